@@ -98,6 +98,51 @@
  */
 #define IFX_MAS_MODULATORF16_OUTPUT_BEHAVIOR_ACTIVE_SHORT_HIGH_LOW (2)
 
+/**
+ * Macro for continuous space vector modulation (both zero vectors [0,0,0] and [1,1,1] in every half period, all phases
+ * switch)
+ */
+#define IFX_MAS_MODULATORF16_MODULATION_MODE_SVPWM                 (0)
+
+/**
+ * Macro for discontinuous modulation with the zero vector [0,0,0] only, the phase with the lowest voltage is clamped to
+ * the low side
+ */
+#define IFX_MAS_MODULATORF16_MODULATION_MODE_DPWMMIN               (1)
+
+/**
+ * Macro for discontinuous modulation with the zero vector [1,1,1] only, the phase with the highest voltage is clamped
+ * to the high side
+ */
+#define IFX_MAS_MODULATORF16_MODULATION_MODE_DPWMMAX               (2)
+
+/**
+ * Macro for discontinuous modulation with the phase of the largest voltage magnitude clamped for 60 degree around its
+ * peak, to the high side at a positive and to the low side at a negative peak
+ */
+#define IFX_MAS_MODULATORF16_MODULATION_MODE_DPWM60                (3)
+
+/**
+ * Macro for modulation in the linear region only, the modulation index is limited to the inscribed circle of the
+ * voltage hexagon (0.907 of six-step)
+ */
+#define IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR            (0)
+
+/**
+ * Macro for overmodulation in two stages towards six-step, both active vectors are kept at least as long as the minimum
+ * sensing time so that the current measurement windows stay valid. The fundamental voltage stays slightly below
+ * six-step.
+ */
+#define IFX_MAS_MODULATORF16_OVERMODULATION_MODE_MEASURABLE        (1)
+
+/**
+ * Macro for overmodulation in two stages up to six-step. Periods with a measurement window shorter than the minimum
+ * sensing time are flagged in currentReconstructionInfo.measurementValid. The pulses are not shifted for the
+ * measurement beyond the linear region. With both overmodulation modes the voltage limit of the current controller,
+ * IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15, has to be raised to make use of the voltage.
+ */
+#define IFX_MAS_MODULATORF16_OVERMODULATION_MODE_SIXSTEP           (2)
+
 /**
  * Contains the module output variables.
  */
@@ -18,10 +18,10 @@
 #include "cmsis_compiler.h"
 
 /* Size of the lookup table used  */
-#define IFX_MAS_MODULATORF16_TABLESIN60SQRT3_LUT_SIZE  (12)
+#define IFX_MAS_MODULATORF16_TABLESIN60SQRT3_LUT_SIZE  (IFX_MAS_MODULATORF16_CFG_LUT_SIZE)
 
 /* Maximum index of the lookup table used, 2^(size) -1  */
-#define IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX (4095U)
+#define IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX ((1U << IFX_MAS_MODULATORF16_TABLESIN60SQRT3_LUT_SIZE) - 1U)
 
 /* Macro to convert angle value to lookup table index */
 #define IFX_MAS_MODULATORF16_ANGLE_TO_INDEX            (15U - IFX_MAS_MODULATORF16_TABLESIN60SQRT3_LUT_SIZE)
@@ -29,6 +29,25 @@
 /* Modulation index max for linear region, normalized by 2/pi */
 #define IFX_MAS_MODULATORF16_CONST_MI_0907_Q15         (18921)
 
+/* Modulation index of six-step operation, 2/pi */
+#define IFX_MAS_MODULATORF16_CONST_MI_SIXSTEP_Q15      (20861)
+
+/* Largest modulation index of the configured overmodulation mode */
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE == IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+#define IFX_MAS_MODULATORF16_MI_LIMIT_Q15              (IFX_MAS_MODULATORF16_CONST_MI_0907_Q15)
+#else
+#define IFX_MAS_MODULATORF16_MI_LIMIT_Q15              (IFX_MAS_MODULATORF16_CONST_MI_SIXSTEP_Q15)
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
+/* Modulation index step between the entries of the overmodulation table, 2^n */
+#define IFX_MAS_MODULATORF16_OVERMODULATION_STEP       (7U)
+
+/* Hold angle of six-step operation, half of a sector in Q15 */
+#define IFX_MAS_MODULATORF16_HOLD_SIXSTEP_Q15          (16384)
+
+/* 1/sqrt(3) in Q15 */
+#define IFX_MAS_MODULATORF16_CONST_INV_SQRT3_Q15       (18919)
+
 /* Ratio from period ticks to compare value */
 #define IFX_MAS_MODULATORF16_MAX_COMPARE_VALUE_RATIO   (2)
 #define IFX_MAS_MODULATORF16_MED_COMPARE_VALUE_RATIO   (4)
@@ -72,6 +91,64 @@ static const Ifx_ComponentVersion Ifx_MHA_ModulatorF16_componentVersion = {
 };
 /* *INDENT-ON* */
 
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+/* Pulse order of one sector of the space vector hexagon */
+typedef struct
+{
+    /* Index of the switching time {t_Right, t_Left} which follows the zero vector at the beginning of the period */
+    uint8 firstTime;
+
+    /* Phase (u, v, w = 0, 1, 2) of the long, middle and short pulse */
+    uint8 phase[3];
+
+    /* Pulse (long, middle, short = 0, 1, 2) of the phases u, v and w */
+    uint8 pulse[3];
+} Ifx_MAS_ModulatorF16_SectorTable;
+
+/* *INDENT-OFF* */
+/* Pulse order of the sectors 0..5, replaces the sector branches of symmetricSwitching, assignOutputs and
+ * compDeadTime */
+static const Ifx_MAS_ModulatorF16_SectorTable Ifx_MAS_ModulatorF16_sectorTable[6] = {
+    {.firstTime = 0U, .phase = {0U, 1U, 2U}, .pulse = {0U, 1U, 2U}},
+    {.firstTime = 1U, .phase = {1U, 0U, 2U}, .pulse = {1U, 0U, 2U}},
+    {.firstTime = 0U, .phase = {1U, 2U, 0U}, .pulse = {2U, 0U, 1U}},
+    {.firstTime = 1U, .phase = {2U, 1U, 0U}, .pulse = {2U, 1U, 0U}},
+    {.firstTime = 0U, .phase = {2U, 0U, 1U}, .pulse = {1U, 2U, 0U}},
+    {.firstTime = 1U, .phase = {0U, 2U, 1U}, .pulse = {0U, 2U, 1U}}
+};
+/* *INDENT-ON* */
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
+
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+/* Reference vector of the overmodulation for one modulation index */
+typedef struct
+{
+    /* Radius of the circle which is clipped at the voltage hexagon, modulation index in Q15 */
+    Ifx_Math_Fract16 radius;
+
+    /* Angle the vector is held at the vertices of the hexagon, fraction of a sector in Q15 */
+    Ifx_Math_Fract16 hold;
+} Ifx_MAS_ModulatorF16_OvermodulationTable;
+
+/* *INDENT-OFF* */
+/* Reference vector for the modulation indices 18921 + 128 * i, i = 0..16, for which the fundamental of the applied
+ * voltage equals the modulation index. Stage I clips a growing circle at the hexagon, until the circle reaches the
+ * vertices (2/3, 0.952 of six-step). Stage II then holds the angle at the vertices, a hold angle of half a sector is
+ * six-step. The last hold angle is extrapolated so that six-step is reached at
+ * IFX_MAS_MODULATORF16_CONST_MI_SIXSTEP_Q15. */
+static const Ifx_MAS_ModulatorF16_OvermodulationTable Ifx_MAS_ModulatorF16_overmodulationTable[17] = {
+    {.radius = 18921, .hold = 0},     {.radius = 19074, .hold = 0},     {.radius = 19259, .hold = 0},
+    {.radius = 19476, .hold = 0},     {.radius = 19735, .hold = 0},     {.radius = 20055, .hold = 0},
+    {.radius = 20483, .hold = 0},     {.radius = 21227, .hold = 0},     {.radius = 21845, .hold = 819},
+    {.radius = 21845, .hold = 1961},  {.radius = 21845, .hold = 3197},  {.radius = 21845, .hold = 4555},
+    {.radius = 21845, .hold = 6086},  {.radius = 21845, .hold = 7881},  {.radius = 21845, .hold = 10165},
+    {.radius = 21845, .hold = 14112}, {.radius = 21845, .hold = 28653}
+};
+/* *INDENT-ON* */
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
 /* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
  * argument." */
 
@@ -109,6 +186,11 @@ static inline void Ifx_MAS_ModulatorF16_modSwitch(Ifx_MAS_ModulatorF16* self, si
 static inline void Ifx_MAS_ModulatorF16_modSwitch(Ifx_MAS_ModulatorF16* self, sint16* compVal,
                                                   sint16* switchingTimes);
 #endif /* IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0 */
+#if IFX_MAS_MODULATORF16_CFG_MODULATION_MODE != IFX_MAS_MODULATORF16_MODULATION_MODE_SVPWM
+
+/* API to move the zero vector time to one zero vector for discontinuous modulation */
+static inline void Ifx_MAS_ModulatorF16_clampPhase(Ifx_MAS_ModulatorF16* self, sint16* cmprVal, sint16* switchingTimes);
+#endif /* IFX_MAS_MODULATORF16_CFG_MODULATION_MODE */
 /* API to limit the switching times */
 static inline void Ifx_MAS_ModulatorF16_limitSwitchTimes(Ifx_MAS_ModulatorF16* self, sint16* cmprVal);
 
@@ -121,6 +203,16 @@ static inline void Ifx_MAS_ModulatorF16_measBegin(Ifx_MAS_ModulatorF16* self, si
 /* API to assign the compare values and triggers */
 static inline void Ifx_MAS_ModulatorF16_assignOutputs(Ifx_MAS_ModulatorF16* self, sint16* cmprVal);
 
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+/* API to calculate the switching times and the actual voltage beyond the linear region */
+static inline void Ifx_MAS_ModulatorF16_overmodulation(Ifx_MAS_ModulatorF16* self, uint16 tableIndex, Ifx_Math_Fract16
+                                                       voltageOverDcLinkVoltage, sint16* switchingTimes);
+
+/* API to check the current measurement windows */
+static inline void Ifx_MAS_ModulatorF16_checkMeasurementWindows(Ifx_MAS_ModulatorF16* self, sint16* cmprVal);
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
 /* API to calculate the effective times of the inverter switching states */
 static inline void Ifx_MAS_ModulatorF16_updatePolar7SegQ16(Ifx_MAS_ModulatorF16* self, uint32 angle, Ifx_Math_Fract16
                                                            voltageOverDcLinkVoltage, Ifx_Math_3PhaseFract16 currents);
@@ -215,6 +307,9 @@ void Ifx_MAS_ModulatorF16_init(Ifx_MAS_ModulatorF16* self)
     /* Set flag for second trigger */
     self->p_output.currentReconstructionInfo.secondTriggerIsSum = true;
 
+    /* Set flag for the measurement windows */
+    self->p_output.currentReconstructionInfo.measurementValid = true;
+
     /* Set substate to bidirectional two phase shift */
     self->p_status.subState = Ifx_MAS_ModulatorF16_SubState_bidirectionalTwoPhase;
 
@@ -512,14 +607,14 @@ static inline uint8 Ifx_MAS_ModulatorF16_limitInputs(Ifx_MAS_ModulatorF16* self,
         dcCheckedAmp = limitedAmp;
     }
 
-    /* Limit modulation index to the Linear Region */
-    if (modIndex > IFX_MAS_MODULATORF16_CONST_MI_0907_Q15)
+    /* Limit modulation index to the linear region, or to six-step with overmodulation */
+    if (modIndex > IFX_MAS_MODULATORF16_MI_LIMIT_Q15)
     {
-        limModIndex  = IFX_MAS_MODULATORF16_CONST_MI_0907_Q15;
+        limModIndex  = IFX_MAS_MODULATORF16_MI_LIMIT_Q15;
         faultStatus |= (uint8)IFX_MAS_MODULATORF16_OVERMODULATION_FAULT_STS;
 
-        /* Write the actual voltage (DC-Link voltage * linear modulation limit) */
-        actualVoltageAmp = Ifx_Math_Mul_F16(dcLinkVoltage, IFX_MAS_MODULATORF16_CONST_MI_0907_Q15);
+        /* Write the actual voltage (DC-Link voltage * modulation limit) */
+        actualVoltageAmp = Ifx_Math_Mul_F16(dcLinkVoltage, IFX_MAS_MODULATORF16_MI_LIMIT_Q15);
     }
     else
     {
@@ -765,6 +860,16 @@ __USED static inline void Ifx_MAS_ModulatorF16_updatePolar7SegQ16(Ifx_MAS_Modula
     switchingTimes[2] = ((self->p_period_tick / IFX_MAS_MODULATORF16_MAX_COMPARE_VALUE_RATIO) - switchingTimes[0] -
                          switchingTimes[1]) / 2;
 
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+    /* Replace the switching times beyond the linear region */
+    if (voltageOverDcLinkVoltage > IFX_MAS_MODULATORF16_CONST_MI_0907_Q15)
+    {
+        Ifx_MAS_ModulatorF16_overmodulation(self, tableIndex, voltageOverDcLinkVoltage, switchingTimes);
+    }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
 #if IFX_MAS_MODULATORF16_CFG_ENABLE_DEADTIME_COMPENSATION == 1
     Ifx_MAS_ModulatorF16_calcSwitchTimes(self, switchingTimes, currents, voltageOverDcLinkVoltage);
 #else
@@ -774,6 +879,139 @@ __USED static inline void Ifx_MAS_ModulatorF16_updatePolar7SegQ16(Ifx_MAS_Modula
 }
 
 
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+static inline void Ifx_MAS_ModulatorF16_overmodulation(Ifx_MAS_ModulatorF16* self, uint16 tableIndex, Ifx_Math_Fract16
+                                                       voltageOverDcLinkVoltage, sint16* switchingTimes)
+{
+    sint16                                          halfPeriod = self->p_period_tick /
+                                                                 IFX_MAS_MODULATORF16_MAX_COMPARE_VALUE_RATIO;
+    const Ifx_MAS_ModulatorF16_OvermodulationTable* entry;
+    sint32                                          fraction;
+    Ifx_Math_Fract16                                radius;
+    sint32                                          hold;
+    sint32                                          sum;
+    Ifx_Math_CmpFract16                             actualVoltage;
+    Ifx_Math_PolarFract16                           actualVoltagePolar;
+
+    /* Table entry below the modulation index and distance to it */
+    uint16 offset = (uint16)(voltageOverDcLinkVoltage - IFX_MAS_MODULATORF16_CONST_MI_0907_Q15);
+    entry    = &Ifx_MAS_ModulatorF16_overmodulationTable[offset >> IFX_MAS_MODULATORF16_OVERMODULATION_STEP];
+    fraction = (sint32)offset & ((1 << IFX_MAS_MODULATORF16_OVERMODULATION_STEP) - 1);
+
+    /* Interpolate the reference vector between the table entries */
+    radius = (Ifx_Math_Fract16)(entry[0].radius + (((entry[1].radius - entry[0].radius) * fraction) >>
+                                                   IFX_MAS_MODULATORF16_OVERMODULATION_STEP));
+    hold   = entry[0].hold + (((entry[1].hold - entry[0].hold) * fraction) >> IFX_MAS_MODULATORF16_OVERMODULATION_STEP);
+
+    if (hold > IFX_MAS_MODULATORF16_HOLD_SIXSTEP_Q15)
+    {
+        hold = IFX_MAS_MODULATORF16_HOLD_SIXSTEP_Q15;
+    }
+
+    /* Stage II: hold the vector at the vertices, stretch the angle in between */
+    hold = (hold * (sint32)(IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX + 1U)) >> 15;
+
+    if ((sint32)tableIndex <= hold)
+    {
+        tableIndex = 0u;
+    }
+    else if ((sint32)tableIndex >= ((sint32)IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX - hold))
+    {
+        tableIndex = (uint16)IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX;
+    }
+    else
+    {
+        tableIndex = (uint16)((((sint32)tableIndex - hold) * (sint32)IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX) /
+                              ((sint32)IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX - (2 * hold)));
+    }
+
+    /* t_Right and t_Left of the circle */
+    switchingTimes[0] = Ifx_Math_MulShR_F16(halfPeriod, Ifx_Math_Mul_F16(radius,
+        Ifx_MAS_ModulatorF16_lutSin60Sqrt3[(IFX_MAS_MODULATORF16_TABLESIN60SQRT3_MAX_INDEX - tableIndex)]), 14u);
+    switchingTimes[1] = Ifx_Math_MulShR_F16(halfPeriod, Ifx_Math_Mul_F16(radius,
+        Ifx_MAS_ModulatorF16_lutSin60Sqrt3[tableIndex]), 14u);
+
+    /* Stage I: clip the vector at the hexagon, the angle is kept */
+    sum = (sint32)switchingTimes[0] + (sint32)switchingTimes[1];
+
+    if (sum > halfPeriod)
+    {
+        switchingTimes[0] = (sint16)(((sint32)switchingTimes[0] * halfPeriod) / sum);
+        switchingTimes[1] = halfPeriod - switchingTimes[0];
+    }
+
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE == IFX_MAS_MODULATORF16_OVERMODULATION_MODE_MEASURABLE
+
+    /* Keep both active vectors as long as the minimum sensing time, the vector moves along the hexagon away from the
+     * vertex */
+    if (switchingTimes[0] < self->p_minSenseTime_tick)
+    {
+        switchingTimes[1] = switchingTimes[1] - (self->p_minSenseTime_tick - switchingTimes[0]);
+        switchingTimes[0] = self->p_minSenseTime_tick;
+    }
+    else if (switchingTimes[1] < self->p_minSenseTime_tick)
+    {
+        switchingTimes[0] = switchingTimes[0] - (self->p_minSenseTime_tick - switchingTimes[1]);
+        switchingTimes[1] = self->p_minSenseTime_tick;
+    }
+    else
+    {
+        /* Both measurement windows are long enough */
+    }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
+    /* t_0 */
+    switchingTimes[2] = (halfPeriod - switchingTimes[0] - switchingTimes[1]) / 2;
+
+    /* The applied vector differs from the reference in amplitude and angle, it is written as actual voltage for the
+     * flux estimator: vector in the sector from the active vectors, amplitude scaled from the modulation index */
+    actualVoltage.real = (Ifx_Math_Fract16)(((2 * (sint32)switchingTimes[0] + (sint32)switchingTimes[1]) << 15) /
+                                            (3 * (sint32)halfPeriod));
+    actualVoltage.imag = (Ifx_Math_Fract16)(((sint32)switchingTimes[1] * IFX_MAS_MODULATORF16_CONST_INV_SQRT3_Q15) /
+                                            halfPeriod);
+    actualVoltagePolar = Ifx_Math_CartToPolar_F16(actualVoltage);
+
+    self->p_output.actualVoltage.amplitude = (Ifx_Math_Fract16)(((sint32)self->p_output.actualVoltage.amplitude *
+                                                                 actualVoltagePolar.amplitude) /
+                                                                voltageOverDcLinkVoltage);
+    self->p_output.actualVoltage.angle = ((uint32)self->p_output.currentReconstructionInfo.sector * 0x2AAAAAABu) +
+                                         actualVoltagePolar.angle;
+}
+
+
+static inline void Ifx_MAS_ModulatorF16_checkMeasurementWindows(Ifx_MAS_ModulatorF16* self, sint16* cmprVal)
+{
+    /* The first window begins with the long pulse and ends with the middle or short pulse, whichever comes first */
+    sint16 firstWindow = ((cmprVal[1] < cmprVal[2]) ? cmprVal[1] : cmprVal[2]) - cmprVal[0];
+    sint16 secondWindow;
+
+    /* The second window is between the short pulse and the later of the long and middle pulse (sum of two currents)
+     * or between the earlier of the long and middle pulse and the short pulse (one current) */
+    if (self->p_output.currentReconstructionInfo.secondTriggerIsSum == true)
+    {
+        secondWindow = cmprVal[5] - ((cmprVal[3] > cmprVal[4]) ? cmprVal[3] : cmprVal[4]);
+    }
+    else
+    {
+        secondWindow = ((cmprVal[3] < cmprVal[4]) ? cmprVal[3] : cmprVal[4]) - cmprVal[5];
+    }
+
+    /* Both windows have to cover ringing, measurement and dead time */
+    if ((firstWindow < self->p_minSenseTime_tick)
+        || (secondWindow < self->p_minSenseTime_tick))
+    {
+        self->p_output.currentReconstructionInfo.measurementValid = false;
+    }
+    else
+    {
+        self->p_output.currentReconstructionInfo.measurementValid = true;
+    }
+}
+
+
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
 #if IFX_MAS_MODULATORF16_CFG_ENABLE_DEADTIME_COMPENSATION == 1
 static inline void Ifx_MAS_ModulatorF16_calcSwitchTimes(Ifx_MAS_ModulatorF16* self, sint16* switchingTimes,
                                                         Ifx_Math_3PhaseFract16 currents, Ifx_Math_Fract16
@@ -818,11 +1056,30 @@ static inline void Ifx_MAS_ModulatorF16_calcSwitchTimes(Ifx_MAS_ModulatorF16*sel
             && (self->p_status.subState == Ifx_MAS_ModulatorF16_SubState_bidirectionalThreePhase)))
     {
         self->p_status.subState = Ifx_MAS_ModulatorF16_SubState_bidirectionalThreePhase;
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE == IFX_MAS_MODULATORF16_OVERMODULATION_MODE_SIXSTEP
+
+        /* Beyond the linear region the pulses are not shifted, the applied voltage has priority over the measurement
+         * windows */
+        if (voltageOverDcLinkVoltage > IFX_MAS_MODULATORF16_CONST_MI_0907_Q15)
+        {
+            self->p_output.currentReconstructionInfo.secondTriggerIsSum = true;
+        }
+        else
+        {
+#if IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0
+            Ifx_MAS_ModulatorF16_modSwitch(self, cmprVal, switchingTimes, isSevenSegment);
+#else
+            Ifx_MAS_ModulatorF16_modSwitch(self, cmprVal, switchingTimes);
+#endif /* IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK */
+        }
+
+#else
 #if IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0
         Ifx_MAS_ModulatorF16_modSwitch(self, cmprVal, switchingTimes, isSevenSegment);
 #else
         Ifx_MAS_ModulatorF16_modSwitch(self, cmprVal, switchingTimes);
 #endif /* IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK */
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
     }
     else
     {
@@ -830,9 +1087,21 @@ static inline void Ifx_MAS_ModulatorF16_calcSwitchTimes(Ifx_MAS_ModulatorF16*sel
         Ifx_MAS_ModulatorF16_modSwitchSmallAmplitude(self, cmprVal);
     }
 
+#if IFX_MAS_MODULATORF16_CFG_MODULATION_MODE != IFX_MAS_MODULATORF16_MODULATION_MODE_SVPWM
+
+    /* Clamp one phase for discontinuous modulation, the measurement windows are kept */
+    Ifx_MAS_ModulatorF16_clampPhase(self, cmprVal, switchingTimes);
+#endif /* IFX_MAS_MODULATORF16_CFG_MODULATION_MODE */
+
     /* Limit switching times between the defined limits */
     Ifx_MAS_ModulatorF16_limitSwitchTimes(self, cmprVal);
 
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+    /* Flag measurement windows which are too short */
+    Ifx_MAS_ModulatorF16_checkMeasurementWindows(self, cmprVal);
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+
     /* Calculate the triggers based on sector */
     Ifx_MAS_ModulatorF16_calcTriggers(self, cmprVal);
 
@@ -843,6 +1112,17 @@ static inline void Ifx_MAS_ModulatorF16_calcSwitchTimes(Ifx_MAS_ModulatorF16*sel
 
 static inline void Ifx_MAS_ModulatorF16_symmetricSwitching(sint16* cmprVal, sint16* switchingTimes, uint8 sector)
 {
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Switching time of the first active vector of the sector, the short pulse ends after both active vectors */
+    sint16 firstActiveTime = (Ifx_MAS_ModulatorF16_sectorTable[sector].firstTime == 0u) ? switchingTimes[0] :
+                             switchingTimes[1];
+
+    cmprVal[0] = switchingTimes[2];
+    cmprVal[1] = firstActiveTime + switchingTimes[2];
+    cmprVal[2] = switchingTimes[0] + switchingTimes[1] + switchingTimes[2];
+#else
+
     if ((sector & 1u) == 1u)
     {
         /* sector 1,3,5 */
@@ -857,6 +1137,8 @@ static inline void Ifx_MAS_ModulatorF16_symmetricSwitching(sint16* cmprVal, sint
         cmprVal[1] = switchingTimes[0] + switchingTimes[2];
         cmprVal[2] = switchingTimes[1] + cmprVal[1];
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
@@ -879,6 +1161,37 @@ static inline void Ifx_MAS_ModulatorF16_modSwitch(Ifx_MAS_ModulatorF16*self, sin
     /* In this mode the second trigger always measures two currents */
     self->p_output.currentReconstructionInfo.secondTriggerIsSum = true;
 
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Ticks missing in the smaller measurement window (tL or tR), zero if both windows can be measured. The pulses are
+     * always shifted, by zero ticks if the windows are large enough.
+     * Note: shiftValue is negative or zero!*/
+    shiftValue = ((switchingTimes[0] < switchingTimes[1]) ? switchingTimes[0] : switchingTimes[1]) -
+                 self->p_minSenseTime_tick;
+    shiftValue = (shiftValue < 0) ? shiftValue : 0;
+
+    /* Shift the large and the short pulse half value to the left and the middle pulse to the right */
+    sint16 shiftValueHalfFixed = (sint16)(shiftValue / 2);
+    compVal[0] = compVal[0] + shiftValueHalfFixed;
+    compVal[3] = compVal[3] - shiftValueHalfFixed;
+
+#if IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0
+
+    /* polyspace +2 MISRA-C3:10.1 [Justified:Low] "Right shift of signed integer is used for better performance and
+     * justified since arithmetic shift is supported on all target architectures/compilers." */
+    sint16 shiftValueCond = (sint16)(shiftValue >> isSevenSegment);
+    compVal[1] = compVal[1] - shiftValueCond;
+    compVal[4] = compVal[4] + shiftValueCond;
+    compVal[2] = compVal[2] + ((sint16)isSevenSegment * shiftValueCond);
+    compVal[5] = compVal[5] - ((sint16)isSevenSegment * shiftValueCond);
+#else
+    compVal[1] = compVal[1] - shiftValueHalfFixed;
+    compVal[4] = compVal[4] + shiftValueHalfFixed;
+    compVal[2] = compVal[2] + shiftValueHalfFixed;
+    compVal[5] = compVal[5] - shiftValueHalfFixed;
+#endif /* IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0 */
+#else
+
     /* Is at least one of the measurement windows (tL and/or tR) too small to be measured? */
     if ((switchingTimes[0] < self->p_minSenseTime_tick)
         || (switchingTimes[1] < self->p_minSenseTime_tick))
@@ -937,6 +1250,8 @@ static inline void Ifx_MAS_ModulatorF16_modSwitch(Ifx_MAS_ModulatorF16*self, sin
 
 #endif /* IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK != 0 */
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
@@ -955,6 +1270,30 @@ static inline void Ifx_MAS_ModulatorF16_modSwitchSmallAmplitude(Ifx_MAS_Modulato
     /* Get the margin of the current measurement window for the first measurement trigger */
     marginMeasurementWindowLeft = cmprVal[1] - cmprVal[0] - self->p_minSenseTime_tick;
 
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Shift the long pulse to the left by the missing ticks, zero if the window is large enough */
+    marginMeasurementWindowLeft = (marginMeasurementWindowLeft < 0) ? marginMeasurementWindowLeft : 0;
+    cmprVal[0]                  = cmprVal[0] + marginMeasurementWindowLeft;
+    cmprVal[3]                  = cmprVal[3] - marginMeasurementWindowLeft;
+
+    /* Second last and last switching event of the count down phase */
+    secondLastCmprVal = (cmprVal[3] > cmprVal[4]) ? cmprVal[3] : cmprVal[4];
+    lastCmprVal       = (cmprVal[3] > cmprVal[4]) ? cmprVal[4] : cmprVal[3];
+
+    /* Get the current measurement window for the second measurement trigger */
+    marginMeasurementWindowRight = cmprVal[5] - secondLastCmprVal - self->p_minSenseTime_tick;
+
+    /* The second trigger measures two currents if the window is large enough, else the short pulse is shifted to the
+     * right behind the last compare value and the second trigger measures one current */
+    bool   secondTriggerIsSum = (marginMeasurementWindowRight < 0) ? false : true;
+    sint16 shiftRight         = (secondTriggerIsSum == true) ? 0 : (cmprVal[2] - lastCmprVal +
+                                                                     self->p_minSenseTime_tick);
+    cmprVal[2] = cmprVal[2] + shiftRight;
+    cmprVal[5] = cmprVal[5] - shiftRight;
+    self->p_output.currentReconstructionInfo.secondTriggerIsSum = secondTriggerIsSum;
+#else
+
     /* Shift the long pulse to the left if the window is not enough for a current measurement */
     if (marginMeasurementWindowLeft < 0)
     {
@@ -1001,15 +1340,111 @@ static inline void Ifx_MAS_ModulatorF16_modSwitchSmallAmplitude(Ifx_MAS_Modulato
         /* Set the flag that the second trigger measure two currents */
         self->p_output.currentReconstructionInfo.secondTriggerIsSum = true;
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
 /* polyspace-end CODE-METRIC:VOCF [Justified:Low] "Language scope code metric is justified because the second
  * parameter actually points to an array of unique compare values" */
+
+#if IFX_MAS_MODULATORF16_CFG_MODULATION_MODE != IFX_MAS_MODULATORF16_MODULATION_MODE_SVPWM
+static inline void Ifx_MAS_ModulatorF16_clampPhase(Ifx_MAS_ModulatorF16* self, sint16* cmprVal, sint16* switchingTimes)
+{
+    /* Clamp to the high side (zero vector [1,1,1] only) or to the low side (zero vector [0,0,0] only) */
+    bool  clampHigh;
+    uint8 half;
+
+#if IFX_MAS_MODULATORF16_CFG_MODULATION_MODE == IFX_MAS_MODULATORF16_MODULATION_MODE_DPWMMIN
+    clampHigh = false;
+    (void)switchingTimes;
+#elif IFX_MAS_MODULATORF16_CFG_MODULATION_MODE == IFX_MAS_MODULATORF16_MODULATION_MODE_DPWMMAX
+    clampHigh = true;
+    (void)switchingTimes;
+#else
+
+    /* The first active vector of a sector is t_Right in the sectors 0,2,4 and t_Left in the sectors 1,3,5. While it is
+     * the longer one, the long pulse belongs to the phase with the largest voltage magnitude, which is clamped high.
+     * Else it is the short pulse, which is clamped low. */
+    if ((self->p_output.currentReconstructionInfo.sector & 1u) == 1u)
+    {
+        clampHigh = (switchingTimes[1] > switchingTimes[0]) ? true : false;
+    }
+    else
+    {
+        clampHigh = (switchingTimes[0] > switchingTimes[1]) ? true : false;
+    }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_MODULATION_MODE */
+
+    /* The count up (cmprVal[0...2]) and the count down (cmprVal[3...5]) values are moved by a common offset, so that
+     * the first or last switching event of the half period reaches the limit. The line to line voltages and the
+     * distances between the switching events, i.e. the measurement windows of the shifted pulses, are not changed. */
+    for (half = 0; half < 6u; half += 3u)
+    {
+        sint16 offset;
+
+        if (clampHigh == true)
+        {
+            /* First switching event to 0 */
+            offset = cmprVal[half];
+
+            if (cmprVal[half + 1u] < offset)
+            {
+                offset = cmprVal[half + 1u];
+            }
+
+            if (cmprVal[half + 2u] < offset)
+            {
+                offset = cmprVal[half + 2u];
+            }
+
+            offset = -offset;
+        }
+        else
+        {
+            /* Last switching event to half of the period */
+            offset = cmprVal[half];
+
+            if (cmprVal[half + 1u] > offset)
+            {
+                offset = cmprVal[half + 1u];
+            }
+
+            if (cmprVal[half + 2u] > offset)
+            {
+                offset = cmprVal[half + 2u];
+            }
+
+            offset = (self->p_period_tick / IFX_MAS_MODULATORF16_MAX_COMPARE_VALUE_RATIO) - offset;
+        }
+
+        cmprVal[half]      = cmprVal[half] + offset;
+        cmprVal[half + 1u] = cmprVal[half + 1u] + offset;
+        cmprVal[half + 2u] = cmprVal[half + 2u] + offset;
+    }
+}
+
+
+#endif /* IFX_MAS_MODULATORF16_CFG_MODULATION_MODE */
 static inline void Ifx_MAS_ModulatorF16_limitSwitchTimes(Ifx_MAS_ModulatorF16* self, sint16* cmprVal)
 {
     uint8 i;
 
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Upper limit of the compare values */
+    sint16 upperLimit = self->p_period_tick / IFX_MAS_MODULATORF16_MAX_COMPARE_VALUE_RATIO;
+
+    /* Limit compare values by selection */
+    for (i = 0; i < 6; i++)
+    {
+        sint16 limited = (cmprVal[i] > upperLimit) ? upperLimit : cmprVal[i];
+        cmprVal[i] = (limited < 0) ? 0 : limited;
+    }
+
+#else
+
     /* Limit compare values */
     for (i = 0; i < 6; i++)
     {
@@ -1029,11 +1464,39 @@ static inline void Ifx_MAS_ModulatorF16_limitSwitchTimes(Ifx_MAS_ModulatorF16* s
             /* Do nothing */
         }
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
 static inline void Ifx_MAS_ModulatorF16_calcTriggers(Ifx_MAS_ModulatorF16* self, sint16* cmprVal)
 {
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Measuring from the end */
+    bool   measureEnd = (self->p_currentMeasurement.p_measurementPoint ==
+                         Ifx_MAS_ModulatorF16_measurementPoint_end) ? true : false;
+
+    /* The second trigger measures one current */
+    bool   measureOne = (self->p_output.currentReconstructionInfo.secondTriggerIsSum == true) ? false : true;
+
+    /* Delay of the triggers after the beginning or before the end of the measurement windows */
+    sint16 delta = (measureEnd == true) ? (sint16)(-self->p_currentMeasurement.p_deltaEnd_tick) :
+                   self->p_currentMeasurement.p_deltaBegin_tick;
+
+    /* The first window begins with the long pulse and ends with the middle or short pulse, whichever comes first */
+    sint16 firstEdge = (measureEnd == true) ? ((cmprVal[1] < cmprVal[2]) ? cmprVal[1] : cmprVal[2]) : cmprVal[0];
+
+    /* The second window begins with the short pulse (sum of two currents) or the earlier of the long and middle pulse
+     * (one current), it ends with the later of the long and middle pulse (sum) or the short pulse (one current) */
+    sint16 earlierEdge = (cmprVal[3] < cmprVal[4]) ? cmprVal[3] : cmprVal[4];
+    sint16 laterEdge   = (cmprVal[3] < cmprVal[4]) ? cmprVal[4] : cmprVal[3];
+    sint16 secondEdge  = (measureEnd == measureOne) ? cmprVal[5] : ((measureEnd == true) ? laterEdge : earlierEdge);
+
+    self->p_output.triggerTime_tick[0] = (uint16)((sint16)(firstEdge + delta));
+    self->p_output.triggerTime_tick[1] = (uint16)((sint16)((sint16)(self->p_period_tick - secondEdge) + delta));
+#else
+
     if (self->p_currentMeasurement.p_measurementPoint == Ifx_MAS_ModulatorF16_measurementPoint_beginning)
     {
         /* Measuring from the begin */
@@ -1044,6 +1507,8 @@ static inline void Ifx_MAS_ModulatorF16_calcTriggers(Ifx_MAS_ModulatorF16* self,
         /* Measuring from the end */
         Ifx_MAS_ModulatorF16_measEnd(self, cmprVal);
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
@@ -1103,6 +1568,19 @@ static inline void Ifx_MAS_ModulatorF16_measEnd(Ifx_MAS_ModulatorF16* self, sint
  * according to the correct sector is implemented as a switch-case" */
 static inline void Ifx_MAS_ModulatorF16_assignOutputs(Ifx_MAS_ModulatorF16* self, sint16* cmprVal)
 {
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Phases of the long, middle and short pulse */
+    const uint8* phase = Ifx_MAS_ModulatorF16_sectorTable[self->p_output.currentReconstructionInfo.sector].phase;
+    uint8        i;
+
+    for (i = 0; i < 3u; i++)
+    {
+        self->p_output.compareValues_tick[phase[i]]      = (uint16)cmprVal[i];
+        self->p_output.compareValues_tick[phase[i] + 3u] = (uint16)((sint16)(self->p_period_tick - cmprVal[i + 3u]));
+    }
+
+#else
     switch (self->p_output.currentReconstructionInfo.sector)
     {
         case 0:
@@ -1159,6 +1637,7 @@ static inline void Ifx_MAS_ModulatorF16_assignOutputs(Ifx_MAS_ModulatorF16* self
             self->p_output.compareValues_tick[4] = (uint16)((sint16)(self->p_period_tick - cmprVal[5]));
             break;
     }
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
@@ -1171,6 +1650,17 @@ static inline void Ifx_MAS_ModulatorF16_compDeadTime(Ifx_MAS_ModulatorF16* self,
 {
     uint8 sector = self->p_output.currentReconstructionInfo.sector;
 
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Pulses of the phases */
+    const uint8* pulse = Ifx_MAS_ModulatorF16_sectorTable[sector].pulse;
+
+    /* Compensate the dead time of each phases */
+    Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.u, pulse[0]);
+    Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.v, pulse[1]);
+    Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.w, pulse[2]);
+#else
+
     /* Map the long, middle, short pulse back to phases */
     uint8 vecMapPhaseU[] = {0, 1, 2, 2, 1, 0};
     uint8 vecMapPhaseV[] = {1, 0, 0, 1, 2, 2};
@@ -1180,12 +1670,20 @@ static inline void Ifx_MAS_ModulatorF16_compDeadTime(Ifx_MAS_ModulatorF16* self,
     Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.u, vecMapPhaseU[sector]);
     Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.v, vecMapPhaseV[sector]);
     Ifx_MAS_ModulatorF16_compPhaseDeadTime(self, cmprVal, currents.w, vecMapPhaseW[sector]);
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
 static inline void Ifx_MAS_ModulatorF16_compPhaseDeadTime(Ifx_MAS_ModulatorF16* self, sint16* cmprVal,
                                                           Ifx_Math_Fract16 phaseCurrent, uint8 phaseOffset)
 {
+#if IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE == 1
+
+    /* Shorten the pulse for positive currents, lengthen it for negative currents */
+    cmprVal[phaseOffset] = cmprVal[phaseOffset] + ((phaseCurrent >= 0) ? (sint16)(-self->p_deadTimeCompensation) :
+                                                   self->p_deadTimeCompensation);
+#else
+
     if (phaseCurrent >= 0)
     {
         cmprVal[phaseOffset] = cmprVal[phaseOffset] - self->p_deadTimeCompensation;
@@ -1194,6 +1692,8 @@ static inline void Ifx_MAS_ModulatorF16_compPhaseDeadTime(Ifx_MAS_ModulatorF16*
     {
         cmprVal[phaseOffset] = cmprVal[phaseOffset] + self->p_deadTimeCompensation;
     }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE */
 }
 
 
@@ -160,6 +160,65 @@ typedef enum Ifx_MDA_FluxEstimatorF16_Mode
     Ifx_MDA_FluxEstimatorF16_Mode_enable  = 1  /**<Speed and angle estimation of the rotor flux is enabled*/
 } Ifx_MDA_FluxEstimatorF16_Mode;
 
+/**
+ * Parameters of the Flux Estimator including the coefficients derived from them, as returned by
+ * Ifx_MDA_FluxEstimatorF16_getParameters() and taken by Ifx_MDA_FluxEstimatorF16_initParameters()
+ */
+typedef struct Ifx_MDA_FluxEstimatorF16_Parameters
+{
+    /**
+     * Sampling time of the Flux Estimator and of its filters, in microseconds
+     */
+    uint32 samplingTime_us;
+
+    /**
+     * Time constants of the alpha, beta and speed filters, in microseconds
+     */
+    uint32 alphaTimeConstant_us;
+    uint32 betaTimeConstant_us;
+    uint32 speedTimeConstant_us;
+
+    /**
+     * Proportional gain of the PLL
+     */
+    Ifx_Math_Fract16Q pllPropGain;
+
+    /**
+     * Proportional gain of the PLL multiplied by the sampling time, in the Q format of the gain
+     */
+    Ifx_Math_Fract16 pllPropGainSamplingTime;
+
+    /**
+     * Discrete coefficients of the alpha, beta and speed filters, in Q15
+     */
+    Ifx_Math_Fract16 alphaTimeConstCoeff;
+    Ifx_Math_Fract16 betaTimeConstCoeff;
+    Ifx_Math_Fract16 speedTimeConstCoeff;
+
+    /**
+     * Gains of the alpha and beta filters, in Q14
+     */
+    Ifx_Math_Fract16 alphaGainQ14;
+    Ifx_Math_Fract16 betaGainQ14;
+
+    /**
+     * Conversion factor from rad to rad/s
+     */
+    Ifx_Math_Fract16 radToRadPerSecondQ7;
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /**
+     * Integral gain of the PLL
+     */
+    Ifx_Math_Fract16Q pllIntegGain;
+
+    /**
+     * Integral gain of the PLL multiplied by the square of the sampling time, in Q31
+     */
+    Ifx_Math_Fract32 pllIntegGainSamplingTimeQ31;
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+} Ifx_MDA_FluxEstimatorF16_Parameters;
+
 /**
  * \brief Data structure that stores all data of module instance.
  *
@@ -216,6 +275,60 @@ typedef struct Ifx_MDA_FluxEstimatorF16
  */
 void Ifx_MDA_FluxEstimatorF16_init(Ifx_MDA_FluxEstimatorF16* self);
 
+/**
+ *  \brief Initialize the module to the default values and to the given parameters.
+ *
+ *  Same as Ifx_MDA_FluxEstimatorF16_init(), but the sampling time, the filter and PLL coefficients are taken as
+ * calculated before instead of being calculated from the Config Wizard values, so there is no division, e.g. for the
+ * start-up from parameters stored in non volatile memory.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] parameters Parameters as returned by Ifx_MDA_FluxEstimatorF16_getParameters()
+ *
+ */
+void Ifx_MDA_FluxEstimatorF16_initParameters(Ifx_MDA_FluxEstimatorF16* self, const
+                                             Ifx_MDA_FluxEstimatorF16_Parameters* parameters);
+
+/**
+ *  \brief Get the parameters of the module including the coefficients derived from them.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [out] parameters Parameters of the module
+ *
+ */
+void Ifx_MDA_FluxEstimatorF16_getParameters(Ifx_MDA_FluxEstimatorF16* self, Ifx_MDA_FluxEstimatorF16_Parameters*
+                                            parameters);
+
+/**
+ *  \brief Calculate the parameters of the module for another sampling time.
+ *
+ *  The time constants and gains are those of the module, the filter and PLL coefficients and the conversion factor are
+ * calculated for the given sampling time, e.g. outside of the fast loop for Ifx_MDA_FluxEstimatorF16_setParameters().
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *  \param [out] parameters Parameters of the module at the given sampling time
+ *
+ */
+void Ifx_MDA_FluxEstimatorF16_calcParameters(Ifx_MDA_FluxEstimatorF16* self, uint32 samplingTime_us,
+                                             Ifx_MDA_FluxEstimatorF16_Parameters* parameters);
+
+/**
+ *  \brief Take over parameters calculated before while the module runs.
+ *
+ *  Unlike Ifx_MDA_FluxEstimatorF16_initParameters(), the filter states, the PLL, the outputs and the mode are kept,
+ * and the rate of change held by the PLL is scaled to the new sampling time, see Ifx_Math_PLLF16_scaleRate(). There is
+ * no division, e.g. for a change of the sampling time within the fast loop.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] parameters Parameters as returned by Ifx_MDA_FluxEstimatorF16_calcParameters()
+ *  \param [in] rateRatioQ16 New sampling time divided by the one in use, in Q16
+ *
+ */
+void Ifx_MDA_FluxEstimatorF16_setParameters(Ifx_MDA_FluxEstimatorF16* self, const Ifx_MDA_FluxEstimatorF16_Parameters*
+                                            parameters, Ifx_Math_Fract32 rateRatioQ16);
+
 /**
  *  \brief Perform estimation of the rotor flux rotational speed and position.
  *
@@ -14,6 +14,26 @@
  * This module takes as input the currents in alpha-beta format, the direct and quadrature reference currents and the
  * rotor flux angle, performs the current control using two PI controllers, and outputs the voltage command, in polar
  * format. It also takes the electrical speed as input and performs dq decoupling if enabled​.
+ *
+ * With IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE the angle of the voltage command is extrapolated by the
+ * electrical speed times the delay compensation time, i.e. the time from the current sampling to the middle of the
+ * interval in which the inverter applies the voltage command. The time is zero after the initialization, the FOC
+ * solution sets it from its current loop factor and PWM period.
+ *
+ * With IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE the PI controllers are replaced by a deadbeat controller based on
+ * the d-q model of the motor (resistance, d and q inductance and permanent magnet flux of the configuration). It
+ * predicts the current at the next sampling from the voltage commands which are applied meanwhile, and commands the
+ * voltage which brings the predicted current to the command within one further sampling period. A voltage command is
+ * applied from the end of the next sampling period, half a PWM period after its sampling, so the carry-over of the
+ * previous voltage command into the next sampling interval is included in both. A disturbance observer integrates the
+ * prediction error into a voltage which is added to the model, so that deviations of the model, e.g. of the inverter
+ * or of the parameters, do not leave a steady state current error. Below a sampling time of two PWM periods the gain
+ * is the one of two PWM periods. The prediction is made in the d-q reference system of the sampling, so the deadbeat
+ * controller requires the delay compensation.
+ *
+ * With IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE the PI controllers are executed inline with the Q formats
+ * of the configuration as constants, see Ifx_Math_PiConstF16.h. The Q formats of currentDPi and currentQPi must then
+ * not be changed by another Ifx_Math_PiF16_init().
  */
 
 #ifndef IFX_MDA_FOCCONTROLLERF16_H
@@ -25,6 +45,10 @@
 #include "Ifx_Math_DqDecouplingF16.h"
 #include "Ifx_Math_PiF16.h"
 
+#if (IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1) && (IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE != 1)
+#error "IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE requires the delay compensation to be enabled"
+#endif
+
 /**
  * Base voltage, in V
  * <table>
@@ -133,6 +157,38 @@ typedef struct Ifx_MDA_FocControllerF16_Output
     Ifx_Math_PolarFract16 voltageCommandPolar;
 } Ifx_MDA_FocControllerF16_Output;
 
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+/**
+ * Coefficients of the deadbeat controller which depend on the sampling time, as calculated by
+ * Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs()
+ */
+typedef struct Ifx_MDA_FocControllerF16_DeadbeatCoeffs
+{
+    /**
+     * Sampling time of the deadbeat controller, in microseconds
+     */
+    uint32 samplingTime_us;
+
+    /**
+     * D and q inductance divided by the normalized sampling time, in Q12
+     */
+    Ifx_Math_Fract16 deadbeatGainDQ12;
+    Ifx_Math_Fract16 deadbeatGainQQ12;
+
+    /**
+     * Normalized sampling time divided by the d and q inductance, in Q12
+     */
+    Ifx_Math_Fract16 predictionGainDQ12;
+    Ifx_Math_Fract16 predictionGainQQ12;
+
+    /**
+     * Half a PWM period divided by the sampling time, in Q15
+     */
+    Ifx_Math_Fract16 carryOverQ15;
+} Ifx_MDA_FocControllerF16_DeadbeatCoeffs;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
 /**
  * \brief Data structure that stores all data of module instance.
  *
@@ -178,6 +234,66 @@ typedef struct Ifx_MDA_FocControllerF16
      * Q-PI controller  antiWindup control
      */
     sint8 p_qAntiwindupCtrl;
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /**
+     * Delay compensation time, in microseconds
+     */
+    uint32 p_delayCompensationTime_us;
+
+    /**
+     * Angle advance of the voltage command per normalized electrical speed 2^-15
+     */
+    sint32 p_delayCompensationGain;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /**
+     * Sampling time of the deadbeat controller, in microseconds
+     */
+    uint32 p_samplingTime_us;
+
+    /**
+     * D inductance divided by the normalized sampling time, in Q12
+     */
+    Ifx_Math_Fract16 p_deadbeatGainDQ12;
+
+    /**
+     * Q inductance divided by the normalized sampling time, in Q12
+     */
+    Ifx_Math_Fract16 p_deadbeatGainQQ12;
+
+    /**
+     * Normalized sampling time divided by the d inductance, in Q12
+     */
+    Ifx_Math_Fract16 p_predictionGainDQ12;
+
+    /**
+     * Normalized sampling time divided by the q inductance, in Q12
+     */
+    Ifx_Math_Fract16 p_predictionGainQQ12;
+
+    /**
+     * Part of the sampling period in which the previous voltage command is still applied, i.e. half a PWM period
+     * divided by the sampling time, in Q15
+     */
+    Ifx_Math_Fract16 p_carryOverQ15;
+
+    /**
+     * Voltage command of the previous execution
+     */
+    Ifx_Math_CmpFract16 p_previousVoltageDQ;
+
+    /**
+     * Current predicted by the previous execution for the present sampling
+     */
+    Ifx_Math_CmpFract16 p_predictedCurrentDQ;
+
+    /**
+     * Voltage missing in the d-q model, estimated by the disturbance observer
+     */
+    Ifx_Math_CmpFract16 p_disturbanceVoltageDQ;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
 } Ifx_MDA_FocControllerF16;
 
 /**
@@ -195,17 +311,23 @@ void Ifx_MDA_FocControllerF16_init(Ifx_MDA_FocControllerF16* self);
  *  This API executes the current regulation of the Field Oriented Controller (FOC). It performs the Park transformation
  * and executes the PI controllers of the D and Q currents and outputs the resulting voltage vector in polar
  * coordinates. Additionally, if enabled, it compensates for the d-q decoupling, and if enabled, it limits the amplitude
- * of the output voltage vector according to the available DC link voltage with a D component prioritization.
+ * of the output voltage vector according to the available DC link voltage with a D component prioritization. If the
+ * deadbeat controller is enabled, it replaces the PI controllers and the d-q decoupling.
  *
  *  Inputs to this API:
  *  <ul>
  *      <li>Reference D and Q currents, normalized in Q15 format</li>
  *      <li>Measured alpha and beta currents, normalized in Q15 format</li>
  *      <li>Rotor flux angle between 0 and 2*pi, normalized to  0 to 2^32-1</li>
- *      <li>Electrical speed, needed to compensate for the d-q decoupling, normalized in Q15 format</li>
+ *      <li>Electrical speed, needed to compensate for the d-q decoupling, the back EMF of the deadbeat controller and
+ * the delay, normalized in Q15 format</li>
  *      <li>DC Link voltage, needed to limit the amplitude of the output voltage vector, normalized in Q15 format</li>
  *  </ul>
  *
+ *  If the delay compensation is enabled, the rotor flux angle used for the voltage command is advanced by the
+ * electrical speed times the delay compensation time. The Park transformation uses the rotor flux angle unchanged, as
+ * the measured current belongs to it.
+ *
  *  Outputs to this API:
  *  <ul>
  *      <li>Calculated voltage vector in polar coordinates containing the amplitude normalized in Q15 format and the
@@ -290,6 +412,145 @@ static inline sint8 Ifx_MDA_FocControllerF16_getQVoltageSatStatus(Ifx_MDA_FocCon
 }
 
 
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+/**
+ *  \brief Set the delay compensation time in microseconds, between [0us, 1000us].
+ *
+ *  The delay compensation time is the time from the current sampling to the middle of the interval in which the
+ * voltage command is applied. Larger values are limited to 1000us.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] delayCompensationTime_us Delay compensation time, in microseconds
+ *
+ */
+void Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(Ifx_MDA_FocControllerF16* self, uint32
+                                                          delayCompensationTime_us);
+
+/**
+ *  \brief Get the delay compensation time in microseconds.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Delay compensation time, in microseconds
+ */
+static inline uint32 Ifx_MDA_FocControllerF16_getDelayCompensationTime_us(Ifx_MDA_FocControllerF16* self)
+{
+    return self->p_delayCompensationTime_us;
+}
+
+
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+/**
+ *  \brief Set the sampling time of the deadbeat controller in microseconds, between [1us, 2000us].
+ *
+ *  The gains and the carry-over of the deadbeat controller are recalculated from the sampling time.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *
+ */
+void Ifx_MDA_FocControllerF16_setSamplingTime_us(Ifx_MDA_FocControllerF16* self, uint32 samplingTime_us);
+
+/**
+ *  \brief Initialize the module to the default values, with the gains and the carry-over of the deadbeat controller
+ * as calculated before, without division.
+ *
+ *  Same as Ifx_MDA_FocControllerF16_init() followed by Ifx_MDA_FocControllerF16_setSamplingTime_us(), e.g. with the
+ *  coefficients stored in a parameter block.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] coeffs Coefficients as returned by Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs()
+ *
+ */
+void Ifx_MDA_FocControllerF16_initDeadbeatCoeffs(Ifx_MDA_FocControllerF16* self, const
+                                                 Ifx_MDA_FocControllerF16_DeadbeatCoeffs* coeffs);
+
+/**
+ *  \brief Calculate the gains and the carry-over of the deadbeat controller for a sampling time, as set by
+ * Ifx_MDA_FocControllerF16_setSamplingTime_us(), e.g. outside of the fast loop.
+ *
+ *
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *  \param [out] coeffs Coefficients at the given sampling time
+ *
+ */
+void Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs(uint32 samplingTime_us, Ifx_MDA_FocControllerF16_DeadbeatCoeffs*
+                                                 coeffs);
+
+/**
+ *  \brief Set the gains and the carry-over of the deadbeat controller as calculated before, without division.
+ *
+ *  The states of the deadbeat controller are kept, e.g. for a change of the sampling time within the fast loop.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] coeffs Coefficients as returned by Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs()
+ *
+ */
+static inline void Ifx_MDA_FocControllerF16_setDeadbeatCoeffs(Ifx_MDA_FocControllerF16* self, const
+                                                              Ifx_MDA_FocControllerF16_DeadbeatCoeffs* coeffs)
+{
+    self->p_samplingTime_us    = coeffs->samplingTime_us;
+    self->p_deadbeatGainDQ12   = coeffs->deadbeatGainDQ12;
+    self->p_deadbeatGainQQ12   = coeffs->deadbeatGainQQ12;
+    self->p_predictionGainDQ12 = coeffs->predictionGainDQ12;
+    self->p_predictionGainQQ12 = coeffs->predictionGainQQ12;
+    self->p_carryOverQ15       = coeffs->carryOverQ15;
+}
+
+
+/**
+ *  \brief Get the gains and the carry-over of the deadbeat controller, e.g. to store them for
+ * Ifx_MDA_FocControllerF16_initDeadbeatCoeffs().
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [out] coeffs Coefficients at the current sampling time
+ *
+ */
+static inline void Ifx_MDA_FocControllerF16_getDeadbeatCoeffs(Ifx_MDA_FocControllerF16* self,
+                                                              Ifx_MDA_FocControllerF16_DeadbeatCoeffs* coeffs)
+{
+    coeffs->samplingTime_us    = self->p_samplingTime_us;
+    coeffs->deadbeatGainDQ12   = self->p_deadbeatGainDQ12;
+    coeffs->deadbeatGainQQ12   = self->p_deadbeatGainQQ12;
+    coeffs->predictionGainDQ12 = self->p_predictionGainDQ12;
+    coeffs->predictionGainQQ12 = self->p_predictionGainQQ12;
+    coeffs->carryOverQ15       = self->p_carryOverQ15;
+}
+
+
+/**
+ *  \brief Get the sampling time of the deadbeat controller in microseconds.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Sampling time, in microseconds
+ */
+static inline uint32 Ifx_MDA_FocControllerF16_getSamplingTime_us(Ifx_MDA_FocControllerF16* self)
+{
+    return self->p_samplingTime_us;
+}
+
+
+/**
+ *  \brief Rotate the states of the deadbeat controller by 180 degrees.
+ *
+ *  To be called when the d-q reference system is rotated by 180 degrees, so that the voltage command, the prediction
+ *  and the disturbance voltage refer to the rotated reference system.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+void Ifx_MDA_FocControllerF16_rotateDeadbeat(Ifx_MDA_FocControllerF16* self);
+
+
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
 /**
  *  \brief Returns the component ID
  *
@@ -372,6 +372,37 @@ static inline Ifx_Math_Fract16 Ifx_MDA_IToFControllerF16_getReferenceCurrentImag
 }
 
 
+/**
+ *  \brief Set the angle increment per execution and per unit of speed.
+ *
+ *  The increment is proportional to the sampling time, e.g. to be scaled with it if the execution rate is changed at
+ * runtime.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] angleIncrementQ14 Angle increment, in Q14
+ *
+ */
+static inline void Ifx_MDA_IToFControllerF16_setAngleIncrement(Ifx_MDA_IToFControllerF16* self, Ifx_Math_Fract16
+                                                               angleIncrementQ14)
+{
+    self->p_angleIncrementQ14 = angleIncrementQ14;
+}
+
+
+/**
+ *  \brief Get the angle increment per execution and per unit of speed.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Angle increment, in Q14
+ */
+static inline Ifx_Math_Fract16 Ifx_MDA_IToFControllerF16_getAngleIncrement(Ifx_MDA_IToFControllerF16* self)
+{
+    return self->p_angleIncrementQ14;
+}
+
+
 /**
  *  \brief Returns the component ID
  *
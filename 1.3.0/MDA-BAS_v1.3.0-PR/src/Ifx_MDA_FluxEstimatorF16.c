@@ -89,6 +89,9 @@ void Ifx_MDA_FluxEstimatorF16_initSpeedFilter(Ifx_MDA_FluxEstimatorF16* self);
 static inline Ifx_Math_Fract16 Ifx_MDA_FluxEstimatorF16_calcFlux(Ifx_Math_LowPass1stF16* filter, Ifx_Math_Fract16
                                                                  statorVoltage, Ifx_Math_Fract16 statorCurrent);
 
+/* Private function to calculate the conversion factor from rad to rad/s for a sampling time */
+static Ifx_Math_Fract16 Ifx_MDA_FluxEstimatorF16_calcRadToRadPerSecond(uint32 samplingTime_us);
+
 /* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
  * argument." */
 
@@ -123,6 +126,13 @@ void Ifx_MDA_FluxEstimatorF16_init(Ifx_MDA_FluxEstimatorF16* self)
     gain.value   = IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q;
     gain.qFormat = (Ifx_Math_FractQFormat)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q_FORMAT;
     Ifx_Math_PLLF16_setPropGain(&self->p_pllFilter, gain);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* Set PLL integral gain */
+    gain.value   = IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q;
+    gain.qFormat = (Ifx_Math_FractQFormat)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q_FORMAT;
+    Ifx_Math_PLLF16_setIntegGain(&self->p_pllFilter, gain);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
 
     /* Initialize sampling time from Config Wizard */
     Ifx_MDA_FluxEstimatorF16_setSamplingTime_us(self, IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US);
@@ -136,6 +146,118 @@ void Ifx_MDA_FluxEstimatorF16_init(Ifx_MDA_FluxEstimatorF16* self)
 }
 
 
+void Ifx_MDA_FluxEstimatorF16_initParameters(Ifx_MDA_FluxEstimatorF16* self, const
+                                             Ifx_MDA_FluxEstimatorF16_Parameters* parameters)
+{
+    /* Initialize filters with the stored coefficients */
+    Ifx_Math_LowPass1stF16_init(&(self->p_alphaFilter));
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_alphaFilter), parameters->alphaTimeConstCoeff,
+        parameters->alphaTimeConstant_us, parameters->samplingTime_us);
+    Ifx_Math_LowPass1stF16_setGain(&(self->p_alphaFilter), parameters->alphaGainQ14);
+    Ifx_Math_LowPass1stF16_init(&(self->p_betaFilter));
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_betaFilter), parameters->betaTimeConstCoeff,
+        parameters->betaTimeConstant_us, parameters->samplingTime_us);
+    Ifx_Math_LowPass1stF16_setGain(&(self->p_betaFilter), parameters->betaGainQ14);
+    Ifx_Math_LowPass1stF16_init(&(self->p_speedFilter));
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_speedFilter), parameters->speedTimeConstCoeff,
+        parameters->speedTimeConstant_us, parameters->samplingTime_us);
+
+    /* Initialize PLL with the stored gain */
+    Ifx_Math_PLLF16_init(&self->p_pllFilter);
+    Ifx_Math_PLLF16_setPropGainSamplingTime(&self->p_pllFilter, parameters->pllPropGain, parameters->samplingTime_us,
+        parameters->pllPropGainSamplingTime);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    Ifx_Math_PLLF16_setIntegGainSamplingTime(&self->p_pllFilter, parameters->pllIntegGain,
+        parameters->pllIntegGainSamplingTimeQ31);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
+    /* Sampling time and conversion factor */
+    self->p_samplingTime_us     = parameters->samplingTime_us;
+    self->p_radToRadPerSecondQ7 = parameters->radToRadPerSecondQ7;
+
+    /* Reset outputs */
+    self->p_output.anglePLL = 0;
+    self->p_output.speedQ15 = 0;
+
+    /* Set initial operation mode to disabled */
+    self->p_mode = Ifx_MDA_FluxEstimatorF16_Mode_disable;
+}
+
+
+void Ifx_MDA_FluxEstimatorF16_getParameters(Ifx_MDA_FluxEstimatorF16* self, Ifx_MDA_FluxEstimatorF16_Parameters*
+                                            parameters)
+{
+    parameters->samplingTime_us         = self->p_samplingTime_us;
+    parameters->alphaTimeConstant_us    = Ifx_Math_LowPass1stF16_getTimeConstant_us(&(self->p_alphaFilter));
+    parameters->betaTimeConstant_us     = Ifx_Math_LowPass1stF16_getTimeConstant_us(&(self->p_betaFilter));
+    parameters->speedTimeConstant_us    = Ifx_Math_LowPass1stF16_getTimeConstant_us(&(self->p_speedFilter));
+    parameters->pllPropGain             = Ifx_Math_PLLF16_getPropGain(&self->p_pllFilter);
+    parameters->pllPropGainSamplingTime = Ifx_Math_PLLF16_getPropGainSamplingTime(&self->p_pllFilter);
+    parameters->alphaTimeConstCoeff     = Ifx_Math_LowPass1stF16_getTimeConstCoeff(&(self->p_alphaFilter));
+    parameters->betaTimeConstCoeff      = Ifx_Math_LowPass1stF16_getTimeConstCoeff(&(self->p_betaFilter));
+    parameters->speedTimeConstCoeff     = Ifx_Math_LowPass1stF16_getTimeConstCoeff(&(self->p_speedFilter));
+    parameters->alphaGainQ14            = Ifx_Math_LowPass1stF16_getGain(&(self->p_alphaFilter));
+    parameters->betaGainQ14             = Ifx_Math_LowPass1stF16_getGain(&(self->p_betaFilter));
+    parameters->radToRadPerSecondQ7     = self->p_radToRadPerSecondQ7;
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    parameters->pllIntegGain                = Ifx_Math_PLLF16_getIntegGain(&self->p_pllFilter);
+    parameters->pllIntegGainSamplingTimeQ31 = Ifx_Math_PLLF16_getIntegGainSamplingTime(&self->p_pllFilter);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+}
+
+
+void Ifx_MDA_FluxEstimatorF16_calcParameters(Ifx_MDA_FluxEstimatorF16* self, uint32 samplingTime_us,
+                                             Ifx_MDA_FluxEstimatorF16_Parameters* parameters)
+{
+    /* Time constants and gains of the module */
+    Ifx_MDA_FluxEstimatorF16_getParameters(self, parameters);
+
+    /* Coefficients derived from them for the given sampling time */
+    parameters->samplingTime_us         = samplingTime_us;
+    parameters->alphaTimeConstCoeff     = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(parameters->alphaTimeConstant_us,
+        samplingTime_us);
+    parameters->betaTimeConstCoeff      = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(parameters->betaTimeConstant_us,
+        samplingTime_us);
+    parameters->speedTimeConstCoeff     = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(parameters->speedTimeConstant_us,
+        samplingTime_us);
+    parameters->pllPropGainSamplingTime = Ifx_Math_PLLF16_calcPropGainSamplingTime(parameters->pllPropGain,
+        samplingTime_us);
+    parameters->radToRadPerSecondQ7     = Ifx_MDA_FluxEstimatorF16_calcRadToRadPerSecond(samplingTime_us);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    parameters->pllIntegGainSamplingTimeQ31 = Ifx_Math_PLLF16_calcIntegGainSamplingTime(parameters->pllIntegGain,
+        samplingTime_us);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+}
+
+
+void Ifx_MDA_FluxEstimatorF16_setParameters(Ifx_MDA_FluxEstimatorF16* self, const Ifx_MDA_FluxEstimatorF16_Parameters*
+                                            parameters, Ifx_Math_Fract32 rateRatioQ16)
+{
+    /* Filter coefficients, the filter states are kept */
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_alphaFilter), parameters->alphaTimeConstCoeff,
+        parameters->alphaTimeConstant_us, parameters->samplingTime_us);
+    Ifx_Math_LowPass1stF16_setGain(&(self->p_alphaFilter), parameters->alphaGainQ14);
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_betaFilter), parameters->betaTimeConstCoeff,
+        parameters->betaTimeConstant_us, parameters->samplingTime_us);
+    Ifx_Math_LowPass1stF16_setGain(&(self->p_betaFilter), parameters->betaGainQ14);
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_speedFilter), parameters->speedTimeConstCoeff,
+        parameters->speedTimeConstant_us, parameters->samplingTime_us);
+
+    /* PLL gains, the rate of change held by the PLL moves to the new sampling time */
+    Ifx_Math_PLLF16_scaleRate(&self->p_pllFilter, rateRatioQ16);
+    Ifx_Math_PLLF16_setPropGainSamplingTime(&self->p_pllFilter, parameters->pllPropGain, parameters->samplingTime_us,
+        parameters->pllPropGainSamplingTime);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    Ifx_Math_PLLF16_setIntegGainSamplingTime(&self->p_pllFilter, parameters->pllIntegGain,
+        parameters->pllIntegGainSamplingTimeQ31);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
+    /* Sampling time and conversion factor */
+    self->p_samplingTime_us     = parameters->samplingTime_us;
+    self->p_radToRadPerSecondQ7 = parameters->radToRadPerSecondQ7;
+}
+
+
 void Ifx_MDA_FluxEstimatorF16_initAlphaFilter(Ifx_MDA_FluxEstimatorF16* self)
 {
     /* Initialize filters */
@@ -169,6 +291,20 @@ void Ifx_MDA_FluxEstimatorF16_initSpeedFilter(Ifx_MDA_FluxEstimatorF16* self)
 
 
 void Ifx_MDA_FluxEstimatorF16_setSamplingTime_us(Ifx_MDA_FluxEstimatorF16* self, uint32 samplingTime_us)
+{
+    /* Calculate the conversion factor * sampling time, in Q7 */
+    self->p_radToRadPerSecondQ7 = Ifx_MDA_FluxEstimatorF16_calcRadToRadPerSecond(samplingTime_us);
+    self->p_samplingTime_us     = samplingTime_us;
+
+    /* Set sampling time in the dependent modules */
+    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_alphaFilter), samplingTime_us);
+    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_betaFilter), samplingTime_us);
+    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_speedFilter), samplingTime_us);
+    Ifx_Math_PLLF16_setSamplingTime_us(&self->p_pllFilter, samplingTime_us);
+}
+
+
+static Ifx_Math_Fract16 Ifx_MDA_FluxEstimatorF16_calcRadToRadPerSecond(uint32 samplingTime_us)
 {
     /* Represents the sampling time in Q30 format */
     Ifx_Math_Fract32 samplingTimeQ30;
@@ -181,16 +317,9 @@ void Ifx_MDA_FluxEstimatorF16_setSamplingTime_us(Ifx_MDA_FluxEstimatorF16* self,
                                          IFX_MATH_MICROSECONDS_TO_SECONDS);
 
     /* Calculate the conversion factor * sampling time, in Q7 */
-    self->p_radToRadPerSecondQ7 = (Ifx_Math_Fract16)Ifx_Math_DivShL_F32(
-        IFX_MDA_FLUXESTIMATORF16_CFG_SYSTEM_BASE_TIME_Q30, samplingTimeQ30, (uint8)Ifx_Math_DivShL_ShiftDiv(
-            Ifx_Math_FractQFormat_q30, Ifx_Math_FractQFormat_q30, Ifx_Math_FractQFormat_q7));
-    self->p_samplingTime_us = samplingTime_us;
-
-    /* Set sampling time in the dependent modules */
-    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_alphaFilter), samplingTime_us);
-    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_betaFilter), samplingTime_us);
-    Ifx_Math_LowPass1stF16_setSamplingTime_us(&(self->p_speedFilter), samplingTime_us);
-    Ifx_Math_PLLF16_setSamplingTime_us(&self->p_pllFilter, samplingTime_us);
+    return (Ifx_Math_Fract16)Ifx_Math_DivShL_F32(IFX_MDA_FLUXESTIMATORF16_CFG_SYSTEM_BASE_TIME_Q30, samplingTimeQ30,
+        (uint8)Ifx_Math_DivShL_ShiftDiv(Ifx_Math_FractQFormat_q30, Ifx_Math_FractQFormat_q30,
+            Ifx_Math_FractQFormat_q7));
 }
 
 
@@ -17,6 +17,9 @@
 #include "Ifx_Math_Park.h"
 #include "Ifx_Math_PolarToCart.h"
 #include "Ifx_Math_Arithmetic.h"
+#if IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1
+#include "Ifx_Math_PiConstF16.h"
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1 */
 
 /* CMSIS includes */
 #include "cmsis_compiler.h"
@@ -64,12 +67,47 @@ static const Ifx_ComponentVersion Ifx_MDA_FocController_componentVersion = {
 /* Anti-windup strategy flag, negative limitation is active */
 #define IFX_MDA_FOCCONTROLLER_FLAG_AW_NEG (-1)
 
+#if IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1
+
+/* Current PI controllers with the Q formats of Ifx_MDA_FocControllerF16_init() as constants */
+IFX_MATH_PICONSTF16_DEFINE(Ifx_MDA_FocControllerF16_executeCurrentDPi,
+    IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_PROPGAIN_Q_FORMAT, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KI_TS_Q_FORMAT,
+    IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q_FORMAT, Ifx_Math_FractQFormat_q14,
+    IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_LIMIT_Q_FORMAT)
+IFX_MATH_PICONSTF16_DEFINE(Ifx_MDA_FocControllerF16_executeCurrentQPi,
+    IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_PROPGAIN_Q_FORMAT, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KI_TS_Q_FORMAT,
+    IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KAW_TS_Q_FORMAT, Ifx_Math_FractQFormat_q14,
+    IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_LIMIT_Q_FORMAT)
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1 */
 #if IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE
 
 /* Local function to execute d-q decoupling */
 static inline void Ifx_MDA_FocControllerF16_dqDecoupling(Ifx_MDA_FocControllerF16* self, Ifx_Math_Fract16
                                                          electricalSpeed);
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+/* Normalized sampling time per microsecond in Q24, i.e. base speed * 2^24 / 10^6 */
+#define IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_PER_US_Q24 \
+    ((sint64)((IFX_MDA_FOCCONTROLLERF16_CFG_BASE_ELEC_SPEED_RADPS * 16777216.0) / 1000000.0))
+
+/* Range of the sampling time of the deadbeat controller */
+#define IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MIN_US (1U)
+#define IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MAX_US (2000U)
+
+/* Gain of the disturbance observer of the deadbeat controller as right shift, i.e. 1/4 of the prediction error */
+#define IFX_MDA_FOCCONTROLLERF16_DEADBEAT_OBSERVER_SHIFT (2)
+
+/* Local function to reset the states of the deadbeat controller */
+static inline void Ifx_MDA_FocControllerF16_resetDeadbeat(Ifx_MDA_FocControllerF16* self);
+
+/* Local function to execute the deadbeat controller */
+static inline void Ifx_MDA_FocControllerF16_deadbeat(Ifx_MDA_FocControllerF16* self, Ifx_Math_CmpFract16 dqCommand,
+                                                     Ifx_Math_Fract16 electricalSpeed);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+/* Local function to initialize the controllers except for the deadbeat gains */
+static inline void Ifx_MDA_FocControllerF16_initControllers(Ifx_MDA_FocControllerF16* self);
+
 /* Local functions to initialize d and q PI controllers */
 static inline void Ifx_MDA_FocControllerF16_initDPi(Ifx_MDA_FocControllerF16* self);
 static inline void Ifx_MDA_FocControllerF16_initQPi(Ifx_MDA_FocControllerF16* self);
@@ -82,6 +120,15 @@ static inline void Ifx_MDA_FocControllerF16_limitDQVoltage(Ifx_MDA_FocController
 static inline void Ifx_MDA_FocControllerF16_limitDVoltage(Ifx_MDA_FocControllerF16* self, Ifx_Math_Fract16 maxAmpQ15);
 static inline void Ifx_MDA_FocControllerF16_limitQVoltage(Ifx_MDA_FocControllerF16* self, Ifx_Math_Fract16 maxAmpQ15);
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_LIMIT_VOLT_VECTOR_D_PRIO */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+/* Angle advance per normalized speed 2^-15 and per microsecond in Q8, i.e. base speed * 2^32 / 2pi / 2^15 / 10^6 */
+#define IFX_MDA_FOCCONTROLLERF16_DELAY_GAIN_PER_US_Q8 \
+    ((sint32)((IFX_MDA_FOCCONTROLLERF16_CFG_BASE_ELEC_SPEED_RADPS * 131072.0 * 256.0) / (6.283185307 * 1000000.0)))
+
+/* Maximum delay compensation time, keeps the angle advance per normalized speed within 32 bits */
+#define IFX_MDA_FOCCONTROLLERF16_DELAY_MAX_US         (1000U)
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
 /* Shift factor for getting index from Amplitude table */
 #define IFX_MDA_FOCCONTROLLERF16_SHIFT (15 - IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE)
 
@@ -93,8 +140,6 @@ static const Ifx_Math_Interp1DLut_Type focControllerInterp1DLut = {
 };
 
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_LIMIT_VOLT_VECTOR_D_PRIO */
-/* Modulation index max for linear region, normalized by 2/pi */
-#define IFX_MDA_FOCCONTROLLERF16_CONST_MI_0907_Q15 (18921)
 
 /* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
  * argument." */
@@ -121,31 +166,38 @@ void Ifx_MDA_FocControllerF16_getVersion(const Ifx_ComponentVersion** componentV
  */
 void Ifx_MDA_FocControllerF16_init(Ifx_MDA_FocControllerF16* self)
 {
-    /* Initialize internal variables and outputs to 0 */
-    self->currentDQ.real                         = 0;
-    self->currentDQ.imag                         = 0;
-    self->voltageDQ.real                         = 0;
-    self->voltageDQ.imag                         = 0;
-    self->p_output.voltageCommandPolar.amplitude = 0;
-    self->p_output.voltageCommandPolar.angle     = 0;
+    Ifx_MDA_FocControllerF16_initControllers(self);
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
 
-    /* Initialize Id PI controller */
-    Ifx_MDA_FocControllerF16_initDPi(self);
+    /* Initialize the gains and the states of the deadbeat controller */
+    Ifx_MDA_FocControllerF16_setSamplingTime_us(self, IFX_MDA_FOCCONTROLLERF16_CFG_SAMPLING_TIME_US);
+    Ifx_MDA_FocControllerF16_resetDeadbeat(self);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+}
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
 
-    /* Initialize Iq PI controller */
-    Ifx_MDA_FocControllerF16_initQPi(self);
 
-    /* Initialize d-q decoupling */
-#if IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE
-    Ifx_Math_DqDecouplingF16_init(&(self->dqDecoupling));
-    Ifx_Math_DqDecouplingF16_setInductanceD(&(self->dqDecoupling),
-        IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15);
-    Ifx_Math_DqDecouplingF16_setInductanceQ(&(self->dqDecoupling),
-        IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15);
-#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE */
+/**
+ *  Initialize the module to the default values, with the coefficients of the deadbeat controller calculated before.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] coeffs Coefficients as returned by Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs()
+ *
+ */
+void Ifx_MDA_FocControllerF16_initDeadbeatCoeffs(Ifx_MDA_FocControllerF16* self, const
+                                                 Ifx_MDA_FocControllerF16_DeadbeatCoeffs* coeffs)
+{
+    Ifx_MDA_FocControllerF16_initControllers(self);
+
+    /* Initialize the gains and the states of the deadbeat controller */
+    Ifx_MDA_FocControllerF16_setDeadbeatCoeffs(self, coeffs);
+    Ifx_MDA_FocControllerF16_resetDeadbeat(self);
 }
 
 
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
+
 /**
  *  Execute the current regulation and output the voltage command.
  *
@@ -163,6 +215,14 @@ __USED void Ifx_MDA_FocControllerF16_execute(Ifx_MDA_FocControllerF16* self, Ifx
                                              electricalSpeed, Ifx_Math_Fract16
                                              dcLinkVoltageQ15)
 {
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* Current Park trans. (alpha-beta to d-q) */
+    self->currentDQ = Ifx_Math_Park_F16(currentAlphaBeta, rotorFluxAngle);
+
+    /* Execute the deadbeat controller instead of the PI controllers and the d-q decoupling */
+    Ifx_MDA_FocControllerF16_deadbeat(self, dqCommand, electricalSpeed);
+#else
     /* Variable declaration */
     Ifx_Math_CmpFract16 errorCurrentDQ;
 
@@ -176,13 +236,21 @@ __USED void Ifx_MDA_FocControllerF16_execute(Ifx_MDA_FocControllerF16* self, Ifx
         1));
 
     /* Execute current PI controllers */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1
+    self->voltageDQ.real = Ifx_MDA_FocControllerF16_executeCurrentDPi(&(self->currentDPi), errorCurrentDQ.real,
+        self->p_dAntiwindupCtrl);
+    self->voltageDQ.imag = Ifx_MDA_FocControllerF16_executeCurrentQPi(&(self->currentQPi), errorCurrentDQ.imag,
+        self->p_qAntiwindupCtrl);
+#else
     self->voltageDQ.real = Ifx_Math_PiF16_execute(&(self->currentDPi), errorCurrentDQ.real, self->p_dAntiwindupCtrl);
     self->voltageDQ.imag = Ifx_Math_PiF16_execute(&(self->currentQPi), errorCurrentDQ.imag, self->p_qAntiwindupCtrl);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE == 1 */
 
     /* Execute d-q decoupling */
 #if IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE
     Ifx_MDA_FocControllerF16_dqDecoupling(self, electricalSpeed);
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE */
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
 
 #if IFX_MDA_FOCCONTROLLERF16_CFG_LIMIT_VOLT_VECTOR_D_PRIO
 
@@ -194,6 +262,12 @@ __USED void Ifx_MDA_FocControllerF16_execute(Ifx_MDA_FocControllerF16* self, Ifx
 
     /* Add rotor flux angle to convert from d-q to alpha-beta */
     self->p_output.voltageCommandPolar.angle += rotorFluxAngle;
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /* Advance the angle by the rotation to the middle of the interval in which the voltage is applied, modulo 2^32 */
+    self->p_output.voltageCommandPolar.angle += (uint32)(sint32)electricalSpeed *
+                                                (uint32)self->p_delayCompensationGain;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
 }
 
 
@@ -210,10 +284,153 @@ void Ifx_MDA_FocControllerF16_reset(Ifx_MDA_FocControllerF16* self)
     /* Reset PI controllers previous values */
     Ifx_Math_PiF16_setIntegPreviousValue(&(self->currentDPi), 0);
     Ifx_Math_PiF16_setIntegPreviousValue(&(self->currentQPi), 0);
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* Reset the states of the deadbeat controller */
+    Ifx_MDA_FocControllerF16_resetDeadbeat(self);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
 }
 
 
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+void Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(Ifx_MDA_FocControllerF16* self, uint32
+                                                          delayCompensationTime_us)
+{
+    /* Limit the time, so that the angle advance cannot overflow */
+    if (delayCompensationTime_us > IFX_MDA_FOCCONTROLLERF16_DELAY_MAX_US)
+    {
+        delayCompensationTime_us = IFX_MDA_FOCCONTROLLERF16_DELAY_MAX_US;
+    }
+
+    self->p_delayCompensationTime_us = delayCompensationTime_us;
+
+    /* Angle advance per normalized speed 2^-15 */
+    self->p_delayCompensationGain    = (IFX_MDA_FOCCONTROLLERF16_DELAY_GAIN_PER_US_Q8 *
+                                        (sint32)delayCompensationTime_us) >> 8;
+}
+
+
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+void Ifx_MDA_FocControllerF16_setSamplingTime_us(Ifx_MDA_FocControllerF16* self, uint32 samplingTime_us)
+{
+    Ifx_MDA_FocControllerF16_DeadbeatCoeffs coeffs;
+
+    Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs(samplingTime_us, &coeffs);
+    Ifx_MDA_FocControllerF16_setDeadbeatCoeffs(self, &coeffs);
+}
+
+
+void Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs(uint32 samplingTime_us, Ifx_MDA_FocControllerF16_DeadbeatCoeffs*
+                                                 coeffs)
+{
+    /* Variable declaration */
+    sint64 samplingTimeQ24;
+    sint64 gainTimeQ24;
+
+    /* Limit the time to the range of the gains */
+    if (samplingTime_us < IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MIN_US)
+    {
+        samplingTime_us = IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MIN_US;
+    }
+    else if (samplingTime_us > IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MAX_US)
+    {
+        samplingTime_us = IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_MAX_US;
+    }
+    else
+    {
+        /* Within the range */
+    }
+
+    /* Normalized sampling time in Q24 */
+    samplingTimeQ24 = (sint64)samplingTime_us * IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_PER_US_Q24;
+
+    /* Sampling time of the gain L / Ts, at least two PWM periods: with a sampling time of one PWM period, where half
+     * of each voltage command is carried over, the full gain lets the current loop oscillate, so that there one half
+     * of the error is corrected per sampling */
+    if (samplingTime_us < (2U * IFX_MDA_FOCCONTROLLERF16_CFG_PWM_PERIOD_US))
+    {
+        gainTimeQ24 = (sint64)(2U * IFX_MDA_FOCCONTROLLERF16_CFG_PWM_PERIOD_US) *
+                      IFX_MDA_FOCCONTROLLERF16_SAMPLING_TIME_PER_US_Q24;
+    }
+    else
+    {
+        gainTimeQ24 = samplingTimeQ24;
+    }
+
+    /* Gains in Q12, limited to the range of the representation: L / Ts and Ts / L */
+    coeffs->deadbeatGainDQ12   = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)(
+        ((sint64)IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15 << 21) / gainTimeQ24));
+    coeffs->deadbeatGainQQ12   = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)(
+        ((sint64)IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15 << 21) / gainTimeQ24));
+    coeffs->predictionGainDQ12 = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)(
+        (samplingTimeQ24 << 3) / (sint64)IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15));
+    coeffs->predictionGainQQ12 = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)(
+        (samplingTimeQ24 << 3) / (sint64)IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15));
+
+    /* Half a PWM period per sampling time in Q15, at most one half for a sampling time of one PWM period */
+    coeffs->carryOverQ15 = (Ifx_Math_Fract16)(((uint32)IFX_MDA_FOCCONTROLLERF16_CFG_PWM_PERIOD_US << 14) /
+                                              samplingTime_us);
+
+    if (coeffs->carryOverQ15 > (Ifx_Math_Fract16)0x4000)
+    {
+        coeffs->carryOverQ15 = (Ifx_Math_Fract16)0x4000;
+    }
+
+    coeffs->samplingTime_us = samplingTime_us;
+}
+
+
+void Ifx_MDA_FocControllerF16_rotateDeadbeat(Ifx_MDA_FocControllerF16* self)
+{
+    /* Negate the states which refer to the d-q reference system */
+    self->voltageDQ.real              = Ifx_Math_Neg_F16(self->voltageDQ.real);
+    self->voltageDQ.imag              = Ifx_Math_Neg_F16(self->voltageDQ.imag);
+    self->p_previousVoltageDQ.real    = Ifx_Math_Neg_F16(self->p_previousVoltageDQ.real);
+    self->p_previousVoltageDQ.imag    = Ifx_Math_Neg_F16(self->p_previousVoltageDQ.imag);
+    self->p_predictedCurrentDQ.real   = Ifx_Math_Neg_F16(self->p_predictedCurrentDQ.real);
+    self->p_predictedCurrentDQ.imag   = Ifx_Math_Neg_F16(self->p_predictedCurrentDQ.imag);
+    self->p_disturbanceVoltageDQ.real = Ifx_Math_Neg_F16(self->p_disturbanceVoltageDQ.real);
+    self->p_disturbanceVoltageDQ.imag = Ifx_Math_Neg_F16(self->p_disturbanceVoltageDQ.imag);
+}
+
+
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
 /* Functions called by Ifx_MDA_FocControllerF16_init() */
+static inline void Ifx_MDA_FocControllerF16_initControllers(Ifx_MDA_FocControllerF16* self)
+{
+    /* Initialize internal variables and outputs to 0 */
+    self->currentDQ.real                         = 0;
+    self->currentDQ.imag                         = 0;
+    self->voltageDQ.real                         = 0;
+    self->voltageDQ.imag                         = 0;
+    self->p_output.voltageCommandPolar.amplitude = 0;
+    self->p_output.voltageCommandPolar.angle     = 0;
+
+    /* Initialize Id PI controller */
+    Ifx_MDA_FocControllerF16_initDPi(self);
+
+    /* Initialize Iq PI controller */
+    Ifx_MDA_FocControllerF16_initQPi(self);
+
+    /* Initialize d-q decoupling */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE
+    Ifx_Math_DqDecouplingF16_init(&(self->dqDecoupling));
+    Ifx_Math_DqDecouplingF16_setInductanceD(&(self->dqDecoupling),
+        IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15);
+    Ifx_Math_DqDecouplingF16_setInductanceQ(&(self->dqDecoupling),
+        IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /* No angle advance until the delay compensation time is set */
+    Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(self, 0U);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+}
+
+
 static inline void Ifx_MDA_FocControllerF16_initDPi(Ifx_MDA_FocControllerF16* self)
 {
     /* Set Q formats */
@@ -288,12 +505,99 @@ static inline void Ifx_MDA_FocControllerF16_dqDecoupling(Ifx_MDA_FocControllerF1
 
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE */
 
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+/* polyspace +4 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+ * arithmetic." */
+static inline void Ifx_MDA_FocControllerF16_deadbeat(Ifx_MDA_FocControllerF16* self, Ifx_Math_CmpFract16 dqCommand,
+                                                     Ifx_Math_Fract16 electricalSpeed)
+{
+    /* Speed times inductance and flux, i.e. the back EMF coefficients of the d-q model */
+    sint32 speedLd   = ((sint32)electricalSpeed * IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15) >> 15;
+    sint32 speedLq   = ((sint32)electricalSpeed * IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15) >> 15;
+    sint32 speedFlux = ((sint32)electricalSpeed * IFX_MDA_FOCCONTROLLERF16_CFG_FLUX_Q15) >> 15;
+    sint32 currentD  = (sint32)self->currentDQ.real;
+    sint32 currentQ  = (sint32)self->currentDQ.imag;
+    sint32 carryOver = (sint32)self->p_carryOverQ15;
+    sint32 disturbanceD;
+    sint32 disturbanceQ;
+    sint32 appliedD;
+    sint32 appliedQ;
+    sint32 predictedD;
+    sint32 predictedQ;
+    sint32 voltageD;
+    sint32 voltageQ;
+
+    /* Disturbance voltage, i.e. the voltage missing in the model, from the error of the previous prediction:
+     * d = d + L / Ts * (i'[k-1] - i) * 2^-shift */
+    disturbanceD = (sint32)self->p_disturbanceVoltageDQ.real +
+                   ((((sint32)self->p_deadbeatGainDQ12 * ((sint32)self->p_predictedCurrentDQ.real - currentD)) >> 12)
+                    >> IFX_MDA_FOCCONTROLLERF16_DEADBEAT_OBSERVER_SHIFT);
+    disturbanceQ = (sint32)self->p_disturbanceVoltageDQ.imag +
+                   ((((sint32)self->p_deadbeatGainQQ12 * ((sint32)self->p_predictedCurrentDQ.imag - currentQ)) >> 12)
+                    >> IFX_MDA_FOCCONTROLLERF16_DEADBEAT_OBSERVER_SHIFT);
+    self->p_disturbanceVoltageDQ.real = Ifx_Math_Sat_F16_F32(disturbanceD);
+    self->p_disturbanceVoltageDQ.imag = Ifx_Math_Sat_F16_F32(disturbanceQ);
+    disturbanceD                      = (sint32)self->p_disturbanceVoltageDQ.real;
+    disturbanceQ                      = (sint32)self->p_disturbanceVoltageDQ.imag;
+
+    /* Voltage applied until the next sampling, the previous command after the carry-over of the one before:
+     * u = (1 - a) * u[k-1] + a * u[k-2] */
+    appliedD = (sint32)self->voltageDQ.real +
+               ((carryOver * ((sint32)self->p_previousVoltageDQ.real - (sint32)self->voltageDQ.real)) >> 15);
+    appliedQ = (sint32)self->voltageDQ.imag +
+               ((carryOver * ((sint32)self->p_previousVoltageDQ.imag - (sint32)self->voltageDQ.imag)) >> 15);
+    self->p_previousVoltageDQ = self->voltageDQ;
+
+    /* Predict the current at the next sampling: i' = i + Ts / L * (u - R * i - e - d) */
+    voltageD   = appliedD - ((IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 * currentD) >> 15)
+                 + ((speedLq * currentQ) >> 15) - disturbanceD;
+    voltageQ   = appliedQ - ((IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 * currentQ) >> 15)
+                 - ((speedLd * currentD) >> 15) - speedFlux - disturbanceQ;
+    predictedD = (sint32)Ifx_Math_Sat_F16_F32(currentD + (((sint32)self->p_predictionGainDQ12 *
+                                                           (sint32)Ifx_Math_Sat_F16_F32(voltageD)) >> 12));
+    predictedQ = (sint32)Ifx_Math_Sat_F16_F32(currentQ + (((sint32)self->p_predictionGainQQ12 *
+                                                           (sint32)Ifx_Math_Sat_F16_F32(voltageQ)) >> 12));
+    self->p_predictedCurrentDQ.real = (Ifx_Math_Fract16)predictedD;
+    self->p_predictedCurrentDQ.imag = (Ifx_Math_Fract16)predictedQ;
+
+    /* Voltage which brings the predicted current to the command within one sampling period, less the carry-over of
+     * the previous command beyond its steady state voltage: u = u0 + L / Ts * (i* - i') - a * (u[k-1] - u0) with the
+     * steady state voltage u0 = R * i' + e + d */
+    voltageD = ((IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 * predictedD) >> 15) - ((speedLq * predictedQ) >> 15)
+               + disturbanceD;
+    voltageQ = ((IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 * predictedQ) >> 15) + ((speedLd * predictedD) >> 15)
+               + speedFlux + disturbanceQ;
+    voltageD = voltageD + (((sint32)self->p_deadbeatGainDQ12 * ((sint32)dqCommand.real - predictedD)) >> 12)
+               - ((carryOver * ((sint32)self->voltageDQ.real - voltageD)) >> 15);
+    voltageQ = voltageQ + (((sint32)self->p_deadbeatGainQQ12 * ((sint32)dqCommand.imag - predictedQ)) >> 12)
+               - ((carryOver * ((sint32)self->voltageDQ.imag - voltageQ)) >> 15);
+    self->voltageDQ.real = Ifx_Math_Sat_F16_F32(voltageD);
+    self->voltageDQ.imag = Ifx_Math_Sat_F16_F32(voltageQ);
+}
+
+
+static inline void Ifx_MDA_FocControllerF16_resetDeadbeat(Ifx_MDA_FocControllerF16* self)
+{
+    self->p_previousVoltageDQ.real    = 0;
+    self->p_previousVoltageDQ.imag    = 0;
+    self->p_predictedCurrentDQ.real   = 0;
+    self->p_predictedCurrentDQ.imag   = 0;
+    self->p_disturbanceVoltageDQ.real = 0;
+    self->p_disturbanceVoltageDQ.imag = 0;
+}
+
+
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
 #if IFX_MDA_FOCCONTROLLERF16_CFG_LIMIT_VOLT_VECTOR_D_PRIO
 static inline void Ifx_MDA_FocControllerF16_limitDQVoltage(Ifx_MDA_FocControllerF16* self, Ifx_Math_Fract16
                                                            dcLinkVoltageQ15)
 {
-    /* Calculate maximum modulation amplitude based on actual DC-Link voltage  */
-    Ifx_Math_Fract16 maxAmpQ15 = Ifx_Math_MulSat_F16(dcLinkVoltageQ15, IFX_MDA_FOCCONTROLLERF16_CONST_MI_0907_Q15);
+    /* Calculate maximum modulation amplitude based on actual DC-Link voltage and the maximum modulation index, the
+     * linear region of the modulator or up to six-step with overmodulation */
+    Ifx_Math_Fract16 maxAmpQ15 = Ifx_Math_MulSat_F16(dcLinkVoltageQ15,
+        IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15);
 
     /* Limit D voltage to max. amplitude */
     Ifx_MDA_FocControllerF16_limitDVoltage(self, maxAmpQ15);
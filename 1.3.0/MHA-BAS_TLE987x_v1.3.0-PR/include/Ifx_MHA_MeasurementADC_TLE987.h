@@ -24,6 +24,29 @@
  * While in the ON state, the outputs are the DC link voltage and the two shunt current measurements, which can be used
  * by other modules to reconstruct the phase current values. Both of the inputs are represented in Q15 and normalized by
  * the base voltage/current.
+ *
+ * By default the raw shunt currents are read by Ifx_MHA_MeasurementADC_TLE987_periodMatch() and
+ * Ifx_MHA_MeasurementADC_TLE987_oneMatch(), which have to be called in the CCU6 interrupts. With
+ * IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1 the results are captured by the DMA instead: the conversion of the CSA
+ * channel by the sequencer (second current measurement) requests DMA channel 5, which copies the EIM, CSA and VDH
+ * results into one half of a double buffer by a memory scatter-gather task list and then writes the index of that half.
+ * The last task requests the channel interrupt, in which Ifx_MHA_MeasurementADC_TLE987_dmaDone() has to be called
+ * (DMA_CH2_INT_EN and DMA_CH2_CALLBACK of the device configuration, DMA channel 5 interrupt). It arms the channel for
+ * the other half right away, so every PWM period is captured and execute() converts the half completed last, i.e. the
+ * currents of the last PWM period also with a current loop factor N > 1. init() arms the channel for the first
+ * capture. The measurement interrupt functions must not be called in this case. The control structure entries of DMA
+ * channel 5 have to be reserved by the DMA configuration of the device (DMA_EN bit 5, scatter-gather with 4 tasks from
+ * Ifx_MHA_MeasurementADC_TLE987_dmaTaskList), and the DMA master enable is set by init().
+ *
+ * With IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1 the calibration is only done as long as no offset is
+ * known. The offset of the calibration, or one seeded by Ifx_MHA_MeasurementADC_TLE987_setOffset() (e.g. the value of
+ * Ifx_MHA_MeasurementADC_TLE987_getOffset() stored at the last shutdown), is kept over disable and enable, and an
+ * enable request then powers on the amplifier and transitions directly to ON. While
+ * Ifx_MHA_MeasurementADC_TLE987_enableOffsetTracking() is set, i.e. while the caller guarantees that no current flows
+ * through the shunt at the sampling times, execute() refines the offset by a first order low pass of 2^-shift
+ * (IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_SHIFT) per current measurement. Measurements farther than
+ * IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_LIMIT LSB from the offset are taken as current flowing and are ignored, so
+ * the offset follows the drift of the amplifier with the temperature but not a current through the shunt.
  */
 
 #ifndef IFX_MHA_MEASUREMENTADC_TLE987_H
@@ -35,6 +58,9 @@
 #include "Ifx_MHA_MeasurementADC_Cfg.h"
 #include "Ifx_Math.h"
 #include "csa.h"
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+#include "dma.h"
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
 
 /**
  * Base current, in A
@@ -295,8 +321,59 @@ typedef struct Ifx_MHA_MeasurementADC_TLE987
      * Current measurement buffer index for read access
      */
     uint8 p_rawCurrentMeasurementsReadIndex;
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+    /**
+     * Double buffer (two-dimensional array) written by DMA channel 5.
+     *
+     * 1st dimension:
+     * - buffer index
+     *
+     * 2nd dimension:
+     * - 0 -&gt; 1st current measurement of a PWM cycle (EIM result)
+     * - 1 -&gt; 2nd current measurement of a PWM cycle (CSA result)
+     * - 2 -&gt; DC link voltage (VDH result)
+     */
+    uint16 p_dmaRawMeasurements[2][3];
+
+    /**
+     * Index of the buffer completed last, written by the last task of the DMA task list
+     */
+    volatile uint8 p_dmaCompletedIndex;
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /**
+     * Low pass filtered offset of the amplifier, in ADC LSB with 16 fractional bits
+     */
+    sint32 p_offsetFilter;
+
+    /**
+     * Whether the offset is known from a calibration or from Ifx_MHA_MeasurementADC_TLE987_setOffset()
+     */
+    bool p_offsetValid;
+
+    /**
+     * Whether the offset is refined by the current measurements, no current flows through the shunt
+     */
+    bool p_trackOffset;
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
 } Ifx_MHA_MeasurementADC_TLE987;
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/**
+ * Number of DMA tasks per buffer: EIM, CSA and VDH result, buffer index
+ */
+#define IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS (4U)
+
+/**
+ * Task lists of DMA channel 5, IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS tasks per buffer, written by init()
+ */
+extern TDMA_Entry Ifx_MHA_MeasurementADC_TLE987_dmaTaskList[2U * IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS];
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
 /**
  *  \brief Initialize the measurement ADC to the default settings.
  *
@@ -337,7 +414,8 @@ void Ifx_MHA_MeasurementADC_TLE987_execute(Ifx_MHA_MeasurementADC_TLE987* self);
 /**
  *  \brief This function has to be called in the period match interrupt by the library user.
  *
- *  This will update the first current measurement value.
+ *  This will update the first current measurement value. Not to be called with
+ * IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1.
  *
  *  \param [inout] self Reference to structure that contains instance data members
  *
@@ -349,13 +427,28 @@ void Ifx_MHA_MeasurementADC_TLE987_periodMatch(Ifx_MHA_MeasurementADC_TLE987* se
  *
  *  This will update the second raw current measurement value and swap the write index of the current measurement
  * buffer. The first and the second current measurement value will be converted whenever a call to the execute function
- * is done.
+ * is done. Not to be called with IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1.
  *
  *  \param [inout] self Reference to structure that contains instance data members
  *
  */
 void Ifx_MHA_MeasurementADC_TLE987_oneMatch(Ifx_MHA_MeasurementADC_TLE987* self);
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/**
+ *  \brief This function has to be called in the DMA channel 5 interrupt by the library user.
+ *
+ *  Arms the DMA channel for the capture of the next PWM period into the buffer not completed last. Only available with
+ * IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+void Ifx_MHA_MeasurementADC_TLE987_dmaDone(Ifx_MHA_MeasurementADC_TLE987* self);
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
 /**
  *  \brief Get  the status of the measurement ADC, containing the state machine state.
  *
@@ -474,6 +567,59 @@ static inline Ifx_MHA_MeasurementADC_TLE987_optionCsaGain Ifx_MHA_MeasurementADC
 }
 
 
+/**
+ *  \brief Get the offset of the amplifier.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return ADC result at zero shunt current, 0 until the first calibration or seeding
+ */
+static inline uint16 Ifx_MHA_MeasurementADC_TLE987_getOffset(Ifx_MHA_MeasurementADC_TLE987* self)
+{
+    return self->p_offset;
+}
+
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+/**
+ *  \brief Seed the offset of the amplifier, e.g. with the offset stored at the last shutdown.
+ *
+ *  The next enable request skips the calibration. Only available with
+ * IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] offset ADC result at zero shunt current
+ *
+ */
+static inline void Ifx_MHA_MeasurementADC_TLE987_setOffset(Ifx_MHA_MeasurementADC_TLE987* self, uint16 offset)
+{
+    self->p_offset       = offset;
+    self->p_offsetFilter = (sint32)((uint32)offset << 16U);
+    self->p_offsetValid  = true;
+}
+
+
+/**
+ *  \brief Enable or disable the refinement of the offset by the current measurements.
+ *
+ *  To be enabled only while no current flows through the shunt at the sampling times, e.g. at zero voltage command
+ * and standstill. Only available with IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] enable Whether the shunt current is zero
+ *
+ */
+static inline void Ifx_MHA_MeasurementADC_TLE987_enableOffsetTracking(Ifx_MHA_MeasurementADC_TLE987* self, bool
+                                                                      enable)
+{
+    self->p_trackOffset = enable;
+}
+
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
 /**
  *  \brief This API enables or disables the module based on the input parameter enable.
  * If the input parameter is TRUE and no fault is detected, then the module will be enabled in the next call to
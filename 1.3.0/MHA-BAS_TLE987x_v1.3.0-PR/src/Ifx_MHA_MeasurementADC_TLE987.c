@@ -59,6 +59,31 @@ static const Ifx_ComponentVersion Ifx_MHA_MeasurementADC_TLE987_componentVersion
     .rev   = IFX_MHA_MEASUREMENTADC_TLE987_COMPONENTVERSION_REV
 };
 /* *INDENT-ON* */
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/* DMA channel requested by the conversion of ADC1 channel 1 (CSA) */
+#define IFX_MHA_MEASUREMENTADC_TLE987_DMA_CHANNEL (DMA_CH5)
+
+/* Task lists of the DMA channel, the Config Wizard refers to the first list */
+TDMA_Entry Ifx_MHA_MeasurementADC_TLE987_dmaTaskList[2U * IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS];
+
+/* Buffer indices written by the last task of the task lists */
+static const uint8 Ifx_MHA_MeasurementADC_TLE987_dmaBufferIndex[2] = {0U, 1U};
+
+/* Set up the DMA task lists of both buffers */
+static void Ifx_MHA_MeasurementADC_TLE987_initDma(Ifx_MHA_MeasurementADC_TLE987* self);
+
+/* Arm the DMA channel for the capture into the given buffer */
+static inline void Ifx_MHA_MeasurementADC_TLE987_startDma(uint8 bufferIndex);
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+/* Refine the offset by the raw current measurements of a PWM cycle */
+static inline void Ifx_MHA_MeasurementADC_TLE987_updateOffset(Ifx_MHA_MeasurementADC_TLE987* self, const uint16*
+                                                              rawCurrentMeasurements);
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
 /* Swap write index of the current measurement buffer after receiving second current measurement */
 static inline void Ifx_MHA_MeasurementADC_TLE987_swapCurrentMeasurementWriteIndex(
     Ifx_MHA_MeasurementADC_TLE987* self);
@@ -104,6 +129,22 @@ void Ifx_MHA_MeasurementADC_TLE987_init(Ifx_MHA_MeasurementADC_TLE987* self)
     self->p_rawCurrentMeasurementsReadIndex  = 1;
     self->p_rawCurrentMeasurementsWriteIndex = 0;
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+    /* Reset the DMA buffers, the first capture is written to buffer 0 */
+    self->p_dmaRawMeasurements[0][0] = 0U;
+    self->p_dmaRawMeasurements[0][1] = 0U;
+    self->p_dmaRawMeasurements[0][2] = 0U;
+    self->p_dmaRawMeasurements[1][0] = 0U;
+    self->p_dmaRawMeasurements[1][1] = 0U;
+    self->p_dmaRawMeasurements[1][2] = 0U;
+    self->p_dmaCompletedIndex        = 1U;
+    Ifx_MHA_MeasurementADC_TLE987_initDma(self);
+
+    /* Capture the next conversion into buffer 0, from then on the channel is re-armed by dmaDone() */
+    Ifx_MHA_MeasurementADC_TLE987_startDma(0U);
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
     /* Reset outputs */
     self->p_output.dcLinkVoltageQ15    = 0;
     self->p_output.shuntCurrentsQ15[0] = 0;
@@ -114,6 +155,13 @@ void Ifx_MHA_MeasurementADC_TLE987_init(Ifx_MHA_MeasurementADC_TLE987* self)
     self->p_cycleCounter                         = 1U;
     self->p_offset                               = 0U;
     self->_Super_Ifx_MHA_MeasurementADC.p_enable = false;
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* No offset known, the first enable calibrates unless it is seeded */
+    self->p_offsetFilter = 0L;
+    self->p_offsetValid  = false;
+    self->p_trackOffset  = false;
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
 
     /* Initialize state */
     self->p_status.state = Ifx_MHA_MeasurementADC_TLE987_State_init;
@@ -143,6 +191,19 @@ void Ifx_MHA_MeasurementADC_TLE987_oneMatch(Ifx_MHA_MeasurementADC_TLE987* self)
 }
 
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/* DMA channel 5 interrupt */
+void Ifx_MHA_MeasurementADC_TLE987_dmaDone(Ifx_MHA_MeasurementADC_TLE987* self)
+{
+    /* Capture the next conversion into the buffer not completed last, execute() reads the completed one */
+    Ifx_MHA_MeasurementADC_TLE987_startDma((uint8)(self->p_dmaCompletedIndex ^ 1U));
+}
+
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+
 __USED void Ifx_MHA_MeasurementADC_TLE987_execute(Ifx_MHA_MeasurementADC_TLE987* self)
 {
     /* Variable to store the state */
@@ -187,11 +248,22 @@ __USED void Ifx_MHA_MeasurementADC_TLE987_execute(Ifx_MHA_MeasurementADC_TLE987*
             {
                 /* Enable the current sense amplifier */
                 CSA_Power_On();
-
-                /* Change ADC to SW mode and start conversion */
-                ADC1_SetMode(SW_MODE);
-                ADC1_SetSocSwMode(ADC1_CSA);
-                nextState = Ifx_MHA_MeasurementADC_TLE987_State_calibration;
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+                /* Offset known from the last calibration or seeded, skip the calibration */
+                if (self->p_offsetValid == true)
+                {
+                    ADC1_SetMode(SEQ_MODE);
+                    nextState = Ifx_MHA_MeasurementADC_TLE987_State_on;
+                }
+                else
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+                {
+                    /* Change ADC to SW mode and start conversion */
+                    ADC1_SetMode(SW_MODE);
+                    ADC1_SetSocSwMode(ADC1_CSA);
+                    nextState = Ifx_MHA_MeasurementADC_TLE987_State_calibration;
+                }
             }
 
             break;
@@ -218,6 +290,12 @@ __USED void Ifx_MHA_MeasurementADC_TLE987_execute(Ifx_MHA_MeasurementADC_TLE987*
 
                 /* Get the average value */
                 self->p_offset = (uint16)(self->p_currentAccumulator / self->p_cycleCounter);
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+                /* Start the refinement from the calibrated offset, later enables skip the calibration */
+                self->p_offsetFilter = (sint32)((uint32)self->p_offset << 16U);
+                self->p_offsetValid  = true;
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
 
                 /* Reset cycle counter and accumulator variable */
                 self->p_cycleCounter       = 1;
@@ -240,6 +318,36 @@ __USED void Ifx_MHA_MeasurementADC_TLE987_execute(Ifx_MHA_MeasurementADC_TLE987*
 }
 
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+static inline void Ifx_MHA_MeasurementADC_TLE987_updateOffset(Ifx_MHA_MeasurementADC_TLE987* self, const uint16*
+                                                              rawCurrentMeasurements)
+{
+    /* Deviation of a measurement from the offset */
+    sint32 deviation;
+    uint8  measurement;
+
+    if (self->p_trackOffset == true)
+    {
+        for (measurement = 0U; measurement < 2U; measurement++)
+        {
+            deviation = (sint32)rawCurrentMeasurements[measurement] - (sint32)self->p_offset;
+
+            /* Low pass towards the measurement, unless it shows a current through the shunt */
+            if ((deviation <= IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_LIMIT)
+                && (deviation >= -IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_LIMIT))
+            {
+                self->p_offsetFilter += Ifx_Math_ShR_F32((sint32)((uint32)rawCurrentMeasurements[measurement] << 16U) -
+                    self->p_offsetFilter, IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_SHIFT);
+            }
+        }
+
+        /* Offset used by the next current scaling, rounded to nearest */
+        self->p_offset = (uint16)(((uint32)self->p_offsetFilter + 0x8000UL) >> 16U);
+    }
+}
+
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
 static inline Ifx_Math_Fract16 Ifx_MHA_MeasurementADC_TLE987_scaleCurrent(Ifx_MHA_MeasurementADC_TLE987* self, uint16
                                                                           rawCurrentMeasurement)
 {
@@ -258,6 +366,74 @@ static inline Ifx_Math_Fract16 Ifx_MHA_MeasurementADC_TLE987_scaleCurrent(Ifx_MH
 }
 
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+static inline void Ifx_MHA_MeasurementADC_TLE987_calc(Ifx_MHA_MeasurementADC_TLE987* self)
+{
+    /* Buffer completed last by the DMA */
+    uint8            readIndex = self->p_dmaCompletedIndex;
+
+    /* Scale DC-Link voltage */
+    Ifx_Math_Fract32 scaledDcLink = (Ifx_Math_Fract32)self->p_dmaRawMeasurements[readIndex][2] *
+                                    IFX_MHA_MEASUREMENTADC_CFG_CONVERT_VDC_TO_Q15;
+    self->p_output.dcLinkVoltageQ15 = Ifx_Math_Sat_F16_F32(Ifx_Math_ShR_F32(scaledDcLink,
+        IFX_MHA_MEASUREMENTADC_CFG_VDC_BITS));
+
+    /* Scale first shunt current */
+    self->p_output.shuntCurrentsQ15[0] = Ifx_MHA_MeasurementADC_TLE987_scaleCurrent(self,
+        self->p_dmaRawMeasurements[readIndex][0]);
+
+    /* Scale second shunt current */
+    self->p_output.shuntCurrentsQ15[1] = Ifx_MHA_MeasurementADC_TLE987_scaleCurrent(self,
+        self->p_dmaRawMeasurements[readIndex][1]);
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* Refine the offset while no current flows through the shunt */
+    Ifx_MHA_MeasurementADC_TLE987_updateOffset(self, self->p_dmaRawMeasurements[readIndex]);
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+}
+
+
+static void Ifx_MHA_MeasurementADC_TLE987_initDma(Ifx_MHA_MeasurementADC_TLE987* self)
+{
+    TDMA_Entry* task;
+    uint8       bufferIndex;
+
+    for (bufferIndex = 0U; bufferIndex < 2U; bufferIndex++)
+    {
+        task = &Ifx_MHA_MeasurementADC_TLE987_dmaTaskList[bufferIndex * IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS];
+
+        /* First current measurement, EIM result */
+        (void)DMA_Task_Set(&task[0], DMA_Cycle_Type_MemSctGthAlt, 0U, (uint32)&ADC1->RES_OUT_EIM.reg,
+            (uint32)&self->p_dmaRawMeasurements[bufferIndex][0], 1U, DMA_16Bit_Transfer, DMA_No_Inc);
+
+        /* Second current measurement, result of channel 1 (CSA) */
+        (void)DMA_Task_Set(&task[1], DMA_Cycle_Type_MemSctGthAlt, 0U, (uint32)&ADC1->RES_OUT1.reg,
+            (uint32)&self->p_dmaRawMeasurements[bufferIndex][1], 1U, DMA_16Bit_Transfer, DMA_No_Inc);
+
+        /* DC link voltage, result of channel 6 (VDH) */
+        (void)DMA_Task_Set(&task[2], DMA_Cycle_Type_MemSctGthAlt, 0U, (uint32)&ADC1->RES_OUT6.reg,
+            (uint32)&self->p_dmaRawMeasurements[bufferIndex][2], 1U, DMA_16Bit_Transfer, DMA_No_Inc);
+
+        /* Buffer complete, the basic cycle disables the channel and requests the channel interrupt */
+        (void)DMA_Task_Set(&task[3], DMA_Cycle_Type_Basic, 0U,
+            (uint32)&Ifx_MHA_MeasurementADC_TLE987_dmaBufferIndex[bufferIndex], (uint32)&self->p_dmaCompletedIndex,
+            1U, DMA_8Bit_Transfer, DMA_No_Inc);
+    }
+
+    DMA_Master_En();
+}
+
+
+static inline void Ifx_MHA_MeasurementADC_TLE987_startDma(uint8 bufferIndex)
+{
+    DMA_Channel_MemSctGth_Set(IFX_MHA_MEASUREMENTADC_TLE987_DMA_CHANNEL,
+        &Ifx_MHA_MeasurementADC_TLE987_dmaTaskList[bufferIndex * IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS],
+        IFX_MHA_MEASUREMENTADC_TLE987_DMA_TASKS);
+    DMA_Channel_Enable_Set((uint32)1U << IFX_MHA_MEASUREMENTADC_TLE987_DMA_CHANNEL);
+}
+
+
+#else
 static inline void Ifx_MHA_MeasurementADC_TLE987_calc(Ifx_MHA_MeasurementADC_TLE987* self)
 {
     /* Read DC-Link voltage and scale it */
@@ -273,9 +449,18 @@ static inline void Ifx_MHA_MeasurementADC_TLE987_calc(Ifx_MHA_MeasurementADC_TLE
     /* Read and scale second shunt current */
     self->p_output.shuntCurrentsQ15[1] = Ifx_MHA_MeasurementADC_TLE987_scaleCurrent(self,
         self->p_rawCurrentMeasurements[self->p_rawCurrentMeasurementsReadIndex][1]);
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* Refine the offset while no current flows through the shunt */
+    Ifx_MHA_MeasurementADC_TLE987_updateOffset(self,
+        self->p_rawCurrentMeasurements[self->p_rawCurrentMeasurementsReadIndex]);
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
 }
 
 
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+
 static inline void Ifx_MHA_MeasurementADC_TLE987_swapCurrentMeasurementWriteIndex(Ifx_MHA_MeasurementADC_TLE987* self)
 {
     /* Store actual write index */
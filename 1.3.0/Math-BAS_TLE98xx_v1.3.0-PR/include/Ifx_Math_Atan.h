@@ -37,8 +37,8 @@ extern const uint16 Ifx_Math_Lut_Atan_F16_table[];
  * represents \f$\pi/4\f$. If the input is less than zero the function returns a value in the range [7/8*2^32-1,
  * 2^32-1], where 7/8*2^32-1 represents \f$7*\pi/4\f$. The resolution of the output can be modified by configuring the
  * size of the lookup table. The size of the lookup table is given by IFX_MATH_CFG_ATAN_LUT_SIZE. The valid
- * configuration set is: IFX_MATH_CFG_ATAN_LUT_SIZE = {IFX_MATH_USROPT_ATAN_LUT_SIZE_8;
- * IFX_MATH_USROPT_ATAN_LUT_SIZE_10; IFX_MATH_USROPT_ATAN_LUT_SIZE_12}.
+ * configuration set is: IFX_MATH_CFG_ATAN_LUT_SIZE = {IFX_MATH_USROPT_ATAN_LUT_SIZE_8; IFX_MATH_USROPT_ATAN_LUT_SIZE_9;
+ * IFX_MATH_USROPT_ATAN_LUT_SIZE_10; IFX_MATH_USROPT_ATAN_LUT_SIZE_11; IFX_MATH_USROPT_ATAN_LUT_SIZE_12}.
  *
  *  \param [in] x 16-bit fractional number with the format Q15
  *
@@ -16,6 +16,124 @@
 #ifndef IFX_MATH_ATAN2_H
 #define IFX_MATH_ATAN2_H
 #include "Ifx_Math.h"
+#include "Ifx_Math_ShL.h"
+
+/**
+ * Maximum number of iterations of Ifx_Math_Atan2Cordic_F16()
+ */
+#define IFX_MATH_ATAN2_CORDIC_MAX_ITERATIONS (16U)
+
+/**
+ * Number of CORDIC iterations of Ifx_Math_Atan2_F16() in mode IFX_MATH_USROPT_ATAN2_MODE_CORDIC. The angle error is
+ * in the range of the error of the arctangent lookup table of size IFX_MATH_CFG_ATAN_LUT_SIZE.
+ */
+#define IFX_MATH_ATAN2_CORDIC_ITERATIONS     (IFX_MATH_CFG_ATAN_LUT_SIZE + 2U)
+
+/**
+ * Vector folded into the partition \f$[-\pi/4, \pi/4]\f$ by Ifx_Math_Atan2Partition_F16()
+ */
+typedef struct Ifx_Math_Atan2Partition_Type
+{
+    /**
+     * Angle of the partition: 0, \f$\pi/2\f$, \f$\pi\f$ or \f$3/2*\pi\f$, normalized by \f$2*\pi\f$
+     */
+    uint32 angle;
+
+    /**
+     * Tangent of the remaining angle in Q15, i.e. the smaller divided by the larger component, saturated to
+     * IFX_MATH_FRACT16_MAX
+     */
+    Ifx_Math_Fract16 tangent;
+
+    /**
+     * Absolute value of the larger component in Q15, in the range [0, 2^15]
+     */
+    uint16 magnitudeMax;
+} Ifx_Math_Atan2Partition_Type;
+
+/* polyspace-begin CODE-METRIC:VOCF [Justified:Low] "Not possible to achieve the threshold limit for the code metrics
+ * without violating MISRA rules or other code metrics." */
+
+/**
+ *  \brief Folds the vector (x, y) into the partition \f$[-\pi/4, \pi/4]\f$.
+ *
+ *  The angle of the vector is the partition angle plus the arctangent of the tangent, its magnitude is the larger
+ * component times \f$\sqrt{1+tangent^2}\f$. Used by Ifx_Math_Atan2_F16() and Ifx_Math_CartToPolar_F16(), so that
+ * both need one division.
+ *
+ *  \param [in] y 16-bit fractional number with the format Q15
+ *  \param [in] x 16-bit fractional number with the format Q15
+ *
+ *  \return Partition angle, tangent and larger component
+ */
+static inline Ifx_Math_Atan2Partition_Type Ifx_Math_Atan2Partition_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x)
+{
+    /* Local variables to store the tangent and the partition */
+    Ifx_Math_Fract32             tangent;
+    Ifx_Math_Atan2Partition_Type partition;
+
+    /* Divide unit circle in four partitions */
+    if (y < -x)
+    {
+        if (x > y)                                                         /* Partition 4: 5*Pi/4..7*Pi/4 */
+        {
+            partition.angle        = IFX_MATH_PI_INDEX + IFX_MATH_PI_INDEX / 2; /* Set pre-angle of 3/2*Pi */
+            partition.magnitudeMax = (uint16)(-(sint32)y);
+            tangent                = -(Ifx_Math_ShL_F32(x, 15)) / y;            /* Calculate tangent of the angle,
+                                                                                 * stretched by y and y+x (x and y are
+                                                                                 * interpreted as vectors) */
+        }
+        else                                                               /* Partition 3: 3*Pi/4..5*Pi/4 */
+        {
+            partition.angle        = IFX_MATH_PI_INDEX;                    /* Set pre-angle of Pi */
+            partition.magnitudeMax = (uint16)(-(sint32)x);
+            tangent                = (Ifx_Math_ShL_F32(y, 15)) / x;        /* Calculate tangent of the angle,
+                                                                            * stretched by x and y+x (x and y are
+                                                                            * interpreted as vectors) */
+        }
+    }
+    else
+    {
+        if (x < y)                                                         /* Partition 2: 1*Pi/4..3*Pi/4 */
+        {
+            partition.angle        = IFX_MATH_PI_INDEX / 2;                /* Set pre-angle of 1/2*Pi */
+            partition.magnitudeMax = (uint16)y;
+            tangent                = -(Ifx_Math_ShL_F32(x, 15)) / y;       /* Calculate tangent of the angle,
+                                                                            * stretched by y and y+x (x and y are
+                                                                            * interpreted as vectors) */
+        }
+        else                                                               /* Partition 1: -1*Pi/4..1*Pi/4 */
+        {
+            partition.angle        = 0;                                    /* Set no pre-angle */
+            partition.magnitudeMax = (uint16)x;
+
+            if (x == 0)                                                    /* Prevent division by zero */
+            {
+                tangent = 0;
+            }
+            else
+            {
+                tangent = (Ifx_Math_ShL_F32(y, 15)) / x;                   /* Calculate tangent of the angle,
+                                                                            * stretched by x and y+x (x and y are
+                                                                            * interpreted as vectors) */
+            }
+        }
+    }
+
+    /* Saturate tangent */
+    if (tangent == (IFX_MATH_FRACT16_MAX + 1))
+    {
+        tangent = IFX_MATH_FRACT16_MAX;
+    }
+
+    partition.tangent = (Ifx_Math_Fract16)tangent;
+
+    return partition;
+}
+
+
+/* polyspace-end CODE-METRIC:VOCF [Justified:Low] "Not possible to achieve the threshold limit for the code metrics
+ * without violating MISRA rules or other code metrics." */
 
 /**
  *  \brief Calculate the four quadrant arctangent of x and y.
@@ -24,7 +142,11 @@
  * return value is 0 if both inputs are 0.
  *  The resolution of the output can be modified by configuring the size of the lookup table. The size of the lookup
  * table is given by IFX_MATH_USRCFG_ATAN_LUT_SIZE. The valid configuration set is: IFX_MATH_USRCFG_ATAN_LUT_SIZE =
- * {IFX_MATH_USROPT_ATAN_LUT_SIZE_8; IFX_MATH_USROPT_ATAN_LUT_SIZE_10; IFX_MATH_USROPT_ATAN_LUT_SIZE_12}.
+ * {IFX_MATH_USROPT_ATAN_LUT_SIZE_8; IFX_MATH_USROPT_ATAN_LUT_SIZE_9; IFX_MATH_USROPT_ATAN_LUT_SIZE_10;
+ * IFX_MATH_USROPT_ATAN_LUT_SIZE_11; IFX_MATH_USROPT_ATAN_LUT_SIZE_12}.
+ *  The implementation is selected by IFX_MATH_CFG_ATAN2_MODE: IFX_MATH_USROPT_ATAN2_MODE_LUT divides the smaller by the
+ * larger input and reads the arctangent lookup table, IFX_MATH_USROPT_ATAN2_MODE_CORDIC returns the angle of
+ * Ifx_Math_Atan2Cordic_F16() with IFX_MATH_ATAN2_CORDIC_ITERATIONS iterations.
  *
  *  \param [in] y 16-bit fractional number with the format Q15
  *  \param [in] x 16-bit fractional number with the format Q15
@@ -33,4 +155,21 @@
  */
 uint32 Ifx_Math_Atan2_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x);
 
+/**
+ *  \brief Calculate the four quadrant arctangent and the magnitude of x and y by CORDIC in vectoring mode.
+ *
+ *  The vector is rotated into the right half plane and then towards the x axis by shifts and additions only, so no
+ * division and no lookup table of the size of IFX_MATH_CFG_ATAN_LUT_SIZE are needed. The remaining x component is
+ * the magnitude, scaled back by the CORDIC gain. The angle error decreases by a factor of two per iteration, it is
+ * below \f$atan(2^{1-iterations})\f$. The angle is 0 if both inputs are 0.
+ *
+ *  \param [in] y 16-bit fractional number with the format Q15
+ *  \param [in] x 16-bit fractional number with the format Q15
+ *  \param [in] iterations Number of iterations, in the range [1, IFX_MATH_ATAN2_CORDIC_MAX_ITERATIONS]
+ *
+ *  \return Magnitude \f$\sqrt{x^2+y^2}\f$ in Q15, saturated to IFX_MATH_FRACT16_MAX, and 32-bit angle, normalized by
+ * \f$2*\pi\f$
+ */
+Ifx_Math_PolarFract16 Ifx_Math_Atan2Cordic_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x, uint8 iterations);
+
 #endif /*IFX_MATH_ATAN2_H*/
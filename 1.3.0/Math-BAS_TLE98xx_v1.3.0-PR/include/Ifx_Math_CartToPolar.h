@@ -32,9 +32,15 @@ extern const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[];
  *
  *  \f[\begin{equation} Amplitude = \sqrt{(real*real)+(imag*imag)}\end{equation}\f]
  *
+ *  Angle and amplitude share one normalization of the vector, Ifx_Math_Atan2Partition_F16(): with the larger component
+ * m and the tangent t of the partition the amplitude is evaluated as \f$m*\sqrt{2}*\sqrt{(1+t^2)/2}\f$, so that the
+ * square root table is read in the range [0.5,1] for any amplitude. In mode IFX_MATH_USROPT_ATAN2_MODE_CORDIC of
+ * IFX_MATH_CFG_ATAN2_MODE both are the result of one Ifx_Math_Atan2Cordic_F16() pass instead.
+ *
  *  The resolution of the Amplitude table which ranges from [0,1] can be modified by configuring the size of the lookup
  * table. The size of the lookup table is given by IFX_MATH_CFG_CART2POLAR_LUT_SIZE. The valid configuration is set as:
- * IFX_MATH_CFG_CART2POLAR_LUT_SIZE = {IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_8; IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_10;
+ * IFX_MATH_CFG_CART2POLAR_LUT_SIZE = {IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_8; IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_9;
+ * IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_10; IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_11;
  * IFX_MATH_USROPT_CART2POLAR_LUT_SIZE_12}.
  *
  *  \param [in] cartesian Data Container of the cartesian co-ordinates {real,imag}
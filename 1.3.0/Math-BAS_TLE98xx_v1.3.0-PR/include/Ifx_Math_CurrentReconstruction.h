@@ -32,6 +32,11 @@ typedef struct Ifx_Math_CurrentReconstruction_info
      * Whether the second current trigger is measuring the sum of two phase currents or only one phase current.
      */
     bool secondTriggerIsSum;
+
+    /**
+     * Whether both current measurement windows were long enough, the measured currents are not usable otherwise.
+     */
+    bool measurementValid;
 } Ifx_Math_CurrentReconstruction_info;
 
 /**
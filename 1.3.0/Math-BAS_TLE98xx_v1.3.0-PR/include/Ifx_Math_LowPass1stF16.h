@@ -119,21 +119,39 @@ static inline void Ifx_Math_LowPass1stF16_setPreviousValue(Ifx_Math_LowPass1stF1
 
 
 /**
- *  \brief Set the time constant of the 1st order low-pass filter to the value passed to the "timeConstant" parameter.
+ *  \brief Calculate the discrete coefficient of the 1st order low-pass filter for the given time constant and sampling
+ * time, e.g. outside of the fast loop for Ifx_Math_LowPass1stF16_setTimeConstCoeff().
  *
  *
- *  \param [inout] self Reference to structure that contains instance data members
  *  \param [in] timeConstant_us the time constant of the filter in microseconds, restricted to the range [0us, 2^31us]
+ *  \param [in] samplingTime_us the discrete sampling time period of the filter in microseconds, restricted to the range
+ * [1us, 10^6us]
  *
+ *  \return Discrete coefficient samplingTime/(samplingTime+timeConstant), in Q15
  */
-static inline void Ifx_Math_LowPass1stF16_setTimeConstant_us(Ifx_Math_LowPass1stF16* self, uint32 timeConstant_us)
+static inline Ifx_Math_Fract16 Ifx_Math_LowPass1stF16_calcTimeConstCoeff(uint32 timeConstant_us, uint32
+                                                                         samplingTime_us)
 {
     /* timeConstCoeff = samplingTime/(samplingTime+timeConstant), calculated in Q15 since tConstCoeff is between 0 and 1
      * */
-    Ifx_Math_Fract32 addTmp = Ifx_Math_Add_F32((Ifx_Math_Fract32)(self->p_samplingTime_us),
+    Ifx_Math_Fract32 addTmp = Ifx_Math_Add_F32((Ifx_Math_Fract32)(samplingTime_us),
         (Ifx_Math_Fract32)(timeConstant_us));
-    self->p_timeConstCoeff  = Ifx_Math_Sat_F16_F32(Ifx_Math_DivShL_F32((Ifx_Math_Fract32)(self->p_samplingTime_us),
-        addTmp, 15u));
+
+    return Ifx_Math_Sat_F16_F32(Ifx_Math_DivShL_F32((Ifx_Math_Fract32)(samplingTime_us), addTmp, 15u));
+}
+
+
+/**
+ *  \brief Set the time constant of the 1st order low-pass filter to the value passed to the "timeConstant" parameter.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] timeConstant_us the time constant of the filter in microseconds, restricted to the range [0us, 2^31us]
+ *
+ */
+static inline void Ifx_Math_LowPass1stF16_setTimeConstant_us(Ifx_Math_LowPass1stF16* self, uint32 timeConstant_us)
+{
+    self->p_timeConstCoeff  = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(timeConstant_us, self->p_samplingTime_us);
     self->p_timeConstant_us = timeConstant_us;
 }
 
@@ -149,16 +167,47 @@ static inline void Ifx_Math_LowPass1stF16_setTimeConstant_us(Ifx_Math_LowPass1st
  */
 static inline void Ifx_Math_LowPass1stF16_setSamplingTime_us(Ifx_Math_LowPass1stF16* self, uint32 samplingTime_us)
 {
-    /* timeConstCoeff = samplingTime/(samplingTime+timeConstant), calculated in Q15 since tConstCoeff is between 0 and 1
-     * */
-    Ifx_Math_Fract32 addTmp = Ifx_Math_Add_F32((Ifx_Math_Fract32)(samplingTime_us),
-        (Ifx_Math_Fract32)(self->p_timeConstant_us));
-    self->p_timeConstCoeff  = Ifx_Math_Sat_F16_F32(Ifx_Math_DivShL_F32((Ifx_Math_Fract32)(samplingTime_us), addTmp,
-        15u));
+    self->p_timeConstCoeff  = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(self->p_timeConstant_us, samplingTime_us);
     self->p_samplingTime_us = samplingTime_us;
 }
 
 
+/**
+ *  \brief Set the discrete coefficient of the 1st order low-pass filter as calculated before for the given time
+ * constant and sampling time, e.g. by Ifx_Math_LowPass1stF16_setSamplingTime_us() at the commissioning, without the
+ * division of the setters.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] timeConstCoeff the discrete coefficient samplingTime/(samplingTime+timeConstant), in Q15
+ *  \param [in] timeConstant_us the time constant of the filter in microseconds the coefficient was calculated for
+ *  \param [in] samplingTime_us the sampling time of the filter in microseconds the coefficient was calculated for
+ *
+ */
+static inline void Ifx_Math_LowPass1stF16_setTimeConstCoeff(Ifx_Math_LowPass1stF16* self, Ifx_Math_Fract16
+                                                            timeConstCoeff, uint32 timeConstant_us, uint32
+                                                            samplingTime_us)
+{
+    self->p_timeConstCoeff  = timeConstCoeff;
+    self->p_timeConstant_us = timeConstant_us;
+    self->p_samplingTime_us = samplingTime_us;
+}
+
+
+/**
+ *  \brief Get the discrete coefficient of the 1st order low-pass filter.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Discrete coefficient samplingTime/(samplingTime+timeConstant), in Q15
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_LowPass1stF16_getTimeConstCoeff(Ifx_Math_LowPass1stF16* self)
+{
+    return self->p_timeConstCoeff;
+}
+
+
 /**
  *  \brief Get the time constant of the 1st order low-pass filter.
  *
@@ -15,6 +15,11 @@
  * The feed forward signal is the average rate of change of the input angle, which has a configurable delay
  * (controllable by the option IFX_MATH_CFG_PLL_DELAY_LENGTH).
  *
+ * With the option IFX_MATH_CFG_PLL_TYPE set to IFX_MATH_USROPT_PLL_TYPE_PI, an integral path is added to the
+ * proportional path. The average rate lags the rate of the input angle by a constant amount while the input
+ * accelerates at a constant rate. The integral path takes this lag over, so the filtered angle tracks a constant
+ * acceleration without a steady state angle error, instead of the lag divided by the proportional gain.
+ *
  * The implementation expects that the product of the proportional gain and the sampling time fit in the range [-1, 1)
  * in Q15 representation. If this condition is not met, the filter output is undefined.
  */
@@ -56,6 +61,24 @@ typedef struct Ifx_Math_PLLF16
      */
     Ifx_Math_Fract16 p_propGainSamplingTime;
 
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /**
+     * Integral gain of the PLL controller
+     */
+    Ifx_Math_Fract16Q p_integGain;
+
+    /**
+     * Stores the value of the integral gain multiplied by the square of the sampling time, in Q31
+     */
+    Ifx_Math_Fract32 p_integGainSamplingTimeQ31;
+
+    /**
+     * Integral path, as angle variation per sampling time in the 32-bit angle format
+     */
+    Ifx_Math_Fract32 p_integral;
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
     /**
      * Index of the current buffer position
      */
@@ -68,7 +91,8 @@ typedef struct Ifx_Math_PLLF16
 typedef struct Ifx_Math_PLLF16_Type
 {
     /**
-     * Angle variation, from the average rate of change of the input angle
+     * Angle variation, from the average rate of change of the input angle, and with IFX_MATH_USROPT_PLL_TYPE_PI of the
+     * integral path added
      */
     Ifx_Math_Fract16 deltaAngle;
 
@@ -115,6 +139,8 @@ void Ifx_Math_PLLF16_setPropGain(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q propGa
 /**
  *  \brief Set the discrete sampling time period in microseconds, in the range [1us, 10^6us]
  *
+ *  A change of the sampling time at runtime leaves the buffer of the average rate as it is, see
+ * Ifx_Math_PLLF16_scaleRate().
  *
  *  \param [inout] self Reference to structure that contains instance data members
  *  \param [in] samplingTime_us Sampling time, in microseconds
@@ -150,6 +176,40 @@ static inline uint32 Ifx_Math_PLLF16_getSamplingTime_us(Ifx_Math_PLLF16* self)
 }
 
 
+/**
+ *  \brief Set the proportional gain and the sampling time together with the product of both, as calculated before by
+ * Ifx_Math_PLLF16_setPropGain() and Ifx_Math_PLLF16_setSamplingTime_us(), without the division of the setters.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] propGain Proportional gain
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *  \param [in] propGainSamplingTime Proportional gain multiplied by the sampling time, in the Q format of the gain
+ *
+ */
+static inline void Ifx_Math_PLLF16_setPropGainSamplingTime(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q propGain, uint32
+                                                           samplingTime_us, Ifx_Math_Fract16 propGainSamplingTime)
+{
+    self->p_propGain             = propGain;
+    self->p_samplingTime_us      = samplingTime_us;
+    self->p_propGainSamplingTime = propGainSamplingTime;
+}
+
+
+/**
+ *  \brief Get the proportional gain multiplied by the sampling time.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Proportional gain multiplied by the sampling time, in the Q format of the gain
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_PLLF16_getPropGainSamplingTime(Ifx_Math_PLLF16* self)
+{
+    return self->p_propGainSamplingTime;
+}
+
+
 /**
  *  \brief Set the previous value of the PLL filter.
  *
@@ -179,7 +239,7 @@ static inline uint32 Ifx_Math_PLLF16_getPreviousValue(Ifx_Math_PLLF16* self)
 
 
 /**
- *  \brief Reset the buffer and buffer index
+ *  \brief Reset the buffer and buffer index, and with IFX_MATH_USROPT_PLL_TYPE_PI the integral path
  *
  *
  *  \param [inout] self Reference to structure that contains instance data members
@@ -187,4 +247,103 @@ static inline uint32 Ifx_Math_PLLF16_getPreviousValue(Ifx_Math_PLLF16* self)
  */
 void Ifx_Math_PLLF16_resetBuffer(Ifx_Math_PLLF16* self);
 
+/**
+ *  \brief Calculate the proportional gain multiplied by the sampling time, as set by Ifx_Math_PLLF16_setPropGain() and
+ * Ifx_Math_PLLF16_setSamplingTime_us(), for Ifx_Math_PLLF16_setPropGainSamplingTime().
+ *
+ *
+ *  \param [in] propGain Proportional gain
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *
+ *  \return Proportional gain multiplied by the sampling time, in the Q format of the gain
+ */
+Ifx_Math_Fract16 Ifx_Math_PLLF16_calcPropGainSamplingTime(Ifx_Math_Fract16Q propGain, uint32 samplingTime_us);
+
+/**
+ *  \brief Scale the rate of change held by the PLL for a change of the sampling time at runtime.
+ *
+ *  The angles in the buffer of the average rate are moved relative to the latest input by the ratio of the new to the
+ * previous sampling time, and with IFX_MATH_USROPT_PLL_TYPE_PI the integral path is scaled by it, so the angle
+ * variation is continuous over the change. The ratio is calculated by the caller, there is no division, e.g. for the
+ * change within the fast loop together with Ifx_Math_PLLF16_setPropGainSamplingTime().
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] rateRatioQ16 New sampling time divided by the previous one, in Q16
+ *
+ */
+void Ifx_Math_PLLF16_scaleRate(Ifx_Math_PLLF16* self, Ifx_Math_Fract32 rateRatioQ16);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+/**
+ *  \brief Set the integral gain of the PLL controller.
+ *
+ *  The product of the integral gain and the square of the sampling time is calculated with the sampling time set
+ * before.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] integGain Integral gain, in 1/s^2
+ *
+ */
+void Ifx_Math_PLLF16_setIntegGain(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q integGain);
+
+/**
+ *  \brief Calculate the integral gain multiplied by the square of the sampling time, as set by
+ * Ifx_Math_PLLF16_setIntegGain(), for Ifx_Math_PLLF16_setIntegGainSamplingTime().
+ *
+ *
+ *  \param [in] integGain Integral gain, in 1/s^2
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *
+ *  \return Integral gain multiplied by the square of the sampling time, in Q31
+ */
+Ifx_Math_Fract32 Ifx_Math_PLLF16_calcIntegGainSamplingTime(Ifx_Math_Fract16Q integGain, uint32 samplingTime_us);
+
+/**
+ *  \brief Get the integral gain of the PLL controller.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Integral gain and respective Q format
+ */
+static inline Ifx_Math_Fract16Q Ifx_Math_PLLF16_getIntegGain(Ifx_Math_PLLF16* self)
+{
+    return self->p_integGain;
+}
+
+
+/**
+ *  \brief Set the integral gain together with the product of the gain and the square of the sampling time, as
+ * calculated before by Ifx_Math_PLLF16_setIntegGain(), without the division of the setter.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] integGain Integral gain, in 1/s^2
+ *  \param [in] integGainSamplingTimeQ31 Integral gain multiplied by the square of the sampling time, in Q31
+ *
+ */
+static inline void Ifx_Math_PLLF16_setIntegGainSamplingTime(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q integGain,
+                                                            Ifx_Math_Fract32 integGainSamplingTimeQ31)
+{
+    self->p_integGain                = integGain;
+    self->p_integGainSamplingTimeQ31 = integGainSamplingTimeQ31;
+}
+
+
+/**
+ *  \brief Get the integral gain multiplied by the square of the sampling time.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Integral gain multiplied by the square of the sampling time, in Q31
+ */
+static inline Ifx_Math_Fract32 Ifx_Math_PLLF16_getIntegGainSamplingTime(Ifx_Math_PLLF16* self)
+{
+    return self->p_integGainSamplingTimeQ31;
+}
+
+
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
 #endif /*IFX_MATH_PLLF16_H*/
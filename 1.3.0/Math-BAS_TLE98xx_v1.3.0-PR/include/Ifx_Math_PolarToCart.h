@@ -24,8 +24,9 @@
  * to cartesian (real, imag) system.
  *  The output resolution is configurable by controlling the sine lookup table size. The size of the lookup table is
  * given by IFX_MATH_CFG_SIN_LUT_SIZE.
- *  The valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE =
- * {IFX_MATH_USROPT_SIN_LUT_SIZE_8;IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ *  The valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE = {IFX_MATH_USROPT_SIN_LUT_SIZE_8;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_9; IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_11;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
  *
  *  \param [in] polar Data container of the polar coordinates: amplitude and angle
  *
@@ -34,6 +34,20 @@ typedef struct Ifx_Math_SinCos_Type
     Ifx_Math_Fract16 cos;
 } Ifx_Math_SinCos_Type;
 
+#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_LUT
+
+/**
+ * Lookup table index of \f$\pi/2\f$
+ */
+#define IFX_MATH_SINCOS_QUARTER_INDEX (1UL << (IFX_MATH_CFG_SIN_LUT_SIZE - 2U))
+
+/**
+ * Mask to wrap a lookup table index around one period
+ */
+#define IFX_MATH_SINCOS_INDEX_MASK    ((1UL << IFX_MATH_CFG_SIN_LUT_SIZE) - 1U)
+
+#endif
+
 /**
  *  \brief Calculates the sinus and cosinus value of a 32-bit angle value.
  *
@@ -41,20 +55,89 @@ typedef struct Ifx_Math_SinCos_Type
  * normalized by\f$2*\pi\f$. The output resolution is configurable by controlling the sine lookup table size. The size
  * of the lookup table is given by IFX_MATH_CFG_SIN_LUT_SIZE.
  *  The valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE = {IFX_MATH_USROPT_SIN_LUT_SIZE_8;
- * IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_9; IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_11;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ *
+ *  The angle is rounded to a table index once. The cosinus is read at the index mirrored around \f$\pi/4\f$
+ * (\f$cos(\theta) = sin(\pi/2 - \theta)\f$), so both values take one index computation and two table reads. The
+ * results are identical to Ifx_Math_Sin_F16() and Ifx_Math_Cos_F16(), except for the cosinus of first quadrant angles
+ * which lie exactly halfway between two table entries (255 of 2^32 angles for a table size of 10). These are rounded
+ * to the other neighbouring entry.
+ *
+ *  In mode IFX_MATH_USROPT_SIN_MODE_INTERPOLATED the angle is folded into the first quadrant once and the sinus and
+ * cosinus are interpolated at the folded angle and at its complement to \f$\pi/2\f$, see Ifx_Math_SinQuarter_F16().
+ * The results are identical to Ifx_Math_Sin_F16() and Ifx_Math_Cos_F16() of this mode.
  *
  *  \param [in] x 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized by\f$2*\pi\f$
  *
  *  \return Data container containing the sinus and cosinus if the input in Q15 format
  */
+#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED
 static inline Ifx_Math_SinCos_Type Ifx_Math_SinCos_F16(uint32 x)
 {
     Ifx_Math_SinCos_Type sinCosReturn;
-    sinCosReturn.sin = Ifx_Math_Sin_F16(x);
-    sinCosReturn.cos = Ifx_Math_Cos_F16(x);
+
+    /* Quadrant of the angle and angle within the quadrant */
+    uint32               quadrant = x >> 30;
+    uint32               position = x & (IFX_MATH_SIN_QUARTER_ANGLE - 1UL);
+
+    /* Sinus of the angle within the quadrant and of its complement, i.e. its cosinus */
+    Ifx_Math_Fract16     sinPosition = Ifx_Math_SinQuarter_F16(position);
+    Ifx_Math_Fract16     cosPosition = Ifx_Math_SinQuarter_F16(IFX_MATH_SIN_QUARTER_ANGLE - position);
+
+    /* sin(pi/2 + theta) = cos(theta) and cos(pi/2 + theta) = -sin(theta) in the second and fourth quadrant */
+    if ((quadrant & 1UL) != 0UL)
+    {
+        sinCosReturn.sin = cosPosition;
+        sinCosReturn.cos = sinPosition;
+    }
+    else
+    {
+        sinCosReturn.sin = sinPosition;
+        sinCosReturn.cos = cosPosition;
+    }
+
+    /* Negative sinus in the third and fourth quadrant */
+    if ((quadrant & 2UL) != 0UL)
+    {
+        sinCosReturn.sin = -sinCosReturn.sin;
+    }
+
+    /* Negative cosinus in the second and third quadrant */
+    if (((quadrant + 1UL) & 2UL) != 0UL)
+    {
+        sinCosReturn.cos = -sinCosReturn.cos;
+    }
 
     return sinCosReturn;
 }
 
 
+#else
+static inline Ifx_Math_SinCos_Type Ifx_Math_SinCos_F16(uint32 x)
+{
+    Ifx_Math_SinCos_Type sinCosReturn;
+
+    /* Stores the 16-bit angle value */
+    uint16               xQ16 = (uint16)(x >> 16);
+
+    /* Addition of 0.5 in the input value and rounding off to nearest integer */
+    uint32               xRounded = (uint32)xQ16 + (1UL << (IFX_MATH_SIN_ANGLE_TO_INDEX - 1U));
+
+    /* Converts the rounded angle to table index of the sinus */
+    uint32               sinIndex = xRounded >> IFX_MATH_SIN_ANGLE_TO_INDEX;
+
+    /* Cosine(theta) = sin(pi/2 - theta), wrapped around to the table range */
+    uint32               cosIndex = (IFX_MATH_SINCOS_QUARTER_INDEX - sinIndex) & IFX_MATH_SINCOS_INDEX_MASK;
+
+    /* Get the table results */
+    sinCosReturn.sin = Ifx_Math_Lut_Sincos_F16_table[sinIndex];
+    sinCosReturn.cos = Ifx_Math_Lut_Sincos_F16_table[cosIndex];
+
+    return sinCosReturn;
+}
+
+
+#endif /* IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED */
+
 #endif /*IFX_MATH_SINCOS_H*/
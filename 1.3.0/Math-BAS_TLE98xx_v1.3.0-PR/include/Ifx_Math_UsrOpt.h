@@ -20,31 +20,71 @@
  */
 #define IFX_MATH_USROPT_ATAN_LUT_SIZE_8         (8)
 
+/**
+ * Lookup table size for arctangent is 2^9
+ */
+#define IFX_MATH_USROPT_ATAN_LUT_SIZE_9         (9)
+
 /**
  * Lookup table size for arctangent is 2^10
  */
 #define IFX_MATH_USROPT_ATAN_LUT_SIZE_10        (10)
 
+/**
+ * Lookup table size for arctangent is 2^11
+ */
+#define IFX_MATH_USROPT_ATAN_LUT_SIZE_11        (11)
+
 /**
  * Lookup table size for arctangent is 2^12
  */
 #define IFX_MATH_USROPT_ATAN_LUT_SIZE_12        (12)
 
+/**
+ * Arctangent of two arguments by division and arctangent lookup table
+ */
+#define IFX_MATH_USROPT_ATAN2_MODE_LUT          (0)
+
+/**
+ * Arctangent of two arguments by CORDIC in vectoring mode, without division
+ */
+#define IFX_MATH_USROPT_ATAN2_MODE_CORDIC       (1)
+
 /**
  * Lookup table size for sine is 2^8
  */
 #define IFX_MATH_USROPT_SIN_LUT_SIZE_8          (8)
 
+/**
+ * Lookup table size for sine is 2^9
+ */
+#define IFX_MATH_USROPT_SIN_LUT_SIZE_9          (9)
+
 /**
  * Lookup table size for sine is 2^10
  */
 #define IFX_MATH_USROPT_SIN_LUT_SIZE_10         (10)
 
+/**
+ * Lookup table size for sine is 2^11
+ */
+#define IFX_MATH_USROPT_SIN_LUT_SIZE_11         (11)
+
 /**
  * Lookup table size for sine is 2^12
  */
 #define IFX_MATH_USROPT_SIN_LUT_SIZE_12         (12)
 
+/**
+ * Sine of the nearest entry of a lookup table of one period
+ */
+#define IFX_MATH_USROPT_SIN_MODE_LUT            (0)
+
+/**
+ * Sine linearly interpolated between the entries of a lookup table of a quarter period
+ */
+#define IFX_MATH_USROPT_SIN_MODE_INTERPOLATED   (1)
+
 /**
  * Trapezoidal discretization mode for PI controller
  */
@@ -85,6 +125,16 @@
  */
 #define IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_8  (8)
 
+/**
+ * Lookup table size for Cartesian2Polar is 2^9
+ */
+#define IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_9  (9)
+
+/**
+ * Lookup table size for Cartesian2Polar is 2^11
+ */
+#define IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_11 (11)
+
 /**
  * Lookup table size for Cartesian2Polar is 2^12
  */
@@ -115,4 +165,14 @@
  */
 #define IFX_MATH_USROPT_PLL_DELAY_32            (32)
 
+/**
+ * PLL with proportional path and feed forward of the average rate of change of the input angle
+ */
+#define IFX_MATH_USROPT_PLL_TYPE_FEED_FORWARD   (0)
+
+/**
+ * PLL with proportional and integral path and feed forward of the average rate of change of the input angle
+ */
+#define IFX_MATH_USROPT_PLL_TYPE_PI             (1)
+
 #endif /*IFX_MATH_USROPT_H*/
@@ -9,41 +9,81 @@
  */
 
 #include "Ifx_Math_Atan2.h"
+#include "Ifx_Math_Atan.h"
 #include "Ifx_Math_CartToPolar.h"
 #include "Ifx_Math_MulShR.h"
-#include "Ifx_Math_AddSat.h"
-#include "Ifx_Math_Interp1DLut.h"
+
+#if IFX_MATH_CFG_ATAN2_MODE == IFX_MATH_USROPT_ATAN2_MODE_CORDIC
+Ifx_Math_PolarFract16 Ifx_Math_CartToPolar_F16(Ifx_Math_CmpFract16 cartesian)
+{
+    /* Angle and amplitude from one CORDIC vectoring pass */
+    return Ifx_Math_Atan2Cordic_F16(cartesian.imag, cartesian.real, IFX_MATH_ATAN2_CORDIC_ITERATIONS);
+}
+
+
+#else
 
 /* Shift factor for getting index from Amplitude table*/
-#define IFX_MATH_CARTTOPOLAR_SHIFT (15 - IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE)
+#define IFX_MATH_CARTTOPOLAR_SHIFT      (15 - IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE)
+
+/* (1 + tangent^2) / 2 at a tangent of 0, in Q15 */
+#define IFX_MATH_CARTTOPOLAR_HALF       (16384)
+
+/* sqrt(2) in Q15, times 2^15 / (2^15 - 1) because the table holds sqrt(x) * (2^15 - 1) rounded down */
+#define IFX_MATH_CARTTOPOLAR_SQRT2      (46342u)
+
+/* Rounding constant of the amplitude, which has 46 fractional bits before the final shift */
+#define IFX_MATH_CARTTOPOLAR_ROUND      ((uint64)1u << 30)
 
-/* Link to look up table*/
-static const Ifx_Math_Interp1DLut_Type cartToPolarInterp1DLut = {
-    .data = &Ifx_Math_Lut_CartToPolar_F16_table[0], .size = (((uint16)1 << IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE) + 1)
-};
 Ifx_Math_PolarFract16 Ifx_Math_CartToPolar_F16(Ifx_Math_CmpFract16 cartesian)
 {
-    /* Local variables to store the real and imaginary */
-    Ifx_Math_Fract16      abcissa;
-    Ifx_Math_Fract16      ordinate;
+    /* Local variables for the partition and the return value */
+    Ifx_Math_Atan2Partition_Type partition;
+    Ifx_Math_PolarFract16        polar;
+
+    /* Local variables for the table interpolation */
+    Ifx_Math_Fract16             halfSecantSq;
+    uint16                       index;
+    Ifx_Math_Fract16             fraction;
+    Ifx_Math_Fract16             slope;
+    Ifx_Math_Fract16             root;
+    uint64                       amplitude;
+
+    /* Fold the vector into the partition -Pi/4..Pi/4, shared by angle and amplitude */
+    partition = Ifx_Math_Atan2Partition_F16(cartesian.imag, cartesian.real);
 
-    /* Local variables to store the return value and square of amplitude */
-    Ifx_Math_PolarFract16 polar;
-    Ifx_Math_Fract16      ampsq;
+    /* Get angle from the partition and the arc tangent of the remaining angle */
+    polar.angle = partition.angle + Ifx_Math_Atan_F16(partition.tangent);
 
-    /* Storing the real and imaginary part of cartesian co-ordinates into local variables */
-    abcissa  = cartesian.real;
-    ordinate = cartesian.imag;
+    /* (1 + tangent^2) / 2 in the range [0.5, 1), which keeps the full resolution of the square root table for any
+     * amplitude, i.e. also for small vectors */
+    halfSecantSq = (Ifx_Math_Fract16)(IFX_MATH_CARTTOPOLAR_HALF
+                                      + Ifx_Math_MulShR_F16(partition.tangent, partition.tangent, 16u));
 
-    /* Get angle from arc tangent */
-    polar.angle = Ifx_Math_Atan2_F16(ordinate, abcissa);
+    /* Interpolate the square root between adjoining LUT values. The index is below 2^LUT_SIZE, so index + 1 is the
+     * last entry of the table at most. */
+    index    = (uint16)((uint16)halfSecantSq >> IFX_MATH_CARTTOPOLAR_SHIFT);
+    fraction = (Ifx_Math_Fract16)(halfSecantSq - (Ifx_Math_Fract16)(index << IFX_MATH_CARTTOPOLAR_SHIFT));
+    slope    = (Ifx_Math_Fract16)(Ifx_Math_Lut_CartToPolar_F16_table[index + 1u]
+                                  - Ifx_Math_Lut_CartToPolar_F16_table[index]);
+    root     = (Ifx_Math_Fract16)(Ifx_Math_Lut_CartToPolar_F16_table[index]
+                                  + Ifx_Math_MulShR_F16(slope, fraction, IFX_MATH_CARTTOPOLAR_SHIFT));
 
-    /* Calculation of amplitude*amplitude */
-    ampsq = Ifx_Math_AddSat_F16(Ifx_Math_MulShR_F16(abcissa, abcissa, 15u), Ifx_Math_MulShR_F16(ordinate, ordinate,
-        15u));
+    /* Amplitude = larger component * sqrt(2) * sqrt((1 + tangent^2) / 2), rounded once. The square root is taken in
+     * Q16 with half an LSB added, the center of the range which the rounded down table value stands for. */
+    amplitude = ((((uint64)((uint32)partition.magnitudeMax * (((uint32)root << 1) + 1u)))
+                  * IFX_MATH_CARTTOPOLAR_SQRT2) + IFX_MATH_CARTTOPOLAR_ROUND) >> 31;
 
-    /* Get amplitude via interpolation between adjoining LUT values*/
-    polar.amplitude = Ifx_Math_Interp1DLut_F16(ampsq, cartToPolarInterp1DLut, IFX_MATH_CARTTOPOLAR_SHIFT);
+    /* Saturate amplitude */
+    if (amplitude > (uint64)IFX_MATH_FRACT16_MAX)
+    {
+        amplitude = (uint64)IFX_MATH_FRACT16_MAX;
+    }
+
+    polar.amplitude = (Ifx_Math_Fract16)amplitude;
 
     return polar;
 }
+
+
+#endif /* IFX_MATH_CFG_ATAN2_MODE == IFX_MATH_USROPT_ATAN2_MODE_CORDIC */
@@ -11,33 +11,92 @@
 #include "Ifx_Math_Sin.h"
 #include "Ifx_Math.h"
 
+#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED
+
 /**
- * Lookup table between \f$sin(0)\f$ and \f$sin(2*\pi)\f$
- * Tables are available for IFX_MATH_CFG_SIN_LUT_SIZE = 8, 10, 12 bit.
- * Table size is (2^IFX_MATH_CFG_SIN_LUT_SIZE) + 1
+ * Lookup table between \f$sin(0)\f$ and \f$sin(\pi/2)\f$ for the interpolation of IFX_MATH_USROPT_SIN_MODE_INTERPOLATED
+ * Tables are available for IFX_MATH_CFG_SIN_LUT_SIZE = 8, 9, 10, 11, 12 bit, the resolution per period.
+ * Table size is (2^(IFX_MATH_CFG_SIN_LUT_SIZE - 2)) + 2, the last entry mirrors the entry before \f$sin(\pi/2)\f$ so
+ * that the interpolation at \f$\pi/2\f$ stays within the table.
+ * Generated by foc_gen_tables of the host build
  */
 #if IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_8
-const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[257] = {
-    0, 804, 1608, 2411, 3212, 4011, 4808, 5602, 6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793, 12540, 13279,
-    14010, 14733, 15447, 16151, 16846, 17531, 18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595, 23170, 23732,
-    24279, 24812, 25330, 25833, 26320, 26791, 27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957, 30274, 30572,
-    30853, 31114, 31357, 31581, 31786, 31972, 32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758, 32767, 32758,
-    32729, 32679, 32610, 32522, 32413, 32286, 32138, 31972, 31786, 31581, 31357, 31114, 30853, 30572, 30274, 29957,
-    29622, 29269, 28899, 28511, 28106, 27684, 27246, 26791, 26320, 25833, 25330, 24812, 24279, 23732, 23170, 22595,
-    22006, 21403, 20788, 20160, 19520, 18868, 18205, 17531, 16846, 16151, 15447, 14733, 14010, 13279, 12540, 11793,
-    11039, 10279, 9512, 8740, 7962, 7180, 6393, 5602, 4808, 4011, 3212, 2411, 1608, 804, 0, -804, -1608, -2411, -3212,
-    -4011, -4808, -5602, -6393, -7180, -7962, -8740, -9512, -10279, -11039, -11793, -12540, -13279, -14010, -14733,
-    -15447, -16151, -16846, -17531, -18205, -18868, -19520, -20160, -20788, -21403, -22006, -22595, -23170, -23732,
-    -24279, -24812, -25330, -25833, -26320, -26791, -27246, -27684, -28106, -28511, -28899, -29269, -29622, -29957,
-    -30274, -30572, -30853, -31114, -31357, -31581, -31786, -31972, -32138, -32286, -32413, -32522, -32610, -32679,
-    -32729, -32758, -32768, -32758, -32729, -32679, -32610, -32522, -32413, -32286, -32138, -31972, -31786, -31581,
-    -31357, -31114, -30853, -30572, -30274, -29957, -29622, -29269, -28899, -28511, -28106, -27684, -27246, -26791,
-    -26320, -25833, -25330, -24812, -24279, -23732, -23170, -22595, -22006, -21403, -20788, -20160, -19520, -18868,
-    -18205, -17531, -16846, -16151, -15447, -14733, -14010, -13279, -12540, -11793, -11039, -10279, -9512, -8740,
-    -7962, -7180, -6393, -5602, -4808, -4011, -3212, -2411, -1608, -804, 0
+const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[66] = {
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602, 6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793, 12540, 13279, 14010,
+    14733, 15447, 16151, 16846, 17531, 18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595, 23170, 23732, 24279,
+    24812, 25330, 25833, 26320, 26791, 27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957, 30274, 30572, 30853,
+    31114, 31357, 31581, 31786, 31972, 32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758, 32767, 32758
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_9
+const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[130] = {
+    0, 402, 804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998, 6393, 6787, 7180, 7571,
+    7962, 8351, 8740, 9127, 9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167, 12540, 12910, 13279, 13646, 14010,
+    14373, 14733, 15091, 15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869, 18205, 18538, 18868, 19195, 19520,
+    19841, 20160, 20475, 20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884, 23170, 23453, 23732, 24008, 24279,
+    24548, 24812, 25073, 25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020, 27246, 27467, 27684, 27897, 28106,
+    28311, 28511, 28707, 28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118, 30274, 30425, 30572, 30715, 30853,
+    30986, 31114, 31238, 31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058, 32138, 32214, 32286, 32352, 32413,
+    32470, 32522, 32568, 32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766, 32767, 32766
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_10
+const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[258] = {
+    0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812,
+    4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376, 7571,
+    7767, 7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319, 9512, 9704, 9896, 10088, 10279, 10469, 10660, 10850, 11039,
+    11228, 11417, 11605, 11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463, 13646, 13828, 14010,
+    14192, 14373, 14553, 14733, 14912, 15091, 15269, 15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846,
+    17018, 17190, 17361, 17531, 17700, 17869, 18037, 18205, 18372, 18538, 18703, 18868, 19032, 19195, 19358, 19520,
+    19681, 19841, 20001, 20160, 20318, 20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856, 22006,
+    22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312, 23453, 23593, 23732, 23870, 24008, 24144, 24279,
+    24414, 24548, 24680, 24812, 24943, 25073, 25202, 25330, 25457, 25583, 25708, 25833, 25956, 26078, 26199, 26320,
+    26439, 26557, 26674, 26791, 26906, 27020, 27133, 27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106,
+    28209, 28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178, 29269, 29359, 29448, 29535, 29622,
+    29707, 29792, 29875, 29957, 30038, 30118, 30196, 30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784, 30853,
+    30920, 30986, 31050, 31114, 31177, 31238, 31298, 31357, 31415, 31471, 31527, 31581, 31634, 31686, 31737, 31786,
+    31834, 31881, 31927, 31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251, 32286, 32319, 32352, 32383, 32413,
+    32442, 32470, 32496, 32522, 32546, 32568, 32590, 32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729,
+    32738, 32746, 32753, 32758, 32762, 32766, 32767, 32767, 32767
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_11
+const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[514] = {
+    0, 101, 201, 302, 402, 503, 603, 704, 804, 905, 1005, 1106, 1206, 1307, 1407, 1507, 1608, 1708, 1809, 1909, 2009,
+    2110, 2210, 2310, 2411, 2511, 2611, 2711, 2811, 2912, 3012, 3112, 3212, 3312, 3412, 3512, 3612, 3712, 3812, 3911,
+    4011, 4111, 4211, 4310, 4410, 4510, 4609, 4709, 4808, 4907, 5007, 5106, 5205, 5305, 5404, 5503, 5602, 5701, 5800,
+    5899, 5998, 6097, 6195, 6294, 6393, 6491, 6590, 6688, 6787, 6885, 6983, 7081, 7180, 7278, 7376, 7473, 7571, 7669,
+    7767, 7864, 7962, 8059, 8157, 8254, 8351, 8449, 8546, 8643, 8740, 8836, 8933, 9030, 9127, 9223, 9319, 9416, 9512,
+    9608, 9704, 9800, 9896, 9992, 10088, 10183, 10279, 10374, 10469, 10565, 10660, 10755, 10850, 10945, 11039, 11134,
+    11228, 11323, 11417, 11511, 11605, 11699, 11793, 11887, 11980, 12074, 12167, 12261, 12354, 12447, 12540, 12633,
+    12725, 12818, 12910, 13003, 13095, 13187, 13279, 13371, 13463, 13554, 13646, 13737, 13828, 13919, 14010, 14101,
+    14192, 14282, 14373, 14463, 14553, 14643, 14733, 14823, 14912, 15002, 15091, 15180, 15269, 15358, 15447, 15535,
+    15624, 15712, 15800, 15888, 15976, 16064, 16151, 16239, 16326, 16413, 16500, 16587, 16673, 16760, 16846, 16932,
+    17018, 17104, 17190, 17275, 17361, 17446, 17531, 17616, 17700, 17785, 17869, 17953, 18037, 18121, 18205, 18288,
+    18372, 18455, 18538, 18621, 18703, 18786, 18868, 18950, 19032, 19114, 19195, 19277, 19358, 19439, 19520, 19601,
+    19681, 19761, 19841, 19921, 20001, 20081, 20160, 20239, 20318, 20397, 20475, 20554, 20632, 20710, 20788, 20865,
+    20943, 21020, 21097, 21174, 21251, 21327, 21403, 21479, 21555, 21631, 21706, 21781, 21856, 21931, 22006, 22080,
+    22154, 22228, 22302, 22375, 22449, 22522, 22595, 22668, 22740, 22812, 22884, 22956, 23028, 23099, 23170, 23241,
+    23312, 23383, 23453, 23523, 23593, 23663, 23732, 23801, 23870, 23939, 24008, 24076, 24144, 24212, 24279, 24347,
+    24414, 24481, 24548, 24614, 24680, 24746, 24812, 24878, 24943, 25008, 25073, 25138, 25202, 25266, 25330, 25394,
+    25457, 25520, 25583, 25646, 25708, 25771, 25833, 25894, 25956, 26017, 26078, 26139, 26199, 26259, 26320, 26379,
+    26439, 26498, 26557, 26616, 26674, 26733, 26791, 26848, 26906, 26963, 27020, 27077, 27133, 27190, 27246, 27301,
+    27357, 27412, 27467, 27522, 27576, 27630, 27684, 27738, 27791, 27844, 27897, 27950, 28002, 28054, 28106, 28158,
+    28209, 28260, 28311, 28361, 28411, 28461, 28511, 28560, 28610, 28658, 28707, 28755, 28803, 28851, 28899, 28946,
+    28993, 29040, 29086, 29132, 29178, 29224, 29269, 29314, 29359, 29404, 29448, 29492, 29535, 29579, 29622, 29665,
+    29707, 29750, 29792, 29833, 29875, 29916, 29957, 29997, 30038, 30078, 30118, 30157, 30196, 30235, 30274, 30312,
+    30350, 30388, 30425, 30462, 30499, 30536, 30572, 30608, 30644, 30680, 30715, 30750, 30784, 30819, 30853, 30886,
+    30920, 30953, 30986, 31018, 31050, 31082, 31114, 31146, 31177, 31207, 31238, 31268, 31298, 31328, 31357, 31386,
+    31415, 31443, 31471, 31499, 31527, 31554, 31581, 31608, 31634, 31660, 31686, 31711, 31737, 31761, 31786, 31810,
+    31834, 31858, 31881, 31904, 31927, 31950, 31972, 31994, 32015, 32037, 32058, 32078, 32099, 32119, 32138, 32158,
+    32177, 32196, 32214, 32233, 32251, 32268, 32286, 32303, 32319, 32336, 32352, 32368, 32383, 32398, 32413, 32428,
+    32442, 32456, 32470, 32483, 32496, 32509, 32522, 32534, 32546, 32557, 32568, 32579, 32590, 32600, 32610, 32620,
+    32629, 32638, 32647, 32656, 32664, 32672, 32679, 32686, 32693, 32700, 32706, 32712, 32718, 32723, 32729, 32733,
+    32738, 32742, 32746, 32749, 32753, 32756, 32758, 32760, 32762, 32764, 32766, 32767, 32767, 32767, 32767, 32767
 };
+
 #elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_12
-const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[4097] = {
+const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[1026] = {
     0, 50, 101, 151, 201, 251, 302, 352, 402, 452, 503, 553, 603, 653, 704, 754, 804, 854, 905, 955, 1005, 1055, 1106,
     1156, 1206, 1256, 1307, 1357, 1407, 1457, 1507, 1558, 1608, 1658, 1708, 1758, 1809, 1859, 1909, 1959, 2009, 2060,
     2110, 2160, 2210, 2260, 2310, 2360, 2411, 2461, 2511, 2561, 2611, 2661, 2711, 2761, 2811, 2861, 2912, 2962, 3012,
@@ -48,265 +107,130 @@ const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[4097] = {
     6836, 6885, 6934, 6983, 7032, 7081, 7130, 7180, 7229, 7278, 7327, 7376, 7425, 7473, 7522, 7571, 7620, 7669, 7718,
     7767, 7816, 7864, 7913, 7962, 8011, 8059, 8108, 8157, 8206, 8254, 8303, 8351, 8400, 8449, 8497, 8546, 8594, 8643,
     8691, 8740, 8788, 8836, 8885, 8933, 8982, 9030, 9078, 9127, 9175, 9223, 9271, 9319, 9368, 9416, 9464, 9512, 9560,
-    9608, 9656, 9704, 9752, 9800, 9848, 9896, 9944, 9992, 10040, 10088, 10135, 10183, 10231, 10279, 10326, 10374,
-    10422, 10469, 10517, 10565, 10612, 10660, 10707, 10755, 10802, 10850, 10897, 10945, 10992, 11039, 11087, 11134,
-    11181, 11228, 11276, 11323, 11370, 11417, 11464, 11511, 11558, 11605, 11652, 11699, 11746, 11793, 11840, 11887,
-    11934, 11980, 12027, 12074, 12121, 12167, 12214, 12261, 12307, 12354, 12400, 12447, 12493, 12540, 12586, 12633,
-    12679, 12725, 12772, 12818, 12864, 12910, 12957, 13003, 13049, 13095, 13141, 13187, 13233, 13279, 13325, 13371,
-    13417, 13463, 13508, 13554, 13600, 13646, 13691, 13737, 13783, 13828, 13874, 13919, 13965, 14010, 14056, 14101,
-    14146, 14192, 14237, 14282, 14327, 14373, 14418, 14463, 14508, 14553, 14598, 14643, 14688, 14733, 14778, 14823,
-    14867, 14912, 14957, 15002, 15046, 15091, 15136, 15180, 15225, 15269, 15314, 15358, 15402, 15447, 15491, 15535,
-    15580, 15624, 15668, 15712, 15756, 15800, 15844, 15888, 15932, 15976, 16020, 16064, 16108, 16151, 16195, 16239,
-    16282, 16326, 16369, 16413, 16456, 16500, 16543, 16587, 16630, 16673, 16717, 16760, 16803, 16846, 16889, 16932,
-    16975, 17018, 17061, 17104, 17147, 17190, 17233, 17275, 17318, 17361, 17403, 17446, 17488, 17531, 17573, 17616,
-    17658, 17700, 17743, 17785, 17827, 17869, 17911, 17953, 17995, 18037, 18079, 18121, 18163, 18205, 18247, 18288,
-    18330, 18372, 18413, 18455, 18496, 18538, 18579, 18621, 18662, 18703, 18745, 18786, 18827, 18868, 18909, 18950,
-    18991, 19032, 19073, 19114, 19155, 19195, 19236, 19277, 19317, 19358, 19399, 19439, 19479, 19520, 19560, 19601,
-    19641, 19681, 19721, 19761, 19801, 19841, 19881, 19921, 19961, 20001, 20041, 20081, 20120, 20160, 20200, 20239,
-    20279, 20318, 20357, 20397, 20436, 20475, 20515, 20554, 20593, 20632, 20671, 20710, 20749, 20788, 20827, 20865,
-    20904, 20943, 20981, 21020, 21059, 21097, 21136, 21174, 21212, 21251, 21289, 21327, 21365, 21403, 21441, 21479,
-    21517, 21555, 21593, 21631, 21668, 21706, 21744, 21781, 21819, 21856, 21894, 21931, 21968, 22006, 22043, 22080,
-    22117, 22154, 22191, 22228, 22265, 22302, 22339, 22375, 22412, 22449, 22485, 22522, 22558, 22595, 22631, 22668,
-    22704, 22740, 22776, 22812, 22848, 22884, 22920, 22956, 22992, 23028, 23064, 23099, 23135, 23170, 23206, 23241,
-    23277, 23312, 23348, 23383, 23418, 23453, 23488, 23523, 23558, 23593, 23628, 23663, 23697, 23732, 23767, 23801,
-    23836, 23870, 23905, 23939, 23973, 24008, 24042, 24076, 24110, 24144, 24178, 24212, 24246, 24279, 24313, 24347,
-    24380, 24414, 24448, 24481, 24514, 24548, 24581, 24614, 24647, 24680, 24713, 24746, 24779, 24812, 24845, 24878,
-    24910, 24943, 24976, 25008, 25041, 25073, 25105, 25138, 25170, 25202, 25234, 25266, 25298, 25330, 25362, 25394,
-    25425, 25457, 25489, 25520, 25552, 25583, 25615, 25646, 25677, 25708, 25739, 25771, 25802, 25833, 25863, 25894,
-    25925, 25956, 25986, 26017, 26048, 26078, 26108, 26139, 26169, 26199, 26229, 26259, 26290, 26320, 26349, 26379,
-    26409, 26439, 26468, 26498, 26528, 26557, 26586, 26616, 26645, 26674, 26704, 26733, 26762, 26791, 26820, 26848,
-    26877, 26906, 26935, 26963, 26992, 27020, 27049, 27077, 27105, 27133, 27162, 27190, 27218, 27246, 27273, 27301,
-    27329, 27357, 27384, 27412, 27440, 27467, 27494, 27522, 27549, 27576, 27603, 27630, 27657, 27684, 27711, 27738,
-    27765, 27791, 27818, 27844, 27871, 27897, 27924, 27950, 27976, 28002, 28028, 28054, 28080, 28106, 28132, 28158,
-    28183, 28209, 28234, 28260, 28285, 28311, 28336, 28361, 28386, 28411, 28436, 28461, 28486, 28511, 28536, 28560,
-    28585, 28610, 28634, 28658, 28683, 28707, 28731, 28755, 28779, 28803, 28827, 28851, 28875, 28899, 28922, 28946,
-    28970, 28993, 29016, 29040, 29063, 29086, 29109, 29132, 29155, 29178, 29201, 29224, 29247, 29269, 29292, 29314,
-    29337, 29359, 29381, 29404, 29426, 29448, 29470, 29492, 29514, 29535, 29557, 29579, 29600, 29622, 29643, 29665,
-    29686, 29707, 29729, 29750, 29771, 29792, 29813, 29833, 29854, 29875, 29895, 29916, 29936, 29957, 29977, 29997,
-    30018, 30038, 30058, 30078, 30098, 30118, 30137, 30157, 30177, 30196, 30216, 30235, 30254, 30274, 30293, 30312,
-    30331, 30350, 30369, 30388, 30407, 30425, 30444, 30462, 30481, 30499, 30518, 30536, 30554, 30572, 30590, 30608,
-    30626, 30644, 30662, 30680, 30697, 30715, 30732, 30750, 30767, 30784, 30801, 30819, 30836, 30853, 30869, 30886,
-    30903, 30920, 30936, 30953, 30969, 30986, 31002, 31018, 31034, 31050, 31067, 31082, 31098, 31114, 31130, 31146,
-    31161, 31177, 31192, 31207, 31223, 31238, 31253, 31268, 31283, 31298, 31313, 31328, 31342, 31357, 31372, 31386,
-    31400, 31415, 31429, 31443, 31457, 31471, 31485, 31499, 31513, 31527, 31540, 31554, 31568, 31581, 31594, 31608,
-    31621, 31634, 31647, 31660, 31673, 31686, 31699, 31711, 31724, 31737, 31749, 31761, 31774, 31786, 31798, 31810,
-    31822, 31834, 31846, 31858, 31870, 31881, 31893, 31904, 31916, 31927, 31938, 31950, 31961, 31972, 31983, 31994,
-    32005, 32015, 32026, 32037, 32047, 32058, 32068, 32078, 32088, 32099, 32109, 32119, 32129, 32138, 32148, 32158,
-    32167, 32177, 32186, 32196, 32205, 32214, 32224, 32233, 32242, 32251, 32259, 32268, 32277, 32286, 32294, 32303,
-    32311, 32319, 32328, 32336, 32344, 32352, 32360, 32368, 32376, 32383, 32391, 32398, 32406, 32413, 32421, 32428,
-    32435, 32442, 32449, 32456, 32463, 32470, 32477, 32483, 32490, 32496, 32503, 32509, 32515, 32522, 32528, 32534,
-    32540, 32546, 32551, 32557, 32563, 32568, 32574, 32579, 32585, 32590, 32595, 32600, 32605, 32610, 32615, 32620,
-    32625, 32629, 32634, 32638, 32643, 32647, 32651, 32656, 32660, 32664, 32668, 32672, 32675, 32679, 32683, 32686,
-    32690, 32693, 32697, 32700, 32703, 32706, 32709, 32712, 32715, 32718, 32721, 32723, 32726, 32729, 32731, 32733,
-    32736, 32738, 32740, 32742, 32744, 32746, 32748, 32749, 32751, 32753, 32754, 32756, 32757, 32758, 32759, 32760,
-    32761, 32762, 32763, 32764, 32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
-    32767, 32767, 32767, 32767, 32766, 32766, 32765, 32764, 32763, 32762, 32761, 32760, 32759, 32758, 32757, 32756,
-    32754, 32753, 32751, 32749, 32748, 32746, 32744, 32742, 32740, 32738, 32736, 32733, 32731, 32729, 32726, 32723,
-    32721, 32718, 32715, 32712, 32709, 32706, 32703, 32700, 32697, 32693, 32690, 32686, 32683, 32679, 32675, 32672,
-    32668, 32664, 32660, 32656, 32651, 32647, 32643, 32638, 32634, 32629, 32625, 32620, 32615, 32610, 32605, 32600,
-    32595, 32590, 32585, 32579, 32574, 32568, 32563, 32557, 32551, 32546, 32540, 32534, 32528, 32522, 32515, 32509,
-    32503, 32496, 32490, 32483, 32477, 32470, 32463, 32456, 32449, 32442, 32435, 32428, 32421, 32413, 32406, 32398,
-    32391, 32383, 32376, 32368, 32360, 32352, 32344, 32336, 32328, 32319, 32311, 32303, 32294, 32286, 32277, 32268,
-    32259, 32251, 32242, 32233, 32224, 32214, 32205, 32196, 32186, 32177, 32167, 32158, 32148, 32138, 32129, 32119,
-    32109, 32099, 32088, 32078, 32068, 32058, 32047, 32037, 32026, 32015, 32005, 31994, 31983, 31972, 31961, 31950,
-    31938, 31927, 31916, 31904, 31893, 31881, 31870, 31858, 31846, 31834, 31822, 31810, 31798, 31786, 31774, 31761,
-    31749, 31737, 31724, 31711, 31699, 31686, 31673, 31660, 31647, 31634, 31621, 31608, 31594, 31581, 31568, 31554,
-    31540, 31527, 31513, 31499, 31485, 31471, 31457, 31443, 31429, 31415, 31400, 31386, 31372, 31357, 31342, 31328,
-    31313, 31298, 31283, 31268, 31253, 31238, 31223, 31207, 31192, 31177, 31161, 31146, 31130, 31114, 31098, 31082,
-    31067, 31050, 31034, 31018, 31002, 30986, 30969, 30953, 30936, 30920, 30903, 30886, 30869, 30853, 30836, 30819,
-    30801, 30784, 30767, 30750, 30732, 30715, 30697, 30680, 30662, 30644, 30626, 30608, 30590, 30572, 30554, 30536,
-    30518, 30499, 30481, 30462, 30444, 30425, 30407, 30388, 30369, 30350, 30331, 30312, 30293, 30274, 30254, 30235,
-    30216, 30196, 30177, 30157, 30137, 30118, 30098, 30078, 30058, 30038, 30018, 29997, 29977, 29957, 29936, 29916,
-    29895, 29875, 29854, 29833, 29813, 29792, 29771, 29750, 29729, 29707, 29686, 29665, 29643, 29622, 29600, 29579,
-    29557, 29535, 29514, 29492, 29470, 29448, 29426, 29404, 29381, 29359, 29337, 29314, 29292, 29269, 29247, 29224,
-    29201, 29178, 29155, 29132, 29109, 29086, 29063, 29040, 29016, 28993, 28970, 28946, 28922, 28899, 28875, 28851,
-    28827, 28803, 28779, 28755, 28731, 28707, 28683, 28658, 28634, 28610, 28585, 28560, 28536, 28511, 28486, 28461,
-    28436, 28411, 28386, 28361, 28336, 28311, 28285, 28260, 28234, 28209, 28183, 28158, 28132, 28106, 28080, 28054,
-    28028, 28002, 27976, 27950, 27924, 27897, 27871, 27844, 27818, 27791, 27765, 27738, 27711, 27684, 27657, 27630,
-    27603, 27576, 27549, 27522, 27494, 27467, 27440, 27412, 27384, 27357, 27329, 27301, 27273, 27246, 27218, 27190,
-    27162, 27133, 27105, 27077, 27049, 27020, 26992, 26963, 26935, 26906, 26877, 26848, 26820, 26791, 26762, 26733,
-    26704, 26674, 26645, 26616, 26586, 26557, 26528, 26498, 26468, 26439, 26409, 26379, 26349, 26320, 26290, 26259,
-    26229, 26199, 26169, 26139, 26108, 26078, 26048, 26017, 25986, 25956, 25925, 25894, 25863, 25833, 25802, 25771,
-    25739, 25708, 25677, 25646, 25615, 25583, 25552, 25520, 25489, 25457, 25425, 25394, 25362, 25330, 25298, 25266,
-    25234, 25202, 25170, 25138, 25105, 25073, 25041, 25008, 24976, 24943, 24910, 24878, 24845, 24812, 24779, 24746,
-    24713, 24680, 24647, 24614, 24581, 24548, 24514, 24481, 24448, 24414, 24380, 24347, 24313, 24279, 24246, 24212,
-    24178, 24144, 24110, 24076, 24042, 24008, 23973, 23939, 23905, 23870, 23836, 23801, 23767, 23732, 23697, 23663,
-    23628, 23593, 23558, 23523, 23488, 23453, 23418, 23383, 23348, 23312, 23277, 23241, 23206, 23170, 23135, 23099,
-    23064, 23028, 22992, 22956, 22920, 22884, 22848, 22812, 22776, 22740, 22704, 22668, 22631, 22595, 22558, 22522,
-    22485, 22449, 22412, 22375, 22339, 22302, 22265, 22228, 22191, 22154, 22117, 22080, 22043, 22006, 21968, 21931,
-    21894, 21856, 21819, 21781, 21744, 21706, 21668, 21631, 21593, 21555, 21517, 21479, 21441, 21403, 21365, 21327,
-    21289, 21251, 21212, 21174, 21136, 21097, 21059, 21020, 20981, 20943, 20904, 20865, 20827, 20788, 20749, 20710,
-    20671, 20632, 20593, 20554, 20515, 20475, 20436, 20397, 20357, 20318, 20279, 20239, 20200, 20160, 20120, 20081,
-    20041, 20001, 19961, 19921, 19881, 19841, 19801, 19761, 19721, 19681, 19641, 19601, 19560, 19520, 19479, 19439,
-    19399, 19358, 19317, 19277, 19236, 19195, 19155, 19114, 19073, 19032, 18991, 18950, 18909, 18868, 18827, 18786,
-    18745, 18703, 18662, 18621, 18579, 18538, 18496, 18455, 18413, 18372, 18330, 18288, 18247, 18205, 18163, 18121,
-    18079, 18037, 17995, 17953, 17911, 17869, 17827, 17785, 17743, 17700, 17658, 17616, 17573, 17531, 17488, 17446,
-    17403, 17361, 17318, 17275, 17233, 17190, 17147, 17104, 17061, 17018, 16975, 16932, 16889, 16846, 16803, 16760,
-    16717, 16673, 16630, 16587, 16543, 16500, 16456, 16413, 16369, 16326, 16282, 16239, 16195, 16151, 16108, 16064,
-    16020, 15976, 15932, 15888, 15844, 15800, 15756, 15712, 15668, 15624, 15580, 15535, 15491, 15447, 15402, 15358,
-    15314, 15269, 15225, 15180, 15136, 15091, 15046, 15002, 14957, 14912, 14867, 14823, 14778, 14733, 14688, 14643,
-    14598, 14553, 14508, 14463, 14418, 14373, 14327, 14282, 14237, 14192, 14146, 14101, 14056, 14010, 13965, 13919,
-    13874, 13828, 13783, 13737, 13691, 13646, 13600, 13554, 13508, 13463, 13417, 13371, 13325, 13279, 13233, 13187,
-    13141, 13095, 13049, 13003, 12957, 12910, 12864, 12818, 12772, 12725, 12679, 12633, 12586, 12540, 12493, 12447,
-    12400, 12354, 12307, 12261, 12214, 12167, 12121, 12074, 12027, 11980, 11934, 11887, 11840, 11793, 11746, 11699,
-    11652, 11605, 11558, 11511, 11464, 11417, 11370, 11323, 11276, 11228, 11181, 11134, 11087, 11039, 10992, 10945,
-    10897, 10850, 10802, 10755, 10707, 10660, 10612, 10565, 10517, 10469, 10422, 10374, 10326, 10279, 10231, 10183,
-    10135, 10088, 10040, 9992, 9944, 9896, 9848, 9800, 9752, 9704, 9656, 9608, 9560, 9512, 9464, 9416, 9368, 9319,
-    9271, 9223, 9175, 9127, 9078, 9030, 8982, 8933, 8885, 8836, 8788, 8740, 8691, 8643, 8594, 8546, 8497, 8449, 8400,
-    8351, 8303, 8254, 8206, 8157, 8108, 8059, 8011, 7962, 7913, 7864, 7816, 7767, 7718, 7669, 7620, 7571, 7522, 7473,
-    7425, 7376, 7327, 7278, 7229, 7180, 7130, 7081, 7032, 6983, 6934, 6885, 6836, 6787, 6737, 6688, 6639, 6590, 6541,
-    6491, 6442, 6393, 6343, 6294, 6245, 6195, 6146, 6097, 6047, 5998, 5948, 5899, 5850, 5800, 5751, 5701, 5652, 5602,
-    5553, 5503, 5453, 5404, 5354, 5305, 5255, 5205, 5156, 5106, 5057, 5007, 4957, 4907, 4858, 4808, 4758, 4709, 4659,
-    4609, 4559, 4510, 4460, 4410, 4360, 4310, 4260, 4211, 4161, 4111, 4061, 4011, 3961, 3911, 3861, 3812, 3762, 3712,
-    3662, 3612, 3562, 3512, 3462, 3412, 3362, 3312, 3262, 3212, 3162, 3112, 3062, 3012, 2962, 2912, 2861, 2811, 2761,
-    2711, 2661, 2611, 2561, 2511, 2461, 2411, 2360, 2310, 2260, 2210, 2160, 2110, 2060, 2009, 1959, 1909, 1859, 1809,
-    1758, 1708, 1658, 1608, 1558, 1507, 1457, 1407, 1357, 1307, 1256, 1206, 1156, 1106, 1055, 1005, 955, 905, 854,
-    804, 754, 704, 653, 603, 553, 503, 452, 402, 352, 302, 251, 201, 151, 101, 50, 0, -50, -101, -151, -201, -251,
-    -302, -352, -402, -452, -503, -553, -603, -653, -704, -754, -804, -854, -905, -955, -1005, -1055, -1106, -1156,
-    -1206, -1256, -1307, -1357, -1407, -1457, -1507, -1558, -1608, -1658, -1708, -1758, -1809, -1859, -1909, -1959,
-    -2009, -2060, -2110, -2160, -2210, -2260, -2310, -2360, -2411, -2461, -2511, -2561, -2611, -2661, -2711, -2761,
-    -2811, -2861, -2912, -2962, -3012, -3062, -3112, -3162, -3212, -3262, -3312, -3362, -3412, -3462, -3512, -3562,
-    -3612, -3662, -3712, -3762, -3812, -3861, -3911, -3961, -4011, -4061, -4111, -4161, -4211, -4260, -4310, -4360,
-    -4410, -4460, -4510, -4559, -4609, -4659, -4709, -4758, -4808, -4858, -4907, -4957, -5007, -5057, -5106, -5156,
-    -5205, -5255, -5305, -5354, -5404, -5453, -5503, -5553, -5602, -5652, -5701, -5751, -5800, -5850, -5899, -5948,
-    -5998, -6047, -6097, -6146, -6195, -6245, -6294, -6343, -6393, -6442, -6491, -6541, -6590, -6639, -6688, -6737,
-    -6787, -6836, -6885, -6934, -6983, -7032, -7081, -7130, -7180, -7229, -7278, -7327, -7376, -7425, -7473, -7522,
-    -7571, -7620, -7669, -7718, -7767, -7816, -7864, -7913, -7962, -8011, -8059, -8108, -8157, -8206, -8254, -8303,
-    -8351, -8400, -8449, -8497, -8546, -8594, -8643, -8691, -8740, -8788, -8836, -8885, -8933, -8982, -9030, -9078,
-    -9127, -9175, -9223, -9271, -9319, -9368, -9416, -9464, -9512, -9560, -9608, -9656, -9704, -9752, -9800, -9848,
-    -9896, -9944, -9992, -10040, -10088, -10135, -10183, -10231, -10279, -10326, -10374, -10422, -10469, -10517,
-    -10565, -10612, -10660, -10707, -10755, -10802, -10850, -10897, -10945, -10992, -11039, -11087, -11134, -11181,
-    -11228, -11276, -11323, -11370, -11417, -11464, -11511, -11558, -11605, -11652, -11699, -11746, -11793, -11840,
-    -11887, -11934, -11980, -12027, -12074, -12121, -12167, -12214, -12261, -12307, -12354, -12400, -12447, -12493,
-    -12540, -12586, -12633, -12679, -12725, -12772, -12818, -12864, -12910, -12957, -13003, -13049, -13095, -13141,
-    -13187, -13233, -13279, -13325, -13371, -13417, -13463, -13508, -13554, -13600, -13646, -13691, -13737, -13783,
-    -13828, -13874, -13919, -13965, -14010, -14056, -14101, -14146, -14192, -14237, -14282, -14327, -14373, -14418,
-    -14463, -14508, -14553, -14598, -14643, -14688, -14733, -14778, -14823, -14867, -14912, -14957, -15002, -15046,
-    -15091, -15136, -15180, -15225, -15269, -15314, -15358, -15402, -15447, -15491, -15535, -15580, -15624, -15668,
-    -15712, -15756, -15800, -15844, -15888, -15932, -15976, -16020, -16064, -16108, -16151, -16195, -16239, -16282,
-    -16326, -16369, -16413, -16456, -16500, -16543, -16587, -16630, -16673, -16717, -16760, -16803, -16846, -16889,
-    -16932, -16975, -17018, -17061, -17104, -17147, -17190, -17233, -17275, -17318, -17361, -17403, -17446, -17488,
-    -17531, -17573, -17616, -17658, -17700, -17743, -17785, -17827, -17869, -17911, -17953, -17995, -18037, -18079,
-    -18121, -18163, -18205, -18247, -18288, -18330, -18372, -18413, -18455, -18496, -18538, -18579, -18621, -18662,
-    -18703, -18745, -18786, -18827, -18868, -18909, -18950, -18991, -19032, -19073, -19114, -19155, -19195, -19236,
-    -19277, -19317, -19358, -19399, -19439, -19479, -19520, -19560, -19601, -19641, -19681, -19721, -19761, -19801,
-    -19841, -19881, -19921, -19961, -20001, -20041, -20081, -20120, -20160, -20200, -20239, -20279, -20318, -20357,
-    -20397, -20436, -20475, -20515, -20554, -20593, -20632, -20671, -20710, -20749, -20788, -20827, -20865, -20904,
-    -20943, -20981, -21020, -21059, -21097, -21136, -21174, -21212, -21251, -21289, -21327, -21365, -21403, -21441,
-    -21479, -21517, -21555, -21593, -21631, -21668, -21706, -21744, -21781, -21819, -21856, -21894, -21931, -21968,
-    -22006, -22043, -22080, -22117, -22154, -22191, -22228, -22265, -22302, -22339, -22375, -22412, -22449, -22485,
-    -22522, -22558, -22595, -22631, -22668, -22704, -22740, -22776, -22812, -22848, -22884, -22920, -22956, -22992,
-    -23028, -23064, -23099, -23135, -23170, -23206, -23241, -23277, -23312, -23348, -23383, -23418, -23453, -23488,
-    -23523, -23558, -23593, -23628, -23663, -23697, -23732, -23767, -23801, -23836, -23870, -23905, -23939, -23973,
-    -24008, -24042, -24076, -24110, -24144, -24178, -24212, -24246, -24279, -24313, -24347, -24380, -24414, -24448,
-    -24481, -24514, -24548, -24581, -24614, -24647, -24680, -24713, -24746, -24779, -24812, -24845, -24878, -24910,
-    -24943, -24976, -25008, -25041, -25073, -25105, -25138, -25170, -25202, -25234, -25266, -25298, -25330, -25362,
-    -25394, -25425, -25457, -25489, -25520, -25552, -25583, -25615, -25646, -25677, -25708, -25739, -25771, -25802,
-    -25833, -25863, -25894, -25925, -25956, -25986, -26017, -26048, -26078, -26108, -26139, -26169, -26199, -26229,
-    -26259, -26290, -26320, -26349, -26379, -26409, -26439, -26468, -26498, -26528, -26557, -26586, -26616, -26645,
-    -26674, -26704, -26733, -26762, -26791, -26820, -26848, -26877, -26906, -26935, -26963, -26992, -27020, -27049,
-    -27077, -27105, -27133, -27162, -27190, -27218, -27246, -27273, -27301, -27329, -27357, -27384, -27412, -27440,
-    -27467, -27494, -27522, -27549, -27576, -27603, -27630, -27657, -27684, -27711, -27738, -27765, -27791, -27818,
-    -27844, -27871, -27897, -27924, -27950, -27976, -28002, -28028, -28054, -28080, -28106, -28132, -28158, -28183,
-    -28209, -28234, -28260, -28285, -28311, -28336, -28361, -28386, -28411, -28436, -28461, -28486, -28511, -28536,
-    -28560, -28585, -28610, -28634, -28658, -28683, -28707, -28731, -28755, -28779, -28803, -28827, -28851, -28875,
-    -28899, -28922, -28946, -28970, -28993, -29016, -29040, -29063, -29086, -29109, -29132, -29155, -29178, -29201,
-    -29224, -29247, -29269, -29292, -29314, -29337, -29359, -29381, -29404, -29426, -29448, -29470, -29492, -29514,
-    -29535, -29557, -29579, -29600, -29622, -29643, -29665, -29686, -29707, -29729, -29750, -29771, -29792, -29813,
-    -29833, -29854, -29875, -29895, -29916, -29936, -29957, -29977, -29997, -30018, -30038, -30058, -30078, -30098,
-    -30118, -30137, -30157, -30177, -30196, -30216, -30235, -30254, -30274, -30293, -30312, -30331, -30350, -30369,
-    -30388, -30407, -30425, -30444, -30462, -30481, -30499, -30518, -30536, -30554, -30572, -30590, -30608, -30626,
-    -30644, -30662, -30680, -30697, -30715, -30732, -30750, -30767, -30784, -30801, -30819, -30836, -30853, -30869,
-    -30886, -30903, -30920, -30936, -30953, -30969, -30986, -31002, -31018, -31034, -31050, -31067, -31082, -31098,
-    -31114, -31130, -31146, -31161, -31177, -31192, -31207, -31223, -31238, -31253, -31268, -31283, -31298, -31313,
-    -31328, -31342, -31357, -31372, -31386, -31400, -31415, -31429, -31443, -31457, -31471, -31485, -31499, -31513,
-    -31527, -31540, -31554, -31568, -31581, -31594, -31608, -31621, -31634, -31647, -31660, -31673, -31686, -31699,
-    -31711, -31724, -31737, -31749, -31761, -31774, -31786, -31798, -31810, -31822, -31834, -31846, -31858, -31870,
-    -31881, -31893, -31904, -31916, -31927, -31938, -31950, -31961, -31972, -31983, -31994, -32005, -32015, -32026,
-    -32037, -32047, -32058, -32068, -32078, -32088, -32099, -32109, -32119, -32129, -32138, -32148, -32158, -32167,
-    -32177, -32186, -32196, -32205, -32214, -32224, -32233, -32242, -32251, -32259, -32268, -32277, -32286, -32294,
-    -32303, -32311, -32319, -32328, -32336, -32344, -32352, -32360, -32368, -32376, -32383, -32391, -32398, -32406,
-    -32413, -32421, -32428, -32435, -32442, -32449, -32456, -32463, -32470, -32477, -32483, -32490, -32496, -32503,
-    -32509, -32515, -32522, -32528, -32534, -32540, -32546, -32551, -32557, -32563, -32568, -32574, -32579, -32585,
-    -32590, -32595, -32600, -32605, -32610, -32615, -32620, -32625, -32629, -32634, -32638, -32643, -32647, -32651,
-    -32656, -32660, -32664, -32668, -32672, -32675, -32679, -32683, -32686, -32690, -32693, -32697, -32700, -32703,
-    -32706, -32709, -32712, -32715, -32718, -32721, -32723, -32726, -32729, -32731, -32733, -32736, -32738, -32740,
-    -32742, -32744, -32746, -32748, -32749, -32751, -32753, -32754, -32756, -32757, -32758, -32759, -32760, -32761,
-    -32762, -32763, -32764, -32765, -32766, -32766, -32767, -32767, -32767, -32768, -32768, -32768, -32768, -32768,
-    -32768, -32768, -32767, -32767, -32767, -32766, -32766, -32765, -32764, -32763, -32762, -32761, -32760, -32759,
-    -32758, -32757, -32756, -32754, -32753, -32751, -32749, -32748, -32746, -32744, -32742, -32740, -32738, -32736,
-    -32733, -32731, -32729, -32726, -32723, -32721, -32718, -32715, -32712, -32709, -32706, -32703, -32700, -32697,
-    -32693, -32690, -32686, -32683, -32679, -32675, -32672, -32668, -32664, -32660, -32656, -32651, -32647, -32643,
-    -32638, -32634, -32629, -32625, -32620, -32615, -32610, -32605, -32600, -32595, -32590, -32585, -32579, -32574,
-    -32568, -32563, -32557, -32551, -32546, -32540, -32534, -32528, -32522, -32515, -32509, -32503, -32496, -32490,
-    -32483, -32477, -32470, -32463, -32456, -32449, -32442, -32435, -32428, -32421, -32413, -32406, -32398, -32391,
-    -32383, -32376, -32368, -32360, -32352, -32344, -32336, -32328, -32319, -32311, -32303, -32294, -32286, -32277,
-    -32268, -32259, -32251, -32242, -32233, -32224, -32214, -32205, -32196, -32186, -32177, -32167, -32158, -32148,
-    -32138, -32129, -32119, -32109, -32099, -32088, -32078, -32068, -32058, -32047, -32037, -32026, -32015, -32005,
-    -31994, -31983, -31972, -31961, -31950, -31938, -31927, -31916, -31904, -31893, -31881, -31870, -31858, -31846,
-    -31834, -31822, -31810, -31798, -31786, -31774, -31761, -31749, -31737, -31724, -31711, -31699, -31686, -31673,
-    -31660, -31647, -31634, -31621, -31608, -31594, -31581, -31568, -31554, -31540, -31527, -31513, -31499, -31485,
-    -31471, -31457, -31443, -31429, -31415, -31400, -31386, -31372, -31357, -31342, -31328, -31313, -31298, -31283,
-    -31268, -31253, -31238, -31223, -31207, -31192, -31177, -31161, -31146, -31130, -31114, -31098, -31082, -31067,
-    -31050, -31034, -31018, -31002, -30986, -30969, -30953, -30936, -30920, -30903, -30886, -30869, -30853, -30836,
-    -30819, -30801, -30784, -30767, -30750, -30732, -30715, -30697, -30680, -30662, -30644, -30626, -30608, -30590,
-    -30572, -30554, -30536, -30518, -30499, -30481, -30462, -30444, -30425, -30407, -30388, -30369, -30350, -30331,
-    -30312, -30293, -30274, -30254, -30235, -30216, -30196, -30177, -30157, -30137, -30118, -30098, -30078, -30058,
-    -30038, -30018, -29997, -29977, -29957, -29936, -29916, -29895, -29875, -29854, -29833, -29813, -29792, -29771,
-    -29750, -29729, -29707, -29686, -29665, -29643, -29622, -29600, -29579, -29557, -29535, -29514, -29492, -29470,
-    -29448, -29426, -29404, -29381, -29359, -29337, -29314, -29292, -29269, -29247, -29224, -29201, -29178, -29155,
-    -29132, -29109, -29086, -29063, -29040, -29016, -28993, -28970, -28946, -28922, -28899, -28875, -28851, -28827,
-    -28803, -28779, -28755, -28731, -28707, -28683, -28658, -28634, -28610, -28585, -28560, -28536, -28511, -28486,
-    -28461, -28436, -28411, -28386, -28361, -28336, -28311, -28285, -28260, -28234, -28209, -28183, -28158, -28132,
-    -28106, -28080, -28054, -28028, -28002, -27976, -27950, -27924, -27897, -27871, -27844, -27818, -27791, -27765,
-    -27738, -27711, -27684, -27657, -27630, -27603, -27576, -27549, -27522, -27494, -27467, -27440, -27412, -27384,
-    -27357, -27329, -27301, -27273, -27246, -27218, -27190, -27162, -27133, -27105, -27077, -27049, -27020, -26992,
-    -26963, -26935, -26906, -26877, -26848, -26820, -26791, -26762, -26733, -26704, -26674, -26645, -26616, -26586,
-    -26557, -26528, -26498, -26468, -26439, -26409, -26379, -26349, -26320, -26290, -26259, -26229, -26199, -26169,
-    -26139, -26108, -26078, -26048, -26017, -25986, -25956, -25925, -25894, -25863, -25833, -25802, -25771, -25739,
-    -25708, -25677, -25646, -25615, -25583, -25552, -25520, -25489, -25457, -25425, -25394, -25362, -25330, -25298,
-    -25266, -25234, -25202, -25170, -25138, -25105, -25073, -25041, -25008, -24976, -24943, -24910, -24878, -24845,
-    -24812, -24779, -24746, -24713, -24680, -24647, -24614, -24581, -24548, -24514, -24481, -24448, -24414, -24380,
-    -24347, -24313, -24279, -24246, -24212, -24178, -24144, -24110, -24076, -24042, -24008, -23973, -23939, -23905,
-    -23870, -23836, -23801, -23767, -23732, -23697, -23663, -23628, -23593, -23558, -23523, -23488, -23453, -23418,
-    -23383, -23348, -23312, -23277, -23241, -23206, -23170, -23135, -23099, -23064, -23028, -22992, -22956, -22920,
-    -22884, -22848, -22812, -22776, -22740, -22704, -22668, -22631, -22595, -22558, -22522, -22485, -22449, -22412,
-    -22375, -22339, -22302, -22265, -22228, -22191, -22154, -22117, -22080, -22043, -22006, -21968, -21931, -21894,
-    -21856, -21819, -21781, -21744, -21706, -21668, -21631, -21593, -21555, -21517, -21479, -21441, -21403, -21365,
-    -21327, -21289, -21251, -21212, -21174, -21136, -21097, -21059, -21020, -20981, -20943, -20904, -20865, -20827,
-    -20788, -20749, -20710, -20671, -20632, -20593, -20554, -20515, -20475, -20436, -20397, -20357, -20318, -20279,
-    -20239, -20200, -20160, -20120, -20081, -20041, -20001, -19961, -19921, -19881, -19841, -19801, -19761, -19721,
-    -19681, -19641, -19601, -19560, -19520, -19479, -19439, -19399, -19358, -19317, -19277, -19236, -19195, -19155,
-    -19114, -19073, -19032, -18991, -18950, -18909, -18868, -18827, -18786, -18745, -18703, -18662, -18621, -18579,
-    -18538, -18496, -18455, -18413, -18372, -18330, -18288, -18247, -18205, -18163, -18121, -18079, -18037, -17995,
-    -17953, -17911, -17869, -17827, -17785, -17743, -17700, -17658, -17616, -17573, -17531, -17488, -17446, -17403,
-    -17361, -17318, -17275, -17233, -17190, -17147, -17104, -17061, -17018, -16975, -16932, -16889, -16846, -16803,
-    -16760, -16717, -16673, -16630, -16587, -16543, -16500, -16456, -16413, -16369, -16326, -16282, -16239, -16195,
-    -16151, -16108, -16064, -16020, -15976, -15932, -15888, -15844, -15800, -15756, -15712, -15668, -15624, -15580,
-    -15535, -15491, -15447, -15402, -15358, -15314, -15269, -15225, -15180, -15136, -15091, -15046, -15002, -14957,
-    -14912, -14867, -14823, -14778, -14733, -14688, -14643, -14598, -14553, -14508, -14463, -14418, -14373, -14327,
-    -14282, -14237, -14192, -14146, -14101, -14056, -14010, -13965, -13919, -13874, -13828, -13783, -13737, -13691,
-    -13646, -13600, -13554, -13508, -13463, -13417, -13371, -13325, -13279, -13233, -13187, -13141, -13095, -13049,
-    -13003, -12957, -12910, -12864, -12818, -12772, -12725, -12679, -12633, -12586, -12540, -12493, -12447, -12400,
-    -12354, -12307, -12261, -12214, -12167, -12121, -12074, -12027, -11980, -11934, -11887, -11840, -11793, -11746,
-    -11699, -11652, -11605, -11558, -11511, -11464, -11417, -11370, -11323, -11276, -11228, -11181, -11134, -11087,
-    -11039, -10992, -10945, -10897, -10850, -10802, -10755, -10707, -10660, -10612, -10565, -10517, -10469, -10422,
-    -10374, -10326, -10279, -10231, -10183, -10135, -10088, -10040, -9992, -9944, -9896, -9848, -9800, -9752, -9704,
-    -9656, -9608, -9560, -9512, -9464, -9416, -9368, -9319, -9271, -9223, -9175, -9127, -9078, -9030, -8982, -8933,
-    -8885, -8836, -8788, -8740, -8691, -8643, -8594, -8546, -8497, -8449, -8400, -8351, -8303, -8254, -8206, -8157,
-    -8108, -8059, -8011, -7962, -7913, -7864, -7816, -7767, -7718, -7669, -7620, -7571, -7522, -7473, -7425, -7376,
-    -7327, -7278, -7229, -7180, -7130, -7081, -7032, -6983, -6934, -6885, -6836, -6787, -6737, -6688, -6639, -6590,
-    -6541, -6491, -6442, -6393, -6343, -6294, -6245, -6195, -6146, -6097, -6047, -5998, -5948, -5899, -5850, -5800,
-    -5751, -5701, -5652, -5602, -5553, -5503, -5453, -5404, -5354, -5305, -5255, -5205, -5156, -5106, -5057, -5007,
-    -4957, -4907, -4858, -4808, -4758, -4709, -4659, -4609, -4559, -4510, -4460, -4410, -4360, -4310, -4260, -4211,
-    -4161, -4111, -4061, -4011, -3961, -3911, -3861, -3812, -3762, -3712, -3662, -3612, -3562, -3512, -3462, -3412,
-    -3362, -3312, -3262, -3212, -3162, -3112, -3062, -3012, -2962, -2912, -2861, -2811, -2761, -2711, -2661, -2611,
-    -2561, -2511, -2461, -2411, -2360, -2310, -2260, -2210, -2160, -2110, -2060, -2009, -1959, -1909, -1859, -1809,
-    -1758, -1708, -1658, -1608, -1558, -1507, -1457, -1407, -1357, -1307, -1256, -1206, -1156, -1106, -1055, -1005,
-    -955, -905, -854, -804, -754, -704, -653, -603, -553, -503, -452, -402, -352, -302, -251, -201, -151, -101, -50, 0
+    9608, 9656, 9704, 9752, 9800, 9848, 9896, 9944, 9992, 10040, 10088, 10135, 10183, 10231, 10279, 10326, 10374, 10422,
+    10469, 10517, 10565, 10612, 10660, 10707, 10755, 10802, 10850, 10897, 10945, 10992, 11039, 11087, 11134, 11181,
+    11228, 11276, 11323, 11370, 11417, 11464, 11511, 11558, 11605, 11652, 11699, 11746, 11793, 11840, 11887, 11934,
+    11980, 12027, 12074, 12121, 12167, 12214, 12261, 12307, 12354, 12400, 12447, 12493, 12540, 12586, 12633, 12679,
+    12725, 12772, 12818, 12864, 12910, 12957, 13003, 13049, 13095, 13141, 13187, 13233, 13279, 13325, 13371, 13417,
+    13463, 13508, 13554, 13600, 13646, 13691, 13737, 13783, 13828, 13874, 13919, 13965, 14010, 14056, 14101, 14146,
+    14192, 14237, 14282, 14327, 14373, 14418, 14463, 14508, 14553, 14598, 14643, 14688, 14733, 14778, 14823, 14867,
+    14912, 14957, 15002, 15046, 15091, 15136, 15180, 15225, 15269, 15314, 15358, 15402, 15447, 15491, 15535, 15580,
+    15624, 15668, 15712, 15756, 15800, 15844, 15888, 15932, 15976, 16020, 16064, 16108, 16151, 16195, 16239, 16282,
+    16326, 16369, 16413, 16456, 16500, 16543, 16587, 16630, 16673, 16717, 16760, 16803, 16846, 16889, 16932, 16975,
+    17018, 17061, 17104, 17147, 17190, 17233, 17275, 17318, 17361, 17403, 17446, 17488, 17531, 17573, 17616, 17658,
+    17700, 17743, 17785, 17827, 17869, 17911, 17953, 17995, 18037, 18079, 18121, 18163, 18205, 18247, 18288, 18330,
+    18372, 18413, 18455, 18496, 18538, 18579, 18621, 18662, 18703, 18745, 18786, 18827, 18868, 18909, 18950, 18991,
+    19032, 19073, 19114, 19155, 19195, 19236, 19277, 19317, 19358, 19399, 19439, 19479, 19520, 19560, 19601, 19641,
+    19681, 19721, 19761, 19801, 19841, 19881, 19921, 19961, 20001, 20041, 20081, 20120, 20160, 20200, 20239, 20279,
+    20318, 20357, 20397, 20436, 20475, 20515, 20554, 20593, 20632, 20671, 20710, 20749, 20788, 20827, 20865, 20904,
+    20943, 20981, 21020, 21059, 21097, 21136, 21174, 21212, 21251, 21289, 21327, 21365, 21403, 21441, 21479, 21517,
+    21555, 21593, 21631, 21668, 21706, 21744, 21781, 21819, 21856, 21894, 21931, 21968, 22006, 22043, 22080, 22117,
+    22154, 22191, 22228, 22265, 22302, 22339, 22375, 22412, 22449, 22485, 22522, 22558, 22595, 22631, 22668, 22704,
+    22740, 22776, 22812, 22848, 22884, 22920, 22956, 22992, 23028, 23064, 23099, 23135, 23170, 23206, 23241, 23277,
+    23312, 23348, 23383, 23418, 23453, 23488, 23523, 23558, 23593, 23628, 23663, 23697, 23732, 23767, 23801, 23836,
+    23870, 23905, 23939, 23973, 24008, 24042, 24076, 24110, 24144, 24178, 24212, 24246, 24279, 24313, 24347, 24380,
+    24414, 24448, 24481, 24514, 24548, 24581, 24614, 24647, 24680, 24713, 24746, 24779, 24812, 24845, 24878, 24910,
+    24943, 24976, 25008, 25041, 25073, 25105, 25138, 25170, 25202, 25234, 25266, 25298, 25330, 25362, 25394, 25425,
+    25457, 25489, 25520, 25552, 25583, 25615, 25646, 25677, 25708, 25739, 25771, 25802, 25833, 25863, 25894, 25925,
+    25956, 25986, 26017, 26048, 26078, 26108, 26139, 26169, 26199, 26229, 26259, 26290, 26320, 26349, 26379, 26409,
+    26439, 26468, 26498, 26528, 26557, 26586, 26616, 26645, 26674, 26704, 26733, 26762, 26791, 26820, 26848, 26877,
+    26906, 26935, 26963, 26992, 27020, 27049, 27077, 27105, 27133, 27162, 27190, 27218, 27246, 27273, 27301, 27329,
+    27357, 27384, 27412, 27440, 27467, 27494, 27522, 27549, 27576, 27603, 27630, 27657, 27684, 27711, 27738, 27765,
+    27791, 27818, 27844, 27871, 27897, 27924, 27950, 27976, 28002, 28028, 28054, 28080, 28106, 28132, 28158, 28183,
+    28209, 28234, 28260, 28285, 28311, 28336, 28361, 28386, 28411, 28436, 28461, 28486, 28511, 28536, 28560, 28585,
+    28610, 28634, 28658, 28683, 28707, 28731, 28755, 28779, 28803, 28827, 28851, 28875, 28899, 28922, 28946, 28970,
+    28993, 29016, 29040, 29063, 29086, 29109, 29132, 29155, 29178, 29201, 29224, 29247, 29269, 29292, 29314, 29337,
+    29359, 29381, 29404, 29426, 29448, 29470, 29492, 29514, 29535, 29557, 29579, 29600, 29622, 29643, 29665, 29686,
+    29707, 29729, 29750, 29771, 29792, 29813, 29833, 29854, 29875, 29895, 29916, 29936, 29957, 29977, 29997, 30018,
+    30038, 30058, 30078, 30098, 30118, 30137, 30157, 30177, 30196, 30216, 30235, 30254, 30274, 30293, 30312, 30331,
+    30350, 30369, 30388, 30407, 30425, 30444, 30462, 30481, 30499, 30518, 30536, 30554, 30572, 30590, 30608, 30626,
+    30644, 30662, 30680, 30697, 30715, 30732, 30750, 30767, 30784, 30801, 30819, 30836, 30853, 30869, 30886, 30903,
+    30920, 30936, 30953, 30969, 30986, 31002, 31018, 31034, 31050, 31067, 31082, 31098, 31114, 31130, 31146, 31161,
+    31177, 31192, 31207, 31223, 31238, 31253, 31268, 31283, 31298, 31313, 31328, 31342, 31357, 31372, 31386, 31400,
+    31415, 31429, 31443, 31457, 31471, 31485, 31499, 31513, 31527, 31540, 31554, 31568, 31581, 31594, 31608, 31621,
+    31634, 31647, 31660, 31673, 31686, 31699, 31711, 31724, 31737, 31749, 31761, 31774, 31786, 31798, 31810, 31822,
+    31834, 31846, 31858, 31870, 31881, 31893, 31904, 31916, 31927, 31938, 31950, 31961, 31972, 31983, 31994, 32005,
+    32015, 32026, 32037, 32047, 32058, 32068, 32078, 32088, 32099, 32109, 32119, 32129, 32138, 32148, 32158, 32167,
+    32177, 32186, 32196, 32205, 32214, 32224, 32233, 32242, 32251, 32259, 32268, 32277, 32286, 32294, 32303, 32311,
+    32319, 32328, 32336, 32344, 32352, 32360, 32368, 32376, 32383, 32391, 32398, 32406, 32413, 32421, 32428, 32435,
+    32442, 32449, 32456, 32463, 32470, 32477, 32483, 32490, 32496, 32503, 32509, 32515, 32522, 32528, 32534, 32540,
+    32546, 32551, 32557, 32563, 32568, 32574, 32579, 32585, 32590, 32595, 32600, 32605, 32610, 32615, 32620, 32625,
+    32629, 32634, 32638, 32643, 32647, 32651, 32656, 32660, 32664, 32668, 32672, 32675, 32679, 32683, 32686, 32690,
+    32693, 32697, 32700, 32703, 32706, 32709, 32712, 32715, 32718, 32721, 32723, 32726, 32729, 32731, 32733, 32736,
+    32738, 32740, 32742, 32744, 32746, 32748, 32749, 32751, 32753, 32754, 32756, 32757, 32758, 32759, 32760, 32761,
+    32762, 32763, 32764, 32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767
 };
-#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_10
 
+#endif
+
+#else
+
+/**
+ * Lookup table between \f$sin(0)\f$ and \f$sin(2*\pi)\f$
+ * Tables are available for IFX_MATH_CFG_SIN_LUT_SIZE = 8, 9, 10, 11, 12 bit.
+ * Table size is (2^IFX_MATH_CFG_SIN_LUT_SIZE) + 1
+ * Generated by foc_gen_tables of the host build
+ */
+#if IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_8
+const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[257] = {
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602, 6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793, 12540, 13279, 14010,
+    14733, 15447, 16151, 16846, 17531, 18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595, 23170, 23732, 24279,
+    24812, 25330, 25833, 26320, 26791, 27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957, 30274, 30572, 30853,
+    31114, 31357, 31581, 31786, 31972, 32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758, 32767, 32758, 32729,
+    32679, 32610, 32522, 32413, 32286, 32138, 31972, 31786, 31581, 31357, 31114, 30853, 30572, 30274, 29957, 29622,
+    29269, 28899, 28511, 28106, 27684, 27246, 26791, 26320, 25833, 25330, 24812, 24279, 23732, 23170, 22595, 22006,
+    21403, 20788, 20160, 19520, 18868, 18205, 17531, 16846, 16151, 15447, 14733, 14010, 13279, 12540, 11793, 11039,
+    10279, 9512, 8740, 7962, 7180, 6393, 5602, 4808, 4011, 3212, 2411, 1608, 804, 0, -804, -1608, -2411, -3212, -4011,
+    -4808, -5602, -6393, -7180, -7962, -8740, -9512, -10279, -11039, -11793, -12540, -13279, -14010, -14733, -15447,
+    -16151, -16846, -17531, -18205, -18868, -19520, -20160, -20788, -21403, -22006, -22595, -23170, -23732, -24279,
+    -24812, -25330, -25833, -26320, -26791, -27246, -27684, -28106, -28511, -28899, -29269, -29622, -29957, -30274,
+    -30572, -30853, -31114, -31357, -31581, -31786, -31972, -32138, -32286, -32413, -32522, -32610, -32679, -32729,
+    -32758, -32768, -32758, -32729, -32679, -32610, -32522, -32413, -32286, -32138, -31972, -31786, -31581, -31357,
+    -31114, -30853, -30572, -30274, -29957, -29622, -29269, -28899, -28511, -28106, -27684, -27246, -26791, -26320,
+    -25833, -25330, -24812, -24279, -23732, -23170, -22595, -22006, -21403, -20788, -20160, -19520, -18868, -18205,
+    -17531, -16846, -16151, -15447, -14733, -14010, -13279, -12540, -11793, -11039, -10279, -9512, -8740, -7962, -7180,
+    -6393, -5602, -4808, -4011, -3212, -2411, -1608, -804, 0
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_9
+const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[513] = {
+    0, 402, 804, 1206, 1608, 2009, 2411, 2811, 3212, 3612, 4011, 4410, 4808, 5205, 5602, 5998, 6393, 6787, 7180, 7571,
+    7962, 8351, 8740, 9127, 9512, 9896, 10279, 10660, 11039, 11417, 11793, 12167, 12540, 12910, 13279, 13646, 14010,
+    14373, 14733, 15091, 15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869, 18205, 18538, 18868, 19195, 19520,
+    19841, 20160, 20475, 20788, 21097, 21403, 21706, 22006, 22302, 22595, 22884, 23170, 23453, 23732, 24008, 24279,
+    24548, 24812, 25073, 25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020, 27246, 27467, 27684, 27897, 28106,
+    28311, 28511, 28707, 28899, 29086, 29269, 29448, 29622, 29792, 29957, 30118, 30274, 30425, 30572, 30715, 30853,
+    30986, 31114, 31238, 31357, 31471, 31581, 31686, 31786, 31881, 31972, 32058, 32138, 32214, 32286, 32352, 32413,
+    32470, 32522, 32568, 32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766, 32767, 32766, 32758, 32746, 32729,
+    32706, 32679, 32647, 32610, 32568, 32522, 32470, 32413, 32352, 32286, 32214, 32138, 32058, 31972, 31881, 31786,
+    31686, 31581, 31471, 31357, 31238, 31114, 30986, 30853, 30715, 30572, 30425, 30274, 30118, 29957, 29792, 29622,
+    29448, 29269, 29086, 28899, 28707, 28511, 28311, 28106, 27897, 27684, 27467, 27246, 27020, 26791, 26557, 26320,
+    26078, 25833, 25583, 25330, 25073, 24812, 24548, 24279, 24008, 23732, 23453, 23170, 22884, 22595, 22302, 22006,
+    21706, 21403, 21097, 20788, 20475, 20160, 19841, 19520, 19195, 18868, 18538, 18205, 17869, 17531, 17190, 16846,
+    16500, 16151, 15800, 15447, 15091, 14733, 14373, 14010, 13646, 13279, 12910, 12540, 12167, 11793, 11417, 11039,
+    10660, 10279, 9896, 9512, 9127, 8740, 8351, 7962, 7571, 7180, 6787, 6393, 5998, 5602, 5205, 4808, 4410, 4011, 3612,
+    3212, 2811, 2411, 2009, 1608, 1206, 804, 402, 0, -402, -804, -1206, -1608, -2009, -2411, -2811, -3212, -3612, -4011,
+    -4410, -4808, -5205, -5602, -5998, -6393, -6787, -7180, -7571, -7962, -8351, -8740, -9127, -9512, -9896, -10279,
+    -10660, -11039, -11417, -11793, -12167, -12540, -12910, -13279, -13646, -14010, -14373, -14733, -15091, -15447,
+    -15800, -16151, -16500, -16846, -17190, -17531, -17869, -18205, -18538, -18868, -19195, -19520, -19841, -20160,
+    -20475, -20788, -21097, -21403, -21706, -22006, -22302, -22595, -22884, -23170, -23453, -23732, -24008, -24279,
+    -24548, -24812, -25073, -25330, -25583, -25833, -26078, -26320, -26557, -26791, -27020, -27246, -27467, -27684,
+    -27897, -28106, -28311, -28511, -28707, -28899, -29086, -29269, -29448, -29622, -29792, -29957, -30118, -30274,
+    -30425, -30572, -30715, -30853, -30986, -31114, -31238, -31357, -31471, -31581, -31686, -31786, -31881, -31972,
+    -32058, -32138, -32214, -32286, -32352, -32413, -32470, -32522, -32568, -32610, -32647, -32679, -32706, -32729,
+    -32746, -32758, -32766, -32768, -32766, -32758, -32746, -32729, -32706, -32679, -32647, -32610, -32568, -32522,
+    -32470, -32413, -32352, -32286, -32214, -32138, -32058, -31972, -31881, -31786, -31686, -31581, -31471, -31357,
+    -31238, -31114, -30986, -30853, -30715, -30572, -30425, -30274, -30118, -29957, -29792, -29622, -29448, -29269,
+    -29086, -28899, -28707, -28511, -28311, -28106, -27897, -27684, -27467, -27246, -27020, -26791, -26557, -26320,
+    -26078, -25833, -25583, -25330, -25073, -24812, -24548, -24279, -24008, -23732, -23453, -23170, -22884, -22595,
+    -22302, -22006, -21706, -21403, -21097, -20788, -20475, -20160, -19841, -19520, -19195, -18868, -18538, -18205,
+    -17869, -17531, -17190, -16846, -16500, -16151, -15800, -15447, -15091, -14733, -14373, -14010, -13646, -13279,
+    -12910, -12540, -12167, -11793, -11417, -11039, -10660, -10279, -9896, -9512, -9127, -8740, -8351, -7962, -7571,
+    -7180, -6787, -6393, -5998, -5602, -5205, -4808, -4410, -4011, -3612, -3212, -2811, -2411, -2009, -1608, -1206,
+    -804, -402, 0
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_10
 const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[1025] = {
     0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809, 2009, 2210, 2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812,
     4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800, 5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376, 7571,
@@ -339,42 +263,451 @@ const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[1025] = {
     10850, 10660, 10469, 10279, 10088, 9896, 9704, 9512, 9319, 9127, 8933, 8740, 8546, 8351, 8157, 7962, 7767, 7571,
     7376, 7180, 6983, 6787, 6590, 6393, 6195, 5998, 5800, 5602, 5404, 5205, 5007, 4808, 4609, 4410, 4211, 4011, 3812,
     3612, 3412, 3212, 3012, 2811, 2611, 2411, 2210, 2009, 1809, 1608, 1407, 1206, 1005, 804, 603, 402, 201, 0, -201,
-    -402, -603, -804, -1005, -1206, -1407, -1608, -1809, -2009, -2210, -2411, -2611, -2811, -3012, -3212, -3412,
-    -3612, -3812, -4011, -4211, -4410, -4609, -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195, -6393, -6590,
-    -6787, -6983, -7180, -7376, -7571, -7767, -7962, -8157, -8351, -8546, -8740, -8933, -9127, -9319, -9512, -9704,
-    -9896, -10088, -10279, -10469, -10660, -10850, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12354,
-    -12540, -12725, -12910, -13095, -13279, -13463, -13646, -13828, -14010, -14192, -14373, -14553, -14733, -14912,
-    -15091, -15269, -15447, -15624, -15800, -15976, -16151, -16326, -16500, -16673, -16846, -17018, -17190, -17361,
-    -17531, -17700, -17869, -18037, -18205, -18372, -18538, -18703, -18868, -19032, -19195, -19358, -19520, -19681,
-    -19841, -20001, -20160, -20318, -20475, -20632, -20788, -20943, -21097, -21251, -21403, -21555, -21706, -21856,
-    -22006, -22154, -22302, -22449, -22595, -22740, -22884, -23028, -23170, -23312, -23453, -23593, -23732, -23870,
-    -24008, -24144, -24279, -24414, -24548, -24680, -24812, -24943, -25073, -25202, -25330, -25457, -25583, -25708,
-    -25833, -25956, -26078, -26199, -26320, -26439, -26557, -26674, -26791, -26906, -27020, -27133, -27246, -27357,
-    -27467, -27576, -27684, -27791, -27897, -28002, -28106, -28209, -28311, -28411, -28511, -28610, -28707, -28803,
-    -28899, -28993, -29086, -29178, -29269, -29359, -29448, -29535, -29622, -29707, -29792, -29875, -29957, -30038,
-    -30118, -30196, -30274, -30350, -30425, -30499, -30572, -30644, -30715, -30784, -30853, -30920, -30986, -31050,
-    -31114, -31177, -31238, -31298, -31357, -31415, -31471, -31527, -31581, -31634, -31686, -31737, -31786, -31834,
-    -31881, -31927, -31972, -32015, -32058, -32099, -32138, -32177, -32214, -32251, -32286, -32319, -32352, -32383,
-    -32413, -32442, -32470, -32496, -32522, -32546, -32568, -32590, -32610, -32629, -32647, -32664, -32679, -32693,
-    -32706, -32718, -32729, -32738, -32746, -32753, -32758, -32762, -32766, -32767, -32768, -32767, -32766, -32762,
-    -32758, -32753, -32746, -32738, -32729, -32718, -32706, -32693, -32679, -32664, -32647, -32629, -32610, -32590,
-    -32568, -32546, -32522, -32496, -32470, -32442, -32413, -32383, -32352, -32319, -32286, -32251, -32214, -32177,
-    -32138, -32099, -32058, -32015, -31972, -31927, -31881, -31834, -31786, -31737, -31686, -31634, -31581, -31527,
-    -31471, -31415, -31357, -31298, -31238, -31177, -31114, -31050, -30986, -30920, -30853, -30784, -30715, -30644,
-    -30572, -30499, -30425, -30350, -30274, -30196, -30118, -30038, -29957, -29875, -29792, -29707, -29622, -29535,
-    -29448, -29359, -29269, -29178, -29086, -28993, -28899, -28803, -28707, -28610, -28511, -28411, -28311, -28209,
-    -28106, -28002, -27897, -27791, -27684, -27576, -27467, -27357, -27246, -27133, -27020, -26906, -26791, -26674,
-    -26557, -26439, -26320, -26199, -26078, -25956, -25833, -25708, -25583, -25457, -25330, -25202, -25073, -24943,
-    -24812, -24680, -24548, -24414, -24279, -24144, -24008, -23870, -23732, -23593, -23453, -23312, -23170, -23028,
-    -22884, -22740, -22595, -22449, -22302, -22154, -22006, -21856, -21706, -21555, -21403, -21251, -21097, -20943,
-    -20788, -20632, -20475, -20318, -20160, -20001, -19841, -19681, -19520, -19358, -19195, -19032, -18868, -18703,
-    -18538, -18372, -18205, -18037, -17869, -17700, -17531, -17361, -17190, -17018, -16846, -16673, -16500, -16326,
-    -16151, -15976, -15800, -15624, -15447, -15269, -15091, -14912, -14733, -14553, -14373, -14192, -14010, -13828,
-    -13646, -13463, -13279, -13095, -12910, -12725, -12540, -12354, -12167, -11980, -11793, -11605, -11417, -11228,
-    -11039, -10850, -10660, -10469, -10279, -10088, -9896, -9704, -9512, -9319, -9127, -8933, -8740, -8546, -8351,
-    -8157, -7962, -7767, -7571, -7376, -7180, -6983, -6787, -6590, -6393, -6195, -5998, -5800, -5602, -5404, -5205,
-    -5007, -4808, -4609, -4410, -4211, -4011, -3812, -3612, -3412, -3212, -3012, -2811, -2611, -2411, -2210, -2009,
-    -1809, -1608, -1407, -1206, -1005, -804, -603, -402, -201, 0
+    -402, -603, -804, -1005, -1206, -1407, -1608, -1809, -2009, -2210, -2411, -2611, -2811, -3012, -3212, -3412, -3612,
+    -3812, -4011, -4211, -4410, -4609, -4808, -5007, -5205, -5404, -5602, -5800, -5998, -6195, -6393, -6590, -6787,
+    -6983, -7180, -7376, -7571, -7767, -7962, -8157, -8351, -8546, -8740, -8933, -9127, -9319, -9512, -9704, -9896,
+    -10088, -10279, -10469, -10660, -10850, -11039, -11228, -11417, -11605, -11793, -11980, -12167, -12354, -12540,
+    -12725, -12910, -13095, -13279, -13463, -13646, -13828, -14010, -14192, -14373, -14553, -14733, -14912, -15091,
+    -15269, -15447, -15624, -15800, -15976, -16151, -16326, -16500, -16673, -16846, -17018, -17190, -17361, -17531,
+    -17700, -17869, -18037, -18205, -18372, -18538, -18703, -18868, -19032, -19195, -19358, -19520, -19681, -19841,
+    -20001, -20160, -20318, -20475, -20632, -20788, -20943, -21097, -21251, -21403, -21555, -21706, -21856, -22006,
+    -22154, -22302, -22449, -22595, -22740, -22884, -23028, -23170, -23312, -23453, -23593, -23732, -23870, -24008,
+    -24144, -24279, -24414, -24548, -24680, -24812, -24943, -25073, -25202, -25330, -25457, -25583, -25708, -25833,
+    -25956, -26078, -26199, -26320, -26439, -26557, -26674, -26791, -26906, -27020, -27133, -27246, -27357, -27467,
+    -27576, -27684, -27791, -27897, -28002, -28106, -28209, -28311, -28411, -28511, -28610, -28707, -28803, -28899,
+    -28993, -29086, -29178, -29269, -29359, -29448, -29535, -29622, -29707, -29792, -29875, -29957, -30038, -30118,
+    -30196, -30274, -30350, -30425, -30499, -30572, -30644, -30715, -30784, -30853, -30920, -30986, -31050, -31114,
+    -31177, -31238, -31298, -31357, -31415, -31471, -31527, -31581, -31634, -31686, -31737, -31786, -31834, -31881,
+    -31927, -31972, -32015, -32058, -32099, -32138, -32177, -32214, -32251, -32286, -32319, -32352, -32383, -32413,
+    -32442, -32470, -32496, -32522, -32546, -32568, -32590, -32610, -32629, -32647, -32664, -32679, -32693, -32706,
+    -32718, -32729, -32738, -32746, -32753, -32758, -32762, -32766, -32767, -32768, -32767, -32766, -32762, -32758,
+    -32753, -32746, -32738, -32729, -32718, -32706, -32693, -32679, -32664, -32647, -32629, -32610, -32590, -32568,
+    -32546, -32522, -32496, -32470, -32442, -32413, -32383, -32352, -32319, -32286, -32251, -32214, -32177, -32138,
+    -32099, -32058, -32015, -31972, -31927, -31881, -31834, -31786, -31737, -31686, -31634, -31581, -31527, -31471,
+    -31415, -31357, -31298, -31238, -31177, -31114, -31050, -30986, -30920, -30853, -30784, -30715, -30644, -30572,
+    -30499, -30425, -30350, -30274, -30196, -30118, -30038, -29957, -29875, -29792, -29707, -29622, -29535, -29448,
+    -29359, -29269, -29178, -29086, -28993, -28899, -28803, -28707, -28610, -28511, -28411, -28311, -28209, -28106,
+    -28002, -27897, -27791, -27684, -27576, -27467, -27357, -27246, -27133, -27020, -26906, -26791, -26674, -26557,
+    -26439, -26320, -26199, -26078, -25956, -25833, -25708, -25583, -25457, -25330, -25202, -25073, -24943, -24812,
+    -24680, -24548, -24414, -24279, -24144, -24008, -23870, -23732, -23593, -23453, -23312, -23170, -23028, -22884,
+    -22740, -22595, -22449, -22302, -22154, -22006, -21856, -21706, -21555, -21403, -21251, -21097, -20943, -20788,
+    -20632, -20475, -20318, -20160, -20001, -19841, -19681, -19520, -19358, -19195, -19032, -18868, -18703, -18538,
+    -18372, -18205, -18037, -17869, -17700, -17531, -17361, -17190, -17018, -16846, -16673, -16500, -16326, -16151,
+    -15976, -15800, -15624, -15447, -15269, -15091, -14912, -14733, -14553, -14373, -14192, -14010, -13828, -13646,
+    -13463, -13279, -13095, -12910, -12725, -12540, -12354, -12167, -11980, -11793, -11605, -11417, -11228, -11039,
+    -10850, -10660, -10469, -10279, -10088, -9896, -9704, -9512, -9319, -9127, -8933, -8740, -8546, -8351, -8157, -7962,
+    -7767, -7571, -7376, -7180, -6983, -6787, -6590, -6393, -6195, -5998, -5800, -5602, -5404, -5205, -5007, -4808,
+    -4609, -4410, -4211, -4011, -3812, -3612, -3412, -3212, -3012, -2811, -2611, -2411, -2210, -2009, -1809, -1608,
+    -1407, -1206, -1005, -804, -603, -402, -201, 0
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_11
+const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[2049] = {
+    0, 101, 201, 302, 402, 503, 603, 704, 804, 905, 1005, 1106, 1206, 1307, 1407, 1507, 1608, 1708, 1809, 1909, 2009,
+    2110, 2210, 2310, 2411, 2511, 2611, 2711, 2811, 2912, 3012, 3112, 3212, 3312, 3412, 3512, 3612, 3712, 3812, 3911,
+    4011, 4111, 4211, 4310, 4410, 4510, 4609, 4709, 4808, 4907, 5007, 5106, 5205, 5305, 5404, 5503, 5602, 5701, 5800,
+    5899, 5998, 6097, 6195, 6294, 6393, 6491, 6590, 6688, 6787, 6885, 6983, 7081, 7180, 7278, 7376, 7473, 7571, 7669,
+    7767, 7864, 7962, 8059, 8157, 8254, 8351, 8449, 8546, 8643, 8740, 8836, 8933, 9030, 9127, 9223, 9319, 9416, 9512,
+    9608, 9704, 9800, 9896, 9992, 10088, 10183, 10279, 10374, 10469, 10565, 10660, 10755, 10850, 10945, 11039, 11134,
+    11228, 11323, 11417, 11511, 11605, 11699, 11793, 11887, 11980, 12074, 12167, 12261, 12354, 12447, 12540, 12633,
+    12725, 12818, 12910, 13003, 13095, 13187, 13279, 13371, 13463, 13554, 13646, 13737, 13828, 13919, 14010, 14101,
+    14192, 14282, 14373, 14463, 14553, 14643, 14733, 14823, 14912, 15002, 15091, 15180, 15269, 15358, 15447, 15535,
+    15624, 15712, 15800, 15888, 15976, 16064, 16151, 16239, 16326, 16413, 16500, 16587, 16673, 16760, 16846, 16932,
+    17018, 17104, 17190, 17275, 17361, 17446, 17531, 17616, 17700, 17785, 17869, 17953, 18037, 18121, 18205, 18288,
+    18372, 18455, 18538, 18621, 18703, 18786, 18868, 18950, 19032, 19114, 19195, 19277, 19358, 19439, 19520, 19601,
+    19681, 19761, 19841, 19921, 20001, 20081, 20160, 20239, 20318, 20397, 20475, 20554, 20632, 20710, 20788, 20865,
+    20943, 21020, 21097, 21174, 21251, 21327, 21403, 21479, 21555, 21631, 21706, 21781, 21856, 21931, 22006, 22080,
+    22154, 22228, 22302, 22375, 22449, 22522, 22595, 22668, 22740, 22812, 22884, 22956, 23028, 23099, 23170, 23241,
+    23312, 23383, 23453, 23523, 23593, 23663, 23732, 23801, 23870, 23939, 24008, 24076, 24144, 24212, 24279, 24347,
+    24414, 24481, 24548, 24614, 24680, 24746, 24812, 24878, 24943, 25008, 25073, 25138, 25202, 25266, 25330, 25394,
+    25457, 25520, 25583, 25646, 25708, 25771, 25833, 25894, 25956, 26017, 26078, 26139, 26199, 26259, 26320, 26379,
+    26439, 26498, 26557, 26616, 26674, 26733, 26791, 26848, 26906, 26963, 27020, 27077, 27133, 27190, 27246, 27301,
+    27357, 27412, 27467, 27522, 27576, 27630, 27684, 27738, 27791, 27844, 27897, 27950, 28002, 28054, 28106, 28158,
+    28209, 28260, 28311, 28361, 28411, 28461, 28511, 28560, 28610, 28658, 28707, 28755, 28803, 28851, 28899, 28946,
+    28993, 29040, 29086, 29132, 29178, 29224, 29269, 29314, 29359, 29404, 29448, 29492, 29535, 29579, 29622, 29665,
+    29707, 29750, 29792, 29833, 29875, 29916, 29957, 29997, 30038, 30078, 30118, 30157, 30196, 30235, 30274, 30312,
+    30350, 30388, 30425, 30462, 30499, 30536, 30572, 30608, 30644, 30680, 30715, 30750, 30784, 30819, 30853, 30886,
+    30920, 30953, 30986, 31018, 31050, 31082, 31114, 31146, 31177, 31207, 31238, 31268, 31298, 31328, 31357, 31386,
+    31415, 31443, 31471, 31499, 31527, 31554, 31581, 31608, 31634, 31660, 31686, 31711, 31737, 31761, 31786, 31810,
+    31834, 31858, 31881, 31904, 31927, 31950, 31972, 31994, 32015, 32037, 32058, 32078, 32099, 32119, 32138, 32158,
+    32177, 32196, 32214, 32233, 32251, 32268, 32286, 32303, 32319, 32336, 32352, 32368, 32383, 32398, 32413, 32428,
+    32442, 32456, 32470, 32483, 32496, 32509, 32522, 32534, 32546, 32557, 32568, 32579, 32590, 32600, 32610, 32620,
+    32629, 32638, 32647, 32656, 32664, 32672, 32679, 32686, 32693, 32700, 32706, 32712, 32718, 32723, 32729, 32733,
+    32738, 32742, 32746, 32749, 32753, 32756, 32758, 32760, 32762, 32764, 32766, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32766, 32764, 32762, 32760, 32758, 32756, 32753, 32749, 32746, 32742, 32738, 32733, 32729, 32723,
+    32718, 32712, 32706, 32700, 32693, 32686, 32679, 32672, 32664, 32656, 32647, 32638, 32629, 32620, 32610, 32600,
+    32590, 32579, 32568, 32557, 32546, 32534, 32522, 32509, 32496, 32483, 32470, 32456, 32442, 32428, 32413, 32398,
+    32383, 32368, 32352, 32336, 32319, 32303, 32286, 32268, 32251, 32233, 32214, 32196, 32177, 32158, 32138, 32119,
+    32099, 32078, 32058, 32037, 32015, 31994, 31972, 31950, 31927, 31904, 31881, 31858, 31834, 31810, 31786, 31761,
+    31737, 31711, 31686, 31660, 31634, 31608, 31581, 31554, 31527, 31499, 31471, 31443, 31415, 31386, 31357, 31328,
+    31298, 31268, 31238, 31207, 31177, 31146, 31114, 31082, 31050, 31018, 30986, 30953, 30920, 30886, 30853, 30819,
+    30784, 30750, 30715, 30680, 30644, 30608, 30572, 30536, 30499, 30462, 30425, 30388, 30350, 30312, 30274, 30235,
+    30196, 30157, 30118, 30078, 30038, 29997, 29957, 29916, 29875, 29833, 29792, 29750, 29707, 29665, 29622, 29579,
+    29535, 29492, 29448, 29404, 29359, 29314, 29269, 29224, 29178, 29132, 29086, 29040, 28993, 28946, 28899, 28851,
+    28803, 28755, 28707, 28658, 28610, 28560, 28511, 28461, 28411, 28361, 28311, 28260, 28209, 28158, 28106, 28054,
+    28002, 27950, 27897, 27844, 27791, 27738, 27684, 27630, 27576, 27522, 27467, 27412, 27357, 27301, 27246, 27190,
+    27133, 27077, 27020, 26963, 26906, 26848, 26791, 26733, 26674, 26616, 26557, 26498, 26439, 26379, 26320, 26259,
+    26199, 26139, 26078, 26017, 25956, 25894, 25833, 25771, 25708, 25646, 25583, 25520, 25457, 25394, 25330, 25266,
+    25202, 25138, 25073, 25008, 24943, 24878, 24812, 24746, 24680, 24614, 24548, 24481, 24414, 24347, 24279, 24212,
+    24144, 24076, 24008, 23939, 23870, 23801, 23732, 23663, 23593, 23523, 23453, 23383, 23312, 23241, 23170, 23099,
+    23028, 22956, 22884, 22812, 22740, 22668, 22595, 22522, 22449, 22375, 22302, 22228, 22154, 22080, 22006, 21931,
+    21856, 21781, 21706, 21631, 21555, 21479, 21403, 21327, 21251, 21174, 21097, 21020, 20943, 20865, 20788, 20710,
+    20632, 20554, 20475, 20397, 20318, 20239, 20160, 20081, 20001, 19921, 19841, 19761, 19681, 19601, 19520, 19439,
+    19358, 19277, 19195, 19114, 19032, 18950, 18868, 18786, 18703, 18621, 18538, 18455, 18372, 18288, 18205, 18121,
+    18037, 17953, 17869, 17785, 17700, 17616, 17531, 17446, 17361, 17275, 17190, 17104, 17018, 16932, 16846, 16760,
+    16673, 16587, 16500, 16413, 16326, 16239, 16151, 16064, 15976, 15888, 15800, 15712, 15624, 15535, 15447, 15358,
+    15269, 15180, 15091, 15002, 14912, 14823, 14733, 14643, 14553, 14463, 14373, 14282, 14192, 14101, 14010, 13919,
+    13828, 13737, 13646, 13554, 13463, 13371, 13279, 13187, 13095, 13003, 12910, 12818, 12725, 12633, 12540, 12447,
+    12354, 12261, 12167, 12074, 11980, 11887, 11793, 11699, 11605, 11511, 11417, 11323, 11228, 11134, 11039, 10945,
+    10850, 10755, 10660, 10565, 10469, 10374, 10279, 10183, 10088, 9992, 9896, 9800, 9704, 9608, 9512, 9416, 9319, 9223,
+    9127, 9030, 8933, 8836, 8740, 8643, 8546, 8449, 8351, 8254, 8157, 8059, 7962, 7864, 7767, 7669, 7571, 7473, 7376,
+    7278, 7180, 7081, 6983, 6885, 6787, 6688, 6590, 6491, 6393, 6294, 6195, 6097, 5998, 5899, 5800, 5701, 5602, 5503,
+    5404, 5305, 5205, 5106, 5007, 4907, 4808, 4709, 4609, 4510, 4410, 4310, 4211, 4111, 4011, 3911, 3812, 3712, 3612,
+    3512, 3412, 3312, 3212, 3112, 3012, 2912, 2811, 2711, 2611, 2511, 2411, 2310, 2210, 2110, 2009, 1909, 1809, 1708,
+    1608, 1507, 1407, 1307, 1206, 1106, 1005, 905, 804, 704, 603, 503, 402, 302, 201, 101, 0, -101, -201, -302, -402,
+    -503, -603, -704, -804, -905, -1005, -1106, -1206, -1307, -1407, -1507, -1608, -1708, -1809, -1909, -2009, -2110,
+    -2210, -2310, -2411, -2511, -2611, -2711, -2811, -2912, -3012, -3112, -3212, -3312, -3412, -3512, -3612, -3712,
+    -3812, -3911, -4011, -4111, -4211, -4310, -4410, -4510, -4609, -4709, -4808, -4907, -5007, -5106, -5205, -5305,
+    -5404, -5503, -5602, -5701, -5800, -5899, -5998, -6097, -6195, -6294, -6393, -6491, -6590, -6688, -6787, -6885,
+    -6983, -7081, -7180, -7278, -7376, -7473, -7571, -7669, -7767, -7864, -7962, -8059, -8157, -8254, -8351, -8449,
+    -8546, -8643, -8740, -8836, -8933, -9030, -9127, -9223, -9319, -9416, -9512, -9608, -9704, -9800, -9896, -9992,
+    -10088, -10183, -10279, -10374, -10469, -10565, -10660, -10755, -10850, -10945, -11039, -11134, -11228, -11323,
+    -11417, -11511, -11605, -11699, -11793, -11887, -11980, -12074, -12167, -12261, -12354, -12447, -12540, -12633,
+    -12725, -12818, -12910, -13003, -13095, -13187, -13279, -13371, -13463, -13554, -13646, -13737, -13828, -13919,
+    -14010, -14101, -14192, -14282, -14373, -14463, -14553, -14643, -14733, -14823, -14912, -15002, -15091, -15180,
+    -15269, -15358, -15447, -15535, -15624, -15712, -15800, -15888, -15976, -16064, -16151, -16239, -16326, -16413,
+    -16500, -16587, -16673, -16760, -16846, -16932, -17018, -17104, -17190, -17275, -17361, -17446, -17531, -17616,
+    -17700, -17785, -17869, -17953, -18037, -18121, -18205, -18288, -18372, -18455, -18538, -18621, -18703, -18786,
+    -18868, -18950, -19032, -19114, -19195, -19277, -19358, -19439, -19520, -19601, -19681, -19761, -19841, -19921,
+    -20001, -20081, -20160, -20239, -20318, -20397, -20475, -20554, -20632, -20710, -20788, -20865, -20943, -21020,
+    -21097, -21174, -21251, -21327, -21403, -21479, -21555, -21631, -21706, -21781, -21856, -21931, -22006, -22080,
+    -22154, -22228, -22302, -22375, -22449, -22522, -22595, -22668, -22740, -22812, -22884, -22956, -23028, -23099,
+    -23170, -23241, -23312, -23383, -23453, -23523, -23593, -23663, -23732, -23801, -23870, -23939, -24008, -24076,
+    -24144, -24212, -24279, -24347, -24414, -24481, -24548, -24614, -24680, -24746, -24812, -24878, -24943, -25008,
+    -25073, -25138, -25202, -25266, -25330, -25394, -25457, -25520, -25583, -25646, -25708, -25771, -25833, -25894,
+    -25956, -26017, -26078, -26139, -26199, -26259, -26320, -26379, -26439, -26498, -26557, -26616, -26674, -26733,
+    -26791, -26848, -26906, -26963, -27020, -27077, -27133, -27190, -27246, -27301, -27357, -27412, -27467, -27522,
+    -27576, -27630, -27684, -27738, -27791, -27844, -27897, -27950, -28002, -28054, -28106, -28158, -28209, -28260,
+    -28311, -28361, -28411, -28461, -28511, -28560, -28610, -28658, -28707, -28755, -28803, -28851, -28899, -28946,
+    -28993, -29040, -29086, -29132, -29178, -29224, -29269, -29314, -29359, -29404, -29448, -29492, -29535, -29579,
+    -29622, -29665, -29707, -29750, -29792, -29833, -29875, -29916, -29957, -29997, -30038, -30078, -30118, -30157,
+    -30196, -30235, -30274, -30312, -30350, -30388, -30425, -30462, -30499, -30536, -30572, -30608, -30644, -30680,
+    -30715, -30750, -30784, -30819, -30853, -30886, -30920, -30953, -30986, -31018, -31050, -31082, -31114, -31146,
+    -31177, -31207, -31238, -31268, -31298, -31328, -31357, -31386, -31415, -31443, -31471, -31499, -31527, -31554,
+    -31581, -31608, -31634, -31660, -31686, -31711, -31737, -31761, -31786, -31810, -31834, -31858, -31881, -31904,
+    -31927, -31950, -31972, -31994, -32015, -32037, -32058, -32078, -32099, -32119, -32138, -32158, -32177, -32196,
+    -32214, -32233, -32251, -32268, -32286, -32303, -32319, -32336, -32352, -32368, -32383, -32398, -32413, -32428,
+    -32442, -32456, -32470, -32483, -32496, -32509, -32522, -32534, -32546, -32557, -32568, -32579, -32590, -32600,
+    -32610, -32620, -32629, -32638, -32647, -32656, -32664, -32672, -32679, -32686, -32693, -32700, -32706, -32712,
+    -32718, -32723, -32729, -32733, -32738, -32742, -32746, -32749, -32753, -32756, -32758, -32760, -32762, -32764,
+    -32766, -32767, -32767, -32768, -32768, -32768, -32767, -32767, -32766, -32764, -32762, -32760, -32758, -32756,
+    -32753, -32749, -32746, -32742, -32738, -32733, -32729, -32723, -32718, -32712, -32706, -32700, -32693, -32686,
+    -32679, -32672, -32664, -32656, -32647, -32638, -32629, -32620, -32610, -32600, -32590, -32579, -32568, -32557,
+    -32546, -32534, -32522, -32509, -32496, -32483, -32470, -32456, -32442, -32428, -32413, -32398, -32383, -32368,
+    -32352, -32336, -32319, -32303, -32286, -32268, -32251, -32233, -32214, -32196, -32177, -32158, -32138, -32119,
+    -32099, -32078, -32058, -32037, -32015, -31994, -31972, -31950, -31927, -31904, -31881, -31858, -31834, -31810,
+    -31786, -31761, -31737, -31711, -31686, -31660, -31634, -31608, -31581, -31554, -31527, -31499, -31471, -31443,
+    -31415, -31386, -31357, -31328, -31298, -31268, -31238, -31207, -31177, -31146, -31114, -31082, -31050, -31018,
+    -30986, -30953, -30920, -30886, -30853, -30819, -30784, -30750, -30715, -30680, -30644, -30608, -30572, -30536,
+    -30499, -30462, -30425, -30388, -30350, -30312, -30274, -30235, -30196, -30157, -30118, -30078, -30038, -29997,
+    -29957, -29916, -29875, -29833, -29792, -29750, -29707, -29665, -29622, -29579, -29535, -29492, -29448, -29404,
+    -29359, -29314, -29269, -29224, -29178, -29132, -29086, -29040, -28993, -28946, -28899, -28851, -28803, -28755,
+    -28707, -28658, -28610, -28560, -28511, -28461, -28411, -28361, -28311, -28260, -28209, -28158, -28106, -28054,
+    -28002, -27950, -27897, -27844, -27791, -27738, -27684, -27630, -27576, -27522, -27467, -27412, -27357, -27301,
+    -27246, -27190, -27133, -27077, -27020, -26963, -26906, -26848, -26791, -26733, -26674, -26616, -26557, -26498,
+    -26439, -26379, -26320, -26259, -26199, -26139, -26078, -26017, -25956, -25894, -25833, -25771, -25708, -25646,
+    -25583, -25520, -25457, -25394, -25330, -25266, -25202, -25138, -25073, -25008, -24943, -24878, -24812, -24746,
+    -24680, -24614, -24548, -24481, -24414, -24347, -24279, -24212, -24144, -24076, -24008, -23939, -23870, -23801,
+    -23732, -23663, -23593, -23523, -23453, -23383, -23312, -23241, -23170, -23099, -23028, -22956, -22884, -22812,
+    -22740, -22668, -22595, -22522, -22449, -22375, -22302, -22228, -22154, -22080, -22006, -21931, -21856, -21781,
+    -21706, -21631, -21555, -21479, -21403, -21327, -21251, -21174, -21097, -21020, -20943, -20865, -20788, -20710,
+    -20632, -20554, -20475, -20397, -20318, -20239, -20160, -20081, -20001, -19921, -19841, -19761, -19681, -19601,
+    -19520, -19439, -19358, -19277, -19195, -19114, -19032, -18950, -18868, -18786, -18703, -18621, -18538, -18455,
+    -18372, -18288, -18205, -18121, -18037, -17953, -17869, -17785, -17700, -17616, -17531, -17446, -17361, -17275,
+    -17190, -17104, -17018, -16932, -16846, -16760, -16673, -16587, -16500, -16413, -16326, -16239, -16151, -16064,
+    -15976, -15888, -15800, -15712, -15624, -15535, -15447, -15358, -15269, -15180, -15091, -15002, -14912, -14823,
+    -14733, -14643, -14553, -14463, -14373, -14282, -14192, -14101, -14010, -13919, -13828, -13737, -13646, -13554,
+    -13463, -13371, -13279, -13187, -13095, -13003, -12910, -12818, -12725, -12633, -12540, -12447, -12354, -12261,
+    -12167, -12074, -11980, -11887, -11793, -11699, -11605, -11511, -11417, -11323, -11228, -11134, -11039, -10945,
+    -10850, -10755, -10660, -10565, -10469, -10374, -10279, -10183, -10088, -9992, -9896, -9800, -9704, -9608, -9512,
+    -9416, -9319, -9223, -9127, -9030, -8933, -8836, -8740, -8643, -8546, -8449, -8351, -8254, -8157, -8059, -7962,
+    -7864, -7767, -7669, -7571, -7473, -7376, -7278, -7180, -7081, -6983, -6885, -6787, -6688, -6590, -6491, -6393,
+    -6294, -6195, -6097, -5998, -5899, -5800, -5701, -5602, -5503, -5404, -5305, -5205, -5106, -5007, -4907, -4808,
+    -4709, -4609, -4510, -4410, -4310, -4211, -4111, -4011, -3911, -3812, -3712, -3612, -3512, -3412, -3312, -3212,
+    -3112, -3012, -2912, -2811, -2711, -2611, -2511, -2411, -2310, -2210, -2110, -2009, -1909, -1809, -1708, -1608,
+    -1507, -1407, -1307, -1206, -1106, -1005, -905, -804, -704, -603, -503, -402, -302, -201, -101, 0
+};
+
+#elif IFX_MATH_CFG_SIN_LUT_SIZE == IFX_MATH_USROPT_SIN_LUT_SIZE_12
+const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[4097] = {
+    0, 50, 101, 151, 201, 251, 302, 352, 402, 452, 503, 553, 603, 653, 704, 754, 804, 854, 905, 955, 1005, 1055, 1106,
+    1156, 1206, 1256, 1307, 1357, 1407, 1457, 1507, 1558, 1608, 1658, 1708, 1758, 1809, 1859, 1909, 1959, 2009, 2060,
+    2110, 2160, 2210, 2260, 2310, 2360, 2411, 2461, 2511, 2561, 2611, 2661, 2711, 2761, 2811, 2861, 2912, 2962, 3012,
+    3062, 3112, 3162, 3212, 3262, 3312, 3362, 3412, 3462, 3512, 3562, 3612, 3662, 3712, 3762, 3812, 3861, 3911, 3961,
+    4011, 4061, 4111, 4161, 4211, 4260, 4310, 4360, 4410, 4460, 4510, 4559, 4609, 4659, 4709, 4758, 4808, 4858, 4907,
+    4957, 5007, 5057, 5106, 5156, 5205, 5255, 5305, 5354, 5404, 5453, 5503, 5553, 5602, 5652, 5701, 5751, 5800, 5850,
+    5899, 5948, 5998, 6047, 6097, 6146, 6195, 6245, 6294, 6343, 6393, 6442, 6491, 6541, 6590, 6639, 6688, 6737, 6787,
+    6836, 6885, 6934, 6983, 7032, 7081, 7130, 7180, 7229, 7278, 7327, 7376, 7425, 7473, 7522, 7571, 7620, 7669, 7718,
+    7767, 7816, 7864, 7913, 7962, 8011, 8059, 8108, 8157, 8206, 8254, 8303, 8351, 8400, 8449, 8497, 8546, 8594, 8643,
+    8691, 8740, 8788, 8836, 8885, 8933, 8982, 9030, 9078, 9127, 9175, 9223, 9271, 9319, 9368, 9416, 9464, 9512, 9560,
+    9608, 9656, 9704, 9752, 9800, 9848, 9896, 9944, 9992, 10040, 10088, 10135, 10183, 10231, 10279, 10326, 10374, 10422,
+    10469, 10517, 10565, 10612, 10660, 10707, 10755, 10802, 10850, 10897, 10945, 10992, 11039, 11087, 11134, 11181,
+    11228, 11276, 11323, 11370, 11417, 11464, 11511, 11558, 11605, 11652, 11699, 11746, 11793, 11840, 11887, 11934,
+    11980, 12027, 12074, 12121, 12167, 12214, 12261, 12307, 12354, 12400, 12447, 12493, 12540, 12586, 12633, 12679,
+    12725, 12772, 12818, 12864, 12910, 12957, 13003, 13049, 13095, 13141, 13187, 13233, 13279, 13325, 13371, 13417,
+    13463, 13508, 13554, 13600, 13646, 13691, 13737, 13783, 13828, 13874, 13919, 13965, 14010, 14056, 14101, 14146,
+    14192, 14237, 14282, 14327, 14373, 14418, 14463, 14508, 14553, 14598, 14643, 14688, 14733, 14778, 14823, 14867,
+    14912, 14957, 15002, 15046, 15091, 15136, 15180, 15225, 15269, 15314, 15358, 15402, 15447, 15491, 15535, 15580,
+    15624, 15668, 15712, 15756, 15800, 15844, 15888, 15932, 15976, 16020, 16064, 16108, 16151, 16195, 16239, 16282,
+    16326, 16369, 16413, 16456, 16500, 16543, 16587, 16630, 16673, 16717, 16760, 16803, 16846, 16889, 16932, 16975,
+    17018, 17061, 17104, 17147, 17190, 17233, 17275, 17318, 17361, 17403, 17446, 17488, 17531, 17573, 17616, 17658,
+    17700, 17743, 17785, 17827, 17869, 17911, 17953, 17995, 18037, 18079, 18121, 18163, 18205, 18247, 18288, 18330,
+    18372, 18413, 18455, 18496, 18538, 18579, 18621, 18662, 18703, 18745, 18786, 18827, 18868, 18909, 18950, 18991,
+    19032, 19073, 19114, 19155, 19195, 19236, 19277, 19317, 19358, 19399, 19439, 19479, 19520, 19560, 19601, 19641,
+    19681, 19721, 19761, 19801, 19841, 19881, 19921, 19961, 20001, 20041, 20081, 20120, 20160, 20200, 20239, 20279,
+    20318, 20357, 20397, 20436, 20475, 20515, 20554, 20593, 20632, 20671, 20710, 20749, 20788, 20827, 20865, 20904,
+    20943, 20981, 21020, 21059, 21097, 21136, 21174, 21212, 21251, 21289, 21327, 21365, 21403, 21441, 21479, 21517,
+    21555, 21593, 21631, 21668, 21706, 21744, 21781, 21819, 21856, 21894, 21931, 21968, 22006, 22043, 22080, 22117,
+    22154, 22191, 22228, 22265, 22302, 22339, 22375, 22412, 22449, 22485, 22522, 22558, 22595, 22631, 22668, 22704,
+    22740, 22776, 22812, 22848, 22884, 22920, 22956, 22992, 23028, 23064, 23099, 23135, 23170, 23206, 23241, 23277,
+    23312, 23348, 23383, 23418, 23453, 23488, 23523, 23558, 23593, 23628, 23663, 23697, 23732, 23767, 23801, 23836,
+    23870, 23905, 23939, 23973, 24008, 24042, 24076, 24110, 24144, 24178, 24212, 24246, 24279, 24313, 24347, 24380,
+    24414, 24448, 24481, 24514, 24548, 24581, 24614, 24647, 24680, 24713, 24746, 24779, 24812, 24845, 24878, 24910,
+    24943, 24976, 25008, 25041, 25073, 25105, 25138, 25170, 25202, 25234, 25266, 25298, 25330, 25362, 25394, 25425,
+    25457, 25489, 25520, 25552, 25583, 25615, 25646, 25677, 25708, 25739, 25771, 25802, 25833, 25863, 25894, 25925,
+    25956, 25986, 26017, 26048, 26078, 26108, 26139, 26169, 26199, 26229, 26259, 26290, 26320, 26349, 26379, 26409,
+    26439, 26468, 26498, 26528, 26557, 26586, 26616, 26645, 26674, 26704, 26733, 26762, 26791, 26820, 26848, 26877,
+    26906, 26935, 26963, 26992, 27020, 27049, 27077, 27105, 27133, 27162, 27190, 27218, 27246, 27273, 27301, 27329,
+    27357, 27384, 27412, 27440, 27467, 27494, 27522, 27549, 27576, 27603, 27630, 27657, 27684, 27711, 27738, 27765,
+    27791, 27818, 27844, 27871, 27897, 27924, 27950, 27976, 28002, 28028, 28054, 28080, 28106, 28132, 28158, 28183,
+    28209, 28234, 28260, 28285, 28311, 28336, 28361, 28386, 28411, 28436, 28461, 28486, 28511, 28536, 28560, 28585,
+    28610, 28634, 28658, 28683, 28707, 28731, 28755, 28779, 28803, 28827, 28851, 28875, 28899, 28922, 28946, 28970,
+    28993, 29016, 29040, 29063, 29086, 29109, 29132, 29155, 29178, 29201, 29224, 29247, 29269, 29292, 29314, 29337,
+    29359, 29381, 29404, 29426, 29448, 29470, 29492, 29514, 29535, 29557, 29579, 29600, 29622, 29643, 29665, 29686,
+    29707, 29729, 29750, 29771, 29792, 29813, 29833, 29854, 29875, 29895, 29916, 29936, 29957, 29977, 29997, 30018,
+    30038, 30058, 30078, 30098, 30118, 30137, 30157, 30177, 30196, 30216, 30235, 30254, 30274, 30293, 30312, 30331,
+    30350, 30369, 30388, 30407, 30425, 30444, 30462, 30481, 30499, 30518, 30536, 30554, 30572, 30590, 30608, 30626,
+    30644, 30662, 30680, 30697, 30715, 30732, 30750, 30767, 30784, 30801, 30819, 30836, 30853, 30869, 30886, 30903,
+    30920, 30936, 30953, 30969, 30986, 31002, 31018, 31034, 31050, 31067, 31082, 31098, 31114, 31130, 31146, 31161,
+    31177, 31192, 31207, 31223, 31238, 31253, 31268, 31283, 31298, 31313, 31328, 31342, 31357, 31372, 31386, 31400,
+    31415, 31429, 31443, 31457, 31471, 31485, 31499, 31513, 31527, 31540, 31554, 31568, 31581, 31594, 31608, 31621,
+    31634, 31647, 31660, 31673, 31686, 31699, 31711, 31724, 31737, 31749, 31761, 31774, 31786, 31798, 31810, 31822,
+    31834, 31846, 31858, 31870, 31881, 31893, 31904, 31916, 31927, 31938, 31950, 31961, 31972, 31983, 31994, 32005,
+    32015, 32026, 32037, 32047, 32058, 32068, 32078, 32088, 32099, 32109, 32119, 32129, 32138, 32148, 32158, 32167,
+    32177, 32186, 32196, 32205, 32214, 32224, 32233, 32242, 32251, 32259, 32268, 32277, 32286, 32294, 32303, 32311,
+    32319, 32328, 32336, 32344, 32352, 32360, 32368, 32376, 32383, 32391, 32398, 32406, 32413, 32421, 32428, 32435,
+    32442, 32449, 32456, 32463, 32470, 32477, 32483, 32490, 32496, 32503, 32509, 32515, 32522, 32528, 32534, 32540,
+    32546, 32551, 32557, 32563, 32568, 32574, 32579, 32585, 32590, 32595, 32600, 32605, 32610, 32615, 32620, 32625,
+    32629, 32634, 32638, 32643, 32647, 32651, 32656, 32660, 32664, 32668, 32672, 32675, 32679, 32683, 32686, 32690,
+    32693, 32697, 32700, 32703, 32706, 32709, 32712, 32715, 32718, 32721, 32723, 32726, 32729, 32731, 32733, 32736,
+    32738, 32740, 32742, 32744, 32746, 32748, 32749, 32751, 32753, 32754, 32756, 32757, 32758, 32759, 32760, 32761,
+    32762, 32763, 32764, 32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32766, 32766, 32765, 32764, 32763, 32762, 32761, 32760, 32759, 32758, 32757, 32756, 32754,
+    32753, 32751, 32749, 32748, 32746, 32744, 32742, 32740, 32738, 32736, 32733, 32731, 32729, 32726, 32723, 32721,
+    32718, 32715, 32712, 32709, 32706, 32703, 32700, 32697, 32693, 32690, 32686, 32683, 32679, 32675, 32672, 32668,
+    32664, 32660, 32656, 32651, 32647, 32643, 32638, 32634, 32629, 32625, 32620, 32615, 32610, 32605, 32600, 32595,
+    32590, 32585, 32579, 32574, 32568, 32563, 32557, 32551, 32546, 32540, 32534, 32528, 32522, 32515, 32509, 32503,
+    32496, 32490, 32483, 32477, 32470, 32463, 32456, 32449, 32442, 32435, 32428, 32421, 32413, 32406, 32398, 32391,
+    32383, 32376, 32368, 32360, 32352, 32344, 32336, 32328, 32319, 32311, 32303, 32294, 32286, 32277, 32268, 32259,
+    32251, 32242, 32233, 32224, 32214, 32205, 32196, 32186, 32177, 32167, 32158, 32148, 32138, 32129, 32119, 32109,
+    32099, 32088, 32078, 32068, 32058, 32047, 32037, 32026, 32015, 32005, 31994, 31983, 31972, 31961, 31950, 31938,
+    31927, 31916, 31904, 31893, 31881, 31870, 31858, 31846, 31834, 31822, 31810, 31798, 31786, 31774, 31761, 31749,
+    31737, 31724, 31711, 31699, 31686, 31673, 31660, 31647, 31634, 31621, 31608, 31594, 31581, 31568, 31554, 31540,
+    31527, 31513, 31499, 31485, 31471, 31457, 31443, 31429, 31415, 31400, 31386, 31372, 31357, 31342, 31328, 31313,
+    31298, 31283, 31268, 31253, 31238, 31223, 31207, 31192, 31177, 31161, 31146, 31130, 31114, 31098, 31082, 31067,
+    31050, 31034, 31018, 31002, 30986, 30969, 30953, 30936, 30920, 30903, 30886, 30869, 30853, 30836, 30819, 30801,
+    30784, 30767, 30750, 30732, 30715, 30697, 30680, 30662, 30644, 30626, 30608, 30590, 30572, 30554, 30536, 30518,
+    30499, 30481, 30462, 30444, 30425, 30407, 30388, 30369, 30350, 30331, 30312, 30293, 30274, 30254, 30235, 30216,
+    30196, 30177, 30157, 30137, 30118, 30098, 30078, 30058, 30038, 30018, 29997, 29977, 29957, 29936, 29916, 29895,
+    29875, 29854, 29833, 29813, 29792, 29771, 29750, 29729, 29707, 29686, 29665, 29643, 29622, 29600, 29579, 29557,
+    29535, 29514, 29492, 29470, 29448, 29426, 29404, 29381, 29359, 29337, 29314, 29292, 29269, 29247, 29224, 29201,
+    29178, 29155, 29132, 29109, 29086, 29063, 29040, 29016, 28993, 28970, 28946, 28922, 28899, 28875, 28851, 28827,
+    28803, 28779, 28755, 28731, 28707, 28683, 28658, 28634, 28610, 28585, 28560, 28536, 28511, 28486, 28461, 28436,
+    28411, 28386, 28361, 28336, 28311, 28285, 28260, 28234, 28209, 28183, 28158, 28132, 28106, 28080, 28054, 28028,
+    28002, 27976, 27950, 27924, 27897, 27871, 27844, 27818, 27791, 27765, 27738, 27711, 27684, 27657, 27630, 27603,
+    27576, 27549, 27522, 27494, 27467, 27440, 27412, 27384, 27357, 27329, 27301, 27273, 27246, 27218, 27190, 27162,
+    27133, 27105, 27077, 27049, 27020, 26992, 26963, 26935, 26906, 26877, 26848, 26820, 26791, 26762, 26733, 26704,
+    26674, 26645, 26616, 26586, 26557, 26528, 26498, 26468, 26439, 26409, 26379, 26349, 26320, 26290, 26259, 26229,
+    26199, 26169, 26139, 26108, 26078, 26048, 26017, 25986, 25956, 25925, 25894, 25863, 25833, 25802, 25771, 25739,
+    25708, 25677, 25646, 25615, 25583, 25552, 25520, 25489, 25457, 25425, 25394, 25362, 25330, 25298, 25266, 25234,
+    25202, 25170, 25138, 25105, 25073, 25041, 25008, 24976, 24943, 24910, 24878, 24845, 24812, 24779, 24746, 24713,
+    24680, 24647, 24614, 24581, 24548, 24514, 24481, 24448, 24414, 24380, 24347, 24313, 24279, 24246, 24212, 24178,
+    24144, 24110, 24076, 24042, 24008, 23973, 23939, 23905, 23870, 23836, 23801, 23767, 23732, 23697, 23663, 23628,
+    23593, 23558, 23523, 23488, 23453, 23418, 23383, 23348, 23312, 23277, 23241, 23206, 23170, 23135, 23099, 23064,
+    23028, 22992, 22956, 22920, 22884, 22848, 22812, 22776, 22740, 22704, 22668, 22631, 22595, 22558, 22522, 22485,
+    22449, 22412, 22375, 22339, 22302, 22265, 22228, 22191, 22154, 22117, 22080, 22043, 22006, 21968, 21931, 21894,
+    21856, 21819, 21781, 21744, 21706, 21668, 21631, 21593, 21555, 21517, 21479, 21441, 21403, 21365, 21327, 21289,
+    21251, 21212, 21174, 21136, 21097, 21059, 21020, 20981, 20943, 20904, 20865, 20827, 20788, 20749, 20710, 20671,
+    20632, 20593, 20554, 20515, 20475, 20436, 20397, 20357, 20318, 20279, 20239, 20200, 20160, 20120, 20081, 20041,
+    20001, 19961, 19921, 19881, 19841, 19801, 19761, 19721, 19681, 19641, 19601, 19560, 19520, 19479, 19439, 19399,
+    19358, 19317, 19277, 19236, 19195, 19155, 19114, 19073, 19032, 18991, 18950, 18909, 18868, 18827, 18786, 18745,
+    18703, 18662, 18621, 18579, 18538, 18496, 18455, 18413, 18372, 18330, 18288, 18247, 18205, 18163, 18121, 18079,
+    18037, 17995, 17953, 17911, 17869, 17827, 17785, 17743, 17700, 17658, 17616, 17573, 17531, 17488, 17446, 17403,
+    17361, 17318, 17275, 17233, 17190, 17147, 17104, 17061, 17018, 16975, 16932, 16889, 16846, 16803, 16760, 16717,
+    16673, 16630, 16587, 16543, 16500, 16456, 16413, 16369, 16326, 16282, 16239, 16195, 16151, 16108, 16064, 16020,
+    15976, 15932, 15888, 15844, 15800, 15756, 15712, 15668, 15624, 15580, 15535, 15491, 15447, 15402, 15358, 15314,
+    15269, 15225, 15180, 15136, 15091, 15046, 15002, 14957, 14912, 14867, 14823, 14778, 14733, 14688, 14643, 14598,
+    14553, 14508, 14463, 14418, 14373, 14327, 14282, 14237, 14192, 14146, 14101, 14056, 14010, 13965, 13919, 13874,
+    13828, 13783, 13737, 13691, 13646, 13600, 13554, 13508, 13463, 13417, 13371, 13325, 13279, 13233, 13187, 13141,
+    13095, 13049, 13003, 12957, 12910, 12864, 12818, 12772, 12725, 12679, 12633, 12586, 12540, 12493, 12447, 12400,
+    12354, 12307, 12261, 12214, 12167, 12121, 12074, 12027, 11980, 11934, 11887, 11840, 11793, 11746, 11699, 11652,
+    11605, 11558, 11511, 11464, 11417, 11370, 11323, 11276, 11228, 11181, 11134, 11087, 11039, 10992, 10945, 10897,
+    10850, 10802, 10755, 10707, 10660, 10612, 10565, 10517, 10469, 10422, 10374, 10326, 10279, 10231, 10183, 10135,
+    10088, 10040, 9992, 9944, 9896, 9848, 9800, 9752, 9704, 9656, 9608, 9560, 9512, 9464, 9416, 9368, 9319, 9271, 9223,
+    9175, 9127, 9078, 9030, 8982, 8933, 8885, 8836, 8788, 8740, 8691, 8643, 8594, 8546, 8497, 8449, 8400, 8351, 8303,
+    8254, 8206, 8157, 8108, 8059, 8011, 7962, 7913, 7864, 7816, 7767, 7718, 7669, 7620, 7571, 7522, 7473, 7425, 7376,
+    7327, 7278, 7229, 7180, 7130, 7081, 7032, 6983, 6934, 6885, 6836, 6787, 6737, 6688, 6639, 6590, 6541, 6491, 6442,
+    6393, 6343, 6294, 6245, 6195, 6146, 6097, 6047, 5998, 5948, 5899, 5850, 5800, 5751, 5701, 5652, 5602, 5553, 5503,
+    5453, 5404, 5354, 5305, 5255, 5205, 5156, 5106, 5057, 5007, 4957, 4907, 4858, 4808, 4758, 4709, 4659, 4609, 4559,
+    4510, 4460, 4410, 4360, 4310, 4260, 4211, 4161, 4111, 4061, 4011, 3961, 3911, 3861, 3812, 3762, 3712, 3662, 3612,
+    3562, 3512, 3462, 3412, 3362, 3312, 3262, 3212, 3162, 3112, 3062, 3012, 2962, 2912, 2861, 2811, 2761, 2711, 2661,
+    2611, 2561, 2511, 2461, 2411, 2360, 2310, 2260, 2210, 2160, 2110, 2060, 2009, 1959, 1909, 1859, 1809, 1758, 1708,
+    1658, 1608, 1558, 1507, 1457, 1407, 1357, 1307, 1256, 1206, 1156, 1106, 1055, 1005, 955, 905, 854, 804, 754, 704,
+    653, 603, 553, 503, 452, 402, 352, 302, 251, 201, 151, 101, 50, 0, -50, -101, -151, -201, -251, -302, -352, -402,
+    -452, -503, -553, -603, -653, -704, -754, -804, -854, -905, -955, -1005, -1055, -1106, -1156, -1206, -1256, -1307,
+    -1357, -1407, -1457, -1507, -1558, -1608, -1658, -1708, -1758, -1809, -1859, -1909, -1959, -2009, -2060, -2110,
+    -2160, -2210, -2260, -2310, -2360, -2411, -2461, -2511, -2561, -2611, -2661, -2711, -2761, -2811, -2861, -2912,
+    -2962, -3012, -3062, -3112, -3162, -3212, -3262, -3312, -3362, -3412, -3462, -3512, -3562, -3612, -3662, -3712,
+    -3762, -3812, -3861, -3911, -3961, -4011, -4061, -4111, -4161, -4211, -4260, -4310, -4360, -4410, -4460, -4510,
+    -4559, -4609, -4659, -4709, -4758, -4808, -4858, -4907, -4957, -5007, -5057, -5106, -5156, -5205, -5255, -5305,
+    -5354, -5404, -5453, -5503, -5553, -5602, -5652, -5701, -5751, -5800, -5850, -5899, -5948, -5998, -6047, -6097,
+    -6146, -6195, -6245, -6294, -6343, -6393, -6442, -6491, -6541, -6590, -6639, -6688, -6737, -6787, -6836, -6885,
+    -6934, -6983, -7032, -7081, -7130, -7180, -7229, -7278, -7327, -7376, -7425, -7473, -7522, -7571, -7620, -7669,
+    -7718, -7767, -7816, -7864, -7913, -7962, -8011, -8059, -8108, -8157, -8206, -8254, -8303, -8351, -8400, -8449,
+    -8497, -8546, -8594, -8643, -8691, -8740, -8788, -8836, -8885, -8933, -8982, -9030, -9078, -9127, -9175, -9223,
+    -9271, -9319, -9368, -9416, -9464, -9512, -9560, -9608, -9656, -9704, -9752, -9800, -9848, -9896, -9944, -9992,
+    -10040, -10088, -10135, -10183, -10231, -10279, -10326, -10374, -10422, -10469, -10517, -10565, -10612, -10660,
+    -10707, -10755, -10802, -10850, -10897, -10945, -10992, -11039, -11087, -11134, -11181, -11228, -11276, -11323,
+    -11370, -11417, -11464, -11511, -11558, -11605, -11652, -11699, -11746, -11793, -11840, -11887, -11934, -11980,
+    -12027, -12074, -12121, -12167, -12214, -12261, -12307, -12354, -12400, -12447, -12493, -12540, -12586, -12633,
+    -12679, -12725, -12772, -12818, -12864, -12910, -12957, -13003, -13049, -13095, -13141, -13187, -13233, -13279,
+    -13325, -13371, -13417, -13463, -13508, -13554, -13600, -13646, -13691, -13737, -13783, -13828, -13874, -13919,
+    -13965, -14010, -14056, -14101, -14146, -14192, -14237, -14282, -14327, -14373, -14418, -14463, -14508, -14553,
+    -14598, -14643, -14688, -14733, -14778, -14823, -14867, -14912, -14957, -15002, -15046, -15091, -15136, -15180,
+    -15225, -15269, -15314, -15358, -15402, -15447, -15491, -15535, -15580, -15624, -15668, -15712, -15756, -15800,
+    -15844, -15888, -15932, -15976, -16020, -16064, -16108, -16151, -16195, -16239, -16282, -16326, -16369, -16413,
+    -16456, -16500, -16543, -16587, -16630, -16673, -16717, -16760, -16803, -16846, -16889, -16932, -16975, -17018,
+    -17061, -17104, -17147, -17190, -17233, -17275, -17318, -17361, -17403, -17446, -17488, -17531, -17573, -17616,
+    -17658, -17700, -17743, -17785, -17827, -17869, -17911, -17953, -17995, -18037, -18079, -18121, -18163, -18205,
+    -18247, -18288, -18330, -18372, -18413, -18455, -18496, -18538, -18579, -18621, -18662, -18703, -18745, -18786,
+    -18827, -18868, -18909, -18950, -18991, -19032, -19073, -19114, -19155, -19195, -19236, -19277, -19317, -19358,
+    -19399, -19439, -19479, -19520, -19560, -19601, -19641, -19681, -19721, -19761, -19801, -19841, -19881, -19921,
+    -19961, -20001, -20041, -20081, -20120, -20160, -20200, -20239, -20279, -20318, -20357, -20397, -20436, -20475,
+    -20515, -20554, -20593, -20632, -20671, -20710, -20749, -20788, -20827, -20865, -20904, -20943, -20981, -21020,
+    -21059, -21097, -21136, -21174, -21212, -21251, -21289, -21327, -21365, -21403, -21441, -21479, -21517, -21555,
+    -21593, -21631, -21668, -21706, -21744, -21781, -21819, -21856, -21894, -21931, -21968, -22006, -22043, -22080,
+    -22117, -22154, -22191, -22228, -22265, -22302, -22339, -22375, -22412, -22449, -22485, -22522, -22558, -22595,
+    -22631, -22668, -22704, -22740, -22776, -22812, -22848, -22884, -22920, -22956, -22992, -23028, -23064, -23099,
+    -23135, -23170, -23206, -23241, -23277, -23312, -23348, -23383, -23418, -23453, -23488, -23523, -23558, -23593,
+    -23628, -23663, -23697, -23732, -23767, -23801, -23836, -23870, -23905, -23939, -23973, -24008, -24042, -24076,
+    -24110, -24144, -24178, -24212, -24246, -24279, -24313, -24347, -24380, -24414, -24448, -24481, -24514, -24548,
+    -24581, -24614, -24647, -24680, -24713, -24746, -24779, -24812, -24845, -24878, -24910, -24943, -24976, -25008,
+    -25041, -25073, -25105, -25138, -25170, -25202, -25234, -25266, -25298, -25330, -25362, -25394, -25425, -25457,
+    -25489, -25520, -25552, -25583, -25615, -25646, -25677, -25708, -25739, -25771, -25802, -25833, -25863, -25894,
+    -25925, -25956, -25986, -26017, -26048, -26078, -26108, -26139, -26169, -26199, -26229, -26259, -26290, -26320,
+    -26349, -26379, -26409, -26439, -26468, -26498, -26528, -26557, -26586, -26616, -26645, -26674, -26704, -26733,
+    -26762, -26791, -26820, -26848, -26877, -26906, -26935, -26963, -26992, -27020, -27049, -27077, -27105, -27133,
+    -27162, -27190, -27218, -27246, -27273, -27301, -27329, -27357, -27384, -27412, -27440, -27467, -27494, -27522,
+    -27549, -27576, -27603, -27630, -27657, -27684, -27711, -27738, -27765, -27791, -27818, -27844, -27871, -27897,
+    -27924, -27950, -27976, -28002, -28028, -28054, -28080, -28106, -28132, -28158, -28183, -28209, -28234, -28260,
+    -28285, -28311, -28336, -28361, -28386, -28411, -28436, -28461, -28486, -28511, -28536, -28560, -28585, -28610,
+    -28634, -28658, -28683, -28707, -28731, -28755, -28779, -28803, -28827, -28851, -28875, -28899, -28922, -28946,
+    -28970, -28993, -29016, -29040, -29063, -29086, -29109, -29132, -29155, -29178, -29201, -29224, -29247, -29269,
+    -29292, -29314, -29337, -29359, -29381, -29404, -29426, -29448, -29470, -29492, -29514, -29535, -29557, -29579,
+    -29600, -29622, -29643, -29665, -29686, -29707, -29729, -29750, -29771, -29792, -29813, -29833, -29854, -29875,
+    -29895, -29916, -29936, -29957, -29977, -29997, -30018, -30038, -30058, -30078, -30098, -30118, -30137, -30157,
+    -30177, -30196, -30216, -30235, -30254, -30274, -30293, -30312, -30331, -30350, -30369, -30388, -30407, -30425,
+    -30444, -30462, -30481, -30499, -30518, -30536, -30554, -30572, -30590, -30608, -30626, -30644, -30662, -30680,
+    -30697, -30715, -30732, -30750, -30767, -30784, -30801, -30819, -30836, -30853, -30869, -30886, -30903, -30920,
+    -30936, -30953, -30969, -30986, -31002, -31018, -31034, -31050, -31067, -31082, -31098, -31114, -31130, -31146,
+    -31161, -31177, -31192, -31207, -31223, -31238, -31253, -31268, -31283, -31298, -31313, -31328, -31342, -31357,
+    -31372, -31386, -31400, -31415, -31429, -31443, -31457, -31471, -31485, -31499, -31513, -31527, -31540, -31554,
+    -31568, -31581, -31594, -31608, -31621, -31634, -31647, -31660, -31673, -31686, -31699, -31711, -31724, -31737,
+    -31749, -31761, -31774, -31786, -31798, -31810, -31822, -31834, -31846, -31858, -31870, -31881, -31893, -31904,
+    -31916, -31927, -31938, -31950, -31961, -31972, -31983, -31994, -32005, -32015, -32026, -32037, -32047, -32058,
+    -32068, -32078, -32088, -32099, -32109, -32119, -32129, -32138, -32148, -32158, -32167, -32177, -32186, -32196,
+    -32205, -32214, -32224, -32233, -32242, -32251, -32259, -32268, -32277, -32286, -32294, -32303, -32311, -32319,
+    -32328, -32336, -32344, -32352, -32360, -32368, -32376, -32383, -32391, -32398, -32406, -32413, -32421, -32428,
+    -32435, -32442, -32449, -32456, -32463, -32470, -32477, -32483, -32490, -32496, -32503, -32509, -32515, -32522,
+    -32528, -32534, -32540, -32546, -32551, -32557, -32563, -32568, -32574, -32579, -32585, -32590, -32595, -32600,
+    -32605, -32610, -32615, -32620, -32625, -32629, -32634, -32638, -32643, -32647, -32651, -32656, -32660, -32664,
+    -32668, -32672, -32675, -32679, -32683, -32686, -32690, -32693, -32697, -32700, -32703, -32706, -32709, -32712,
+    -32715, -32718, -32721, -32723, -32726, -32729, -32731, -32733, -32736, -32738, -32740, -32742, -32744, -32746,
+    -32748, -32749, -32751, -32753, -32754, -32756, -32757, -32758, -32759, -32760, -32761, -32762, -32763, -32764,
+    -32765, -32766, -32766, -32767, -32767, -32767, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32767,
+    -32767, -32767, -32766, -32766, -32765, -32764, -32763, -32762, -32761, -32760, -32759, -32758, -32757, -32756,
+    -32754, -32753, -32751, -32749, -32748, -32746, -32744, -32742, -32740, -32738, -32736, -32733, -32731, -32729,
+    -32726, -32723, -32721, -32718, -32715, -32712, -32709, -32706, -32703, -32700, -32697, -32693, -32690, -32686,
+    -32683, -32679, -32675, -32672, -32668, -32664, -32660, -32656, -32651, -32647, -32643, -32638, -32634, -32629,
+    -32625, -32620, -32615, -32610, -32605, -32600, -32595, -32590, -32585, -32579, -32574, -32568, -32563, -32557,
+    -32551, -32546, -32540, -32534, -32528, -32522, -32515, -32509, -32503, -32496, -32490, -32483, -32477, -32470,
+    -32463, -32456, -32449, -32442, -32435, -32428, -32421, -32413, -32406, -32398, -32391, -32383, -32376, -32368,
+    -32360, -32352, -32344, -32336, -32328, -32319, -32311, -32303, -32294, -32286, -32277, -32268, -32259, -32251,
+    -32242, -32233, -32224, -32214, -32205, -32196, -32186, -32177, -32167, -32158, -32148, -32138, -32129, -32119,
+    -32109, -32099, -32088, -32078, -32068, -32058, -32047, -32037, -32026, -32015, -32005, -31994, -31983, -31972,
+    -31961, -31950, -31938, -31927, -31916, -31904, -31893, -31881, -31870, -31858, -31846, -31834, -31822, -31810,
+    -31798, -31786, -31774, -31761, -31749, -31737, -31724, -31711, -31699, -31686, -31673, -31660, -31647, -31634,
+    -31621, -31608, -31594, -31581, -31568, -31554, -31540, -31527, -31513, -31499, -31485, -31471, -31457, -31443,
+    -31429, -31415, -31400, -31386, -31372, -31357, -31342, -31328, -31313, -31298, -31283, -31268, -31253, -31238,
+    -31223, -31207, -31192, -31177, -31161, -31146, -31130, -31114, -31098, -31082, -31067, -31050, -31034, -31018,
+    -31002, -30986, -30969, -30953, -30936, -30920, -30903, -30886, -30869, -30853, -30836, -30819, -30801, -30784,
+    -30767, -30750, -30732, -30715, -30697, -30680, -30662, -30644, -30626, -30608, -30590, -30572, -30554, -30536,
+    -30518, -30499, -30481, -30462, -30444, -30425, -30407, -30388, -30369, -30350, -30331, -30312, -30293, -30274,
+    -30254, -30235, -30216, -30196, -30177, -30157, -30137, -30118, -30098, -30078, -30058, -30038, -30018, -29997,
+    -29977, -29957, -29936, -29916, -29895, -29875, -29854, -29833, -29813, -29792, -29771, -29750, -29729, -29707,
+    -29686, -29665, -29643, -29622, -29600, -29579, -29557, -29535, -29514, -29492, -29470, -29448, -29426, -29404,
+    -29381, -29359, -29337, -29314, -29292, -29269, -29247, -29224, -29201, -29178, -29155, -29132, -29109, -29086,
+    -29063, -29040, -29016, -28993, -28970, -28946, -28922, -28899, -28875, -28851, -28827, -28803, -28779, -28755,
+    -28731, -28707, -28683, -28658, -28634, -28610, -28585, -28560, -28536, -28511, -28486, -28461, -28436, -28411,
+    -28386, -28361, -28336, -28311, -28285, -28260, -28234, -28209, -28183, -28158, -28132, -28106, -28080, -28054,
+    -28028, -28002, -27976, -27950, -27924, -27897, -27871, -27844, -27818, -27791, -27765, -27738, -27711, -27684,
+    -27657, -27630, -27603, -27576, -27549, -27522, -27494, -27467, -27440, -27412, -27384, -27357, -27329, -27301,
+    -27273, -27246, -27218, -27190, -27162, -27133, -27105, -27077, -27049, -27020, -26992, -26963, -26935, -26906,
+    -26877, -26848, -26820, -26791, -26762, -26733, -26704, -26674, -26645, -26616, -26586, -26557, -26528, -26498,
+    -26468, -26439, -26409, -26379, -26349, -26320, -26290, -26259, -26229, -26199, -26169, -26139, -26108, -26078,
+    -26048, -26017, -25986, -25956, -25925, -25894, -25863, -25833, -25802, -25771, -25739, -25708, -25677, -25646,
+    -25615, -25583, -25552, -25520, -25489, -25457, -25425, -25394, -25362, -25330, -25298, -25266, -25234, -25202,
+    -25170, -25138, -25105, -25073, -25041, -25008, -24976, -24943, -24910, -24878, -24845, -24812, -24779, -24746,
+    -24713, -24680, -24647, -24614, -24581, -24548, -24514, -24481, -24448, -24414, -24380, -24347, -24313, -24279,
+    -24246, -24212, -24178, -24144, -24110, -24076, -24042, -24008, -23973, -23939, -23905, -23870, -23836, -23801,
+    -23767, -23732, -23697, -23663, -23628, -23593, -23558, -23523, -23488, -23453, -23418, -23383, -23348, -23312,
+    -23277, -23241, -23206, -23170, -23135, -23099, -23064, -23028, -22992, -22956, -22920, -22884, -22848, -22812,
+    -22776, -22740, -22704, -22668, -22631, -22595, -22558, -22522, -22485, -22449, -22412, -22375, -22339, -22302,
+    -22265, -22228, -22191, -22154, -22117, -22080, -22043, -22006, -21968, -21931, -21894, -21856, -21819, -21781,
+    -21744, -21706, -21668, -21631, -21593, -21555, -21517, -21479, -21441, -21403, -21365, -21327, -21289, -21251,
+    -21212, -21174, -21136, -21097, -21059, -21020, -20981, -20943, -20904, -20865, -20827, -20788, -20749, -20710,
+    -20671, -20632, -20593, -20554, -20515, -20475, -20436, -20397, -20357, -20318, -20279, -20239, -20200, -20160,
+    -20120, -20081, -20041, -20001, -19961, -19921, -19881, -19841, -19801, -19761, -19721, -19681, -19641, -19601,
+    -19560, -19520, -19479, -19439, -19399, -19358, -19317, -19277, -19236, -19195, -19155, -19114, -19073, -19032,
+    -18991, -18950, -18909, -18868, -18827, -18786, -18745, -18703, -18662, -18621, -18579, -18538, -18496, -18455,
+    -18413, -18372, -18330, -18288, -18247, -18205, -18163, -18121, -18079, -18037, -17995, -17953, -17911, -17869,
+    -17827, -17785, -17743, -17700, -17658, -17616, -17573, -17531, -17488, -17446, -17403, -17361, -17318, -17275,
+    -17233, -17190, -17147, -17104, -17061, -17018, -16975, -16932, -16889, -16846, -16803, -16760, -16717, -16673,
+    -16630, -16587, -16543, -16500, -16456, -16413, -16369, -16326, -16282, -16239, -16195, -16151, -16108, -16064,
+    -16020, -15976, -15932, -15888, -15844, -15800, -15756, -15712, -15668, -15624, -15580, -15535, -15491, -15447,
+    -15402, -15358, -15314, -15269, -15225, -15180, -15136, -15091, -15046, -15002, -14957, -14912, -14867, -14823,
+    -14778, -14733, -14688, -14643, -14598, -14553, -14508, -14463, -14418, -14373, -14327, -14282, -14237, -14192,
+    -14146, -14101, -14056, -14010, -13965, -13919, -13874, -13828, -13783, -13737, -13691, -13646, -13600, -13554,
+    -13508, -13463, -13417, -13371, -13325, -13279, -13233, -13187, -13141, -13095, -13049, -13003, -12957, -12910,
+    -12864, -12818, -12772, -12725, -12679, -12633, -12586, -12540, -12493, -12447, -12400, -12354, -12307, -12261,
+    -12214, -12167, -12121, -12074, -12027, -11980, -11934, -11887, -11840, -11793, -11746, -11699, -11652, -11605,
+    -11558, -11511, -11464, -11417, -11370, -11323, -11276, -11228, -11181, -11134, -11087, -11039, -10992, -10945,
+    -10897, -10850, -10802, -10755, -10707, -10660, -10612, -10565, -10517, -10469, -10422, -10374, -10326, -10279,
+    -10231, -10183, -10135, -10088, -10040, -9992, -9944, -9896, -9848, -9800, -9752, -9704, -9656, -9608, -9560, -9512,
+    -9464, -9416, -9368, -9319, -9271, -9223, -9175, -9127, -9078, -9030, -8982, -8933, -8885, -8836, -8788, -8740,
+    -8691, -8643, -8594, -8546, -8497, -8449, -8400, -8351, -8303, -8254, -8206, -8157, -8108, -8059, -8011, -7962,
+    -7913, -7864, -7816, -7767, -7718, -7669, -7620, -7571, -7522, -7473, -7425, -7376, -7327, -7278, -7229, -7180,
+    -7130, -7081, -7032, -6983, -6934, -6885, -6836, -6787, -6737, -6688, -6639, -6590, -6541, -6491, -6442, -6393,
+    -6343, -6294, -6245, -6195, -6146, -6097, -6047, -5998, -5948, -5899, -5850, -5800, -5751, -5701, -5652, -5602,
+    -5553, -5503, -5453, -5404, -5354, -5305, -5255, -5205, -5156, -5106, -5057, -5007, -4957, -4907, -4858, -4808,
+    -4758, -4709, -4659, -4609, -4559, -4510, -4460, -4410, -4360, -4310, -4260, -4211, -4161, -4111, -4061, -4011,
+    -3961, -3911, -3861, -3812, -3762, -3712, -3662, -3612, -3562, -3512, -3462, -3412, -3362, -3312, -3262, -3212,
+    -3162, -3112, -3062, -3012, -2962, -2912, -2861, -2811, -2761, -2711, -2661, -2611, -2561, -2511, -2461, -2411,
+    -2360, -2310, -2260, -2210, -2160, -2110, -2060, -2009, -1959, -1909, -1859, -1809, -1758, -1708, -1658, -1608,
+    -1558, -1507, -1457, -1407, -1357, -1307, -1256, -1206, -1156, -1106, -1055, -1005, -955, -905, -854, -804, -754,
+    -704, -653, -603, -553, -503, -452, -402, -352, -302, -251, -201, -151, -101, -50, 0
 };
 
 #endif
+
+#endif /* IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED */
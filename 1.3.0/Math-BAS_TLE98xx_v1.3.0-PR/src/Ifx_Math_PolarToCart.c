@@ -10,20 +10,22 @@
 
 #include "Ifx_Math_PolarToCart.h"
 #include "Ifx_Math_Mul.h"
-#include "Ifx_Math_Sin.h"
-#include "Ifx_Math_Cos.h"
+#include "Ifx_Math_SinCos.h"
 
 /* \brief Calculates the 16-bit polar to cartesian transformation. */
 Ifx_Math_CmpFract16 Ifx_Math_PolarToCart_F16(Ifx_Math_PolarFract16 polar)
 {
     /* Variable declaration of the result = real +j*imag */
-    Ifx_Math_CmpFract16 result;
+    Ifx_Math_CmpFract16  result;
+
+    /* sin(theta) and cos(theta) from one table index */
+    Ifx_Math_SinCos_Type sinCosTheta = Ifx_Math_SinCos_F16(polar.angle);
 
     /* real = Amp*cos(theta) */
-    result.real = Ifx_Math_Mul_F16(polar.amplitude, Ifx_Math_Cos_F16(polar.angle));
+    result.real = Ifx_Math_Mul_F16(polar.amplitude, sinCosTheta.cos);
 
     /* imag = Amp*sin(theta) */
-    result.imag = Ifx_Math_Mul_F16(polar.amplitude, Ifx_Math_Sin_F16(polar.angle));
+    result.imag = Ifx_Math_Mul_F16(polar.amplitude, sinCosTheta.sin);
 
     return result;
 }
@@ -20,6 +20,14 @@
 #include "probe_scope.h"
 
 #include "no_opt.h"
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+#include "isr_defines.h"
+
+/* The captures of the DMA are only re-armed by the DMA channel 5 interrupt */
+#if (DMA_CH2_INT_EN != 1)
+#error "IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA requires DMA_CH2_INT_EN == 1 with DMA_CH2_CALLBACK Ifx_FOC_dmaCh5Callback"
+#endif
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
 
 /* User input speed which can be set in rpm and currents in dq frame which can be set when direct interface is enabled
  * */
@@ -58,14 +66,45 @@ NO_OPT volatile uint16              rotorAlignCounter = 0;
 /* Duration rotor alignment (steps) = alignment(s) * speed loop freq (Hz) */
 #define ROTORALIGNMENT_TIME_STEPS (666)
 
-#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1)
+#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1) || (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1)
 
 /* Counter for the current control loop execution */
 NO_OPT volatile sint8 currentControlCounter = 0;
 
 #endif
 
-#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1)
+#if (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1)
+
+/* SysTick value and timestamp of the previous call of usrProfilerTimestamp() */
+NO_OPT volatile uint32 profilerSysTickPrevious = 0;
+NO_OPT volatile uint32 profilerTimestamp       = 0;
+
+/* Execution time profiler timestamp in CPU cycles. SysTick is already running for WDT1 as a down counter with a
+ * period of 1 ms, so the cycles since the previous call are accumulated to an up counting timestamp. Durations inside
+ * one fast loop are exact as long as the fast loop is shorter than one SysTick period. */
+uint32 usrProfilerTimestamp(void)
+{
+    uint32 sysTick = SysTick_Value_Get();
+
+    if (sysTick <= profilerSysTickPrevious)
+    {
+        profilerTimestamp += profilerSysTickPrevious - sysTick;
+    }
+    else
+    {
+        /* SysTick was reloaded since the previous call */
+        profilerTimestamp += (profilerSysTickPrevious + SysTick_ReloadValue_Get() + 1u) - sysTick;
+    }
+
+    profilerSysTickPrevious = sysTick;
+
+    return profilerTimestamp;
+}
+
+
+#endif
+
+#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1) || (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1)
 
 /* Fast loop execution call back, PendSV_Handler software interrupt defined in start up file */
 void PendSV_Handler(void)
@@ -80,17 +119,19 @@ void PendSV_Handler(void)
 void Ifx_FOC_oneMatchCallback(void)
 {
     Ifx_MHA_PatternGen_TLE987_onOneMatch(&(FocDemoClosedLoop.patternGenTLE987));
-#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1)
+#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1) || (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1)
 
     /* Execute current control only in the defined cycles */
-    if (currentControlCounter < (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR - 1))
+    if (currentControlCounter < ((sint8)Ifx_MS_FocSolutionF16_getCurrentLoopFactor(&FocDemoClosedLoop) - 1))
     {
         /* Increment counter */
         currentControlCounter++;
     }
     else
     {
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
         Ifx_MHA_MeasurementADC_TLE987_oneMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
 
         /* Reset Pattern Generator cycle counter */
         Ifx_MHA_PatternGen_TLE987_reset(&(FocDemoClosedLoop.patternGenTLE987));
@@ -101,7 +142,9 @@ void Ifx_FOC_oneMatchCallback(void)
     }
 
 #else
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
     Ifx_MHA_MeasurementADC_TLE987_oneMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
     Ifx_MS_FocSolutionF16_executeControlMode(&FocDemoClosedLoop);
 #endif
 }
@@ -110,11 +153,24 @@ void Ifx_FOC_oneMatchCallback(void)
 /* CCU6 period match callback */
 void Ifx_FOC_periodMatchCallback(void)
 {
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
     Ifx_MHA_MeasurementADC_TLE987_periodMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
     Ifx_MHA_PatternGen_TLE987_onPeriodMatch(&(FocDemoClosedLoop.patternGenTLE987));
 }
 
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/* DMA channel 5 callback (DMA_CH2_CALLBACK), current measurements of a PWM period captured */
+void Ifx_FOC_dmaCh5Callback(void)
+{
+    Ifx_MHA_MeasurementADC_TLE987_dmaDone(&(FocDemoClosedLoop.measurementADCTLE987));
+}
+
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
 /* Slow loop execution call back which is called by timer GPT2.T6 */
 NO_OPT void Ifx_FOC_speedLoop_callback(void)
 {
@@ -177,7 +233,7 @@ int main(void)
 
     /* Start speed loop timer */
     GPT12E_T6_Start();
-#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1)
+#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1) || (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1)
 
     /* Set PendSV interrupt priority */
     NVIC_SetPriority(PendSV_IRQn, 2);
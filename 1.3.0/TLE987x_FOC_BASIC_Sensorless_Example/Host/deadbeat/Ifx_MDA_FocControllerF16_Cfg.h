@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MDA_FocControllerF16_Cfg.h
+ * \brief Configuration overlay of the host build with the deadbeat current controller of the FOC controller
+ * (foc_stack_deadbeat): takes the configuration of the delay compensation overlay, which comes next in the include
+ * path, and enables IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE.
+ */
+
+#ifndef HOST_DEADBEAT_IFX_MDA_FOCCONTROLLERF16_CFG_H
+#define HOST_DEADBEAT_IFX_MDA_FOCCONTROLLERF16_CFG_H
+
+#include_next "Ifx_MDA_FocControllerF16_Cfg.h"
+
+#undef IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE
+#define IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE (0x1) /*decimal 1*/
+
+#endif /* HOST_DEADBEAT_IFX_MDA_FOCCONTROLLERF16_CFG_H */
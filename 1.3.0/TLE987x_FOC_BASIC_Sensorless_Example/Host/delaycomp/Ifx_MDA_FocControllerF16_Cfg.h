@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MDA_FocControllerF16_Cfg.h
+ * \brief Configuration overlay of the host build with the delay compensation of the FOC controller
+ * (foc_stack_delaycomp): takes the project configuration and enables
+ * IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE.
+ */
+
+#ifndef HOST_DELAYCOMP_IFX_MDA_FOCCONTROLLERF16_CFG_H
+#define HOST_DELAYCOMP_IFX_MDA_FOCCONTROLLERF16_CFG_H
+
+#include_next "Ifx_MDA_FocControllerF16_Cfg.h"
+
+#undef IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE
+#define IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE (0x1) /*decimal 1*/
+
+#endif /* HOST_DELAYCOMP_IFX_MDA_FOCCONTROLLERF16_CFG_H */
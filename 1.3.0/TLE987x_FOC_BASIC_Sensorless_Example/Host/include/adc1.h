@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file adc1.h
+ * \brief Host stand-in for the ADC1 SDK driver, backed by the simulated register image in host_sfr.h.
+ */
+
+#ifndef ADC1_H
+#define ADC1_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Software mode */
+#define SW_MODE  0u
+
+/** \brief Sequencer mode */
+#define SEQ_MODE 1u
+
+/** \brief ADC1 channel 1 (CSA) */
+#define ADC1_CH1 1u
+#define ADC1_CSA ADC1_CH1
+
+/** \brief Simulated ADC1 register block */
+#define ADC1     (&HostSfr.adc1)
+
+/** \brief Reads the EIM result register */
+INLINE uint16 ADC1_EIM_Result_Get(void)
+{
+    return (uint16)HostSfr.adc1.RES_OUT_EIM.reg;
+}
+
+
+/** \brief Reads the channel 1 (CSA) result register */
+INLINE uint16 ADC1_CSA_Result_Get(void)
+{
+    return (uint16)HostSfr.adc1.RES_OUT1.reg;
+}
+
+
+/** \brief Reads the channel 6 (VDH) result register */
+INLINE uint16 ADC1_VDH_Result_Get(void)
+{
+    return (uint16)HostSfr.adc1.RES_OUT6.reg;
+}
+
+
+/** \brief Selects software or sequencer mode */
+INLINE void ADC1_SetMode(uint8 mode)
+{
+    HostSfr.adc1Mode = mode;
+}
+
+
+/** \brief Selects the channel for software mode conversions and starts a conversion */
+INLINE void ADC1_SetSocSwMode(uint8 Ch)
+{
+    HostSfr.adc1SocSwChannel = Ch;
+    HostSfr.adc1SocCount++;
+}
+
+
+/** \brief Starts a software mode conversion */
+INLINE void ADC1_SOC_Set(void)
+{
+    HostSfr.adc1SocCount++;
+}
+
+
+#endif /* ADC1_H */
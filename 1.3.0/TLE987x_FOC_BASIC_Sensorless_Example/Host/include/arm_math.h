@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file arm_math.h
+ * \brief Host stand-in for the subset of CMSIS-DSP used by the math library.
+ */
+
+#ifndef ARM_MATH_H
+#define ARM_MATH_H
+
+#include <stdint.h>
+#include "cmsis_compiler.h"
+
+/** \brief 31-bit fractional data type */
+typedef int32_t q31_t;
+
+/** \brief 63-bit fractional data type */
+typedef int64_t q63_t;
+
+/** \brief Clips a q63 value to the q31 range */
+__STATIC_FORCEINLINE q31_t clip_q63_to_q31(q63_t x)
+{
+    return ((q31_t)(x >> 32) != ((q31_t)x >> 31)) ? ((0x7FFFFFFF ^ ((q31_t)(x >> 63)))) : (q31_t)x;
+}
+
+
+#endif /* ARM_MATH_H */
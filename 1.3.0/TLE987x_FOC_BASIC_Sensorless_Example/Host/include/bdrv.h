@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file bdrv.h
+ * \brief Host stand-in for the bridge driver SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef BDRV_H
+#define BDRV_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Bridge driver channel configuration */
+typedef enum _TBdrv_Ch_Cfg
+{
+    Ch_Off = 0u,  /**< \brief channel disabled                           */
+    Ch_En  = 1u,  /**< \brief channel enabled                            */
+    Ch_PWM = 3u,  /**< \brief channel enabled with PWM (CCU6 connection) */
+    Ch_On  = 5u,  /**< \brief channel enabled and static on              */
+    Ch_DCS = 9u   /**< \brief channel enabled with Diag.-Current Source  */
+} TBdrv_Ch_Cfg;
+
+/** \brief Simulated SCUPM register block */
+#define SCUPM (&HostSfr.scupm)
+
+/** \brief Clears the given bits in the bridge driver interrupt status register */
+void BDRV_Clr_Sts(uint32 Sts_Bit);
+
+/** \brief Configures all six bridge driver stages */
+void BDRV_Set_Bridge(TBdrv_Ch_Cfg LS1_Cfg, TBdrv_Ch_Cfg HS1_Cfg, TBdrv_Ch_Cfg LS2_Cfg, TBdrv_Ch_Cfg HS2_Cfg,
+                     TBdrv_Ch_Cfg LS3_Cfg, TBdrv_Ch_Cfg HS3_Cfg);
+
+#endif /* BDRV_H */
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file bootrom.h
+ * \brief Host stand-in for the BootROM SDK driver, backed by the simulated data flash of host_sfr.h.
+ */
+
+#ifndef _BOOTROM_H
+#define _BOOTROM_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Size of a flash page in bytes */
+#define FlashPageSize (HOST_SFR_FLASH_PAGE_SIZE)
+
+/**
+ * \brief Programs a page of the simulated data flash with the given data.
+ * \param addr Address of the page, see DataFlashStart in tle_variants.h
+ * \param buf Data of the page, FlashPageSize bytes
+ * \param Branch Not simulated
+ * \param Correct Not simulated
+ * \param FailPageErase Not simulated
+ * \return 0 if the page was programmed, 1 if the address is not the start of a data flash page
+ */
+uint8 ProgramPage(uint32 addr, const uint8* buf, uint8 Branch, uint8 Correct, uint8 FailPageErase);
+
+#endif /* _BOOTROM_H */
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file ccu6.h
+ * \brief Host stand-in for the CCU6 SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef CCU6_H
+#define CCU6_H
+
+#include "types.h"
+#include "ccu6_defines.h"
+#include "host_sfr.h"
+
+/** \brief Simulated CCU6 register block */
+#define CCU6 (&HostSfr.ccu6)
+
+/** \brief Selects the T13 trigger event */
+INLINE void CCU6_SetT13Trigger(uint16 Mask)
+{
+    HostSfr.ccu6T13Trigger = Mask;
+}
+
+
+/** \brief Clears the trap interrupt flag */
+INLINE void CCU6_TRAP_Int_Clr(void)
+{
+    HostSfr.ccu6TrapFlag = 0u;
+}
+
+
+/** \brief Reads the trap interrupt flag */
+INLINE uint8 CCU6_Trap_Flag_Int_Sts(void)
+{
+    return HostSfr.ccu6TrapFlag;
+}
+
+
+/** \brief Loads the CC60 shadow register */
+INLINE void CCU6_LoadShadowRegister_CC60(uint16 tick)
+{
+    HostSfr.ccu6CompareShadow[0] = tick;
+}
+
+
+/** \brief Loads the CC61 shadow register */
+INLINE void CCU6_LoadShadowRegister_CC61(uint16 tick)
+{
+    HostSfr.ccu6CompareShadow[1] = tick;
+}
+
+
+/** \brief Loads the CC62 shadow register */
+INLINE void CCU6_LoadShadowRegister_CC62(uint16 tick)
+{
+    HostSfr.ccu6CompareShadow[2] = tick;
+}
+
+
+/** \brief Loads the CC63 shadow register */
+INLINE void CCU6_LoadShadowRegister_CC63(uint16 tick)
+{
+    HostSfr.ccu6CompareShadow[3] = tick;
+}
+
+
+/** \brief Requests the T12 shadow transfer, applied immediately on the host */
+INLINE void CCU6_T12_Str_En(void)
+{
+    HostSfr.ccu6Compare[0] = HostSfr.ccu6CompareShadow[0];
+    HostSfr.ccu6Compare[1] = HostSfr.ccu6CompareShadow[1];
+    HostSfr.ccu6Compare[2] = HostSfr.ccu6CompareShadow[2];
+    HostSfr.ccu6T12ShadowTransfers++;
+}
+
+
+/** \brief Requests the T13 shadow transfer, applied immediately on the host */
+INLINE void CCU6_T13_Str_En(void)
+{
+    HostSfr.ccu6Compare[3] = HostSfr.ccu6CompareShadow[3];
+    HostSfr.ccu6T13ShadowTransfers++;
+}
+
+
+/** \brief Reads the T12 period value */
+INLINE uint16 CCU6_T12_Period_Value_Get(void)
+{
+    return HostSfr.ccu6T12Period;
+}
+
+
+/** \brief Sets the T12 period value */
+INLINE void CCU6_T12_Period_Value_Set(uint16 t12pr)
+{
+    HostSfr.ccu6T12Period = t12pr;
+}
+
+
+/** \brief Reads the dead time in T12 clock ticks */
+INLINE uint8 CCU6_Deadtime_Get(void)
+{
+    return HostSfr.ccu6Deadtime;
+}
+
+
+/** \brief Sets the dead time in T12 clock ticks */
+INLINE void CCU6_Deadtime_Set(uint16 dtm)
+{
+    HostSfr.ccu6Deadtime = (uint8)dtm;
+}
+
+
+/** \brief Loads the multi-channel PWM shadow register */
+INLINE void CCU6_Multi_Ch_PWM_Shadow_Reg_Load(uint16 ccu6_mask)
+{
+    HostSfr.ccu6McmShadow = ccu6_mask;
+}
+
+
+/** \brief Requests the multi-channel PWM shadow transfer, applied immediately on the host */
+INLINE void CCU6_MCM_PWM_Str_SW_En(void)
+{
+    HostSfr.ccu6Mcm = HostSfr.ccu6McmShadow;
+}
+
+
+#endif /* CCU6_H */
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file cmsis_compiler.h
+ * \brief Host stand-in for the CMSIS compiler abstraction (gcc/clang).
+ */
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include <stdint.h>
+
+#ifndef __USED
+  #define __USED __attribute__((used))
+#endif
+
+#ifndef __STATIC_INLINE
+  #define __STATIC_INLINE static inline
+#endif
+
+#ifndef __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE __attribute__((always_inline)) static inline
+#endif
+
+/** \brief Signed saturation to the given bit width, equivalent to the SSAT instruction */
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+    /* Largest value which can be represented with sat bits */
+    const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+
+    /* Smallest value which can be represented with sat bits */
+    const int32_t min = -1 - max;
+
+    return (val > max) ? max : ((val < min) ? min : val);
+}
+
+
+#endif /* CMSIS_COMPILER_H */
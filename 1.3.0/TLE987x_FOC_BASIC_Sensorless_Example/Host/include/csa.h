@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file csa.h
+ * \brief Host stand-in for the current sense amplifier SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef CSA_H
+#define CSA_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Powers on the current sense amplifier */
+INLINE void CSA_Power_On(void)
+{
+    HostSfr.csaPowered = true;
+}
+
+
+/** \brief Powers off the current sense amplifier */
+INLINE void CSA_Power_Off(void)
+{
+    HostSfr.csaPowered = false;
+}
+
+
+/** \brief Sets the current sense amplifier gain */
+INLINE void CSA_Gain_Set(uint32 gain)
+{
+    HostSfr.csaGain = gain & 3u;
+}
+
+
+/** \brief Reads the current sense amplifier gain */
+INLINE uint32 CSA_Gain_Get(void)
+{
+    return HostSfr.csaGain;
+}
+
+
+#endif /* CSA_H */
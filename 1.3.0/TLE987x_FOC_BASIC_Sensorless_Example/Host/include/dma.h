@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file dma.h
+ * \brief Host stand-in for the DMA SDK driver, backed by host_sfr.h.
+ *
+ * Only memory scatter-gather task lists are simulated, they are run by HostSfr_RequestDma(). The SDK passes addresses
+ * as uint32, so the stacks using the DMA are built and linked as position dependent code, see CMakeLists.txt.
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief DMA channel 5, ADC1 channel 1 */
+#define DMA_CH5      (5u)
+
+/** \brief DMA channel 5 mask */
+#define DMA_MASK_CH5 ((uint16)1u << DMA_CH5)
+
+/** \brief Transfer sizes */
+typedef enum _TDMA_Transfer_Size
+{
+    DMA_8Bit_Transfer  = 0u,
+    DMA_16Bit_Transfer = 1u,
+    DMA_32Bit_Transfer = 2u
+} TDMA_Transfer_Size;
+
+/** \brief Increment modes */
+typedef enum _TDMA_Increment_Mode
+{
+    DMA_No_Inc      = 0u,
+    DMA_Src_Inc     = 1u,
+    DMA_Dst_Inc     = 2u,
+    DMA_Src_Dst_Inc = 3u
+} TDMA_Increment_Mode;
+
+/** \brief Cycle types */
+typedef enum _TDMA_Cycle_Types
+{
+    DMA_Cycle_Type_Invalid       = 0u,
+    DMA_Cycle_Type_Basic         = 1u,
+    DMA_Cycle_Type_Auto          = 2u,
+    DMA_Cycle_Type_PingPong      = 3u,
+    DMA_Cycle_Type_MemSctGthPrim = 4u,
+    DMA_Cycle_Type_MemSctGthAlt  = 5u,
+    DMA_Cycle_Type_PerSctGthPrim = 6u,
+    DMA_Cycle_Type_PerSctGthAlt  = 7u
+} TDMA_Cycle_Types;
+
+/** \brief Channel control word */
+typedef union
+{
+    uint32 reg;
+    struct
+    {
+        uint32 Cycle_Ctrl    : 3;
+        uint32 Next_UseBurst : 1;
+        uint32 N_Minus_1     : 10;
+        uint32 R_Power       : 4;
+        uint32 Src_Prot_Ctrl : 3;
+        uint32 Dst_Prot_Ctrl : 3;
+        uint32 Src_Size      : 2;
+        uint32 Src_Inc       : 2;
+        uint32 Dst_Size      : 2;
+        uint32 Dst_Inc       : 2;
+    } bit;
+} TControl;
+
+/** \brief Channel control structure entry, also one task of a scatter-gather task list */
+typedef struct
+{
+    uint32   Src_End_Ptr;
+    uint32   Dst_End_Ptr;
+    TControl Control;
+    uint32   reserved;
+} TDMA_Entry;
+
+/** \brief Sets the master enable */
+INLINE void DMA_Master_En(void)
+{
+    HostSfr.dmaMasterEnable = true;
+}
+
+
+/** \brief Enables DMA channels */
+INLINE void DMA_Channel_Enable_Set(uint32 mask_ch)
+{
+    HostSfr.dmaChannelEnable |= mask_ch;
+}
+
+
+/** \brief Sets up one task of a scatter-gather task list */
+TDMA_Entry* DMA_Task_Set(TDMA_Entry* entry, TDMA_Cycle_Types cycle_type, uint8 arb_rate, uint32 addr_src,
+                         uint32 addr_dst, uint32 trans_cnt, TDMA_Transfer_Size datawidth,
+                         TDMA_Increment_Mode increment);
+
+/** \brief Sets up the primary structure of a channel for memory scatter-gather with the given task list */
+void DMA_Channel_MemSctGth_Set(uint32 DMA_ChIdx, TDMA_Entry* Task_List, uint32 NoOfTasks);
+
+#endif /* DMA_H */
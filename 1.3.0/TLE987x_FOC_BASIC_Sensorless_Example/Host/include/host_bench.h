@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench.h
+ * \brief Micro benchmark harness for the kernels of the math libraries on the host.
+ *
+ * A kernel executes the function under test a given number of times with varying inputs and accumulates the results
+ * in HostBench_sink, so that the compiler cannot drop the calls. Each kernel is run several times and the fastest run
+ * is reported, in ns per call and in timestamp units of host_profiler.h per call.
+ */
+
+#ifndef HOST_BENCH_H
+#define HOST_BENCH_H
+
+#include "types.h"
+
+/** \brief Number of runs of each kernel, the fastest one is reported */
+#define HOST_BENCH_RUNS (5u)
+
+/** \brief Kernel under test, executes the function under test calls times */
+typedef void (*THostBench_Kernel)(uint32 calls);
+
+/** \brief Result of one kernel */
+typedef struct
+{
+    float64 nsPerCall;    /**< \brief Wall time per call */
+    float64 unitsPerCall; /**< \brief Instructions (or ns, see HostProfiler_getUnit()) per call */
+} THostBench_Result;
+
+/** \brief Accumulator of the kernel results */
+extern volatile sint32 HostBench_sink;
+
+/**
+ * \brief Returns a monotonic time stamp in nanoseconds.
+ */
+uint64 HostBench_nowNs(void);
+
+/**
+ * \brief Runs a kernel HOST_BENCH_RUNS times and returns the cost per call of the fastest run.
+ *
+ * \param [in] kernel Kernel under test
+ * \param [in] calls  Calls per run
+ *
+ * \return Cost per call
+ */
+THostBench_Result HostBench_run(THostBench_Kernel kernel, uint32 calls);
+
+/**
+ * \brief Runs a kernel and prints one table row with its cost per call.
+ *
+ * \param [in] name   Name of the kernel
+ * \param [in] kernel Kernel under test
+ * \param [in] calls  Calls per run
+ *
+ * \return Cost per call
+ */
+THostBench_Result HostBench_print(const char* name, THostBench_Kernel kernel, uint32 calls);
+
+/**
+ * \brief Prints the table header of HostBench_print().
+ */
+void HostBench_printHeader(void);
+
+#endif /* HOST_BENCH_H */
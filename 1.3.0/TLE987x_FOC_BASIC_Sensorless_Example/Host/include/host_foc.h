@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_foc.h
+ * \brief Host counterpart of Example/main.c: owns the FOC instance and replays the interrupt sequence of the target
+ * (CCU6 period match, CCU6 one match with PendSV fast loop, GPT12 T6 speed loop) one PWM period at a time.
+ */
+
+#ifndef HOST_FOC_H
+#define HOST_FOC_H
+
+#include "Ifx_MS_FocSolutionF16.h"
+#include "gpt12e_defines.h"
+
+/** \brief PWM periods per speed loop call, derived from the GPT12 CAPREL reload time */
+#define HOST_FOC_SPEED_LOOP_DIVIDER     ((uint32)((GPT12E_CAPREL_TIME * (float64)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ / 1000.0) + 0.5))
+
+/** \brief PWM period in seconds */
+#define HOST_FOC_PWM_PERIOD_S (1.0 / ((float64)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000.0))
+
+/** \brief User inputs of the example application, see Example/main.c */
+typedef struct
+{
+    Ifx_Math_Fract16    referenceSpeedQ0;      /**< \brief Reference mechanical speed in rpm */
+    Ifx_Math_CmpFract16 currentsDqReference;   /**< \brief dq current reference for the direct interface */
+    uint8               enablePowerStage;      /**< \brief Enables the power stage */
+    uint8               enableControl;         /**< \brief Enables the speed control */
+    uint8               controlMode;           /**< \brief Ifx_MS_FocSolutionF16_ControlMode */
+    uint8               enableDirectInterface; /**< \brief Enables the direct dq current interface */
+    uint8               clrFaultFoc;           /**< \brief Requests a fault clear */
+    uint8               enableSpeedPreControl; /**< \brief Enables the speed pre-control */
+} THostFoc_Inputs;
+
+/** \brief FOC instance driven by the host harness */
+extern Ifx_MS_FocSolutionF16 FocDemoClosedLoop;
+
+/** \brief User inputs, evaluated in HostFoc_Background() and in the speed loop */
+extern THostFoc_Inputs       HostFoc_inputs;
+
+/**
+ * \brief Resets the simulated registers and the user inputs and initializes the FOC instance, as main() does after
+ * TLE_Init().
+ */
+void HostFoc_Init(void);
+
+/**
+ * \brief Executes one pass of the main() background loop (enable/clear requests and bridge driver handling).
+ */
+void HostFoc_Background(void);
+
+/**
+ * \brief CCU6 period match callback. HostSfr.adc1.RES_OUT_EIM must hold the first shunt sample.
+ */
+void HostFoc_PeriodMatch(void);
+
+/**
+ * \brief CCU6 one match callback, including the fast loop which is executed from PendSV on the target.
+ * HostSfr.adc1.RES_OUT1 must hold the second shunt sample and HostSfr.adc1.RES_OUT6 the DC-link voltage.
+ *
+ * \return true if the fast loop was executed in this PWM period
+ */
+bool HostFoc_OneMatch(void);
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+/**
+ * \brief DMA channel 5 callback, the current measurements of a PWM period have been captured.
+ */
+void HostFoc_DmaCh5(void);
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+/**
+ * \brief GPT12 T6 speed loop callback.
+ */
+void HostFoc_SpeedLoop(void);
+
+/**
+ * \brief Executes one PWM period: period match, one match (and fast loop when due) and, every
+ * HOST_FOC_SPEED_LOOP_DIVIDER periods, the speed loop and the background loop.
+ */
+void HostFoc_Step(void);
+
+#endif /* HOST_FOC_H */
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_plant.h
+ * \brief PMSM and inverter plant model for software-in-the-loop runs of the FOC stack on the host.
+ *
+ * The plant consumes the compare values and trigger times which the pattern generator transferred to the simulated
+ * CCU6/Timer3 registers (i.e. the six compare values and the two trigger times of Ifx_MAS_ModulatorF16_execute() in
+ * the period in which the hardware applies them) and writes the two single shunt samples and the DC-link voltage to
+ * the simulated ADC1 result registers before the period match and one match interrupts read them.
+ *
+ * Model:
+ * - ideal three phase inverter (no dead time, no switching delay) with constant DC-link voltage, all phases floating
+ *   and no current while the outputs of the pattern generator are disabled
+ * - surface mounted PMSM (Ld = Lq) in the stationary alpha/beta frame, integrated with a semi-implicit Euler step per
+ *   constant switching state segment of the PWM period, back EMF held constant over each half PWM period
+ * - one mass mechanical system with viscous friction and a constant load torque, updated every half PWM period
+ * - DC-link shunt, CSA and 12 bit ADC scaled as the inverse of the current conversion of the measurement ADC module,
+ *   with optional white noise of each conversion
+ *
+ * With IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1 the conversion of channel 1 requests DMA channel 5, and the DMA
+ * channel 5 callback is called when the request completes the task list of the channel.
+ */
+
+#ifndef HOST_PLANT_H
+#define HOST_PLANT_H
+
+#include "types.h"
+
+/** \brief Motor, inverter and load parameters of the plant, in SI units */
+typedef struct
+{
+    float64 resistance_Ohm;          /**< \brief Phase resistance */
+    float64 inductance_H;            /**< \brief Phase inductance (Ld = Lq) */
+    float64 flux_Wb;                 /**< \brief Permanent magnet flux linkage (amplitude) */
+    uint8   polePairs;               /**< \brief Number of pole pairs */
+    float64 inertia_kgm2;            /**< \brief Rotor and load inertia */
+    float64 viscousFriction_Nms;     /**< \brief Viscous friction constant */
+    float64 loadTorque_Nm;           /**< \brief Constant load torque, opposing the direction of rotation */
+    float64 dcLinkVoltage_V;         /**< \brief DC-link voltage */
+    float64 adcOffset_lsb;           /**< \brief ADC result of the CSA output at zero shunt current */
+    float64 adcPerAmpere_lsb;        /**< \brief ADC LSB per A shunt current */
+    float64 adcPerVolt_lsb;          /**< \brief VDH ADC LSB per V DC-link voltage */
+    float64 adcNoise_lsb;            /**< \brief RMS white noise of a shunt current conversion, 0 for none */
+} THostPlant_Params;
+
+/** \brief Plant state and the compare values latched from the simulated registers */
+typedef struct
+{
+    THostPlant_Params params;                   /**< \brief Plant parameters */
+
+    /* Electrical state */
+    float64           currentAlpha_A;           /**< \brief Stator current, alpha axis */
+    float64           currentBeta_A;            /**< \brief Stator current, beta axis */
+    float64           angleElec_rad;            /**< \brief Electrical rotor angle [0, 2pi) */
+
+    /* Mechanical state */
+    float64           speedMech_radps;          /**< \brief Mechanical rotor speed */
+    float64           torque_Nm;                /**< \brief Electrical torque of the last half period */
+
+    /* Switching times applied in the current PWM period, in modulator ticks from the start of the period */
+    uint16            switchOn_tick[3];         /**< \brief High side switch on time of phase U, V, W */
+    uint16            switchOff_tick[3];        /**< \brief High side switch off time of phase U, V, W */
+    uint16            triggerTime_tick[2];      /**< \brief First (EIM) and second (CSA) shunt sampling time */
+
+    /* Time base */
+    float64           tick_s;                   /**< \brief Duration of one modulator tick */
+    uint16            period_tick;              /**< \brief PWM period in modulator ticks */
+    float64           time_s;                   /**< \brief Simulated time */
+    uint32            periodCounter;            /**< \brief PWM periods since the last speed loop call */
+    uint32            noiseState;               /**< \brief State of the noise generator */
+} THostPlant;
+
+/**
+ * \brief Fills the plant parameters with the motor of the project configuration (Ifx_MS_FocSolutionF16_Cfg.h base
+ * values and inertia, measurement ADC scaling), a DC-link voltage of 12 V and no load.
+ *
+ * \param [out] params Plant parameters
+ */
+void HostPlant_defaultParams(THostPlant_Params* params);
+
+/**
+ * \brief Initializes the plant at standstill with zero currents and a rotor angle of zero.
+ *
+ * \param [out] self   Plant instance
+ * \param [in]  params Plant parameters
+ */
+void HostPlant_init(THostPlant* self, const THostPlant_Params* params);
+
+/**
+ * \brief Simulates the up counting half of the PWM period and stores the first shunt sample in
+ * HostSfr.adc1.RES_OUT_EIM. Call before the period match interrupt.
+ *
+ * \param [in,out] self Plant instance
+ */
+void HostPlant_runUpCounting(THostPlant* self);
+
+/**
+ * \brief Latches the up counting compare values and the Timer3 trigger for the next PWM period. Call after the
+ * period match interrupt.
+ *
+ * \param [in,out] self Plant instance
+ */
+void HostPlant_latchUpCounting(THostPlant* self);
+
+/**
+ * \brief Simulates the down counting half of the PWM period and stores the second shunt sample in
+ * HostSfr.adc1.RES_OUT1 and the DC-link voltage in HostSfr.adc1.RES_OUT6. Call before the one match interrupt.
+ *
+ * \param [in,out] self Plant instance
+ */
+void HostPlant_runDownCounting(THostPlant* self);
+
+/**
+ * \brief Latches the down counting compare values and the CC63 trigger for the next PWM period. Call after the one
+ * match interrupt.
+ *
+ * \param [in,out] self Plant instance
+ */
+void HostPlant_latchDownCounting(THostPlant* self);
+
+/**
+ * \brief Executes one PWM period of the closed loop: plant and interrupts of the FOC instance of host_foc.h in the
+ * order in which they occur on the target, including the speed loop every HOST_FOC_SPEED_LOOP_DIVIDER periods.
+ *
+ * \param [in,out] self Plant instance
+ *
+ * \return true if the fast loop was executed in this PWM period
+ */
+bool HostPlant_stepClosedLoop(THostPlant* self);
+
+/**
+ * \brief Returns the mechanical rotor speed in rpm.
+ *
+ * \param [in] self Plant instance
+ */
+static inline float64 HostPlant_getSpeedRpm(const THostPlant* self)
+{
+    return self->speedMech_radps * (60.0 / (2.0 * 3.14159265358979323846));
+}
+
+
+/**
+ * \brief Returns the d and q current in the rotor frame of the plant.
+ *
+ * \param [in]  self      Plant instance
+ * \param [out] currentD_A d current
+ * \param [out] currentQ_A q current
+ */
+void HostPlant_getCurrentsDq(const THostPlant* self, float64* currentD_A, float64* currentQ_A);
+
+#endif /* HOST_PLANT_H */
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_decode.h
+ * \brief Decoder of the compressed ProbeScope buffers (PROBE_SCOPE_COMPRESS_EN), see probe_scope.h for the format.
+ *
+ * The buffer of a channel can be read from the device with the debugger or with ProbeScope_ChBlocksGet(), the blocks
+ * are decoded independently of each other.
+ */
+
+#ifndef HOST_PROBE_DECODE_H
+#define HOST_PROBE_DECODE_H
+
+#include "types.h"
+
+/**
+ * \brief Decodes one block of a channel.
+ *
+ * \param [in]  block       Block of PROBE_SCOPE_COMPRESS_BLOCK_SIZE bytes
+ * \param [in]  dataType    Data type of the channel, PROBE_SCOPE_INT08U .. PROBE_SCOPE_FP32
+ * \param [in]  shift       Resolution of the codes of the channel, see ProbeScope_ChCompressSet()
+ * \param [out] values      PROBE_SCOPE_COMPRESS_KEY_SAMPLES samples, in the low bits
+ */
+void HostProbeDecode_block(const uint8* block, uint8 dataType, uint8 shift, uint32* values);
+
+/**
+ * \brief Returns a decoded sample as number.
+ *
+ * \param [in] value    Sample, in the low bits
+ * \param [in] dataType Data type of the channel
+ *
+ * \return Sample as signed or unsigned integer or as float, depending on the data type
+ */
+float64 HostProbeDecode_toFloat(uint32 value, uint8 dataType);
+
+#endif /* HOST_PROBE_DECODE_H */
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_profiler.h
+ * \brief Timestamp of the fast loop profiler (IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP) for the host build.
+ *
+ * Counts the user space instructions retired by the calling thread (Linux perf events), so the statistics of
+ * Ifx_MS_FocSolutionF16_getProfilerStatistics() do not depend on the load of the host. If the hardware counter is not
+ * accessible (no PMU in a virtual machine, perf_event_paranoid), the timestamp falls back to monotonic nanoseconds.
+ */
+
+#ifndef HOST_PROFILER_H
+#define HOST_PROFILER_H
+
+#include "types.h"
+
+/**
+ * \brief Returns the instruction count (or the nanosecond clock) modulo 2^32. Opens the counter on the first call.
+ */
+uint32 HostProfiler_timestamp(void);
+
+/**
+ * \brief Returns the unit of HostProfiler_timestamp(), "instructions" or "ns". Opens the counter if necessary.
+ */
+const char* HostProfiler_getUnit(void);
+
+#endif /* HOST_PROFILER_H */
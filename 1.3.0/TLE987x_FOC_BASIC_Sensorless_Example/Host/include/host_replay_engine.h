@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_replay_engine.h
+ * \brief Offline replay of recorded fast loop signals through the flux estimator, the FOC controller and the
+ * modulator, as Ifx_MS_FocSolutionF16_executeControlMode() calls them.
+ *
+ * A recording is a CSV file with one line per fast loop cycle and a header line with the column names of
+ * HostReplay_columnNames, in any order. The values are the raw integers of the FOC solution after the fast loop of the
+ * cycle, e.g. ProbeScope channels received with foc_probe_rx with the header renamed:
+ * - currentAlpha, currentBeta: currentsAlphaBeta (Q15)
+ * - dcLinkVoltage: measurementADCTLE987.p_output.dcLinkVoltageQ15 (Q15)
+ * - voltageAmplitude, voltageAngle: focController.p_output.voltageCommandPolar, the input of the modulator
+ * - state, subState: p_status.state and p_status.subState
+ * - angle: angle, the rotor angle of the Park transformation (32 bit)
+ * - currentDRef, currentQRef: dqCommand (Q15)
+ * - speedRef: rateLimitInSpeedQ15 (Q15)
+ * - estimatedSpeed: p_output.estimatedSpeedQ15 (Q15), only compared with the replay
+ *
+ * The currents, the DC-link voltage and the voltage command are required. Without state the solution is taken as
+ * running, without subState as in closed loop. Without the current references the FOC controller is not replayed.
+ * As in the FOC solution, the filters of the flux estimator are reset in the off and standby states.
+ *
+ * The recorded currents are not a result of the replayed voltage, so the modulator is fed with the recorded voltage
+ * command and the flux estimator sees the voltage which was applied. The output of the replayed FOC controller is the
+ * voltage it would have commanded with the replayed angle. The phase currents of the modulator are derived from the
+ * alpha-beta currents, they are only used by the dead time compensation. The rotation of the dq reference system on a
+ * sign change of the q current command is not replayed.
+ */
+
+#ifndef HOST_REPLAY_ENGINE_H
+#define HOST_REPLAY_ENGINE_H
+
+#include <stdio.h>
+#include "Ifx_MS_FocSolutionF16.h"
+
+/** \brief Columns of a recording, bit positions of THostReplay.columns */
+typedef enum
+{
+    HostReplay_Column_currentAlpha = 0,
+    HostReplay_Column_currentBeta,
+    HostReplay_Column_dcLinkVoltage,
+    HostReplay_Column_voltageAmplitude,
+    HostReplay_Column_voltageAngle,
+    HostReplay_Column_state,
+    HostReplay_Column_subState,
+    HostReplay_Column_angle,
+    HostReplay_Column_currentDRef,
+    HostReplay_Column_currentQRef,
+    HostReplay_Column_speedRef,
+    HostReplay_Column_estimatedSpeed,
+    HostReplay_Column_total
+} THostReplay_Column;
+
+/** \brief Column names of a recording, in the order of THostReplay_Column */
+extern const char* const HostReplay_columnNames[HostReplay_Column_total];
+
+/** \brief Recorded signals of one fast loop cycle */
+typedef struct
+{
+    Ifx_Math_CmpFract16   currentsAlphaBeta; /**< \brief Alpha-beta currents of the cycle */
+    Ifx_Math_Fract16      dcLinkVoltageQ15;  /**< \brief DC-link voltage of the cycle */
+    Ifx_Math_PolarFract16 voltageCommand;    /**< \brief Voltage command of the FOC controller */
+    uint8                 state;             /**< \brief Ifx_MS_FocSolutionF16_State */
+    uint8                 subState;          /**< \brief Ifx_MS_FocSolutionF16_SubState */
+    uint32                angle;             /**< \brief Rotor angle of the Park transformation */
+    Ifx_Math_CmpFract16   dqCommand;         /**< \brief dq current references */
+    Ifx_Math_Fract16      speedRefQ15;       /**< \brief Rate limited reference speed */
+    Ifx_Math_Fract16      estimatedSpeedQ15; /**< \brief Estimated speed of the target */
+} THostReplay_Record;
+
+/** \brief Replayed signals of one fast loop cycle */
+typedef struct
+{
+    Ifx_Math_Fract16      estimatedSpeedQ15; /**< \brief Speed of the flux estimator */
+    uint32                estimatedAngle;    /**< \brief Angle of the flux estimator */
+    Ifx_Math_PolarFract16 voltageCommand;    /**< \brief Voltage command of the FOC controller, 0 if not running */
+    Ifx_Math_PolarFract16 actualVoltage;     /**< \brief Actual voltage of the modulator */
+} THostReplay_Output;
+
+/** \brief Parameters which differ from the project configuration, 0 keeps the configured value */
+typedef struct
+{
+    float64 pllGain;            /**< \brief Proportional gain of the PLL */
+    uint32  alphaTimeConst_us;  /**< \brief Time constant of the alpha flux filter, its gain follows it */
+    uint32  betaTimeConst_us;   /**< \brief Time constant of the beta flux filter, its gain follows it */
+    uint32  speedTimeConst_us;  /**< \brief Time constant of the speed filter */
+} THostReplay_Params;
+
+/** \brief Replayed modules */
+typedef struct
+{
+    Ifx_MDA_FluxEstimatorF16 fluxEstimator;
+    Ifx_MDA_FocControllerF16 focController;
+    Ifx_MAS_ModulatorF16     modulator;
+    Ifx_Math_CmpFract16      voltageAlphaBeta;         /**< \brief Actual voltage of the modulator */
+    Ifx_Math_CmpFract16      previousVoltageAlphaBeta; /**< \brief Actual voltage of the previous cycle */
+    uint32                   columns;                  /**< \brief Columns of the recording */
+} THostReplay;
+
+/**
+ * \brief Reads a recording.
+ *
+ * \param [in]  file    Recording, CSV
+ * \param [out] records Records of the cycles, to be released with free()
+ * \param [out] columns Columns of the recording, a bit per THostReplay_Column
+ *
+ * \return Number of cycles, 0 if the file could not be parsed or misses a required column
+ */
+uint32 HostReplay_read(FILE* file, THostReplay_Record** records, uint32* columns);
+
+/**
+ * \brief Writes the header line of a recording with all columns.
+ */
+void HostReplay_writeHeader(FILE* file);
+
+/**
+ * \brief Writes the line of a cycle of a recording with all columns.
+ */
+void HostReplay_writeRecord(FILE* file, const THostReplay_Record* record);
+
+/**
+ * \brief Writes the header line of the replayed signals.
+ */
+void HostReplay_writeOutputHeader(FILE* file);
+
+/**
+ * \brief Writes the line of a cycle of the replayed signals.
+ */
+void HostReplay_writeOutput(FILE* file, uint32 cycle, const THostReplay_Output* output);
+
+/**
+ * \brief Initializes the modules from the project configuration and applies the given parameters.
+ *
+ * \param [out] self    Replay instance
+ * \param [in]  params  Parameters, NULL for the project configuration
+ * \param [in]  columns Columns of the recording
+ */
+void HostReplay_init(THostReplay* self, const THostReplay_Params* params, uint32 columns);
+
+/**
+ * \brief Replays one fast loop cycle.
+ *
+ * \param [inout] self   Replay instance
+ * \param [in]    record Recorded signals of the cycle
+ * \param [out]   output Replayed signals of the cycle
+ */
+void HostReplay_step(THostReplay* self, const THostReplay_Record* record, THostReplay_Output* output);
+
+#endif /* HOST_REPLAY_ENGINE_H */
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_sfr.h
+ * \brief Simulated TLE987x special function registers for the host build.
+ *
+ * The host build replaces the SDK peripheral headers (adc1.h, ccu6.h, csa.h, dma.h, timer3.h, bdrv.h, port.h, int.h) by
+ * stand-ins which read and write the register image below instead of the device SFRs. A test bench or plant model
+ * writes the ADC results before a measurement interrupt and reads back the compare values that the pattern
+ * generator transferred to the CCU6 shadow registers.
+ */
+
+#ifndef HOST_SFR_H
+#define HOST_SFR_H
+
+#include "types.h"
+
+/** \brief Number of CCU6 compare channels (CC60..CC63) */
+#define HOST_SFR_CCU6_CHANNELS (4u)
+
+/** \brief Number of bridge driver stages (LS1, HS1, LS2, HS2, LS3, HS3) */
+#define HOST_SFR_BDRV_STAGES   (6u)
+
+/** \brief Number of DMA channels */
+#define HOST_SFR_DMA_CHANNELS  (14u)
+
+/** \brief Size of the simulated data flash in bytes */
+#define HOST_SFR_DATA_FLASH_SIZE (0x1000u)
+
+/** \brief Size of a flash page in bytes */
+#define HOST_SFR_FLASH_PAGE_SIZE (128u)
+
+/** \brief Number of pages of the simulated data flash */
+#define HOST_SFR_DATA_FLASH_PAGES (HOST_SFR_DATA_FLASH_SIZE / HOST_SFR_FLASH_PAGE_SIZE)
+
+/** \brief Simulated ADC1 result register, the result is in bits 0..11 */
+typedef union
+{
+    uint32 reg;
+} THostSfr_Adc1_ResOut;
+
+/** \brief Simulated ADC1 register subset accessed directly through the ADC1 pointer, e.g. as DMA source */
+typedef struct
+{
+    THostSfr_Adc1_ResOut RES_OUT_EIM;
+    THostSfr_Adc1_ResOut RES_OUT6;
+    THostSfr_Adc1_ResOut RES_OUT1;
+} THostSfr_Adc1;
+
+/** \brief Simulated CCU6 port input select register 0 */
+typedef union
+{
+    uint32 reg;
+    struct
+    {
+        uint32 ISCC60  : 2;
+        uint32 ISCC61  : 2;
+        uint32 ISCC62  : 2;
+        uint32 ISTRP   : 2;
+        uint32 ISPOS0  : 2;
+        uint32 ISPOS1  : 2;
+        uint32 ISPOS2  : 2;
+        uint32 IST12HR : 2;
+        uint32         : 16;
+    } bit;
+} THostSfr_Ccu6_Pisel0;
+
+/** \brief Simulated CCU6 register subset accessed directly through the CCU6 pointer */
+typedef struct
+{
+    THostSfr_Ccu6_Pisel0 PISEL0;
+} THostSfr_Ccu6;
+
+/** \brief Simulated SCUPM register subset accessed directly through the SCUPM pointer */
+typedef struct
+{
+    union
+    {
+        uint32 reg;
+    } BDRV_IS;
+} THostSfr_Scupm;
+
+/** \brief Register image of all peripherals used by the motor control libraries */
+typedef struct
+{
+    /* ADC1 */
+    THostSfr_Adc1  adc1;                                          /**< \brief EIM (shunt sample at period match),
+                                                                   *   channel 1 (CSA) and channel 6 (VDH) results */
+    uint8          adc1Mode;                                      /**< \brief SW_MODE or SEQ_MODE */
+    uint8          adc1SocSwChannel;                              /**< \brief Channel selected for SW conversions */
+    uint32         adc1SocCount;                                  /**< \brief Number of SW start-of-conversions */
+
+    /* CSA */
+    bool           csaPowered;                                    /**< \brief CSA power state */
+    uint32         csaGain;                                       /**< \brief CSA gain setting (0..3) */
+
+    /* CCU6 */
+    THostSfr_Ccu6  ccu6;                                          /**< \brief Directly accessed CCU6 registers */
+    uint16         ccu6CompareShadow[HOST_SFR_CCU6_CHANNELS];     /**< \brief CC6xSR shadow registers */
+    uint16         ccu6Compare[HOST_SFR_CCU6_CHANNELS];           /**< \brief CC6xR after shadow transfer */
+    uint16         ccu6T12Period;                                 /**< \brief T12PR */
+    uint8          ccu6Deadtime;                                  /**< \brief T12DTC.DTM */
+    uint16         ccu6T13Trigger;                                /**< \brief T13 trigger configuration */
+    uint16         ccu6McmShadow;                                 /**< \brief MCMOUTS */
+    uint16         ccu6Mcm;                                       /**< \brief MCMOUT after shadow transfer */
+    uint8          ccu6TrapFlag;                                  /**< \brief IS.TRPF */
+    uint32         ccu6T12ShadowTransfers;                        /**< \brief Number of T12 shadow transfer requests */
+    uint32         ccu6T13ShadowTransfers;                        /**< \brief Number of T13 shadow transfer requests */
+
+    /* DMA */
+    bool           dmaMasterEnable;                               /**< \brief CFG.MASTER_ENABLE */
+    uint32         dmaChannelEnable;                              /**< \brief CHNL_ENABLE_SET, cleared by a basic cycle */
+    const void*    dmaTaskList[HOST_SFR_DMA_CHANNELS];            /**< \brief Memory scatter-gather task lists */
+    uint32         dmaTasks[HOST_SFR_DMA_CHANNELS];               /**< \brief Number of tasks of the task lists */
+    uint32         dmaTransfers;                                  /**< \brief Number of DMA transfers */
+
+    /* Timer3 */
+    uint16         timer3Compare;                                 /**< \brief T3 compare value (ADC trigger) */
+
+    /* NVIC */
+    bool           nvicNode5Enabled;                              /**< \brief Int_CCU6SR1 enable state */
+
+    /* Ports */
+    uint8          portP23;                                       /**< \brief P2.3 input level */
+    uint8          portP24;                                       /**< \brief P2.4 input level */
+
+    /* UART1 */
+    uint8          uart1Sbuf;                                     /**< \brief SBUF, last byte written */
+    bool           uart1TxPending;                                /**< \brief SBUF written and not yet shifted out */
+    uint8          uart1TxIntFlag;                                /**< \brief SCON.TI */
+
+    /* Bridge driver */
+    THostSfr_Scupm scupm;                                         /**< \brief Directly accessed SCUPM registers */
+    uint8          bdrvStage[HOST_SFR_BDRV_STAGES];               /**< \brief Driver stage configuration */
+} THostSfr;
+
+/** \brief Simulated data flash, keeps its content over HostSfr_Reset() like the flash over a reset of the device */
+typedef struct
+{
+    uint8  bytes[HOST_SFR_DATA_FLASH_SIZE];        /**< \brief Content, 0 when erased */
+    uint32 pagePrograms[HOST_SFR_DATA_FLASH_PAGES]; /**< \brief Number of ProgramPage() calls per page (wear) */
+} THostSfr_DataFlash;
+
+/** \brief Register image used by all SDK stand-ins */
+extern THostSfr HostSfr;
+
+/** \brief Data flash used by the BootROM stand-in, see bootrom.h */
+extern THostSfr_DataFlash HostSfr_dataFlash;
+
+/**
+ * \brief Resets the register image to the power-on values of the configured device.
+ */
+void HostSfr_Reset(void);
+
+/**
+ * \brief Erases the whole simulated data flash and clears its program counters.
+ */
+void HostSfr_EraseDataFlash(void);
+
+/**
+ * \brief Shifts out the byte written to the UART1 buffer, i.e. one byte time of UART1 has passed. Sets the transmit
+ * interrupt flag like the end of the stop bit.
+ *
+ * \param [out] data Transmitted byte
+ *
+ * \return true if a byte was transmitted
+ */
+bool HostSfr_ShiftUart1(uint8* data);
+
+/**
+ * \brief Hardware request of a DMA channel, e.g. DMA channel 5 by the conversion of ADC1 channel 1. Runs the memory
+ * scatter-gather task list of the channel if it is enabled, up to the first basic cycle which disables the channel.
+ *
+ * \param DMA_ChIdx DMA channel number
+ *
+ * \return true if the request completed the task list, i.e. the channel interrupt would be requested
+ */
+bool HostSfr_RequestDma(uint32 DMA_ChIdx);
+
+#endif /* HOST_SFR_H */
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file int.h
+ * \brief Host stand-in for the interrupt SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef INT_H
+#define INT_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Enables the NVIC node 5 (Int_CCU6SR1) */
+INLINE void NVIC_Node5_En(void)
+{
+    HostSfr.nvicNode5Enabled = true;
+}
+
+
+/** \brief Disables the NVIC node 5 (Int_CCU6SR1) */
+INLINE void NVIC_Node5_Dis(void)
+{
+    HostSfr.nvicNode5Enabled = false;
+}
+
+
+#endif /* INT_H */
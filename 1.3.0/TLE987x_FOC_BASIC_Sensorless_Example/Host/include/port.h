@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file port.h
+ * \brief Host stand-in for the PORT SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef PORT_H
+#define PORT_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Reads the input level of P2.3 */
+INLINE uint8 PORT_P23_Get(void)
+{
+    return HostSfr.portP23;
+}
+
+
+/** \brief Reads the input level of P2.4 */
+INLINE uint8 PORT_P24_Get(void)
+{
+    return HostSfr.portP24;
+}
+
+
+#endif /* PORT_H */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file timer3.h
+ * \brief Host stand-in for the Timer3 SDK driver, backed by host_sfr.h.
+ */
+
+#ifndef TIMER3_H
+#define TIMER3_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Sets the Timer3 compare value which triggers the first shunt conversion */
+void TIMER3_Set_Cmp_Value(uint16 Cmp_Value);
+
+#endif /* TIMER3_H */
@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file tle_variants.h
+ * \brief Host stand-in for the memory layout of the device variant: the data flash is the simulated one of
+ * host_sfr.h.
+ *
+ * The SDK passes flash addresses as uint32, so the stacks reading the data flash are built and linked as position
+ * dependent code, see CMakeLists.txt.
+ */
+
+#ifndef TLE_VARIANTS_H
+#define TLE_VARIANTS_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Start address of the data flash */
+#define DataFlashStart ((uint32)(uintptr_t)&HostSfr_dataFlash.bytes[0])
+
+/** \brief Size of the data flash */
+#define DataFlashSize  (HOST_SFR_DATA_FLASH_SIZE)
+
+#endif /* TLE_VARIANTS_H */
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file uart.h
+ * \brief Host stand-in for the UART SDK driver, backed by host_sfr.h. The bytes are shifted out by
+ * HostSfr_ShiftUart1().
+ */
+
+#ifndef UART_H
+#define UART_H
+
+#include "types.h"
+#include "host_sfr.h"
+
+/** \brief Clears the transmit interrupt flag and writes a byte to the UART1 buffer */
+INLINE void UART1_Send_Byte(uint8 c)
+{
+    HostSfr.uart1TxIntFlag = 0u;
+    HostSfr.uart1Sbuf      = c;
+    HostSfr.uart1TxPending = true;
+}
+
+
+/** \brief Returns whether UART1 has transmitted a byte, i.e. the transmit interrupt flag */
+INLINE bool UART1_isByteTransmitted(void)
+{
+    return (HostSfr.uart1TxIntFlag == 1u) ? true : false;
+}
+
+
+#endif /* UART_H */
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MHA_PatternGen_Cfg.h
+ * \brief Configuration overlay of the host build with the current loop factor switchable at runtime
+ * (foc_stack_loopfactor): takes the project configuration and enables
+ * IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR.
+ */
+
+#ifndef HOST_LOOPFACTOR_IFX_MHA_PATTERNGEN_CFG_H
+#define HOST_LOOPFACTOR_IFX_MHA_PATTERNGEN_CFG_H
+
+#include_next "Ifx_MHA_PatternGen_Cfg.h"
+
+#undef IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR
+#define IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR (0x1) /*decimal 1*/
+
+#endif /* HOST_LOOPFACTOR_IFX_MHA_PATTERNGEN_CFG_H */
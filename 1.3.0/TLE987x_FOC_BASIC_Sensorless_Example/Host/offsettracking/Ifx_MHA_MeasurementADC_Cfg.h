@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MHA_MeasurementADC_Cfg.h
+ * \brief Configuration overlay of the host build with the background offset tracking of the measurement ADC
+ * (foc_stack_offsettracking): takes the project configuration and enables
+ * IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING.
+ */
+
+#ifndef HOST_OFFSETTRACKING_IFX_MHA_MEASUREMENTADC_CFG_H
+#define HOST_OFFSETTRACKING_IFX_MHA_MEASUREMENTADC_CFG_H
+
+#include_next "Ifx_MHA_MeasurementADC_Cfg.h"
+
+#undef IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING
+#define IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING (0x1) /*decimal 1*/
+
+#endif /* HOST_OFFSETTRACKING_IFX_MHA_MEASUREMENTADC_CFG_H */
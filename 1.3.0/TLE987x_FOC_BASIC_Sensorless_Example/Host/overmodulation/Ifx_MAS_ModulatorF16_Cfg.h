@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MAS_ModulatorF16_Cfg.h
+ * \brief Configuration overlay of the host build with overmodulation (foc_stack_overmodulation): takes the project
+ * configuration and sets IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE to
+ * IFX_MAS_MODULATORF16_OVERMODULATION_MODE_MEASURABLE.
+ */
+
+#ifndef HOST_OVERMODULATION_IFX_MAS_MODULATORF16_CFG_H
+#define HOST_OVERMODULATION_IFX_MAS_MODULATORF16_CFG_H
+
+#include_next "Ifx_MAS_ModulatorF16_Cfg.h"
+
+#undef IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE
+#define IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE (0x1) /*decimal 1*/
+
+#endif /* HOST_OVERMODULATION_IFX_MAS_MODULATORF16_CFG_H */
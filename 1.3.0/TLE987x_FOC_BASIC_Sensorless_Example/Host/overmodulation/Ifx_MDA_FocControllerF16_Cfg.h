@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MDA_FocControllerF16_Cfg.h
+ * \brief Configuration overlay of the host build with overmodulation (foc_stack_overmodulation): takes the project
+ * configuration and raises IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15 to six-step (2/pi).
+ */
+
+#ifndef HOST_OVERMODULATION_IFX_MDA_FOCCONTROLLERF16_CFG_H
+#define HOST_OVERMODULATION_IFX_MDA_FOCCONTROLLERF16_CFG_H
+
+#include_next "Ifx_MDA_FocControllerF16_Cfg.h"
+
+#undef IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15
+#define IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15 (0x517D) /*decimal 20861*/
+
+#endif /* HOST_OVERMODULATION_IFX_MDA_FOCCONTROLLERF16_CFG_H */
@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MS_FocSolutionF16_Cfg.h
+ * \brief Configuration overlay of the host build with the parameter block in data flash (foc_stack_parameterblock):
+ * takes the project configuration and enables IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK.
+ */
+
+#ifndef HOST_PARAMETERBLOCK_IFX_MS_FOCSOLUTIONF16_CFG_H
+#define HOST_PARAMETERBLOCK_IFX_MS_FOCSOLUTIONF16_CFG_H
+
+#include_next "Ifx_MS_FocSolutionF16_Cfg.h"
+
+#undef IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK (0x1) /*decimal 1*/
+
+#endif /* HOST_PARAMETERBLOCK_IFX_MS_FOCSOLUTIONF16_CFG_H */
@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_Math_Cfg.h
+ * \brief Configuration overlay of the PI controller checks (foc_check_pi_<disc><anti windup>): takes the project
+ * configuration and sets IFX_MATH_CFG_PI_DISC and IFX_MATH_CFG_PI_ANTI_WIND to HOST_PIVARIANT_DISC and
+ * HOST_PIVARIANT_ANTI_WIND of the compiler command line.
+ */
+
+#ifndef HOST_PIVARIANT_IFX_MATH_CFG_H
+#define HOST_PIVARIANT_IFX_MATH_CFG_H
+
+#include_next "Ifx_Math_Cfg.h"
+
+#undef IFX_MATH_CFG_PI_DISC
+#define IFX_MATH_CFG_PI_DISC      (HOST_PIVARIANT_DISC)
+
+#undef IFX_MATH_CFG_PI_ANTI_WIND
+#define IFX_MATH_CFG_PI_ANTI_WIND (HOST_PIVARIANT_ANTI_WIND)
+
+#endif /* HOST_PIVARIANT_IFX_MATH_CFG_H */
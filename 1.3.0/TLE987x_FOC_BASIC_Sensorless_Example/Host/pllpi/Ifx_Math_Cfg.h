@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_Math_Cfg.h
+ * \brief Configuration overlay of the host build with the PLL with integral path (foc_stack_pllpi): takes the project
+ * configuration and sets IFX_MATH_CFG_PLL_TYPE.
+ */
+
+#ifndef HOST_PLLPI_IFX_MATH_CFG_H
+#define HOST_PLLPI_IFX_MATH_CFG_H
+
+#include_next "Ifx_Math_Cfg.h"
+
+#undef IFX_MATH_CFG_PLL_TYPE
+#define IFX_MATH_CFG_PLL_TYPE (0x1) /*decimal 1*/
+
+#endif /* HOST_PLLPI_IFX_MATH_CFG_H */
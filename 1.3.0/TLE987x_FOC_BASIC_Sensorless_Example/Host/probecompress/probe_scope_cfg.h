@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file probe_scope_cfg.h
+ * \brief Configuration overlay of the host build with the compressed ProbeScope buffers (foc_probe_capture_compress):
+ * takes the project configuration, enables PROBE_SCOPE_COMPRESS_EN and raises PROBE_SCOPE_MAX_SAMPLES to the samples
+ * which fit into the RAM of the 50 uncompressed samples, in blocks of 16 samples.
+ */
+
+#ifndef HOST_PROBECOMPRESS_PROBE_SCOPE_CFG_H
+#define HOST_PROBECOMPRESS_PROBE_SCOPE_CFG_H
+
+#include_next "probe_scope_cfg.h"
+
+#undef PROBE_SCOPE_COMPRESS_EN
+#define PROBE_SCOPE_COMPRESS_EN 1
+
+#undef PROBE_SCOPE_MAX_SAMPLES
+#define PROBE_SCOPE_MAX_SAMPLES 192
+
+#undef PROBE_SCOPE_COMPRESS_KEY_SAMPLES
+#define PROBE_SCOPE_COMPRESS_KEY_SAMPLES 16
+
+#endif /* HOST_PROBECOMPRESS_PROBE_SCOPE_CFG_H */
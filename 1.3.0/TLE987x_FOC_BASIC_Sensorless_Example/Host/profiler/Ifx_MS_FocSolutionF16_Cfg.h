@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MS_FocSolutionF16_Cfg.h
+ * \brief Configuration overlay of the profiled host build (foc_stack_profiler): takes the project configuration and
+ * enables the execution time profiler with the timestamp of host_profiler.h.
+ */
+
+#ifndef HOST_PROFILER_IFX_MS_FOCSOLUTIONF16_CFG_H
+#define HOST_PROFILER_IFX_MS_FOCSOLUTIONF16_CFG_H
+
+#include_next "Ifx_MS_FocSolutionF16_Cfg.h"
+
+#undef IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER (0x1) /*decimal 1*/
+
+/* The host executes the fast loop in a few hundred instructions or ns, use a finer histogram than on the target */
+#undef IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT
+#define IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT (0x6) /*decimal 6*/
+
+#undef IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP
+#define IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP HostProfiler_timestamp
+
+#endif /* HOST_PROFILER_IFX_MS_FOCSOLUTIONF16_CFG_H */
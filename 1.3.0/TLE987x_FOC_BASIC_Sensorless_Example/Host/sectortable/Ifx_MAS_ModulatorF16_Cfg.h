@@ -0,0 +1,25 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MAS_ModulatorF16_Cfg.h
+ * \brief Configuration overlay of the host build with the sector table fast path of the modulator
+ * (foc_stack_sectortable): takes the project configuration and enables IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE.
+ */
+
+#ifndef HOST_SECTORTABLE_IFX_MAS_MODULATORF16_CFG_H
+#define HOST_SECTORTABLE_IFX_MAS_MODULATORF16_CFG_H
+
+#include_next "Ifx_MAS_ModulatorF16_Cfg.h"
+
+#undef IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE
+#define IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE (0x1) /*decimal 1*/
+
+#endif /* HOST_SECTORTABLE_IFX_MAS_MODULATORF16_CFG_H */
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MDA_FocControllerF16_Cfg.h
+ * \brief Configuration overlay of the host build with overmodulation (foc_stack_sixstep): takes the project
+ * configuration and raises IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15 to 99.5 % of six-step. Closer to
+ * six-step almost all measurement windows are too short and the current loop runs without feedback.
+ */
+
+#ifndef HOST_SIXSTEP_IFX_MDA_FOCCONTROLLERF16_CFG_H
+#define HOST_SIXSTEP_IFX_MDA_FOCCONTROLLERF16_CFG_H
+
+#include_next "Ifx_MDA_FocControllerF16_Cfg.h"
+
+#undef IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15
+#define IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15 (0x510E) /*decimal 20750*/
+
+#endif /* HOST_SIXSTEP_IFX_MDA_FOCCONTROLLERF16_CFG_H */
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench.c
+ * \brief Micro benchmark harness for the kernels of the math libraries on the host.
+ */
+
+#include <stdio.h>
+#include <time.h>
+#include "host_bench.h"
+#include "host_profiler.h"
+
+volatile sint32 HostBench_sink;
+
+uint64 HostBench_nowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64)ts.tv_sec * 1000000000ULL) + (uint64)ts.tv_nsec;
+}
+
+
+THostBench_Result HostBench_run(THostBench_Kernel kernel, uint32 calls)
+{
+    THostBench_Result result = {0.0, 0.0};
+    uint32            run;
+
+    /* Warm up caches and branch predictors */
+    kernel(calls / 16u);
+
+    for (run = 0; run < HOST_BENCH_RUNS; run++)
+    {
+        uint64  startNs    = HostBench_nowNs();
+        uint32  startUnits = HostProfiler_timestamp();
+        float64 units;
+        float64 ns;
+
+        kernel(calls);
+
+        units = (float64)(uint32)(HostProfiler_timestamp() - startUnits) / (float64)calls;
+        ns    = (float64)(HostBench_nowNs() - startNs) / (float64)calls;
+
+        if ((run == 0u) || (ns < result.nsPerCall))
+        {
+            result.nsPerCall    = ns;
+            result.unitsPerCall = units;
+        }
+    }
+
+    return result;
+}
+
+
+void HostBench_printHeader(void)
+{
+    (void)printf("%-32s %10s %14s\n", "kernel", "ns/call", HostProfiler_getUnit());
+}
+
+
+THostBench_Result HostBench_print(const char* name, THostBench_Kernel kernel, uint32 calls)
+{
+    THostBench_Result result = HostBench_run(kernel, calls);
+
+    (void)printf("%-32s %10.2f %14.2f\n", name, result.nsPerCall, result.unitsPerCall);
+
+    return result;
+}
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_atan2.c
+ * \brief Accuracy and cost of the arctangent of two arguments: division and lookup table
+ * (IFX_MATH_USROPT_ATAN2_MODE_LUT) for table sizes 2^8, 2^10 and 2^12 against Ifx_Math_Atan2Cordic_F16() with the
+ * iteration counts of IFX_MATH_ATAN2_CORDIC_ITERATIONS for these table sizes.
+ *
+ * Only the configured arctangent table is linked, the other sizes are evaluated with a model of the lookup table
+ * variant. The model is checked bit by bit against the linked table and, in mode IFX_MATH_USROPT_ATAN2_MODE_LUT,
+ * against Ifx_Math_Atan2_F16(). Errors are taken against atan2() over random vectors with a magnitude of at least
+ * HOST_BENCH_ATAN2_MIN_MAGNITUDE.
+ *
+ * Usage: foc_bench_atan2 [calls per run] [accuracy samples]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_Math_Atan.h"
+#include "Ifx_Math_Atan2.h"
+
+/* Smallest magnitude of the accuracy samples, smaller vectors are dominated by the Q15 quantization of the inputs */
+#define HOST_BENCH_ATAN2_MIN_MAGNITUDE (1024.0)
+
+/* Number of input vectors of the timing kernels */
+#define HOST_BENCH_ATAN2_VECTORS       (4096u)
+
+/* Largest modelled table size */
+#define HOST_BENCH_ATAN2_MAX_LUT_SIZE  (12u)
+
+/* Angle normalization of the library, 2^32 per revolution */
+#define HOST_BENCH_ATAN2_ANGLE_TO_RAD  (2.0 * 3.14159265358979323846 / 4294967296.0)
+
+/* Accuracy of one variant */
+typedef struct
+{
+    float64 angleMax_deg;     /* Largest angle error */
+    float64 angleRms_deg;     /* RMS angle error */
+    float64 magnitudeMax_lsb; /* Largest magnitude error, negative if the variant has no magnitude */
+} THostBenchAtan2_Accuracy;
+
+/* Modelled arctangent table of the size HostBenchAtan2_lutSize */
+static uint16 HostBenchAtan2_lut[(1u << HOST_BENCH_ATAN2_MAX_LUT_SIZE) + 1u];
+static uint8  HostBenchAtan2_lutSize;
+
+/* CORDIC iterations of the kernel */
+static uint8  HostBenchAtan2_iterations;
+
+/* Input vectors of the timing kernels */
+static Ifx_Math_Fract16 HostBenchAtan2_x[HOST_BENCH_ATAN2_VECTORS];
+static Ifx_Math_Fract16 HostBenchAtan2_y[HOST_BENCH_ATAN2_VECTORS];
+
+/* Fills the modelled table: atan(i / 2^size) normalized by 2*pi to 2^16 */
+static void HostBenchAtan2_buildLut(uint8 size)
+{
+    uint32 entries = 1u << size;
+    uint32 i;
+
+    for (i = 0; i <= entries; i++)
+    {
+        HostBenchAtan2_lut[i] = (uint16)lround(atan((float64)i / (float64)entries) / (2.0 * 3.14159265358979323846)
+                                               * 65536.0);
+    }
+
+    HostBenchAtan2_lutSize = size;
+}
+
+
+/* Ifx_Math_Atan_F16() on the modelled table */
+static uint32 HostBenchAtan2_atanModel(Ifx_Math_Fract16 x)
+{
+    sint32 input = (x < 0) ? -(sint32)x : (sint32)x;
+    uint8  shift = (uint8)(15u - HostBenchAtan2_lutSize);
+    uint32 value;
+
+    if (input > IFX_MATH_FRACT16_MAX)
+    {
+        input = IFX_MATH_FRACT16_MAX;
+    }
+
+    /* Rounding shift of Ifx_Math_ShRRnd_F16() */
+    input = (input + (1 << (shift - 1u))) >> shift;
+    value = ((uint32)HostBenchAtan2_lut[input]) << 16;
+
+    return (x < 0) ? ((2u * IFX_MATH_PI_INDEX) - value) : value;
+}
+
+
+/* Ifx_Math_Atan2_F16() of mode IFX_MATH_USROPT_ATAN2_MODE_LUT on the modelled table */
+static uint32 HostBenchAtan2_atan2Model(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x)
+{
+    sint32 tangent;
+    uint32 angle;
+
+    if (y < -x)
+    {
+        if (x > y)
+        {
+            angle   = IFX_MATH_PI_INDEX + IFX_MATH_PI_INDEX / 2;
+            tangent = -((sint32)x << 15) / y;
+        }
+        else
+        {
+            angle   = IFX_MATH_PI_INDEX;
+            tangent = ((sint32)y << 15) / x;
+        }
+    }
+    else
+    {
+        if (x < y)
+        {
+            angle   = IFX_MATH_PI_INDEX / 2;
+            tangent = -((sint32)x << 15) / y;
+        }
+        else
+        {
+            angle   = 0;
+            tangent = (x == 0) ? 0 : (((sint32)y << 15) / x);
+        }
+    }
+
+    if (tangent == (IFX_MATH_FRACT16_MAX + 1))
+    {
+        tangent = IFX_MATH_FRACT16_MAX;
+    }
+
+    return angle + HostBenchAtan2_atanModel((Ifx_Math_Fract16)tangent);
+}
+
+
+/* Returns a random vector with a magnitude between HOST_BENCH_ATAN2_MIN_MAGNITUDE and full scale */
+static void HostBenchAtan2_randomVector(Ifx_Math_Fract16* y, Ifx_Math_Fract16* x)
+{
+    float64 magnitude;
+
+    do
+    {
+        *x        = (Ifx_Math_Fract16)((rand() & 0xFFFF) - 0x8000);
+        *y        = (Ifx_Math_Fract16)((rand() & 0xFFFF) - 0x8000);
+        magnitude = hypot((float64)*x, (float64)*y);
+    } while ((magnitude < HOST_BENCH_ATAN2_MIN_MAGNITUDE) || (magnitude > (float64)IFX_MATH_FRACT16_MAX));
+}
+
+
+/* Angle error in degrees, wrapped to [-180, 180) */
+static float64 HostBenchAtan2_angleError(uint32 angle, Ifx_Math_Fract16 y, Ifx_Math_Fract16 x)
+{
+    float64 error = ((float64)angle * HOST_BENCH_ATAN2_ANGLE_TO_RAD) - atan2((float64)y, (float64)x);
+
+    error = remainder(error, 2.0 * 3.14159265358979323846);
+
+    return error * (180.0 / 3.14159265358979323846);
+}
+
+
+/* Accuracy of the lookup table model (iterations == 0) or of the CORDIC */
+static THostBenchAtan2_Accuracy HostBenchAtan2_accuracy(uint8 iterations, uint32 samples)
+{
+    THostBenchAtan2_Accuracy accuracy = {0.0, 0.0, (iterations > 0u) ? 0.0 : -1.0};
+    float64                  sumSq    = 0.0;
+    uint32                   sample;
+
+    srand(1u);
+
+    for (sample = 0; sample < samples; sample++)
+    {
+        Ifx_Math_Fract16 x;
+        Ifx_Math_Fract16 y;
+        uint32           angle;
+        float64          error;
+
+        HostBenchAtan2_randomVector(&y, &x);
+
+        if (iterations > 0u)
+        {
+            Ifx_Math_PolarFract16 polar = Ifx_Math_Atan2Cordic_F16(y, x, iterations);
+            float64               magnitudeError = fabs((float64)polar.amplitude - hypot((float64)x, (float64)y));
+
+            angle = polar.angle;
+
+            if (magnitudeError > accuracy.magnitudeMax_lsb)
+            {
+                accuracy.magnitudeMax_lsb = magnitudeError;
+            }
+        }
+        else
+        {
+            angle = HostBenchAtan2_atan2Model(y, x);
+        }
+
+        error  = fabs(HostBenchAtan2_angleError(angle, y, x));
+        sumSq += error * error;
+
+        if (error > accuracy.angleMax_deg)
+        {
+            accuracy.angleMax_deg = error;
+        }
+    }
+
+    accuracy.angleRms_deg = sqrt(sumSq / (float64)samples);
+
+    return accuracy;
+}
+
+
+/* Checks the model of the lookup table variant against the linked table and Ifx_Math_Atan2_F16() */
+static bool HostBenchAtan2_checkModel(void)
+{
+    bool   match = true;
+    uint32 i;
+
+    HostBenchAtan2_buildLut(IFX_MATH_CFG_ATAN_LUT_SIZE);
+
+    for (i = 0; i <= (1u << IFX_MATH_CFG_ATAN_LUT_SIZE); i++)
+    {
+        if (HostBenchAtan2_lut[i] != Ifx_Math_Lut_Atan_F16_table[i])
+        {
+            match = false;
+        }
+    }
+
+#if IFX_MATH_CFG_ATAN2_MODE == IFX_MATH_USROPT_ATAN2_MODE_LUT
+    {
+        sint32 x;
+        sint32 y;
+
+        for (y = -32768; y <= 32767; y += 7)
+        {
+            for (x = -32768; x <= 32767; x += 5)
+            {
+                if (HostBenchAtan2_atan2Model((Ifx_Math_Fract16)y, (Ifx_Math_Fract16)x)
+                    != Ifx_Math_Atan2_F16((Ifx_Math_Fract16)y, (Ifx_Math_Fract16)x))
+                {
+                    match = false;
+                }
+            }
+        }
+    }
+#endif
+
+    return match;
+}
+
+
+static void HostBenchAtan2_kernelAtan2(uint32 calls)
+{
+    uint32 sum = 0u;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        uint32 i = call & (HOST_BENCH_ATAN2_VECTORS - 1u);
+        sum += Ifx_Math_Atan2_F16(HostBenchAtan2_y[i], HostBenchAtan2_x[i]);
+    }
+
+    HostBench_sink = (sint32)sum;
+}
+
+
+static void HostBenchAtan2_kernelCordic(uint32 calls)
+{
+    uint32 sum = 0u;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        uint32                i     = call & (HOST_BENCH_ATAN2_VECTORS - 1u);
+        Ifx_Math_PolarFract16 polar = Ifx_Math_Atan2Cordic_F16(HostBenchAtan2_y[i], HostBenchAtan2_x[i],
+            HostBenchAtan2_iterations);
+        sum += polar.angle + (uint32)polar.amplitude;
+    }
+
+    HostBench_sink = (sint32)sum;
+}
+
+
+int main(int argc, char** argv)
+{
+    static const uint8 lutSizes[] = {8u, 10u, 12u};
+    uint32             calls      = (argc > 1) ? (uint32)atoi(argv[1]) : 2000000u;
+    uint32             samples    = (argc > 2) ? (uint32)atoi(argv[2]) : 1000000u;
+    uint32             i;
+
+    srand(2u);
+
+    for (i = 0; i < HOST_BENCH_ATAN2_VECTORS; i++)
+    {
+        HostBenchAtan2_randomVector(&HostBenchAtan2_y[i], &HostBenchAtan2_x[i]);
+    }
+
+    (void)printf("configured: IFX_MATH_CFG_ATAN2_MODE %d, IFX_MATH_CFG_ATAN_LUT_SIZE %d\n", IFX_MATH_CFG_ATAN2_MODE,
+        IFX_MATH_CFG_ATAN_LUT_SIZE);
+    (void)printf("lookup table model matches the library: %s\n\n", (HostBenchAtan2_checkModel() == true) ? "yes" : "NO");
+
+    /* Accuracy */
+    (void)printf("accuracy over %u random vectors, |v| >= %.0f LSB\n", (unsigned)samples,
+        HOST_BENCH_ATAN2_MIN_MAGNITUDE);
+    (void)printf("%-28s %14s %14s %16s\n", "variant", "max err [deg]", "rms err [deg]", "max |v| err [LSB]");
+
+    for (i = 0; i < (sizeof(lutSizes) / sizeof(lutSizes[0])); i++)
+    {
+        THostBenchAtan2_Accuracy lut;
+        THostBenchAtan2_Accuracy cordic;
+        uint8                    iterations = (uint8)(lutSizes[i] + 2u);
+        char                     name[32];
+
+        HostBenchAtan2_buildLut(lutSizes[i]);
+        lut    = HostBenchAtan2_accuracy(0u, samples);
+        cordic = HostBenchAtan2_accuracy(iterations, samples);
+
+        (void)snprintf(name, sizeof(name), "LUT 2^%u + division", (unsigned)lutSizes[i]);
+        (void)printf("%-28s %14.5f %14.5f %16s\n", name, lut.angleMax_deg, lut.angleRms_deg, "-");
+        (void)snprintf(name, sizeof(name), "CORDIC %u iterations", (unsigned)iterations);
+        (void)printf("%-28s %14.5f %14.5f %16.2f\n", name, cordic.angleMax_deg, cordic.angleRms_deg,
+            cordic.magnitudeMax_lsb);
+    }
+
+    /* Cost */
+    (void)printf("\n%u calls per run, best of %u runs\n", (unsigned)calls, (unsigned)HOST_BENCH_RUNS);
+    HostBench_printHeader();
+    (void)HostBench_print("Ifx_Math_Atan2_F16 (configured)", HostBenchAtan2_kernelAtan2, calls);
+
+    for (i = 0; i < (sizeof(lutSizes) / sizeof(lutSizes[0])); i++)
+    {
+        char name[32];
+
+        HostBenchAtan2_iterations = (uint8)(lutSizes[i] + 2u);
+        (void)snprintf(name, sizeof(name), "CORDIC %u iterations", (unsigned)HostBenchAtan2_iterations);
+        (void)HostBench_print(name, HostBenchAtan2_kernelCordic, calls);
+    }
+
+    return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_carttopolar.c
+ * \brief Accuracy and cost of Ifx_Math_CartToPolar_F16() against the previous implementation, which calculated the
+ * angle with Ifx_Math_Atan2_F16() and the amplitude from the saturated square of the vector with
+ * Ifx_Math_Interp1DLut_F16(), and against one Ifx_Math_Atan2Cordic_F16() pass.
+ *
+ * The amplitude error is taken against hypot() over random vectors of the full range and over vectors around the
+ * modulation limit 0.907 of the FOC controller (the inscribed circle of the hexagon of the space vector modulation,
+ * sqrt(3)/2 of full scale, plus margin), where the amplitude is used to limit the voltage vector.
+ *
+ * Usage: foc_bench_carttopolar [calls per run] [accuracy samples]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_Math_AddSat.h"
+#include "Ifx_Math_Atan2.h"
+#include "Ifx_Math_CartToPolar.h"
+#include "Ifx_Math_Interp1DLut.h"
+#include "Ifx_Math_MulShR.h"
+
+/* Number of input vectors of the timing kernels */
+#define HOST_BENCH_CARTTOPOLAR_VECTORS      (4096u)
+
+/* Range of the amplitude around the modulation limit, relative to full scale */
+#define HOST_BENCH_CARTTOPOLAR_LIMIT_MIN    (0.85)
+#define HOST_BENCH_CARTTOPOLAR_LIMIT_MAX    (0.95)
+
+/* Smallest amplitude of the full range samples in LSB */
+#define HOST_BENCH_CARTTOPOLAR_MIN_MAGNITUDE (64.0)
+
+/* Angle normalization of the library, 2^32 per revolution */
+#define HOST_BENCH_CARTTOPOLAR_ANGLE_TO_RAD (2.0 * 3.14159265358979323846 / 4294967296.0)
+
+/* Variant of the conversion */
+typedef Ifx_Math_PolarFract16 (*THostBenchCartToPolar_Function)(Ifx_Math_CmpFract16 cartesian);
+
+/* Accuracy of one variant */
+typedef struct
+{
+    float64 amplitudeMax_lsb; /* Largest amplitude error */
+    float64 amplitudeRms_lsb; /* RMS amplitude error */
+    float64 angleMax_deg;     /* Largest angle error */
+} THostBenchCartToPolar_Accuracy;
+
+/* Input vectors of the timing kernels */
+static Ifx_Math_CmpFract16 HostBenchCartToPolar_vectors[HOST_BENCH_CARTTOPOLAR_VECTORS];
+
+/* Previous implementation of Ifx_Math_CartToPolar_F16(), kept out of line as the library function */
+static __attribute__((noinline)) Ifx_Math_PolarFract16 HostBenchCartToPolar_previous(Ifx_Math_CmpFract16 cartesian)
+{
+    static const Ifx_Math_Interp1DLut_Type lut = {
+        .data = &Ifx_Math_Lut_CartToPolar_F16_table[0], .size = (((uint16)1 << IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE) + 1)
+    };
+    Ifx_Math_PolarFract16                  polar;
+    Ifx_Math_Fract16                       ampsq;
+
+    polar.angle     = Ifx_Math_Atan2_F16(cartesian.imag, cartesian.real);
+    ampsq           = Ifx_Math_AddSat_F16(Ifx_Math_MulShR_F16(cartesian.real, cartesian.real, 15u),
+        Ifx_Math_MulShR_F16(cartesian.imag, cartesian.imag, 15u));
+    polar.amplitude = Ifx_Math_Interp1DLut_F16(ampsq, lut, 15 - IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE);
+
+    return polar;
+}
+
+
+/* One CORDIC pass with the configured number of iterations */
+static __attribute__((noinline)) Ifx_Math_PolarFract16 HostBenchCartToPolar_cordic(Ifx_Math_CmpFract16 cartesian)
+{
+    return Ifx_Math_Atan2Cordic_F16(cartesian.imag, cartesian.real, IFX_MATH_ATAN2_CORDIC_ITERATIONS);
+}
+
+
+/* Returns a random vector with an amplitude between minimum and maximum in LSB */
+static Ifx_Math_CmpFract16 HostBenchCartToPolar_randomVector(float64 minimum, float64 maximum)
+{
+    Ifx_Math_CmpFract16 vector;
+    float64             magnitude;
+
+    do
+    {
+        vector.real = (Ifx_Math_Fract16)((rand() & 0xFFFF) - 0x8000);
+        vector.imag = (Ifx_Math_Fract16)((rand() & 0xFFFF) - 0x8000);
+        magnitude   = hypot((float64)vector.real, (float64)vector.imag);
+    } while ((magnitude < minimum) || (magnitude > maximum));
+
+    return vector;
+}
+
+
+/* Accuracy of a variant, amplitudes above full scale are compared with the saturated value */
+static THostBenchCartToPolar_Accuracy HostBenchCartToPolar_accuracy(THostBenchCartToPolar_Function function,
+                                                                    float64 minimum, float64 maximum, uint32 samples)
+{
+    THostBenchCartToPolar_Accuracy accuracy = {0.0, 0.0, 0.0};
+    float64                        sumSq    = 0.0;
+    uint32                         sample;
+
+    srand(1u);
+
+    for (sample = 0; sample < samples; sample++)
+    {
+        Ifx_Math_CmpFract16   vector    = HostBenchCartToPolar_randomVector(minimum, maximum);
+        Ifx_Math_PolarFract16 polar     = function(vector);
+        float64               magnitude = fmin(hypot((float64)vector.real, (float64)vector.imag),
+            (float64)IFX_MATH_FRACT16_MAX);
+        float64               error     = fabs((float64)polar.amplitude - magnitude);
+        float64               angle     = ((float64)polar.angle * HOST_BENCH_CARTTOPOLAR_ANGLE_TO_RAD)
+                                          - atan2((float64)vector.imag, (float64)vector.real);
+
+        sumSq += error * error;
+
+        if (error > accuracy.amplitudeMax_lsb)
+        {
+            accuracy.amplitudeMax_lsb = error;
+        }
+
+        angle = fabs(remainder(angle, 2.0 * 3.14159265358979323846)) * (180.0 / 3.14159265358979323846);
+
+        if (angle > accuracy.angleMax_deg)
+        {
+            accuracy.angleMax_deg = angle;
+        }
+    }
+
+    accuracy.amplitudeRms_lsb = sqrt(sumSq / (float64)samples);
+
+    return accuracy;
+}
+
+
+/* Checks the angle of Ifx_Math_CartToPolar_F16() bit by bit against Ifx_Math_Atan2_F16() on a grid */
+static bool HostBenchCartToPolar_checkAngle(void)
+{
+    bool   match = true;
+    sint32 x;
+    sint32 y;
+
+    for (y = -32768; y <= 32767; y += 7)
+    {
+        for (x = -32768; x <= 32767; x += 5)
+        {
+            Ifx_Math_CmpFract16 vector = {(Ifx_Math_Fract16)x, (Ifx_Math_Fract16)y};
+
+            if (Ifx_Math_CartToPolar_F16(vector).angle != Ifx_Math_Atan2_F16((Ifx_Math_Fract16)y, (Ifx_Math_Fract16)x))
+            {
+                match = false;
+            }
+        }
+    }
+
+    return match;
+}
+
+
+static void HostBenchCartToPolar_kernel(THostBenchCartToPolar_Function function, uint32 calls)
+{
+    uint32 sum = 0u;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_PolarFract16 polar = function(HostBenchCartToPolar_vectors[call & (HOST_BENCH_CARTTOPOLAR_VECTORS - 1u)]);
+        sum += polar.angle + (uint32)polar.amplitude;
+    }
+
+    HostBench_sink = (sint32)sum;
+}
+
+
+static void HostBenchCartToPolar_kernelLibrary(uint32 calls)
+{
+    HostBenchCartToPolar_kernel(Ifx_Math_CartToPolar_F16, calls);
+}
+
+
+static void HostBenchCartToPolar_kernelPrevious(uint32 calls)
+{
+    HostBenchCartToPolar_kernel(HostBenchCartToPolar_previous, calls);
+}
+
+
+static void HostBenchCartToPolar_kernelCordic(uint32 calls)
+{
+    HostBenchCartToPolar_kernel(HostBenchCartToPolar_cordic, calls);
+}
+
+
+/* Prints the accuracy of one variant in both ranges */
+static void HostBenchCartToPolar_printAccuracy(const char* name, THostBenchCartToPolar_Function function,
+                                               uint32 samples)
+{
+    THostBenchCartToPolar_Accuracy full  = HostBenchCartToPolar_accuracy(function,
+        HOST_BENCH_CARTTOPOLAR_MIN_MAGNITUDE, 32768.0, samples);
+    THostBenchCartToPolar_Accuracy limit = HostBenchCartToPolar_accuracy(function,
+        HOST_BENCH_CARTTOPOLAR_LIMIT_MIN * 32768.0, HOST_BENCH_CARTTOPOLAR_LIMIT_MAX * 32768.0, samples);
+
+    (void)printf("%-30s %9.2f %9.3f %9.2f %9.3f %11.5f\n", name, full.amplitudeMax_lsb, full.amplitudeRms_lsb,
+        limit.amplitudeMax_lsb, limit.amplitudeRms_lsb, full.angleMax_deg);
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32            calls   = (argc > 1) ? (uint32)atoi(argv[1]) : 2000000u;
+    uint32            samples = (argc > 2) ? (uint32)atoi(argv[2]) : 1000000u;
+    THostBench_Result library;
+    THostBench_Result previous;
+    uint32            i;
+
+    srand(2u);
+
+    for (i = 0; i < HOST_BENCH_CARTTOPOLAR_VECTORS; i++)
+    {
+        HostBenchCartToPolar_vectors[i] = HostBenchCartToPolar_randomVector(HOST_BENCH_CARTTOPOLAR_MIN_MAGNITUDE,
+            32768.0);
+    }
+
+    (void)printf("configured: IFX_MATH_CFG_ATAN2_MODE %d, IFX_MATH_CFG_ATAN_LUT_SIZE %d, "
+                 "IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE %d\n", IFX_MATH_CFG_ATAN2_MODE, IFX_MATH_CFG_ATAN_LUT_SIZE,
+        IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE);
+    (void)printf("angle matches Ifx_Math_Atan2_F16: %s\n\n", (HostBenchCartToPolar_checkAngle() == true) ? "yes" : "NO");
+
+    /* Accuracy */
+    (void)printf("accuracy over %u random vectors each: full range |v| >= %.0f LSB, limit %.2f..%.2f of full scale\n",
+        (unsigned)samples, HOST_BENCH_CARTTOPOLAR_MIN_MAGNITUDE, HOST_BENCH_CARTTOPOLAR_LIMIT_MIN,
+        HOST_BENCH_CARTTOPOLAR_LIMIT_MAX);
+    (void)printf("%-30s %9s %9s %9s %9s %11s\n", "variant", "full max", "full rms", "limit max", "limit rms",
+        "angle [deg]");
+    HostBenchCartToPolar_printAccuracy("Ifx_Math_CartToPolar_F16", Ifx_Math_CartToPolar_F16, samples);
+    HostBenchCartToPolar_printAccuracy("previous (Atan2 + |v|^2 LUT)", HostBenchCartToPolar_previous, samples);
+    HostBenchCartToPolar_printAccuracy("CORDIC", HostBenchCartToPolar_cordic, samples);
+
+    /* Cost */
+    (void)printf("\n%u calls per run, best of %u runs\n", (unsigned)calls, (unsigned)HOST_BENCH_RUNS);
+    HostBench_printHeader();
+    library  = HostBench_print("Ifx_Math_CartToPolar_F16", HostBenchCartToPolar_kernelLibrary, calls);
+    previous = HostBench_print("previous (Atan2 + |v|^2 LUT)", HostBenchCartToPolar_kernelPrevious, calls);
+    (void)HostBench_print("CORDIC", HostBenchCartToPolar_kernelCordic, calls);
+    (void)printf("\nIfx_Math_CartToPolar_F16 vs previous: %.1f %%\n",
+        ((library.nsPerCall / previous.nsPerCall) - 1.0) * 100.0);
+
+    return 0;
+}
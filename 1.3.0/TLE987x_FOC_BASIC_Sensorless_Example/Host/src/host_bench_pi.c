@@ -0,0 +1,371 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_pi.c
+ * \brief PI controller with constant Q formats (Ifx_Math_PiConstF16.h) against Ifx_Math_PiF16_execute().
+ *
+ * The speed, d current and q current PI controller are set up as in Ifx_MS_FocSolutionF16_initSpeedPi() and
+ * Ifx_MDA_FocControllerF16_init(). Each one is executed by Ifx_Math_PiF16_execute() and by the function which
+ * IFX_MATH_PICONSTF16_DEFINE() generates with the Q formats of the configuration, on two instances with the same
+ * random errors, anti-windup control inputs, gains, limits and integrator states. Output, integrator state and
+ * saturation status have to be the same after every call, and the shifts of IFX_MATH_PICONSTF16_DEFINE() the ones
+ * which Ifx_Math_PiF16_init() derives from the Q formats. Then the cost per call of both on the same inputs is
+ * printed.
+ *
+ * foc_bench_pi is built with the discretization and anti-windup method of the project configuration, the checks
+ * foc_check_pi_<disc><anti windup> with each one of IFX_MATH_CFG_PI_DISC and IFX_MATH_CFG_PI_ANTI_WIND, see
+ * foc_check_piconst. The exit code is 1 if the outputs differ.
+ *
+ * Usage: foc_bench_pi [calls per run, 0: check only]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_Math_PiConstF16.h"
+#include "Ifx_MDA_FocControllerF16_Cfg.h"
+#include "Ifx_MS_FocSolutionF16_Cfg.h"
+
+/* Number of random calls per check and calls between two random integrator states */
+#define HOST_BENCH_PI_CHECK_CALLS  (200000u)
+#define HOST_BENCH_PI_STATE_CALLS  (256u)
+
+/* Number of recorded inputs of the timing kernels */
+#define HOST_BENCH_PI_SAMPLES      (4096u)
+
+/* Q format of the errors of the three PI controllers */
+#define HOST_BENCH_PI_Q_FORMAT_ERROR Ifx_Math_FractQFormat_q14
+
+/* Speed, d current and q current PI controller with constant Q formats */
+IFX_MATH_PICONSTF16_DEFINE(HostBenchPi_executeSpeed, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_PROPGAIN_Q_FORMAT,
+    IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KI_TS_Q_FORMAT, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KAW_TS_Q_FORMAT,
+    HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_LIMIT_Q_FORMAT)
+IFX_MATH_PICONSTF16_DEFINE(HostBenchPi_executeCurrentD, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_PROPGAIN_Q_FORMAT,
+    IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KI_TS_Q_FORMAT, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q_FORMAT,
+    HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_LIMIT_Q_FORMAT)
+IFX_MATH_PICONSTF16_DEFINE(HostBenchPi_executeCurrentQ, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_PROPGAIN_Q_FORMAT,
+    IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KI_TS_Q_FORMAT, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KAW_TS_Q_FORMAT,
+    HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_LIMIT_Q_FORMAT)
+
+/* Execute function with the signature of Ifx_Math_PiF16_execute() */
+typedef Ifx_Math_Fract16 (*THostBenchPi_Execute)(Ifx_Math_PiF16* self, Ifx_Math_Fract16 errorValue, sint8
+                                                 antiWindupCtrl);
+
+/* Configuration of one PI controller */
+typedef struct
+{
+    const char*             name;
+    THostBenchPi_Execute    executeConst;
+    Ifx_Math_PiF16_Qformats qformats;
+    Ifx_Math_Fract16        propGain;
+    Ifx_Math_Fract16        integGainSamplingTime;
+    Ifx_Math_Fract16        antiWindupGainSamplingTime;
+    Ifx_Math_Fract16        upperLimit;
+    Ifx_Math_Fract16        lowerLimit;
+} THostBenchPi_Controller;
+
+/* Inputs of one call */
+typedef struct
+{
+    Ifx_Math_Fract16 error;
+    sint8            antiWindupCtrl;
+} THostBenchPi_Input;
+
+static const THostBenchPi_Controller HostBenchPi_controllers[] = {
+    {"speed", HostBenchPi_executeSpeed,
+     {.qFormatAntiWindupGainSamplingTime = (Ifx_Math_FractQFormat)IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KAW_TS_Q_FORMAT,
+      .qFormatPropGain                   = (Ifx_Math_FractQFormat)IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_PROPGAIN_Q_FORMAT,
+      .qFormatIntegGainSamplingTime      = (Ifx_Math_FractQFormat)IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KI_TS_Q_FORMAT,
+      .qFormatOutput                     = (Ifx_Math_FractQFormat)IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_LIMIT_Q_FORMAT,
+      .qFormatError                      = HOST_BENCH_PI_Q_FORMAT_ERROR},
+     IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_PROPGAIN_Q, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KI_TS_Q,
+     IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KAW_TS_Q, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_OUT_UPP_LIMIT_Q,
+     IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_OUT_LOW_LIMIT_Q},
+    {"d current", HostBenchPi_executeCurrentD,
+     {.qFormatAntiWindupGainSamplingTime = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q_FORMAT,
+      .qFormatPropGain                   = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_PROPGAIN_Q_FORMAT,
+      .qFormatIntegGainSamplingTime      = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KI_TS_Q_FORMAT,
+      .qFormatOutput                     = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_LIMIT_Q_FORMAT,
+      .qFormatError                      = HOST_BENCH_PI_Q_FORMAT_ERROR},
+     IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_PROPGAIN_Q, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KI_TS_Q,
+     IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_OUT_UPP_LIMIT_Q,
+     IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_OUT_LOW_LIMIT_Q},
+    {"q current", HostBenchPi_executeCurrentQ,
+     {.qFormatAntiWindupGainSamplingTime = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KAW_TS_Q_FORMAT,
+      .qFormatPropGain                   = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_PROPGAIN_Q_FORMAT,
+      .qFormatIntegGainSamplingTime      = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KI_TS_Q_FORMAT,
+      .qFormatOutput                     = (Ifx_Math_FractQFormat)IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_LIMIT_Q_FORMAT,
+      .qFormatError                      = HOST_BENCH_PI_Q_FORMAT_ERROR},
+     IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_PROPGAIN_Q, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KI_TS_Q,
+     IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KAW_TS_Q, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_OUT_UPP_LIMIT_Q,
+     IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_OUT_LOW_LIMIT_Q},
+};
+
+#define HOST_BENCH_PI_CONTROLLERS (sizeof(HostBenchPi_controllers) / sizeof(HostBenchPi_controllers[0]))
+
+/* Recorded inputs and the instance and the function under test of the timing kernels */
+static THostBenchPi_Input   HostBenchPi_inputs[HOST_BENCH_PI_SAMPLES];
+static Ifx_Math_PiF16       HostBenchPi_pi;
+static THostBenchPi_Execute HostBenchPi_executeConst;
+
+/* Random number in [min, max] */
+static sint32 HostBenchPi_random(sint32 min, sint32 max)
+{
+    return min + (sint32)((uint32)rand() % (uint32)((max - min) + 1));
+}
+
+
+/* Random error: mostly small, as in closed loop, else over the full range */
+static Ifx_Math_Fract16 HostBenchPi_randomError(void)
+{
+    return (Ifx_Math_Fract16)(((rand() % 4) == 0) ? HostBenchPi_random(-32768, 32767) :
+                              HostBenchPi_random(-1024, 1024));
+}
+
+
+static void HostBenchPi_init(Ifx_Math_PiF16* pi, const THostBenchPi_Controller* controller)
+{
+    Ifx_Math_PiF16_init(pi, controller->qformats);
+    Ifx_Math_PiF16_setPropGain(pi, controller->propGain);
+    Ifx_Math_PiF16_setIntegGainSamplingTime(pi, controller->integGainSamplingTime);
+    Ifx_Math_PiF16_setAntiWindupGainSamplingTime(pi, controller->antiWindupGainSamplingTime);
+    Ifx_Math_PiF16_setUpperLimit(pi, controller->upperLimit);
+    Ifx_Math_PiF16_setLowerLimit(pi, controller->lowerLimit);
+}
+
+
+/* Compares both execute functions of one PI controller, returns the number of differing calls */
+static uint32 HostBenchPi_check(const THostBenchPi_Controller* controller)
+{
+    Ifx_Math_PiF16 generic;
+    Ifx_Math_PiF16 specialized;
+    uint32         mismatches = 0u;
+    uint32         call;
+
+    HostBenchPi_init(&generic, controller);
+    HostBenchPi_init(&specialized, controller);
+
+    for (call = 0u; call < HOST_BENCH_PI_CHECK_CALLS; call++)
+    {
+        Ifx_Math_Fract16 error          = HostBenchPi_randomError();
+        sint8            antiWindupCtrl = (sint8)HostBenchPi_random(-1, 1);
+        Ifx_Math_Fract16 outGeneric;
+        Ifx_Math_Fract16 outSpecialized;
+
+        /* The configured gains and limits first, then random ones from a random integrator state on */
+        if ((call >= (HOST_BENCH_PI_CHECK_CALLS / 2u)) && ((call % HOST_BENCH_PI_STATE_CALLS) == 0u))
+        {
+            Ifx_Math_Fract16 upperLimit = (Ifx_Math_Fract16)HostBenchPi_random(0, 32767);
+            Ifx_Math_Fract16 lowerLimit = (Ifx_Math_Fract16)HostBenchPi_random(-32768, 0);
+            Ifx_Math_Fract16 state      = (Ifx_Math_Fract16)HostBenchPi_random(lowerLimit, upperLimit);
+            Ifx_Math_PiF16*  pis[2]     = {&generic, &specialized};
+            Ifx_Math_Fract16 gains[3];
+            uint32           index;
+
+            gains[0] = (Ifx_Math_Fract16)HostBenchPi_random(0, 32767);
+            gains[1] = (Ifx_Math_Fract16)HostBenchPi_random(0, 4096);
+            gains[2] = (Ifx_Math_Fract16)HostBenchPi_random(0, 32767);
+
+            for (index = 0u; index < 2u; index++)
+            {
+                Ifx_Math_PiF16_setPropGain(pis[index], gains[0]);
+                Ifx_Math_PiF16_setIntegGainSamplingTime(pis[index], gains[1]);
+                Ifx_Math_PiF16_setAntiWindupGainSamplingTime(pis[index], gains[2]);
+                Ifx_Math_PiF16_setUpperLimit(pis[index], upperLimit);
+                Ifx_Math_PiF16_setLowerLimit(pis[index], lowerLimit);
+                Ifx_Math_PiF16_setIntegPreviousValue(pis[index], state);
+            }
+        }
+        else if ((call % HOST_BENCH_PI_STATE_CALLS) == 0u)
+        {
+            /* Keeps the integrator without anti-windup within its range */
+            Ifx_Math_Fract16 state = (Ifx_Math_Fract16)HostBenchPi_random(controller->lowerLimit,
+                controller->upperLimit);
+            Ifx_Math_PiF16_setIntegPreviousValue(&generic, state);
+            Ifx_Math_PiF16_setIntegPreviousValue(&specialized, state);
+        }
+        else
+        {
+            /* Same parameters and state */
+        }
+
+        outGeneric     = Ifx_Math_PiF16_execute(&generic, error, antiWindupCtrl);
+        outSpecialized = controller->executeConst(&specialized, error, antiWindupCtrl);
+
+        if ((outGeneric != outSpecialized) || (generic.p_integPreviousValue != specialized.p_integPreviousValue)
+            || (generic.p_saturationStatus != specialized.p_saturationStatus))
+        {
+            if (mismatches == 0u)
+            {
+                (void)printf("%s: call %u, error %d, anti-windup %d: output %d / %d, state %d / %d\n",
+                    controller->name, (unsigned)call, (int)error, (int)antiWindupCtrl, (int)outGeneric,
+                    (int)outSpecialized, (int)generic.p_integPreviousValue, (int)specialized.p_integPreviousValue);
+            }
+
+            mismatches++;
+            specialized = generic;
+        }
+    }
+
+    return mismatches;
+}
+
+
+/* Compares the shifts of the generated function with those of Ifx_Math_PiF16_init() */
+static uint32 HostBenchPi_checkShifts(void)
+{
+    static const uint8 shifts[HOST_BENCH_PI_CONTROLLERS][3] = {
+        {(uint8)IFX_MATH_PICONSTF16_SHIFT(IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_PROPGAIN_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_LIMIT_Q_FORMAT),
+         (uint8)(IFX_MATH_PICONSTF16_SHIFT(IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KI_TS_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_LIMIT_Q_FORMAT) +
+                 IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER),
+         (uint8)(IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KAW_TS_Q_FORMAT + IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER)},
+        {(uint8)IFX_MATH_PICONSTF16_SHIFT(IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_PROPGAIN_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_LIMIT_Q_FORMAT),
+         (uint8)(IFX_MATH_PICONSTF16_SHIFT(IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KI_TS_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_LIMIT_Q_FORMAT) +
+                 IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER),
+         (uint8)(IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q_FORMAT + IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER)},
+        {(uint8)IFX_MATH_PICONSTF16_SHIFT(IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_PROPGAIN_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_LIMIT_Q_FORMAT),
+         (uint8)(IFX_MATH_PICONSTF16_SHIFT(IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KI_TS_Q_FORMAT,
+             HOST_BENCH_PI_Q_FORMAT_ERROR, IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_LIMIT_Q_FORMAT) +
+                 IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER),
+         (uint8)(IFX_MDA_FOCCONTROLLERF16_CFG_IQ_PI_KAW_TS_Q_FORMAT + IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER)},
+    };
+    uint32 mismatches = 0u;
+    uint32 index;
+
+    for (index = 0u; index < HOST_BENCH_PI_CONTROLLERS; index++)
+    {
+        Ifx_Math_PiF16 pi;
+
+        HostBenchPi_init(&pi, &HostBenchPi_controllers[index]);
+
+        if ((pi.p_qFormatPropGain != shifts[index][0]) || (pi.p_qFormatIntegGain != shifts[index][1])
+            || (pi.p_qFormatAntiWindupGain != shifts[index][2]))
+        {
+            (void)printf("%s: shifts %u %u %u, Ifx_Math_PiF16_init() %u %u %u\n", HostBenchPi_controllers[index].name,
+                (unsigned)shifts[index][0], (unsigned)shifts[index][1], (unsigned)shifts[index][2],
+                (unsigned)pi.p_qFormatPropGain, (unsigned)pi.p_qFormatIntegGain,
+                (unsigned)pi.p_qFormatAntiWindupGain);
+            mismatches++;
+        }
+    }
+
+    return mismatches;
+}
+
+
+static void HostBenchPi_kernelGeneric(uint32 calls)
+{
+    Ifx_Math_Fract16 out = 0;
+    uint32           call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        const THostBenchPi_Input* input = &HostBenchPi_inputs[call % HOST_BENCH_PI_SAMPLES];
+        out ^= Ifx_Math_PiF16_execute(&HostBenchPi_pi, input->error, input->antiWindupCtrl);
+    }
+
+    HostBench_sink = (sint32)out;
+}
+
+
+/* One kernel per PI controller, so that the generated function is inlined as in the FOC */
+#define HOST_BENCH_PI_KERNEL(name, execute)                                                      \
+    static void name(uint32 calls)                                                               \
+    {                                                                                            \
+        Ifx_Math_Fract16 out = 0;                                                                \
+        uint32           call;                                                                   \
+        for (call = 0u; call < calls; call++)                                                    \
+        {                                                                                        \
+            const THostBenchPi_Input* input = &HostBenchPi_inputs[call % HOST_BENCH_PI_SAMPLES]; \
+            out ^= execute(&HostBenchPi_pi, input->error, input->antiWindupCtrl);                \
+        }                                                                                        \
+        HostBench_sink = (sint32)out;                                                            \
+    }
+
+HOST_BENCH_PI_KERNEL(HostBenchPi_kernelSpeed, HostBenchPi_executeSpeed)
+HOST_BENCH_PI_KERNEL(HostBenchPi_kernelCurrentD, HostBenchPi_executeCurrentD)
+HOST_BENCH_PI_KERNEL(HostBenchPi_kernelCurrentQ, HostBenchPi_executeCurrentQ)
+
+/* Through the function pointer, i.e. the call overhead of Ifx_Math_PiF16_execute() with constant shifts */
+static void HostBenchPi_kernelCall(uint32 calls)
+{
+    Ifx_Math_Fract16 out = 0;
+    uint32           call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        const THostBenchPi_Input* input = &HostBenchPi_inputs[call % HOST_BENCH_PI_SAMPLES];
+        out ^= HostBenchPi_executeConst(&HostBenchPi_pi, input->error, input->antiWindupCtrl);
+    }
+
+    HostBench_sink = (sint32)out;
+}
+
+
+int main(int argc, char** argv)
+{
+    static const THostBench_Kernel kernels[HOST_BENCH_PI_CONTROLLERS] = {
+        HostBenchPi_kernelSpeed, HostBenchPi_kernelCurrentD, HostBenchPi_kernelCurrentQ
+    };
+    uint32 calls      = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 10) : 10000000u;
+    uint32 mismatches = HostBenchPi_checkShifts();
+    uint32 index;
+
+    srand(1u);
+
+    for (index = 0u; index < HOST_BENCH_PI_CONTROLLERS; index++)
+    {
+        uint32 differing = HostBenchPi_check(&HostBenchPi_controllers[index]);
+
+        (void)printf("PI_DISC %d, PI_ANTI_WIND %d, %-9s: %u of %u calls differ\n", (int)IFX_MATH_CFG_PI_DISC,
+            (int)IFX_MATH_CFG_PI_ANTI_WIND, HostBenchPi_controllers[index].name, (unsigned)differing,
+            (unsigned)HOST_BENCH_PI_CHECK_CALLS);
+        mismatches += differing;
+    }
+
+    if ((mismatches == 0u) && (calls > 0u))
+    {
+        for (index = 0u; index < HOST_BENCH_PI_SAMPLES; index++)
+        {
+            /* Errors of a settled loop, without saturation */
+            HostBenchPi_inputs[index].error          = (Ifx_Math_Fract16)HostBenchPi_random(-64, 64);
+            HostBenchPi_inputs[index].antiWindupCtrl = 0;
+        }
+
+        (void)printf("\n%u calls per run, best of %u runs\n\n", (unsigned)calls, (unsigned)HOST_BENCH_RUNS);
+        HostBench_printHeader();
+
+        for (index = 0u; index < HOST_BENCH_PI_CONTROLLERS; index++)
+        {
+            char name[48];
+
+            HostBenchPi_init(&HostBenchPi_pi, &HostBenchPi_controllers[index]);
+            (void)snprintf(name, sizeof(name), "%s, generic", HostBenchPi_controllers[index].name);
+            (void)HostBench_print(name, HostBenchPi_kernelGeneric, calls);
+
+            HostBenchPi_init(&HostBenchPi_pi, &HostBenchPi_controllers[index]);
+            HostBenchPi_executeConst = HostBenchPi_controllers[index].executeConst;
+            (void)snprintf(name, sizeof(name), "%s, constant, called", HostBenchPi_controllers[index].name);
+            (void)HostBench_print(name, HostBenchPi_kernelCall, calls);
+
+            HostBenchPi_init(&HostBenchPi_pi, &HostBenchPi_controllers[index]);
+            (void)snprintf(name, sizeof(name), "%s, constant, inline", HostBenchPi_controllers[index].name);
+            (void)HostBench_print(name, kernels[index], calls);
+        }
+    }
+
+    return (mismatches == 0u) ? 0 : 1;
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_pll.c
+ * \brief Tracking error and cost of the PLL of the Flux Estimator under the speed ramps of the FOC solution.
+ *
+ * The PLL is set up as in Ifx_MDA_FluxEstimatorF16_init(), with the gains and the sampling time of
+ * Ifx_MDA_FluxEstimatorF16_Cfg.h, and is fed with the exact rotor angle of a speed profile: a constant speed, a ramp
+ * with one of the ramp rates of Ifx_MS_FocSolutionF16_Cfg.h and a constant speed again. The ramp rate is a speed step
+ * per execution of the state machine, i.e. per fast loop, which is also the sampling time of the PLL. Gaussian noise
+ * of a given RMS value can be added to the input angle.
+ *
+ * Per ramp the angle error of the PLL against the input (mean and largest absolute value over the second half of the
+ * ramp, largest absolute value after the end of the ramp) and the RMS error of the angle variation, in rpm, over the
+ * second half of the ramp are printed. The type of the PLL is the one of IFX_MATH_CFG_PLL_TYPE, foc_bench_pll is built
+ * with the project configuration and foc_bench_pll_pi with IFX_MATH_USROPT_PLL_TYPE_PI.
+ *
+ * Usage: foc_bench_pll [calls per run] [input noise, deg rms]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_MDA_FluxEstimatorF16.h"
+#include "Ifx_MS_FocSolutionF16_Cfg.h"
+
+/* Constant speed before and after the ramp */
+#define HOST_BENCH_PLL_HOLD_S     (0.3)
+
+/* Number of recorded inputs of the timing kernel */
+#define HOST_BENCH_PLL_SAMPLES    (4096u)
+
+/* Sampling time of the PLL, in seconds */
+#define HOST_BENCH_PLL_TS_S       ((float64)IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US * 1.0e-6)
+
+/* Angle normalization of the library, 2^32 per revolution */
+#define HOST_BENCH_PLL_ANGLE_SCALE (4294967296.0)
+
+#define HOST_BENCH_PLL_PI         (3.14159265358979323846)
+
+/* Mechanical speed in rpm of a normalized speed in Q15 */
+#define HOST_BENCH_PLL_RPM(speedQ15) \
+    (((float64)(speedQ15) * (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_MECH_SPEED_RPM) / 32768.0)
+
+/* Speed profile of one run, speeds in Q15 and the ramp rate in Q30 per fast loop as in the Config Wizard */
+typedef struct
+{
+    const char* name;
+    float64     fromQ15;
+    float64     toQ15;
+    float64     rateQ30;
+} THostBenchPll_Ramp;
+
+/* Errors of one run */
+typedef struct
+{
+    float64 rampMean_deg;    /* Mean angle error over the second half of the ramp */
+    float64 rampMax_deg;     /* Largest absolute angle error over the second half of the ramp */
+    float64 holdMax_deg;     /* Largest absolute angle error after the end of the ramp */
+    float64 speedRms_rpm;    /* RMS error of the angle variation over the second half of the ramp */
+    float64 acceleration;    /* Electrical acceleration of the ramp, in rad/s^2 */
+} THostBenchPll_Result;
+
+/* Recorded inputs of the timing kernel */
+static uint32          HostBenchPll_inputs[HOST_BENCH_PLL_SAMPLES];
+static uint32          HostBenchPll_recorded;
+
+/* Instance of the timing kernel */
+static Ifx_Math_PLLF16 HostBenchPll_pll;
+
+/* Standard normal random number, Box-Muller */
+static float64 HostBenchPll_gauss(void)
+{
+    float64 u1 = ((float64)rand() + 1.0) / ((float64)RAND_MAX + 2.0);
+    float64 u2 = ((float64)rand() + 1.0) / ((float64)RAND_MAX + 2.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * HOST_BENCH_PLL_PI * u2);
+}
+
+
+/* Sets the PLL up as Ifx_MDA_FluxEstimatorF16_init() */
+static void HostBenchPll_init(Ifx_Math_PLLF16* pll)
+{
+    Ifx_Math_Fract16Q gain;
+
+    Ifx_Math_PLLF16_init(pll);
+    gain.value   = IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q;
+    gain.qFormat = (Ifx_Math_FractQFormat)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q_FORMAT;
+    Ifx_Math_PLLF16_setPropGain(pll, gain);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    gain.value   = IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q;
+    gain.qFormat = (Ifx_Math_FractQFormat)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q_FORMAT;
+    Ifx_Math_PLLF16_setIntegGain(pll, gain);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+    Ifx_Math_PLLF16_setSamplingTime_us(pll, IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US);
+}
+
+
+/* Runs one speed profile, records the inputs of the ramp if asked */
+static void HostBenchPll_run(THostBenchPll_Result* result, const THostBenchPll_Ramp* ramp, float64 noise_deg,
+                             bool record)
+{
+    Ifx_Math_PLLF16 pll;
+    float64         stepQ15     = ramp->rateQ30 / 32768.0;
+    uint32          holdSamples = (uint32)(HOST_BENCH_PLL_HOLD_S / HOST_BENCH_PLL_TS_S);
+    uint32          rampSamples = (uint32)ceil(fabs(ramp->toQ15 - ramp->fromQ15) / stepQ15);
+    uint32          samples     = holdSamples + rampSamples + holdSamples;
+    float64         radPerQ15   = (float64)IFX_MDA_FLUXESTIMATORF16_CFG_BASE_ELEC_SPEED_RADPS / 32768.0;
+    float64         speedQ15    = ramp->fromQ15;
+    float64         angle_rad   = 0.0;
+    float64         rampSum_deg = 0.0;
+    float64         speedSumSq  = 0.0;
+    uint32          rampCount   = 0u;
+    uint32          k;
+
+    result->rampMax_deg  = 0.0;
+    result->holdMax_deg  = 0.0;
+    result->acceleration = (stepQ15 * radPerQ15) / HOST_BENCH_PLL_TS_S;
+
+    HostBenchPll_init(&pll);
+
+    for (k = 0u; k < samples; k++)
+    {
+        float64              measured_rad = angle_rad + (noise_deg * HostBenchPll_gauss() * (HOST_BENCH_PLL_PI / 180.0));
+        uint32               input        = (uint32)(sint64)llround(fmod(measured_rad, 2.0 * HOST_BENCH_PLL_PI) *
+                                                                    (HOST_BENCH_PLL_ANGLE_SCALE /
+                                                                     (2.0 * HOST_BENCH_PLL_PI)));
+        uint32               exact        = (uint32)(sint64)llround(fmod(angle_rad, 2.0 * HOST_BENCH_PLL_PI) *
+                                                                    (HOST_BENCH_PLL_ANGLE_SCALE /
+                                                                     (2.0 * HOST_BENCH_PLL_PI)));
+        Ifx_Math_PLLF16_Type output       = Ifx_Math_PLLF16_execute(&pll, input);
+        float64              error_deg    = (float64)(sint32)(output.angle - exact) * (360.0 /
+                                                                                       HOST_BENCH_PLL_ANGLE_SCALE);
+
+        /* Angle variation of the PLL in Q15 of pi per sampling time, as speed in Q15 */
+        float64              estimateQ15  = ((float64)output.deltaAngle * (HOST_BENCH_PLL_PI / 32768.0)) /
+                                            (radPerQ15 * HOST_BENCH_PLL_TS_S);
+
+        if ((k >= (holdSamples + (rampSamples / 2u))) && (k < (holdSamples + rampSamples)))
+        {
+            float64 speedError = HOST_BENCH_PLL_RPM(estimateQ15 - speedQ15);
+
+            rampSum_deg         += error_deg;
+            result->rampMax_deg  = fmax(result->rampMax_deg, fabs(error_deg));
+            speedSumSq          += speedError * speedError;
+            rampCount++;
+        }
+        else if (k >= (holdSamples + rampSamples))
+        {
+            result->holdMax_deg = fmax(result->holdMax_deg, fabs(error_deg));
+        }
+
+        if ((record == true) && (k >= holdSamples) && (HostBenchPll_recorded < HOST_BENCH_PLL_SAMPLES))
+        {
+            HostBenchPll_inputs[HostBenchPll_recorded] = input;
+            HostBenchPll_recorded++;
+        }
+
+        /* Rotor angle of the next sample, then the speed step of the state machine */
+        angle_rad = fmod(angle_rad + (speedQ15 * radPerQ15 * HOST_BENCH_PLL_TS_S), 2.0 * HOST_BENCH_PLL_PI);
+
+        if (angle_rad < 0.0)
+        {
+            angle_rad += 2.0 * HOST_BENCH_PLL_PI;
+        }
+
+        if ((k >= holdSamples) && (k < (holdSamples + rampSamples)))
+        {
+            speedQ15 = (ramp->toQ15 > ramp->fromQ15) ? fmin(speedQ15 + stepQ15, ramp->toQ15) :
+                       fmax(speedQ15 - stepQ15, ramp->toQ15);
+        }
+    }
+
+    result->rampMean_deg = (rampCount > 0u) ? (rampSum_deg / (float64)rampCount) : 0.0;
+    result->speedRms_rpm = (rampCount > 0u) ? sqrt(speedSumSq / (float64)rampCount) : 0.0;
+}
+
+
+/* PLL on the recorded inputs */
+static void HostBenchPll_kernel(uint32 calls)
+{
+    Ifx_Math_PLLF16_Type output = {0};
+    uint32               call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        output = Ifx_Math_PLLF16_execute(&HostBenchPll_pll, HostBenchPll_inputs[call % HOST_BENCH_PLL_SAMPLES]);
+    }
+
+    HostBench_sink = (sint32)output.angle;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32                     calls     = (argc > 1) ? (uint32)atoi(argv[1]) : 1000000u;
+    float64                    noise_deg = (argc > 2) ? atof(argv[2]) : 0.0;
+    const float64              upRate    = (float64)IFX_MS_FOCSOLUTIONF16_CFG_CLOSED_LOOP_RAMP_UP_RATE_Q30;
+    const THostBenchPll_Ramp   ramps[]   = {
+        {"closed loop up",       IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_MAXIMUM_SPEED_Q15, IFX_MS_FOCSOLUTIONF16_CFG_CLOSED_LOOP_RAMP_UP_RATE_Q30},
+        {"closed loop down",     IFX_MS_FOCSOLUTIONF16_CFG_MAXIMUM_SPEED_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_DOWN_Q15, IFX_MS_FOCSOLUTIONF16_CFG_CLOSED_LOOP_RAMP_DOWN_RATE_Q30},
+        {"open loop up",         0.0, IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_OPEN_LOOP_RAMP_UP_RATE_Q30},
+        {"open loop down",       IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_DOWN_Q15, 0.0,
+         IFX_MS_FOCSOLUTIONF16_CFG_OPEN_LOOP_RAMP_DOWN_RATE_Q30},
+        {"closed loop up x2",    IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_MAXIMUM_SPEED_Q15, 2.0 * upRate},
+        {"closed loop up x4",    IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_MAXIMUM_SPEED_Q15, 4.0 * upRate},
+        {"closed loop up x8",    IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15,
+         IFX_MS_FOCSOLUTIONF16_CFG_MAXIMUM_SPEED_Q15, 8.0 * upRate},
+    };
+    THostBenchPll_Result       result;
+    uint32                     index;
+
+    srand(1u);
+
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+    (void)printf("PLL type            : IFX_MATH_USROPT_PLL_TYPE_PI, Ki %.0f 1/s^2\n",
+        (float64)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q /
+        (float64)(1u << IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q_FORMAT));
+#else
+    (void)printf("PLL type            : IFX_MATH_USROPT_PLL_TYPE_FEED_FORWARD\n");
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+    (void)printf("PLL                 : Kp %.0f 1/s, delay length %d, sampling time %u us, input noise %.2f deg rms\n",
+        (float64)IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q / (float64)(1u << IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q_FORMAT),
+        IFX_MATH_CFG_PLL_DELAY_LENGTH, (unsigned)IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US, noise_deg);
+    (void)printf("errors              : angle [deg] and angle variation [rpm] against the input, second half of the "
+                 "ramp and after it\n\n");
+    (void)printf("%-20s %9s %9s %12s %10s %10s %10s\n", "ramp", "from rpm", "to rpm", "accel rad/s2", "mean deg",
+        "max deg", "after deg");
+
+    for (index = 0u; index < (uint32)(sizeof(ramps) / sizeof(ramps[0])); index++)
+    {
+        HostBenchPll_run(&result, &ramps[index], noise_deg, (index == 0u));
+        (void)printf("%-20s %9.0f %9.0f %12.0f %10.3f %10.3f %10.3f   speed rms %7.2f rpm\n", ramps[index].name,
+            HOST_BENCH_PLL_RPM(ramps[index].fromQ15), HOST_BENCH_PLL_RPM(ramps[index].toQ15), result.acceleration,
+            result.rampMean_deg, result.rampMax_deg, result.holdMax_deg, result.speedRms_rpm);
+    }
+
+    /* Cost per call on the inputs of the first ramp */
+    HostBenchPll_init(&HostBenchPll_pll);
+
+    (void)printf("\n");
+    HostBench_printHeader();
+    (void)HostBench_print("Ifx_Math_PLLF16_execute", HostBenchPll_kernel, calls);
+
+    return 0;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_sincos.c
+ * \brief Compares the fused Ifx_Math_SinCos_F16() with two separate Ifx_Math_Sin_F16() / Ifx_Math_Cos_F16()
+ * lookups, standalone and inside Park, inverse Park and polar to cartesian transformation.
+ *
+ * The separate lookups are the implementations of Math-BAS 1.3.0. With a non-zero second argument all 2^32 angles are
+ * checked against them.
+ *
+ * Usage: foc_bench_sincos [calls per run] [exhaustive check]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_Math_InvPark.h"
+#include "Ifx_Math_MulSat.h"
+#include "Ifx_Math_AddSat.h"
+#include "Ifx_Math_SubSat.h"
+#include "Ifx_Math_Park.h"
+#include "Ifx_Math_PolarToCart.h"
+#include "Ifx_Math_SinCos.h"
+
+/* Angle increment between two calls, odd so that all table indices are hit */
+#define HOST_BENCH_SINCOS_ANGLE_STEP (0x9E3779B9u)
+
+/* Operand of the transformations, derived from the angle so that the compiler cannot specialize the callee */
+static inline Ifx_Math_CmpFract16 HostBenchSinCos_vector(uint32 angle)
+{
+    Ifx_Math_CmpFract16 vector;
+    vector.real = (Ifx_Math_Fract16)(angle >> 16);
+    vector.imag = (Ifx_Math_Fract16)angle;
+
+    return vector;
+}
+
+
+/* Two lookups, as Ifx_Math_SinCos_F16() of Math-BAS 1.3.0 */
+static inline Ifx_Math_SinCos_Type HostBenchSinCos_separate(uint32 x)
+{
+    Ifx_Math_SinCos_Type sinCosReturn;
+    sinCosReturn.sin = Ifx_Math_Sin_F16(x);
+    sinCosReturn.cos = Ifx_Math_Cos_F16(x);
+
+    return sinCosReturn;
+}
+
+
+/* Ifx_Math_Park_F16() of Math-BAS 1.3.0 */
+static __attribute__((noinline)) Ifx_Math_CmpFract16 HostBenchSinCos_parkSeparate(Ifx_Math_CmpFract16 stationary,
+                                                                                  uint32 angle)
+{
+    Ifx_Math_CmpFract16 parkOutput;
+    Ifx_Math_Fract16    cosTheta = Ifx_Math_Cos_F16(angle);
+    Ifx_Math_Fract16    sinTheta = Ifx_Math_Sin_F16(angle);
+
+    parkOutput.real = Ifx_Math_AddSat_F16(Ifx_Math_MulSat_F16(stationary.real, cosTheta),
+        Ifx_Math_MulSat_F16(stationary.imag, sinTheta));
+    parkOutput.imag = Ifx_Math_SubSat_F16(Ifx_Math_MulSat_F16(stationary.imag, cosTheta),
+        Ifx_Math_MulSat_F16(stationary.real, sinTheta));
+
+    return parkOutput;
+}
+
+
+static void HostBenchSinCos_kernelSeparate(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_SinCos_Type sinCos = HostBenchSinCos_separate(angle);
+        sum   += sinCos.sin + sinCos.cos;
+        angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinCos_kernelFused(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_SinCos_Type sinCos = Ifx_Math_SinCos_F16(angle);
+        sum   += sinCos.sin + sinCos.cos;
+        angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinCos_kernelParkSeparate(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_CmpFract16 dq = HostBenchSinCos_parkSeparate(HostBenchSinCos_vector(angle), angle);
+        sum   += dq.real + dq.imag;
+        angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinCos_kernelPark(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_CmpFract16 dq = Ifx_Math_Park_F16(HostBenchSinCos_vector(angle), angle);
+        sum   += dq.real + dq.imag;
+        angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinCos_kernelInvPark(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_CmpFract16 ab = Ifx_Math_InvPark_F16(HostBenchSinCos_vector(angle), angle);
+        sum   += ab.real + ab.imag;
+        angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinCos_kernelPolarToCart(uint32 calls)
+{
+    Ifx_Math_PolarFract16 polar = {0, 0u};
+    sint32                sum   = 0;
+    uint32                call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_CmpFract16 cart;
+        polar.amplitude = (Ifx_Math_Fract16)(polar.angle >> 17);
+        cart            = Ifx_Math_PolarToCart_F16(polar);
+        sum         += cart.real + cart.imag;
+        polar.angle += HOST_BENCH_SINCOS_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+/* Counts the angles for which the fused and the separate lookups differ */
+static void HostBenchSinCos_checkAllAngles(void)
+{
+    uint32 angle          = 0u;
+    uint32 sinMismatches  = 0u;
+    uint32 cosMismatches  = 0u;
+    sint32 maxDifference  = 0;
+
+    do
+    {
+        Ifx_Math_SinCos_Type fused    = Ifx_Math_SinCos_F16(angle);
+        Ifx_Math_SinCos_Type separate = HostBenchSinCos_separate(angle);
+
+        if (fused.sin != separate.sin)
+        {
+            sinMismatches++;
+        }
+
+        if (fused.cos != separate.cos)
+        {
+            sint32 difference = abs((sint32)fused.cos - (sint32)separate.cos);
+            cosMismatches++;
+
+            if (difference > maxDifference)
+            {
+                maxDifference = difference;
+            }
+        }
+
+        angle++;
+    } while (angle != 0u);
+
+    (void)printf("\nall 2^32 angles against the separate lookups\n");
+    (void)printf("sin mismatches : %u\n", (unsigned)sinMismatches);
+    (void)printf("cos mismatches : %u (max. difference %d LSB, angles halfway between two table entries)\n",
+        (unsigned)cosMismatches, (int)maxDifference);
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32 calls      = (argc > 1) ? (uint32)atoi(argv[1]) : 10000000u;
+    bool   exhaustive = ((argc > 2) && (atoi(argv[2]) != 0)) ? true : false;
+
+    (void)printf("sine table size 2^%d, %u calls per run, best of %u runs\n\n", IFX_MATH_CFG_SIN_LUT_SIZE,
+        (unsigned)calls, (unsigned)HOST_BENCH_RUNS);
+
+    HostBench_printHeader();
+    (void)HostBench_print("SinCos, separate lookups", HostBenchSinCos_kernelSeparate, calls);
+    (void)HostBench_print("SinCos, fused", HostBenchSinCos_kernelFused, calls);
+    (void)HostBench_print("Park, separate lookups", HostBenchSinCos_kernelParkSeparate, calls);
+    (void)HostBench_print("Park, fused", HostBenchSinCos_kernelPark, calls);
+    (void)HostBench_print("InvPark, fused", HostBenchSinCos_kernelInvPark, calls);
+    (void)HostBench_print("PolarToCart, fused", HostBenchSinCos_kernelPolarToCart, calls);
+
+    if (exhaustive == true)
+    {
+        HostBenchSinCos_checkAllAngles();
+    }
+
+    return 0;
+}
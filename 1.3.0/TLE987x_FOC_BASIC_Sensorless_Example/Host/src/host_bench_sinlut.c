@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_bench_sinlut.c
+ * \brief Flash, accuracy and cost of the sine modes of Math-BAS: nearest entry of a one period table
+ * (IFX_MATH_USROPT_SIN_MODE_LUT) against linear interpolation in a quarter wave table
+ * (IFX_MATH_USROPT_SIN_MODE_INTERPOLATED), for the table sizes 2^8, 2^10 and 2^12 per period.
+ *
+ * Only the configured table is linked, all variants are evaluated with a model of Ifx_Math_SinCos_F16(). The model of
+ * the configured variant is checked bit by bit against the linked library. The accuracy is taken against sin() and
+ * cos() over evenly spaced angles, THD+N is the power of all DFT bins but the fundamental of one sampled period
+ * relative to the fundamental.
+ *
+ * Usage: foc_bench_sinlut [calls per run]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_Math_SinCos.h"
+
+/* Largest modelled table size per period */
+#define HOST_BENCH_SINLUT_MAX_SIZE     (12u)
+
+/* Angles of the accuracy sweep and samples of the THD+N period, prime so that the samples do not repeat the table
+ * grid */
+#define HOST_BENCH_SINLUT_SWEEP        (1u << 22)
+#define HOST_BENCH_SINLUT_THD_SAMPLES  (3001u)
+
+/* Angle increment between two calls of the timing kernels, odd so that all table indices are hit */
+#define HOST_BENCH_SINLUT_ANGLE_STEP   (0x9E3779B9u)
+
+#define HOST_BENCH_SINLUT_PI           (3.14159265358979323846)
+
+/* Modelled variant */
+typedef struct
+{
+    uint8 size;         /* Table size per period, 2^size */
+    bool  interpolated; /* IFX_MATH_USROPT_SIN_MODE_INTERPOLATED, else IFX_MATH_USROPT_SIN_MODE_LUT */
+} THostBenchSinLut_Variant;
+
+/* Modelled tables of the variant set up by HostBenchSinLut_build() */
+static Ifx_Math_Fract16 HostBenchSinLut_table[(1u << HOST_BENCH_SINLUT_MAX_SIZE) + 2u];
+static uint32           HostBenchSinLut_entries;
+static uint8            HostBenchSinLut_size;
+
+/* Fills the modelled table of a variant, entries rounded as in Ifx_Math_Lut_SinCos_F16_Table.c */
+static void HostBenchSinLut_build(THostBenchSinLut_Variant variant)
+{
+    uint32  intervals = variant.interpolated ? (1u << (variant.size - 2u)) : (1u << variant.size);
+    float64 period    = variant.interpolated ? (HOST_BENCH_SINLUT_PI / 2.0) : (2.0 * HOST_BENCH_SINLUT_PI);
+    uint32  i;
+
+    for (i = 0; i <= intervals; i++)
+    {
+        float64 value = round(sin(period * (float64)i / (float64)intervals) * 32768.0);
+        HostBenchSinLut_table[i] = (Ifx_Math_Fract16)fmax(-32768.0, fmin(32767.0, value));
+    }
+
+    HostBenchSinLut_entries = intervals + 1u;
+
+    /* Mirrored entry after sin(pi/2) */
+    if (variant.interpolated)
+    {
+        HostBenchSinLut_table[intervals + 1u] = HostBenchSinLut_table[intervals - 1u];
+        HostBenchSinLut_entries++;
+    }
+
+    HostBenchSinLut_size = variant.size;
+}
+
+
+/* Ifx_Math_SinCos_F16() of IFX_MATH_USROPT_SIN_MODE_LUT on the modelled table */
+static inline Ifx_Math_SinCos_Type HostBenchSinLut_nearest(uint32 x)
+{
+    Ifx_Math_SinCos_Type result;
+    uint8                shift    = (uint8)(16u - HostBenchSinLut_size);
+    uint32               sinIndex = (((x >> 16) + (1u << (shift - 1u))) >> shift);
+    uint32               cosIndex = ((1u << (HostBenchSinLut_size - 2u)) - sinIndex)
+                                    & ((1u << HostBenchSinLut_size) - 1u);
+
+    result.sin = HostBenchSinLut_table[sinIndex];
+    result.cos = HostBenchSinLut_table[cosIndex];
+
+    return result;
+}
+
+
+/* Ifx_Math_SinQuarter_F16() on the modelled table */
+static inline Ifx_Math_Fract16 HostBenchSinLut_quarter(uint32 x)
+{
+    uint8  shift    = (uint8)(32u - HostBenchSinLut_size);
+    uint32 index    = x >> shift;
+    sint32 fraction = (sint32)((x >> (shift - 15u)) & 0x7FFFu);
+    sint32 slope    = (sint32)HostBenchSinLut_table[index + 1u] - (sint32)HostBenchSinLut_table[index];
+
+    return (Ifx_Math_Fract16)(HostBenchSinLut_table[index] + (((slope * fraction) + (1 << 14)) >> 15));
+}
+
+
+/* Ifx_Math_SinCos_F16() of IFX_MATH_USROPT_SIN_MODE_INTERPOLATED on the modelled table */
+static inline Ifx_Math_SinCos_Type HostBenchSinLut_interpolated(uint32 x)
+{
+    Ifx_Math_SinCos_Type result;
+    uint32               quadrant    = x >> 30;
+    uint32               position    = x & ((1u << 30) - 1u);
+    Ifx_Math_Fract16     sinPosition = HostBenchSinLut_quarter(position);
+    Ifx_Math_Fract16     cosPosition = HostBenchSinLut_quarter((1u << 30) - position);
+
+    result.sin = ((quadrant & 1u) != 0u) ? cosPosition : sinPosition;
+    result.cos = ((quadrant & 1u) != 0u) ? sinPosition : cosPosition;
+    result.sin = ((quadrant & 2u) != 0u) ? (Ifx_Math_Fract16)(-result.sin) : result.sin;
+    result.cos = (((quadrant + 1u) & 2u) != 0u) ? (Ifx_Math_Fract16)(-result.cos) : result.cos;
+
+    return result;
+}
+
+
+static inline Ifx_Math_SinCos_Type HostBenchSinLut_model(THostBenchSinLut_Variant variant, uint32 x)
+{
+    return variant.interpolated ? HostBenchSinLut_interpolated(x) : HostBenchSinLut_nearest(x);
+}
+
+
+/* Checks the model of the configured variant against Ifx_Math_SinCos_F16(), Ifx_Math_Sin_F16() and Ifx_Math_Cos_F16()
+ * of the library, on every 257th angle and around the quadrant boundaries */
+static bool HostBenchSinLut_checkModel(void)
+{
+    THostBenchSinLut_Variant variant = {
+        IFX_MATH_CFG_SIN_LUT_SIZE, (IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED) ? true : false
+    };
+    bool                     match   = true;
+    uint64                   angle;
+    uint32                   quadrant;
+    sint32                   offset;
+
+    HostBenchSinLut_build(variant);
+
+    for (angle = 0u; angle <= 0xFFFFFFFFu; angle += 257u)
+    {
+        Ifx_Math_SinCos_Type model   = HostBenchSinLut_model(variant, (uint32)angle);
+        Ifx_Math_SinCos_Type library = Ifx_Math_SinCos_F16((uint32)angle);
+
+        if ((model.sin != library.sin) || (model.cos != library.cos)
+            || ((variant.interpolated == true) && ((model.sin != Ifx_Math_Sin_F16((uint32)angle))
+                                                   || (model.cos != Ifx_Math_Cos_F16((uint32)angle)))))
+        {
+            match = false;
+        }
+    }
+
+    for (quadrant = 0u; quadrant < 4u; quadrant++)
+    {
+        for (offset = -1000; offset <= 1000; offset++)
+        {
+            uint32               x       = (quadrant << 30) + (uint32)offset;
+            Ifx_Math_SinCos_Type model   = HostBenchSinLut_model(variant, x);
+            Ifx_Math_SinCos_Type library = Ifx_Math_SinCos_F16(x);
+
+            if ((model.sin != library.sin) || (model.cos != library.cos))
+            {
+                match = false;
+            }
+        }
+    }
+
+    return match;
+}
+
+
+/* Prints flash, accuracy and THD+N of the variant set up by HostBenchSinLut_build() */
+static void HostBenchSinLut_printAccuracy(THostBenchSinLut_Variant variant)
+{
+    float64 maxError      = 0.0;
+    float64 sumSq         = 0.0;
+    float64 fundamentalRe = 0.0;
+    float64 fundamentalIm = 0.0;
+    float64 totalPower    = 0.0;
+    float64 fundamentalPower;
+    uint32  i;
+    char    name[40];
+
+    /* Error over the sweep, with low angle bits that are not aligned to the table */
+    for (i = 0; i < HOST_BENCH_SINLUT_SWEEP; i++)
+    {
+        uint32               x      = (i * (uint32)(0x100000000ULL / HOST_BENCH_SINLUT_SWEEP)) + (i * 0x9Bu);
+        float64              theta  = (float64)x * (2.0 * HOST_BENCH_SINLUT_PI / 4294967296.0);
+        Ifx_Math_SinCos_Type result = HostBenchSinLut_model(variant, x);
+        float64              errorSin = (float64)result.sin - (sin(theta) * 32768.0);
+        float64              errorCos = (float64)result.cos - (cos(theta) * 32768.0);
+
+        sumSq   += (errorSin * errorSin) + (errorCos * errorCos);
+        maxError = fmax(maxError, fmax(fabs(errorSin), fabs(errorCos)));
+    }
+
+    /* One period of samples, fundamental by DFT, the rest is harmonics and noise */
+    for (i = 0; i < HOST_BENCH_SINLUT_THD_SAMPLES; i++)
+    {
+        float64 phase = 2.0 * HOST_BENCH_SINLUT_PI * (float64)i / (float64)HOST_BENCH_SINLUT_THD_SAMPLES;
+        uint32  x     = (uint32)llround((float64)i * (4294967296.0 / (float64)HOST_BENCH_SINLUT_THD_SAMPLES));
+        float64 value = (float64)HostBenchSinLut_model(variant, x).sin;
+
+        fundamentalRe += value * cos(phase);
+        fundamentalIm += value * sin(phase);
+        totalPower    += value * value;
+    }
+
+    fundamentalPower = 2.0 * ((fundamentalRe * fundamentalRe) + (fundamentalIm * fundamentalIm))
+                       / (float64)HOST_BENCH_SINLUT_THD_SAMPLES;
+
+    (void)snprintf(name, sizeof(name), "%s 2^%u", variant.interpolated ? "interpolated" : "nearest",
+        (unsigned)variant.size);
+    (void)printf("%-20s %8u %8u %10.2f %10.3f %12.1f\n", name, (unsigned)HostBenchSinLut_entries,
+        (unsigned)(HostBenchSinLut_entries * sizeof(Ifx_Math_Fract16)), maxError,
+        sqrt(sumSq / (2.0 * (float64)HOST_BENCH_SINLUT_SWEEP)),
+        10.0 * log10((totalPower - fundamentalPower) / fundamentalPower));
+}
+
+
+static void HostBenchSinLut_kernelNearest(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_SinCos_Type sinCos = HostBenchSinLut_nearest(angle);
+        sum   += sinCos.sin + sinCos.cos;
+        angle += HOST_BENCH_SINLUT_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinLut_kernelInterpolated(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_SinCos_Type sinCos = HostBenchSinLut_interpolated(angle);
+        sum   += sinCos.sin + sinCos.cos;
+        angle += HOST_BENCH_SINLUT_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+static void HostBenchSinLut_kernelLibrary(uint32 calls)
+{
+    uint32 angle = 0u;
+    sint32 sum   = 0;
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_Math_SinCos_Type sinCos = Ifx_Math_SinCos_F16(angle);
+        sum   += sinCos.sin + sinCos.cos;
+        angle += HOST_BENCH_SINLUT_ANGLE_STEP;
+    }
+
+    HostBench_sink = sum;
+}
+
+
+int main(int argc, char** argv)
+{
+    static const uint8 sizes[] = {8u, 10u, 12u};
+    uint32             calls   = (argc > 1) ? (uint32)atoi(argv[1]) : 10000000u;
+    uint32             mode;
+    uint32             i;
+
+    (void)printf("configured: IFX_MATH_CFG_SIN_MODE %d, IFX_MATH_CFG_SIN_LUT_SIZE %d\n", IFX_MATH_CFG_SIN_MODE,
+        IFX_MATH_CFG_SIN_LUT_SIZE);
+    (void)printf("model matches the library: %s\n\n", (HostBenchSinLut_checkModel() == true) ? "yes" : "NO");
+
+    /* Flash and accuracy */
+    (void)printf("error of sin and cos in LSB of Q15 over %u angles, THD+N of one period of %u samples\n",
+        (unsigned)HOST_BENCH_SINLUT_SWEEP, (unsigned)HOST_BENCH_SINLUT_THD_SAMPLES);
+    (void)printf("%-20s %8s %8s %10s %10s %12s\n", "variant", "entries", "bytes", "max err", "rms err",
+        "THD+N [dB]");
+
+    for (mode = 0u; mode < 2u; mode++)
+    {
+        for (i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+        {
+            THostBenchSinLut_Variant variant = {sizes[i], (mode == 1u) ? true : false};
+
+            HostBenchSinLut_build(variant);
+            HostBenchSinLut_printAccuracy(variant);
+        }
+    }
+
+    /* Cost, independent of the table size apart from cache effects which the target does not have */
+    (void)printf("\nIfx_Math_SinCos_F16, %u calls per run, best of %u runs\n", (unsigned)calls,
+        (unsigned)HOST_BENCH_RUNS);
+    HostBench_printHeader();
+
+    for (i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        THostBenchSinLut_Variant nearest      = {sizes[i], false};
+        THostBenchSinLut_Variant interpolated = {sizes[i], true};
+        char                     name[40];
+
+        HostBenchSinLut_build(nearest);
+        (void)snprintf(name, sizeof(name), "nearest 2^%u", (unsigned)sizes[i]);
+        (void)HostBench_print(name, HostBenchSinLut_kernelNearest, calls);
+
+        HostBenchSinLut_build(interpolated);
+        (void)snprintf(name, sizeof(name), "interpolated 2^%u", (unsigned)sizes[i]);
+        (void)HostBench_print(name, HostBenchSinLut_kernelInterpolated, calls);
+    }
+
+    (void)HostBench_print("library (configured)", HostBenchSinLut_kernelLibrary, calls);
+
+    return 0;
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_current_step.c
+ * \brief Step response of the current controller in closed loop against the PMSM plant, and its cost per call.
+ *
+ * The FOC runs in speed control at a constant reference speed against a constant load torque. In steady state the
+ * direct current interface is enabled with the present q current command and a step of the d current command, which
+ * leaves the torque and so the speed unchanged for equal d and q inductance. The measured d and q current of the FOC
+ * controller is printed for each fast loop after the step, together with the number of fast loops until the d current
+ * stays within 10% of the step, its overshoot and the largest deviation of the q current. Fast loop 0 is the last one
+ * with the previous command, the speed loop takes over the step after it. The inputs of the FOC controller of the
+ * run are recorded and replayed to Ifx_MDA_FocControllerF16_execute() for its cost per call.
+ *
+ * Built against foc_stack_delaycomp (PI controllers) as foc_current_step and against foc_stack_deadbeat (deadbeat
+ * controller) as foc_current_step_deadbeat, so that both have the delay compensation and the current loop factor
+ * switched at runtime.
+ *
+ * Usage: foc_current_step [speed rpm] [step mA] [load torque mNm] [current loop factor]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "host_foc.h"
+#include "host_plant.h"
+
+/* Time until steady state before the step */
+#define HOST_CURRENT_STEP_SETTLE_S  (3.0)
+
+/* Number of fast loops evaluated and printed after the step */
+#define HOST_CURRENT_STEP_SAMPLES   (64u)
+#define HOST_CURRENT_STEP_PRINTED   (16u)
+
+/* Tolerance band of the settled q current, relative to the step */
+#define HOST_CURRENT_STEP_BAND      (0.1)
+
+/* Number of recorded inputs of the FOC controller */
+#define HOST_CURRENT_STEP_RECORDED  (1024u)
+
+/* Current in A of a current in Q15 */
+#define HOST_CURRENT_STEP_AMPERE(currentQ15) \
+    (((float64)(currentQ15) * (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_CURRENT_A) / 32768.0)
+
+/* Inputs of one call of the FOC controller */
+typedef struct
+{
+    Ifx_Math_CmpFract16 currentAlphaBeta;
+    Ifx_Math_CmpFract16 dqCommand;
+    uint32              angle;
+    Ifx_Math_Fract16    speed;
+} THostCurrentStep_Input;
+
+/* Recorded inputs and the FOC controller instance under test of the kernel */
+static THostCurrentStep_Input   HostCurrentStep_inputs[HOST_CURRENT_STEP_RECORDED];
+static uint32                   HostCurrentStep_recorded;
+static Ifx_MDA_FocControllerF16 HostCurrentStep_controller;
+
+/* Replays the recorded inputs to the FOC controller */
+static void HostCurrentStep_kernel(uint32 calls)
+{
+    Ifx_MDA_FocControllerF16_Output output = {0};
+    uint32                          call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        const THostCurrentStep_Input* input = &HostCurrentStep_inputs[call % HostCurrentStep_recorded];
+
+        Ifx_MDA_FocControllerF16_execute(&HostCurrentStep_controller, input->currentAlphaBeta, input->dqCommand,
+            input->angle, input->speed, (Ifx_Math_Fract16)0x4000);
+        Ifx_MDA_FocControllerF16_getOutput(&HostCurrentStep_controller, &output);
+    }
+
+    HostBench_sink = (sint32)output.voltageCommandPolar.angle;
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    sint16              referenceRpm  = (argc > 1) ? (sint16)atoi(argv[1]) : 1000;
+    float64             step_A        = (argc > 2) ? (atof(argv[2]) / 1000.0) : 0.5;
+    float64             loadTorque_Nm = (argc > 3) ? (atof(argv[3]) / 1000.0) : 0.02;
+    uint8               factor        = (argc > 4) ? (uint8)atoi(argv[4]) :
+                                        (uint8)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR;
+    THostPlant_Params   params;
+    THostPlant          plant;
+    Ifx_Math_CmpFract16 command;
+    float64             currentD_A[HOST_CURRENT_STEP_SAMPLES];
+    float64             currentQ_A[HOST_CURRENT_STEP_SAMPLES];
+    float64             initialQ_A;
+    float64             targetD_A;
+    float64             overshoot_pct = 0.0;
+    float64             deviationQ_A  = 0.0;
+    sint32              settled       = -1;
+    uint32              samples       = 0u;
+    uint32              periods       = (uint32)(HOST_CURRENT_STEP_SETTLE_S / HOST_FOC_PWM_PERIOD_S);
+    uint32              period;
+    uint32              index;
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    (void)Ifx_MS_FocSolutionF16_setCurrentLoopFactor(&FocDemoClosedLoop, factor);
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    for (period = 0u; period < periods; period++)
+    {
+        (void)HostPlant_stepClosedLoop(&plant);
+    }
+
+    /* Step of the d current command at the present q current command, taken over by the next speed loop */
+    command                                 = FocDemoClosedLoop.dqCommand;
+    initialQ_A                              = HOST_CURRENT_STEP_AMPERE(command.imag);
+    HostFoc_inputs.currentsDqReference.real = (Ifx_Math_Fract16)((step_A * 32768.0) /
+                                                                 (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_CURRENT_A);
+    HostFoc_inputs.currentsDqReference.imag = command.imag;
+    HostFoc_inputs.enableDirectInterface    = 1;
+    targetD_A                               = HOST_CURRENT_STEP_AMPERE(HostFoc_inputs.currentsDqReference.real);
+
+    while (samples < HOST_CURRENT_STEP_SAMPLES)
+    {
+        if ((HostPlant_stepClosedLoop(&plant) == true)
+            && ((samples > 0u) || (FocDemoClosedLoop.dqCommand.real == HostFoc_inputs.currentsDqReference.real)))
+        {
+            /* Current which the FOC controller measured in this fast loop */
+            currentD_A[samples] = HOST_CURRENT_STEP_AMPERE(FocDemoClosedLoop.focController.currentDQ.real);
+            currentQ_A[samples] = HOST_CURRENT_STEP_AMPERE(FocDemoClosedLoop.focController.currentDQ.imag);
+
+            if (HostCurrentStep_recorded < HOST_CURRENT_STEP_RECORDED)
+            {
+                THostCurrentStep_Input* input = &HostCurrentStep_inputs[HostCurrentStep_recorded];
+                input->currentAlphaBeta = FocDemoClosedLoop.currentsAlphaBeta;
+                input->dqCommand        = FocDemoClosedLoop.dqCommand;
+                input->angle            = FocDemoClosedLoop.angle;
+                input->speed            = FocDemoClosedLoop.rateLimitInSpeedQ15;
+                HostCurrentStep_recorded++;
+            }
+
+            samples++;
+        }
+    }
+
+    /* Settled: first fast loop from which on the d current stays within the band */
+    for (index = 0u; index < HOST_CURRENT_STEP_SAMPLES; index++)
+    {
+        float64 deviation = (currentD_A[index] - targetD_A) / targetD_A;
+
+        if (fabs(deviation) > HOST_CURRENT_STEP_BAND)
+        {
+            settled = -1;
+        }
+        else if (settled < 0)
+        {
+            settled = (sint32)index;
+        }
+        else
+        {
+            /* Still settled */
+        }
+
+        overshoot_pct = fmax(overshoot_pct, deviation * 100.0);
+        deviationQ_A  = fmax(deviationQ_A, fabs(currentQ_A[index] - initialQ_A));
+    }
+
+    (void)printf("scenario          : %d rpm, %.1f mNm load, d current step 0 A -> %.3f A at %.3f A q current, "
+        "fast loop %u us\n", (int)referenceRpm, loadTorque_Nm * 1000.0, targetD_A, initialQ_A,
+        (unsigned)((IFX_MS_FOCSOLUTIONF16_CFG_SAMPLING_TIME_US * factor) /
+                   IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR));
+    (void)printf("FOC state         : %d\n", (int)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state);
+    (void)printf("fast loop  id [A]  iq [A]\n");
+
+    for (index = 0u; index < HOST_CURRENT_STEP_PRINTED; index++)
+    {
+        (void)printf("%9u %7.3f %7.3f\n", (unsigned)index, currentD_A[index], currentQ_A[index]);
+    }
+
+    (void)printf("settled (+-%2.0f%%)   : ", HOST_CURRENT_STEP_BAND * 100.0);
+
+    if (settled < 0)
+    {
+        (void)printf("not settled\n");
+    }
+    else
+    {
+        (void)printf("%d fast loops after fast loop 0\n", (int)settled);
+    }
+
+    (void)printf("overshoot         : %.1f %%\n", overshoot_pct);
+    (void)printf("q current deviation: %.3f A\n\n", deviationQ_A);
+
+    /* Cost per call on the recorded inputs of the run */
+    HostCurrentStep_controller = FocDemoClosedLoop.focController;
+    HostBench_printHeader();
+    (void)HostBench_print("Ifx_MDA_FocControllerF16_execute", HostCurrentStep_kernel, 1000000u);
+
+    return 0;
+}
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_delay_comp.c
+ * \brief Closed loop runs against the PMSM plant with and without the delay compensation of the FOC controller.
+ *
+ * Built against foc_stack_delaycomp, i.e. with IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE and
+ * IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR enabled. Each run holds a constant reference speed against a
+ * constant load torque with a constant current loop factor. The delay compensation time is the one which the FOC
+ * solution derives for the factor, or zero for the run without compensation, or the swept time. In steady state the
+ * torque ripple (standard deviation over mean of the torque of the plant), the d current of the plant and the
+ * efficiency of the motor (mechanical power over mechanical power plus copper losses) are printed.
+ *
+ * The current controllers integrate a constant angle error of the voltage command away, so the remaining error of the
+ * delay is printed as well: the angle of the voltage which the inverter applied in each half PWM period relative to
+ * the rotor in the middle of it, minus the angle of the voltage command relative to the rotor flux angle of the fast
+ * loop, minus the error of this rotor flux angle against the rotor at the current sampling (middle of the PWM period
+ * of the fast loop). Zero means that the voltage command reaches the motor at the angle for which it was calculated.
+ *
+ * Usage: foc_delay_comp [load torque mNm] [sweep step us]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+
+/* Duration of a run and its part at the end which is evaluated as steady state */
+#define HOST_DELAY_COMP_DURATION_S     (4.0)
+#define HOST_DELAY_COMP_STEADY_S       (1.0)
+
+/* Largest delay compensation time of the sweep, in microseconds */
+#define HOST_DELAY_COMP_SWEEP_MAX_US   (400u)
+
+/* Delay compensation time given to the runs with the time derived by the FOC solution */
+#define HOST_DELAY_COMP_DERIVED        (0xFFFFFFFFu)
+
+/* Angle in degree of a normalized angle of the FOC stack */
+#define HOST_DELAY_COMP_DEG(angle)     ((float64)(angle) * (360.0 / 4294967296.0))
+
+/* Angle in degree of an angle in rad */
+#define HOST_DELAY_COMP_RAD_TO_DEG     (180.0 / 3.14159265358979323846)
+
+/* Result of one run */
+typedef struct
+{
+    float64 speed_rpm;          /* Mean speed */
+    float64 delayError_deg;     /* Mean remaining angle error of the applied voltage, see file header */
+    float64 torqueRipple_pct;   /* Standard deviation over mean of the torque */
+    float64 currentDRms_A;      /* RMS d current in the rotor frame of the plant */
+    float64 currentRms_A;       /* RMS current vector amplitude */
+    float64 efficiency_pct;     /* Mechanical power over mechanical power plus copper losses */
+    uint32  delay_us;           /* Delay compensation time in use */
+    sint32  state;              /* FOC state at the end of the run */
+} THostDelayComp_Result;
+
+/* Wraps an angle difference to (-180, 180] degrees */
+static float64 HostDelayComp_wrapDeg(float64 angle_deg)
+{
+    while (angle_deg > 180.0)
+    {
+        angle_deg -= 360.0;
+    }
+
+    while (angle_deg <= -180.0)
+    {
+        angle_deg += 360.0;
+    }
+
+    return angle_deg;
+}
+
+
+/* Returns the angle of the mean voltage which the inverter applies in a half PWM period relative to the rotor angle
+ * in the middle of it, the up counting half with the switch on ticks and the down counting half with the switch off
+ * ticks */
+static float64 HostDelayComp_voltageAngleDeg(const THostPlant* plant, bool downCounting, float64 rotorAngle_rad)
+{
+    float64 halfPeriod = (float64)plant->period_tick * 0.5;
+    float64 duty[3];
+    float64 voltageAlpha;
+    float64 voltageBeta;
+    uint8   phase;
+
+    for (phase = 0u; phase < 3u; phase++)
+    {
+        if (downCounting == true)
+        {
+            duty[phase] = (fmin(fmax((float64)plant->switchOff_tick[phase], halfPeriod), (float64)plant->period_tick)
+                           - halfPeriod) / halfPeriod;
+        }
+        else
+        {
+            duty[phase] = (halfPeriod - fmin((float64)plant->switchOn_tick[phase], halfPeriod)) / halfPeriod;
+        }
+    }
+
+    voltageAlpha = ((2.0 * duty[0]) - duty[1] - duty[2]) / 3.0;
+    voltageBeta  = (duty[1] - duty[2]) / sqrt(3.0);
+
+    return HostDelayComp_wrapDeg((atan2(voltageBeta, voltageAlpha) - rotorAngle_rad) * HOST_DELAY_COMP_RAD_TO_DEG);
+}
+
+
+/* Runs one operating point with a constant factor and a given or the derived delay compensation time */
+static void HostDelayComp_run(THostDelayComp_Result* result, sint16 referenceRpm, uint8 factor, uint32 delay_us,
+                              float64 loadTorque_Nm)
+{
+    THostPlant_Params params;
+    THostPlant        plant;
+    uint32            periods       = (uint32)(HOST_DELAY_COMP_DURATION_S / HOST_FOC_PWM_PERIOD_S);
+    uint32            steadyPeriods = (uint32)(HOST_DELAY_COMP_STEADY_S / HOST_FOC_PWM_PERIOD_S);
+    bool              latched       = false;
+    float64           speedSum      = 0.0;
+    float64           torqueSum     = 0.0;
+    float64           torqueSqSum   = 0.0;
+    float64           powerSum      = 0.0;
+    float64           currentDSqSum = 0.0;
+    float64           currentSqSum  = 0.0;
+    float64           appliedSum    = 0.0;
+    float64           commandSum    = 0.0;
+    uint32            halves        = 0u;
+    uint32            fastLoops     = 0u;
+    float64           torqueMean;
+    float64           copperLoss_W;
+    uint32            period;
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    (void)Ifx_MS_FocSolutionF16_setCurrentLoopFactor(&FocDemoClosedLoop, factor);
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    for (period = 0u; period < periods; period++)
+    {
+        bool    steady = (period >= (periods - steadyPeriods));
+        float64 speedElec_radps;
+        float64 halfPeriod_s;
+        float64 samplingAngle_rad;
+        bool    executed;
+
+        /* Same sequence as HostPlant_stepClosedLoop(), with the applied voltage of each half period */
+        speedElec_radps = plant.speedMech_radps * (float64)params.polePairs;
+        halfPeriod_s    = HOST_FOC_PWM_PERIOD_S * 0.5;
+
+        if (steady == true)
+        {
+            appliedSum += HostDelayComp_voltageAngleDeg(&plant, false,
+                plant.angleElec_rad + (speedElec_radps * halfPeriod_s * 0.5));
+            halves++;
+        }
+
+        HostPlant_runUpCounting(&plant);
+        HostFoc_PeriodMatch();
+        HostPlant_latchUpCounting(&plant);
+        samplingAngle_rad = plant.angleElec_rad;
+
+        if (steady == true)
+        {
+            appliedSum += HostDelayComp_voltageAngleDeg(&plant, true,
+                plant.angleElec_rad + (speedElec_radps * halfPeriod_s * 0.5));
+            halves++;
+        }
+
+        HostPlant_runDownCounting(&plant);
+        executed = HostFoc_OneMatch();
+
+        /* The first fast loop latches the factor and the derived time, a given time overrides it from then on */
+        if ((executed == true) && (latched == false))
+        {
+            if (delay_us != HOST_DELAY_COMP_DERIVED)
+            {
+                Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(&(FocDemoClosedLoop.focController), delay_us);
+            }
+
+            latched = true;
+        }
+
+        /* Voltage command relative to the rotor flux angle plus the error of this angle at the current sampling */
+        if ((executed == true) && (steady == true))
+        {
+            Ifx_Math_CmpFract16 voltageDQ = FocDemoClosedLoop.focController.voltageDQ;
+
+            commandSum += (atan2((float64)voltageDQ.imag, (float64)voltageDQ.real) * HOST_DELAY_COMP_RAD_TO_DEG)
+                          + HostDelayComp_wrapDeg(HOST_DELAY_COMP_DEG(FocDemoClosedLoop.angle)
+                                                  - (samplingAngle_rad * HOST_DELAY_COMP_RAD_TO_DEG));
+            fastLoops++;
+        }
+
+        HostPlant_latchDownCounting(&plant);
+
+        if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+        {
+            HostFoc_SpeedLoop();
+            HostFoc_Background();
+        }
+
+        if (steady == true)
+        {
+            float64 currentD_A;
+            float64 currentQ_A;
+
+            HostPlant_getCurrentsDq(&plant, &currentD_A, &currentQ_A);
+            speedSum      += HostPlant_getSpeedRpm(&plant);
+            torqueSum     += plant.torque_Nm;
+            torqueSqSum   += plant.torque_Nm * plant.torque_Nm;
+            powerSum      += plant.torque_Nm * plant.speedMech_radps;
+            currentDSqSum += currentD_A * currentD_A;
+            currentSqSum  += (currentD_A * currentD_A) + (currentQ_A * currentQ_A);
+        }
+    }
+
+    torqueMean                = torqueSum / (float64)steadyPeriods;
+    copperLoss_W              = 1.5 * params.resistance_Ohm * (currentSqSum / (float64)steadyPeriods);
+    result->speed_rpm         = speedSum / (float64)steadyPeriods;
+    result->delayError_deg    = (appliedSum / (float64)halves) - (commandSum / (float64)fastLoops);
+    result->torqueRipple_pct  = (100.0 * sqrt(fmax((torqueSqSum / (float64)steadyPeriods) - (torqueMean * torqueMean),
+                                                   0.0))) / fabs(torqueMean);
+    result->currentDRms_A     = sqrt(currentDSqSum / (float64)steadyPeriods);
+    result->currentRms_A      = sqrt(currentSqSum / (float64)steadyPeriods);
+    result->efficiency_pct    = (100.0 * (powerSum / (float64)steadyPeriods))
+                                / ((powerSum / (float64)steadyPeriods) + copperLoss_W);
+    result->delay_us          =
+        Ifx_MDA_FocControllerF16_getDelayCompensationTime_us(&(FocDemoClosedLoop.focController));
+    result->state             = (sint32)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state;
+}
+
+
+/* Prints the result of one run */
+static void HostDelayComp_print(const char* name, const THostDelayComp_Result* result)
+{
+    (void)printf("%-12s %5d %8u %9.1f %9.2f %11.3f %9.4f %9.4f %9.3f\n", name, (int)result->state,
+        (unsigned)result->delay_us, result->speed_rpm, result->delayError_deg, result->torqueRipple_pct,
+        result->currentDRms_A, result->currentRms_A, result->efficiency_pct);
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    float64               loadTorque_Nm = (argc > 1) ? (atof(argv[1]) / 1000.0) : 0.02;
+    uint32                sweepStep_us  = (argc > 2) ? (uint32)atoi(argv[2]) : 0u;
+    const sint16          speeds[3]     = {1000, 1500, 2000};
+    const uint8           factors[2]    = {1u, IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR};
+    THostDelayComp_Result result;
+    char                  name[16];
+    uint32                factorIndex;
+    uint32                speedIndex;
+
+    (void)printf("load torque %.1f mNm, PWM %u kHz, configured factor %u, %.1f s per run, last %.1f s evaluated\n\n",
+        loadTorque_Nm * 1000.0, (unsigned)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ,
+        (unsigned)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR, HOST_DELAY_COMP_DURATION_S, HOST_DELAY_COMP_STEADY_S);
+
+    for (factorIndex = 0u; factorIndex < (uint32)(sizeof(factors) / sizeof(factors[0])); factorIndex++)
+    {
+        for (speedIndex = 0u; speedIndex < (uint32)(sizeof(speeds) / sizeof(speeds[0])); speedIndex++)
+        {
+            (void)printf("factor %u, %d rpm\n", (unsigned)factors[factorIndex], (int)speeds[speedIndex]);
+            (void)printf("%-12s %5s %8s %9s %9s %11s %9s %9s %9s\n", "run", "state", "delay us", "speed rpm",
+                "err [deg]", "ripple [%]", "Id rms A", "I rms A", "eff [%]");
+
+            HostDelayComp_run(&result, speeds[speedIndex], factors[factorIndex], 0u, loadTorque_Nm);
+            HostDelayComp_print("off", &result);
+            HostDelayComp_run(&result, speeds[speedIndex], factors[factorIndex], HOST_DELAY_COMP_DERIVED,
+                loadTorque_Nm);
+            HostDelayComp_print("compensated", &result);
+
+            if (sweepStep_us > 0u)
+            {
+                uint32 delay_us;
+
+                for (delay_us = sweepStep_us; delay_us <= HOST_DELAY_COMP_SWEEP_MAX_US; delay_us += sweepStep_us)
+                {
+                    HostDelayComp_run(&result, speeds[speedIndex], factors[factorIndex], delay_us, loadTorque_Nm);
+                    (void)snprintf(name, sizeof(name), "sweep");
+                    HostDelayComp_print(name, &result);
+                }
+            }
+
+            (void)printf("\n");
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_foc.c
+ * \brief Host counterpart of Example/main.c.
+ */
+
+#include <string.h>
+#include "host_foc.h"
+#include "host_sfr.h"
+#include "Ifx_Math_DivSat.h"
+
+/* Duration rotor alignment (steps) = alignment(s) * speed loop freq (Hz) */
+#define ROTORALIGNMENT_TIME_STEPS (666)
+
+/* FOC instance */
+Ifx_MS_FocSolutionF16 FocDemoClosedLoop;
+
+/* User inputs */
+THostFoc_Inputs       HostFoc_inputs;
+
+/* Counter for the rotor alignment */
+static uint16         rotorAlignCounter;
+
+/* Counter for the current control loop execution */
+static sint8          currentControlCounter;
+
+/* Counter for the speed loop timer */
+static uint32         speedLoopCounter;
+
+void HostFoc_Init(void)
+{
+    /* Power-on register values */
+    HostSfr_Reset();
+
+    /* Default user inputs, see Example/main.c */
+    (void)memset(&HostFoc_inputs, 0, sizeof(HostFoc_inputs));
+    HostFoc_inputs.enablePowerStage = 1;
+    HostFoc_inputs.controlMode      = 1;
+
+    /* Reset the application counters */
+    rotorAlignCounter     = 0;
+    currentControlCounter = 0;
+    speedLoopCounter      = 0;
+
+    /* Initialize FOC */
+    (void)memset(&FocDemoClosedLoop, 0, sizeof(FocDemoClosedLoop));
+    Ifx_MS_FocSolutionF16_init(&FocDemoClosedLoop);
+}
+
+
+void HostFoc_Background(void)
+{
+    /* Call clear fault API if requested */
+    if (HostFoc_inputs.clrFaultFoc == 1)
+    {
+        Ifx_MS_FocSolutionF16_clearFault(&FocDemoClosedLoop);
+        HostFoc_inputs.clrFaultFoc = 0;
+    }
+
+    /* Call FOC enable */
+    Ifx_MS_FocSolutionF16_enablePowerStage(&FocDemoClosedLoop, (bool)HostFoc_inputs.enablePowerStage);
+    Ifx_MS_FocSolutionF16_enableControl(&FocDemoClosedLoop, (bool)HostFoc_inputs.enableControl);
+    Ifx_MS_FocSolutionF16_setControlMode(&FocDemoClosedLoop,
+        (Ifx_MS_FocSolutionF16_ControlMode)HostFoc_inputs.controlMode);
+    Ifx_MS_FocSolutionF16_enableDirectInterface(&FocDemoClosedLoop, (bool)HostFoc_inputs.enableDirectInterface);
+
+    /* Call Bridge Driver (fault handling) */
+    Ifx_MHA_BridgeDrv_TLE987_execute(&(FocDemoClosedLoop.bridgeDrvTLE987));
+    Ifx_MS_FocSolutionF16_enableSpeedPreControl(&FocDemoClosedLoop, (bool)HostFoc_inputs.enableSpeedPreControl);
+}
+
+
+void HostFoc_PeriodMatch(void)
+{
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
+    Ifx_MHA_MeasurementADC_TLE987_periodMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+    Ifx_MHA_PatternGen_TLE987_onPeriodMatch(&(FocDemoClosedLoop.patternGenTLE987));
+}
+
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+void HostFoc_DmaCh5(void)
+{
+    Ifx_MHA_MeasurementADC_TLE987_dmaDone(&(FocDemoClosedLoop.measurementADCTLE987));
+}
+
+
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+bool HostFoc_OneMatch(void)
+{
+    /* Fast loop execution flag */
+    bool executed = false;
+
+    Ifx_MHA_PatternGen_TLE987_onOneMatch(&(FocDemoClosedLoop.patternGenTLE987));
+#if (IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR > 1) || (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1)
+
+    /* Execute current control only in the defined cycles */
+    if (currentControlCounter < ((sint8)Ifx_MS_FocSolutionF16_getCurrentLoopFactor(&FocDemoClosedLoop) - 1))
+    {
+        /* Increment counter */
+        currentControlCounter++;
+    }
+    else
+    {
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
+        Ifx_MHA_MeasurementADC_TLE987_oneMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+
+        /* Reset Pattern Generator cycle counter */
+        Ifx_MHA_PatternGen_TLE987_reset(&(FocDemoClosedLoop.patternGenTLE987));
+
+        /* PendSV is taken right after the CCU6 interrupt returns */
+        currentControlCounter = 0;
+        Ifx_MS_FocSolutionF16_executeControlMode(&FocDemoClosedLoop);
+        executed = true;
+    }
+
+#else
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 0
+    Ifx_MHA_MeasurementADC_TLE987_oneMatch(&(FocDemoClosedLoop.measurementADCTLE987));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+    Ifx_MS_FocSolutionF16_executeControlMode(&FocDemoClosedLoop);
+    executed = true;
+#endif
+
+    return executed;
+}
+
+
+void HostFoc_SpeedLoop(void)
+{
+    /* Variable to hold the scaled ref. speed */
+    Ifx_Math_Fract16 referenceSpeedQ15;
+
+    /* If speed control or powerstage disabled */
+    if ((HostFoc_inputs.enableControl == 0)
+        || (HostFoc_inputs.enablePowerStage == 0))
+    {
+        /* set ref. speed to 0 */
+        referenceSpeedQ15 = 0;
+
+        /* Set alignment counter to init. value */
+        rotorAlignCounter = ROTORALIGNMENT_TIME_STEPS;
+    }
+
+    /* Rotor alignment finished */
+    else if (rotorAlignCounter == 0)
+    {
+        /* Calculate the scaled speed from the ref. and base speed */
+        referenceSpeedQ15 = Ifx_Math_DivSat_F16(HostFoc_inputs.referenceSpeedQ0,
+            IFX_MS_FOCSOLUTIONF16_CFG_BASE_MECH_SPEED_RPM);
+    }
+
+    /* Rotor alignment ongoing */
+    else
+    {
+        /* During rotor alignment ref. speed = 0 */
+        referenceSpeedQ15 = 0;
+
+        /* Decrement rotor alignment counter */
+        rotorAlignCounter = rotorAlignCounter - 1;
+    }
+
+    /* Execute speed control */
+    Ifx_MS_FocSolutionF16_executeSpeedControl(&FocDemoClosedLoop, referenceSpeedQ15,
+        HostFoc_inputs.currentsDqReference);
+}
+
+
+void HostFoc_Step(void)
+{
+    /* Interrupts of one PWM period in the order in which they occur on the target */
+    HostFoc_PeriodMatch();
+    (void)HostFoc_OneMatch();
+
+    /* GPT12 T6 speed loop timer */
+    speedLoopCounter++;
+
+    if (speedLoopCounter >= HOST_FOC_SPEED_LOOP_DIVIDER)
+    {
+        speedLoopCounter = 0;
+        HostFoc_SpeedLoop();
+        HostFoc_Background();
+    }
+}
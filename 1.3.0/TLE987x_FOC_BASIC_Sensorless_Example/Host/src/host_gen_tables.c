@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_gen_tables.c
+ * \brief Generator of the lookup table sources of Math-BAS and MAS-BAS.
+ *
+ * Writes Ifx_Math_Lut_Atan_F16_Table.c, Ifx_Math_Lut_CartToPolar_F16_Table.c, Ifx_Math_Lut_SinCos_F16_Table.c and
+ * Ifx_MAS_ModulatorF16_tableSin60Sqrt3.c with one table per size of HOST_GEN_TABLES_SIZES, each guarded by the size
+ * configuration of the component. Only the configured table is compiled and linked. A new size is added to
+ * HOST_GEN_TABLES_SIZES and, for Math-BAS, as IFX_MATH_USROPT_*_LUT_SIZE_n to Ifx_Math_UsrOpt.h.
+ *
+ * The target foc_check_tables of the host build regenerates the tables and compares them with the sources of the
+ * project.
+ *
+ * Usage: foc_gen_tables <output directory>
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include "types.h"
+
+/* Table sizes, log2 of the number of table intervals */
+#define HOST_GEN_TABLES_SIZES      {8u, 9u, 10u, 11u, 12u}
+#define HOST_GEN_TABLES_SIZE_COUNT (5u)
+
+/* Line length of the sources */
+#define HOST_GEN_TABLES_LINE_WIDTH (120u)
+
+#define HOST_GEN_TABLES_PI         (3.14159265358979323846)
+
+/* Value of table entry index of a table of size 2^size */
+typedef sint32 (*THostGenTables_Value)(uint8 size, uint32 index);
+
+/* One table, generated for all sizes */
+typedef struct
+{
+    const char*          type;         /* Element type */
+    const char*          symbol;       /* Table symbol */
+    const char*          sizeMacro;    /* Configuration of the table size */
+    const char*          sizeOption;   /* Prefix of the size options, NULL to compare with the plain number */
+    uint8                periodShift;  /* Table of 2^-periodShift of the period with 2^(size - periodShift) intervals */
+    uint32               extraEntries; /* Number of entries after the last interval */
+    THostGenTables_Value value;        /* Entry values */
+} THostGenTables_Table;
+
+static const uint8 HostGenTables_sizes[HOST_GEN_TABLES_SIZE_COUNT] = HOST_GEN_TABLES_SIZES;
+
+static const char  HostGenTables_copyright[] =
+    "/*\n"
+    " * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.\n"
+    " *\n"
+    " * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary "
+    "course of\n"
+    " * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long "
+    "as no\n"
+    " * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement "
+    "distributed\n"
+    " * along with this file within the software delivery package.\n"
+    " *\n"
+    " */\n"
+    "\n";
+
+/* Rounds to the nearest integer and saturates to the Q15 range */
+static sint32 HostGenTables_roundSat16(float64 value)
+{
+    return (sint32)fmax(-32768.0, fmin(32767.0, (float64)lround(value)));
+}
+
+
+/* atan(i / 2^size), normalized by 2*pi to 2^16 */
+static sint32 HostGenTables_atan(uint8 size, uint32 index)
+{
+    return (sint32)lround(atan((float64)index / (float64)(1u << size)) / (2.0 * HOST_GEN_TABLES_PI) * 65536.0);
+}
+
+
+/* sqrt(i / 2^size) * (2^15 - 1), rounded down */
+static sint32 HostGenTables_sqrt(uint8 size, uint32 index)
+{
+    return (sint32)floor(sqrt((float64)index / (float64)(1u << size)) * 32767.0);
+}
+
+
+/* sin(2*pi * i / 2^size) in Q15 */
+static sint32 HostGenTables_sin(uint8 size, uint32 index)
+{
+    return HostGenTables_roundSat16(sin(2.0 * HOST_GEN_TABLES_PI * (float64)index / (float64)(1u << size)) * 32768.0);
+}
+
+
+/* sin(pi/2 * i / 2^(size - 2)) in Q15, the entry after sin(pi/2) mirrors the entry before */
+static sint32 HostGenTables_sinQuarter(uint8 size, uint32 index)
+{
+    uint32 intervals = 1u << (size - 2u);
+
+    if (index > intervals)
+    {
+        index = (2u * intervals) - index;
+    }
+
+    return HostGenTables_roundSat16(sin((HOST_GEN_TABLES_PI / 2.0) * (float64)index / (float64)intervals) * 32768.0);
+}
+
+
+/* sqrt(3) * sin(60deg * i / (2^size - 1)) in Q14 */
+static sint32 HostGenTables_sin60Sqrt3(uint8 size, uint32 index)
+{
+    return (sint32)lround(sqrt(3.0) * sin((HOST_GEN_TABLES_PI / 3.0) * (float64)index / (float64)((1u << size) - 1u))
+                          * 16384.0);
+}
+
+
+static const THostGenTables_Table HostGenTables_atanTable = {
+    "uint16", "Ifx_Math_Lut_Atan_F16_table", "IFX_MATH_CFG_ATAN_LUT_SIZE", "IFX_MATH_USROPT_ATAN_LUT_SIZE_", 0u,
+    1u, HostGenTables_atan
+};
+
+static const THostGenTables_Table HostGenTables_cartToPolarTable = {
+    "Ifx_Math_Fract16", "Ifx_Math_Lut_CartToPolar_F16_table", "IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE",
+    "IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_", 0u, 1u, HostGenTables_sqrt
+};
+
+static const THostGenTables_Table HostGenTables_sinTable = {
+    "Ifx_Math_Fract16", "Ifx_Math_Lut_Sincos_F16_table", "IFX_MATH_CFG_SIN_LUT_SIZE", "IFX_MATH_USROPT_SIN_LUT_SIZE_",
+    0u, 1u, HostGenTables_sin
+};
+
+static const THostGenTables_Table HostGenTables_sinQuarterTable = {
+    "Ifx_Math_Fract16", "Ifx_Math_Lut_SinQuarter_F16_table", "IFX_MATH_CFG_SIN_LUT_SIZE",
+    "IFX_MATH_USROPT_SIN_LUT_SIZE_", 2u, 2u, HostGenTables_sinQuarter
+};
+
+static const THostGenTables_Table HostGenTables_sin60Sqrt3Table = {
+    "Ifx_Math_Fract16", "Ifx_MAS_ModulatorF16_lutSin60Sqrt3", "IFX_MAS_MODULATORF16_CFG_LUT_SIZE", NULL, 0u, 0u,
+    HostGenTables_sin60Sqrt3
+};
+
+/* Number of entries of a table of size 2^size */
+static uint32 HostGenTables_entries(const THostGenTables_Table* table, uint8 size)
+{
+    return (1u << (size - table->periodShift)) + table->extraEntries;
+}
+
+
+/* Writes the tables of all sizes, each guarded by the size configuration */
+static void HostGenTables_writeSizes(FILE* file, const THostGenTables_Table* table)
+{
+    uint32 sizeIndex;
+
+    for (sizeIndex = 0; sizeIndex < HOST_GEN_TABLES_SIZE_COUNT; sizeIndex++)
+    {
+        uint8  size    = HostGenTables_sizes[sizeIndex];
+        uint32 entries = HostGenTables_entries(table, size);
+        uint32 column  = 3u;
+        uint32 index;
+
+        if (sizeIndex > 0u)
+        {
+            (void)fprintf(file, "\n#elif ");
+        }
+        else
+        {
+            (void)fprintf(file, "#if ");
+        }
+
+        if (table->sizeOption != NULL)
+        {
+            (void)fprintf(file, "%s == %s%u\n", table->sizeMacro, table->sizeOption, (unsigned)size);
+        }
+        else
+        {
+            (void)fprintf(file, "%s == %u\n", table->sizeMacro, (unsigned)size);
+        }
+
+        (void)fprintf(file, "const %s %s[%u] = {\n   ", table->type, table->symbol, (unsigned)entries);
+
+        for (index = 0; index < entries; index++)
+        {
+            char   text[16];
+            uint32 length = (uint32)snprintf(text, sizeof(text), (index < (entries - 1u)) ? " %d," : " %d",
+                (int)table->value(size, index));
+
+            /* Wrap before the line would exceed the line width */
+            if ((column + length) > HOST_GEN_TABLES_LINE_WIDTH)
+            {
+                (void)fprintf(file, "\n   ");
+                column = 3u;
+            }
+
+            (void)fputs(text, file);
+            column += length;
+        }
+
+        (void)fprintf(file, "\n};\n");
+    }
+
+    (void)fprintf(file, "\n#endif\n");
+}
+
+
+/* Writes the list of sizes as "8, 9, 10, 11, 12" */
+static void HostGenTables_writeSizeList(FILE* file)
+{
+    uint32 sizeIndex;
+
+    for (sizeIndex = 0; sizeIndex < HOST_GEN_TABLES_SIZE_COUNT; sizeIndex++)
+    {
+        (void)fprintf(file, (sizeIndex > 0u) ? ", %u" : "%u", (unsigned)HostGenTables_sizes[sizeIndex]);
+    }
+}
+
+
+/* Opens directory/name for writing and writes the copyright header */
+static FILE* HostGenTables_open(const char* directory, const char* name)
+{
+    char  path[512];
+    FILE* file;
+
+    (void)snprintf(path, sizeof(path), "%s/%s", directory, name);
+    file = fopen(path, "w");
+
+    if (file != NULL)
+    {
+        (void)fputs(HostGenTables_copyright, file);
+    }
+    else
+    {
+        (void)fprintf(stderr, "cannot write %s\n", path);
+    }
+
+    return file;
+}
+
+
+static bool HostGenTables_writeAtan(const char* directory)
+{
+    FILE* file = HostGenTables_open(directory, "Ifx_Math_Lut_Atan_F16_Table.c");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    (void)fprintf(file, "#include \"Ifx_Math_Atan.h\"\n#include \"Ifx_Math.h\"\n\n");
+    (void)fprintf(file, "/**\n * Lookup table between \\f$atan(0)\\f$ and \\f$atan(1)\\f$\n");
+    (void)fprintf(file, " * Tables are available for IFX_MATH_CFG_ATAN_LUT_SIZE = ");
+    HostGenTables_writeSizeList(file);
+    (void)fprintf(file, " bit\n * Table size is (2^IFX_MATH_CFG_ATAN_LUT_SIZE) + 1\n");
+    (void)fprintf(file, " * Generated by foc_gen_tables of the host build\n */\n\n");
+    HostGenTables_writeSizes(file, &HostGenTables_atanTable);
+
+    return (fclose(file) == 0) ? true : false;
+}
+
+
+static bool HostGenTables_writeCartToPolar(const char* directory)
+{
+    FILE* file = HostGenTables_open(directory, "Ifx_Math_Lut_CartToPolar_F16_Table.c");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    (void)fprintf(file, "#include \"Ifx_Math.h\"\n#include \"Ifx_Math_CartToPolar.h\"\n\n");
+    (void)fprintf(file, "/**\n * Lookup table between 0 and 1\n");
+    (void)fprintf(file, " * Tables are available for IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE = ");
+    HostGenTables_writeSizeList(file);
+    (void)fprintf(file, " bit\n * Table size is (2^IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE) + 1\n");
+    (void)fprintf(file, " * Generated by foc_gen_tables of the host build\n */\n\n");
+    HostGenTables_writeSizes(file, &HostGenTables_cartToPolarTable);
+
+    return (fclose(file) == 0) ? true : false;
+}
+
+
+static bool HostGenTables_writeSinCos(const char* directory)
+{
+    FILE* file = HostGenTables_open(directory, "Ifx_Math_Lut_SinCos_F16_Table.c");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    (void)fprintf(file, "#include \"Ifx_Math_Sin.h\"\n#include \"Ifx_Math.h\"\n\n");
+    (void)fprintf(file, "#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED\n\n");
+    (void)fprintf(file, "/**\n * Lookup table between \\f$sin(0)\\f$ and \\f$sin(\\pi/2)\\f$ for the interpolation of "
+                        "IFX_MATH_USROPT_SIN_MODE_INTERPOLATED\n");
+    (void)fprintf(file, " * Tables are available for IFX_MATH_CFG_SIN_LUT_SIZE = ");
+    HostGenTables_writeSizeList(file);
+    (void)fprintf(file, " bit, the resolution per period.\n");
+    (void)fprintf(file, " * Table size is (2^(IFX_MATH_CFG_SIN_LUT_SIZE - 2)) + 2, the last entry mirrors the entry "
+                        "before \\f$sin(\\pi/2)\\f$ so\n * that the interpolation at \\f$\\pi/2\\f$ stays within the "
+                        "table.\n");
+    (void)fprintf(file, " * Generated by foc_gen_tables of the host build\n */\n");
+    HostGenTables_writeSizes(file, &HostGenTables_sinQuarterTable);
+    (void)fprintf(file, "\n#else\n\n");
+    (void)fprintf(file, "/**\n * Lookup table between \\f$sin(0)\\f$ and \\f$sin(2*\\pi)\\f$\n");
+    (void)fprintf(file, " * Tables are available for IFX_MATH_CFG_SIN_LUT_SIZE = ");
+    HostGenTables_writeSizeList(file);
+    (void)fprintf(file, " bit.\n * Table size is (2^IFX_MATH_CFG_SIN_LUT_SIZE) + 1\n");
+    (void)fprintf(file, " * Generated by foc_gen_tables of the host build\n */\n");
+    HostGenTables_writeSizes(file, &HostGenTables_sinTable);
+    (void)fprintf(file, "\n#endif /* IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED */\n");
+
+    return (fclose(file) == 0) ? true : false;
+}
+
+
+static bool HostGenTables_writeSin60Sqrt3(const char* directory)
+{
+    FILE* file = HostGenTables_open(directory, "Ifx_MAS_ModulatorF16_tableSin60Sqrt3.c");
+
+    if (file == NULL)
+    {
+        return false;
+    }
+
+    (void)fprintf(file, "#include \"Ifx_MAS_ModulatorF16.h\"\n\n");
+    (void)fprintf(file, "/**\n * Lookup table to store the values needed to calculate the switching times.\n *\n");
+    (void)fprintf(file, " * Values: sqrt(3) * sin(x/(2^n - 1) * 60deg), x = 0,1,...,2^n - 1, in signed integer q14 "
+                        "format.[0 ... 1.5]\n");
+    (void)fprintf(file, " * Tables are available for IFX_MAS_MODULATORF16_CFG_LUT_SIZE n = ");
+    HostGenTables_writeSizeList(file);
+    (void)fprintf(file, " bit\n * Generated by foc_gen_tables of the host build\n */\n");
+    HostGenTables_writeSizes(file, &HostGenTables_sin60Sqrt3Table);
+
+    return (fclose(file) == 0) ? true : false;
+}
+
+
+int main(int argc, char** argv)
+{
+    bool success;
+
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "usage: %s <output directory>\n", argv[0]);
+        return 2;
+    }
+
+    success = HostGenTables_writeAtan(argv[1]);
+    success = (HostGenTables_writeCartToPolar(argv[1]) == true) ? success : false;
+    success = (HostGenTables_writeSinCos(argv[1]) == true) ? success : false;
+    success = (HostGenTables_writeSin60Sqrt3(argv[1]) == true) ? success : false;
+
+    return (success == true) ? 0 : 1;
+}
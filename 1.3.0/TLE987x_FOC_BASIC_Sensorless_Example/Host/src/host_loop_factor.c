@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_loop_factor.c
+ * \brief Closed loop run against the PMSM plant with the current loop factor switched at runtime.
+ *
+ * Built against foc_stack_loopfactor, i.e. with IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR enabled. The
+ * reference speed steps through a profile of low and high speeds. Each run keeps the current loop factor constant or
+ * adapts it to the estimated speed in the speed loop, which decimates the fast loop at low speed and runs it in every
+ * PWM period at high speed. Per run the tracking of the speed, the largest step of the estimated speed and of the
+ * angle error of the flux estimator from one fast loop to the next (a glitch at a switch shows up there) and the
+ * fast loop time per simulated millisecond are printed, the latter per current loop factor in use.
+ *
+ * Usage: foc_loop_factor [low speed factor] [medium speed factor] [load torque mNm]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "host_foc.h"
+#include "host_plant.h"
+
+/* Number of speed steps of the profile */
+#define HOST_LOOP_FACTOR_STEPS       (4u)
+
+/* Part of each speed step at its end which is evaluated as steady state */
+#define HOST_LOOP_FACTOR_STEADY_PART (0.25)
+
+/* Speed thresholds of the adaptive factor between the low, the medium and the high speed range, in rpm */
+#define HOST_LOOP_FACTOR_MID_SPEED   (800.0)
+#define HOST_LOOP_FACTOR_HIGH_SPEED  (1300.0)
+
+/* Hysteresis of the speed thresholds of the adaptive factor, in rpm */
+#define HOST_LOOP_FACTOR_HYSTERESIS  (100.0)
+
+/* Factor given to the runs which adapt the factor to the speed */
+#define HOST_LOOP_FACTOR_ADAPTIVE    (0u)
+
+/* Estimated speed in rpm of a speed in Q15 */
+#define HOST_LOOP_FACTOR_RPM(speedQ15) \
+    (((float64)(speedQ15) * (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_MECH_SPEED_RPM) / 32768.0)
+
+/* Step of the speed profile */
+typedef struct
+{
+    float64 duration_s;      /* Duration of the step */
+    sint16  referenceRpm;    /* Reference speed */
+} THostLoopFactor_Step;
+
+/* Result of one run */
+typedef struct
+{
+    float64 speedErrorRms[HOST_LOOP_FACTOR_STEPS];   /* RMS speed error in steady state of each step */
+    float64 speedStepMax_rpm;                        /* Largest step of the estimated speed between two fast loops */
+    float64 angleStepMax_deg;                        /* Largest step of the angle error between two fast loops */
+    float64 time_s[IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX + 1];    /* Simulated time per factor */
+    uint64  fastLoopNs[IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX + 1]; /* Fast loop time per factor */
+    uint32  switches;                                /* Number of switches of the factor in use */
+    sint32  state;                                   /* FOC state at the end of the run */
+} THostLoopFactor_Result;
+
+/* Speed profile: start-up, high speed, medium speed and back to low speed */
+static const THostLoopFactor_Step HostLoopFactor_profile[HOST_LOOP_FACTOR_STEPS] = {
+    {1.5, 600},
+    {2.0, 1600},
+    {1.5, 1000},
+    {2.0, 500},
+};
+
+/* Returns the current loop factor for the estimated speed, 1 at high speed */
+static uint8 HostLoopFactor_policy(float64 speedRpm, uint8 factor, uint8 lowSpeedFactor, uint8 midSpeedFactor)
+{
+    static const float64 thresholds[2] = {HOST_LOOP_FACTOR_MID_SPEED, HOST_LOOP_FACTOR_HIGH_SPEED};
+    const uint8          factors[3]    = {lowSpeedFactor, midSpeedFactor, 1u};
+    uint8                range         = 0u;
+    uint8                current       = 0u;
+
+    while ((current < 2u) && (factors[current] != factor))
+    {
+        current++;
+    }
+
+    while ((range < 2u) && (fabs(speedRpm) >= (thresholds[range] - ((range < current) ? HOST_LOOP_FACTOR_HYSTERESIS
+                                                                                           : 0.0))))
+    {
+        range++;
+    }
+
+    return factors[range];
+}
+
+
+/* Wraps an angle difference to (-180, 180] degrees */
+static float64 HostLoopFactor_wrapDeg(float64 angle_deg)
+{
+    while (angle_deg > 180.0)
+    {
+        angle_deg -= 360.0;
+    }
+
+    while (angle_deg <= -180.0)
+    {
+        angle_deg += 360.0;
+    }
+
+    return angle_deg;
+}
+
+
+/* Runs the speed profile with a constant factor, or with HOST_LOOP_FACTOR_ADAPTIVE adapting it to the speed */
+static void HostLoopFactor_run(THostLoopFactor_Result* result, uint8 factor, uint8 lowSpeedFactor,
+                               uint8 midSpeedFactor, float64 loadTorque_Nm)
+{
+    THostPlant_Params params;
+    THostPlant        plant;
+    float64           lastSpeed_rpm  = 0.0;
+    float64           lastAngleError = 0.0;
+    bool              tracking       = false;
+    uint8             inUse;
+    uint8             latched;
+    uint32            step;
+    uint32            index;
+
+    for (index = 0u; index <= IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX; index++)
+    {
+        result->time_s[index]     = 0.0;
+        result->fastLoopNs[index] = 0u;
+    }
+
+    result->speedStepMax_rpm = 0.0;
+    result->angleStepMax_deg = 0.0;
+    result->switches         = 0u;
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    inUse = Ifx_MS_FocSolutionF16_getCurrentLoopFactor(&FocDemoClosedLoop);
+
+    /* A constant factor is latched by the first fast loop and not counted as a switch */
+    if (factor != HOST_LOOP_FACTOR_ADAPTIVE)
+    {
+        (void)Ifx_MS_FocSolutionF16_setCurrentLoopFactor(&FocDemoClosedLoop, factor);
+        inUse = factor;
+    }
+
+    latched                      = inUse;
+    HostFoc_inputs.enableControl = 1;
+
+    for (step = 0u; step < HOST_LOOP_FACTOR_STEPS; step++)
+    {
+        uint32  periods       = (uint32)(HostLoopFactor_profile[step].duration_s / HOST_FOC_PWM_PERIOD_S);
+        uint32  steadyPeriods = (uint32)((float64)periods * HOST_LOOP_FACTOR_STEADY_PART);
+        float64 errorSqSum    = 0.0;
+        uint32  period;
+
+        HostFoc_inputs.referenceSpeedQ0 = HostLoopFactor_profile[step].referenceRpm;
+
+        for (period = 0u; period < periods; period++)
+        {
+            uint64 oneMatchNs;
+            uint8  factorInUse = Ifx_MS_FocSolutionF16_getCurrentLoopFactor(&FocDemoClosedLoop);
+
+            /* Same sequence as HostPlant_stepClosedLoop(), with time stamps around the fast loop */
+            HostPlant_runUpCounting(&plant);
+            HostFoc_PeriodMatch();
+            HostPlant_latchUpCounting(&plant);
+            HostPlant_runDownCounting(&plant);
+
+            oneMatchNs = HostBench_nowNs();
+
+            if (HostFoc_OneMatch() == true)
+            {
+                Ifx_MDA_FluxEstimatorF16_Output estimate;
+                float64                         speed_rpm;
+                float64                         angleError;
+
+                /* The factor latched by this fast loop is accounted from here on */
+                factorInUse                     = Ifx_MS_FocSolutionF16_getCurrentLoopFactor(&FocDemoClosedLoop);
+                result->fastLoopNs[factorInUse] += HostBench_nowNs() - oneMatchNs;
+
+                if (factorInUse != latched)
+                {
+                    result->switches++;
+                    latched = factorInUse;
+                }
+
+                Ifx_MDA_FluxEstimatorF16_getOutput(&(FocDemoClosedLoop.fluxEstimator), &estimate);
+                speed_rpm  = HOST_LOOP_FACTOR_RPM(estimate.speedQ15);
+                angleError = HostLoopFactor_wrapDeg(((float64)estimate.anglePLL * (360.0 / 4294967296.0))
+                                                    - (plant.angleElec_rad * (180.0 / 3.14159265358979323846)));
+
+                /* Estimate is only evaluated once the flux estimator tracks the rotor in closed loop */
+                if (Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).subState
+                    == Ifx_MS_FocSolutionF16_SubState_closedLoop)
+                {
+                    if (tracking == true)
+                    {
+                        result->speedStepMax_rpm = fmax(result->speedStepMax_rpm, fabs(speed_rpm - lastSpeed_rpm));
+                        result->angleStepMax_deg = fmax(result->angleStepMax_deg,
+                            fabs(HostLoopFactor_wrapDeg(angleError - lastAngleError)));
+                    }
+
+                    tracking = true;
+                }
+                else
+                {
+                    tracking = false;
+                }
+
+                lastSpeed_rpm  = speed_rpm;
+                lastAngleError = angleError;
+            }
+
+            HostPlant_latchDownCounting(&plant);
+            result->time_s[factorInUse] += HOST_FOC_PWM_PERIOD_S;
+
+            if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+            {
+                HostFoc_SpeedLoop();
+                HostFoc_Background();
+
+                if (factor == HOST_LOOP_FACTOR_ADAPTIVE)
+                {
+                    Ifx_MS_FocSolutionF16_Output output;
+                    Ifx_MS_FocSolutionF16_getOutput(&FocDemoClosedLoop, &output);
+                    inUse = HostLoopFactor_policy(HOST_LOOP_FACTOR_RPM(output.estimatedSpeedQ15), inUse,
+                        lowSpeedFactor, midSpeedFactor);
+                    (void)Ifx_MS_FocSolutionF16_setCurrentLoopFactor(&FocDemoClosedLoop, inUse);
+                }
+            }
+
+            if (period >= (periods - steadyPeriods))
+            {
+                float64 error = HostPlant_getSpeedRpm(&plant) - (float64)HostLoopFactor_profile[step].referenceRpm;
+                errorSqSum += error * error;
+            }
+        }
+
+        result->speedErrorRms[step] = sqrt(errorSqSum / (float64)steadyPeriods);
+    }
+
+    result->state = (sint32)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state;
+}
+
+
+/* Prints the result of one run */
+static void HostLoopFactor_print(const char* name, const THostLoopFactor_Result* result)
+{
+    float64 totalTime_s = 0.0;
+    uint64  totalNs     = 0u;
+    uint32  step;
+    uint32  index;
+
+    (void)printf("%-10s %5d %8u", name, (int)result->state, (unsigned)result->switches);
+
+    for (step = 0u; step < HOST_LOOP_FACTOR_STEPS; step++)
+    {
+        (void)printf(" %7.2f", result->speedErrorRms[step]);
+    }
+
+    (void)printf(" %9.2f %9.2f", result->speedStepMax_rpm, result->angleStepMax_deg);
+
+    for (index = 1u; index <= IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX; index++)
+    {
+        totalTime_s += result->time_s[index];
+        totalNs     += result->fastLoopNs[index];
+    }
+
+    (void)printf(" %9.0f  ", (float64)totalNs / (totalTime_s * 1000.0));
+
+    for (index = 1u; index <= IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX; index++)
+    {
+        if (result->fastLoopNs[index] > 0u)
+        {
+            (void)printf(" %u:%.0f (%.0f%%)", (unsigned)index,
+                (float64)result->fastLoopNs[index] / (result->time_s[index] * 1000.0),
+                (result->time_s[index] * 100.0) / totalTime_s);
+        }
+    }
+
+    (void)printf("\n");
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    uint8                  lowSpeedFactor = (argc > 1) ? (uint8)atoi(argv[1]) : 4u;
+    uint8                  midSpeedFactor = (argc > 2) ? (uint8)atoi(argv[2]) : 2u;
+    float64                loadTorque_Nm  = (argc > 3) ? (atof(argv[3]) / 1000.0) : 0.0;
+    const uint8            constants[4]   = {1u, midSpeedFactor, IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR,
+                                             lowSpeedFactor};
+    THostLoopFactor_Result result;
+    char                   name[16];
+    uint32                 step;
+
+    if ((lowSpeedFactor < 1u) || (lowSpeedFactor > IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX)
+        || (midSpeedFactor < 1u) || (midSpeedFactor > IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX))
+    {
+        (void)fprintf(stderr, "factors have to be in 1..%u\n", (unsigned)IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX);
+        return 1;
+    }
+
+    (void)printf("profile             :");
+
+    for (step = 0u; step < HOST_LOOP_FACTOR_STEPS; step++)
+    {
+        (void)printf(" %d rpm for %.1f s,", (int)HostLoopFactor_profile[step].referenceRpm,
+            HostLoopFactor_profile[step].duration_s);
+    }
+
+    (void)printf(" %.1f mNm load\n", loadTorque_Nm * 1000.0);
+    (void)printf("adaptive factor     : %u below %.0f rpm, %u below %.0f rpm, 1 above, %.0f rpm hysteresis\n",
+        (unsigned)lowSpeedFactor, HOST_LOOP_FACTOR_MID_SPEED, (unsigned)midSpeedFactor, HOST_LOOP_FACTOR_HIGH_SPEED,
+        HOST_LOOP_FACTOR_HYSTERESIS);
+    (void)printf("configured factor   : %u, PWM %u kHz\n\n", (unsigned)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR,
+        (unsigned)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ);
+    (void)printf("%-10s %5s %8s %31s %9s %9s %9s   %s\n", "run", "state", "switches", "speed error rms per step [rpm]",
+        "dSpd max", "dAng max", "ns/ms", "ns/ms per factor (time share)");
+
+    for (step = 0u; step < (uint32)(sizeof(constants) / sizeof(constants[0])); step++)
+    {
+        uint8 factor = constants[step];
+
+        HostLoopFactor_run(&result, factor, lowSpeedFactor, midSpeedFactor, loadTorque_Nm);
+        (void)snprintf(name, sizeof(name), "constant %u", (unsigned)factor);
+        HostLoopFactor_print(name, &result);
+    }
+
+    HostLoopFactor_run(&result, HOST_LOOP_FACTOR_ADAPTIVE, lowSpeedFactor, midSpeedFactor, loadTorque_Nm);
+    HostLoopFactor_print("adaptive", &result);
+
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_main.c
+ * \brief Runs the complete FOC stack on the host with static ADC inputs and reports the cost of the fast loop.
+ *
+ * Usage: foc_host [simulated seconds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "host_foc.h"
+#include "host_sfr.h"
+
+/* ADC mid scale, i.e. zero shunt current after offset calibration */
+#define HOST_MAIN_ADC_CURRENT_ZERO (2048u)
+
+/* VDH result for half of the base voltage (12 V): CONVERT_VDC_TO_Q15 * raw >> VDC_BITS = 16384 */
+#define HOST_MAIN_ADC_VDH_12V      (1638u)
+
+/* Returns a monotonic time stamp in nanoseconds */
+static uint64 HostMain_nowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64)ts.tv_sec * 1000000000ULL) + (uint64)ts.tv_nsec;
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Simulated duration */
+    float64 simulatedSeconds = (argc > 1) ? atof(argv[1]) : 1.0;
+    uint32  periods          = (uint32)(simulatedSeconds / HOST_FOC_PWM_PERIOD_S);
+
+    /* Statistics */
+    uint64  fastLoopCalls = 0;
+    uint64  fastLoopNs    = 0;
+    uint64  startNs;
+    uint64  totalNs;
+    uint32  period;
+
+    HostFoc_Init();
+
+    /* Static measurement inputs */
+    HostSfr.adc1.RES_OUT_EIM.reg = HOST_MAIN_ADC_CURRENT_ZERO;
+    HostSfr.adc1.RES_OUT1.reg    = HOST_MAIN_ADC_CURRENT_ZERO;
+    HostSfr.adc1.RES_OUT6.reg    = HOST_MAIN_ADC_VDH_12V;
+
+    /* Request 1000 rpm */
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = 1000;
+
+    startNs = HostMain_nowNs();
+
+    for (period = 0; period < periods; period++)
+    {
+        /* Time stamp of the one match interrupt entry */
+        uint64 oneMatchNs;
+
+        HostFoc_PeriodMatch();
+
+        oneMatchNs = HostMain_nowNs();
+
+        if (HostFoc_OneMatch() == true)
+        {
+            fastLoopNs += HostMain_nowNs() - oneMatchNs;
+            fastLoopCalls++;
+        }
+
+        if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+        {
+            HostFoc_SpeedLoop();
+            HostFoc_Background();
+        }
+    }
+
+    totalNs = HostMain_nowNs() - startNs;
+
+    (void)printf("simulated time        : %.3f s (%u PWM periods)\n", simulatedSeconds, (unsigned)periods);
+    (void)printf("wall time             : %.3f s\n", (float64)totalNs * 1e-9);
+    (void)printf("simulated s per wall s: %.1f\n", simulatedSeconds / ((float64)totalNs * 1e-9));
+    (void)printf("fast loop calls       : %llu\n", (unsigned long long)fastLoopCalls);
+    (void)printf("fast loop mean        : %.1f ns\n",
+        (fastLoopCalls > 0u) ? ((float64)fastLoopNs / (float64)fastLoopCalls) : 0.0);
+    (void)printf("FOC state             : %d\n", (int)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state);
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_modulator_overmodulation.c
+ * \brief Fundamental voltage, actual voltage feedback and current measurement windows of Ifx_MAS_ModulatorF16 over the
+ * modulation index, for the configured IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE.
+ *
+ * For each modulation index the reference vector runs through HOST_MODULATOR_OVERMODULATION_ANGLES angles of one
+ * electrical revolution. The voltage applied in each PWM period is taken from the duty cycles of the compare values,
+ * the fundamental is its first Fourier coefficient over the revolution. The columns are
+ * - fundamental: amplitude of the fundamental, related to the DC link voltage and to six-step (2/pi),
+ * - feedback error: largest distance between the applied vector and output actualVoltage, related to the DC link
+ *   voltage,
+ * - flagged: periods with currentReconstructionInfo.measurementValid == false,
+ * - unflagged: periods with a measurement window too short, see foc_modulator_windows, which are not flagged.
+ *
+ * Usage: foc_modulator_overmodulation (IFX_MAS_MODULATORF16_OVERMODULATION_MODE_MEASURABLE)
+ *        foc_modulator_sixstep        (IFX_MAS_MODULATORF16_OVERMODULATION_MODE_SIXSTEP)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include "Ifx_MAS_ModulatorF16.h"
+
+/* Angles per electrical revolution */
+#define HOST_MODULATOR_OVERMODULATION_ANGLES   (3072u)
+
+/* DC link voltage, half of the base voltage */
+#define HOST_MODULATOR_OVERMODULATION_DC_LINK  (16384)
+
+/* PWM period of the configuration */
+#define HOST_MODULATOR_OVERMODULATION_PERIOD   ((sint32)IFX_MAS_MODULATORF16_CFG_PERIOD_TICK)
+
+/* Smallest valid distances of the triggers from the last and to the next switching event */
+#define HOST_MODULATOR_OVERMODULATION_BEFORE   ((sint32)(IFX_MAS_MODULATORF16_CFG_DRIVERDELAY_TICK + \
+                                                         IFX_MAS_MODULATORF16_CFG_DEADTIME_TICK +    \
+                                                         IFX_MAS_MODULATORF16_CFG_RINGINGTIME_TICK))
+#define HOST_MODULATOR_OVERMODULATION_AFTER    ((sint32)(IFX_MAS_MODULATORF16_CFG_MEASUREMENTTIME_TICK - \
+                                                         IFX_MAS_MODULATORF16_CFG_DRIVERDELAY_TICK))
+
+#define HOST_MODULATOR_OVERMODULATION_PI       (3.14159265358979323846)
+
+/* Modulation indices of the table: linear region, stage I up to 0.6057, stage II up to six-step, beyond six-step */
+static const float64 HostModulatorOvermodulation_modIndex[] = {
+    0.50, 0.55, 0.5774, 0.585, 0.595, 0.6057, 0.615, 0.625, 0.630, 0.635, 0.6366, 0.65
+};
+
+/* Distance from a to b along the periodic time line of one PWM period */
+static sint32 HostModulatorOvermodulation_distance(sint32 a, sint32 b)
+{
+    sint32 distance = (b - a) % HOST_MODULATOR_OVERMODULATION_PERIOD;
+
+    return (distance < 0) ? (distance + HOST_MODULATOR_OVERMODULATION_PERIOD) : distance;
+}
+
+
+/* Checks the distances of both triggers to the switching events of the phases, true if both windows are valid */
+static bool HostModulatorOvermodulation_windowsValid(const Ifx_MAS_ModulatorF16_Output* output)
+{
+    bool  valid = true;
+    uint8 k;
+    uint8 t;
+
+    for (k = 0u; k < 3u; k++)
+    {
+        sint32 on  = (sint32)output->compareValues_tick[k];
+        sint32 off = (sint32)output->compareValues_tick[k + 3u];
+
+        /* Phases on or off for the whole period do not switch */
+        if ((off <= on) || ((off - on) == HOST_MODULATOR_OVERMODULATION_PERIOD))
+        {
+            continue;
+        }
+
+        for (t = 0u; t < 2u; t++)
+        {
+            sint32 trigger = (sint32)output->triggerTime_tick[t];
+            sint32 before  = HostModulatorOvermodulation_distance(on, trigger);
+            sint32 after   = HostModulatorOvermodulation_distance(trigger, on);
+
+            before = (HostModulatorOvermodulation_distance(off, trigger) < before) ?
+                     HostModulatorOvermodulation_distance(off, trigger) : before;
+            after  = (HostModulatorOvermodulation_distance(trigger, off) < after) ?
+                     HostModulatorOvermodulation_distance(trigger, off) : after;
+
+            if ((before < HOST_MODULATOR_OVERMODULATION_BEFORE) || (after < HOST_MODULATOR_OVERMODULATION_AFTER))
+            {
+                valid = false;
+            }
+        }
+    }
+
+    return valid;
+}
+
+
+/* Runs one revolution at one modulation index and prints one table row */
+static void HostModulatorOvermodulation_row(float64 modIndex)
+{
+    Ifx_MAS_ModulatorF16        modulator;
+    Ifx_MAS_ModulatorF16_Output output;
+    Ifx_Math_PolarFract16       refVoltage;
+    Ifx_Math_3PhaseFract16      currents  = {0, 0, 0};
+    float64                     sumReal   = 0.0;
+    float64                     sumImag   = 0.0;
+    float64                     maxError  = 0.0;
+    uint32                      flagged   = 0u;
+    uint32                      unflagged = 0u;
+    uint32                      i;
+
+    Ifx_MAS_ModulatorF16_init(&modulator);
+    Ifx_MAS_ModulatorF16_setMaxAmplitude(&modulator, 32767);
+    Ifx_MAS_ModulatorF16_enable(&modulator, true);
+
+    refVoltage.amplitude = (Ifx_Math_Fract16)lround(modIndex * (float64)HOST_MODULATOR_OVERMODULATION_DC_LINK);
+    refVoltage.angle     = 0u;
+    Ifx_MAS_ModulatorF16_execute(&modulator, refVoltage, HOST_MODULATOR_OVERMODULATION_DC_LINK, currents);
+
+    for (i = 0u; i < HOST_MODULATOR_OVERMODULATION_ANGLES; i++)
+    {
+        float64 angle = (2.0 * HOST_MODULATOR_OVERMODULATION_PI * (float64)i) /
+                        (float64)HOST_MODULATOR_OVERMODULATION_ANGLES;
+        float64 duty[3];
+        float64 real;
+        float64 imag;
+        float64 feedbackAngle;
+        float64 feedbackAmplitude;
+        float64 error;
+        uint8   k;
+
+        refVoltage.angle = (uint32)(((uint64)i << 32) / HOST_MODULATOR_OVERMODULATION_ANGLES);
+        Ifx_MAS_ModulatorF16_execute(&modulator, refVoltage, HOST_MODULATOR_OVERMODULATION_DC_LINK, currents);
+        Ifx_MAS_ModulatorF16_getOutput(&modulator, &output);
+
+        /* Applied vector from the duty cycles, related to the DC link voltage */
+        for (k = 0u; k < 3u; k++)
+        {
+            sint32 onTime = (sint32)output.compareValues_tick[k + 3u] - (sint32)output.compareValues_tick[k];
+            duty[k] = (onTime > 0) ? ((float64)onTime / (float64)HOST_MODULATOR_OVERMODULATION_PERIOD) : 0.0;
+        }
+
+        real = ((2.0 * duty[0]) - duty[1] - duty[2]) / 3.0;
+        imag = (duty[1] - duty[2]) / sqrt(3.0);
+
+        sumReal += (real * cos(angle)) + (imag * sin(angle));
+        sumImag += (imag * cos(angle)) - (real * sin(angle));
+
+        /* Actual voltage feedback against the applied vector */
+        feedbackAngle     = ((float64)output.actualVoltage.angle * 2.0 * HOST_MODULATOR_OVERMODULATION_PI) /
+                            4294967296.0;
+        feedbackAmplitude = (float64)output.actualVoltage.amplitude / (float64)HOST_MODULATOR_OVERMODULATION_DC_LINK;
+        error             = hypot((feedbackAmplitude * cos(feedbackAngle)) - real,
+            (feedbackAmplitude * sin(feedbackAngle)) - imag);
+        maxError          = (error > maxError) ? error : maxError;
+
+        /* Measurement windows */
+        if (output.currentReconstructionInfo.measurementValid == false)
+        {
+            flagged++;
+        }
+        else if (HostModulatorOvermodulation_windowsValid(&output) == false)
+        {
+            unflagged++;
+        }
+        else
+        {
+            /* Valid and not flagged */
+        }
+    }
+
+    {
+        float64 fundamental = hypot(sumReal, sumImag) / (float64)HOST_MODULATOR_OVERMODULATION_ANGLES;
+
+        (void)printf("%8.4f %8.4f %7.2f %% %12.2f %% %7.1f %% %9u %s\n", modIndex, fundamental,
+            (100.0 * fundamental * HOST_MODULATOR_OVERMODULATION_PI) / 2.0, 100.0 * maxError,
+            (100.0 * (float64)flagged) / (float64)HOST_MODULATOR_OVERMODULATION_ANGLES, (unsigned)unflagged,
+            (Ifx_MAS_ModulatorF16_getStatus(&modulator).overmodulationFlag == true) ? "overmodulation" : "");
+    }
+}
+
+
+int main(void)
+{
+    uint32 i;
+
+    (void)printf("IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE %d, %u angles per revolution\n\n",
+        IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE, (unsigned)HOST_MODULATOR_OVERMODULATION_ANGLES);
+    (void)printf("modIndex   fundamental      feedback error   flagged unflagged\n");
+
+    for (i = 0u; i < (sizeof(HostModulatorOvermodulation_modIndex) / sizeof(HostModulatorOvermodulation_modIndex[0]));
+         i++)
+    {
+        HostModulatorOvermodulation_row(HostModulatorOvermodulation_modIndex[i]);
+    }
+
+    return 0;
+}
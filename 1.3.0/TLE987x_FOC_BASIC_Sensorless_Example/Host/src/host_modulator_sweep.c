@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_modulator_sweep.c
+ * \brief Output of Ifx_MAS_ModulatorF16 over a swept angle and amplitude grid, and the cost of one execution.
+ *
+ * The modulator runs through HOST_MODULATOR_SWEEP_AMPLITUDES amplitudes, rising and then falling so that both
+ * substates of the bidirectional shifting hysteresis are passed, for HOST_MODULATOR_SWEEP_ANGLES angles each and for
+ * both measurement points. The phase currents change their signs with the angle. Compare values, triggers and the
+ * current reconstruction info of each execution are written as one record to the output file.
+ *
+ * The tool is built against the project configuration (foc_modulator_sweep) and with the sector table fast path
+ * IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE (foc_modulator_sweep_sectortable). The target foc_check_modulator of
+ * the host build compares the records of both builds. The builds with discontinuous modulation
+ * (foc_modulator_sweep_dpwm60, foc_modulator_sweep_dpwmmin) are evaluated by foc_modulator_windows.
+ *
+ * Usage: foc_modulator_sweep <output file> [calls per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "Ifx_MAS_ModulatorF16.h"
+
+/* Angles per amplitude, prime so that the angles do not repeat the grid of the sin60 lookup table */
+#define HOST_MODULATOR_SWEEP_ANGLES     (1531u)
+
+/* Amplitudes of the rising half of the sweep, up to beyond the linear modulation limit */
+#define HOST_MODULATOR_SWEEP_AMPLITUDES (97u)
+
+/* DC link voltage of the sweep, half of the base voltage */
+#define HOST_MODULATOR_SWEEP_DC_LINK    (16384)
+
+/* Largest amplitude of the sweep, 0.65 of the DC link voltage */
+#define HOST_MODULATOR_SWEEP_MAX_AMP    (10650)
+
+/* Phase current amplitude of the sweep */
+#define HOST_MODULATOR_SWEEP_CURRENT    (8192)
+
+/* Values of one record */
+#define HOST_MODULATOR_SWEEP_RECORD     (12u)
+
+/* Modulator under test */
+static Ifx_MAS_ModulatorF16 HostModulatorSweep_modulator;
+
+/* Sets up an enabled modulator, executed once to leave the init state */
+static void HostModulatorSweep_init(Ifx_MAS_ModulatorF16* modulator)
+{
+    Ifx_MAS_ModulatorF16_init(modulator);
+    Ifx_MAS_ModulatorF16_setMaxAmplitude(modulator, 32767);
+    Ifx_MAS_ModulatorF16_enable(modulator, true);
+}
+
+
+/* Executes the modulator at one grid point, the currents lag the voltage by 30 degree */
+static void HostModulatorSweep_execute(Ifx_MAS_ModulatorF16* modulator, uint32 angle, Ifx_Math_Fract16 amplitude)
+{
+    Ifx_Math_PolarFract16  refVoltage;
+    Ifx_Math_3PhaseFract16 currents;
+    uint32                 currentAngle = angle - 0x15555555u;
+
+    refVoltage.amplitude = amplitude;
+    refVoltage.angle     = angle;
+
+    /* Square wave currents, the signs select the dead time compensation */
+    currents.u = ((currentAngle >> 31) == 0u) ? HOST_MODULATOR_SWEEP_CURRENT : -HOST_MODULATOR_SWEEP_CURRENT;
+    currents.v = (((currentAngle - 0x55555555u) >> 31) == 0u) ? HOST_MODULATOR_SWEEP_CURRENT :
+                 -HOST_MODULATOR_SWEEP_CURRENT;
+    currents.w = (((currentAngle - 0xAAAAAAAAu) >> 31) == 0u) ? HOST_MODULATOR_SWEEP_CURRENT :
+                 -HOST_MODULATOR_SWEEP_CURRENT;
+
+    Ifx_MAS_ModulatorF16_execute(modulator, refVoltage, HOST_MODULATOR_SWEEP_DC_LINK, currents);
+}
+
+
+/* Runs the grid and writes one record per execution, returns the number of records */
+static uint32 HostModulatorSweep_sweep(FILE* file)
+{
+    Ifx_MAS_ModulatorF16* modulator = &HostModulatorSweep_modulator;
+    uint32                records   = 0u;
+    uint32                point;
+    uint32                step;
+    uint32                i;
+
+    for (point = 0u; point < 2u; point++)
+    {
+        HostModulatorSweep_init(modulator);
+        modulator->p_currentMeasurement.p_measurementPoint = (Ifx_MAS_ModulatorF16_measurementPoint)point;
+
+        for (step = 0u; step < (2u * HOST_MODULATOR_SWEEP_AMPLITUDES); step++)
+        {
+            uint32           level     = (step < HOST_MODULATOR_SWEEP_AMPLITUDES) ? step :
+                                         ((2u * HOST_MODULATOR_SWEEP_AMPLITUDES) - 1u - step);
+            Ifx_Math_Fract16 amplitude = (Ifx_Math_Fract16)((level * (uint32)HOST_MODULATOR_SWEEP_MAX_AMP) /
+                                                            (HOST_MODULATOR_SWEEP_AMPLITUDES - 1u));
+
+            for (i = 0u; i < HOST_MODULATOR_SWEEP_ANGLES; i++)
+            {
+                uint32                      angle = (uint32)(((uint64)i << 32) / HOST_MODULATOR_SWEEP_ANGLES);
+                Ifx_MAS_ModulatorF16_Output output;
+                uint16                      record[HOST_MODULATOR_SWEEP_RECORD];
+                uint32                      k;
+
+                HostModulatorSweep_execute(modulator, angle, amplitude);
+                Ifx_MAS_ModulatorF16_getOutput(modulator, &output);
+
+                for (k = 0u; k < 6u; k++)
+                {
+                    record[k] = output.compareValues_tick[k];
+                }
+
+                record[6]  = output.triggerTime_tick[0];
+                record[7]  = output.triggerTime_tick[1];
+                record[8]  = output.currentReconstructionInfo.sector;
+                record[9]  = (uint16)output.currentReconstructionInfo.secondTriggerIsSum;
+                record[10] = (uint16)modulator->p_status.subState;
+                record[11] = (uint16)modulator->p_status.state;
+
+                (void)fwrite(record, sizeof(record), 1u, file);
+                records++;
+            }
+        }
+    }
+
+    return records;
+}
+
+
+/* Timing kernel: one execution per call, angle and amplitude move through the grid */
+static void HostModulatorSweep_kernel(uint32 calls)
+{
+    Ifx_MAS_ModulatorF16* modulator = &HostModulatorSweep_modulator;
+    uint32                angle     = 0u;
+    uint32                i;
+
+    HostModulatorSweep_init(modulator);
+
+    for (i = 0u; i < calls; i++)
+    {
+        HostModulatorSweep_execute(modulator, angle, (Ifx_Math_Fract16)(i % (uint32)HOST_MODULATOR_SWEEP_MAX_AMP));
+        angle += 0x9E3779B9u;
+    }
+
+    HostBench_sink += (sint32)modulator->p_output.compareValues_tick[0];
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32 calls = (argc > 2) ? (uint32)atoi(argv[2]) : 2000000u;
+    FILE*  file;
+    uint32 records;
+
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "usage: %s <output file> [calls per run]\n", argv[0]);
+        return 2;
+    }
+
+    file = fopen(argv[1], "wb");
+
+    if (file == NULL)
+    {
+        (void)fprintf(stderr, "cannot write %s\n", argv[1]);
+        return 1;
+    }
+
+    records = HostModulatorSweep_sweep(file);
+    (void)fclose(file);
+
+    (void)printf("IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE %d, IFX_MAS_MODULATORF16_CFG_MODULATION_MODE %d: "
+        "%u records written to %s\n\n", IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE,
+        IFX_MAS_MODULATORF16_CFG_MODULATION_MODE, (unsigned)records, argv[1]);
+
+    (void)printf("Ifx_MAS_ModulatorF16_execute, %u calls per run, best of %u runs\n", (unsigned)calls,
+        (unsigned)HOST_BENCH_RUNS);
+    HostBench_printHeader();
+    (void)HostBench_print("execute", HostModulatorSweep_kernel, calls);
+
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_modulator_windows.c
+ * \brief Switching events and current measurement windows of a modulation mode against the records of the reference
+ * modulation, both written by foc_modulator_sweep over the same grid.
+ *
+ * Within one PWM period phase k is on from compareValues_tick[k] to compareValues_tick[k + 3]. A phase that is on or
+ * off for the whole period does not switch, every other phase switches twice. For each record it is checked that
+ * - the line to line on times are the same as in the reference, i.e. the same voltage is applied,
+ * - the inverter switching state at both triggers is the same as in the reference, i.e. the same currents are
+ *   measured as expected by Ifx_Math_CurrentReconstruction_F16,
+ * - the measurement windows at the triggers are valid, or at least as large as in the reference. A window is valid if
+ *   the last switching event is at least driver delay, dead time and ringing time before the trigger and the next one
+ *   at least measurement time minus driver delay after the trigger, for both measurement points.
+ *
+ * The target foc_check_dpwm of the host build runs it for IFX_MAS_MODULATORF16_MODULATION_MODE_DPWM60 and
+ * IFX_MAS_MODULATORF16_MODULATION_MODE_DPWMMIN against the project configuration.
+ *
+ * Usage: foc_modulator_windows <reference records> <records>
+ */
+
+#include <stdio.h>
+#include "types.h"
+#include "Ifx_MAS_ModulatorF16_Cfg.h"
+
+/* Values of one record of foc_modulator_sweep */
+#define HOST_MODULATOR_WINDOWS_RECORD (12u)
+
+/* PWM period of the records */
+#define HOST_MODULATOR_WINDOWS_PERIOD ((sint32)IFX_MAS_MODULATORF16_CFG_PERIOD_TICK)
+
+/* Smallest valid distances of the triggers from the last and to the next switching event */
+#define HOST_MODULATOR_WINDOWS_BEFORE ((sint32)(IFX_MAS_MODULATORF16_CFG_DRIVERDELAY_TICK + \
+                                                IFX_MAS_MODULATORF16_CFG_DEADTIME_TICK +    \
+                                                IFX_MAS_MODULATORF16_CFG_RINGINGTIME_TICK))
+#define HOST_MODULATOR_WINDOWS_AFTER  ((sint32)(IFX_MAS_MODULATORF16_CFG_MEASUREMENTTIME_TICK - \
+                                                IFX_MAS_MODULATORF16_CFG_DRIVERDELAY_TICK))
+
+/* Timing of one PWM period as seen by the phases and the ADC */
+typedef struct
+{
+    uint8  switching;   /* Phases which switch within the period */
+    sint32 onTime[3];   /* On time of the phases u, v, w */
+    uint8  state[2];    /* Phases which are on at the triggers, bit 0 = u */
+    sint32 before[2];   /* Ticks from the last switching event to the triggers */
+    sint32 after[2];    /* Ticks from the triggers to the next switching event */
+} THostModulatorWindows_Period;
+
+/* Distance from a to b along the periodic time line of one PWM period */
+static sint32 HostModulatorWindows_distance(sint32 a, sint32 b)
+{
+    sint32 distance = (b - a) % HOST_MODULATOR_WINDOWS_PERIOD;
+
+    return (distance < 0) ? (distance + HOST_MODULATOR_WINDOWS_PERIOD) : distance;
+}
+
+
+/* Evaluates one record */
+static void HostModulatorWindows_evaluate(const uint16* record, THostModulatorWindows_Period* period)
+{
+    uint8 k;
+    uint8 t;
+
+    period->switching = 0u;
+
+    for (t = 0u; t < 2u; t++)
+    {
+        period->state[t]  = 0u;
+        period->before[t] = HOST_MODULATOR_WINDOWS_PERIOD;
+        period->after[t]  = HOST_MODULATOR_WINDOWS_PERIOD;
+    }
+
+    for (k = 0u; k < 3u; k++)
+    {
+        sint32 on  = (sint32)record[k];
+        sint32 off = (sint32)record[k + 3u];
+
+        period->onTime[k] = (off > on) ? (off - on) : 0;
+
+        /* On or off for the whole period */
+        if ((period->onTime[k] == 0) || (period->onTime[k] == HOST_MODULATOR_WINDOWS_PERIOD))
+        {
+            if (period->onTime[k] != 0)
+            {
+                period->state[0] |= (uint8)(1u << k);
+                period->state[1] |= (uint8)(1u << k);
+            }
+
+            continue;
+        }
+
+        period->switching++;
+
+        for (t = 0u; t < 2u; t++)
+        {
+            sint32 trigger = (sint32)record[6u + t];
+            sint32 toOn    = HostModulatorWindows_distance(on, trigger);
+            sint32 toOff   = HostModulatorWindows_distance(off, trigger);
+            sint32 fromOn  = HostModulatorWindows_distance(trigger, on);
+            sint32 fromOff = HostModulatorWindows_distance(trigger, off);
+            sint32 before  = (toOn < toOff) ? toOn : toOff;
+            sint32 after   = (fromOn < fromOff) ? fromOn : fromOff;
+
+            if ((trigger >= on) && (trigger < off))
+            {
+                period->state[t] |= (uint8)(1u << k);
+            }
+
+            period->before[t] = (before < period->before[t]) ? before : period->before[t];
+            period->after[t]  = (after < period->after[t]) ? after : period->after[t];
+        }
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    FILE*  reference;
+    FILE*  file;
+    uint16 referenceRecord[HOST_MODULATOR_WINDOWS_RECORD];
+    uint16 record[HOST_MODULATOR_WINDOWS_RECORD];
+    uint32 records         = 0u;
+    uint32 voltageErrors   = 0u;
+    uint32 stateErrors     = 0u;
+    uint32 windowErrors    = 0u;
+    uint32 clampedPeriods  = 0u;
+    uint64 referenceEvents = 0u;
+    uint64 events          = 0u;
+
+    if (argc < 3)
+    {
+        (void)fprintf(stderr, "usage: %s <reference records> <records>\n", argv[0]);
+        return 2;
+    }
+
+    reference = fopen(argv[1], "rb");
+    file      = fopen(argv[2], "rb");
+
+    if ((reference == NULL) || (file == NULL))
+    {
+        (void)fprintf(stderr, "cannot read %s or %s\n", argv[1], argv[2]);
+        return 1;
+    }
+
+    while ((fread(referenceRecord, sizeof(referenceRecord), 1u, reference) == 1u)
+           && (fread(record, sizeof(record), 1u, file) == 1u))
+    {
+        THostModulatorWindows_Period referencePeriod;
+        THostModulatorWindows_Period period;
+        uint8                        t;
+
+        HostModulatorWindows_evaluate(referenceRecord, &referencePeriod);
+        HostModulatorWindows_evaluate(record, &period);
+
+        records++;
+        referenceEvents += 2u * referencePeriod.switching;
+        events          += 2u * period.switching;
+        clampedPeriods  += (period.switching < 3u) ? 1u : 0u;
+
+        /* Line to line voltages */
+        if (((period.onTime[0] - period.onTime[1]) != (referencePeriod.onTime[0] - referencePeriod.onTime[1]))
+            || ((period.onTime[1] - period.onTime[2]) != (referencePeriod.onTime[1] - referencePeriod.onTime[2])))
+        {
+            voltageErrors++;
+        }
+
+        /* Measured currents and measurement windows, a window too small in the reference may not get smaller */
+        for (t = 0u; t < 2u; t++)
+        {
+            if (referencePeriod.state[t] != period.state[t])
+            {
+                stateErrors++;
+            }
+
+            sint32 before = (referencePeriod.before[t] < HOST_MODULATOR_WINDOWS_BEFORE) ? referencePeriod.before[t] :
+                            HOST_MODULATOR_WINDOWS_BEFORE;
+            sint32 after  = (referencePeriod.after[t] < HOST_MODULATOR_WINDOWS_AFTER) ? referencePeriod.after[t] :
+                            HOST_MODULATOR_WINDOWS_AFTER;
+
+            if ((period.before[t] < before) || (period.after[t] < after))
+            {
+                windowErrors++;
+            }
+        }
+    }
+
+    (void)fclose(reference);
+    (void)fclose(file);
+
+    if (records == 0u)
+    {
+        (void)fprintf(stderr, "no records\n");
+        return 1;
+    }
+
+    (void)printf("%s against %s, %u records\n", argv[2], argv[1], (unsigned)records);
+    (void)printf("  switching events per period:    %.3f -> %.3f (%.1f %%)\n",
+        (double)referenceEvents / (double)records, (double)events / (double)records,
+        100.0 * ((double)events - (double)referenceEvents) / (double)referenceEvents);
+    (void)printf("  periods with a clamped phase:   %u\n", (unsigned)clampedPeriods);
+    (void)printf("  line to line voltage changed:   %u\n", (unsigned)voltageErrors);
+    (void)printf("  switching state at trigger:     %u changed\n", (unsigned)stateErrors);
+    (void)printf("  measurement window at trigger:  %u invalid\n", (unsigned)windowErrors);
+
+    return ((voltageErrors + stateErrors + windowErrors) == 0u) ? 0 : 1;
+}
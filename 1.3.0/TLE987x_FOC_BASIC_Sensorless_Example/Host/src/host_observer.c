@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_observer.c
+ * \brief Angle observers of the FOC solution side by side: the Flux Estimator (flux integration, arctangent and PLL)
+ * and the sliding mode observer (current observer with switching function and tracking PLL on the back EMF).
+ *
+ * The closed loop against the PMSM plant runs on the Flux Estimator of the project configuration. A shadow sliding
+ * mode observer gets the same voltage and current as the Flux Estimator in every fast loop, so both are evaluated on
+ * identical inputs without feeding back into the control. Per reference speed the error of the estimated angle
+ * against the electrical rotor angle of the plant (mean, RMS and largest absolute value) and the RMS error of the
+ * estimated speed are printed, for the speed ramp and for the steady state at its end.
+ *
+ * The inputs of the run at the first reference speed are recorded and replayed to both execute functions to measure
+ * their cost per call, in ns and in the unit of HostProfiler_getUnit().
+ *
+ * Usage: foc_observer [calls per run] [reference rpm]...
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_bench.h"
+#include "host_foc.h"
+#include "host_plant.h"
+#include "Ifx_MDA_SlidingModeObserverF16.h"
+
+/* Simulated time per reference speed */
+#define HOST_OBSERVER_RUN_S         (2.0)
+
+/* Part of the run at its end which is evaluated as steady state */
+#define HOST_OBSERVER_STEADY_PART   (0.25)
+
+/* Number of recorded fast loop inputs of the timing kernels */
+#define HOST_OBSERVER_SAMPLES       (4096u)
+
+/* Largest number of reference speeds */
+#define HOST_OBSERVER_MAX_SPEEDS    (8u)
+
+/* Estimated speed in rpm of a speed in Q15 */
+#define HOST_OBSERVER_RPM(speedQ15) \
+    (((float64)(speedQ15) * (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_MECH_SPEED_RPM) / 32768.0)
+
+/* Error statistics of one observer over a part of the run */
+typedef struct
+{
+    float64 angleSum_deg;     /* Sum of the angle errors */
+    float64 angleSumSq_deg;   /* Sum of the squared angle errors */
+    float64 angleMax_deg;     /* Largest absolute angle error */
+    float64 speedSumSq_rpm;   /* Sum of the squared speed errors */
+    uint32  samples;          /* Number of evaluated fast loops */
+} THostObserver_Error;
+
+/* Errors of both observers in the ramp and in steady state */
+typedef struct
+{
+    THostObserver_Error fluxEstimator[2];
+    THostObserver_Error slidingMode[2];
+    sint32              state;                /* FOC state at the end of the run */
+} THostObserver_Result;
+
+/* Recorded inputs of the timing kernels */
+static Ifx_Math_CmpFract16 HostObserver_voltage[HOST_OBSERVER_SAMPLES];
+static Ifx_Math_CmpFract16 HostObserver_current[HOST_OBSERVER_SAMPLES];
+static uint32              HostObserver_recorded;
+
+/* Instances of the timing kernels */
+static Ifx_MDA_FluxEstimatorF16       HostObserver_fluxEstimator;
+static Ifx_MDA_SlidingModeObserverF16 HostObserver_slidingMode;
+
+/* Wraps an angle difference to (-180, 180] degrees */
+static float64 HostObserver_wrapDeg(float64 angle_deg)
+{
+    while (angle_deg > 180.0)
+    {
+        angle_deg -= 360.0;
+    }
+
+    while (angle_deg <= -180.0)
+    {
+        angle_deg += 360.0;
+    }
+
+    return angle_deg;
+}
+
+
+/* Adds the error of one estimate */
+static void HostObserver_accumulate(THostObserver_Error* error, const Ifx_MDA_FluxEstimatorF16_Output* estimate,
+                                    const THostPlant* plant)
+{
+    float64 angleError = HostObserver_wrapDeg(((float64)estimate->anglePLL * (360.0 / 4294967296.0))
+                                              - (plant->angleElec_rad * (180.0 / 3.14159265358979323846)));
+    float64 speedError = HOST_OBSERVER_RPM(estimate->speedQ15) - HostPlant_getSpeedRpm(plant);
+
+    error->angleSum_deg   += angleError;
+    error->angleSumSq_deg += angleError * angleError;
+    error->angleMax_deg    = fmax(error->angleMax_deg, fabs(angleError));
+    error->speedSumSq_rpm += speedError * speedError;
+    error->samples++;
+}
+
+
+/* Runs the closed loop to the reference speed with the shadow sliding mode observer, records the inputs if asked */
+static void HostObserver_run(THostObserver_Result* result, sint16 referenceRpm, bool record)
+{
+    THostPlant_Params              params;
+    THostPlant                     plant;
+    Ifx_MDA_SlidingModeObserverF16 shadow;
+    uint32                         periods       = (uint32)(HOST_OBSERVER_RUN_S / HOST_FOC_PWM_PERIOD_S);
+    uint32                         steadyPeriods = (uint32)((float64)periods * HOST_OBSERVER_STEADY_PART);
+    uint32                         period;
+
+    (void)memset(result, 0, sizeof(*result));
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    HostPlant_init(&plant, &params);
+
+    Ifx_MDA_SlidingModeObserverF16_init(&shadow);
+    Ifx_MDA_SlidingModeObserverF16_setSamplingTime_us(&shadow,
+        Ifx_MDA_FluxEstimatorF16_getSamplingTime_us(&(FocDemoClosedLoop.fluxEstimator)));
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    for (period = 0u; period < periods; period++)
+    {
+        /* Voltage of the flux estimator input, taken before the fast loop replaces it */
+        Ifx_Math_CmpFract16 voltage = FocDemoClosedLoop.previousVoltageAlphaBeta;
+
+        /* Same sequence as HostPlant_stepClosedLoop() */
+        HostPlant_runUpCounting(&plant);
+        HostFoc_PeriodMatch();
+        HostPlant_latchUpCounting(&plant);
+        HostPlant_runDownCounting(&plant);
+
+        if (HostFoc_OneMatch() == true)
+        {
+            Ifx_Math_CmpFract16 current = FocDemoClosedLoop.currentsAlphaBeta;
+
+            /* The shadow observer follows the mode of the flux estimator */
+            Ifx_MDA_SlidingModeObserverF16_configMode(&shadow,
+                Ifx_MDA_FluxEstimatorF16_getMode(&(FocDemoClosedLoop.fluxEstimator)));
+            Ifx_MDA_SlidingModeObserverF16_execute(&shadow, voltage, current);
+
+            if ((record == true) && (Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).subState
+                                     == Ifx_MS_FocSolutionF16_SubState_closedLoop))
+            {
+                HostObserver_voltage[HostObserver_recorded % HOST_OBSERVER_SAMPLES] = voltage;
+                HostObserver_current[HostObserver_recorded % HOST_OBSERVER_SAMPLES] = current;
+                HostObserver_recorded++;
+            }
+
+            /* Estimates are evaluated once the flux estimator controls the angle in closed loop */
+            if (Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).subState
+                == Ifx_MS_FocSolutionF16_SubState_closedLoop)
+            {
+                Ifx_MDA_FluxEstimatorF16_Output estimate;
+                uint32                          part = (period >= (periods - steadyPeriods)) ? 1u : 0u;
+
+                Ifx_MDA_FluxEstimatorF16_getOutput(&(FocDemoClosedLoop.fluxEstimator), &estimate);
+                HostObserver_accumulate(&(result->fluxEstimator[part]), &estimate, &plant);
+                Ifx_MDA_SlidingModeObserverF16_getOutput(&shadow, &estimate);
+                HostObserver_accumulate(&(result->slidingMode[part]), &estimate, &plant);
+            }
+        }
+
+        HostPlant_latchDownCounting(&plant);
+
+        if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+        {
+            HostFoc_SpeedLoop();
+            HostFoc_Background();
+        }
+    }
+
+    result->state = (sint32)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state;
+}
+
+
+/* Prints the error statistics of one observer */
+static void HostObserver_print(const char* name, const THostObserver_Error error[2])
+{
+    uint32 part;
+
+    (void)printf("  %-16s", name);
+
+    for (part = 0u; part < 2u; part++)
+    {
+        float64 samples = (error[part].samples > 0u) ? (float64)error[part].samples : 1.0;
+
+        (void)printf(" %8.2f %8.2f %8.2f %9.2f  ", error[part].angleSum_deg / samples,
+            sqrt(error[part].angleSumSq_deg / samples), error[part].angleMax_deg,
+            sqrt(error[part].speedSumSq_rpm / samples));
+    }
+
+    (void)printf("\n");
+}
+
+
+/* Flux estimator on the recorded inputs */
+static void HostObserver_kernelFluxEstimator(uint32 calls)
+{
+    Ifx_MDA_FluxEstimatorF16_Output output;
+    uint32                          call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        uint32 sample = call % HOST_OBSERVER_SAMPLES;
+        Ifx_MDA_FluxEstimatorF16_execute(&HostObserver_fluxEstimator, HostObserver_voltage[sample],
+            HostObserver_current[sample]);
+    }
+
+    Ifx_MDA_FluxEstimatorF16_getOutput(&HostObserver_fluxEstimator, &output);
+    HostBench_sink = (sint32)output.anglePLL;
+}
+
+
+/* Sliding mode observer on the recorded inputs */
+static void HostObserver_kernelSlidingMode(uint32 calls)
+{
+    Ifx_MDA_FluxEstimatorF16_Output output;
+    uint32                          call;
+
+    for (call = 0u; call < calls; call++)
+    {
+        uint32 sample = call % HOST_OBSERVER_SAMPLES;
+        Ifx_MDA_SlidingModeObserverF16_execute(&HostObserver_slidingMode, HostObserver_voltage[sample],
+            HostObserver_current[sample]);
+    }
+
+    Ifx_MDA_SlidingModeObserverF16_getOutput(&HostObserver_slidingMode, &output);
+    HostBench_sink = (sint32)output.anglePLL;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32               calls     = (argc > 1) ? (uint32)atoi(argv[1]) : 200000u;
+    sint16               speeds[HOST_OBSERVER_MAX_SPEEDS] = {1000, 1500, 2000};
+    uint32               numSpeeds = 3u;
+    THostObserver_Result result;
+    uint32               index;
+
+    if (argc > 2)
+    {
+        numSpeeds = 0u;
+
+        for (index = 2u; (index < (uint32)argc) && (numSpeeds < HOST_OBSERVER_MAX_SPEEDS); index++)
+        {
+            speeds[numSpeeds] = (sint16)atoi(argv[index]);
+            numSpeeds++;
+        }
+    }
+
+    (void)printf("angle observers     : flux estimator (shadow: sliding mode observer), %.1f s per speed, "
+                 "sampling time %u us\n", HOST_OBSERVER_RUN_S, (unsigned)IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US);
+    (void)printf("errors              : angle mean / rms / max [deg], speed rms [rpm], against the plant\n\n");
+    (void)printf("  %-16s %-38s  %-38s\n", "", "closed loop ramp", "steady state");
+    (void)printf("  %-16s %8s %8s %8s %9s   %8s %8s %8s %9s\n", "observer", "mean", "rms", "max", "speed",
+        "mean", "rms", "max", "speed");
+
+    for (index = 0u; index < numSpeeds; index++)
+    {
+        HostObserver_run(&result, speeds[index], (index == 0u));
+        (void)printf("%d rpm, FOC state %d\n", (int)speeds[index], (int)result.state);
+        HostObserver_print("flux estimator", result.fluxEstimator);
+        HostObserver_print("sliding mode", result.slidingMode);
+    }
+
+    if (HostObserver_recorded < HOST_OBSERVER_SAMPLES)
+    {
+        (void)fprintf(stderr, "only %u fast loops recorded in closed loop\n", (unsigned)HostObserver_recorded);
+        return 1;
+    }
+
+    /* Cost per call on the recorded inputs of the first reference speed */
+    Ifx_MDA_FluxEstimatorF16_init(&HostObserver_fluxEstimator);
+    Ifx_MDA_FluxEstimatorF16_configMode(&HostObserver_fluxEstimator, Ifx_MDA_FluxEstimatorF16_Mode_enable);
+    Ifx_MDA_SlidingModeObserverF16_init(&HostObserver_slidingMode);
+    Ifx_MDA_SlidingModeObserverF16_configMode(&HostObserver_slidingMode, Ifx_MDA_FluxEstimatorF16_Mode_enable);
+
+    (void)printf("\n");
+    HostBench_printHeader();
+    (void)HostBench_print("Ifx_MDA_FluxEstimatorF16", HostObserver_kernelFluxEstimator, calls);
+    (void)HostBench_print("Ifx_MDA_SlidingModeObserverF16", HostObserver_kernelSlidingMode, calls);
+
+    return 0;
+}
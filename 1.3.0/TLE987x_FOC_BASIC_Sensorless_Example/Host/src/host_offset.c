@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_offset.c
+ * \brief Time to torque and offset error of the current measurement over a duty cycle with a drifting CSA offset,
+ * with and without the background offset tracking of the measurement ADC
+ * (IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING).
+ *
+ * The plant starts with the offset of the project plant, with offset tracking the measurement ADC is seeded with it as
+ * stored at the last shutdown, plus the given seed error. The duty cycle is:
+ * - enable of the power stage and the control, start to the reference speed
+ * - run, while the offset of the plant drifts linearly by the given amount (CSA temperature drift)
+ * - stop of the control, stand by at standstill
+ * - disable and enable of the power stage
+ * - restart to the reference speed
+ *
+ * The time to torque is the time from the enable to the run state of the FOC solution. The offset error is the offset
+ * of the measurement ADC minus that of the plant at the end of each phase, i.e. the error of the measured phase
+ * currents.
+ *
+ * Usage: foc_offset [drift LSB] [run s] [standby s] [seed error LSB] [reference rpm]
+ *        (foc_offset_tracking for the configuration with offset tracking)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+
+/* Longest time to wait for a state of the FOC solution */
+#define HOST_OFFSET_TIMEOUT_S (5.0)
+
+/* Duration of the run after the restart */
+#define HOST_OFFSET_RESTART_S (1.0)
+
+/* Returns the state of the FOC solution */
+static Ifx_MS_FocSolutionF16_State HostOffset_state(void)
+{
+    return Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state;
+}
+
+
+/* Offset of the measurement ADC minus that of the plant, in LSB */
+static float64 HostOffset_error(const THostPlant* plant)
+{
+    return (float64)Ifx_MHA_MeasurementADC_TLE987_getOffset(&FocDemoClosedLoop.measurementADCTLE987) -
+           plant->params.adcOffset_lsb;
+}
+
+
+/* Runs the plant until the FOC solution is in the given state, returns the time it took or a negative value */
+static float64 HostOffset_waitState(THostPlant* plant, Ifx_MS_FocSolutionF16_State state)
+{
+    float64 start_s = plant->time_s;
+
+    while (HostOffset_state() != state)
+    {
+        if ((plant->time_s - start_s) > HOST_OFFSET_TIMEOUT_S)
+        {
+            return -1.0;
+        }
+
+        (void)HostPlant_stepClosedLoop(plant);
+    }
+
+    return plant->time_s - start_s;
+}
+
+
+/* Runs the plant for the given time, the offset of the plant changes linearly by drift_lsb over it */
+static void HostOffset_run(THostPlant* plant, float64 duration_s, float64 drift_lsb)
+{
+    float64 start_s     = plant->time_s;
+    float64 startOffset = plant->params.adcOffset_lsb;
+
+    while ((plant->time_s - start_s) < duration_s)
+    {
+        (void)HostPlant_stepClosedLoop(plant);
+        plant->params.adcOffset_lsb = startOffset + (drift_lsb * (plant->time_s - start_s) / duration_s);
+    }
+}
+
+
+/* Prints the time of a phase and the offset error at its end */
+static void HostOffset_print(const char* phase, float64 time_s, const THostPlant* plant)
+{
+    float64 error = HostOffset_error(plant);
+
+    (void)printf("%-32s", phase);
+
+    if (time_s < 0.0)
+    {
+        (void)printf(" %12s", "timeout");
+    }
+    else
+    {
+        (void)printf(" %12.2f", time_s * 1000.0);
+    }
+
+    (void)printf(" %12.1f %12.1f %10.1f\n", error, error * 1000.0 / plant->params.adcPerAmpere_lsb,
+        HostPlant_getSpeedRpm(plant));
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    float64           drift_lsb    = (argc > 1) ? atof(argv[1]) : 20.0;
+    float64           run_s        = (argc > 2) ? atof(argv[2]) : 2.0;
+    float64           standby_s    = (argc > 3) ? atof(argv[3]) : 0.5;
+    float64           seedError    = (argc > 4) ? atof(argv[4]) : 4.0;
+    sint16            referenceRpm = (argc > 5) ? (sint16)atoi(argv[5]) : 1000;
+    THostPlant_Params params;
+    THostPlant        plant;
+    float64           time_s;
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.adcNoise_lsb = 1.0;
+    HostPlant_init(&plant, &params);
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* Offset stored at the last shutdown */
+    Ifx_MHA_MeasurementADC_TLE987_setOffset(&FocDemoClosedLoop.measurementADCTLE987,
+        (uint16)(plant.params.adcOffset_lsb + seedError));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
+    (void)printf("IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING %d, calibration %d cycles, fast loop %.0f us\n",
+        IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING, IFX_MHA_MEASUREMENTADC_CFG_CALIBRATION_CYCLES,
+        HOST_FOC_PWM_PERIOD_S * 1.0e6 * (float64)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR);
+    (void)printf("drift %.1f LSB over %.2f s run, %.2f s standby, seed error %.1f LSB, %d rpm, noise %.1f LSB\n\n",
+        drift_lsb, run_s, standby_s, seedError, (int)referenceRpm, params.adcNoise_lsb);
+    (void)printf("%-32s %12s %12s %12s %10s\n", "phase", "time [ms]", "error [LSB]", "error [mA]", "rpm");
+
+    /* Start, the power stage is enabled by HostFoc_Init() */
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+    time_s                          = HostOffset_waitState(&plant, Ifx_MS_FocSolutionF16_State_run);
+    HostOffset_print("enable to run", time_s, &plant);
+
+    /* Run with drifting offset */
+    HostOffset_run(&plant, run_s, drift_lsb);
+    HostOffset_print("run, offset drift", run_s, &plant);
+
+    /* Stop and stand by */
+    HostFoc_inputs.enableControl = 0;
+    time_s                       = HostOffset_waitState(&plant, Ifx_MS_FocSolutionF16_State_standBy);
+    HostOffset_print("stop to standby", time_s, &plant);
+    HostOffset_run(&plant, standby_s, 0.0);
+    HostOffset_print("standby", standby_s, &plant);
+
+    /* Power stage off and on again */
+    HostFoc_inputs.enablePowerStage = 0;
+    time_s                          = HostOffset_waitState(&plant, Ifx_MS_FocSolutionF16_State_off);
+    HostOffset_print("power stage disable to off", time_s, &plant);
+    HostFoc_inputs.enablePowerStage = 1;
+    time_s                          = HostOffset_waitState(&plant, Ifx_MS_FocSolutionF16_State_standBy);
+    HostOffset_print("power stage enable to standby", time_s, &plant);
+
+    /* Restart */
+    HostFoc_inputs.enableControl = 1;
+    time_s                       = HostOffset_waitState(&plant, Ifx_MS_FocSolutionF16_State_run);
+    HostOffset_print("restart to run", time_s, &plant);
+    HostOffset_run(&plant, HOST_OFFSET_RESTART_S, 0.0);
+    HostOffset_print("restart, run", HOST_OFFSET_RESTART_S, &plant);
+
+    return 0;
+}
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_parameters.c
+ * \brief Parameter block of the FOC solution in data flash (IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK): cost of
+ * the initialization from the Config Wizard values against the one from the block, persistence of tuned parameters
+ * over a restart, rotation of the writes over the pages and the fallback to older blocks.
+ *
+ * The checks are:
+ * - the initialization from a stored block gives the same instance, bit by bit, as the one from the Config Wizard
+ *   values the block was stored from
+ * - a changed speed PI gain and the calibrated CSA offset are restored after a restart, the time to torque of the
+ *   restart is taken against the plant model
+ * - a store in the run state is refused and leaves the data flash untouched
+ * - the given number of stores is spread evenly over the pages, the newest block has the last sequence number
+ * - a block with a wrong CRC or identifier is skipped for the next older one, erased flash gives the initialization
+ *   from the Config Wizard values
+ *
+ * Usage: foc_parameters [stores] [calls per run]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_bench.h"
+#include "host_foc.h"
+#include "host_plant.h"
+#include "host_sfr.h"
+
+/* Longest time to wait for a state of the FOC solution */
+#define HOST_PARAMETERS_TIMEOUT_S (5.0)
+
+/* Reference speed of the runs */
+#define HOST_PARAMETERS_SPEED_RPM (1000)
+
+/* Instance after the initialization from the Config Wizard values */
+static Ifx_MS_FocSolutionF16 HostParameters_reference;
+
+/* Number of failed checks */
+static uint32                HostParameters_failures;
+
+/* Prints the result of a check */
+static void HostParameters_check(const char* name, bool passed)
+{
+    (void)printf("%-64s %s\n", name, (passed == true) ? "PASS" : "FAIL");
+
+    if (passed == false)
+    {
+        HostParameters_failures++;
+    }
+}
+
+
+/* Returns whether the FOC solution equals the reference instance, bit by bit. The static configuration of the speed
+ * precontrol is copied from a local variable together with its padding, so it is compared by value and its padding
+ * taken over from the reference. */
+static bool HostParameters_equalsReference(void)
+{
+    const Ifx_Math_SpeedPreControlF16_StaticConfig* config    = &FocDemoClosedLoop.speedPreControl.p_staticConfiguration;
+    const Ifx_Math_SpeedPreControlF16_StaticConfig* reference =
+        &HostParameters_reference.speedPreControl.p_staticConfiguration;
+    bool equals = (config->fricitionConstant == reference->fricitionConstant) &&
+                  (config->rotorInertiaOverSamplingTime.value == reference->rotorInertiaOverSamplingTime.value) &&
+                  (config->rotorInertiaOverSamplingTime.qFormat == reference->rotorInertiaOverSamplingTime.qFormat);
+
+    FocDemoClosedLoop.speedPreControl.p_staticConfiguration = *reference;
+
+    return equals && (memcmp(&FocDemoClosedLoop, &HostParameters_reference, sizeof(FocDemoClosedLoop)) == 0);
+}
+
+
+/* Initialization of the FOC solution, from the block if there is one */
+static void HostParameters_initKernel(uint32 calls)
+{
+    uint32 call;
+
+    for (call = 0; call < calls; call++)
+    {
+        Ifx_MS_FocSolutionF16_init(&FocDemoClosedLoop);
+    }
+
+    HostBench_sink = (sint32)Ifx_Math_PiF16_getPropGain(&FocDemoClosedLoop.speedPi);
+}
+
+
+/* Scan of the pages for the newest valid block */
+static void HostParameters_findKernel(uint32 calls)
+{
+    uint32 call;
+    sint32 sum = 0;
+
+    for (call = 0; call < calls; call++)
+    {
+        sum += (sint32)(Ifx_MS_FocSolutionF16_findParameterBlock() != NULL_PTR);
+    }
+
+    HostBench_sink = sum;
+}
+
+
+/* Runs the plant until the FOC solution is in the given state, returns the time it took or a negative value */
+static float64 HostParameters_waitState(THostPlant* plant, Ifx_MS_FocSolutionF16_State state)
+{
+    float64 start_s = plant->time_s;
+
+    while (Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state != state)
+    {
+        if ((plant->time_s - start_s) > HOST_PARAMETERS_TIMEOUT_S)
+        {
+            return -1.0;
+        }
+
+        (void)HostPlant_stepClosedLoop(plant);
+    }
+
+    return plant->time_s - start_s;
+}
+
+
+/* Power-on of the application and start to the reference speed, returns the time from the enable to the run state */
+static float64 HostParameters_start(THostPlant* plant, const THostPlant_Params* params)
+{
+    HostFoc_Init();
+    HostPlant_init(plant, params);
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = HOST_PARAMETERS_SPEED_RPM;
+
+    return HostParameters_waitState(plant, Ifx_MS_FocSolutionF16_State_run);
+}
+
+
+/* Stops the control and switches the power stage off, as before a shutdown */
+static void HostParameters_stop(THostPlant* plant)
+{
+    HostFoc_inputs.enableControl = 0;
+    (void)HostParameters_waitState(plant, Ifx_MS_FocSolutionF16_State_standBy);
+    HostFoc_inputs.enablePowerStage = 0;
+    (void)HostParameters_waitState(plant, Ifx_MS_FocSolutionF16_State_off);
+}
+
+
+/* Returns the sequence number of the newest valid block, -1 if there is none */
+static sint32 HostParameters_newestSequence(void)
+{
+    const Ifx_MS_FocSolutionF16_ParameterBlock* block = Ifx_MS_FocSolutionF16_findParameterBlock();
+
+    return (block != NULL_PTR) ? (sint32)block->sequence : -1;
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32              stores = (argc > 1) ? (uint32)atoi(argv[1]) : 1000u;
+    uint32              calls  = (argc > 2) ? (uint32)atoi(argv[2]) : 100000u;
+    uint32              firstPage = HOST_SFR_DATA_FLASH_PAGES - (uint32)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES;
+    THostSfr_DataFlash  stored;
+    THostPlant_Params   params;
+    THostPlant          plant;
+    THostBench_Result   cfgInit;
+    THostBench_Result   blockInit;
+    THostBench_Result   findBlock;
+    Ifx_Math_Fract16    propGain;
+    uint16              offset;
+    float64             time_s;
+    uint32              minPrograms = 0xFFFFFFFFu;
+    uint32              maxPrograms = 0u;
+    uint32              i;
+
+    (void)printf("parameter block of %u bytes, version 0x%04X, %d pages of %u bytes at the end of the data flash\n\n",
+        (unsigned)sizeof(Ifx_MS_FocSolutionF16_ParameterBlock), (unsigned)IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_VERSION,
+        IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES, (unsigned)HOST_SFR_FLASH_PAGE_SIZE);
+
+    /* Initialization from the Config Wizard values on erased flash, then from the block stored from it */
+    HostSfr_EraseDataFlash();
+    HostFoc_Init();
+    HostParameters_check("erased flash, no parameter block", Ifx_MS_FocSolutionF16_findParameterBlock() == NULL_PTR);
+    HostParameters_reference = FocDemoClosedLoop;
+    HostParameters_check("store of the Config Wizard parameters", Ifx_MS_FocSolutionF16_storeParameters(
+        &FocDemoClosedLoop) == true);
+    HostFoc_Init();
+    HostParameters_check("initialization from the block equals the one from the Config Wizard values",
+        HostParameters_equalsReference() == true);
+
+    /* Cost of the initialization, best of HOST_BENCH_RUNS */
+    (void)printf("\ninitialization of the FOC solution, %u calls per run, best of %u runs\n", (unsigned)calls,
+        (unsigned)HOST_BENCH_RUNS);
+    HostBench_printHeader();
+    stored = HostSfr_dataFlash;
+    HostSfr_EraseDataFlash();
+    cfgInit = HostBench_print("init, Config Wizard values", HostParameters_initKernel, calls);
+    HostSfr_dataFlash = stored;
+    blockInit       = HostBench_print("init, parameter block", HostParameters_initKernel, calls);
+    findBlock       = HostBench_print("scan of the pages and CRC", HostParameters_findKernel, calls);
+    (void)printf("initialization from the block takes %.1f %% of the one from the Config Wizard values, %.1f %% "
+        "without the scan of the pages and CRC\n\n", 100.0 * blockInit.nsPerCall / cfgInit.nsPerCall,
+        100.0 * (blockInit.nsPerCall - findBlock.nsPerCall) / cfgInit.nsPerCall);
+
+    /* Tuning and calibration persist over a restart */
+    HostSfr_EraseDataFlash();
+    HostPlant_defaultParams(&params);
+    time_s = HostParameters_start(&plant, &params);
+    (void)printf("%-64s %8.2f ms\n", "enable to run, Config Wizard values", time_s * 1000.0);
+    propGain = Ifx_Math_PiF16_getPropGain(&FocDemoClosedLoop.speedPi);
+    propGain = (Ifx_Math_Fract16)((propGain * 3) / 4);
+    Ifx_Math_PiF16_setPropGain(&FocDemoClosedLoop.speedPi, propGain);
+    stored = HostSfr_dataFlash;
+    HostParameters_check("store refused in run, flash untouched", (Ifx_MS_FocSolutionF16_storeParameters(
+        &FocDemoClosedLoop) == false) && (memcmp(&stored, &HostSfr_dataFlash, sizeof(stored)) == 0));
+    HostParameters_stop(&plant);
+    offset = Ifx_MHA_MeasurementADC_TLE987_getOffset(&FocDemoClosedLoop.measurementADCTLE987);
+    HostParameters_check("store before the shutdown", Ifx_MS_FocSolutionF16_storeParameters(&FocDemoClosedLoop) ==
+        true);
+    time_s = HostParameters_start(&plant, &params);
+    (void)printf("%-64s %8.2f ms\n", "enable to run after the restart, parameter block", time_s * 1000.0);
+    HostParameters_check("speed PI gain restored", (Ifx_Math_PiF16_getPropGain(&FocDemoClosedLoop.speedPi) ==
+                                                    propGain) && (time_s >= 0.0));
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+    HostParameters_check("CSA offset restored, no calibration", (offset != 0u) &&
+        (FocDemoClosedLoop.measurementADCTLE987.p_offsetValid == true));
+#else
+    (void)offset;
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
+    /* Rotation of the writes over the pages */
+    HostSfr_EraseDataFlash();
+    HostFoc_Init();
+
+    for (i = 0u; i < stores; i++)
+    {
+        (void)Ifx_MS_FocSolutionF16_storeParameters(&FocDemoClosedLoop);
+    }
+
+    (void)printf("\nprograms per page after %u stores:", (unsigned)stores);
+
+    for (i = firstPage; i < HOST_SFR_DATA_FLASH_PAGES; i++)
+    {
+        uint32 programs = HostSfr_dataFlash.pagePrograms[i];
+
+        (void)printf(" %u", (unsigned)programs);
+        minPrograms = (programs < minPrograms) ? programs : minPrograms;
+        maxPrograms = (programs > maxPrograms) ? programs : maxPrograms;
+    }
+
+    (void)printf("\n");
+    HostParameters_check("stores spread evenly over the pages", (stores == 0u) || ((maxPrograms - minPrograms) <= 1u));
+    HostParameters_check("newest block has the last sequence number", HostParameters_newestSequence() ==
+        (sint32)((uint16)(stores - 1u)));
+
+    /* Fallback to older blocks */
+    if (stores >= 3u)
+    {
+        Ifx_MS_FocSolutionF16_ParameterBlock* newest = (Ifx_MS_FocSolutionF16_ParameterBlock*)
+                                                       Ifx_MS_FocSolutionF16_findParameterBlock();
+
+        newest->parameters.speedPi.propGain ^= 0x0100;
+        HostParameters_check("wrong CRC, next older block", HostParameters_newestSequence() ==
+            (sint32)((uint16)(stores - 2u)));
+        newest = (Ifx_MS_FocSolutionF16_ParameterBlock*)Ifx_MS_FocSolutionF16_findParameterBlock();
+        newest->magic = 0u;
+        HostParameters_check("wrong identifier, next older block", HostParameters_newestSequence() ==
+            (sint32)((uint16)(stores - 3u)));
+    }
+
+    HostSfr_EraseDataFlash();
+    HostFoc_Init();
+    HostParameters_check("erased flash, initialization from the Config Wizard values",
+        HostParameters_equalsReference() == true);
+
+    (void)printf("\n%s\n", (HostParameters_failures == 0u) ? "PASS" : "FAIL");
+
+    return (HostParameters_failures == 0u) ? 0 : 1;
+}
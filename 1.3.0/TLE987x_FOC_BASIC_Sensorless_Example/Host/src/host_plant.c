@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_plant.c
+ * \brief PMSM and inverter plant model for software-in-the-loop runs of the FOC stack on the host.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "host_plant.h"
+#include "host_foc.h"
+#include "host_sfr.h"
+#include "ccu6_defines.h"
+#include "gpt12e_defines.h"
+#include "Ifx_MS_FocSolutionF16_Cfg.h"
+#include "Ifx_MDA_FluxEstimatorF16_Cfg.h"
+#include "Ifx_MHA_MeasurementADC_Cfg.h"
+
+/* 2 * pi */
+#define HOST_PLANT_TWO_PI          (6.283185307179586)
+
+/* sqrt(3) */
+#define HOST_PLANT_SQRT3           (1.7320508075688772)
+
+/* Highest result of the 12 bit ADC */
+#define HOST_PLANT_ADC_MAX         (4095.0)
+
+/* ADC result of the CSA output at zero current, mid scale of the ADC */
+#define HOST_PLANT_ADC_OFFSET      (2048.0)
+
+/* DC-link voltage of the default plant */
+#define HOST_PLANT_DC_LINK_VOLTAGE (12.0)
+
+/* Breakpoints of one half period: both ends, the sampling point and up to two switching edges per phase */
+#define HOST_PLANT_MAX_BREAKPOINTS (9u)
+
+/* Current gain of the measurement ADC for the configured CSA gain, see Ifx_MHA_MeasurementADC_TLE987_setCsaGain() */
+#if IFX_MHA_MEASUREMENTADC_CFG_CSA_GAIN == 0
+#define HOST_PLANT_CURRENT_GAIN_Q     IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_Q_10
+#define HOST_PLANT_CURRENT_GAIN_SHIFT IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_SHIFT_10
+#elif IFX_MHA_MEASUREMENTADC_CFG_CSA_GAIN == 1
+#define HOST_PLANT_CURRENT_GAIN_Q     IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_Q_20
+#define HOST_PLANT_CURRENT_GAIN_SHIFT IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_SHIFT_20
+#elif IFX_MHA_MEASUREMENTADC_CFG_CSA_GAIN == 2
+#define HOST_PLANT_CURRENT_GAIN_Q     IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_Q_40
+#define HOST_PLANT_CURRENT_GAIN_SHIFT IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_SHIFT_40
+#else
+#define HOST_PLANT_CURRENT_GAIN_Q     IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_Q_60
+#define HOST_PLANT_CURRENT_GAIN_SHIFT IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_SHIFT_60
+#endif
+
+/* Returns the high side switch pattern (bit 0: U, bit 1: V, bit 2: W) at the given tick of the PWM period */
+static inline uint8 HostPlant_switchState(const THostPlant* self, uint16 tick)
+{
+    /* Switch pattern */
+    uint8 state = 0u;
+
+    /* A phase is connected to the DC-link between its switch on and switch off time */
+    for (uint8 phase = 0u; phase < 3u; phase++)
+    {
+        if ((tick >= self->switchOn_tick[phase]) && (tick < self->switchOff_tick[phase]))
+        {
+            state |= (uint8)(1u << phase);
+        }
+    }
+
+    return state;
+}
+
+
+/* Returns the DC-link shunt current for the given switch pattern */
+static inline float64 HostPlant_shuntCurrent(const THostPlant* self, uint8 state)
+{
+    /* Phase currents from alpha/beta */
+    float64 currentU = self->currentAlpha_A;
+    float64 currentV = (-0.5 * self->currentAlpha_A) + ((HOST_PLANT_SQRT3 / 2.0) * self->currentBeta_A);
+    float64 currentW = -currentU - currentV;
+
+    /* The shunt carries the sum of the currents of all phases connected to the positive DC-link rail */
+    float64 shuntCurrent = 0.0;
+
+    if ((state & 1u) != 0u)
+    {
+        shuntCurrent += currentU;
+    }
+
+    if ((state & 2u) != 0u)
+    {
+        shuntCurrent += currentV;
+    }
+
+    if ((state & 4u) != 0u)
+    {
+        shuntCurrent += currentW;
+    }
+
+    return shuntCurrent;
+}
+
+
+/* Converts a physical value into a saturated 12 bit ADC result */
+static inline uint16 HostPlant_toAdc(float64 value_lsb)
+{
+    /* Saturate to the ADC range */
+    if (value_lsb < 0.0)
+    {
+        value_lsb = 0.0;
+    }
+    else if (value_lsb > HOST_PLANT_ADC_MAX)
+    {
+        value_lsb = HOST_PLANT_ADC_MAX;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (uint16)(value_lsb + 0.5);
+}
+
+
+/* Integrates the electrical system over one segment with constant switch pattern and back EMF */
+static void HostPlant_integrateSegment(THostPlant* self, uint8 state, float64 emfAlpha, float64 emfBeta,
+                                       float64 duration_s)
+{
+    const THostPlant_Params* params = &(self->params);
+
+    /* Leg voltages referred to the negative rail, the common mode voltage does not drive any current */
+    float64 legU = ((state & 1u) != 0u) ? params->dcLinkVoltage_V : 0.0;
+    float64 legV = ((state & 2u) != 0u) ? params->dcLinkVoltage_V : 0.0;
+    float64 legW = ((state & 4u) != 0u) ? params->dcLinkVoltage_V : 0.0;
+
+    /* Clarke transformation of the leg voltages */
+    float64 voltageAlpha = ((2.0 * legU) - legV - legW) / 3.0;
+    float64 voltageBeta  = (legV - legW) / HOST_PLANT_SQRT3;
+
+    /* Semi-implicit Euler step of L di/dt = v - R i - e */
+    float64 gain    = duration_s / params->inductance_H;
+    float64 damping = 1.0 + (gain * params->resistance_Ohm);
+
+    self->currentAlpha_A = (self->currentAlpha_A + (gain * (voltageAlpha - emfAlpha))) / damping;
+    self->currentBeta_A  = (self->currentBeta_A + (gain * (voltageBeta - emfBeta))) / damping;
+}
+
+
+/* Integrates the mechanical system over one half PWM period, sinAngle/cosAngle belong to the rotor angle of the
+ * half period */
+static void HostPlant_integrateMechanics(THostPlant* self, float64 sinAngle, float64 cosAngle, float64 duration_s)
+{
+    const THostPlant_Params* params = &(self->params);
+    float64                  currentQ;
+    float64                  loadTorque;
+    float64                  speed;
+
+    /* Electrical torque of the surface mounted PMSM */
+    currentQ        = (self->currentBeta_A * cosAngle) - (self->currentAlpha_A * sinAngle);
+    self->torque_Nm = 1.5 * (float64)params->polePairs * params->flux_Wb * currentQ;
+
+    /* The load torque opposes the rotation and holds the rotor at standstill while it exceeds the motor torque */
+    if (self->speedMech_radps > 0.0)
+    {
+        loadTorque = params->loadTorque_Nm;
+    }
+    else if (self->speedMech_radps < 0.0)
+    {
+        loadTorque = -params->loadTorque_Nm;
+    }
+    else if (fabs(self->torque_Nm) <= params->loadTorque_Nm)
+    {
+        loadTorque = self->torque_Nm;
+    }
+    else
+    {
+        loadTorque = (self->torque_Nm > 0.0) ? params->loadTorque_Nm : -params->loadTorque_Nm;
+    }
+
+    /* J dw/dt = T - B w - T_load */
+    speed = self->speedMech_radps + (((self->torque_Nm - (params->viscousFriction_Nms * self->speedMech_radps)
+                                       - loadTorque) / params->inertia_kgm2) * duration_s);
+
+    /* The load torque alone does not reverse the rotation */
+    if (((speed * self->speedMech_radps) < 0.0)
+        && (fabs(self->torque_Nm) <= params->loadTorque_Nm))
+    {
+        speed = 0.0;
+    }
+
+    self->speedMech_radps = speed;
+}
+
+
+/* Returns a standard normal distributed value, xorshift32 and Box-Muller */
+static float64 HostPlant_gaussian(THostPlant* self)
+{
+    float64 uniform[2];
+
+    for (uint8 i = 0u; i < 2u; i++)
+    {
+        self->noiseState ^= self->noiseState << 13;
+        self->noiseState ^= self->noiseState >> 17;
+        self->noiseState ^= self->noiseState << 5;
+        uniform[i]        = ((float64)self->noiseState + 1.0) / 4294967296.0;
+    }
+
+    return sqrt(-2.0 * log(uniform[0])) * cos(HOST_PLANT_TWO_PI * uniform[1]);
+}
+
+
+/* Converts one shunt sample, with noise if configured */
+static uint16 HostPlant_convertShunt(THostPlant* self, float64 sample_lsb)
+{
+    float64 noise_lsb = (self->params.adcNoise_lsb > 0.0) ? (self->params.adcNoise_lsb * HostPlant_gaussian(self)) :
+                        0.0;
+
+    return HostPlant_toAdc(sample_lsb + noise_lsb);
+}
+
+
+/* Simulates the ticks [startTick, endTick) of the PWM period and returns the shunt sample at sampleTick in ADC LSB */
+static float64 HostPlant_runHalfPeriod(THostPlant* self, uint16 startTick, uint16 endTick, uint16 sampleTick)
+{
+    /* Sorted switching edges within the half period */
+    uint16  breakpoints[HOST_PLANT_MAX_BREAKPOINTS];
+    uint8   count = 0u;
+    uint8   i;
+    float64 shuntCurrent = 0.0;
+    float64 duration_s   = (float64)(endTick - startTick) * self->tick_s;
+    float64 speedElec    = self->speedMech_radps * (float64)self->params.polePairs;
+    float64 angleMid     = self->angleElec_rad + (speedElec * duration_s * 0.5);
+    float64 sinAngle     = sin(angleMid);
+    float64 cosAngle     = cos(angleMid);
+
+    /* Back EMF of the permanent magnet, constant over the half period (rotor angle in the middle of the half) */
+    float64 emfAlpha = -speedElec * self->params.flux_Wb * sinAngle;
+    float64 emfBeta  = speedElec * self->params.flux_Wb * cosAngle;
+
+    /* Sample at the closest point of this half period */
+    if (sampleTick < startTick)
+    {
+        sampleTick = startTick;
+    }
+    else if (sampleTick > endTick)
+    {
+        sampleTick = endTick;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    /* Collect the ends, the sampling point and all switching edges inside the half period */
+    breakpoints[count++] = startTick;
+    breakpoints[count++] = endTick;
+    breakpoints[count++] = sampleTick;
+
+    for (i = 0u; i < 3u; i++)
+    {
+        if ((self->switchOn_tick[i] > startTick) && (self->switchOn_tick[i] < endTick))
+        {
+            breakpoints[count++] = self->switchOn_tick[i];
+        }
+
+        if ((self->switchOff_tick[i] > startTick) && (self->switchOff_tick[i] < endTick))
+        {
+            breakpoints[count++] = self->switchOff_tick[i];
+        }
+    }
+
+    /* Insertion sort of the few breakpoints */
+    for (i = 1u; i < count; i++)
+    {
+        uint16 value = breakpoints[i];
+        uint8  j     = i;
+
+        while ((j > 0u) && (breakpoints[j - 1u] > value))
+        {
+            breakpoints[j] = breakpoints[j - 1u];
+            j--;
+        }
+
+        breakpoints[j] = value;
+    }
+
+    /* Outputs of the pattern generator disabled (no multi-channel pattern): the phases float and, as long as the back
+     * EMF stays below the DC-link voltage, the current commutates through the diodes into the DC-link within the half
+     * period, so the shunt current is zero */
+    if (HostSfr.ccu6Mcm == 0u)
+    {
+        self->currentAlpha_A = 0.0;
+        self->currentBeta_A  = 0.0;
+        count                = 0u;
+    }
+
+    /* Integrate segment by segment, the switch pattern is constant between two breakpoints */
+    for (i = 0u; i < count; i++)
+    {
+        uint8 state = HostPlant_switchState(self, breakpoints[i]);
+
+        /* Sample the shunt current when the trigger point is reached */
+        if (breakpoints[i] == sampleTick)
+        {
+            shuntCurrent = HostPlant_shuntCurrent(self, state);
+        }
+
+        if ((i + 1u) < count)
+        {
+            HostPlant_integrateSegment(self, state, emfAlpha, emfBeta,
+                (float64)(breakpoints[i + 1u] - breakpoints[i]) * self->tick_s);
+        }
+    }
+
+    /* Rotor angle */
+    self->angleElec_rad += speedElec * duration_s;
+
+    if (self->angleElec_rad >= HOST_PLANT_TWO_PI)
+    {
+        self->angleElec_rad -= HOST_PLANT_TWO_PI;
+    }
+    else if (self->angleElec_rad < 0.0)
+    {
+        self->angleElec_rad += HOST_PLANT_TWO_PI;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    /* Mechanical system and simulated time */
+    HostPlant_integrateMechanics(self, sinAngle, cosAngle, duration_s);
+    self->time_s += duration_s;
+
+    return self->params.adcOffset_lsb + (shuntCurrent * self->params.adcPerAmpere_lsb);
+}
+
+
+void HostPlant_defaultParams(THostPlant_Params* params)
+{
+    /* System base values as computed by the config wizard */
+    float64 baseSpeedElec = floor((float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_MECH_SPEED_RPM *
+                                  (float64)IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS * HOST_PLANT_TWO_PI / 60.0);
+    float64 baseTime      = 1.0 / baseSpeedElec;
+    float64 baseTorque    = (float64)IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS *
+                            (float64)IFX_MS_FOCSOLUTIONF16_CFG_BASE_POWER_W / baseSpeedElec;
+    float64 baseInertia   = (float64)(IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS * IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS) *
+                            IFX_MS_FOCSOLUTIONF16_CFG_BASE_VOLTAGE_V * IFX_MS_FOCSOLUTIONF16_CFG_BASE_CURRENT_A *
+                            baseTime * baseTime * baseTime;
+    float64 torqueConstant;
+
+    (void)memset(params, 0, sizeof(*params));
+
+    /* Phase resistance and inductance of the flux estimator configuration */
+    params->resistance_Ohm = ((float64)IFX_MDA_FLUXESTIMATORF16_CFG_PHASE_RES_Q15 / 32768.0) *
+                             IFX_MDA_FLUXESTIMATORF16_CFG_BASE_RESISTANCE_OHM;
+    params->inductance_H   = ((float64)IFX_MDA_FLUXESTIMATORF16_CFG_PHASE_IND_Q15 / 32768.0) *
+                             (IFX_MDA_FLUXESTIMATORF16_CFG_BASE_INDUCTANCE_MH / 1000.0);
+
+    /* Flux linkage from the torque constant, T = 3/2 * p * flux * iq */
+    torqueConstant    = (baseTorque / IFX_MS_FOCSOLUTIONF16_CFG_BASE_CURRENT_A) /
+                        ((float64)IFX_MS_FOCSOLUTIONF16_CFG_INVERSE_TORQUE_CONSTANT_Q15 / 32768.0);
+    params->polePairs = (uint8)IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS;
+    params->flux_Wb   = torqueConstant / (1.5 * (float64)IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS);
+
+    /* Inertia from the normalized J/Ts of the speed pre-control, Ts is the speed loop period */
+    params->inertia_kgm2 = ((float64)IFX_MS_FOCSOLUTIONF16_CFG_INERTIA_BY_TS_Q /
+                            (float64)(1UL << IFX_MS_FOCSOLUTIONF16_CFG_INERTIA_BY_TS_Q_FORMAT)) *
+                           ((GPT12E_CAPREL_TIME * 1.0e-6) / baseTime) * baseInertia;
+
+    /* Viscous friction, normalized to base torque per base electrical speed */
+    params->viscousFriction_Nms = ((float64)IFX_MS_FOCSOLUTIONF16_CFG_VISCOUS_FRICTION_CONSTANT_Q15 / 32768.0) *
+                                  (baseTorque / baseSpeedElec) * (float64)IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS;
+
+    /* No load, 12 V supply */
+    params->loadTorque_Nm   = 0.0;
+    params->dcLinkVoltage_V = HOST_PLANT_DC_LINK_VOLTAGE;
+
+    /* Inverse of the current conversion of the measurement ADC: Q15 = (adc - offset) * gain >> shift */
+    params->adcOffset_lsb    = HOST_PLANT_ADC_OFFSET;
+    params->adcPerAmpere_lsb = (32768.0 * (float64)(1UL << HOST_PLANT_CURRENT_GAIN_SHIFT)) /
+                               (IFX_MHA_MEASUREMENTADC_CFG_BASE_CURRENT_A * (float64)HOST_PLANT_CURRENT_GAIN_Q);
+
+    /* Inverse of the DC-link voltage conversion: Q15 = adc * CONVERT_VDC_TO_Q15 >> VDC_BITS */
+    params->adcPerVolt_lsb = (32768.0 * (float64)(1UL << IFX_MHA_MEASUREMENTADC_CFG_VDC_BITS)) /
+                             (IFX_MHA_MEASUREMENTADC_CFG_BASE_VOLTAGE_V *
+                              (float64)IFX_MHA_MEASUREMENTADC_CFG_CONVERT_VDC_TO_Q15);
+}
+
+
+void HostPlant_init(THostPlant* self, const THostPlant_Params* params)
+{
+    (void)memset(self, 0, sizeof(*self));
+    self->params     = *params;
+    self->noiseState = 0x2545F491u;
+
+    /* Time base of the CCU6 T12 in center aligned mode */
+    self->period_tick = (uint16)(2u * ((uint16)CCU6_T12PR + 1u));
+    self->tick_s      = HOST_FOC_PWM_PERIOD_S / (float64)self->period_tick;
+
+    /* All high side switches off until the pattern generator transfers the first compare values */
+    for (uint8 phase = 0u; phase < 3u; phase++)
+    {
+        self->switchOn_tick[phase]  = self->period_tick;
+        self->switchOff_tick[phase] = 0u;
+    }
+}
+
+
+void HostPlant_runUpCounting(THostPlant* self)
+{
+    float64 sample_lsb = HostPlant_runHalfPeriod(self, 0u, self->period_tick / 2u, self->triggerTime_tick[0]);
+
+    HostSfr.adc1.RES_OUT_EIM.reg = HostPlant_convertShunt(self, sample_lsb);
+}
+
+
+void HostPlant_latchUpCounting(THostPlant* self)
+{
+    /* CC60..CC62 hold the switch on ticks while T12 counts up */
+    for (uint8 phase = 0u; phase < 3u; phase++)
+    {
+        self->switchOn_tick[phase] = HostSfr.ccu6Compare[phase];
+    }
+
+    /* Timer3 runs with half of the T12 clock */
+    self->triggerTime_tick[0] = (uint16)(HostSfr.timer3Compare << 1u);
+}
+
+
+void HostPlant_runDownCounting(THostPlant* self)
+{
+    float64 sample_lsb = HostPlant_runHalfPeriod(self, self->period_tick / 2u, self->period_tick,
+        self->triggerTime_tick[1]);
+
+    HostSfr.adc1.RES_OUT1.reg = HostPlant_convertShunt(self, sample_lsb);
+    HostSfr.adc1.RES_OUT6.reg = HostPlant_toAdc(self->params.dcLinkVoltage_V * self->params.adcPerVolt_lsb);
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA == 1
+
+    /* The conversion of channel 1 by the sequencer requests DMA channel 5, the completed task list its interrupt */
+    if (HostSfr_RequestDma(5u) == true)
+    {
+        HostFoc_DmaCh5();
+    }
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA */
+}
+
+
+void HostPlant_latchDownCounting(THostPlant* self)
+{
+    /* Half period in ticks */
+    uint16 halfPeriod = self->period_tick / 2u;
+
+    /* CC60..CC62 hold the switch off ticks counted backwards from the end of the period while T12 counts down */
+    for (uint8 phase = 0u; phase < 3u; phase++)
+    {
+        self->switchOff_tick[phase] = (uint16)(self->period_tick - HostSfr.ccu6Compare[phase]);
+    }
+
+    /* T13 is started at the period match */
+    self->triggerTime_tick[1] = (uint16)(halfPeriod + HostSfr.ccu6Compare[3]);
+}
+
+
+bool HostPlant_stepClosedLoop(THostPlant* self)
+{
+    /* Fast loop execution flag */
+    bool executed;
+
+    /* Up counting half, period match interrupt */
+    HostPlant_runUpCounting(self);
+    HostFoc_PeriodMatch();
+    HostPlant_latchUpCounting(self);
+
+    /* Down counting half, one match interrupt */
+    HostPlant_runDownCounting(self);
+    executed = HostFoc_OneMatch();
+    HostPlant_latchDownCounting(self);
+
+    /* GPT12 T6 speed loop timer */
+    self->periodCounter++;
+
+    if (self->periodCounter >= HOST_FOC_SPEED_LOOP_DIVIDER)
+    {
+        self->periodCounter = 0u;
+        HostFoc_SpeedLoop();
+        HostFoc_Background();
+    }
+
+    return executed;
+}
+
+
+void HostPlant_getCurrentsDq(const THostPlant* self, float64* currentD_A, float64* currentQ_A)
+{
+    /* Park transformation with the rotor angle */
+    float64 sinAngle = sin(self->angleElec_rad);
+    float64 cosAngle = cos(self->angleElec_rad);
+
+    *currentD_A = (self->currentAlpha_A * cosAngle) + (self->currentBeta_A * sinAngle);
+    *currentQ_A = (self->currentBeta_A * cosAngle) - (self->currentAlpha_A * sinAngle);
+}
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_capture.c
+ * \brief Captures of ProbeScope over a start-up, with and without the compressed buffers (PROBE_SCOPE_COMPRESS_EN).
+ *
+ * Back to back captures of PROBE_SCOPE_MAX_SAMPLES samples are started with ProbeScope_CaptureStart() after each fast
+ * loop. With compression each capture is decoded with host_probe_decode.h and compared with the sampled values. The
+ * cost of ProbeScope_Sampling() per sample is measured on the recorded channel values afterwards, minus the cost of
+ * replaying them.
+ *
+ * Channels with the resolution of their codes: 1 estimated speed (Q15, 2^2), 2 angle (32 bit, 2^22), 3 alpha current
+ * (Q15, 2^5), 4 sub-state (exact).
+ *
+ * Usage: foc_probe_capture [seconds] [sampling divider]
+ *        (foc_probe_capture_compress for the configuration with compressed buffers)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_bench.h"
+#include "host_foc.h"
+#include "host_plant.h"
+#include "probe_scope_cfg.h"
+#include "probe_scope.h"
+#if PROBE_SCOPE_COMPRESS_EN > 0
+#include "host_probe_decode.h"
+#endif
+
+/* Reference speed of the start-up */
+#define HOST_PROBE_CAPTURE_SPEED_RPM (1000)
+
+/* Number of channels */
+#define HOST_PROBE_CAPTURE_CH (4u)
+
+/* Recorded periods for the benchmark */
+#define HOST_PROBE_CAPTURE_TRACE (20000u)
+
+/* Calls of ProbeScope_Sampling() per benchmark run */
+#define HOST_PROBE_CAPTURE_CALLS (200000u)
+
+/* Channel values, replayed by the benchmark kernels */
+typedef struct
+{
+    sint16 speed;
+    uint32 angle;
+    sint16 current;
+    uint8  subState;
+} THostProbeCapture_Values;
+
+/* Error of the decoded samples of a channel */
+typedef struct
+{
+    float64 maxError;
+    float64 sumSquares;
+    uint32  inResolution;
+} THostProbeCapture_Error;
+
+static const uint8 HostProbeCapture_types[HOST_PROBE_CAPTURE_CH] = {
+    PROBE_SCOPE_INT16S, PROBE_SCOPE_INT32U, PROBE_SCOPE_INT16S, PROBE_SCOPE_INT08U
+};
+
+#if PROBE_SCOPE_COMPRESS_EN > 0
+static const uint8 HostProbeCapture_shifts[HOST_PROBE_CAPTURE_CH] = {2u, 22u, 5u, 0u};
+#endif
+
+static THostProbeCapture_Values HostProbeCapture_trace[HOST_PROBE_CAPTURE_TRACE];
+static THostProbeCapture_Values HostProbeCapture_bench;
+
+/* Reads the channel values of the FOC solution */
+static void HostProbeCapture_read(THostProbeCapture_Values* values)
+{
+    values->speed    = FocDemoClosedLoop.p_output.estimatedSpeedQ15;
+    values->angle    = FocDemoClosedLoop.angle;
+    values->current  = FocDemoClosedLoop.currentsAlphaBeta.real;
+    values->subState = (uint8)FocDemoClosedLoop.p_status.subState;
+}
+
+
+/* Points the channels to the given symbols */
+static void HostProbeCapture_setChannels(void* speed, void* angle, void* current, void* subState)
+{
+#if PROBE_SCOPE_COMPRESS_EN > 0
+    uint8 ch;
+
+#endif
+    ProbeScope_ChSet(1u, speed, HostProbeCapture_types[0]);
+    ProbeScope_ChSet(2u, angle, HostProbeCapture_types[1]);
+    ProbeScope_ChSet(3u, current, HostProbeCapture_types[2]);
+    ProbeScope_ChSet(4u, subState, HostProbeCapture_types[3]);
+#if PROBE_SCOPE_COMPRESS_EN > 0
+
+    for (ch = 0u; ch < HOST_PROBE_CAPTURE_CH; ch++)
+    {
+        ProbeScope_ChCompressSet((uint8)(ch + 1u), HostProbeCapture_shifts[ch]);
+    }
+#endif
+}
+
+
+/* Replays the recorded channel values without sampling them */
+static void HostProbeCapture_replayKernel(uint32 calls)
+{
+    uint32 i;
+
+    for (i = 0u; i < calls; i++)
+    {
+        HostProbeCapture_bench = HostProbeCapture_trace[i % HOST_PROBE_CAPTURE_TRACE];
+        HostBench_sink        += HostProbeCapture_bench.speed;
+    }
+}
+
+
+/* Replays the recorded channel values and samples them, back to back captures */
+static void HostProbeCapture_samplingKernel(uint32 calls)
+{
+    uint32 i;
+
+    for (i = 0u; i < calls; i++)
+    {
+        HostProbeCapture_bench = HostProbeCapture_trace[i % HOST_PROBE_CAPTURE_TRACE];
+        HostBench_sink        += HostProbeCapture_bench.speed;
+        ProbeScope_Sampling();
+
+        if (ProbeScope_DataRdyFlag != 0u)
+        {
+            ProbeScope_DataRdyFlag = 0u;
+        }
+    }
+}
+
+
+#if PROBE_SCOPE_COMPRESS_EN > 0
+/* Decodes the buffers of a complete capture and accumulates the error against the sampled values */
+static void HostProbeCapture_decode(const THostProbeCapture_Values* sampled, THostProbeCapture_Error* error)
+{
+    uint32 values[PROBE_SCOPE_COMPRESS_KEY_SAMPLES];
+    uint32 block;
+    uint32 pos;
+    uint8  ch;
+
+    for (ch = 0u; ch < HOST_PROBE_CAPTURE_CH; ch++)
+    {
+        const uint8* blocks = ProbeScope_ChBlocksGet((uint8)(ch + 1u));
+
+        for (block = 0u; block < (PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES); block++)
+        {
+            HostProbeDecode_block(&blocks[block * PROBE_SCOPE_COMPRESS_BLOCK_SIZE], HostProbeCapture_types[ch],
+                HostProbeCapture_shifts[ch], values);
+
+            for (pos = 0u; pos < PROBE_SCOPE_COMPRESS_KEY_SAMPLES; pos++)
+            {
+                const THostProbeCapture_Values* s = &sampled[(block * PROBE_SCOPE_COMPRESS_KEY_SAMPLES) + pos];
+                uint32 expected = (ch == 0u) ? (uint32)(uint16)s->speed : ((ch == 1u) ? s->angle :
+                                  ((ch == 2u) ? (uint32)(uint16)s->current : s->subState));
+                float64 e;
+
+                /* Difference in the width of the data type, the angle wraps around */
+                e = (ch == 1u) ? (float64)(sint32)(values[pos] - expected) :
+                    (HostProbeDecode_toFloat(values[pos], HostProbeCapture_types[ch]) -
+                     HostProbeDecode_toFloat(expected, HostProbeCapture_types[ch]));
+
+                error[ch].maxError      = fmax(error[ch].maxError, fabs(e));
+                error[ch].sumSquares   += e * e;
+                error[ch].inResolution += (fabs(e) <= ldexp(0.5, HostProbeCapture_shifts[ch])) ? 1u : 0u;
+            }
+        }
+    }
+}
+#endif
+
+
+int main(int argc, char** argv)
+{
+    float64                  seconds  = (argc > 1) ? atof(argv[1]) : 2.0;
+    uint16                   divider  = (argc > 2) ? (uint16)atoi(argv[2]) : 1u;
+    uint32                   periods  = (uint32)(seconds / HOST_FOC_PWM_PERIOD_S);
+    uint32                   captures = 0u;
+    uint32                   phase    = 0u;
+    uint32                   ix       = 0u;
+    THostProbeCapture_Values sampled[PROBE_SCOPE_MAX_SAMPLES];
+    THostPlant_Params        params;
+    THostPlant               plant;
+    THostBench_Result        replay;
+    THostBench_Result        sampling;
+    uint32                   period;
+#if PROBE_SCOPE_COMPRESS_EN > 0
+    static const char* const names[HOST_PROBE_CAPTURE_CH] = {"speed", "angle", "current", "sub-state"};
+    THostProbeCapture_Error  error[HOST_PROBE_CAPTURE_CH] = {{0.0, 0.0, 0u}};
+    uint8                    ch;
+#endif
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    HostPlant_init(&plant, &params);
+
+    ProbeScope_Init((uint32_t)(IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000u));
+    HostProbeCapture_setChannels(&FocDemoClosedLoop.p_output.estimatedSpeedQ15, &FocDemoClosedLoop.angle,
+        &FocDemoClosedLoop.currentsAlphaBeta.real, (void*)&FocDemoClosedLoop.p_status.subState);
+    ProbeScope_CaptureStart(divider);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = HOST_PROBE_CAPTURE_SPEED_RPM;
+
+    for (period = 0u; period < periods; period++)
+    {
+        (void)HostPlant_stepClosedLoop(&plant);
+
+        if (period < HOST_PROBE_CAPTURE_TRACE)
+        {
+            HostProbeCapture_read(&HostProbeCapture_trace[period]);
+        }
+
+        /* Every divider-th call after the start of a capture takes a sample */
+        if ((phase % divider) == 0u)
+        {
+            HostProbeCapture_read(&sampled[ix]);
+            ix++;
+        }
+
+        phase++;
+        ProbeScope_Sampling();
+
+        if (ProbeScope_DataRdyFlag != 0u)
+        {
+#if PROBE_SCOPE_COMPRESS_EN > 0
+            HostProbeCapture_decode(sampled, error);
+#endif
+            captures++;
+            phase = 0u;
+            ix    = 0u;
+            ProbeScope_CaptureStart(divider);
+        }
+    }
+
+    (void)printf("%u captures of %u samples at %.0f Hz, %u channels, ", (unsigned)captures,
+        (unsigned)PROBE_SCOPE_MAX_SAMPLES, (float64)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000.0 / (float64)divider,
+        (unsigned)HOST_PROBE_CAPTURE_CH);
+#if PROBE_SCOPE_COMPRESS_EN > 0
+    (void)printf("compressed, %u bytes per channel (%.2f bytes per sample)\n",
+        (unsigned)((PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES) * PROBE_SCOPE_COMPRESS_BLOCK_SIZE),
+        (float64)PROBE_SCOPE_COMPRESS_BLOCK_SIZE / (float64)PROBE_SCOPE_COMPRESS_KEY_SAMPLES);
+    (void)printf("keyframe every %u samples, %u bit codes\n\n", (unsigned)PROBE_SCOPE_COMPRESS_KEY_SAMPLES,
+        (unsigned)PROBE_SCOPE_COMPRESS_CODE_BITS);
+    (void)printf("%-10s %5s %14s %14s %14s\n", "channel", "shift", "max error LSB", "rms error LSB", "in resolution");
+
+    for (ch = 0u; ch < HOST_PROBE_CAPTURE_CH; ch++)
+    {
+        float64 samples = (float64)captures * (float64)PROBE_SCOPE_MAX_SAMPLES;
+
+        (void)printf("%-10s %5u %14.0f %14.1f %13.1f%%\n", names[ch], (unsigned)HostProbeCapture_shifts[ch],
+            error[ch].maxError, sqrt(error[ch].sumSquares / samples),
+            100.0 * (float64)error[ch].inResolution / samples);
+    }
+#else
+    (void)printf("uncompressed, %u bytes per channel (%u bytes per sample)\n",
+        (unsigned)(PROBE_SCOPE_MAX_SAMPLES * sizeof(uint32)), (unsigned)sizeof(uint32));
+#endif
+
+    /* Cost of the sampling, on the recorded values */
+    HostProbeCapture_setChannels(&HostProbeCapture_bench.speed, &HostProbeCapture_bench.angle,
+        &HostProbeCapture_bench.current, &HostProbeCapture_bench.subState);
+    ProbeScope_CaptureStart(1u);
+    (void)printf("\n");
+    HostBench_printHeader();
+    replay   = HostBench_print("replay of the channel values", HostProbeCapture_replayKernel, HOST_PROBE_CAPTURE_CALLS);
+    sampling = HostBench_print("ProbeScope_Sampling(), 4 channels", HostProbeCapture_samplingKernel,
+        HOST_PROBE_CAPTURE_CALLS);
+    (void)printf("sampling cost %.1f ns per sample\n", sampling.nsPerCall - replay.nsPerCall);
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_decode.c
+ * \brief Decoder of the compressed ProbeScope buffers, see host_probe_decode.h.
+ */
+
+#include <string.h>
+#include "host_probe_decode.h"
+#include "probe_scope_cfg.h"
+#include "probe_scope.h"
+
+/* Reads a little endian 32 bit word */
+static uint32 HostProbeDecode_word(const uint8* data)
+{
+    return (uint32)data[0] | ((uint32)data[1] << 8) | ((uint32)data[2] << 16) | ((uint32)data[3] << 24);
+}
+
+
+void HostProbeDecode_block(const uint8* block, uint8 dataType, uint8 shift, uint32* values)
+{
+    uint32 typeShift = (dataType <= PROBE_SCOPE_INT08S) ? 24u : ((dataType <= PROBE_SCOPE_INT16S) ? 16u : 0u);
+    uint32 cur;
+    uint32 slope;
+    uint32 pos;
+    sint32 code;
+
+    /* The samples in the upper bits, as the encoder */
+    cur       = HostProbeDecode_word(&block[0]) << typeShift;
+    slope     = HostProbeDecode_word(&block[4]) << typeShift;
+    values[0] = cur >> typeShift;
+
+    for (pos = 1u; pos < PROBE_SCOPE_COMPRESS_KEY_SAMPLES; pos++)
+    {
+#if PROBE_SCOPE_COMPRESS_CODE_BITS > 4
+        code = (sint32)(sint8)block[8u + pos - 1u];
+#else
+        code = (sint32)(block[8u + ((pos - 1u) >> 1)] >> (((pos - 1u) & 1u) * 4u)) & 0x0F;
+        code = (code >= 8) ? (code - 16) : code;
+#endif
+        cur        += slope + ((uint32)code << (typeShift + shift));
+        values[pos] = cur >> typeShift;
+    }
+}
+
+
+float64 HostProbeDecode_toFloat(uint32 value, uint8 dataType)
+{
+    float32 fp32;
+    float64 result;
+
+    switch (dataType)
+    {
+        case PROBE_SCOPE_INT08S:
+            result = (float64)(sint8)value;
+            break;
+
+        case PROBE_SCOPE_INT16S:
+            result = (float64)(sint16)value;
+            break;
+
+        case PROBE_SCOPE_INT32S:
+            result = (float64)(sint32)value;
+            break;
+
+        case PROBE_SCOPE_FP32:
+            (void)memcpy(&fp32, &value, sizeof(fp32));
+            result = (float64)fp32;
+            break;
+
+        default:
+            result = (float64)value;
+            break;
+    }
+
+    return result;
+}
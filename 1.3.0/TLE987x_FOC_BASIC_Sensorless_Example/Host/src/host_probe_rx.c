@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_rx.c
+ * \brief Receiver of the ProbeScope stream (PROBE_SCOPE_STREAM_EN), see probe_scope.h for the frame format.
+ *
+ * Reads the raw bytes received from UART1, e.g. captured from the serial port of the evaluation board or written by
+ * foc_probe_stream, and writes the samples as CSV with one column per enabled channel. The 16 bit sample index of the
+ * frames is extended to 32 bit. Gaps in the sample index are reported as dropped samples, they are samples dropped on
+ * a full ring buffer of the target or samples of lost frames. Gaps in the frame counter are reported as lost frames.
+ * Samples dropped after the last received frame do not show up as a gap.
+ * Frames with a wrong CRC, and a truncated frame at the end of the file, are counted as CRC errors and skipped, the
+ * receiver resynchronizes on the next sync bytes.
+ *
+ * Usage: foc_probe_rx <stream file> [CSV file]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "types.h"
+#include "probe_scope.h"
+
+/* Statistics of the received stream */
+typedef struct
+{
+    uint32 frames;         /* Frames with a valid CRC */
+    uint32 crcErrors;      /* Frames with a wrong CRC */
+    uint32 skippedBytes;   /* Bytes skipped to find the sync bytes */
+    uint32 samples;        /* Received samples */
+    uint32 droppedSamples; /* Gaps in the sample index */
+    uint32 lostFrames;     /* Gaps in the frame counter */
+} THostProbeRx_Stats;
+
+/* Returns the size of a sample of the data type in bytes, 0 for an unknown data type */
+static uint32 HostProbeRx_size(uint8 dataType)
+{
+    static const uint8 size[] = {1u, 1u, 2u, 2u, 4u, 4u, 4u};
+
+    return (dataType < sizeof(size)) ? size[dataType] : 0u;
+}
+
+
+/* CRC-8, polynomial 0x07, initial value 0, a bit at a time */
+static uint8 HostProbeRx_crc(const uint8* data, uint32 length)
+{
+    uint8  crc = 0u;
+    uint32 i;
+    uint32 bit;
+
+    for (i = 0u; i < length; i++)
+    {
+        crc ^= data[i];
+
+        for (bit = 0u; bit < 8u; bit++)
+        {
+            crc = ((crc & 0x80u) != 0u) ? (uint8)((crc << 1) ^ 0x07u) : (uint8)(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+
+/* Writes a little endian sample of the data type */
+static void HostProbeRx_writeValue(FILE* csv, const uint8* data, uint8 dataType)
+{
+    uint32  raw = 0u;
+    float32 value;
+    uint32  i;
+
+    for (i = 0u; i < HostProbeRx_size(dataType); i++)
+    {
+        raw |= (uint32)data[i] << (8u * i);
+    }
+
+    switch (dataType)
+    {
+        case PROBE_SCOPE_INT08S:
+            (void)fprintf(csv, ",%d", (int)(sint8)raw);
+            break;
+
+        case PROBE_SCOPE_INT16S:
+            (void)fprintf(csv, ",%d", (int)(sint16)raw);
+            break;
+
+        case PROBE_SCOPE_INT32S:
+            (void)fprintf(csv, ",%ld", (long)(sint32)raw);
+            break;
+
+        case PROBE_SCOPE_FP32:
+            (void)memcpy(&value, &raw, sizeof(value));
+            (void)fprintf(csv, ",%.9g", (float64)value);
+            break;
+
+        default:
+            (void)fprintf(csv, ",%lu", (unsigned long)raw);
+            break;
+    }
+}
+
+
+/* Decodes the frame at data, returns its size or 0 if there is no complete frame with a valid CRC */
+static uint32 HostProbeRx_frame(const uint8* data, uint32 available, FILE* csv, THostProbeRx_Stats* stats)
+{
+    static bool   started = false;
+    static uint32 nextSampleIx;
+    static uint8  nextSeq;
+    uint8         types[8];
+    uint32        channels   = 0u;
+    uint32        sampleSize = 0u;
+    uint32        length;
+    uint32        sampleIx;
+    uint32        sample;
+    uint32        ch;
+
+    if (available < PROBE_SCOPE_STREAM_HDR_SIZE)
+    {
+        return 0u;
+    }
+
+    for (ch = 0u; ch < 8u; ch++)
+    {
+        if ((data[6] & (1u << ch)) != 0u)
+        {
+            if ((PROBE_SCOPE_STREAM_HDR_SIZE + channels) >= available)
+            {
+                return 0u;
+            }
+
+            types[channels] = data[PROBE_SCOPE_STREAM_HDR_SIZE + channels];
+            sampleSize     += HostProbeRx_size(types[channels]);
+            channels++;
+        }
+    }
+
+    length = PROBE_SCOPE_STREAM_HDR_SIZE + channels + (data[5] * sampleSize) + 1u;
+
+    if ((length > available) || (HostProbeRx_crc(&data[2], length - 3u) != data[length - 1u]))
+    {
+        return 0u;
+    }
+
+    /* Sample index extended to 32 bit, gaps are dropped samples */
+    sampleIx = (uint32)data[3] | ((uint32)data[4] << 8);
+
+    if (started == false)
+    {
+        /* Header from the channel mask of the first frame */
+        (void)fprintf(csv, "sample");
+
+        for (ch = 0u; ch < 8u; ch++)
+        {
+            if ((data[6] & (1u << ch)) != 0u)
+            {
+                (void)fprintf(csv, ",ch%u", (unsigned)(ch + 1u));
+            }
+        }
+
+        (void)fprintf(csv, "\n");
+    }
+    else
+    {
+        sampleIx = nextSampleIx + (uint32)(uint16)(sampleIx - (uint16)nextSampleIx);
+        stats->droppedSamples += sampleIx - nextSampleIx;
+        stats->lostFrames     += (uint8)(data[2] - nextSeq);
+    }
+
+    started      = true;
+    nextSampleIx = sampleIx + data[5];
+    nextSeq      = (uint8)(data[2] + 1u);
+
+    for (sample = 0u; sample < data[5]; sample++)
+    {
+        const uint8* value = &data[PROBE_SCOPE_STREAM_HDR_SIZE + channels + (sample * sampleSize)];
+
+        (void)fprintf(csv, "%lu", (unsigned long)(sampleIx + sample));
+
+        for (ch = 0u; ch < channels; ch++)
+        {
+            HostProbeRx_writeValue(csv, value, types[ch]);
+            value += HostProbeRx_size(types[ch]);
+        }
+
+        (void)fprintf(csv, "\n");
+    }
+
+    stats->frames++;
+    stats->samples += data[5];
+
+    return length;
+}
+
+
+int main(int argc, char** argv)
+{
+    THostProbeRx_Stats stats = {0};
+    FILE*              input;
+    FILE*              csv;
+    uint8*             data;
+    long               size;
+    uint32             pos = 0u;
+
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "usage: foc_probe_rx <stream file> [CSV file]\n");
+        return 1;
+    }
+
+    input = fopen(argv[1], "rb");
+    csv   = (argc > 2) ? fopen(argv[2], "w") : stdout;
+
+    if ((input == NULL) || (csv == NULL))
+    {
+        (void)fprintf(stderr, "cannot open %s or %s\n", argv[1], (argc > 2) ? argv[2] : "stdout");
+        return 1;
+    }
+
+    (void)fseek(input, 0, SEEK_END);
+    size = ftell(input);
+    (void)fseek(input, 0, SEEK_SET);
+    data = (uint8*)malloc((size_t)size + 1u);
+
+    if ((data == NULL) || (fread(data, 1u, (size_t)size, input) != (size_t)size))
+    {
+        (void)fprintf(stderr, "cannot read %s\n", argv[1]);
+        return 1;
+    }
+
+    (void)fclose(input);
+
+    while ((pos + 1u) < (uint32)size)
+    {
+        uint32 length = 0u;
+
+        if ((data[pos] == PROBE_SCOPE_STREAM_SYNC0) && (data[pos + 1u] == PROBE_SCOPE_STREAM_SYNC1))
+        {
+            length = HostProbeRx_frame(&data[pos], (uint32)size - pos, csv, &stats);
+
+            if (length == 0u)
+            {
+                stats.crcErrors++;
+            }
+        }
+
+        if (length == 0u)
+        {
+            /* Resynchronize on the next sync bytes */
+            pos++;
+            stats.skippedBytes++;
+        }
+        else
+        {
+            pos += length;
+        }
+    }
+
+    if (csv != stdout)
+    {
+        (void)fclose(csv);
+    }
+
+    free(data);
+
+    (void)fprintf(stderr, "%ld bytes, %u frames, %u CRC errors, %u bytes skipped, %u lost frames\n", size,
+        (unsigned)stats.frames, (unsigned)stats.crcErrors, (unsigned)stats.skippedBytes, (unsigned)stats.lostFrames);
+    (void)fprintf(stderr, "%u samples received, %u samples dropped\n", (unsigned)stats.samples,
+        (unsigned)stats.droppedSamples);
+
+    return (stats.frames > 0u) ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_stream.c
+ * \brief Streaming of a start-up over the open loop to closed loop transition with the stream mode of ProbeScope
+ * (PROBE_SCOPE_STREAM_EN), over UART1 at the given baud rate.
+ *
+ * ProbeScope_Sampling() is called after each fast loop and ProbeScope_StreamTask() once per byte time of UART1, the
+ * bytes shifted out by UART1 are written to the stream file. The samples which were not dropped are written to the
+ * reference file as well, in the CSV format of foc_probe_rx, so the decoded stream can be compared with it. Bytes of
+ * the stream can be corrupted with the given probability to exercise the resynchronization of the receiver.
+ *
+ * Channels: 1 speed after the ramp, 2 estimated speed, 3 q current command (all Q15), 4 sub-state of the FOC solution.
+ *
+ * Usage: foc_probe_stream [stream file] [reference file] [baud] [sampling divider] [seconds] [byte error rate]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+#include "host_sfr.h"
+#include "probe_scope.h"
+
+/* Reference speed of the start-up */
+#define HOST_PROBE_STREAM_SPEED_RPM (1000)
+
+/* Bits per UART byte, 8N1 */
+#define HOST_PROBE_STREAM_UART_BITS (10.0)
+
+/* Writes one sample of the channels to the reference file, in the format of foc_probe_rx */
+static void HostProbeStream_writeReference(FILE* file, uint32 sampleIx)
+{
+    (void)fprintf(file, "%u,%d,%d,%d,%u\n", (unsigned)sampleIx, (int)FocDemoClosedLoop.rateLimitInSpeedQ15,
+        (int)FocDemoClosedLoop.p_output.estimatedSpeedQ15, (int)FocDemoClosedLoop.dqCommand.imag,
+        (unsigned)FocDemoClosedLoop.p_status.subState);
+}
+
+
+/* One byte time of UART1: shifts out the pending byte, possibly corrupted, and runs the stream task */
+static bool HostProbeStream_byteTime(FILE* stream, float64 errorRate, uint32* bytes)
+{
+    uint8 data;
+    bool  sent = HostSfr_ShiftUart1(&data);
+
+    if (sent == true)
+    {
+        if (((float64)rand() / (float64)RAND_MAX) < errorRate)
+        {
+            data ^= (uint8)(1u << (rand() % 8));
+        }
+
+        (void)fputc(data, stream);
+        (*bytes)++;
+    }
+
+    ProbeScope_StreamTask();
+
+    return sent;
+}
+
+
+int main(int argc, char** argv)
+{
+    const char*       streamName    = (argc > 1) ? argv[1] : "probe_stream.bin";
+    const char*       referenceName = (argc > 2) ? argv[2] : "probe_stream_ref.csv";
+    float64           baud          = (argc > 3) ? atof(argv[3]) : 921600.0;
+    uint16            divider       = (argc > 4) ? (uint16)atoi(argv[4]) : 4u;
+    float64           seconds       = (argc > 5) ? atof(argv[5]) : 1.0;
+    float64           errorRate     = (argc > 6) ? atof(argv[6]) : 0.0;
+    uint32            periods       = (uint32)(seconds / HOST_FOC_PWM_PERIOD_S);
+    float64           bytesPerPeriod = baud / HOST_PROBE_STREAM_UART_BITS * HOST_FOC_PWM_PERIOD_S;
+    float64           credit        = 0.0;
+    uint32            bytes         = 0u;
+    uint32            samples       = 0u;
+    uint32            idle          = 0u;
+    uint32            streamBytes;
+    THostPlant_Params params;
+    THostPlant        plant;
+    FILE*             stream;
+    FILE*             reference;
+    uint32            period;
+
+    stream    = fopen(streamName, "wb");
+    reference = fopen(referenceName, "w");
+
+    if ((stream == NULL) || (reference == NULL))
+    {
+        (void)fprintf(stderr, "cannot open %s or %s\n", streamName, referenceName);
+        return 1;
+    }
+
+    (void)fprintf(reference, "sample,ch1,ch2,ch3,ch4\n");
+    srand(1u);
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    HostPlant_init(&plant, &params);
+
+    /* Channels and start of the stream */
+    ProbeScope_Init((uint32_t)(IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000u));
+    ProbeScope_ChSet(1u, (void*)&FocDemoClosedLoop.rateLimitInSpeedQ15, PROBE_SCOPE_INT16S);
+    ProbeScope_ChSet(2u, &FocDemoClosedLoop.p_output.estimatedSpeedQ15, PROBE_SCOPE_INT16S);
+    ProbeScope_ChSet(3u, &FocDemoClosedLoop.dqCommand.imag, PROBE_SCOPE_INT16S);
+    ProbeScope_ChSet(4u, (void*)&FocDemoClosedLoop.p_status.subState, PROBE_SCOPE_INT08U);
+    ProbeScope_StreamStart(divider);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = HOST_PROBE_STREAM_SPEED_RPM;
+
+    for (period = 0u; period < periods; period++)
+    {
+        (void)HostPlant_stepClosedLoop(&plant);
+
+        /* Sampling clock of the scope, every divider-th call takes a sample */
+        if ((period % divider) == 0u)
+        {
+            uint32 dropped = ProbeScope_StreamDropCtr;
+
+            ProbeScope_Sampling();
+
+            if (ProbeScope_StreamDropCtr == dropped)
+            {
+                HostProbeStream_writeReference(reference, samples);
+            }
+
+            samples++;
+        }
+        else
+        {
+            ProbeScope_Sampling();
+        }
+
+        /* Background loop, once per byte time of UART1 */
+        for (credit += bytesPerPeriod; credit >= 1.0; credit -= 1.0)
+        {
+            (void)HostProbeStream_byteTime(stream, errorRate, &bytes);
+        }
+    }
+
+    /* Stop and send the rest of the ring buffer */
+    streamBytes = bytes;
+    ProbeScope_StreamStop();
+
+    while (idle < 2u)
+    {
+        idle = (HostProbeStream_byteTime(stream, errorRate, &bytes) == true) ? 0u : (idle + 1u);
+    }
+
+    (void)fclose(stream);
+    (void)fclose(reference);
+
+    (void)printf("%.3f s at %.0f Hz sampling, 4 channels, %.0f baud, ring buffer %u samples, %u samples per frame\n",
+        seconds, (float64)IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000.0 / (float64)divider, baud,
+        (unsigned)PROBE_SCOPE_STREAM_SAMPLES, (unsigned)PROBE_SCOPE_STREAM_FRAME_SAMPLES);
+    (void)printf("samples %u, dropped %u, %u bytes, %.1f bytes per sample, UART load %.1f %%\n", (unsigned)samples,
+        (unsigned)ProbeScope_StreamDropCtr, (unsigned)bytes,
+        (float64)bytes / (float64)(samples - ProbeScope_StreamDropCtr),
+        100.0 * (float64)streamBytes / (bytesPerPeriod * (float64)periods));
+
+    return 0;
+}
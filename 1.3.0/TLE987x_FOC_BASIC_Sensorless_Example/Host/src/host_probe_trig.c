@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_probe_trig.c
+ * \brief Triggered captures of ProbeScope with the compressed buffers (PROBE_SCOPE_COMPRESS_EN) over a start-up,
+ * decoded from the oldest block on and compared with the sampled values.
+ *
+ * The captures are started with ProbeScope_TrigStart() on the positive going slope of the angle, with the trigger at
+ * the given position in the capture, i.e. pre-triggered for positions above 0. The data ready flag is cleared right
+ * away, so every call of ProbeScope_Sampling() takes a sample and the sample of call n is at position
+ * n % PROBE_SCOPE_MAX_SAMPLES of the buffers. Each capture is checked for:
+ * - the end at a block boundary, i.e. the oldest block is whole
+ * - the trigger within PROBE_SCOPE_COMPRESS_KEY_SAMPLES - 1 samples of the given position
+ * - the sample counter, decoded from the oldest block on, is the one of the last PROBE_SCOPE_MAX_SAMPLES calls
+ * The error of the other channels is printed as by foc_probe_capture_compress.
+ *
+ * Channels with the resolution of their codes: 1 estimated speed (Q15, 2^2), 2 angle (32 bit, 2^22), 3 alpha current
+ * (Q15, 2^5), 4 sample counter (32 bit, exact).
+ *
+ * Usage: foc_probe_trig_compress [trigger position] [seconds]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+#include "host_probe_decode.h"
+#include "probe_scope_cfg.h"
+#include "probe_scope.h"
+
+/* Reference speed of the start-up */
+#define HOST_PROBE_TRIG_SPEED_RPM (1000)
+
+/* Number of channels */
+#define HOST_PROBE_TRIG_CH (4u)
+
+/* Trigger channel and level, half a turn of the angle */
+#define HOST_PROBE_TRIG_CH_ANGLE (2u)
+#define HOST_PROBE_TRIG_LEVEL    (0x80000000u)
+
+/* Channel values */
+typedef struct
+{
+    sint16 speed;
+    uint32 angle;
+    sint16 current;
+    uint32 counter;
+} THostProbeTrig_Values;
+
+/* Error of the decoded samples of a channel */
+typedef struct
+{
+    float64 maxError;
+    float64 sumSquares;
+    uint32  inResolution;
+} THostProbeTrig_Error;
+
+static const uint8 HostProbeTrig_types[HOST_PROBE_TRIG_CH] = {
+    PROBE_SCOPE_INT16S, PROBE_SCOPE_INT32U, PROBE_SCOPE_INT16S, PROBE_SCOPE_INT32U
+};
+
+static const uint8 HostProbeTrig_shifts[HOST_PROBE_TRIG_CH] = {2u, 22u, 5u, 0u};
+
+/* Channel values sampled by ProbeScope */
+static THostProbeTrig_Values HostProbeTrig_cur;
+
+/* Number of failed checks */
+static uint32 HostProbeTrig_failures;
+
+/* Prints a failed check of a capture */
+static void HostProbeTrig_check(const char* name, uint32 capture, bool passed)
+{
+    if (passed == false)
+    {
+        (void)printf("capture %u: %s FAIL\n", (unsigned)capture, name);
+        HostProbeTrig_failures++;
+    }
+}
+
+
+/* Returns the value of a channel, in the low bits */
+static uint32 HostProbeTrig_value(const THostProbeTrig_Values* values, uint8 ch)
+{
+    uint32 value;
+
+    switch (ch)
+    {
+        case 0u:
+            value = (uint32)(uint16)values->speed;
+            break;
+
+        case 1u:
+            value = values->angle;
+            break;
+
+        case 2u:
+            value = (uint32)(uint16)values->current;
+            break;
+
+        default:
+            value = values->counter;
+            break;
+    }
+
+    return value;
+}
+
+
+/* Decodes a complete capture from its oldest block on, checks the sample counter and accumulates the error of the
+ * other channels against the sampled values */
+static void HostProbeTrig_decode(const THostProbeTrig_Values* sampled, uint32 oldest, uint32 capture,
+    THostProbeTrig_Error* error)
+{
+    uint32 values[PROBE_SCOPE_COMPRESS_KEY_SAMPLES];
+    uint32 block;
+    uint32 pos;
+    uint32 ix;
+    bool   exact = true;
+    uint8  ch;
+
+    for (ch = 0u; ch < HOST_PROBE_TRIG_CH; ch++)
+    {
+        const uint8* blocks = ProbeScope_ChBlocksGet((uint8)(ch + 1u));
+
+        for (block = 0u; block < (PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES); block++)
+        {
+            ix = (oldest + (block * PROBE_SCOPE_COMPRESS_KEY_SAMPLES)) % PROBE_SCOPE_MAX_SAMPLES;
+            HostProbeDecode_block(&blocks[(ix / PROBE_SCOPE_COMPRESS_KEY_SAMPLES) * PROBE_SCOPE_COMPRESS_BLOCK_SIZE],
+                HostProbeTrig_types[ch], HostProbeTrig_shifts[ch], values);
+
+            for (pos = 0u; pos < PROBE_SCOPE_COMPRESS_KEY_SAMPLES; pos++)
+            {
+                uint32  expected = HostProbeTrig_value(&sampled[ix + pos], ch);
+                float64 e;
+
+                if (ch == (HOST_PROBE_TRIG_CH - 1u))
+                {
+                    exact = exact && (values[pos] == expected);
+                }
+                else
+                {
+                    /* Difference in the width of the data type, the angle wraps around */
+                    e = (ch == 1u) ? (float64)(sint32)(values[pos] - expected) :
+                        (HostProbeDecode_toFloat(values[pos], HostProbeTrig_types[ch]) -
+                         HostProbeDecode_toFloat(expected, HostProbeTrig_types[ch]));
+
+                    error[ch].maxError      = fmax(error[ch].maxError, fabs(e));
+                    error[ch].sumSquares   += e * e;
+                    error[ch].inResolution += (fabs(e) <= ldexp(0.5, HostProbeTrig_shifts[ch])) ? 1u : 0u;
+                }
+            }
+        }
+    }
+
+    HostProbeTrig_check("sample counter decoded from the oldest block", capture, exact);
+}
+
+
+int main(int argc, char** argv)
+{
+    uint32                dispPos  = (argc > 1) ? (uint32)atoi(argv[1]) : (PROBE_SCOPE_MAX_SAMPLES / 2u);
+    float64               seconds  = (argc > 2) ? atof(argv[2]) : 2.0;
+    uint32                periods  = (uint32)(seconds / HOST_FOC_PWM_PERIOD_S);
+    uint32                captures = 0u;
+    THostProbeTrig_Values sampled[PROBE_SCOPE_MAX_SAMPLES];
+    THostProbeTrig_Error  error[HOST_PROBE_TRIG_CH] = {{0.0, 0.0, 0u}};
+    static const char* const names[HOST_PROBE_TRIG_CH - 1u] = {"speed", "angle", "current"};
+    THostPlant_Params     params;
+    THostPlant            plant;
+    uint32                period;
+    uint32                oldest;
+    uint32                trigPos;
+    uint8                 ch;
+
+    if (dispPos > (PROBE_SCOPE_MAX_SAMPLES - 2u))
+    {
+        (void)printf("trigger position out of [0,%u]\n", (unsigned)(PROBE_SCOPE_MAX_SAMPLES - 2u));
+        return 1;
+    }
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    HostPlant_init(&plant, &params);
+
+    ProbeScope_Init((uint32_t)(IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ * 1000u));
+    ProbeScope_ChSet(1u, &HostProbeTrig_cur.speed, HostProbeTrig_types[0]);
+    ProbeScope_ChSet(2u, &HostProbeTrig_cur.angle, HostProbeTrig_types[1]);
+    ProbeScope_ChSet(3u, &HostProbeTrig_cur.current, HostProbeTrig_types[2]);
+    ProbeScope_ChSet(4u, &HostProbeTrig_cur.counter, HostProbeTrig_types[3]);
+
+    for (ch = 0u; ch < HOST_PROBE_TRIG_CH; ch++)
+    {
+        ProbeScope_ChCompressSet((uint8)(ch + 1u), HostProbeTrig_shifts[ch]);
+    }
+
+    ProbeScope_TrigStart(HOST_PROBE_TRIG_CH_ANGLE, HOST_PROBE_TRIG_LEVEL, dispPos, 1u);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = HOST_PROBE_TRIG_SPEED_RPM;
+
+    for (period = 0u; period < periods; period++)
+    {
+        (void)HostPlant_stepClosedLoop(&plant);
+
+        HostProbeTrig_cur.speed   = FocDemoClosedLoop.p_output.estimatedSpeedQ15;
+        HostProbeTrig_cur.angle   = FocDemoClosedLoop.angle;
+        HostProbeTrig_cur.current = FocDemoClosedLoop.currentsAlphaBeta.real;
+        HostProbeTrig_cur.counter = period;
+
+        /* The sample of this call is at the same position in the buffers */
+        sampled[period % PROBE_SCOPE_MAX_SAMPLES] = HostProbeTrig_cur;
+        ProbeScope_Sampling();
+
+        if (ProbeScope_DataRdyFlag != 0u)
+        {
+            /* The next sample overwrites the oldest one */
+            oldest  = (period + 1u) % PROBE_SCOPE_MAX_SAMPLES;
+            trigPos = ((ProbeScope_TrigIx + PROBE_SCOPE_MAX_SAMPLES) - oldest) % PROBE_SCOPE_MAX_SAMPLES;
+            HostProbeTrig_check("end at a block boundary", captures, (oldest % PROBE_SCOPE_COMPRESS_KEY_SAMPLES) == 0u);
+            HostProbeTrig_check("trigger position", captures,
+                ((trigPos + PROBE_SCOPE_COMPRESS_KEY_SAMPLES) > dispPos) &&
+                (trigPos < (dispPos + PROBE_SCOPE_COMPRESS_KEY_SAMPLES)));
+
+            if ((oldest % PROBE_SCOPE_COMPRESS_KEY_SAMPLES) == 0u)
+            {
+                HostProbeTrig_decode(sampled, oldest, captures, error);
+            }
+
+            captures++;
+            ProbeScope_DataRdyFlag = 0u;
+        }
+    }
+
+    HostProbeTrig_check("at least one capture", captures, captures > 0u);
+
+    (void)printf("%u triggered captures of %u samples, trigger at %u, keyframe every %u samples, %u bit codes\n\n",
+        (unsigned)captures, (unsigned)PROBE_SCOPE_MAX_SAMPLES, (unsigned)dispPos,
+        (unsigned)PROBE_SCOPE_COMPRESS_KEY_SAMPLES, (unsigned)PROBE_SCOPE_COMPRESS_CODE_BITS);
+    (void)printf("%-10s %5s %14s %14s %14s\n", "channel", "shift", "max error LSB", "rms error LSB", "in resolution");
+
+    for (ch = 0u; ch < (HOST_PROBE_TRIG_CH - 1u); ch++)
+    {
+        float64 samples = fmax((float64)captures * (float64)PROBE_SCOPE_MAX_SAMPLES, 1.0);
+
+        (void)printf("%-10s %5u %14.0f %14.1f %13.1f%%\n", names[ch], (unsigned)HostProbeTrig_shifts[ch],
+            error[ch].maxError, sqrt(error[ch].sumSquares / samples),
+            100.0 * (float64)error[ch].inResolution / samples);
+    }
+
+    (void)printf("%s\n", (HostProbeTrig_failures == 0u) ? "PASS" : "FAIL");
+
+    return (HostProbeTrig_failures == 0u) ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_profile.c
+ * \brief Execution time profile of the fast loop stages in a closed loop run against the PMSM plant.
+ *
+ * Built against foc_stack_profiler, i.e. with IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER enabled and the timestamp of
+ * host_profiler.h. Prints min/mean/max and the histogram of Ifx_MS_FocSolutionF16_getProfilerStatistics() per stage.
+ *
+ * Usage: foc_profile [reference rpm] [simulated seconds] [load torque mNm]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+#include "host_profiler.h"
+
+/* Back to back timestamp pairs evaluated for the timestamp overhead */
+#define HOST_PROFILE_OVERHEAD_SAMPLES (1000u)
+
+/* Names of the profiled stages, in the order of Ifx_MS_FocSolutionF16_ProfilerStage */
+static const char* const HostProfile_stageNames[Ifx_MS_FocSolutionF16_ProfilerStage_count] = {
+    "measureAndReconstruct",
+    "fluxEstimation",
+    "regulation",
+    "voltageGeneration",
+    "total",
+};
+
+/* Returns the smallest difference of two consecutive timestamps, which is contained once in each stage */
+static uint32 HostProfile_timestampOverhead(void)
+{
+    uint32 overhead = 0xFFFFFFFFu;
+    uint32 sample;
+
+    for (sample = 0; sample < HOST_PROFILE_OVERHEAD_SAMPLES; sample++)
+    {
+        uint32 start    = HostProfiler_timestamp();
+        uint32 duration = HostProfiler_timestamp() - start;
+
+        if (duration < overhead)
+        {
+            overhead = duration;
+        }
+    }
+
+    return overhead;
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    sint16                                   referenceRpm     = (argc > 1) ? (sint16)atoi(argv[1]) : 1000;
+    float64                                  simulatedSeconds = (argc > 2) ? atof(argv[2]) : 2.0;
+    float64                                  loadTorque_Nm    = (argc > 3) ? (atof(argv[3]) / 1000.0) : 0.0;
+    uint32                                   periods          = (uint32)(simulatedSeconds / HOST_FOC_PWM_PERIOD_S);
+    THostPlant_Params                        params;
+    THostPlant                               plant;
+    Ifx_MS_FocSolutionF16_ProfilerStatistics statistics[Ifx_MS_FocSolutionF16_ProfilerStage_count];
+    uint32                                   period;
+    uint32                                   stage;
+    uint32                                   bin;
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    for (period = 0; period < periods; period++)
+    {
+        (void)HostPlant_stepClosedLoop(&plant);
+    }
+
+    for (stage = 0; stage < (uint32)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+    {
+        Ifx_MS_FocSolutionF16_getProfilerStatistics(&FocDemoClosedLoop, (Ifx_MS_FocSolutionF16_ProfilerStage)stage,
+            &statistics[stage]);
+    }
+
+    (void)printf("scenario           : %d rpm, %.3f s, %.1f mNm load\n", (int)referenceRpm, simulatedSeconds,
+        loadTorque_Nm * 1000.0);
+    (void)printf("FOC state          : %d, %.1f rpm\n", (int)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state,
+        HostPlant_getSpeedRpm(&plant));
+    (void)printf("unit               : %s\n", HostProfiler_getUnit());
+    (void)printf("timestamp overhead : %u\n\n", (unsigned)HostProfile_timestampOverhead());
+
+    (void)printf("%-22s %9s %9s %9s %9s\n", "stage", "count", "min", "mean", "max");
+
+    for (stage = 0; stage < (uint32)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+    {
+        (void)printf("%-22s %9u %9u %9u %9u\n", HostProfile_stageNames[stage], (unsigned)statistics[stage].count,
+            (unsigned)((statistics[stage].count > 0u) ? statistics[stage].min : 0u),
+            (unsigned)Ifx_MS_FocSolutionF16_getProfilerMean(&FocDemoClosedLoop,
+                (Ifx_MS_FocSolutionF16_ProfilerStage)stage),
+            (unsigned)statistics[stage].max);
+    }
+
+    /* Histograms, one column per stage */
+    (void)printf("\nhistogram (bin width %u)\n%-11s", 1u << IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT, "from");
+
+    for (stage = 0; stage < (uint32)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+    {
+        (void)printf(" %9.9s", HostProfile_stageNames[stage]);
+    }
+
+    (void)printf("\n");
+
+    for (bin = 0; bin < IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS; bin++)
+    {
+        (void)printf("%10u%s", (unsigned)(bin << IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT),
+            (bin == (IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS - 1u)) ? "+" : " ");
+
+        for (stage = 0; stage < (uint32)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+        {
+            (void)printf(" %9u", (unsigned)statistics[stage].histogram[bin]);
+        }
+
+        (void)printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_profiler.c
+ * \brief Instruction counting timestamp of the fast loop profiler for the host build.
+ */
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+#include "host_profiler.h"
+
+/* File descriptor of the instruction counter, -1 if not available */
+static int  hostProfilerFd = -1;
+
+/* Counter has been opened (or the fallback selected) */
+static bool hostProfilerOpened = false;
+
+/* Opens the instruction counter of the calling thread */
+static void HostProfiler_open(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+
+    (void)memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    hostProfilerFd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+
+    hostProfilerOpened = true;
+}
+
+
+uint32 HostProfiler_timestamp(void)
+{
+    uint64 count = 0u;
+
+    if (hostProfilerOpened == false)
+    {
+        HostProfiler_open();
+    }
+
+    if ((hostProfilerFd < 0) || (read(hostProfilerFd, &count, sizeof(count)) != (ssize_t)sizeof(count)))
+    {
+        struct timespec ts;
+        (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+        count = ((uint64)ts.tv_sec * 1000000000ULL) + (uint64)ts.tv_nsec;
+    }
+
+    return (uint32)count;
+}
+
+
+const char* HostProfiler_getUnit(void)
+{
+    if (hostProfilerOpened == false)
+    {
+        HostProfiler_open();
+    }
+
+    return (hostProfilerFd < 0) ? "ns" : "instructions";
+}
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_replay.c
+ * \brief Replays a recording through the flux estimator, the FOC controller and the modulator, see
+ * host_replay_engine.h, e.g. to bisect a parameter change against a recording of a field unit.
+ *
+ * Parameters which differ from the project configuration are given as name=value:
+ * - pllGain: proportional gain of the PLL, e.g. 200.0 for the configured 25600 in Q7
+ * - alphaTc, betaTc: time constants of the flux filters in us, the gains of the filters are scaled with them
+ * - speedTc: time constant of the speed filter in us
+ *
+ * One of them may be a comma separated list, the recording is then replayed once per value. Each replay is compared
+ * with the recorded signals: the estimated speed, the angle in closed loop and the voltage command while running, as
+ * far as they are recorded. The replayed signals of the last replay are written to the output CSV.
+ *
+ * Usage: foc_replay <recording CSV> [output CSV or -] [name=value[,value...]]...
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "host_bench.h"
+#include "host_replay_engine.h"
+
+/* Most values of a parameter list */
+#define HOST_REPLAY_VALUES (32u)
+
+/* Parameters which can be changed */
+typedef enum
+{
+    HostReplayTool_Param_pllGain = 0,
+    HostReplayTool_Param_alphaTc,
+    HostReplayTool_Param_betaTc,
+    HostReplayTool_Param_speedTc,
+    HostReplayTool_Param_total
+} THostReplayTool_Param;
+
+/* Deviation of a replayed signal from the recorded one */
+typedef struct
+{
+    float64 maxError;
+    float64 sumSquares;
+    uint32  count;
+} THostReplayTool_Error;
+
+static const char* const HostReplayTool_paramNames[HostReplayTool_Param_total] = {
+    "pllGain", "alphaTc", "betaTc", "speedTc"
+};
+
+/* Adds a deviation */
+static void HostReplayTool_add(THostReplayTool_Error* error, float64 deviation)
+{
+    error->maxError    = fmax(error->maxError, fabs(deviation));
+    error->sumSquares += deviation * deviation;
+    error->count++;
+}
+
+
+/* Prints max and RMS of a deviation, or - if it was not evaluated */
+static void HostReplayTool_print(const THostReplayTool_Error* error)
+{
+    if (error->count > 0u)
+    {
+        (void)printf(" %9.3f %9.3f", error->maxError, sqrt(error->sumSquares / (float64)error->count));
+    }
+    else
+    {
+        (void)printf(" %9s %9s", "-", "-");
+    }
+}
+
+
+/* Stores the value of a parameter */
+static void HostReplayTool_set(THostReplay_Params* params, THostReplayTool_Param param, float64 value)
+{
+    switch (param)
+    {
+        case HostReplayTool_Param_pllGain:
+            params->pllGain = value;
+            break;
+
+        case HostReplayTool_Param_alphaTc:
+            params->alphaTimeConst_us = (uint32)value;
+            break;
+
+        case HostReplayTool_Param_betaTc:
+            params->betaTimeConst_us = (uint32)value;
+            break;
+
+        default:
+            params->speedTimeConst_us = (uint32)value;
+            break;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    const float64         speedToRadps = IFX_MDA_FLUXESTIMATORF16_CFG_BASE_ELEC_SPEED_RADPS / 32768.0;
+    const float64         angleToDeg   = 360.0 / 4294967296.0;
+    THostReplay_Params    params       = {0};
+    THostReplayTool_Param sweep        = HostReplayTool_Param_total;
+    float64               values[HOST_REPLAY_VALUES];
+    uint32                valueCount   = 1u;
+    THostReplay_Record*   records;
+    uint32                columns;
+    uint32                cycles;
+    uint64                totalNs      = 0u;
+    FILE*                 file;
+    sint32                arg;
+    uint32                run;
+
+    if (argc < 2)
+    {
+        (void)fprintf(stderr, "usage: foc_replay <recording CSV> [output CSV or -] [name=value[,value...]]...\n");
+        return 2;
+    }
+
+    /* Parameters, a list is replayed value by value */
+    values[0] = 0.0;
+
+    for (arg = 3; arg < argc; arg++)
+    {
+        THostReplayTool_Param param;
+        char*                 value = strchr(argv[arg], '=');
+        char*                 next;
+
+        for (param = HostReplayTool_Param_pllGain; param < HostReplayTool_Param_total; param++)
+        {
+            if ((value != NULL) && (strncmp(argv[arg], HostReplayTool_paramNames[param], (size_t)(value - argv[arg]))
+                                    == 0) && (strlen(HostReplayTool_paramNames[param]) == (size_t)(value - argv[arg])))
+            {
+                break;
+            }
+        }
+
+        if (param == HostReplayTool_Param_total)
+        {
+            (void)fprintf(stderr, "unknown parameter %s\n", argv[arg]);
+            return 2;
+        }
+
+        value++;
+
+        if (strchr(value, ',') == NULL)
+        {
+            HostReplayTool_set(&params, param, atof(value));
+            continue;
+        }
+
+        if (sweep != HostReplayTool_Param_total)
+        {
+            (void)fprintf(stderr, "only one parameter can be a list\n");
+            return 2;
+        }
+
+        sweep      = param;
+        valueCount = 0u;
+
+        for (next = strtok(value, ","); (next != NULL) && (valueCount < HOST_REPLAY_VALUES); next = strtok(NULL, ","))
+        {
+            values[valueCount] = atof(next);
+            valueCount++;
+        }
+    }
+
+    file = fopen(argv[1], "r");
+
+    if (file == NULL)
+    {
+        (void)fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    cycles = HostReplay_read(file, &records, &columns);
+    (void)fclose(file);
+
+    if (cycles == 0u)
+    {
+        (void)fprintf(stderr, "%s: no cycles or missing columns (currentAlpha, currentBeta, dcLinkVoltage, "
+                              "voltageAmplitude, voltageAngle)\n", argv[1]);
+        return 1;
+    }
+
+    (void)printf("%u cycles, %.3f s recorded\n", (unsigned)cycles,
+        (float64)cycles * (float64)IFX_MS_FOCSOLUTIONF16_CFG_SAMPLING_TIME_US * 1e-6);
+    (void)printf("%-10s %19s %19s %19s %9s\n", (sweep != HostReplayTool_Param_total) ? HostReplayTool_paramNames[sweep]
+                 : "run", "speed rad/s max rms", "angle deg max rms", "voltage LSB max rms", "ns/cycle");
+
+    for (run = 0u; run < valueCount; run++)
+    {
+        THostReplayTool_Error speedError   = {0};
+        THostReplayTool_Error angleError   = {0};
+        THostReplayTool_Error voltageError = {0};
+        THostReplay           replay;
+        THostReplay_Output    output;
+        FILE*                 out          = NULL;
+        uint64                startNs;
+        uint64                durationNs;
+        uint32                cycle;
+
+        if (sweep != HostReplayTool_Param_total)
+        {
+            HostReplayTool_set(&params, sweep, values[run]);
+        }
+
+        /* Replay, timed without the output file */
+        HostReplay_init(&replay, &params, columns);
+        startNs = HostBench_nowNs();
+
+        for (cycle = 0u; cycle < cycles; cycle++)
+        {
+            HostReplay_step(&replay, &records[cycle], &output);
+            HostBench_sink += output.estimatedAngle;
+        }
+
+        durationNs = HostBench_nowNs() - startNs;
+        totalNs   += durationNs;
+
+        /* Second replay for the comparison with the recording and for the output file */
+        if ((run == (valueCount - 1u)) && (argc > 2) && (strcmp(argv[2], "-") != 0))
+        {
+            out = fopen(argv[2], "w");
+
+            if (out == NULL)
+            {
+                (void)fprintf(stderr, "cannot open %s\n", argv[2]);
+                return 1;
+            }
+
+            HostReplay_writeOutputHeader(out);
+        }
+
+        HostReplay_init(&replay, &params, columns);
+
+        for (cycle = 0u; cycle < cycles; cycle++)
+        {
+            const THostReplay_Record* record  = &records[cycle];
+            bool                      running = true;
+
+            HostReplay_step(&replay, record, &output);
+
+            if (out != NULL)
+            {
+                HostReplay_writeOutput(out, cycle, &output);
+            }
+
+            if ((columns & (1u << HostReplay_Column_state)) != 0u)
+            {
+                running = (record->state == (uint8)Ifx_MS_FocSolutionF16_State_run)
+                          || (record->state == (uint8)Ifx_MS_FocSolutionF16_State_rampDown);
+            }
+
+            if ((columns & (1u << HostReplay_Column_estimatedSpeed)) != 0u)
+            {
+                HostReplayTool_add(&speedError,
+                    (float64)(output.estimatedSpeedQ15 - record->estimatedSpeedQ15) * speedToRadps);
+            }
+
+            /* Angle of the Park transformation, which is the estimated angle in closed loop */
+            if (((columns & (1u << HostReplay_Column_angle)) != 0u) && (running == true)
+                && (((columns & (1u << HostReplay_Column_subState)) == 0u)
+                    || (record->subState == (uint8)Ifx_MS_FocSolutionF16_SubState_closedLoop)))
+            {
+                HostReplayTool_add(&angleError,
+                    (float64)(sint32)(output.estimatedAngle - record->angle) * angleToDeg);
+            }
+
+            if (((columns & (1u << HostReplay_Column_currentQRef)) != 0u) && (running == true))
+            {
+                HostReplayTool_add(&voltageError,
+                    (float64)(output.voltageCommand.amplitude - record->voltageCommand.amplitude));
+            }
+        }
+
+        if (out != NULL)
+        {
+            (void)fclose(out);
+        }
+
+        if (sweep != HostReplayTool_Param_total)
+        {
+            (void)printf("%-10g", values[run]);
+        }
+        else
+        {
+            (void)printf("%-10u", (unsigned)run);
+        }
+
+        HostReplayTool_print(&speedError);
+        HostReplayTool_print(&angleError);
+        HostReplayTool_print(&voltageError);
+        (void)printf(" %9.1f\n", (float64)durationNs / (float64)cycles);
+    }
+
+    (void)printf("replay %.1f ms for %u replay(s), %.0fx real time\n", (float64)totalNs * 1e-6, (unsigned)valueCount,
+        ((float64)cycles * (float64)IFX_MS_FOCSOLUTIONF16_CFG_SAMPLING_TIME_US * 1e3 * (float64)valueCount)
+        / (float64)totalNs);
+
+    free(records);
+
+    return 0;
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_replay_engine.c
+ * \brief Offline replay of recorded fast loop signals, see host_replay_engine.h.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Ifx_Math_InvClarke.h"
+#include "Ifx_Math_PolarToCart.h"
+#include "host_replay_engine.h"
+
+/* Longest line of a recording */
+#define HOST_REPLAY_LINE_LENGTH (1024)
+
+/* Columns which a recording has to contain */
+#define HOST_REPLAY_COLUMNS_REQUIRED                                                                    \
+    ((1u << HostReplay_Column_currentAlpha) | (1u << HostReplay_Column_currentBeta)                     \
+     | (1u << HostReplay_Column_dcLinkVoltage) | (1u << HostReplay_Column_voltageAmplitude)             \
+     | (1u << HostReplay_Column_voltageAngle))
+
+/* Current references, the FOC controller is replayed if both are recorded */
+#define HOST_REPLAY_COLUMNS_DQ_COMMAND \
+    ((1u << HostReplay_Column_currentDRef) | (1u << HostReplay_Column_currentQRef))
+
+const char* const HostReplay_columnNames[HostReplay_Column_total] = {
+    "currentAlpha", "currentBeta", "dcLinkVoltage", "voltageAmplitude", "voltageAngle", "state", "subState", "angle",
+    "currentDRef", "currentQRef", "speedRef", "estimatedSpeed"
+};
+
+/* Returns the column of a name of the header, HostReplay_Column_total for an unknown name */
+static THostReplay_Column HostReplay_column(const char* name)
+{
+    uint32 column;
+
+    for (column = 0u; column < (uint32)HostReplay_Column_total; column++)
+    {
+        if (strcmp(name, HostReplay_columnNames[column]) == 0)
+        {
+            break;
+        }
+    }
+
+    return (THostReplay_Column)column;
+}
+
+
+/* Stores the value of a column in the record */
+static void HostReplay_setValue(THostReplay_Record* record, THostReplay_Column column, sint64 value)
+{
+    switch (column)
+    {
+        case HostReplay_Column_currentAlpha:
+            record->currentsAlphaBeta.real = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_currentBeta:
+            record->currentsAlphaBeta.imag = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_dcLinkVoltage:
+            record->dcLinkVoltageQ15 = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_voltageAmplitude:
+            record->voltageCommand.amplitude = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_voltageAngle:
+            record->voltageCommand.angle = (uint32)value;
+            break;
+
+        case HostReplay_Column_state:
+            record->state = (uint8)value;
+            break;
+
+        case HostReplay_Column_subState:
+            record->subState = (uint8)value;
+            break;
+
+        case HostReplay_Column_angle:
+            record->angle = (uint32)value;
+            break;
+
+        case HostReplay_Column_currentDRef:
+            record->dqCommand.real = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_currentQRef:
+            record->dqCommand.imag = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_speedRef:
+            record->speedRefQ15 = (Ifx_Math_Fract16)value;
+            break;
+
+        case HostReplay_Column_estimatedSpeed:
+            record->estimatedSpeedQ15 = (Ifx_Math_Fract16)value;
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+uint32 HostReplay_read(FILE* file, THostReplay_Record** records, uint32* columns)
+{
+    THostReplay_Column map[HOST_REPLAY_LINE_LENGTH / 2];
+    char               line[HOST_REPLAY_LINE_LENGTH];
+    uint32             fields   = 0u;
+    uint32             cycles   = 0u;
+    uint32             capacity = 0u;
+    char*              field;
+
+    *records = NULL;
+    *columns = 0u;
+
+    /* Header, unknown columns such as the sample index of foc_probe_rx are skipped */
+    if (fgets(line, (int)sizeof(line), file) == NULL)
+    {
+        return 0u;
+    }
+
+    for (field = strtok(line, ",\r\n"); field != NULL; field = strtok(NULL, ",\r\n"))
+    {
+        map[fields] = HostReplay_column(field);
+
+        if (map[fields] != HostReplay_Column_total)
+        {
+            *columns |= 1u << map[fields];
+        }
+
+        fields++;
+    }
+
+    if ((*columns & HOST_REPLAY_COLUMNS_REQUIRED) != HOST_REPLAY_COLUMNS_REQUIRED)
+    {
+        return 0u;
+    }
+
+    while (fgets(line, (int)sizeof(line), file) != NULL)
+    {
+        THostReplay_Record* record;
+        uint32              ix = 0u;
+
+        if ((line[0] == '\r') || (line[0] == '\n'))
+        {
+            continue;
+        }
+
+        if (cycles == capacity)
+        {
+            THostReplay_Record* grown;
+
+            capacity = (capacity == 0u) ? 4096u : (capacity * 2u);
+            grown    = (THostReplay_Record*)realloc(*records, capacity * sizeof(THostReplay_Record));
+
+            if (grown == NULL)
+            {
+                free(*records);
+                *records = NULL;
+                return 0u;
+            }
+
+            *records = grown;
+        }
+
+        record = &(*records)[cycles];
+        (void)memset(record, 0, sizeof(*record));
+
+        for (field = strtok(line, ",\r\n"); (field != NULL) && (ix < fields); field = strtok(NULL, ",\r\n"))
+        {
+            HostReplay_setValue(record, map[ix], strtoll(field, NULL, 0));
+            ix++;
+        }
+
+        cycles++;
+    }
+
+    return cycles;
+}
+
+
+void HostReplay_writeHeader(FILE* file)
+{
+    uint32 column;
+
+    for (column = 0u; column < (uint32)HostReplay_Column_total; column++)
+    {
+        (void)fprintf(file, (column == 0u) ? "%s" : ",%s", HostReplay_columnNames[column]);
+    }
+
+    (void)fprintf(file, "\n");
+}
+
+
+void HostReplay_writeRecord(FILE* file, const THostReplay_Record* record)
+{
+    (void)fprintf(file, "%d,%d,%d,%d,%lu,%u,%u,%lu,%d,%d,%d,%d\n", (int)record->currentsAlphaBeta.real,
+        (int)record->currentsAlphaBeta.imag, (int)record->dcLinkVoltageQ15, (int)record->voltageCommand.amplitude,
+        (unsigned long)record->voltageCommand.angle, (unsigned)record->state, (unsigned)record->subState,
+        (unsigned long)record->angle, (int)record->dqCommand.real, (int)record->dqCommand.imag,
+        (int)record->speedRefQ15, (int)record->estimatedSpeedQ15);
+}
+
+
+void HostReplay_writeOutputHeader(FILE* file)
+{
+    (void)fprintf(file, "cycle,estimatedSpeed,estimatedAngle,voltageAmplitude,voltageAngle,actualAmplitude,"
+                        "actualAngle\n");
+}
+
+
+void HostReplay_writeOutput(FILE* file, uint32 cycle, const THostReplay_Output* output)
+{
+    (void)fprintf(file, "%lu,%d,%lu,%d,%lu,%d,%lu\n", (unsigned long)cycle, (int)output->estimatedSpeedQ15,
+        (unsigned long)output->estimatedAngle, (int)output->voltageCommand.amplitude,
+        (unsigned long)output->voltageCommand.angle, (int)output->actualVoltage.amplitude,
+        (unsigned long)output->actualVoltage.angle);
+}
+
+
+/* Sets the time constant of a flux filter, its gain emulates the integrator and is proportional to the time
+ * constant */
+static void HostReplay_setFluxFilter(Ifx_Math_LowPass1stF16* filter, uint32 timeConstant_us)
+{
+    uint32 previous_us = Ifx_Math_LowPass1stF16_getTimeConstant_us(filter);
+    sint32 gainQ14     = Ifx_Math_LowPass1stF16_getGain(filter);
+
+    Ifx_Math_LowPass1stF16_setTimeConstant_us(filter, timeConstant_us);
+    gainQ14 = (sint32)(((sint64)gainQ14 * (sint64)timeConstant_us + (sint64)(previous_us / 2u)) / (sint64)previous_us);
+    Ifx_Math_LowPass1stF16_setGain(filter, (Ifx_Math_Fract16)((gainQ14 > 32767) ? 32767 : gainQ14));
+}
+
+
+void HostReplay_init(THostReplay* self, const THostReplay_Params* params, uint32 columns)
+{
+    /* Modules as initialized by Ifx_MS_FocSolutionF16_init() */
+    Ifx_MDA_FluxEstimatorF16_init(&(self->fluxEstimator));
+    Ifx_MDA_FocControllerF16_init(&(self->focController));
+    Ifx_MAS_ModulatorF16_init(&(self->modulator));
+
+    /* The power stage is taken as enabled for the whole recording */
+    Ifx_MAS_ModulatorF16_enable(&(self->modulator), true);
+
+    self->voltageAlphaBeta.real         = 0;
+    self->voltageAlphaBeta.imag         = 0;
+    self->previousVoltageAlphaBeta.real = 0;
+    self->previousVoltageAlphaBeta.imag = 0;
+    self->columns                       = columns;
+
+    if (params == NULL)
+    {
+        return;
+    }
+
+    if (params->pllGain > 0.0)
+    {
+        /* Q format of the configuration, reduced as far as needed for the gain to fit */
+        Ifx_Math_Fract16Q gain = Ifx_Math_PLLF16_getPropGain(&(self->fluxEstimator.p_pllFilter));
+
+        while ((gain.qFormat > 0) && ((params->pllGain * (float64)(1u << gain.qFormat)) > 32767.0))
+        {
+            gain.qFormat = (Ifx_Math_FractQFormat)((uint32)gain.qFormat - 1u);
+        }
+
+        gain.value = (Ifx_Math_Fract16)lround(fmin(params->pllGain * (float64)(1u << gain.qFormat), 32767.0));
+        Ifx_Math_PLLF16_setPropGain(&(self->fluxEstimator.p_pllFilter), gain);
+    }
+
+    if (params->alphaTimeConst_us > 0u)
+    {
+        HostReplay_setFluxFilter(&(self->fluxEstimator.p_alphaFilter), params->alphaTimeConst_us);
+    }
+
+    if (params->betaTimeConst_us > 0u)
+    {
+        HostReplay_setFluxFilter(&(self->fluxEstimator.p_betaFilter), params->betaTimeConst_us);
+    }
+
+    if (params->speedTimeConst_us > 0u)
+    {
+        Ifx_Math_LowPass1stF16_setTimeConstant_us(&(self->fluxEstimator.p_speedFilter), params->speedTimeConst_us);
+    }
+}
+
+
+void HostReplay_step(THostReplay* self, const THostReplay_Record* record, THostReplay_Output* output)
+{
+    Ifx_Math_PolarFract16           voltageCommand = {0, 0};
+    Ifx_MDA_FluxEstimatorF16_Output fluxEstimatorOutput;
+    Ifx_MAS_ModulatorF16_Output     modulatorOutput;
+    bool                            running        = true;
+    bool                            closedLoop     = true;
+
+    if ((self->columns & (1u << HostReplay_Column_state)) != 0u)
+    {
+        running = (record->state == (uint8)Ifx_MS_FocSolutionF16_State_run)
+                  || (record->state == (uint8)Ifx_MS_FocSolutionF16_State_rampDown);
+    }
+
+    if ((self->columns & (1u << HostReplay_Column_subState)) != 0u)
+    {
+        closedLoop = record->subState == (uint8)Ifx_MS_FocSolutionF16_SubState_closedLoop;
+    }
+
+    /* Flux estimator, enabled by the state machine in the run and ramp down states */
+    Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), (running == true)
+                                        ? Ifx_MDA_FluxEstimatorF16_Mode_enable : Ifx_MDA_FluxEstimatorF16_Mode_disable);
+    Ifx_MDA_FluxEstimatorF16_execute(&(self->fluxEstimator), self->previousVoltageAlphaBeta,
+        record->currentsAlphaBeta);
+    self->previousVoltageAlphaBeta = self->voltageAlphaBeta;
+    Ifx_MDA_FluxEstimatorF16_getOutput(&(self->fluxEstimator), &fluxEstimatorOutput);
+
+    output->estimatedSpeedQ15        = fluxEstimatorOutput.speedQ15;
+    output->estimatedAngle           = fluxEstimatorOutput.anglePLL;
+    output->voltageCommand.amplitude = 0;
+    output->voltageCommand.angle     = 0;
+
+    if (running == true)
+    {
+        voltageCommand = record->voltageCommand;
+
+        if ((self->columns & HOST_REPLAY_COLUMNS_DQ_COMMAND) == HOST_REPLAY_COLUMNS_DQ_COMMAND)
+        {
+            Ifx_MDA_FocControllerF16_Output focControllerOutput;
+            uint32                          angle = (closedLoop == true) ? fluxEstimatorOutput.anglePLL : record->angle;
+            Ifx_Math_Fract16                speedQ15 = fluxEstimatorOutput.speedQ15;
+
+            if ((self->columns & (1u << HostReplay_Column_speedRef)) != 0u)
+            {
+                speedQ15 = record->speedRefQ15;
+            }
+
+            Ifx_MDA_FocControllerF16_execute(&(self->focController), record->currentsAlphaBeta, record->dqCommand,
+                angle, speedQ15, record->dcLinkVoltageQ15);
+            Ifx_MDA_FocControllerF16_getOutput(&(self->focController), &focControllerOutput);
+            output->voltageCommand = focControllerOutput.voltageCommandPolar;
+        }
+    }
+    else
+    {
+        /* The FOC solution resets the controller while it is not running */
+        Ifx_MDA_FocControllerF16_reset(&(self->focController));
+
+        /* and the filters of the flux estimator in the off and standby states, before a restart */
+        if ((record->state == (uint8)Ifx_MS_FocSolutionF16_State_off)
+            || (record->state == (uint8)Ifx_MS_FocSolutionF16_State_standBy))
+        {
+            Ifx_Math_LowPass1stF16_setPreviousValue(&(self->fluxEstimator.p_alphaFilter), 0);
+            Ifx_Math_LowPass1stF16_setPreviousValue(&(self->fluxEstimator.p_betaFilter), 0);
+            Ifx_Math_LowPass1stF16_setPreviousValue(&(self->fluxEstimator.p_speedFilter), 0);
+            Ifx_Math_PLLF16_resetBuffer(&self->fluxEstimator.p_pllFilter);
+            Ifx_Math_PLLF16_setPreviousValue(&self->fluxEstimator.p_pllFilter, 0);
+        }
+    }
+
+    /* Modulator with the recorded command, the actual voltage is the input of the flux estimator in the next cycle */
+    Ifx_MAS_ModulatorF16_execute(&(self->modulator), voltageCommand, record->dcLinkVoltageQ15,
+        Ifx_Math_InvClarke_F16(record->currentsAlphaBeta));
+    Ifx_MAS_ModulatorF16_getOutput(&(self->modulator), &modulatorOutput);
+    self->voltageAlphaBeta = Ifx_Math_PolarToCart_F16(modulatorOutput.actualVoltage);
+    output->actualVoltage  = modulatorOutput.actualVoltage;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_replay_record.c
+ * \brief Recording of a start-up against the PMSM plant of host_plant.h in the format of host_replay_engine.h.
+ *
+ * The signals of each fast loop are written as a recording with all columns, as a field unit would be recorded. The
+ * outputs of the flux estimator, the FOC controller and the modulator of the FOC solution are written in the format of
+ * foc_replay, so the replay of the recording with the project configuration can be compared with them file by file.
+ *
+ * With a stop time, the control is disabled at that time and enabled again as soon as the FOC solution is back in
+ * the stand-by state, so the recording covers the ramp down and a restart of the states kept over it.
+ *
+ * Usage: foc_replay_record <recording CSV> <reference CSV> [reference rpm] [seconds] [load torque mNm] [stop s]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "host_foc.h"
+#include "host_plant.h"
+#include "host_replay_engine.h"
+
+/* Reads the recorded signals and the outputs of the modules after the fast loop */
+static void HostReplayRecord_read(THostReplay_Record* record, THostReplay_Output* output)
+{
+    Ifx_MS_FocSolutionF16* foc = &FocDemoClosedLoop;
+
+    record->currentsAlphaBeta = foc->currentsAlphaBeta;
+    record->dcLinkVoltageQ15  = foc->measurementADCTLE987.p_output.dcLinkVoltageQ15;
+    record->voltageCommand    = foc->focController.p_output.voltageCommandPolar;
+    record->state             = (uint8)foc->p_status.state;
+    record->subState          = (uint8)foc->p_status.subState;
+    record->angle             = foc->angle;
+    record->dqCommand         = foc->dqCommand;
+    record->speedRefQ15       = foc->rateLimitInSpeedQ15;
+    record->estimatedSpeedQ15 = foc->p_output.estimatedSpeedQ15;
+
+    output->estimatedSpeedQ15 = foc->p_output.estimatedSpeedQ15;
+    output->estimatedAngle    = foc->fluxEstimator.p_output.anglePLL;
+    output->actualVoltage     = foc->modulator.p_output.actualVoltage;
+
+    /* The command of the FOC controller is passed to the modulator in the run and ramp down states only */
+    if ((foc->p_status.state == Ifx_MS_FocSolutionF16_State_run)
+        || (foc->p_status.state == Ifx_MS_FocSolutionF16_State_rampDown))
+    {
+        output->voltageCommand = foc->focController.p_output.voltageCommandPolar;
+    }
+    else
+    {
+        output->voltageCommand.amplitude = 0;
+        output->voltageCommand.angle     = 0;
+    }
+}
+
+
+int main(int argc, char** argv)
+{
+    sint16            referenceRpm  = (argc > 3) ? (sint16)atoi(argv[3]) : 1000;
+    float64           seconds       = (argc > 4) ? atof(argv[4]) : 1.0;
+    float64           loadTorque_Nm = (argc > 5) ? (atof(argv[5]) / 1000.0) : 0.0;
+    float64           stop_s        = (argc > 6) ? atof(argv[6]) : 0.0;
+    uint32            periods       = (uint32)(seconds / HOST_FOC_PWM_PERIOD_S);
+    uint32            stopPeriod    = (uint32)(stop_s / HOST_FOC_PWM_PERIOD_S);
+    uint32            restartPeriod = 0u;
+    uint32            cycles        = 0u;
+    THostPlant_Params params;
+    THostPlant        plant;
+    FILE*             recording;
+    FILE*             reference;
+    uint32            period;
+
+    if (argc < 3)
+    {
+        (void)fprintf(stderr, "usage: foc_replay_record <recording CSV> <reference CSV> [reference rpm] [seconds] "
+                              "[load torque mNm] [stop s]\n");
+        return 2;
+    }
+
+    recording = fopen(argv[1], "w");
+    reference = fopen(argv[2], "w");
+
+    if ((recording == NULL) || (reference == NULL))
+    {
+        (void)fprintf(stderr, "cannot open %s or %s\n", argv[1], argv[2]);
+        return 1;
+    }
+
+    HostReplay_writeHeader(recording);
+    HostReplay_writeOutputHeader(reference);
+
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    for (period = 0u; period < periods; period++)
+    {
+        /* Stop, and restart once the ramp down is over */
+        if ((stopPeriod > 0u) && (period == stopPeriod))
+        {
+            HostFoc_inputs.enableControl = 0;
+        }
+        else if ((period > stopPeriod) && (HostFoc_inputs.enableControl == 0)
+                 && (FocDemoClosedLoop.p_status.state == Ifx_MS_FocSolutionF16_State_standBy))
+        {
+            HostFoc_inputs.enableControl = 1;
+            restartPeriod                = period;
+        }
+
+        /* Same sequence as HostPlant_stepClosedLoop(), the signals are read before the speed loop changes them */
+        HostPlant_runUpCounting(&plant);
+        HostFoc_PeriodMatch();
+        HostPlant_latchUpCounting(&plant);
+        HostPlant_runDownCounting(&plant);
+
+        if (HostFoc_OneMatch() == true)
+        {
+            THostReplay_Record record;
+            THostReplay_Output output;
+
+            HostReplayRecord_read(&record, &output);
+            HostReplay_writeRecord(recording, &record);
+            HostReplay_writeOutput(reference, cycles, &output);
+            cycles++;
+        }
+
+        HostPlant_latchDownCounting(&plant);
+
+        if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+        {
+            HostFoc_SpeedLoop();
+            HostFoc_Background();
+        }
+    }
+
+    (void)fclose(recording);
+    (void)fclose(reference);
+
+    (void)printf("%u fast loop cycles recorded, %.3f s at %d rpm, final speed %.1f rpm\n", (unsigned)cycles, seconds,
+        (int)referenceRpm, HostPlant_getSpeedRpm(&plant));
+
+    if (stopPeriod > 0u)
+    {
+        (void)printf("stop at %.3f s, restart at %.3f s\n", stop_s, (float64)restartPeriod * HOST_FOC_PWM_PERIOD_S);
+    }
+
+    return ((stopPeriod > 0u) && (restartPeriod == 0u)) ? 1 : 0;
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_sfr.c
+ * \brief Simulated TLE987x register image and the non-inline SDK functions used by the motor control libraries.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "host_sfr.h"
+#include "adc1.h"
+#include "bdrv.h"
+#include "bootrom.h"
+#include "ccu6.h"
+#include "dma.h"
+#include "timer3.h"
+
+/* Register image */
+THostSfr HostSfr;
+
+/* Data flash */
+THostSfr_DataFlash HostSfr_dataFlash;
+
+void HostSfr_Reset(void)
+{
+    /* Clear all registers */
+    (void)memset(&HostSfr, 0, sizeof(HostSfr));
+
+    /* T12 period as configured by the config wizard */
+    HostSfr.ccu6T12Period = (uint16)CCU6_T12PR;
+
+    /* ADC1 starts in sequencer mode */
+    HostSfr.adc1Mode = SEQ_MODE;
+
+    /* Trap inputs are inactive high */
+    HostSfr.portP23 = 1u;
+    HostSfr.portP24 = 1u;
+
+    /* CCU6 SR1 node is enabled by TLE_Init() */
+    HostSfr.nvicNode5Enabled = true;
+}
+
+
+void TIMER3_Set_Cmp_Value(uint16 Cmp_Value)
+{
+    HostSfr.timer3Compare = Cmp_Value;
+}
+
+
+void BDRV_Clr_Sts(uint32 Sts_Bit)
+{
+    HostSfr.scupm.BDRV_IS.reg &= ~Sts_Bit;
+}
+
+
+void BDRV_Set_Bridge(TBdrv_Ch_Cfg LS1_Cfg, TBdrv_Ch_Cfg HS1_Cfg, TBdrv_Ch_Cfg LS2_Cfg, TBdrv_Ch_Cfg HS2_Cfg,
+                     TBdrv_Ch_Cfg LS3_Cfg, TBdrv_Ch_Cfg HS3_Cfg)
+{
+    HostSfr.bdrvStage[0] = (uint8)LS1_Cfg;
+    HostSfr.bdrvStage[1] = (uint8)HS1_Cfg;
+    HostSfr.bdrvStage[2] = (uint8)LS2_Cfg;
+    HostSfr.bdrvStage[3] = (uint8)HS2_Cfg;
+    HostSfr.bdrvStage[4] = (uint8)LS3_Cfg;
+    HostSfr.bdrvStage[5] = (uint8)HS3_Cfg;
+}
+
+
+TDMA_Entry* DMA_Task_Set(TDMA_Entry* entry, TDMA_Cycle_Types cycle_type, uint8 arb_rate, uint32 addr_src,
+                         uint32 addr_dst, uint32 trans_cnt, TDMA_Transfer_Size datawidth,
+                         TDMA_Increment_Mode increment)
+{
+    /* Increment in bytes of one transfer */
+    uint32 step = ((uint32)1u << (uint8)datawidth);
+
+    entry->Control.reg               = 0u;
+    entry->Control.bit.Cycle_Ctrl    = (uint32)cycle_type;
+    entry->Control.bit.N_Minus_1     = trans_cnt - 1u;
+    entry->Control.bit.R_Power       = arb_rate;
+    entry->Control.bit.Src_Prot_Ctrl = 7u;
+    entry->Control.bit.Dst_Prot_Ctrl = 7u;
+    entry->Control.bit.Src_Size      = (uint32)datawidth;
+    entry->Control.bit.Dst_Size      = (uint32)datawidth;
+
+    /* Same encoding as the SDK, an increment code equal to the data width */
+    entry->Control.bit.Src_Inc = ((increment == DMA_Src_Inc) || (increment == DMA_Src_Dst_Inc)) ? (uint32)datawidth : 0u;
+    entry->Control.bit.Dst_Inc = ((increment == DMA_Dst_Inc) || (increment == DMA_Src_Dst_Inc)) ? (uint32)datawidth : 0u;
+    entry->Src_End_Ptr         = ((increment == DMA_Src_Inc) || (increment == DMA_Src_Dst_Inc)) ?
+                                 (addr_src + ((trans_cnt - 1u) * step)) : addr_src;
+    entry->Dst_End_Ptr         = ((increment == DMA_Dst_Inc) || (increment == DMA_Src_Dst_Inc)) ?
+                                 (addr_dst + ((trans_cnt - 1u) * step)) : addr_dst;
+    entry->reserved            = 0u;
+
+    return entry;
+}
+
+
+void DMA_Channel_MemSctGth_Set(uint32 DMA_ChIdx, TDMA_Entry* Task_List, uint32 NoOfTasks)
+{
+    HostSfr.dmaTaskList[DMA_ChIdx] = Task_List;
+    HostSfr.dmaTasks[DMA_ChIdx]    = NoOfTasks;
+}
+
+
+bool HostSfr_RequestDma(uint32 DMA_ChIdx)
+{
+    const TDMA_Entry* task = (const TDMA_Entry*)HostSfr.dmaTaskList[DMA_ChIdx];
+    uint32            mask = (uint32)1u << DMA_ChIdx;
+    uint32            t;
+
+    if ((HostSfr.dmaMasterEnable == false) || ((HostSfr.dmaChannelEnable & mask) == 0u) || (task == NULL))
+    {
+        return false;
+    }
+
+    for (t = 0u; t < HostSfr.dmaTasks[DMA_ChIdx]; t++)
+    {
+        uint32 count = task[t].Control.bit.N_Minus_1 + 1u;
+        uint32 size  = (uint32)1u << task[t].Control.bit.Src_Size;
+        uint32 src   = task[t].Src_End_Ptr - ((task[t].Control.bit.Src_Inc == 3u) ? 0u :
+                                              ((count - 1u) << task[t].Control.bit.Src_Inc));
+        uint32 dst   = task[t].Dst_End_Ptr - ((task[t].Control.bit.Dst_Inc == 3u) ? 0u :
+                                              ((count - 1u) << task[t].Control.bit.Dst_Inc));
+        uint32 i;
+
+        for (i = 0u; i < count; i++)
+        {
+            /* The addresses are those of the host process, see dma.h */
+            (void)memcpy((void*)(uintptr_t)dst, (const void*)(uintptr_t)src, size);
+            src += (task[t].Control.bit.Src_Inc == 3u) ? 0u : ((uint32)1u << task[t].Control.bit.Src_Inc);
+            dst += (task[t].Control.bit.Dst_Inc == 3u) ? 0u : ((uint32)1u << task[t].Control.bit.Dst_Inc);
+            HostSfr.dmaTransfers++;
+        }
+
+        /* A basic cycle ends the scatter-gather, disables the channel and requests the channel interrupt */
+        if (task[t].Control.bit.Cycle_Ctrl == (uint32)DMA_Cycle_Type_Basic)
+        {
+            HostSfr.dmaChannelEnable &= ~mask;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void HostSfr_EraseDataFlash(void)
+{
+    (void)memset(&HostSfr_dataFlash, 0, sizeof(HostSfr_dataFlash));
+}
+
+
+uint8 ProgramPage(uint32 addr, const uint8* buf, uint8 Branch, uint8 Correct, uint8 FailPageErase)
+{
+    /* The address is that of the host process, see tle_variants.h */
+    uintptr_t offset = (uintptr_t)addr - (uintptr_t)&HostSfr_dataFlash.bytes[0];
+
+    (void)Branch;
+    (void)Correct;
+    (void)FailPageErase;
+
+    if (((uintptr_t)addr < (uintptr_t)&HostSfr_dataFlash.bytes[0]) || (offset >= HOST_SFR_DATA_FLASH_SIZE) ||
+        ((offset % HOST_SFR_FLASH_PAGE_SIZE) != 0u))
+    {
+        return 1u;
+    }
+
+    /* Erase and write of the page */
+    (void)memcpy(&HostSfr_dataFlash.bytes[offset], buf, HOST_SFR_FLASH_PAGE_SIZE);
+    HostSfr_dataFlash.pagePrograms[offset / HOST_SFR_FLASH_PAGE_SIZE]++;
+
+    return 0u;
+}
+
+
+bool HostSfr_ShiftUart1(uint8* data)
+{
+    if (HostSfr.uart1TxPending == false)
+    {
+        return false;
+    }
+
+    *data                  = HostSfr.uart1Sbuf;
+    HostSfr.uart1TxPending = false;
+    HostSfr.uart1TxIntFlag = 1u;
+
+    return true;
+}
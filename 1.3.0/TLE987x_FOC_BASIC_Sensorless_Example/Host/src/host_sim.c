@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file host_sim.c
+ * \brief Closed loop software-in-the-loop run of the FOC stack against the PMSM plant of host_plant.h.
+ *
+ * Starts the motor from standstill to the reference speed and reports the settling time of the speed, the q current
+ * ripple in steady state, the cost of the fast loop and the simulation throughput.
+ *
+ * Usage: foc_sim [reference rpm] [simulated seconds] [load torque mNm] [runs]
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "host_foc.h"
+#include "host_plant.h"
+
+/* Tolerance band of the settled speed, relative to the reference speed */
+#define HOST_SIM_SETTLING_BAND    (0.02)
+
+/* Part of the run at its end which is evaluated as steady state */
+#define HOST_SIM_STEADY_STATE_PART (0.25)
+
+/* Result of one scenario */
+typedef struct
+{
+    float64 settlingTime_s;    /* Last time the speed left the tolerance band, negative if it did not settle */
+    float64 speedRpm;          /* Mean speed in steady state */
+    float64 currentQMean_A;    /* Mean q current in steady state */
+    float64 currentQRipple_A;  /* RMS deviation of the q current from its mean in steady state */
+    float64 currentQPeak_A;    /* Peak to peak q current in steady state */
+    uint64  fastLoopCalls;     /* Number of fast loop executions */
+    uint64  fastLoopNs;        /* Time spent in the fast loop */
+    uint64  fastLoopMaxNs;     /* Longest fast loop execution */
+    sint32  state;             /* FOC state at the end of the run */
+} THostSim_Result;
+
+/* Returns a monotonic time stamp in nanoseconds */
+static uint64 HostSim_nowNs(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64)ts.tv_sec * 1000000000ULL) + (uint64)ts.tv_nsec;
+}
+
+
+/* Runs one start-up scenario */
+static void HostSim_run(THostSim_Result* result, sint16 referenceRpm, float64 simulatedSeconds,
+                        float64 loadTorque_Nm)
+{
+    THostPlant_Params params;
+    THostPlant        plant;
+    uint32            periods       = (uint32)(simulatedSeconds / HOST_FOC_PWM_PERIOD_S);
+    uint32            steadyPeriods = (uint32)((float64)periods * HOST_SIM_STEADY_STATE_PART);
+    float64           band          = fabs((float64)referenceRpm) * HOST_SIM_SETTLING_BAND;
+    float64           speedSum      = 0.0;
+    float64           currentSum    = 0.0;
+    float64           currentSqSum  = 0.0;
+    float64           currentMin    = 0.0;
+    float64           currentMax    = 0.0;
+    uint32            period;
+
+    /* Motor of the project configuration with the requested load */
+    HostFoc_Init();
+    HostPlant_defaultParams(&params);
+    params.loadTorque_Nm = loadTorque_Nm;
+    HostPlant_init(&plant, &params);
+
+    HostFoc_inputs.enableControl    = 1;
+    HostFoc_inputs.referenceSpeedQ0 = referenceRpm;
+
+    result->settlingTime_s = 0.0;
+    result->fastLoopCalls  = 0u;
+    result->fastLoopNs     = 0u;
+    result->fastLoopMaxNs  = 0u;
+
+    for (period = 0; period < periods; period++)
+    {
+        /* Time stamp of the one match interrupt entry */
+        uint64  oneMatchNs;
+        float64 speedRpm;
+
+        /* Same sequence as HostPlant_stepClosedLoop(), with time stamps around the fast loop */
+        HostPlant_runUpCounting(&plant);
+        HostFoc_PeriodMatch();
+        HostPlant_latchUpCounting(&plant);
+        HostPlant_runDownCounting(&plant);
+
+        oneMatchNs = HostSim_nowNs();
+
+        if (HostFoc_OneMatch() == true)
+        {
+            uint64 durationNs = HostSim_nowNs() - oneMatchNs;
+            result->fastLoopNs += durationNs;
+            result->fastLoopCalls++;
+
+            if (durationNs > result->fastLoopMaxNs)
+            {
+                result->fastLoopMaxNs = durationNs;
+            }
+        }
+
+        HostPlant_latchDownCounting(&plant);
+
+        if ((period % HOST_FOC_SPEED_LOOP_DIVIDER) == (HOST_FOC_SPEED_LOOP_DIVIDER - 1u))
+        {
+            HostFoc_SpeedLoop();
+            HostFoc_Background();
+        }
+
+        /* Settling time: last time outside of the tolerance band */
+        speedRpm = HostPlant_getSpeedRpm(&plant);
+
+        if (fabs(speedRpm - (float64)referenceRpm) > band)
+        {
+            result->settlingTime_s = plant.time_s;
+        }
+
+        /* Steady state statistics */
+        if (period >= (periods - steadyPeriods))
+        {
+            float64 currentD;
+            float64 currentQ;
+
+            HostPlant_getCurrentsDq(&plant, &currentD, &currentQ);
+            speedSum     += speedRpm;
+            currentSum   += currentQ;
+            currentSqSum += currentQ * currentQ;
+
+            if ((period == (periods - steadyPeriods)) || (currentQ < currentMin))
+            {
+                currentMin = currentQ;
+            }
+
+            if ((period == (periods - steadyPeriods)) || (currentQ > currentMax))
+            {
+                currentMax = currentQ;
+            }
+        }
+    }
+
+    /* Did not settle until the end of the run */
+    if (result->settlingTime_s >= (plant.time_s - (HOST_FOC_PWM_PERIOD_S * 0.5)))
+    {
+        result->settlingTime_s = -1.0;
+    }
+
+    if (steadyPeriods > 0u)
+    {
+        result->speedRpm         = speedSum / (float64)steadyPeriods;
+        result->currentQMean_A   = currentSum / (float64)steadyPeriods;
+        result->currentQRipple_A = sqrt(fabs((currentSqSum / (float64)steadyPeriods)
+                                             - (result->currentQMean_A * result->currentQMean_A)));
+        result->currentQPeak_A   = currentMax - currentMin;
+    }
+
+    result->state = (sint32)Ifx_MS_FocSolutionF16_getStatus(&FocDemoClosedLoop).state;
+}
+
+
+int main(int argc, char** argv)
+{
+    /* Scenario */
+    sint16          referenceRpm     = (argc > 1) ? (sint16)atoi(argv[1]) : 1000;
+    float64         simulatedSeconds = (argc > 2) ? atof(argv[2]) : 2.0;
+    float64         loadTorque_Nm    = (argc > 3) ? (atof(argv[3]) / 1000.0) : 0.0;
+    uint32          runs             = (argc > 4) ? (uint32)atoi(argv[4]) : 1u;
+    THostSim_Result result           = {0};
+    uint64          startNs;
+    float64         wall_s;
+    uint32          run;
+
+    startNs = HostSim_nowNs();
+
+    for (run = 0; run < runs; run++)
+    {
+        HostSim_run(&result, referenceRpm, simulatedSeconds, loadTorque_Nm);
+    }
+
+    wall_s = (float64)(HostSim_nowNs() - startNs) * 1e-9;
+
+    (void)printf("scenario              : %d rpm, %.3f s, %.1f mNm load, %u run(s)\n", (int)referenceRpm,
+        simulatedSeconds, loadTorque_Nm * 1000.0, (unsigned)runs);
+    (void)printf("FOC state             : %d\n", (int)result.state);
+    (void)printf("settling time (+-%2.0f%%) : ", HOST_SIM_SETTLING_BAND * 100.0);
+
+    if (result.settlingTime_s < 0.0)
+    {
+        (void)printf("not settled\n");
+    }
+    else
+    {
+        (void)printf("%.4f s\n", result.settlingTime_s);
+    }
+
+    (void)printf("steady state speed    : %.1f rpm\n", result.speedRpm);
+    (void)printf("iq mean               : %.4f A\n", result.currentQMean_A);
+    (void)printf("iq ripple rms / p-p   : %.4f A / %.4f A\n", result.currentQRipple_A, result.currentQPeak_A);
+    (void)printf("fast loop mean / max  : %.1f ns / %llu ns\n",
+        (result.fastLoopCalls > 0u) ? ((float64)result.fastLoopNs / (float64)result.fastLoopCalls) : 0.0,
+        (unsigned long long)result.fastLoopMaxNs);
+    (void)printf("wall time             : %.3f s\n", wall_s);
+    (void)printf("simulated s per wall s: %.1f\n", (simulatedSeconds * (float64)runs) / wall_s);
+    (void)printf("scenarios per wall s  : %.1f\n", (float64)runs / wall_s);
+
+    return 0;
+}
@@ -28,7 +28,69 @@
  *********************************************************************************************************
  */
 
+#ifndef  PROBE_SCOPE_H
+#define  PROBE_SCOPE_H
+
 #include  <stdint.h>
+#include  "probe_scope_cfg.h"
+
+/*
+ *********************************************************************************************************
+ *                                             CONSTANTS
+ *********************************************************************************************************
+ */
+
+#define  PROBE_SCOPE_INT08U                   0                            // Supported data types
+#define  PROBE_SCOPE_INT08S                   1
+#define  PROBE_SCOPE_INT16U                   2
+#define  PROBE_SCOPE_INT16S                   3
+#define  PROBE_SCOPE_INT32U                   4
+#define  PROBE_SCOPE_INT32S                   5
+#define  PROBE_SCOPE_FP32                     6
+
+#if PROBE_SCOPE_STREAM_EN > 0
+/*
+ * Stream frame, all fields little endian:
+ *
+ *     Sync        2 bytes     PROBE_SCOPE_STREAM_SYNC0, PROBE_SCOPE_STREAM_SYNC1
+ *     Seq         1 byte      Frame counter
+ *     SampleIx    2 bytes     Index of the first sample, counts the dropped samples as well
+ *     SampleCnt   1 byte      Number of consecutive samples in the frame [1,PROBE_SCOPE_STREAM_FRAME_SAMPLES]
+ *     ChMask      1 byte      Enabled channels, bit 0 = channel #1
+ *     DataType    1 byte      Data type of each enabled channel, lowest channel first
+ *     Samples                 SampleCnt times the value of each enabled channel in its data type
+ *     Crc         1 byte      CRC-8 (polynomial 0x07, initial value 0) from Seq to the end of the samples
+ */
+#define  PROBE_SCOPE_STREAM_SYNC0             0xA5u
+#define  PROBE_SCOPE_STREAM_SYNC1             0x5Au
+#define  PROBE_SCOPE_STREAM_HDR_SIZE          7u                           // Sync to ChMask
+#define  PROBE_SCOPE_STREAM_FRAME_SIZE_MAX    (PROBE_SCOPE_STREAM_HDR_SIZE + PROBE_SCOPE_MAX_CH + \
+                                               (PROBE_SCOPE_STREAM_FRAME_SAMPLES * PROBE_SCOPE_MAX_CH * 4u) + 1u)
+#endif
+
+#if PROBE_SCOPE_COMPRESS_EN > 0
+/*
+ * Compressed sample buffer of a channel, PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES blocks of
+ * PROBE_SCOPE_COMPRESS_BLOCK_SIZE bytes, block n holds the samples n * PROBE_SCOPE_COMPRESS_KEY_SAMPLES onwards:
+ *
+ *     Key         4 bytes     First sample of the block (keyframe), in the low bytes, little endian
+ *     Slope       4 bytes     Slope of the prediction per sample, signed, little endian
+ *     Codes                   Signed codes of the other samples, PROBE_SCOPE_COMPRESS_CODE_BITS each, the 4 bit codes
+ *                             low nibble first
+ *
+ * The second sample onwards is predicted from the decoded sample before it plus Slope, the code is the difference of
+ * the sample to the prediction in units of 2^shift (see ProbeScope_ChCompressSet()), saturated to the code range. The
+ * decoder adds the codes to the predictions and gets the same values as the encoder. Slope is the mean slope since the
+ * previous keyframe, for the first block of a capture the slope to its second sample. After saturated codes the
+ * decoded samples lag behind until the prediction catches up or the next keyframe. The blocks are decoded
+ * independently. A triggered capture ends at a block boundary, up to PROBE_SCOPE_COMPRESS_KEY_SAMPLES - 1 samples
+ * from the trigger position on the screen, so its oldest block is whole: the capture is decoded block by block from
+ * the block after the one with the last sample.
+ */
+#define  PROBE_SCOPE_COMPRESS_CODE_BYTES      ((((PROBE_SCOPE_COMPRESS_KEY_SAMPLES - 1u) * \
+                                                 PROBE_SCOPE_COMPRESS_CODE_BITS) + 7u) / 8u)
+#define  PROBE_SCOPE_COMPRESS_BLOCK_SIZE      ((8u + PROBE_SCOPE_COMPRESS_CODE_BYTES + 3u) & ~3u)
+#endif
 
 /*
  *********************************************************************************************************
@@ -38,3 +100,23 @@
 void ProbeScope_Init(uint32_t sampling_clk_hz);
 void ProbeScope_Sampling(void);
 void ProbeScope_SamplingTmrInitHz(uint32_t sampling_clk_hz);
+void ProbeScope_ChSet(uint8_t ch, void* p_data, uint8_t data_type);
+void ProbeScope_CaptureStart(uint16_t sampling_clk_div);
+void ProbeScope_TrigStart(uint8_t ch, uint32_t level, uint32_t disp_pos, uint16_t sampling_clk_div);
+
+extern volatile uint32_t ProbeScope_DataRdyFlag;
+extern volatile uint32_t ProbeScope_TrigIx;
+
+#if PROBE_SCOPE_STREAM_EN > 0
+void ProbeScope_StreamStart(uint16_t sampling_clk_div);
+void ProbeScope_StreamStop(void);
+void ProbeScope_StreamTask(void);
+
+extern volatile uint32_t ProbeScope_StreamDropCtr;
+#endif
+#if PROBE_SCOPE_COMPRESS_EN > 0
+void ProbeScope_ChCompressSet(uint8_t ch, uint8_t shift);
+const uint8_t* ProbeScope_ChBlocksGet(uint8_t ch);
+#endif
+
+#endif
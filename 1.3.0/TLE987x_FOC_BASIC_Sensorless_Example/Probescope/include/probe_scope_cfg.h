@@ -22,6 +22,9 @@
  ************************************************************************************************************************
  */
 
+#ifndef  PROBE_SCOPE_CFG_H
+#define  PROBE_SCOPE_CFG_H
+
 /*
  ************************************************************************************************************************
  *                                                    CONFIGURATION
@@ -34,3 +37,11 @@
 #define  PROBE_SCOPE_32_BIT_EN            1           /* The maximum size of each sample is 32-bits: [0,1].          */
 #define  PROBE_SCOPE_SAMPLING_CLK_HZ_DFLT 20000       /* Default freq (Hz) to configure the timer at init.           */
 #define  PROBE_SCOPE_IPL                  13
+#define  PROBE_SCOPE_STREAM_EN            1           /* Streaming of the samples over UART1: [0,1].                 */
+#define  PROBE_SCOPE_STREAM_SAMPLES       32          /* Samples of the stream ring buffer, a power of 2: [2,256].   */
+#define  PROBE_SCOPE_STREAM_FRAME_SAMPLES 8           /* Samples per UART frame: [1,PROBE_SCOPE_STREAM_SAMPLES].     */
+#define  PROBE_SCOPE_COMPRESS_EN          0           /* Delta coded samples, not read by uC/Probe: [0,1].           */
+#define  PROBE_SCOPE_COMPRESS_KEY_SAMPLES 10          /* Samples per keyframe, even, dividing MAX_SAMPLES.           */
+#define  PROBE_SCOPE_COMPRESS_CODE_BITS   4           /* Bits of the delta codes: 4 or 8.                            */
+
+#endif
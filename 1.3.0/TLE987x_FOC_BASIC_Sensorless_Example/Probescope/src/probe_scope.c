@@ -30,6 +30,21 @@
 
 #include  "probe_scope_cfg.h"
 #include  "probe_scope.h"
+#if PROBE_SCOPE_STREAM_EN > 0
+#include  "uart.h"
+#endif
+
+#if PROBE_SCOPE_COMPRESS_EN > 0
+#if (PROBE_SCOPE_MAX_SAMPLES % PROBE_SCOPE_COMPRESS_KEY_SAMPLES) != 0
+#error  "PROBE_SCOPE_MAX_SAMPLES must be a multiple of PROBE_SCOPE_COMPRESS_KEY_SAMPLES"
+#endif
+#if ((PROBE_SCOPE_COMPRESS_KEY_SAMPLES % 2) != 0) || ((PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES) < 2)
+#error  "PROBE_SCOPE_COMPRESS_KEY_SAMPLES must be even and at most PROBE_SCOPE_MAX_SAMPLES / 2"
+#endif
+#if (PROBE_SCOPE_COMPRESS_CODE_BITS != 4) && (PROBE_SCOPE_COMPRESS_CODE_BITS != 8)
+#error  "PROBE_SCOPE_COMPRESS_CODE_BITS must be 4 or 8"
+#endif
+#endif
 
 /*
  *********************************************************************************************************
@@ -45,18 +60,17 @@
 #define  PROBE_SCOPE_STATE_SAMPLING_POST_TRIG 2
 #define  PROBE_SCOPE_STATE_DATA_RDY           3
 
+#if PROBE_SCOPE_COMPRESS_EN > 0                                            // Extra samples before the trigger,
+#define  PROBE_SCOPE_PRE_TRIG_EXTRA           (PROBE_SCOPE_COMPRESS_KEY_SAMPLES - 1u)   // see
+#else                                                                      // ProbeScope_CompressAlignEnd()
+#define  PROBE_SCOPE_PRE_TRIG_EXTRA           0u
+#endif
+
 #define  PROBE_SCOPE_MODE_OFF                 0
 #define  PROBE_SCOPE_MODE_SINGLE              1
 #define  PROBE_SCOPE_MODE_CONTINUOUS          2
 #define  PROBE_SCOPE_MODE_TRIG                3
-
-#define  PROBE_SCOPE_INT08U                   0                            // Supported data types
-#define  PROBE_SCOPE_INT08S                   1
-#define  PROBE_SCOPE_INT16U                   2
-#define  PROBE_SCOPE_INT16S                   3
-#define  PROBE_SCOPE_INT32U                   4
-#define  PROBE_SCOPE_INT32S                   5
-#define  PROBE_SCOPE_FP32                     6
+#define  PROBE_SCOPE_MODE_STREAM              4                            // Samples streamed over UART1
 
 #define  PROBE_SCOPE_CH1                      1
 #define  PROBE_SCOPE_CH2                      2
@@ -85,6 +99,15 @@ typedef  float                   CPU_FP32;                                    //
 typedef  double                  CPU_FP64;                                    // 64-bit floating point
 typedef  struct  scope_ch        PROBE_SCOPE_CH;
 typedef  union   scope_ch_sample PROBE_SCOPE_CH_SAMPLE;
+#if PROBE_SCOPE_COMPRESS_EN > 0
+typedef  struct  scope_block     PROBE_SCOPE_BLOCK;
+struct  scope_block                                                           // Compressed samples, see probe_scope.h
+{
+    CPU_INT32U Key;                                                           // First sample of the block
+    CPU_INT32S Slope;                                                         // Slope of the prediction
+    CPU_INT08U Codes[PROBE_SCOPE_COMPRESS_CODE_BYTES];                        // Codes of the other samples
+};
+#endif
 union  scope_ch_sample                                                        // A sample can be any of these data types
 {
     CPU_INT08U Val08U;
@@ -120,9 +143,28 @@ struct  scope_ch
     CPU_INT08U          * DataAddr;                                           // Address of source data (i.e. address of
                                                                               // symbol assigned to channel)
     PROBE_SCOPE_CH_SAMPLE TrigLevel;                                          // Trigger level of the channel
+#if PROBE_SCOPE_COMPRESS_EN > 0
+    CPU_INT08U            CompressShift;                                      // Codes in units of 2^CompressShift
+    CPU_INT32U            KeyPrev;                                            // Previous keyframe, in the upper bits
+    PROBE_SCOPE_CH_SAMPLE Recon[2];                                           // Decoded samples at the even and odd
+                                                                              // positions, for triggering
+    PROBE_SCOPE_BLOCK     Blocks[PROBE_SCOPE_MAX_SAMPLES / PROBE_SCOPE_COMPRESS_KEY_SAMPLES];
+                                                                              // Storage for compressed samples
+#else
     PROBE_SCOPE_CH_SAMPLE Samples[PROBE_SCOPE_MAX_SAMPLES];                   // Storage for samples
+#endif
 };
 
+#if PROBE_SCOPE_STREAM_EN > 0
+typedef  struct  scope_stream_sample PROBE_SCOPE_STREAM_SAMPLE;
+struct  scope_stream_sample
+{
+    CPU_INT16U            Ix;                                                 // Sample index, counts the dropped
+                                                                              // samples as well
+    PROBE_SCOPE_CH_SAMPLE Ch[PROBE_SCOPE_MAX_CH];                             // Value of each enabled channel
+};
+#endif
+
 /*
  *********************************************************************************************************
  *                                             LOCAL VARIABLES
@@ -210,6 +252,33 @@ static CPU_INT16U    ProbeScope_SamplingClkDivCtr;
 volatile CPU_INT32U  ProbeScope_SamplingClkHz;                                // Sampling Clock Frequency in Hz
 static CPU_INT08U    ProbeScope_State;                                        // Scope State
 
+#if PROBE_SCOPE_STREAM_EN > 0
+static volatile PROBE_SCOPE_STREAM_SAMPLE ProbeScope_StreamBuf[PROBE_SCOPE_STREAM_SAMPLES];
+                                                                              // Single producer, single consumer
+                                                                              // ring buffer of the stream: written by
+                                                                              // ProbeScope_Sampling(), read by
+                                                                              // ProbeScope_StreamTask()
+static volatile CPU_INT32U ProbeScope_StreamWrIx;                             // Free running write index, only
+                                                                              // changed by the producer
+static volatile CPU_INT32U ProbeScope_StreamRdIx;                             // Free running read index, only
+                                                                              // changed by the consumer
+static CPU_INT16U          ProbeScope_StreamSampleIx;                         // Index of the next sample
+volatile CPU_INT32U        ProbeScope_StreamDropCtr;                          // Samples dropped on a full ring buffer
+static CPU_INT08U          ProbeScope_StreamFrame[PROBE_SCOPE_STREAM_FRAME_SIZE_MAX];
+                                                                              // Frame being sent
+static CPU_INT16U          ProbeScope_StreamFrameLen;                         // Size of the frame being sent
+static CPU_INT16U          ProbeScope_StreamFramePos;                         // Next byte of the frame to send
+static CPU_INT08U          ProbeScope_StreamFrameSeq;                         // Frame counter
+static CPU_BOOLEAN         ProbeScope_StreamTxBusy;                           // A byte was written to UART1 and its
+                                                                              // transmission is not yet confirmed
+
+static const CPU_INT08U    ProbeScope_StreamCrcTbl[16] =                     // CRC-8 (polynomial 0x07) of the 16
+{                                                                             // nibble values
+    0x00u, 0x07u, 0x0Eu, 0x09u, 0x1Cu, 0x1Bu, 0x12u, 0x15u,
+    0x38u, 0x3Fu, 0x36u, 0x31u, 0x24u, 0x23u, 0x2Au, 0x2Du
+};
+#endif
+
 /*
  *********************************************************************************************************
  *                                             CONSTANTS
@@ -231,7 +300,17 @@ static void ProbeScope_ModeContinuous(void);
 static void ProbeScope_ModeTrig(void);
 static void ProbeScope_SampleChAll(void);
 static void ProbeScope_SampleCh(PROBE_SCOPE_CH* p_ch);
+static void ProbeScope_ReadCh(PROBE_SCOPE_CH* p_ch, PROBE_SCOPE_CH_SAMPLE* p_sample);
 static void ProbeScope_SamplePosNext(void);
+static PROBE_SCOPE_CH* ProbeScope_ChGet(CPU_INT08U ch);
+#if PROBE_SCOPE_COMPRESS_EN > 0
+static void ProbeScope_Compress(PROBE_SCOPE_CH* p_ch);
+static void ProbeScope_CompressAlignEnd(void);
+#endif
+#if PROBE_SCOPE_STREAM_EN > 0
+static void ProbeScope_ModeStream(void);
+static void ProbeScope_StreamFrameBuild(void);
+#endif
 
 /*
  ************************************************************************************************************************
@@ -324,6 +403,12 @@ void ProbeScope_Sampling(void)
         case PROBE_SCOPE_MODE_TRIG:
             ProbeScope_ModeTrig();
             break;
+
+#if PROBE_SCOPE_STREAM_EN > 0
+        case PROBE_SCOPE_MODE_STREAM:
+            ProbeScope_ModeStream();
+            break;
+#endif
     }
 }
 
@@ -427,7 +512,8 @@ static void ProbeScope_ModeTrig(void)
                 ProbeScope_SampleIxCur        = 0;
                 ProbeScope_TrigHoldOffCtr     = 0;
                 ProbeScope_SamplesPostTrigCtr = 0;
-                ProbeScope_SamplesPreTrigCtr  = ProbeScope_TrigDispPos;             // Minimum number of samples
+                ProbeScope_SamplesPreTrigCtr  = ProbeScope_TrigDispPos + PROBE_SCOPE_PRE_TRIG_EXTRA;
+                                                                                    // Minimum number of samples
                                                                                     // pre-trigger
                 ProbeScope_SampleChAll();                                           // Get the first sample to create a
                                                                                     // 'previous' value for triggering
@@ -454,6 +540,9 @@ static void ProbeScope_ModeTrig(void)
                                                                                     // collect before data available
                 {
                     ProbeScope_SamplesPostTrigCtr = PROBE_SCOPE_MAX_SAMPLES - ProbeScope_TrigDispPos - 2;
+#if PROBE_SCOPE_COMPRESS_EN > 0
+                    ProbeScope_CompressAlignEnd();
+#endif
                     ProbeScope_State              = PROBE_SCOPE_STATE_SAMPLING_POST_TRIG;
                 }
 
@@ -498,7 +587,8 @@ static void ProbeScope_ModeTrig(void)
                                                                                     // display the waveform(s)
                     {
                         ProbeScope_TrigFlag          = 0;
-                        ProbeScope_SamplesPreTrigCtr = ProbeScope_TrigDispPos;      // Minimum number of samples
+                        ProbeScope_SamplesPreTrigCtr = ProbeScope_TrigDispPos + PROBE_SCOPE_PRE_TRIG_EXTRA;
+                                                                                    // Minimum number of samples
                                                                                     // pre-trigger
                         ProbeScope_State             = PROBE_SCOPE_STATE_SAMPLING_PRE_TRIG;
                         ProbeScope_SampleChAll();                                   // Get the first sample to create a
@@ -572,14 +662,34 @@ static void ProbeScope_SampleChAll(void)
  ************************************************************************************************************************
  */
 static void ProbeScope_SampleCh(PROBE_SCOPE_CH* p_ch)
+{
+#if PROBE_SCOPE_COMPRESS_EN > 0
+    ProbeScope_ReadCh(p_ch, &p_ch->Recon[ProbeScope_SampleIxCur & 1u]); // Read the sample and code it, it is
+    ProbeScope_Compress(p_ch);                                          // replaced by the decoded sample
+#else
+    ProbeScope_ReadCh(p_ch, &p_ch->Samples[ProbeScope_SampleIxCur]);    // Store at current position in sampling
+                                                                        // buffer
+#endif
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                   ProbeScope_ReadCh()
+ *
+ * Description: This function is called to read a sample from the desired channel.
+ *
+ * Arguments  : p_ch        is a pointer to the desired channel to sample
+ *              p_sample    is a pointer to where the sample will be stored
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+static void ProbeScope_ReadCh(PROBE_SCOPE_CH* p_ch, PROBE_SCOPE_CH_SAMPLE* p_sample)
 {
     PROBE_SCOPE_CH_SAMPLE  msk;                                     // Mask used to select desired bit when in bit mode.
-    PROBE_SCOPE_CH_SAMPLE* p_sample;                                // Pointer to where the sample will be stored
 
     if (p_ch->En == 1)
     {
-        p_sample = &p_ch->Samples[ProbeScope_SampleIxCur];          // Point to current position in sampling buffer
-
         switch (p_ch->DataType)
         {
             case PROBE_SCOPE_INT08U:
@@ -825,10 +935,15 @@ static void ProbeScope_IsTrig(void)
 
     if (p_ch->En == 1)
     {
+#if PROBE_SCOPE_COMPRESS_EN > 0
+        p_sample_prev = &p_ch->Recon[ProbeScope_SampleIxPrev & 1u];       // Trigger on the decoded samples, the
+        p_sample_cur  = &p_ch->Recon[ProbeScope_SampleIxCur & 1u];        // buffer holds codes
+#else
         p_sample_prev = &p_ch->Samples[ProbeScope_SampleIxPrev];          // Point to previous position in sampling
                                                                           // buffer
         p_sample_cur  = &p_ch->Samples[ProbeScope_SampleIxCur];           // Point to current  position in sampling
                                                                           // buffer
+#endif
 
         if (ProbeScope_TrigSlope == PROBE_SCOPE_TRIG_POS)
         {
@@ -1242,3 +1357,642 @@ static void ProbeScope_IsTrig(void)
         }
     }
 }
+
+
+/*
+ ************************************************************************************************************************
+ *                                                 Channel Configuration
+ *
+ * Description: This function is used to assign a symbol to a channel when no debugger configures the channels, e.g.
+ *              for streaming over UART1 or for a capture started by the application.
+ *
+ * Arguments  : ch           is the channel number [1,PROBE_SCOPE_MAX_CH]
+ *              p_data       is the address of the symbol, NULL to disable the channel
+ *              data_type    is the data type of the symbol, PROBE_SCOPE_INT08U .. PROBE_SCOPE_FP32
+ *
+ * Returns    : none
+ *
+ * Note(s)    : The channels must not be changed while sampling, e.g. the data types of a stream frame are the ones
+ *              when it is built.
+ ************************************************************************************************************************
+ */
+void ProbeScope_ChSet(uint8_t ch, void* p_data, uint8_t data_type)
+{
+    PROBE_SCOPE_CH* p_ch = ProbeScope_ChGet(ch);
+
+    if (p_ch != (PROBE_SCOPE_CH*)0)
+    {
+        p_ch->DataType = data_type;
+        p_ch->BitEn    = 0;
+        p_ch->DataAddr = (CPU_INT08U*)p_data;
+        p_ch->En       = (p_data != (void*)0) ? 1 : 0;
+#if PROBE_SCOPE_COMPRESS_EN > 0
+        p_ch->CompressShift = 0;
+#endif
+    }
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                   Start Capture
+ *
+ * Description: This function starts a capture of PROBE_SCOPE_MAX_SAMPLES samples of the enabled channels in
+ *              continuous mode without uC/Probe. ProbeScope_DataRdyFlag is set when the buffers are full, clearing it
+ *              starts the next capture.
+ *
+ * Arguments  : sampling_clk_div    is the divider of the sampling clock (1 to 1000)
+ *
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+void ProbeScope_CaptureStart(uint16_t sampling_clk_div)
+{
+    ProbeScope_Mode              = PROBE_SCOPE_MODE_OFF;
+    ProbeScope_SampleIxPrev      = 0;
+    ProbeScope_SampleIxCur       = 0;
+    ProbeScope_SamplingClkDiv    = sampling_clk_div;
+    ProbeScope_SamplingClkDivCtr = 0;
+    ProbeScope_DataRdyFlag       = 0;
+    ProbeScope_Mode              = PROBE_SCOPE_MODE_CONTINUOUS;
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                               Start Triggered Capture
+ *
+ * Description: This function starts captures of PROBE_SCOPE_MAX_SAMPLES samples of the enabled channels in triggered
+ *              mode without uC/Probe, on the positive going slope of a channel through a level.
+ *              ProbeScope_DataRdyFlag is set when a capture is complete, clearing it starts the next capture. The
+ *              trigger sample is at ProbeScope_TrigIx.
+ *
+ * Arguments  : ch                  is the trigger channel [1,PROBE_SCOPE_MAX_CH]
+ *              level               is the trigger level, in the data type of the channel
+ *              disp_pos            is the position of the trigger in the capture [0,PROBE_SCOPE_MAX_SAMPLES - 2]
+ *              sampling_clk_div    is the divider of the sampling clock (1 to 1000)
+ *
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+void ProbeScope_TrigStart(uint8_t ch, uint32_t level, uint32_t disp_pos, uint16_t sampling_clk_div)
+{
+    PROBE_SCOPE_CH* p_ch = ProbeScope_ChGet(ch);
+
+    ProbeScope_Mode = PROBE_SCOPE_MODE_OFF;
+
+    if (p_ch != (PROBE_SCOPE_CH*)0)
+    {
+        switch (p_ch->DataType)
+        {
+            case PROBE_SCOPE_INT08U:
+            case PROBE_SCOPE_INT08S:
+                p_ch->TrigLevel.Val08U = (CPU_INT08U)level;
+                break;
+
+#if PROBE_SCOPE_16_BIT_EN > 0
+            case PROBE_SCOPE_INT16U:
+            case PROBE_SCOPE_INT16S:
+                p_ch->TrigLevel.Val16U = (CPU_INT16U)level;
+                break;
+#endif
+
+#if PROBE_SCOPE_32_BIT_EN > 0
+            default:
+                p_ch->TrigLevel.Val32U = level;
+                break;
+#else
+            default:
+                break;
+#endif
+        }
+
+        ProbeScope_TrigChSel         = ch;
+        ProbeScope_TrigSlope         = PROBE_SCOPE_TRIG_POS;
+        ProbeScope_TrigDispPos       = disp_pos;
+        ProbeScope_TrigHoldOff       = 0;
+        ProbeScope_SamplingClkDiv    = sampling_clk_div;
+        ProbeScope_SamplingClkDivCtr = 0;
+        ProbeScope_DataRdyFlag       = 0;
+        ProbeScope_State             = PROBE_SCOPE_STATE_START;
+        ProbeScope_Mode              = PROBE_SCOPE_MODE_TRIG;
+    }
+}
+
+
+#if PROBE_SCOPE_STREAM_EN > 0
+/*
+ ************************************************************************************************************************
+ *                                                   Start Streaming
+ *
+ * Description: This function starts the streaming of the enabled channels over UART1. Every sampling_clk_div-th call
+ *              of ProbeScope_Sampling() takes a sample of the enabled channels into the ring buffer, and
+ *              ProbeScope_StreamTask() sends them in frames of PROBE_SCOPE_STREAM_FRAME_SAMPLES samples. When the
+ *              ring buffer is full the sample is dropped, the receiver sees the gap in the sample index.
+ *
+ * Arguments  : sampling_clk_div    is the divider of the sampling clock (1 to 1000)
+ *
+ * Returns    : none
+ *
+ * Note(s)    : Must be called from the context of ProbeScope_StreamTask(), UART1 must be initialized.
+ ************************************************************************************************************************
+ */
+void ProbeScope_StreamStart(uint16_t sampling_clk_div)
+{
+    ProbeScope_Mode              = PROBE_SCOPE_MODE_OFF;                // Stop the producer before the reset
+    ProbeScope_StreamWrIx        = 0;
+    ProbeScope_StreamRdIx        = 0;
+    ProbeScope_StreamSampleIx    = 0;
+    ProbeScope_StreamDropCtr     = 0;
+    ProbeScope_StreamFrameLen    = 0;
+    ProbeScope_StreamFramePos    = 0;
+    ProbeScope_SamplingClkDiv    = sampling_clk_div;
+    ProbeScope_SamplingClkDivCtr = 0;
+    ProbeScope_Mode              = PROBE_SCOPE_MODE_STREAM;
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                   Stop Streaming
+ *
+ * Description: This function stops the sampling of the stream. ProbeScope_StreamTask() still sends the samples of the
+ *              ring buffer, the last frame may have less than PROBE_SCOPE_STREAM_FRAME_SAMPLES samples.
+ *
+ * Arguments  : none
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+void ProbeScope_StreamStop(void)
+{
+    ProbeScope_Mode = PROBE_SCOPE_MODE_OFF;
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                   Stream Task
+ *
+ * Description: This function must be called periodically from the background loop. It writes the next byte of the
+ *              current frame to UART1 when the previous one is transmitted, and builds the next frame from the ring
+ *              buffer when the current one is sent. It never waits for UART1.
+ *
+ * Arguments  : none
+ * Returns    : none
+ *
+ * Note(s)    : UART1 has no DMA request on the TLE987x, so the bytes are written one at a time. The transmit flag is
+ *              polled, the background loop has to run at least once per byte time for the full baud rate.
+ ************************************************************************************************************************
+ */
+void ProbeScope_StreamTask(void)
+{
+    if (ProbeScope_StreamFramePos >= ProbeScope_StreamFrameLen)
+    {
+        ProbeScope_StreamFrameBuild();
+    }
+
+    if (ProbeScope_StreamFramePos < ProbeScope_StreamFrameLen)
+    {
+        if ((ProbeScope_StreamTxBusy == 0) || (UART1_isByteTransmitted() == true))
+        {
+            UART1_Send_Byte(ProbeScope_StreamFrame[ProbeScope_StreamFramePos]);
+            ProbeScope_StreamFramePos++;
+            ProbeScope_StreamTxBusy = 1;
+        }
+    }
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                  Stream Sampling Mode
+ *
+ * Description: This is the state machine called when stream mode is selected, it is the producer of the ring buffer
+ *
+ * Arguments  : none
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+static void ProbeScope_ModeStream(void)
+{
+    volatile PROBE_SCOPE_STREAM_SAMPLE* p_sample;
+    PROBE_SCOPE_CH_SAMPLE               sample = {0};
+    CPU_INT32U                          wr_ix;
+    CPU_INT08U                          ch;
+
+    if (ProbeScope_SamplingClkDivCtr > 1)
+    {
+        ProbeScope_SamplingClkDivCtr--;
+    }
+    else
+    {
+        if (ProbeScope_SamplingClkDiv == 0)                                     // Make sure clock divider is not 0
+        {
+            ProbeScope_SamplingClkDiv = 1;
+        }
+
+        ProbeScope_SamplingClkDivCtr = ProbeScope_SamplingClkDiv;
+        wr_ix                        = ProbeScope_StreamWrIx;
+
+        if ((wr_ix - ProbeScope_StreamRdIx) >= PROBE_SCOPE_STREAM_SAMPLES)     // See if the ring buffer is full
+        {
+            ProbeScope_StreamDropCtr++;                                         // yes, drop the sample
+        }
+        else
+        {
+            p_sample     = &ProbeScope_StreamBuf[wr_ix & (PROBE_SCOPE_STREAM_SAMPLES - 1u)];
+            p_sample->Ix = ProbeScope_StreamSampleIx;
+
+            for (ch = 1; ch <= PROBE_SCOPE_MAX_CH; ch++)
+            {
+                ProbeScope_ReadCh(ProbeScope_ChGet(ch), &sample);
+                p_sample->Ch[ch - 1] = sample;
+            }
+
+            ProbeScope_StreamWrIx = wr_ix + 1u;                                 // Publish the complete sample
+        }
+
+        ProbeScope_StreamSampleIx++;
+    }
+
+    ProbeScope_State = PROBE_SCOPE_STATE_START;                                 // Force Triggered mode state to START
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                 Build Stream Frame
+ *
+ * Description: This function is the consumer of the ring buffer. It builds a frame of up to
+ *              PROBE_SCOPE_STREAM_FRAME_SAMPLES consecutive samples, see probe_scope.h for the format. While streaming
+ *              it waits for a full frame, after ProbeScope_StreamStop() it sends the remaining samples.
+ *
+ * Arguments  : none
+ * Returns    : none
+ ************************************************************************************************************************
+ */
+static void ProbeScope_StreamFrameBuild(void)
+{
+    volatile PROBE_SCOPE_STREAM_SAMPLE* p_sample;
+    PROBE_SCOPE_CH                    * p_ch;
+    CPU_INT32U                          rd_ix = ProbeScope_StreamRdIx;
+    CPU_INT32U                          avail = ProbeScope_StreamWrIx - rd_ix;
+    CPU_INT16U                          sample_ix;
+    CPU_INT16U                          len;
+    CPU_INT16U                          i;
+    CPU_INT08U                          cnt;
+    CPU_INT08U                          mask = 0;
+    CPU_INT08U                          size;
+    CPU_INT08U                          crc  = 0;
+    CPU_INT08U                          ch;
+
+    if ((avail == 0) ||
+        ((avail < PROBE_SCOPE_STREAM_FRAME_SAMPLES) && (ProbeScope_Mode == PROBE_SCOPE_MODE_STREAM)))
+    {
+        return;
+    }
+
+    sample_ix                 = ProbeScope_StreamBuf[rd_ix & (PROBE_SCOPE_STREAM_SAMPLES - 1u)].Ix;
+    ProbeScope_StreamFrame[0] = PROBE_SCOPE_STREAM_SYNC0;
+    ProbeScope_StreamFrame[1] = PROBE_SCOPE_STREAM_SYNC1;
+    ProbeScope_StreamFrame[2] = ProbeScope_StreamFrameSeq++;
+    ProbeScope_StreamFrame[3] = (CPU_INT08U)sample_ix;
+    ProbeScope_StreamFrame[4] = (CPU_INT08U)(sample_ix >> 8);
+    len                       = PROBE_SCOPE_STREAM_HDR_SIZE;
+
+    for (ch = 1; ch <= PROBE_SCOPE_MAX_CH; ch++)                                // Data type of the enabled channels
+    {
+        p_ch = ProbeScope_ChGet(ch);
+
+        if (p_ch->En == 1)
+        {
+            mask                           |= (CPU_INT08U)(1u << (ch - 1));
+            ProbeScope_StreamFrame[len++]   = p_ch->DataType;
+        }
+    }
+
+    ProbeScope_StreamFrame[6] = mask;
+
+    for (cnt = 0; (cnt < PROBE_SCOPE_STREAM_FRAME_SAMPLES) && (cnt < avail); cnt++)
+    {
+        p_sample = &ProbeScope_StreamBuf[(rd_ix + cnt) & (PROBE_SCOPE_STREAM_SAMPLES - 1u)];
+
+        if (p_sample->Ix != (CPU_INT16U)(sample_ix + cnt))                      // A frame holds consecutive samples
+        {
+            break;
+        }
+
+        for (ch = 1; ch <= PROBE_SCOPE_MAX_CH; ch++)
+        {
+            p_ch = ProbeScope_ChGet(ch);
+
+            if (p_ch->En == 1)
+            {
+                size = (p_ch->DataType >= PROBE_SCOPE_INT32U) ? 4u : ((p_ch->DataType >= PROBE_SCOPE_INT16U) ? 2u : 1u);
+
+                for (i = 0; i < size; i++)                                      // Little endian, as the CPU
+                {
+                    ProbeScope_StreamFrame[len++] = ((const volatile CPU_INT08U*)&p_sample->Ch[ch - 1])[i];
+                }
+            }
+        }
+    }
+
+    ProbeScope_StreamRdIx     = rd_ix + cnt;                                    // Release the samples to the producer
+    ProbeScope_StreamFrame[5] = cnt;
+
+    for (i = 2; i < len; i++)                                                   // CRC from Seq to the end of the
+    {                                                                           // samples, a nibble at a time
+        crc = (CPU_INT08U)(crc << 4) ^ ProbeScope_StreamCrcTbl[(crc >> 4) ^ (ProbeScope_StreamFrame[i] >> 4)];
+        crc = (CPU_INT08U)(crc << 4) ^ ProbeScope_StreamCrcTbl[(crc >> 4) ^ (ProbeScope_StreamFrame[i] & 0x0Fu)];
+    }
+
+    ProbeScope_StreamFrame[len++] = crc;
+    ProbeScope_StreamFrameLen     = len;
+    ProbeScope_StreamFramePos     = 0;
+}
+#endif
+
+
+#if PROBE_SCOPE_COMPRESS_EN > 0
+/*
+ ************************************************************************************************************************
+ *                                               Channel Compression
+ *
+ * Description: This function sets the resolution of the codes of a channel. A coarser resolution trades the accuracy
+ *              of slowly varying samples against less saturation on fast changes, e.g. 22 for a 32 bit angle.
+ *
+ * Arguments  : ch       is the channel number [1,PROBE_SCOPE_MAX_CH]
+ *              shift    is the resolution of the codes, 2^shift LSB of the data type [0,bits of the data type - 1]
+ *
+ * Returns    : none
+ *
+ * Note(s)    : Must be called after ProbeScope_ChSet().
+ ************************************************************************************************************************
+ */
+void ProbeScope_ChCompressSet(uint8_t ch, uint8_t shift)
+{
+    PROBE_SCOPE_CH* p_ch = ProbeScope_ChGet(ch);
+
+    if (p_ch != (PROBE_SCOPE_CH*)0)
+    {
+        p_ch->CompressShift = shift;
+    }
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                               Compressed Samples
+ *
+ * Description: This function returns the compressed sample buffer of a channel, e.g. to copy it out of the device.
+ *
+ * Arguments  : ch      is the channel number [1,PROBE_SCOPE_MAX_CH]
+ * Returns    : the blocks of the channel, see probe_scope.h for the format, NULL for an invalid channel number
+ ************************************************************************************************************************
+ */
+const uint8_t* ProbeScope_ChBlocksGet(uint8_t ch)
+{
+    PROBE_SCOPE_CH* p_ch = ProbeScope_ChGet(ch);
+
+    return (p_ch != (PROBE_SCOPE_CH*)0) ? (const uint8_t*)&p_ch->Blocks[0] : (const uint8_t*)0;
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                                 ProbeScope_Compress()
+ *
+ * Description: This function codes the sample at the current position of the channel into its block and replaces it
+ *              by the decoded sample. The arithmetic is done with the samples in the upper bits of 32 bits, so the
+ *              differences wrap around as the data type does, e.g. for an angle.
+ *
+ * Arguments  : p_ch      is a pointer to the channel
+ * Returns    : none
+ *
+ * Note(s)    : PROBE_SCOPE_FP32 samples are coded on their bit pattern, so only slowly varying values of constant sign
+ *              are reproduced well.
+ ************************************************************************************************************************
+ */
+static void ProbeScope_Compress(PROBE_SCOPE_CH* p_ch)
+{
+    PROBE_SCOPE_BLOCK*     p_block;
+    PROBE_SCOPE_CH_SAMPLE* p_cur;
+    CPU_INT32U             pos;                                         // Position of the sample in the block
+    CPU_INT32U             shift;                                       // Alignment of the samples to the upper bits
+    CPU_INT32U             cur;
+    CPU_INT32U             prev;
+    CPU_INT32U             pred;
+    CPU_INT32S             code;
+
+    if (p_ch->En == 1)
+    {
+        p_block = &p_ch->Blocks[ProbeScope_SampleIxCur / PROBE_SCOPE_COMPRESS_KEY_SAMPLES];
+        pos     = ProbeScope_SampleIxCur % PROBE_SCOPE_COMPRESS_KEY_SAMPLES;
+        p_cur   = &p_ch->Recon[ProbeScope_SampleIxCur & 1u];
+
+        switch (p_ch->DataType)                                         // Sample and previous decoded sample
+        {
+            case PROBE_SCOPE_INT08U:
+            case PROBE_SCOPE_INT08S:
+                shift = 24;
+                cur   = (CPU_INT32U)p_cur->Val08U;
+                prev  = (CPU_INT32U)p_ch->Recon[(ProbeScope_SampleIxCur & 1u) ^ 1u].Val08U;
+                break;
+
+#if PROBE_SCOPE_16_BIT_EN > 0
+            case PROBE_SCOPE_INT16U:
+            case PROBE_SCOPE_INT16S:
+                shift = 16;
+                cur   = (CPU_INT32U)p_cur->Val16U;
+                prev  = (CPU_INT32U)p_ch->Recon[(ProbeScope_SampleIxCur & 1u) ^ 1u].Val16U;
+                break;
+#endif
+
+#if PROBE_SCOPE_32_BIT_EN > 0
+            default:
+                shift = 0;
+                cur   = p_cur->Val32U;
+                prev  = p_ch->Recon[(ProbeScope_SampleIxCur & 1u) ^ 1u].Val32U;
+                break;
+#else
+            default:
+                return;
+#endif
+        }
+
+        cur  <<= shift;
+        prev <<= shift;
+
+        if (pos == 0)                                                   // Keyframe, the slope is the mean slope
+        {                                                               // since the previous keyframe
+            p_block->Key   = cur >> shift;
+            p_block->Slope = ((CPU_INT32S)(cur - p_ch->KeyPrev) >> shift) /
+                             (CPU_INT32S)PROBE_SCOPE_COMPRESS_KEY_SAMPLES;
+            p_ch->KeyPrev  = cur;
+        }
+        else
+        {
+            if (ProbeScope_SampleIxCur == 1)                            // No keyframe before the first one, its
+            {                                                           // slope is the one to the second sample
+                p_block->Slope = (CPU_INT32S)(cur - prev) >> shift;
+            }
+
+            pred   = prev + ((CPU_INT32U)p_block->Slope << shift);      // Linear extrapolation
+            shift += p_ch->CompressShift;
+            code   = (CPU_INT32S)((cur - pred) + ((1u << shift) >> 1)) >> shift;      // Rounded
+
+            if (code > ((1 << (PROBE_SCOPE_COMPRESS_CODE_BITS - 1)) - 1))   // Saturate to the code range
+            {
+                code = (1 << (PROBE_SCOPE_COMPRESS_CODE_BITS - 1)) - 1;
+            }
+            else if (code < -(1 << (PROBE_SCOPE_COMPRESS_CODE_BITS - 1)))
+            {
+                code = -(1 << (PROBE_SCOPE_COMPRESS_CODE_BITS - 1));
+            }
+
+#if PROBE_SCOPE_COMPRESS_CODE_BITS > 4
+            p_block->Codes[pos - 1] = (CPU_INT08U)code;
+#else
+            if ((pos & 1u) == 1)                                        // Low nibble first
+            {
+                p_block->Codes[pos >> 1] = (CPU_INT08U)((p_block->Codes[pos >> 1] & 0xF0u) |
+                                                        ((CPU_INT08U)code & 0x0Fu));
+            }
+            else
+            {
+                p_block->Codes[(pos - 1) >> 1] = (CPU_INT08U)((p_block->Codes[(pos - 1) >> 1] & 0x0Fu) |
+                                                              ((CPU_INT08U)code << 4));
+            }
+#endif
+
+            cur    = pred + ((CPU_INT32U)code << shift);                // Decoded sample
+            shift -= p_ch->CompressShift;
+
+            switch (shift)                                              // Replace the sample by the decoded one
+            {
+                case 24:
+                    p_cur->Val08U = (CPU_INT08U)(cur >> shift);
+                    break;
+
+#if PROBE_SCOPE_16_BIT_EN > 0
+                case 16:
+                    p_cur->Val16U = (CPU_INT16U)(cur >> shift);
+                    break;
+#endif
+
+#if PROBE_SCOPE_32_BIT_EN > 0
+                default:
+                    p_cur->Val32U = cur;
+                    break;
+#endif
+            }
+        }
+    }
+}
+
+
+/*
+ ************************************************************************************************************************
+ *                                             ProbeScope_CompressAlignEnd()
+ *
+ * Description: This function is called when the trigger is found and moves the end of the capture to a block
+ *              boundary, up to PROBE_SCOPE_COMPRESS_KEY_SAMPLES - 1 samples earlier or later than
+ *              ProbeScope_TrigDispPos asks for. The oldest samples in the buffer are then a whole block with its own
+ *              keyframe instead of the rest of a block whose keyframe was overwritten by the newest samples.
+ *
+ * Arguments  : none
+ * Returns    : none
+ *
+ * Note(s)    : The minimum number of samples before the trigger includes PROBE_SCOPE_PRE_TRIG_EXTRA, so the samples
+ *              of an earlier end are also from this capture.
+ ************************************************************************************************************************
+ */
+static void ProbeScope_CompressAlignEnd(void)
+{
+    CPU_INT32U end;                                                     // Position after the last sample
+    CPU_INT32U over;                                                    // Samples of the end past a block boundary
+
+    end  = (ProbeScope_SampleIxCur + ProbeScope_SamplesPostTrigCtr + 1u) % PROBE_SCOPE_MAX_SAMPLES;
+    over = end % PROBE_SCOPE_COMPRESS_KEY_SAMPLES;
+
+    if (over <= ProbeScope_SamplesPostTrigCtr)                          // End at the block boundary before
+    {
+        ProbeScope_SamplesPostTrigCtr -= over;
+    }
+    else                                                                // End at the block boundary after
+    {
+        ProbeScope_SamplesPostTrigCtr += PROBE_SCOPE_COMPRESS_KEY_SAMPLES - over;
+    }
+}
+#endif
+
+
+/*
+ ************************************************************************************************************************
+ *                                                   ProbeScope_ChGet()
+ *
+ * Description: This function returns the channel of a channel number.
+ *
+ * Arguments  : ch      is the channel number [1,PROBE_SCOPE_MAX_CH]
+ * Returns    : pointer to the channel, NULL for an invalid channel number
+ ************************************************************************************************************************
+ */
+static PROBE_SCOPE_CH* ProbeScope_ChGet(CPU_INT08U ch)
+{
+    PROBE_SCOPE_CH* p_ch = (PROBE_SCOPE_CH*)0;
+
+    switch (ch)
+    {
+        case PROBE_SCOPE_CH1:
+            p_ch = &ProbeScope_Ch1;
+            break;
+
+#if PROBE_SCOPE_MAX_CH >= 2
+        case PROBE_SCOPE_CH2:
+            p_ch = &ProbeScope_Ch2;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 3
+        case PROBE_SCOPE_CH3:
+            p_ch = &ProbeScope_Ch3;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 4
+        case PROBE_SCOPE_CH4:
+            p_ch = &ProbeScope_Ch4;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 5
+        case PROBE_SCOPE_CH5:
+            p_ch = &ProbeScope_Ch5;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 6
+        case PROBE_SCOPE_CH6:
+            p_ch = &ProbeScope_Ch6;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 7
+        case PROBE_SCOPE_CH7:
+            p_ch = &ProbeScope_Ch7;
+            break;
+#endif
+
+#if PROBE_SCOPE_MAX_CH >= 8
+        case PROBE_SCOPE_CH8:
+            p_ch = &ProbeScope_Ch8;
+            break;
+#endif
+
+        default:
+            break;
+    }
+
+    return p_ch;
+}
@@ -48,6 +48,8 @@
 
 #define IFX_MAS_MODULATORF16_CFG_ENABLE_FAULT_OUT (0x0) /*decimal 0*/
 
+#define IFX_MAS_MODULATORF16_CFG_ENABLE_SECTOR_TABLE (0x0) /*decimal 0*/
+
 #define IFX_MAS_MODULATORF16_CFG_FAULT_OUT usrFaultCallback
 
 #define IFX_MAS_MODULATORF16_CFG_FAULT_OUT_BEHAVIOR (0x0) /*decimal 0*/
@@ -56,6 +58,8 @@
 
 #define IFX_MAS_MODULATORF16_CFG_FAULT_REACTION_OVERMODULATION (0x1) /*decimal 1*/
 
+#define IFX_MAS_MODULATORF16_CFG_LUT_SIZE (0xC) /*decimal 12*/
+
 #define IFX_MAS_MODULATORF16_CFG_MAX_AMPLITUDE_Q15 (0x3555) /*decimal 13653*/
 
 #define IFX_MAS_MODULATORF16_CFG_MEASUREMENTPOINT (0x0) /*decimal 0*/
@@ -64,6 +68,10 @@
 
 #define IFX_MAS_MODULATORF16_CFG_MIN_ON_TIME_TICK (0x0) /*decimal 0*/
 
+#define IFX_MAS_MODULATORF16_CFG_MODULATION_MODE (0x0) /*decimal 0*/
+
+#define IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE (0x0) /*decimal 0*/
+
 #define IFX_MAS_MODULATORF16_CFG_PERIOD_TICK (0x7D0) /*decimal 2000*/
 
 #define IFX_MAS_MODULATORF16_CFG_RINGINGTIME_TICK (0x14) /*decimal 20*/
@@ -68,6 +68,10 @@
 
 #define IFX_MDA_FLUXESTIMATORF16_CFG_PLL_GAIN_Q_FORMAT (0x7) /*decimal 7*/
 
+#define IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q (0x2710) /*decimal 10000*/
+
+#define IFX_MDA_FLUXESTIMATORF16_CFG_PLL_INTEG_GAIN_Q_FORMAT (0x0) /*decimal 0*/
+
 #define IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US (0x96) /*decimal 150*/
 
 #define IFX_MDA_FLUXESTIMATORF16_CFG_SPEED_TC_US (0x26DB) /*decimal 9947*/
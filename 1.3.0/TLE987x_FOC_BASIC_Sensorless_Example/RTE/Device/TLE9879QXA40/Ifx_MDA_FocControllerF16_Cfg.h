@@ -34,12 +34,20 @@
 
 #define IFX_MDA_FOCCONTROLLERF16_CFG_BASE_CURRENT_A (5.00000)
 
+#define IFX_MDA_FOCCONTROLLERF16_CFG_BASE_ELEC_SPEED_RADPS (1675.00000)
+
 #define IFX_MDA_FOCCONTROLLERF16_CFG_BASE_VOLTAGE_V (24.00000)
 
+#define IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE (0x0) /*decimal 0*/
+
+#define IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE (0x0) /*decimal 0*/
+
 #define IFX_MDA_FOCCONTROLLERF16_CFG_DIRECT_INDUCTANCE_Q15 (0x2EE6) /*decimal 12006*/
 
 #define IFX_MDA_FOCCONTROLLERF16_CFG_DQDECOUPLINGENABLE (0x0) /*decimal 0*/
 
+#define IFX_MDA_FOCCONTROLLERF16_CFG_FLUX_Q15 (0x341D) /*decimal 13341*/
+
 #define IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q (0x18) /*decimal 24*/
 
 #define IFX_MDA_FOCCONTROLLERF16_CFG_ID_PI_KAW_TS_Q_FORMAT (0xF) /*decimal 15*/
@@ -78,8 +86,16 @@
 
 #define IFX_MDA_FOCCONTROLLERF16_CFG_LIMIT_VOLT_VECTOR_D_PRIO (0x1) /*decimal 1*/
 
+#define IFX_MDA_FOCCONTROLLERF16_CFG_MAX_MODULATION_INDEX_Q15 (0x49E9) /*decimal 18921*/
+
+#define IFX_MDA_FOCCONTROLLERF16_CFG_PI_CONST_QFORMAT_ENABLE (0x0) /*decimal 0*/
+
+#define IFX_MDA_FOCCONTROLLERF16_CFG_PWM_PERIOD_US (0x32) /*decimal 50*/
+
 #define IFX_MDA_FOCCONTROLLERF16_CFG_QUADRATURE_INDUCTANCE_Q15 (0x2EE6) /*decimal 12006*/
 
+#define IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 (0x1400) /*decimal 5120*/
+
 #define IFX_MDA_FOCCONTROLLERF16_CFG_SAMPLING_TIME_US (0x96) /*decimal 150*/
 
 #endif /* IFX_MDA_FOCCONTROLLERF16_CFG_H */
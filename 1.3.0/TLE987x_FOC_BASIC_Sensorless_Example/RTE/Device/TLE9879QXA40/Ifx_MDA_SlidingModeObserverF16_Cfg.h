@@ -0,0 +1,43 @@
+/**
+ * @cond
+ ***********************************************************************************************************************
+ *
+ * Copyright (c) 2018, Infineon Technologies AG
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,are permitted provided that the
+ * following conditions are met:
+ *
+ *   Redistributions of source code must retain the above copyright notice, this list of conditions and the  following
+ *   disclaimer.
+ *
+ *   Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *   following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *   Neither the name of the copyright holders nor the names of its contributors may be used to endorse or promote
+ *   products derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ * INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE  FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY,OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT  OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **********************************************************************************************************************/
+#ifndef IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_H
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_H
+
+/* XML Version 1.0.0 */
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_XML_VERSION (10000)
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_CORRECTION_GAIN_Q15 (0x4000) /*decimal 16384*/
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_MIN_EMF_Q15 (0x148) /*decimal 328*/
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_PLL_BANDWIDTH_RADPS (0x3E8) /*decimal 1000*/
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_SLIDING_GAIN_Q15 (0x6000) /*decimal 24576*/
+
+#endif /* IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_H */
@@ -58,6 +58,14 @@
 
 #define IFX_MHA_MEASUREMENTADC_CFG_CURRENT_GAIN_SHIFT_60 (0xA) /*decimal 10*/
 
+#define IFX_MHA_MEASUREMENTADC_CFG_ENABLE_DMA (0x0) /*decimal 0*/
+
+#define IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING (0x0) /*decimal 0*/
+
+#define IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_LIMIT (0x40) /*decimal 64*/
+
+#define IFX_MHA_MEASUREMENTADC_CFG_OFFSET_TRACKING_SHIFT (0x8) /*decimal 8*/
+
 #define IFX_MHA_MEASUREMENTADC_CFG_SHUNT_RES (0.00500)
 
 #define IFX_MHA_MEASUREMENTADC_CFG_VDC_BITS (0xB) /*decimal 11*/
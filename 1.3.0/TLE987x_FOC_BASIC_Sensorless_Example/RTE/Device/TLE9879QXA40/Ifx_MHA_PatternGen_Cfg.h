@@ -38,6 +38,8 @@
 
 #define IFX_MHA_PATTERNGEN_CFG_ENABLE_FAULT_OUT (0x0) /*decimal 0*/
 
+#define IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR (0x0) /*decimal 0*/
+
 #define IFX_MHA_PATTERNGEN_CFG_FAULT_OUT usrFaultCallback
 
 #define IFX_MHA_PATTERNGEN_CFG_FAULT_OUT_BEHAVIOR (0x0) /*decimal 0*/
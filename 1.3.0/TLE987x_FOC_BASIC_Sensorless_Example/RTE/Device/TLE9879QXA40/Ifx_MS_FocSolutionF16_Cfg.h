@@ -34,6 +34,8 @@
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_ERROR_MIN (0x71C) /*decimal 1820*/
 
+#define IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER (0x0) /*decimal 0*/
+
 #define IFX_MS_FOCSOLUTIONF16_CFG_BASE_CURRENT_A (5.00000)
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_BASE_FLUX_WB (0.01)
@@ -56,6 +58,14 @@
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR (0x3) /*decimal 3*/
 
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK (0x0) /*decimal 0*/
+
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER (0x0) /*decimal 0*/
+
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR (0x0) /*decimal 0*/
+
+#define IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT (0x0) /*decimal 0*/
+
 #define IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ (0x14) /*decimal 20*/
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_INCLUDE_STARTANGLE_IDENT (0x0) /*decimal 0*/
@@ -78,8 +88,14 @@
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_OPEN_LOOP_RAMP_UP_RATE_Q30 (0x625E9) /*decimal 402921*/
 
+#define IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES (0x8) /*decimal 8*/
+
 #define IFX_MS_FOCSOLUTIONF16_CFG_POLE_PAIRS (0x4) /*decimal 4*/
 
+#define IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT (0x9) /*decimal 9*/
+
+#define IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP usrProfilerTimestamp
+
 #define IFX_MS_FOCSOLUTIONF16_CFG_Q_CURRENT_AT_TRANSITION_Q15 (0x1999) /*decimal 6553*/
 
 #define IFX_MS_FOCSOLUTIONF16_CFG_SAMPLING_TIME_US (0x96) /*decimal 150*/
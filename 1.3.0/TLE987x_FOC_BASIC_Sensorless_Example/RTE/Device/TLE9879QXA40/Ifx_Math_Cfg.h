@@ -32,6 +32,8 @@
 /* XML Version 1.0.2 */
 #define IFX_MATH_CFG_XML_VERSION (10002)
 
+#define IFX_MATH_CFG_ATAN2_MODE (0x0) /*decimal 0*/
+
 #define IFX_MATH_CFG_ATAN_LUT_SIZE (0xA) /*decimal 10*/
 
 #define IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE (0xA) /*decimal 10*/
@@ -42,6 +44,10 @@
 
 #define IFX_MATH_CFG_PLL_DELAY_LENGTH (0x8) /*decimal 8*/
 
+#define IFX_MATH_CFG_PLL_TYPE (0x0) /*decimal 0*/
+
 #define IFX_MATH_CFG_SIN_LUT_SIZE (0xA) /*decimal 10*/
 
+#define IFX_MATH_CFG_SIN_MODE (0x0) /*decimal 0*/
+
 #endif /* IFX_MATH_CFG_H */
@@ -298,7 +298,7 @@
 
 #define DMA_CH1_INT_EN (0x0) /*decimal 0*/
 
-#define DMA_CH2_CALLBACK place_your_function_call_back_here
+#define DMA_CH2_CALLBACK Ifx_FOC_dmaCh5Callback
 
 #define DMA_CH2_INT_EN (0x0) /*decimal 0*/
 
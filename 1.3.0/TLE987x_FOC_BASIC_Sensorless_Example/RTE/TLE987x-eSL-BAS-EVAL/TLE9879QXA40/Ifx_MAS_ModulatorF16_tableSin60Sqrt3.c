@@ -13,8 +13,255 @@
 /**
  * Lookup table to store the values needed to calculate the switching times.
  *
- * Values: sqrt(3) * sin(x/4096 * 60deg), x = 0,1,...,4095, in signed integer q14 format.[0 ... 1.4965]
+ * Values: sqrt(3) * sin(x/(2^n - 1) * 60deg), x = 0,1,...,2^n - 1, in signed integer q14 format.[0 ... 1.5]
+ * Tables are available for IFX_MAS_MODULATORF16_CFG_LUT_SIZE n = 8, 9, 10, 11, 12 bit
+ * Generated by foc_gen_tables of the host build
  */
+#if IFX_MAS_MODULATORF16_CFG_LUT_SIZE == 8
+const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[256] = {
+    0, 117, 233, 350, 466, 583, 699, 816, 932, 1049, 1165, 1281, 1398, 1514, 1631, 1747, 1863, 1980, 2096, 2212, 2328,
+    2444, 2560, 2676, 2792, 2908, 3024, 3140, 3256, 3372, 3487, 3603, 3719, 3834, 3949, 4065, 4180, 4295, 4411, 4526,
+    4641, 4756, 4870, 4985, 5100, 5214, 5329, 5443, 5558, 5672, 5786, 5900, 6014, 6128, 6242, 6355, 6469, 6582, 6695,
+    6809, 6922, 7035, 7148, 7260, 7373, 7485, 7598, 7710, 7822, 7934, 8046, 8157, 8269, 8380, 8492, 8603, 8714, 8825,
+    8935, 9046, 9156, 9266, 9377, 9486, 9596, 9706, 9815, 9925, 10034, 10143, 10251, 10360, 10468, 10577, 10685, 10792,
+    10900, 11008, 11115, 11222, 11329, 11436, 11542, 11649, 11755, 11861, 11967, 12072, 12178, 12283, 12388, 12492,
+    12597, 12701, 12805, 12909, 13013, 13116, 13220, 13323, 13425, 13528, 13630, 13732, 13834, 13936, 14037, 14138,
+    14239, 14340, 14441, 14541, 14641, 14740, 14840, 14939, 15038, 15137, 15235, 15333, 15431, 15529, 15626, 15724,
+    15820, 15917, 16013, 16109, 16205, 16301, 16396, 16491, 16586, 16680, 16774, 16868, 16962, 17055, 17148, 17241,
+    17333, 17425, 17517, 17609, 17700, 17791, 17881, 17972, 18062, 18152, 18241, 18330, 18419, 18507, 18596, 18683,
+    18771, 18858, 18945, 19032, 19118, 19204, 19290, 19375, 19460, 19545, 19629, 19713, 19797, 19880, 19963, 20046,
+    20128, 20210, 20292, 20373, 20454, 20534, 20615, 20695, 20774, 20853, 20932, 21011, 21089, 21167, 21244, 21321,
+    21398, 21474, 21550, 21626, 21701, 21776, 21851, 21925, 21999, 22072, 22145, 22218, 22290, 22362, 22434, 22505,
+    22576, 22646, 22716, 22786, 22855, 22924, 22992, 23061, 23128, 23196, 23263, 23329, 23395, 23461, 23526, 23591,
+    23656, 23720, 23784, 23847, 23910, 23973, 24035, 24097, 24158, 24219, 24279, 24340, 24399, 24459, 24518, 24576
+};
+
+#elif IFX_MAS_MODULATORF16_CFG_LUT_SIZE == 9
+const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[512] = {
+    0, 58, 116, 174, 233, 291, 349, 407, 465, 523, 582, 640, 698, 756, 814, 872, 930, 988, 1047, 1105, 1163, 1221, 1279,
+    1337, 1395, 1453, 1511, 1569, 1627, 1686, 1744, 1802, 1860, 1918, 1976, 2034, 2092, 2150, 2208, 2266, 2324, 2382,
+    2440, 2497, 2555, 2613, 2671, 2729, 2787, 2845, 2903, 2961, 3018, 3076, 3134, 3192, 3250, 3307, 3365, 3423, 3481,
+    3538, 3596, 3654, 3711, 3769, 3827, 3884, 3942, 3999, 4057, 4114, 4172, 4230, 4287, 4344, 4402, 4459, 4517, 4574,
+    4632, 4689, 4746, 4804, 4861, 4918, 4975, 5033, 5090, 5147, 5204, 5261, 5319, 5376, 5433, 5490, 5547, 5604, 5661,
+    5718, 5775, 5832, 5889, 5946, 6002, 6059, 6116, 6173, 6230, 6286, 6343, 6400, 6456, 6513, 6570, 6626, 6683, 6739,
+    6796, 6852, 6908, 6965, 7021, 7078, 7134, 7190, 7246, 7303, 7359, 7415, 7471, 7527, 7583, 7639, 7695, 7751, 7807,
+    7863, 7919, 7975, 8030, 8086, 8142, 8198, 8253, 8309, 8365, 8420, 8476, 8531, 8587, 8642, 8697, 8753, 8808, 8863,
+    8918, 8974, 9029, 9084, 9139, 9194, 9249, 9304, 9359, 9414, 9469, 9523, 9578, 9633, 9688, 9742, 9797, 9851, 9906,
+    9960, 10015, 10069, 10124, 10178, 10232, 10286, 10341, 10395, 10449, 10503, 10557, 10611, 10665, 10719, 10772,
+    10826, 10880, 10934, 10987, 11041, 11094, 11148, 11201, 11255, 11308, 11361, 11415, 11468, 11521, 11574, 11627,
+    11680, 11733, 11786, 11839, 11892, 11945, 11997, 12050, 12103, 12155, 12208, 12260, 12313, 12365, 12417, 12470,
+    12522, 12574, 12626, 12678, 12730, 12782, 12834, 12886, 12938, 12989, 13041, 13093, 13144, 13196, 13247, 13299,
+    13350, 13401, 13453, 13504, 13555, 13606, 13657, 13708, 13759, 13810, 13860, 13911, 13962, 14012, 14063, 14113,
+    14164, 14214, 14264, 14315, 14365, 14415, 14465, 14515, 14565, 14615, 14665, 14714, 14764, 14814, 14863, 14913,
+    14962, 15012, 15061, 15110, 15159, 15209, 15258, 15307, 15356, 15404, 15453, 15502, 15551, 15599, 15648, 15696,
+    15745, 15793, 15841, 15890, 15938, 15986, 16034, 16082, 16130, 16178, 16225, 16273, 16321, 16368, 16416, 16463,
+    16510, 16558, 16605, 16652, 16699, 16746, 16793, 16840, 16886, 16933, 16980, 17026, 17073, 17119, 17166, 17212,
+    17258, 17304, 17350, 17396, 17442, 17488, 17534, 17579, 17625, 17671, 17716, 17761, 17807, 17852, 17897, 17942,
+    17987, 18032, 18077, 18122, 18167, 18211, 18256, 18300, 18345, 18389, 18433, 18477, 18522, 18566, 18610, 18653,
+    18697, 18741, 18785, 18828, 18872, 18915, 18958, 19001, 19045, 19088, 19131, 19174, 19216, 19259, 19302, 19344,
+    19387, 19429, 19472, 19514, 19556, 19598, 19640, 19682, 19724, 19766, 19808, 19849, 19891, 19932, 19973, 20015,
+    20056, 20097, 20138, 20179, 20220, 20261, 20301, 20342, 20382, 20423, 20463, 20503, 20544, 20584, 20624, 20664,
+    20703, 20743, 20783, 20822, 20862, 20901, 20940, 20980, 21019, 21058, 21097, 21136, 21174, 21213, 21252, 21290,
+    21328, 21367, 21405, 21443, 21481, 21519, 21557, 21595, 21632, 21670, 21708, 21745, 21782, 21820, 21857, 21894,
+    21931, 21968, 22004, 22041, 22078, 22114, 22150, 22187, 22223, 22259, 22295, 22331, 22367, 22403, 22438, 22474,
+    22509, 22545, 22580, 22615, 22650, 22685, 22720, 22755, 22790, 22824, 22859, 22893, 22927, 22962, 22996, 23030,
+    23064, 23098, 23131, 23165, 23198, 23232, 23265, 23299, 23332, 23365, 23398, 23431, 23463, 23496, 23529, 23561,
+    23593, 23626, 23658, 23690, 23722, 23754, 23785, 23817, 23849, 23880, 23912, 23943, 23974, 24005, 24036, 24067,
+    24098, 24128, 24159, 24189, 24220, 24250, 24280, 24310, 24340, 24370, 24400, 24429, 24459, 24488, 24518, 24547,
+    24576
+};
+
+#elif IFX_MAS_MODULATORF16_CFG_LUT_SIZE == 10
+const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[1024] = {
+    0, 29, 58, 87, 116, 145, 174, 203, 232, 261, 290, 320, 349, 378, 407, 436, 465, 494, 523, 552, 581, 610, 639, 668,
+    697, 726, 755, 784, 813, 842, 871, 900, 929, 958, 987, 1017, 1046, 1075, 1104, 1133, 1162, 1191, 1220, 1249, 1278,
+    1307, 1336, 1365, 1394, 1423, 1452, 1481, 1510, 1539, 1568, 1597, 1626, 1655, 1684, 1713, 1742, 1771, 1800, 1829,
+    1858, 1887, 1916, 1945, 1974, 2003, 2032, 2061, 2090, 2119, 2148, 2177, 2206, 2234, 2263, 2292, 2321, 2350, 2379,
+    2408, 2437, 2466, 2495, 2524, 2553, 2582, 2611, 2640, 2669, 2697, 2726, 2755, 2784, 2813, 2842, 2871, 2900, 2929,
+    2958, 2987, 3015, 3044, 3073, 3102, 3131, 3160, 3189, 3218, 3246, 3275, 3304, 3333, 3362, 3391, 3419, 3448, 3477,
+    3506, 3535, 3564, 3592, 3621, 3650, 3679, 3708, 3736, 3765, 3794, 3823, 3852, 3880, 3909, 3938, 3967, 3995, 4024,
+    4053, 4082, 4110, 4139, 4168, 4197, 4225, 4254, 4283, 4312, 4340, 4369, 4398, 4426, 4455, 4484, 4512, 4541, 4570,
+    4598, 4627, 4656, 4684, 4713, 4742, 4770, 4799, 4828, 4856, 4885, 4913, 4942, 4971, 4999, 5028, 5056, 5085, 5114,
+    5142, 5171, 5199, 5228, 5256, 5285, 5313, 5342, 5371, 5399, 5428, 5456, 5485, 5513, 5542, 5570, 5599, 5627, 5656,
+    5684, 5712, 5741, 5769, 5798, 5826, 5855, 5883, 5911, 5940, 5968, 5997, 6025, 6053, 6082, 6110, 6139, 6167, 6195,
+    6224, 6252, 6280, 6309, 6337, 6365, 6394, 6422, 6450, 6478, 6507, 6535, 6563, 6591, 6620, 6648, 6676, 6704, 6733,
+    6761, 6789, 6817, 6846, 6874, 6902, 6930, 6958, 6986, 7015, 7043, 7071, 7099, 7127, 7155, 7183, 7211, 7239, 7268,
+    7296, 7324, 7352, 7380, 7408, 7436, 7464, 7492, 7520, 7548, 7576, 7604, 7632, 7660, 7688, 7716, 7744, 7772, 7800,
+    7828, 7856, 7883, 7911, 7939, 7967, 7995, 8023, 8051, 8079, 8106, 8134, 8162, 8190, 8218, 8245, 8273, 8301, 8329,
+    8357, 8384, 8412, 8440, 8468, 8495, 8523, 8551, 8578, 8606, 8634, 8661, 8689, 8717, 8744, 8772, 8800, 8827, 8855,
+    8882, 8910, 8938, 8965, 8993, 9020, 9048, 9075, 9103, 9130, 9158, 9185, 9213, 9240, 9268, 9295, 9323, 9350, 9378,
+    9405, 9432, 9460, 9487, 9514, 9542, 9569, 9597, 9624, 9651, 9679, 9706, 9733, 9760, 9788, 9815, 9842, 9869, 9897,
+    9924, 9951, 9978, 10005, 10033, 10060, 10087, 10114, 10141, 10168, 10195, 10223, 10250, 10277, 10304, 10331, 10358,
+    10385, 10412, 10439, 10466, 10493, 10520, 10547, 10574, 10601, 10628, 10655, 10682, 10709, 10736, 10762, 10789,
+    10816, 10843, 10870, 10897, 10923, 10950, 10977, 11004, 11031, 11057, 11084, 11111, 11138, 11164, 11191, 11218,
+    11244, 11271, 11298, 11324, 11351, 11378, 11404, 11431, 11457, 11484, 11510, 11537, 11564, 11590, 11617, 11643,
+    11670, 11696, 11723, 11749, 11775, 11802, 11828, 11855, 11881, 11907, 11934, 11960, 11986, 12013, 12039, 12065,
+    12092, 12118, 12144, 12170, 12197, 12223, 12249, 12275, 12302, 12328, 12354, 12380, 12406, 12432, 12458, 12484,
+    12511, 12537, 12563, 12589, 12615, 12641, 12667, 12693, 12719, 12745, 12771, 12797, 12822, 12848, 12874, 12900,
+    12926, 12952, 12978, 13004, 13029, 13055, 13081, 13107, 13132, 13158, 13184, 13210, 13235, 13261, 13287, 13312,
+    13338, 13364, 13389, 13415, 13440, 13466, 13492, 13517, 13543, 13568, 13594, 13619, 13645, 13670, 13696, 13721,
+    13746, 13772, 13797, 13823, 13848, 13873, 13899, 13924, 13949, 13975, 14000, 14025, 14050, 14076, 14101, 14126,
+    14151, 14176, 14202, 14227, 14252, 14277, 14302, 14327, 14352, 14377, 14402, 14427, 14452, 14477, 14502, 14527,
+    14552, 14577, 14602, 14627, 14652, 14677, 14702, 14726, 14751, 14776, 14801, 14826, 14850, 14875, 14900, 14925,
+    14949, 14974, 14999, 15023, 15048, 15072, 15097, 15122, 15146, 15171, 15195, 15220, 15244, 15269, 15293, 15318,
+    15342, 15367, 15391, 15416, 15440, 15464, 15489, 15513, 15537, 15562, 15586, 15610, 15634, 15659, 15683, 15707,
+    15731, 15755, 15780, 15804, 15828, 15852, 15876, 15900, 15924, 15948, 15972, 15996, 16020, 16044, 16068, 16092,
+    16116, 16140, 16164, 16188, 16211, 16235, 16259, 16283, 16307, 16330, 16354, 16378, 16402, 16425, 16449, 16473,
+    16496, 16520, 16544, 16567, 16591, 16614, 16638, 16661, 16685, 16708, 16732, 16755, 16779, 16802, 16825, 16849,
+    16872, 16896, 16919, 16942, 16966, 16989, 17012, 17035, 17059, 17082, 17105, 17128, 17151, 17174, 17197, 17221,
+    17244, 17267, 17290, 17313, 17336, 17359, 17382, 17405, 17428, 17451, 17473, 17496, 17519, 17542, 17565, 17588,
+    17610, 17633, 17656, 17679, 17701, 17724, 17747, 17769, 17792, 17815, 17837, 17860, 17882, 17905, 17928, 17950,
+    17973, 17995, 18017, 18040, 18062, 18085, 18107, 18129, 18152, 18174, 18196, 18219, 18241, 18263, 18285, 18308,
+    18330, 18352, 18374, 18396, 18418, 18440, 18463, 18485, 18507, 18529, 18551, 18573, 18595, 18616, 18638, 18660,
+    18682, 18704, 18726, 18748, 18769, 18791, 18813, 18835, 18856, 18878, 18900, 18922, 18943, 18965, 18986, 19008,
+    19030, 19051, 19073, 19094, 19116, 19137, 19158, 19180, 19201, 19223, 19244, 19265, 19287, 19308, 19329, 19351,
+    19372, 19393, 19414, 19435, 19456, 19478, 19499, 19520, 19541, 19562, 19583, 19604, 19625, 19646, 19667, 19688,
+    19709, 19730, 19751, 19771, 19792, 19813, 19834, 19855, 19875, 19896, 19917, 19937, 19958, 19979, 19999, 20020,
+    20041, 20061, 20082, 20102, 20123, 20143, 20164, 20184, 20204, 20225, 20245, 20265, 20286, 20306, 20326, 20347,
+    20367, 20387, 20407, 20427, 20448, 20468, 20488, 20508, 20528, 20548, 20568, 20588, 20608, 20628, 20648, 20668,
+    20688, 20708, 20728, 20747, 20767, 20787, 20807, 20826, 20846, 20866, 20886, 20905, 20925, 20944, 20964, 20984,
+    21003, 21023, 21042, 21062, 21081, 21101, 21120, 21139, 21159, 21178, 21197, 21217, 21236, 21255, 21274, 21294,
+    21313, 21332, 21351, 21370, 21389, 21409, 21428, 21447, 21466, 21485, 21504, 21523, 21541, 21560, 21579, 21598,
+    21617, 21636, 21654, 21673, 21692, 21711, 21729, 21748, 21767, 21785, 21804, 21823, 21841, 21860, 21878, 21897,
+    21915, 21934, 21952, 21970, 21989, 22007, 22025, 22044, 22062, 22080, 22099, 22117, 22135, 22153, 22171, 22189,
+    22207, 22226, 22244, 22262, 22280, 22298, 22316, 22333, 22351, 22369, 22387, 22405, 22423, 22441, 22458, 22476,
+    22494, 22512, 22529, 22547, 22564, 22582, 22600, 22617, 22635, 22652, 22670, 22687, 22705, 22722, 22739, 22757,
+    22774, 22791, 22809, 22826, 22843, 22861, 22878, 22895, 22912, 22929, 22946, 22963, 22980, 22997, 23014, 23031,
+    23048, 23065, 23082, 23099, 23116, 23133, 23150, 23166, 23183, 23200, 23217, 23233, 23250, 23267, 23283, 23300,
+    23316, 23333, 23349, 23366, 23382, 23399, 23415, 23432, 23448, 23464, 23481, 23497, 23513, 23530, 23546, 23562,
+    23578, 23594, 23610, 23627, 23643, 23659, 23675, 23691, 23707, 23723, 23739, 23755, 23770, 23786, 23802, 23818,
+    23834, 23849, 23865, 23881, 23897, 23912, 23928, 23943, 23959, 23975, 23990, 24006, 24021, 24037, 24052, 24067,
+    24083, 24098, 24113, 24129, 24144, 24159, 24175, 24190, 24205, 24220, 24235, 24250, 24265, 24280, 24295, 24310,
+    24325, 24340, 24355, 24370, 24385, 24400, 24415, 24429, 24444, 24459, 24474, 24488, 24503, 24518, 24532, 24547,
+    24561, 24576
+};
+
+#elif IFX_MAS_MODULATORF16_CFG_LUT_SIZE == 11
+const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[2048] = {
+    0, 15, 29, 44, 58, 73, 87, 102, 116, 131, 145, 160, 174, 189, 203, 218, 232, 247, 261, 276, 290, 305, 319, 334, 348,
+    363, 377, 392, 406, 421, 436, 450, 465, 479, 494, 508, 523, 537, 552, 566, 581, 595, 610, 624, 639, 653, 668, 682,
+    697, 711, 726, 740, 755, 769, 784, 798, 813, 827, 842, 856, 871, 885, 900, 914, 929, 943, 958, 972, 987, 1001, 1016,
+    1031, 1045, 1060, 1074, 1089, 1103, 1118, 1132, 1147, 1161, 1176, 1190, 1205, 1219, 1234, 1248, 1263, 1277, 1292,
+    1306, 1321, 1335, 1350, 1364, 1379, 1393, 1408, 1422, 1437, 1451, 1466, 1480, 1495, 1509, 1524, 1538, 1553, 1567,
+    1582, 1596, 1611, 1625, 1640, 1654, 1669, 1683, 1698, 1712, 1727, 1741, 1755, 1770, 1784, 1799, 1813, 1828, 1842,
+    1857, 1871, 1886, 1900, 1915, 1929, 1944, 1958, 1973, 1987, 2002, 2016, 2031, 2045, 2060, 2074, 2089, 2103, 2118,
+    2132, 2147, 2161, 2175, 2190, 2204, 2219, 2233, 2248, 2262, 2277, 2291, 2306, 2320, 2335, 2349, 2364, 2378, 2393,
+    2407, 2421, 2436, 2450, 2465, 2479, 2494, 2508, 2523, 2537, 2552, 2566, 2581, 2595, 2609, 2624, 2638, 2653, 2667,
+    2682, 2696, 2711, 2725, 2740, 2754, 2768, 2783, 2797, 2812, 2826, 2841, 2855, 2870, 2884, 2898, 2913, 2927, 2942,
+    2956, 2971, 2985, 3000, 3014, 3028, 3043, 3057, 3072, 3086, 3101, 3115, 3129, 3144, 3158, 3173, 3187, 3202, 3216,
+    3230, 3245, 3259, 3274, 3288, 3302, 3317, 3331, 3346, 3360, 3375, 3389, 3403, 3418, 3432, 3447, 3461, 3475, 3490,
+    3504, 3519, 3533, 3547, 3562, 3576, 3591, 3605, 3619, 3634, 3648, 3663, 3677, 3691, 3706, 3720, 3735, 3749, 3763,
+    3778, 3792, 3807, 3821, 3835, 3850, 3864, 3879, 3893, 3907, 3922, 3936, 3950, 3965, 3979, 3994, 4008, 4022, 4037,
+    4051, 4065, 4080, 4094, 4108, 4123, 4137, 4152, 4166, 4180, 4195, 4209, 4223, 4238, 4252, 4266, 4281, 4295, 4309,
+    4324, 4338, 4353, 4367, 4381, 4396, 4410, 4424, 4439, 4453, 4467, 4482, 4496, 4510, 4525, 4539, 4553, 4568, 4582,
+    4596, 4611, 4625, 4639, 4654, 4668, 4682, 4696, 4711, 4725, 4739, 4754, 4768, 4782, 4797, 4811, 4825, 4840, 4854,
+    4868, 4882, 4897, 4911, 4925, 4940, 4954, 4968, 4983, 4997, 5011, 5025, 5040, 5054, 5068, 5083, 5097, 5111, 5125,
+    5140, 5154, 5168, 5183, 5197, 5211, 5225, 5240, 5254, 5268, 5282, 5297, 5311, 5325, 5339, 5354, 5368, 5382, 5396,
+    5411, 5425, 5439, 5453, 5468, 5482, 5496, 5510, 5525, 5539, 5553, 5567, 5582, 5596, 5610, 5624, 5639, 5653, 5667,
+    5681, 5695, 5710, 5724, 5738, 5752, 5767, 5781, 5795, 5809, 5823, 5838, 5852, 5866, 5880, 5894, 5909, 5923, 5937,
+    5951, 5965, 5980, 5994, 6008, 6022, 6036, 6051, 6065, 6079, 6093, 6107, 6121, 6136, 6150, 6164, 6178, 6192, 6206,
+    6221, 6235, 6249, 6263, 6277, 6291, 6306, 6320, 6334, 6348, 6362, 6376, 6390, 6405, 6419, 6433, 6447, 6461, 6475,
+    6489, 6504, 6518, 6532, 6546, 6560, 6574, 6588, 6602, 6617, 6631, 6645, 6659, 6673, 6687, 6701, 6715, 6729, 6744,
+    6758, 6772, 6786, 6800, 6814, 6828, 6842, 6856, 6870, 6884, 6899, 6913, 6927, 6941, 6955, 6969, 6983, 6997, 7011,
+    7025, 7039, 7053, 7067, 7081, 7096, 7110, 7124, 7138, 7152, 7166, 7180, 7194, 7208, 7222, 7236, 7250, 7264, 7278,
+    7292, 7306, 7320, 7334, 7348, 7362, 7376, 7390, 7404, 7418, 7432, 7446, 7460, 7474, 7488, 7502, 7516, 7530, 7544,
+    7558, 7572, 7586, 7600, 7614, 7628, 7642, 7656, 7670, 7684, 7698, 7712, 7726, 7740, 7754, 7768, 7782, 7796, 7810,
+    7824, 7838, 7852, 7866, 7880, 7894, 7908, 7922, 7935, 7949, 7963, 7977, 7991, 8005, 8019, 8033, 8047, 8061, 8075,
+    8089, 8103, 8116, 8130, 8144, 8158, 8172, 8186, 8200, 8214, 8228, 8242, 8255, 8269, 8283, 8297, 8311, 8325, 8339,
+    8353, 8367, 8380, 8394, 8408, 8422, 8436, 8450, 8464, 8477, 8491, 8505, 8519, 8533, 8547, 8561, 8574, 8588, 8602,
+    8616, 8630, 8644, 8657, 8671, 8685, 8699, 8713, 8726, 8740, 8754, 8768, 8782, 8795, 8809, 8823, 8837, 8851, 8864,
+    8878, 8892, 8906, 8920, 8933, 8947, 8961, 8975, 8988, 9002, 9016, 9030, 9044, 9057, 9071, 9085, 9099, 9112, 9126,
+    9140, 9154, 9167, 9181, 9195, 9209, 9222, 9236, 9250, 9263, 9277, 9291, 9305, 9318, 9332, 9346, 9359, 9373, 9387,
+    9401, 9414, 9428, 9442, 9455, 9469, 9483, 9496, 9510, 9524, 9537, 9551, 9565, 9578, 9592, 9606, 9619, 9633, 9647,
+    9660, 9674, 9688, 9701, 9715, 9729, 9742, 9756, 9769, 9783, 9797, 9810, 9824, 9838, 9851, 9865, 9878, 9892, 9906,
+    9919, 9933, 9946, 9960, 9974, 9987, 10001, 10014, 10028, 10042, 10055, 10069, 10082, 10096, 10109, 10123, 10137,
+    10150, 10164, 10177, 10191, 10204, 10218, 10231, 10245, 10258, 10272, 10286, 10299, 10313, 10326, 10340, 10353,
+    10367, 10380, 10394, 10407, 10421, 10434, 10448, 10461, 10475, 10488, 10502, 10515, 10529, 10542, 10556, 10569,
+    10583, 10596, 10609, 10623, 10636, 10650, 10663, 10677, 10690, 10704, 10717, 10731, 10744, 10757, 10771, 10784,
+    10798, 10811, 10825, 10838, 10851, 10865, 10878, 10892, 10905, 10918, 10932, 10945, 10959, 10972, 10985, 10999,
+    11012, 11026, 11039, 11052, 11066, 11079, 11092, 11106, 11119, 11132, 11146, 11159, 11172, 11186, 11199, 11213,
+    11226, 11239, 11253, 11266, 11279, 11292, 11306, 11319, 11332, 11346, 11359, 11372, 11386, 11399, 11412, 11426,
+    11439, 11452, 11465, 11479, 11492, 11505, 11518, 11532, 11545, 11558, 11572, 11585, 11598, 11611, 11625, 11638,
+    11651, 11664, 11677, 11691, 11704, 11717, 11730, 11744, 11757, 11770, 11783, 11796, 11810, 11823, 11836, 11849,
+    11862, 11876, 11889, 11902, 11915, 11928, 11941, 11955, 11968, 11981, 11994, 12007, 12020, 12034, 12047, 12060,
+    12073, 12086, 12099, 12112, 12126, 12139, 12152, 12165, 12178, 12191, 12204, 12217, 12230, 12244, 12257, 12270,
+    12283, 12296, 12309, 12322, 12335, 12348, 12361, 12374, 12387, 12400, 12414, 12427, 12440, 12453, 12466, 12479,
+    12492, 12505, 12518, 12531, 12544, 12557, 12570, 12583, 12596, 12609, 12622, 12635, 12648, 12661, 12674, 12687,
+    12700, 12713, 12726, 12739, 12752, 12765, 12778, 12791, 12804, 12817, 12830, 12843, 12855, 12868, 12881, 12894,
+    12907, 12920, 12933, 12946, 12959, 12972, 12985, 12998, 13011, 13023, 13036, 13049, 13062, 13075, 13088, 13101,
+    13114, 13127, 13139, 13152, 13165, 13178, 13191, 13204, 13217, 13229, 13242, 13255, 13268, 13281, 13294, 13306,
+    13319, 13332, 13345, 13358, 13370, 13383, 13396, 13409, 13422, 13434, 13447, 13460, 13473, 13486, 13498, 13511,
+    13524, 13537, 13549, 13562, 13575, 13588, 13600, 13613, 13626, 13639, 13651, 13664, 13677, 13689, 13702, 13715,
+    13728, 13740, 13753, 13766, 13778, 13791, 13804, 13816, 13829, 13842, 13854, 13867, 13880, 13892, 13905, 13918,
+    13930, 13943, 13956, 13968, 13981, 13994, 14006, 14019, 14032, 14044, 14057, 14069, 14082, 14095, 14107, 14120,
+    14132, 14145, 14158, 14170, 14183, 14195, 14208, 14220, 14233, 14245, 14258, 14271, 14283, 14296, 14308, 14321,
+    14333, 14346, 14358, 14371, 14383, 14396, 14408, 14421, 14433, 14446, 14458, 14471, 14483, 14496, 14508, 14521,
+    14533, 14546, 14558, 14571, 14583, 14596, 14608, 14620, 14633, 14645, 14658, 14670, 14683, 14695, 14707, 14720,
+    14732, 14745, 14757, 14770, 14782, 14794, 14807, 14819, 14831, 14844, 14856, 14869, 14881, 14893, 14906, 14918,
+    14930, 14943, 14955, 14967, 14980, 14992, 15004, 15017, 15029, 15041, 15054, 15066, 15078, 15091, 15103, 15115,
+    15127, 15140, 15152, 15164, 15176, 15189, 15201, 15213, 15226, 15238, 15250, 15262, 15274, 15287, 15299, 15311,
+    15323, 15336, 15348, 15360, 15372, 15384, 15397, 15409, 15421, 15433, 15445, 15458, 15470, 15482, 15494, 15506,
+    15518, 15531, 15543, 15555, 15567, 15579, 15591, 15603, 15615, 15628, 15640, 15652, 15664, 15676, 15688, 15700,
+    15712, 15724, 15736, 15749, 15761, 15773, 15785, 15797, 15809, 15821, 15833, 15845, 15857, 15869, 15881, 15893,
+    15905, 15917, 15929, 15941, 15953, 15965, 15977, 15989, 16001, 16013, 16025, 16037, 16049, 16061, 16073, 16085,
+    16097, 16109, 16121, 16133, 16145, 16157, 16169, 16181, 16193, 16204, 16216, 16228, 16240, 16252, 16264, 16276,
+    16288, 16300, 16312, 16323, 16335, 16347, 16359, 16371, 16383, 16395, 16406, 16418, 16430, 16442, 16454, 16466,
+    16477, 16489, 16501, 16513, 16525, 16537, 16548, 16560, 16572, 16584, 16595, 16607, 16619, 16631, 16643, 16654,
+    16666, 16678, 16690, 16701, 16713, 16725, 16736, 16748, 16760, 16772, 16783, 16795, 16807, 16818, 16830, 16842,
+    16853, 16865, 16877, 16888, 16900, 16912, 16923, 16935, 16947, 16958, 16970, 16982, 16993, 17005, 17017, 17028,
+    17040, 17051, 17063, 17075, 17086, 17098, 17109, 17121, 17133, 17144, 17156, 17167, 17179, 17190, 17202, 17213,
+    17225, 17236, 17248, 17260, 17271, 17283, 17294, 17306, 17317, 17329, 17340, 17352, 17363, 17375, 17386, 17398,
+    17409, 17420, 17432, 17443, 17455, 17466, 17478, 17489, 17501, 17512, 17523, 17535, 17546, 17558, 17569, 17580,
+    17592, 17603, 17615, 17626, 17637, 17649, 17660, 17671, 17683, 17694, 17706, 17717, 17728, 17740, 17751, 17762,
+    17773, 17785, 17796, 17807, 17819, 17830, 17841, 17853, 17864, 17875, 17886, 17898, 17909, 17920, 17931, 17943,
+    17954, 17965, 17976, 17988, 17999, 18010, 18021, 18033, 18044, 18055, 18066, 18077, 18089, 18100, 18111, 18122,
+    18133, 18144, 18156, 18167, 18178, 18189, 18200, 18211, 18222, 18234, 18245, 18256, 18267, 18278, 18289, 18300,
+    18311, 18322, 18333, 18345, 18356, 18367, 18378, 18389, 18400, 18411, 18422, 18433, 18444, 18455, 18466, 18477,
+    18488, 18499, 18510, 18521, 18532, 18543, 18554, 18565, 18576, 18587, 18598, 18609, 18620, 18631, 18642, 18653,
+    18664, 18675, 18686, 18697, 18707, 18718, 18729, 18740, 18751, 18762, 18773, 18784, 18795, 18806, 18816, 18827,
+    18838, 18849, 18860, 18871, 18881, 18892, 18903, 18914, 18925, 18936, 18946, 18957, 18968, 18979, 18990, 19000,
+    19011, 19022, 19033, 19043, 19054, 19065, 19076, 19087, 19097, 19108, 19119, 19129, 19140, 19151, 19162, 19172,
+    19183, 19194, 19204, 19215, 19226, 19236, 19247, 19258, 19268, 19279, 19290, 19300, 19311, 19322, 19332, 19343,
+    19354, 19364, 19375, 19385, 19396, 19407, 19417, 19428, 19438, 19449, 19459, 19470, 19481, 19491, 19502, 19512,
+    19523, 19533, 19544, 19554, 19565, 19575, 19586, 19596, 19607, 19617, 19628, 19638, 19649, 19659, 19670, 19680,
+    19691, 19701, 19712, 19722, 19732, 19743, 19753, 19764, 19774, 19785, 19795, 19805, 19816, 19826, 19837, 19847,
+    19857, 19868, 19878, 19888, 19899, 19909, 19919, 19930, 19940, 19950, 19961, 19971, 19981, 19992, 20002, 20012,
+    20023, 20033, 20043, 20053, 20064, 20074, 20084, 20094, 20105, 20115, 20125, 20135, 20146, 20156, 20166, 20176,
+    20186, 20197, 20207, 20217, 20227, 20237, 20248, 20258, 20268, 20278, 20288, 20298, 20309, 20319, 20329, 20339,
+    20349, 20359, 20369, 20379, 20389, 20400, 20410, 20420, 20430, 20440, 20450, 20460, 20470, 20480, 20490, 20500,
+    20510, 20520, 20530, 20540, 20550, 20560, 20570, 20580, 20590, 20600, 20610, 20620, 20630, 20640, 20650, 20660,
+    20670, 20680, 20690, 20700, 20710, 20720, 20730, 20740, 20750, 20759, 20769, 20779, 20789, 20799, 20809, 20819,
+    20829, 20838, 20848, 20858, 20868, 20878, 20888, 20897, 20907, 20917, 20927, 20937, 20946, 20956, 20966, 20976,
+    20986, 20995, 21005, 21015, 21025, 21034, 21044, 21054, 21064, 21073, 21083, 21093, 21102, 21112, 21122, 21132,
+    21141, 21151, 21161, 21170, 21180, 21190, 21199, 21209, 21219, 21228, 21238, 21247, 21257, 21267, 21276, 21286,
+    21296, 21305, 21315, 21324, 21334, 21343, 21353, 21363, 21372, 21382, 21391, 21401, 21410, 21420, 21429, 21439,
+    21448, 21458, 21467, 21477, 21486, 21496, 21505, 21515, 21524, 21534, 21543, 21553, 21562, 21571, 21581, 21590,
+    21600, 21609, 21619, 21628, 21637, 21647, 21656, 21665, 21675, 21684, 21694, 21703, 21712, 21722, 21731, 21740,
+    21750, 21759, 21768, 21778, 21787, 21796, 21805, 21815, 21824, 21833, 21843, 21852, 21861, 21870, 21880, 21889,
+    21898, 21907, 21917, 21926, 21935, 21944, 21953, 21963, 21972, 21981, 21990, 21999, 22008, 22018, 22027, 22036,
+    22045, 22054, 22063, 22073, 22082, 22091, 22100, 22109, 22118, 22127, 22136, 22145, 22154, 22163, 22173, 22182,
+    22191, 22200, 22209, 22218, 22227, 22236, 22245, 22254, 22263, 22272, 22281, 22290, 22299, 22308, 22317, 22326,
+    22335, 22344, 22353, 22362, 22370, 22379, 22388, 22397, 22406, 22415, 22424, 22433, 22442, 22451, 22459, 22468,
+    22477, 22486, 22495, 22504, 22513, 22521, 22530, 22539, 22548, 22557, 22566, 22574, 22583, 22592, 22601, 22609,
+    22618, 22627, 22636, 22645, 22653, 22662, 22671, 22679, 22688, 22697, 22706, 22714, 22723, 22732, 22740, 22749,
+    22758, 22766, 22775, 22784, 22792, 22801, 22810, 22818, 22827, 22836, 22844, 22853, 22861, 22870, 22879, 22887,
+    22896, 22904, 22913, 22921, 22930, 22939, 22947, 22956, 22964, 22973, 22981, 22990, 22998, 23007, 23015, 23024,
+    23032, 23041, 23049, 23058, 23066, 23075, 23083, 23091, 23100, 23108, 23117, 23125, 23134, 23142, 23150, 23159,
+    23167, 23176, 23184, 23192, 23201, 23209, 23217, 23226, 23234, 23242, 23251, 23259, 23267, 23276, 23284, 23292,
+    23301, 23309, 23317, 23325, 23334, 23342, 23350, 23358, 23367, 23375, 23383, 23391, 23400, 23408, 23416, 23424,
+    23432, 23441, 23449, 23457, 23465, 23473, 23481, 23489, 23498, 23506, 23514, 23522, 23530, 23538, 23546, 23554,
+    23563, 23571, 23579, 23587, 23595, 23603, 23611, 23619, 23627, 23635, 23643, 23651, 23659, 23667, 23675, 23683,
+    23691, 23699, 23707, 23715, 23723, 23731, 23739, 23747, 23755, 23763, 23771, 23779, 23787, 23795, 23802, 23810,
+    23818, 23826, 23834, 23842, 23850, 23858, 23866, 23873, 23881, 23889, 23897, 23905, 23913, 23920, 23928, 23936,
+    23944, 23952, 23959, 23967, 23975, 23983, 23990, 23998, 24006, 24014, 24021, 24029, 24037, 24045, 24052, 24060,
+    24068, 24075, 24083, 24091, 24098, 24106, 24114, 24121, 24129, 24137, 24144, 24152, 24159, 24167, 24175, 24182,
+    24190, 24197, 24205, 24213, 24220, 24228, 24235, 24243, 24250, 24258, 24265, 24273, 24281, 24288, 24296, 24303,
+    24311, 24318, 24325, 24333, 24340, 24348, 24355, 24363, 24370, 24378, 24385, 24393, 24400, 24407, 24415, 24422,
+    24430, 24437, 24444, 24452, 24459, 24466, 24474, 24481, 24488, 24496, 24503, 24510, 24518, 24525, 24532, 24540,
+    24547, 24554, 24561, 24569, 24576
+};
+
+#elif IFX_MAS_MODULATORF16_CFG_LUT_SIZE == 12
 const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[4096] = {
     0, 7, 15, 22, 29, 36, 44, 51, 58, 65, 73, 80, 87, 94, 102, 109, 116, 123, 131, 138, 145, 152, 160, 167, 174, 181,
     189, 196, 203, 210, 218, 225, 232, 239, 247, 254, 261, 269, 276, 283, 290, 298, 305, 312, 319, 327, 334, 341, 348,
@@ -258,3 +505,5 @@ const Ifx_Math_Fract16 Ifx_MAS_ModulatorF16_lutSin60Sqrt3[4096] = {
     24477, 24481, 24485, 24488, 24492, 24496, 24499, 24503, 24507, 24510, 24514, 24518, 24521, 24525, 24529, 24532,
     24536, 24540, 24543, 24547, 24551, 24554, 24558, 24561, 24565, 24569, 24572, 24576
 };
+
+#endif
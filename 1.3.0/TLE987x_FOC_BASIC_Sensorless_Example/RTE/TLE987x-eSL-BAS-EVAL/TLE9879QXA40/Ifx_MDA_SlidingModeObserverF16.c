@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+#include "Ifx_MDA_SlidingModeObserverF16.h"
+#include "Ifx_MDA_SlidingModeObserverF16_Cfg.h"
+#include "Ifx_MDA_FluxEstimatorF16_Cfg.h"
+
+/* Math library includes */
+#include "Ifx_Math_Abs.h"
+#include "Ifx_Math_AddSat.h"
+#include "Ifx_Math_LowPass1stF16.h"
+#include "Ifx_Math_Mul.h"
+#include "Ifx_Math_Sat.h"
+#include "Ifx_Math_SinCos.h"
+
+/* CMSIS includes */
+#include "cmsis_compiler.h"
+
+/*
+ * Coefficients per microsecond of sampling time, calculated from the motor and base values of the Flux Estimator:
+ * - Current gain Ts / (Tb * L), with the base time Tb and the normalized inductance L, in Q24
+ * - PLL integral gain Ki * Ts / wb = wn^2 * Ts / wb, with the PLL bandwidth wn and the base speed wb, in Q32
+ * - Angle increment per normalized speed unit wb * Ts / (2 * pi), in 2^32 per turn and 2^15 per speed, in Q16
+ * The PLL proportional gain Kp / wb = 2 * wn / wb (critically damped) does not depend on the sampling time, in Q12.
+ */
+
+/* polyspace-begin MISRA2012:D1.1 [Justified:Low] "Behavior verified by unit tests." */
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_CURRENT_GAIN_PER_US_Q24                                    \
+                                                                        ((sint32)((16777216.0F * 32768.0F) / \
+        ((float)IFX_MDA_FLUXESTIMATORF16_CFG_BASE_TIME_MS * 1000.0F * (float)IFX_MDA_FLUXESTIMATORF16_CFG_PHASE_IND_Q15)))
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_PLL_INTEG_GAIN_PER_US_Q32                                  \
+                                                                        ((sint32)((4294967296.0F * \
+        (float)IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_PLL_BANDWIDTH_RADPS *                           \
+        (float)IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_PLL_BANDWIDTH_RADPS) /                          \
+        ((float)IFX_MDA_FLUXESTIMATORF16_CFG_BASE_ELEC_SPEED_RADPS * 1000000.0F)))
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_ANGLE_INCREMENT_PER_US_Q16                                 \
+                                                                        ((sint32)((65536.0F * 131072.0F * \
+        (float)IFX_MDA_FLUXESTIMATORF16_CFG_BASE_ELEC_SPEED_RADPS) / (6.2831853F * 1000000.0F)))
+
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_PLL_PROP_GAIN_Q12                                          \
+                                                                        ((Ifx_Math_Fract16)((4096.0F * 2.0F * \
+        (float)IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_PLL_BANDWIDTH_RADPS) /                          \
+        (float)IFX_MDA_FLUXESTIMATORF16_CFG_BASE_ELEC_SPEED_RADPS))
+
+/* Macros to define the component ID */
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_SOURCEID     ((uint8)Ifx_ComponentID_SourceID_infineonTechnologiesAG)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_LIBRARYID    ((uint16)Ifx_ComponentID_LibraryID_mctrlDriveAlgorithm)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_MODULEID     (5U)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_COMPONENTID1 (1U)
+
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_COMPONENTID2 ((uint8)Ifx_ComponentID_ComponentID2_basic)
+
+/* Macros to define the component version */
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_MAJOR   (1U)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_MINOR   (3U)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_PATCH   (0U)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_T       (0U)
+#define IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_REV     (0U)
+
+/* *INDENT-OFF* */
+/* Component ID */
+static const Ifx_ComponentID      Ifx_MDA_SlidingModeObserver_componentID = {
+    .sourceID     = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_SOURCEID,
+    .libraryID    = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_LIBRARYID,
+    .moduleID     = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_MODULEID,
+    .componentID1 = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_COMPONENTID1,
+    .componentID2 = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTID_COMPONENTID2,
+};
+
+/* Component Version */
+static const Ifx_ComponentVersion Ifx_MDA_SlidingModeObserver_componentVersion = {
+    .major = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_MAJOR,
+    .minor = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_MINOR,
+    .patch = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_PATCH,
+    .t     = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_T,
+    .rev   = IFX_MDA_SLIDINGMODEOBSERVER_COMPONENTVERSION_REV
+};
+/* *INDENT-ON* */
+/* polyspace-end MISRA2012:D1.1 [Justified:Low] "Behavior verified by unit tests." */
+
+/* Private function to execute the current observer of one stator axis */
+static inline Ifx_Math_Fract16 Ifx_MDA_SlidingModeObserverF16_observeAxis(Ifx_MDA_SlidingModeObserverF16* self,
+                                                                          Ifx_Math_Fract16* currentEst,
+                                                                          Ifx_Math_Fract16 emf, Ifx_Math_Fract16
+                                                                          statorVoltage, Ifx_Math_Fract16
+                                                                          statorCurrent);
+
+/* Private function to execute the PLL on the estimated back EMF */
+static inline void Ifx_MDA_SlidingModeObserverF16_trackEmf(Ifx_MDA_SlidingModeObserverF16* self);
+
+/* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
+ * argument." */
+
+/* Function to get the component ID */
+void Ifx_MDA_SlidingModeObserverF16_getID(const Ifx_ComponentID** componentID)
+{
+    *componentID = &Ifx_MDA_SlidingModeObserver_componentID;
+}
+
+
+/* Function to get the component version */
+void Ifx_MDA_SlidingModeObserverF16_getVersion(const Ifx_ComponentVersion** componentVersion)
+{
+    *componentVersion = &Ifx_MDA_SlidingModeObserver_componentVersion;
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_init(Ifx_MDA_SlidingModeObserverF16* self)
+{
+    /* Initialize speed filter */
+    Ifx_Math_LowPass1stF16_init(&(self->p_speedFilter));
+    Ifx_Math_LowPass1stF16_setTimeConstant_us(&(self->p_speedFilter), IFX_MDA_FLUXESTIMATORF16_CFG_SPEED_TC_US);
+
+    /* Proportional gain of the PLL */
+    self->p_pllPropGainQ12 = IFX_MDA_SLIDINGMODEOBSERVERF16_PLL_PROP_GAIN_Q12;
+
+    /* Initialize sampling time from Config Wizard, the sampling time of the Flux Estimator is used */
+    Ifx_MDA_SlidingModeObserverF16_setSamplingTime_us(self, IFX_MDA_FLUXESTIMATORF16_CFG_SAMPLING_TIME_US);
+
+    /* Reset states and outputs */
+    Ifx_MDA_SlidingModeObserverF16_reset(self);
+
+    /* Set initial operation mode to disabled */
+    self->p_mode = Ifx_MDA_FluxEstimatorF16_Mode_disable;
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_initSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, const
+                                                           Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs)
+{
+    /* Initialize speed filter, its coefficient is one of the given ones */
+    Ifx_Math_LowPass1stF16_init(&(self->p_speedFilter));
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_speedFilter), coeffs->speedTimeConstCoeff,
+        IFX_MDA_FLUXESTIMATORF16_CFG_SPEED_TC_US, coeffs->samplingTime_us);
+
+    /* Proportional gain of the PLL */
+    self->p_pllPropGainQ12 = IFX_MDA_SLIDINGMODEOBSERVERF16_PLL_PROP_GAIN_Q12;
+
+    /* Gains at the sampling time of the coefficients */
+    Ifx_MDA_SlidingModeObserverF16_setSamplingTimeCoeffs(self, coeffs);
+
+    /* Reset states and outputs */
+    Ifx_MDA_SlidingModeObserverF16_reset(self);
+
+    /* Set initial operation mode to disabled */
+    self->p_mode = Ifx_MDA_FluxEstimatorF16_Mode_disable;
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_reset(Ifx_MDA_SlidingModeObserverF16* self)
+{
+    self->p_currentEst.real = 0;
+    self->p_currentEst.imag = 0;
+    self->p_emf.real        = 0;
+    self->p_emf.imag        = 0;
+    self->p_speedIntegQ31   = 0;
+    self->p_angle           = 0;
+    Ifx_Math_LowPass1stF16_setPreviousValue(&(self->p_speedFilter), 0);
+    self->p_output.anglePLL = 0;
+    self->p_output.speedQ15 = 0;
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_setSamplingTime_us(Ifx_MDA_SlidingModeObserverF16* self, uint32
+                                                       samplingTime_us)
+{
+    Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs coeffs;
+
+    Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs(self, samplingTime_us, &coeffs);
+    Ifx_MDA_SlidingModeObserverF16_setSamplingTimeCoeffs(self, &coeffs);
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, uint32
+                                                           samplingTime_us,
+                                                           Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs)
+{
+    /* Current gain in Q12, limited to the range of the representation */
+    Ifx_Math_Fract32 currentGainQ12 = (Ifx_Math_Fract32)(((sint64)samplingTime_us *
+                                                          IFX_MDA_SLIDINGMODEOBSERVERF16_CURRENT_GAIN_PER_US_Q24) >> 12);
+
+    coeffs->currentGainQ12 = Ifx_Math_Sat_F16_F32(currentGainQ12);
+
+    if (coeffs->currentGainQ12 < 1)
+    {
+        coeffs->currentGainQ12 = 1;
+    }
+
+    /* Slope of the switching function, so that the configured fraction of the current error is corrected in each
+     * sampling period: slope = c / g */
+
+    /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    coeffs->slidingSlopeQ12 = Ifx_Math_Sat_F16_F32(
+        ((Ifx_Math_Fract32)IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_CORRECTION_GAIN_Q15 << 9) / coeffs->currentGainQ12);
+
+    /* PLL integral gain and angle increment per sampling period */
+    coeffs->pllIntegGainSamplingTimeQ16 = (Ifx_Math_Fract32)(((sint64)samplingTime_us *
+                                                              IFX_MDA_SLIDINGMODEOBSERVERF16_PLL_INTEG_GAIN_PER_US_Q32)
+                                                             >> 16);
+    coeffs->angleIncrement = (Ifx_Math_Fract32)(((sint64)samplingTime_us *
+                                                 IFX_MDA_SLIDINGMODEOBSERVERF16_ANGLE_INCREMENT_PER_US_Q16) >> 16);
+
+    /* Speed filter */
+    coeffs->speedTimeConstCoeff = Ifx_Math_LowPass1stF16_calcTimeConstCoeff(
+        Ifx_Math_LowPass1stF16_getTimeConstant_us(&(self->p_speedFilter)), samplingTime_us);
+    coeffs->samplingTime_us     = samplingTime_us;
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_setSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, const
+                                                          Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs)
+{
+    self->p_currentGainQ12              = coeffs->currentGainQ12;
+    self->p_slidingSlopeQ12             = coeffs->slidingSlopeQ12;
+    self->p_pllIntegGainSamplingTimeQ16 = coeffs->pllIntegGainSamplingTimeQ16;
+    self->p_angleIncrement              = coeffs->angleIncrement;
+    self->p_samplingTime_us             = coeffs->samplingTime_us;
+
+    /* Set sampling time in the dependent modules */
+    Ifx_Math_LowPass1stF16_setTimeConstCoeff(&(self->p_speedFilter), coeffs->speedTimeConstCoeff,
+        Ifx_Math_LowPass1stF16_getTimeConstant_us(&(self->p_speedFilter)), coeffs->samplingTime_us);
+}
+
+
+void Ifx_MDA_SlidingModeObserverF16_getSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self,
+                                                          Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs)
+{
+    coeffs->samplingTime_us             = self->p_samplingTime_us;
+    coeffs->currentGainQ12              = self->p_currentGainQ12;
+    coeffs->slidingSlopeQ12             = self->p_slidingSlopeQ12;
+    coeffs->pllIntegGainSamplingTimeQ16 = self->p_pllIntegGainSamplingTimeQ16;
+    coeffs->angleIncrement              = self->p_angleIncrement;
+    coeffs->speedTimeConstCoeff         = Ifx_Math_LowPass1stF16_getTimeConstCoeff(&(self->p_speedFilter));
+}
+
+
+__USED void Ifx_MDA_SlidingModeObserverF16_execute(Ifx_MDA_SlidingModeObserverF16* self, Ifx_Math_CmpFract16
+                                                   statorVoltage, Ifx_Math_CmpFract16 statorCurrent)
+{
+    if (self->p_mode == Ifx_MDA_FluxEstimatorF16_Mode_enable)
+    {
+        /* Current observer and switching function, the back EMF of the last period drives the current model */
+        self->p_emf.real = Ifx_MDA_SlidingModeObserverF16_observeAxis(self, &self->p_currentEst.real,
+            self->p_emf.real, statorVoltage.real, statorCurrent.real);
+        self->p_emf.imag = Ifx_MDA_SlidingModeObserverF16_observeAxis(self, &self->p_currentEst.imag,
+            self->p_emf.imag, statorVoltage.imag, statorCurrent.imag);
+
+        /* Lock the PLL onto the estimated back EMF */
+        Ifx_MDA_SlidingModeObserverF16_trackEmf(self);
+    }
+    else
+    {
+        /* Speed shall be set to zero and angle shall be kept at last value if the observer is disabled */
+        self->p_output.speedQ15 = 0;
+    }
+}
+
+
+static inline Ifx_Math_Fract16 Ifx_MDA_SlidingModeObserverF16_observeAxis(Ifx_MDA_SlidingModeObserverF16* self,
+                                                                          Ifx_Math_Fract16* currentEst,
+                                                                          Ifx_Math_Fract16 emf, Ifx_Math_Fract16
+                                                                          statorVoltage, Ifx_Math_Fract16
+                                                                          statorCurrent)
+{
+    /* Local variable declaration */
+    Ifx_Math_Fract16 indVoltage;
+    Ifx_Math_Fract16 currentError;
+    Ifx_Math_Fract32 switching;
+
+    /* U_L = Us - I_est*R - E_est, voltage across the inductance of the model */
+    indVoltage = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)statorVoltage -
+                                      (Ifx_Math_Fract32)Ifx_Math_Mul_F16(*currentEst,
+                                          IFX_MDA_FLUXESTIMATORF16_CFG_PHASE_RES_Q15) - (Ifx_Math_Fract32)emf);
+
+    /* I_est = I_est + U_L * Ts / (Tb * L) */
+
+    /* polyspace +3 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    *currentEst = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)*currentEst +
+                                       (((Ifx_Math_Fract32)indVoltage * self->p_currentGainQ12) >> 12));
+
+    /* Current error of the model */
+    currentError = Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)*currentEst - (Ifx_Math_Fract32)statorCurrent);
+
+    /* Switching function, linear within the boundary layer and saturated at the sliding gain outside of it */
+
+    /* polyspace +1 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    switching = ((Ifx_Math_Fract32)currentError * self->p_slidingSlopeQ12) >> 12;
+
+    if (switching > IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_SLIDING_GAIN_Q15)
+    {
+        switching = IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_SLIDING_GAIN_Q15;
+    }
+    else if (switching < -IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_SLIDING_GAIN_Q15)
+    {
+        switching = -IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_SLIDING_GAIN_Q15;
+    }
+    else
+    {
+        /* Within the boundary layer */
+    }
+
+    return (Ifx_Math_Fract16)switching;
+}
+
+
+static inline void Ifx_MDA_SlidingModeObserverF16_trackEmf(Ifx_MDA_SlidingModeObserverF16* self)
+{
+    /* Local variable declaration */
+    Ifx_Math_SinCos_Type sinCos;
+    Ifx_Math_Fract32     angleError;
+    Ifx_Math_Fract16     absAlpha;
+    Ifx_Math_Fract16     absBeta;
+    Ifx_Math_Fract32     magnitude;
+    Ifx_Math_Fract16     angleErrorNorm;
+    Ifx_Math_Fract32     speed;
+
+    /* The back EMF leads the rotor flux by pi/2: E = w * Psi * (-sin(theta), cos(theta)), so the cross product with
+     * the estimated angle is -(E_alpha * cos(theta_est) + E_beta * sin(theta_est)) = w * Psi * sin(theta - theta_est)
+     */
+    sinCos     = Ifx_Math_SinCos_F16(self->p_angle);
+
+    /* polyspace +3 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    angleError = -((((Ifx_Math_Fract32)self->p_emf.real * sinCos.cos) +
+                    ((Ifx_Math_Fract32)self->p_emf.imag * sinCos.sin)) >> 15);
+
+    /* Magnitude of the back EMF by the alpha max plus beta min approximation, max + min / 2, limited to the minimum
+     * back EMF below which the angle error is not normalized */
+    absAlpha  = Ifx_Math_Abs_F16(self->p_emf.real);
+    absBeta   = Ifx_Math_Abs_F16(self->p_emf.imag);
+    magnitude = (absAlpha > absBeta) ? ((Ifx_Math_Fract32)absAlpha + (absBeta / 2)) :
+                ((Ifx_Math_Fract32)absBeta + (absAlpha / 2));
+
+    if (magnitude < IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_MIN_EMF_Q15)
+    {
+        magnitude = IFX_MDA_SLIDINGMODEOBSERVERF16_CFG_MIN_EMF_Q15;
+    }
+
+    /* Normalized angle error sin(theta - theta_est), in Q15, with the sign of the estimated speed */
+
+    /* polyspace +1 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    angleErrorNorm = Ifx_Math_Sat_F16_F32((angleError << 15) / magnitude);
+
+    if (self->p_speedIntegQ31 < 0)
+    {
+        angleErrorNorm = -angleErrorNorm;
+    }
+
+    /* Integral path, the estimated speed */
+    self->p_speedIntegQ31 = Ifx_Math_AddSat_F32(self->p_speedIntegQ31,
+        self->p_pllIntegGainSamplingTimeQ16 * angleErrorNorm);
+
+    /* Proportional path, speed of the angle integration */
+
+    /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    speed = (self->p_speedIntegQ31 >> 16) + (((Ifx_Math_Fract32)self->p_pllPropGainQ12 * angleErrorNorm) >> 12);
+
+    /* Angle integration, wrapping around at 2 * pi */
+    self->p_angle = self->p_angle + (uint32)((sint64)speed * self->p_angleIncrement);
+
+    /* Filter and output normalized speed, output angle */
+    self->p_output.speedQ15 = Ifx_Math_LowPass1stF16_execute(&(self->p_speedFilter),
+        (Ifx_Math_Fract16)(self->p_speedIntegQ31 >> 16));
+    self->p_output.anglePLL = self->p_angle;
+}
+
+
+/* polyspace-end MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
+ * argument." */
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_MDA_SlidingModeObserverF16.h
+ * \brief Sliding mode observer for the rotor flux position and speed.
+ * This module takes as input the stator voltage and current and outputs the estimated normalized speed and the
+ * estimated position of rotor flux (in radians), in the same format as the Flux Estimator.
+ *
+ * A discrete model of the stator current is driven by the stator voltage and by a switching function of the current
+ * error. The switching function is linear within a boundary layer and saturated at the sliding gain outside of it, its
+ * output is the estimated back EMF. A tracking PLL with proportional and integral path locks onto the back EMF
+ * directly, by the cross product of the back EMF with the estimated angle, so no arctangent is calculated.
+ *
+ * The motor and base values are taken from <u>Ifx_MDA_FluxEstimatorF16_Cfg</u>.h, the observer and PLL gains from
+ * <u>Ifx_MDA_SlidingModeObserverF16_Cfg</u>.h.
+ */
+
+#ifndef IFX_MDA_SLIDINGMODEOBSERVERF16_H
+#define IFX_MDA_SLIDINGMODEOBSERVERF16_H
+#include "Ifx_ComponentID.h"
+#include "Ifx_ComponentVersion.h"
+#include "Ifx_MDA_FluxEstimatorF16.h"
+#include "Ifx_MDA_SlidingModeObserverF16_Cfg.h"
+#include "Ifx_Math.h"
+#include "Ifx_Math_LowPass1stF16.h"
+
+/**
+ * Coefficients of the observer which depend on the sampling time, as calculated by
+ * Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs()
+ */
+typedef struct Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs
+{
+    /**
+     * Sampling time, in microseconds
+     */
+    uint32 samplingTime_us;
+
+    /**
+     * Sampling time divided by the base time and by the normalized inductance, in Q12
+     */
+    Ifx_Math_Fract16 currentGainQ12;
+
+    /**
+     * Slope of the switching function within the boundary layer, in Q12
+     */
+    Ifx_Math_Fract16 slidingSlopeQ12;
+
+    /**
+     * Integral gain of the PLL multiplied by the sampling time, normalized by the base speed, in Q16
+     */
+    Ifx_Math_Fract32 pllIntegGainSamplingTimeQ16;
+
+    /**
+     * Angle increment per sampling time of the normalized speed 2^-15
+     */
+    Ifx_Math_Fract32 angleIncrement;
+
+    /**
+     * Discrete coefficient of the speed filter, in Q15
+     */
+    Ifx_Math_Fract16 speedTimeConstCoeff;
+} Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs;
+
+/**
+ * \brief Data structure that stores all data of module instance.
+ *
+ */
+typedef struct Ifx_MDA_SlidingModeObserverF16
+{
+    /**
+     * Estimated stator current in stator reference frame, normalized, in Q15
+     */
+    Ifx_Math_CmpFract16 p_currentEst;
+
+    /**
+     * Output of the switching function, i.e. the estimated back EMF in stator reference frame, normalized, in Q15
+     */
+    Ifx_Math_CmpFract16 p_emf;
+
+    /**
+     * Integral path of the PLL, i.e. the estimated speed, normalized, in Q31
+     */
+    Ifx_Math_Fract32 p_speedIntegQ31;
+
+    /**
+     * Angle of the PLL, normalized to 0 to 2^32-1
+     */
+    uint32 p_angle;
+
+    /**
+     * First order low pass filter for the speed, with the time constant of the speed filter of the Flux Estimator
+     */
+    Ifx_Math_LowPass1stF16 p_speedFilter;
+
+    /**
+     * Contains the output variables of the module.
+     */
+    Ifx_MDA_FluxEstimatorF16_Output p_output;
+
+    /**
+     * Sampling time, in microseconds
+     */
+    uint32 p_samplingTime_us;
+
+    /**
+     * Sampling time divided by the base time and by the normalized inductance, in Q12
+     */
+    Ifx_Math_Fract16 p_currentGainQ12;
+
+    /**
+     * Slope of the switching function within the boundary layer, in Q12
+     */
+    Ifx_Math_Fract16 p_slidingSlopeQ12;
+
+    /**
+     * Proportional gain of the PLL, normalized by the base speed, in Q12
+     */
+    Ifx_Math_Fract16 p_pllPropGainQ12;
+
+    /**
+     * Integral gain of the PLL multiplied by the sampling time, normalized by the base speed, in Q16
+     */
+    Ifx_Math_Fract32 p_pllIntegGainSamplingTimeQ16;
+
+    /**
+     * Angle increment per sampling time of the normalized speed 2^-15
+     */
+    Ifx_Math_Fract32 p_angleIncrement;
+
+    /**
+     * Configured operation mode of the observer
+     */
+    Ifx_MDA_FluxEstimatorF16_Mode p_mode;
+} Ifx_MDA_SlidingModeObserverF16;
+
+/**
+ *  \brief Initialize the module to the default values and to the values configured in Config Wizard.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_init(Ifx_MDA_SlidingModeObserverF16* self);
+
+/**
+ *  \brief Initialize the module to the default values, with the coefficients which depend on the sampling time as
+ * calculated before, e.g. stored in a parameter block, without division.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] coeffs Coefficients as returned by Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs() or
+ * Ifx_MDA_SlidingModeObserverF16_getSamplingTimeCoeffs()
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_initSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, const
+                                                           Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs);
+
+/**
+ *  \brief Reset the estimated current, back EMF, speed, speed filter and angle to zero.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_reset(Ifx_MDA_SlidingModeObserverF16* self);
+
+/**
+ *  \brief Perform estimation of the rotor flux rotational speed and position.
+ *
+ *  Same interface as Ifx_MDA_FluxEstimatorF16_execute(). If the module is enabled, this API performs the speed and
+ * angle estimation of the rotor flux. In case of mode disable, this API does not perform calculations, but sets the
+ * returned speed to zero and the returned estimated angle to the last value.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] statorVoltage Structure containing the normalized stator voltage applied during the last sampling
+ * period, in 1Q15 format
+ *  \param [in] statorCurrent Structure containing the normalized stator current at the end of the last sampling
+ * period, in 1Q15 format
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_execute(Ifx_MDA_SlidingModeObserverF16* self, Ifx_Math_CmpFract16 statorVoltage,
+                                            Ifx_Math_CmpFract16 statorCurrent);
+
+/**
+ *  \brief Configure the mode of the observer.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] mode Control input to set the mode of the observer
+ *
+ */
+static inline void Ifx_MDA_SlidingModeObserverF16_configMode(Ifx_MDA_SlidingModeObserverF16* self,
+                                                             Ifx_MDA_FluxEstimatorF16_Mode   mode)
+{
+    self->p_mode = mode;
+}
+
+
+/**
+ *  \brief Set the discrete sampling time period in microseconds, between  [1us, 2000us].
+ *
+ *  The observer and PLL gains per sampling period are recalculated from the sampling time.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_setSamplingTime_us(Ifx_MDA_SlidingModeObserverF16* self, uint32
+                                                       samplingTime_us);
+
+/**
+ *  \brief Calculate the coefficients which depend on the sampling time, as set by
+ * Ifx_MDA_SlidingModeObserverF16_setSamplingTime_us(), e.g. outside of the fast loop.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] samplingTime_us Sampling time, in microseconds
+ *  \param [out] coeffs Coefficients at the given sampling time
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, uint32
+                                                           samplingTime_us,
+                                                           Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs);
+
+/**
+ *  \brief Set the coefficients which depend on the sampling time as calculated before, without division.
+ *
+ *  The states of the observer are kept, e.g. for a change of the sampling time within the fast loop.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] coeffs Coefficients as returned by Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs()
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_setSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self, const
+                                                          Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs);
+
+/**
+ *  \brief Get the coefficients which depend on the sampling time, as set last.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [out] coeffs Coefficients in use
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_getSamplingTimeCoeffs(Ifx_MDA_SlidingModeObserverF16* self,
+                                                          Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs* coeffs);
+
+/**
+ *  \brief Get the discrete sampling time period in microseconds.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Sampling time, in microseconds
+ */
+static inline uint32 Ifx_MDA_SlidingModeObserverF16_getSamplingTime_us(Ifx_MDA_SlidingModeObserverF16* self)
+{
+    return self->p_samplingTime_us;
+}
+
+
+/**
+ *  \brief Get the module output variables.
+ * The output contains the estimated speed, represented in Q15, and the estimated flux angle.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [out] output Structure containing the module outputs
+ *
+ */
+static inline void Ifx_MDA_SlidingModeObserverF16_getOutput(Ifx_MDA_SlidingModeObserverF16 * self,
+                                                            Ifx_MDA_FluxEstimatorF16_Output* output)
+{
+    *output = self->p_output;
+}
+
+
+/**
+ *  \brief Get the active mode of the observer.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return Mode
+ */
+static inline Ifx_MDA_FluxEstimatorF16_Mode Ifx_MDA_SlidingModeObserverF16_getMode(Ifx_MDA_SlidingModeObserverF16*
+                                                                                   self)
+{
+    return self->p_mode;
+}
+
+
+/**
+ *  \brief Returns the component ID
+ *
+ *
+ *  \param [out] *componentID Variable to store the address of the component ID
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_getID(const Ifx_ComponentID** componentID);
+
+/**
+ *  \brief Returns the component version
+ *
+ *
+ *  \param [out] *componentVersion Variable to store the address of the component version
+ *
+ */
+void Ifx_MDA_SlidingModeObserverF16_getVersion(const Ifx_ComponentVersion** componentVersion);
+
+#endif /*IFX_MDA_SLIDINGMODEOBSERVERF16_H*/
@@ -44,6 +44,16 @@
 #define IFX_MHA_PATTERNGEN_TLE987_COMPONENTVERSION_T          (0U)
 #define IFX_MHA_PATTERNGEN_TLE987_COMPONENTVERSION_REV        (0U)
 
+/* Number of PWM periods per current control cycle and whether the compare values are passed through the shadow
+ * variables */
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+#define IFX_MHA_PATTERNGEN_TLE987_LOOP_FACTOR(self)           ((self)->p_currentLoopFactor)
+#define IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW                  (1)
+#else
+#define IFX_MHA_PATTERNGEN_TLE987_LOOP_FACTOR(self)           (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR)
+#define IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW                  (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR > 1)
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
+
 /* *INDENT-OFF* */
 /* Component ID */
 static const Ifx_ComponentID      Ifx_MHA_PatternGen_TLE987_componentID = {
@@ -90,7 +100,7 @@ static inline void Ifx_MHA_PatternGen_TLE987_transferUpCounting(Ifx_MHA_PatternG
 static inline void Ifx_MHA_PatternGen_TLE987_actionDisable(void);
 static inline void Ifx_MHA_PatternGen_TLE987_actionEnable(void);
 
-#if (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR > 1)
+#if IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW
 
 /* Update values from the shadow variables to the used ones */
 static inline void Ifx_MHA_PatternGen_TLE987_updateCompareAndTriggers(Ifx_MHA_PatternGen_TLE987* self);
@@ -139,6 +149,12 @@ void Ifx_MHA_PatternGen_TLE987_init(Ifx_MHA_PatternGen_TLE987* self)
     /* Reset executed flag and cycle counter */
     self->p_executed     = false;
     self->p_cycleCounter = 0;
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /* Start with the configured factor */
+    self->p_currentLoopFactor        = IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR;
+    self->p_currentLoopFactorRequest = IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR;
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
 
     /* Start T13 on the period match to generate trigger for second current measurement */
     CCU6_SetT13Trigger(IFX_MHA_PATTERNGEN_TLE987_TRIGGER_T13_ON_PERIOD_MATCH);
@@ -176,7 +192,7 @@ void Ifx_MHA_PatternGen_TLE987_execute(Ifx_MHA_PatternGen_TLE987* self, uint16 c
     bool clearFault = self->_Super_Ifx_MHA_PatternGen.p_clearFault;
 
 /* If the current loop factor is 1, then don't use the shadow variables */
-#if (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR == 1)
+#if !IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW
 
     /* Assign the trigger and the compare values to be used in the interrupts */
     self->p_triggerTime_tick[0] = triggerTime_tick[0];
@@ -210,11 +226,11 @@ void Ifx_MHA_PatternGen_TLE987_execute(Ifx_MHA_PatternGen_TLE987* self, uint16 c
 void Ifx_MHA_PatternGen_TLE987_onPeriodMatch(Ifx_MHA_PatternGen_TLE987* self)
 {
     /* Last cycle and execute was already called, update compare values and transfer it to the CCU6 */
-    if ((self->p_cycleCounter == (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR - 1))
+    if ((self->p_cycleCounter == (IFX_MHA_PATTERNGEN_TLE987_LOOP_FACTOR(self) - 1))
         && (self->p_executed == true))
     {
 /* Only update the values if the current loop factor is bigger than 1 */
-#if (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR > 1)
+#if IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW
 
         /* Update compare and trigger values */
         Ifx_MHA_PatternGen_TLE987_updateCompareAndTriggers(self);
@@ -225,7 +241,7 @@ void Ifx_MHA_PatternGen_TLE987_onPeriodMatch(Ifx_MHA_PatternGen_TLE987* self)
     }
 
     /* Last cycle and PatternGen execute was not called, compare values will be updated by execute */
-    else if (self->p_cycleCounter == (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR - 1))
+    else if (self->p_cycleCounter == (IFX_MHA_PATTERNGEN_TLE987_LOOP_FACTOR(self) - 1))
     {
         self->p_cycleCounter++;
     }
@@ -283,7 +299,7 @@ static inline void Ifx_MHA_PatternGen_TLE987_transferDownCounting(Ifx_MHA_Patter
 }
 
 
-#if (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR > 1)
+#if IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW
 static inline void Ifx_MHA_PatternGen_TLE987_updateCompareAndTriggers(Ifx_MHA_PatternGen_TLE987* self)
 {
     /* Update compare values */
@@ -326,9 +342,9 @@ static inline Ifx_MHA_PatternGen_TLE987_State Ifx_MHA_PatternGen_TLE987_stateOn(
         NVIC_Node5_Dis();
 
         /* Transfer values if the last period match was already executed */
-        if (self->p_cycleCounter == IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR)
+        if (self->p_cycleCounter == IFX_MHA_PATTERNGEN_TLE987_LOOP_FACTOR(self))
         {
-#if (IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR > 1)
+#if IFX_MHA_PATTERNGEN_TLE987_USE_SHADOW
 
             /* Update compare and trigger values and transfer them to CCU6 */
             Ifx_MHA_PatternGen_TLE987_updateCompareAndTriggers(self);
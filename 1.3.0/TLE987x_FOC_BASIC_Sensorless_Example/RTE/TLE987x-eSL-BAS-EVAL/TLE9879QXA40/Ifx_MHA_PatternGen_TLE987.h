@@ -15,6 +15,12 @@
  * well as the compare value needed by the hardware module to trigger a current measurement (compare values are mainly
  * calculated by the modulator). It sets the modulation frequency and the deadtime of the system. In addition to that,
  * it can be configured to react on a trap fault.
+ *
+ * The current control loop runs every IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR PWM periods. With
+ * IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 the factor is a variable instead, which is requested by
+ * Ifx_MHA_PatternGen_TLE987_setCurrentLoopFactor() and taken over by Ifx_MHA_PatternGen_TLE987_reset(), i.e. at the PWM
+ * period in which the current control loop is triggered. The compare values are then always passed through the shadow
+ * variables, also for a factor of 1.
  */
 
 #ifndef IFX_MHA_PATTERNGEN_TLE987_H
@@ -23,6 +29,7 @@
 #include "Ifx_ComponentID.h"
 #include "Ifx_ComponentVersion.h"
 #include "Ifx_MHA_PatternGen.h"
+#include "Ifx_MHA_PatternGen_Cfg.h"
 #include "ccu6.h"
 
 /**
@@ -107,6 +114,18 @@ typedef struct Ifx_MHA_PatternGen_TLE987
      * Flags that the pattern generator execute function has finished its execution
      */
     bool p_executed;
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /**
+     * Number of PWM periods per current control cycle
+     */
+    uint8 p_currentLoopFactor;
+
+    /**
+     * Requested number of PWM periods per current control cycle, taken over by Ifx_MHA_PatternGen_TLE987_reset()
+     */
+    uint8 p_currentLoopFactorRequest;
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
 } Ifx_MHA_PatternGen_TLE987;
 
 /**
@@ -188,9 +207,56 @@ static inline void Ifx_MHA_PatternGen_TLE987_reset(Ifx_MHA_PatternGen_TLE987* se
 {
     self->p_cycleCounter = 0;
     self->p_executed     = false;
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /* A new factor starts with the current control cycle */
+    self->p_currentLoopFactor = self->p_currentLoopFactorRequest;
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
 }
 
 
+/**
+ *  \brief Get the number of PWM periods per current control cycle.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR, or the factor in use with
+ * IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+ */
+static inline uint8 Ifx_MHA_PatternGen_TLE987_getCurrentLoopFactor(Ifx_MHA_PatternGen_TLE987* self)
+{
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+    return self->p_currentLoopFactor;
+#else
+    (void)self;
+
+    return (uint8)IFX_MHA_PATTERNGEN_CFG_CURRENT_LOOP_FACTOR;
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
+}
+
+
+#if IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+/**
+ *  \brief Request the number of PWM periods per current control cycle.
+ *
+ *  The factor is taken over by the next call of Ifx_MHA_PatternGen_TLE987_reset(), so the PWM period in which the
+ * current control loop is triggered is the first one of a cycle with the new factor. Only available with
+ * IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] factor Number of PWM periods per current control cycle, at least 1
+ *
+ */
+static inline void Ifx_MHA_PatternGen_TLE987_setCurrentLoopFactor(Ifx_MHA_PatternGen_TLE987* self, uint8 factor)
+{
+    self->p_currentLoopFactorRequest = factor;
+}
+
+
+#endif /* IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR */
+
+
 /**
  *  \brief Get the status of the pattern generator.
  *
@@ -14,6 +14,7 @@
 #include "Ifx_Math_Abs.h"
 #include "Ifx_Math_CartToPolar.h"
 #include "Ifx_Math_Clarke.h"
+#include "Ifx_Math_InvPark.h"
 #include "Ifx_Math_Park.h"
 #include "Ifx_Math_PolarToCart.h"
 #include "Ifx_Math_NegSat.h"
@@ -21,6 +22,14 @@
 #include "Ifx_Math_AddSat.h"
 #include "Ifx_Math_DivShLSat.h"
 #include "Ifx_Math_SubSat.h"
+#include "Ifx_Math_Sat.h"
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1
+#include "Ifx_Math_PiConstF16.h"
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+#include "bootrom.h"
+#include "tle_variants.h"
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
 
 /* Macro to saturate the value with wrapping */
 #define IFX_MS_FOCSOLUTIONF16_2MAX                              (-2 * IFX_MATH_FRACT16_MIN)
@@ -36,6 +45,35 @@
 
 /* Macro for transition mode when mode is smooth transition */
 #define IFX_MS_FOCSOLUTIONF16_TRANSITION_MODE_SMOOTH_TRANSITION (1)
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+/* Delay from the current sampling to the middle of the interval in which the voltage command is applied, 1.5 sampling
+ * times plus half a PWM period, i.e. (3 * current loop factor + 1) half PWM periods in microseconds */
+#define IFX_MS_FOCSOLUTIONF16_DELAY_COMPENSATION_TIME_US \
+    ((((3U * IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR) + 1U) * 1000U) / \
+     (2U * IFX_MS_FOCSOLUTIONF16_CFG_FREQUENCY_KHZ))
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+/* Address of the first page of the parameter block, the pages are the last ones of the data flash */
+#define IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_START \
+    (DataFlashStart + DataFlashSize - ((uint32)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES * FlashPageSize))
+
+/* Initial value of the CRC-16/CCITT */
+#define IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_CRC_INIT (0xFFFFU)
+
+/* Bytes covered by the CRC, from the version to the end of the parameters */
+#define IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_CRC_SIZE \
+    ((uint32)sizeof(Ifx_MS_FocSolutionF16_ParameterBlock) - (2U * (uint32)sizeof(uint16)))
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1
+
+/* Speed PI controller with the Q formats of Ifx_MS_FocSolutionF16_initSpeedPi() as constants */
+IFX_MATH_PICONSTF16_DEFINE(Ifx_MS_FocSolutionF16_executeSpeedPi, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_PROPGAIN_Q_FORMAT,
+    IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KI_TS_Q_FORMAT, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_KAW_TS_Q_FORMAT,
+    Ifx_Math_FractQFormat_q14, IFX_MS_FOCSOLUTIONF16_CFG_SPEED_PI_LIMIT_Q_FORMAT)
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1 */
 
 /* Macros to define the component ID */
 #define IFX_MS_FOCSOLUTION_TLE987_COMPONENTID_SOURCEID                   \
@@ -73,6 +111,18 @@ static const Ifx_ComponentVersion Ifx_MS_FocSolution_TLE987_componentVersion = {
     .t     = IFX_MS_FOCSOLUTION_TLE987_COMPONENTVERSION_T,
     .rev   = IFX_MS_FOCSOLUTION_TLE987_COMPONENTVERSION_REV
 };
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+/* CRC-16/CCITT (polynomial 0x1021) of the 16 nibble values, the CRC is calculated a nibble at a time */
+static const uint16 Ifx_MS_FocSolutionF16_crcTable[16] = {
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU
+};
+
+/* The parameter block has to fit into one data flash page */
+typedef uint8 Ifx_MS_FocSolutionF16_ParameterBlockFitsPage[
+    (sizeof(Ifx_MS_FocSolutionF16_ParameterBlock) <= FlashPageSize) ? 1 : -1];
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
 /* *INDENT-ON* */
 
 /* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
@@ -84,17 +134,46 @@ static inline void Ifx_MS_FocSolutionF16_initDriveAlgo(Ifx_MS_FocSolutionF16* se
 static inline void Ifx_MS_FocSolutionF16_initSpeedPi(Ifx_MS_FocSolutionF16* self);
 static inline void Ifx_MS_FocSolutionF16_initSpeedAccelerationLimiters(Ifx_MS_FocSolutionF16* self);
 static inline void Ifx_MS_FocSolutionF16_initStartCurrentRateLimiter(Ifx_MS_FocSolutionF16* self);
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+/* Functions of the parameter block */
+static inline void Ifx_MS_FocSolutionF16_initModulesParameters(Ifx_MS_FocSolutionF16* self, const
+                                                               Ifx_MS_FocSolutionF16_Parameters* parameters);
+static inline void Ifx_MS_FocSolutionF16_setPiParameters(Ifx_Math_PiF16* pi, const
+                                                         Ifx_MS_FocSolutionF16_PiParameters* parameters);
+static inline void Ifx_MS_FocSolutionF16_getPiParameters(Ifx_Math_PiF16* pi, Ifx_MS_FocSolutionF16_PiParameters*
+                                                         parameters);
+static inline const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_getParameterPage(uint8 page);
+static inline const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_findNewestBlock(bool olderOnly,
+                                                                                                uint16 sequence);
+static uint16 Ifx_MS_FocSolutionF16_calcParameterBlockCrc(const Ifx_MS_FocSolutionF16_ParameterBlock* block);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
 
 /* Functions called by Ifx_MS_FocSolutionF16_executeControlMode() */
 static inline Ifx_MHA_MeasurementADC_TLE987_Output Ifx_MS_FocSolutionF16_measureAndReconstruct(
     Ifx_MS_FocSolutionF16* self);
 static inline uint32                Ifx_MS_FocSolutionF16_fluxEstimation(Ifx_MS_FocSolutionF16* self);
+
+/* Functions to access the angle observer selected by IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER */
+static inline void Ifx_MS_FocSolutionF16_configAngleObserverMode(Ifx_MS_FocSolutionF16* self,
+                                                                 Ifx_MDA_FluxEstimatorF16_Mode mode);
+static inline void Ifx_MS_FocSolutionF16_getAngleObserverOutput(Ifx_MS_FocSolutionF16* self,
+                                                                Ifx_MDA_FluxEstimatorF16_Output* output);
 static inline Ifx_Math_PolarFract16 Ifx_MS_FocSolutionF16_regulationLoop(Ifx_MS_FocSolutionF16* self,
                                                                          uint32 estimatedAngle, Ifx_Math_Fract16
                                                                          dcLinkVoltageQ15);
 static inline void Ifx_MS_FocSolutionF16_voltageGeneration(
     Ifx_MS_FocSolutionF16* self, Ifx_Math_PolarFract16 voltageCommandPolar, Ifx_MHA_MeasurementADC_TLE987_Output
     measurementADCOutput);
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+static inline void Ifx_MS_FocSolutionF16_updateProfiler(Ifx_MS_FocSolutionF16* self, const uint32* timestamps);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+static void Ifx_MS_FocSolutionF16_storeLoopGains(Ifx_MS_FocSolutionF16* self);
+static void Ifx_MS_FocSolutionF16_scaleLoopGains(Ifx_MS_FocSolutionF16* self, uint8 factor);
+static void Ifx_MS_FocSolutionF16_updateCurrentLoopFactor(Ifx_MS_FocSolutionF16* self);
+static inline Ifx_Math_Fract16 Ifx_MS_FocSolutionF16_scaleLoopGain(Ifx_Math_Fract16 gain, uint8 factor);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
 static void Ifx_MS_FocSolutionF16_stateMachine(Ifx_MS_FocSolutionF16* self, Ifx_Math_Fract16 speedQ15, bool
                                                faultStatus, Ifx_Math_CmpFract16 currentsDqRef,
                                                Ifx_MDA_IToFControllerF16_Output
@@ -284,11 +363,39 @@ void Ifx_MS_FocSolutionF16_getVersion(const Ifx_ComponentVersion** componentVers
 
 void Ifx_MS_FocSolutionF16_init(Ifx_MS_FocSolutionF16* self)
 {
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+    /* Newest valid parameter block in data flash */
+    const Ifx_MS_FocSolutionF16_ParameterBlock* parameterBlock = Ifx_MS_FocSolutionF16_findParameterBlock();
+
+    if (parameterBlock != NULL_PTR)
+    {
+        /* Initialize modules and speed PI controller with the stored parameters */
+        Ifx_MS_FocSolutionF16_initModulesParameters(self, &(parameterBlock->parameters));
+    }
+    else
+    {
+        /* Initialize modules from used libraries */
+        Ifx_MS_FocSolutionF16_initModules(self);
+
+        /* Initialize speed PI controller */
+        Ifx_MS_FocSolutionF16_initSpeedPi(self);
+    }
+
+#else
+
     /* Initialize modules from used libraries */
     Ifx_MS_FocSolutionF16_initModules(self);
 
     /* Initialize speed PI controller */
     Ifx_MS_FocSolutionF16_initSpeedPi(self);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /* Delay compensation for the configured current loop factor and PWM frequency */
+    Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(&(self->focController),
+        IFX_MS_FOCSOLUTIONF16_DELAY_COMPENSATION_TIME_US);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
 
     /* Initialize transition speeds */
     self->transitionSpeedUpQ15   = IFX_MS_FOCSOLUTIONF16_CFG_TRANSITION_SPEED_UP_Q15;
@@ -332,6 +439,19 @@ void Ifx_MS_FocSolutionF16_init(Ifx_MS_FocSolutionF16* self)
     self->p_clearFaultIsRequested   = false;
     self->p_qCurrentAtTransitionQ15 = IFX_MS_FOCSOLUTIONF16_CFG_Q_CURRENT_AT_TRANSITION_Q15;
     self->p_qCommandZeroCrossing    = false;
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+
+    /* Initialize execution time statistics */
+    Ifx_MS_FocSolutionF16_resetProfiler(self);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /* The modules are initialized for the configured current loop factor */
+    self->p_currentLoopFactor      = Ifx_MS_FocSolutionF16_getCurrentLoopFactor(self);
+    self->p_scaledLoopGains.factor = self->p_currentLoopFactor;
+    Ifx_MS_FocSolutionF16_storeLoopGains(self);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
 }
 
 
@@ -395,7 +515,12 @@ static inline Ifx_Math_Fract16 Ifx_MS_FocSolutionF16_calcCurrentQRef(Ifx_MS_FocS
         Ifx_Math_Fract16 errSpeedQ14         = Ifx_Math_Sub_F16(rateLimitInSpeedQ14, estimatedSpeedQ14);
 
         /* Execute speed PI */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1
+        Ifx_Math_Fract16 speedPiOut = Ifx_MS_FocSolutionF16_executeSpeedPi(&(self->speedPi), errSpeedQ14,
+            qAntiwindupCtrl);
+#else
         Ifx_Math_Fract16 speedPiOut = Ifx_Math_PiF16_execute(&(self->speedPi), errSpeedQ14, qAntiwindupCtrl);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_SPEED_PI_CONST_QFORMAT == 1 */
 
         /* Check if speedPreControl is enabled */
         if (self->p_enableSpeedPreControl == true)
@@ -441,13 +566,40 @@ void Ifx_MS_FocSolutionF16_executeControlMode(Ifx_MS_FocSolutionF16* self)
     Ifx_Math_PolarFract16                voltageCommandPolar;
     Ifx_MHA_MeasurementADC_TLE987_Output measurementADCOutput;
     uint32                               estimatedAngle;
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+
+    /* Timestamps at the start of each stage and at the end of the last stage */
+    uint32 timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_total + 1];
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /* The pattern generator latched a new current loop factor at the start of this fast loop, take the gains over */
+    if (Ifx_MS_FocSolutionF16_getCurrentLoopFactor(self) != self->p_currentLoopFactor)
+    {
+        Ifx_MS_FocSolutionF16_updateCurrentLoopFactor(self);
+    }
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+    timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_measureAndReconstruct] =
+        IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP();
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
 
     /* Return voltage measurement and perform current measurement and reconstruction */
     measurementADCOutput = Ifx_MS_FocSolutionF16_measureAndReconstruct(self);
 
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+    timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_fluxEstimation] = IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP();
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+
     /* Perform the angle and speed estimation */
     estimatedAngle = Ifx_MS_FocSolutionF16_fluxEstimation(self);
 
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+    timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_regulation] = IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP();
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+
     if ((self->p_status.state == Ifx_MS_FocSolutionF16_State_run)
         || (self->p_status.state == Ifx_MS_FocSolutionF16_State_rampDown))
     {
@@ -477,11 +629,501 @@ void Ifx_MS_FocSolutionF16_executeControlMode(Ifx_MS_FocSolutionF16* self)
         voltageCommandPolar.angle     = 0;
     }
 
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+    timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_voltageGeneration] =
+        IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP();
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+
     /* Generate voltage according to the command */
     Ifx_MS_FocSolutionF16_voltageGeneration(self, voltageCommandPolar, measurementADCOutput);
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+    timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_total] = IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP();
+
+    /* Update the execution time statistics */
+    Ifx_MS_FocSolutionF16_updateProfiler(self, timestamps);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+}
+
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+bool Ifx_MS_FocSolutionF16_setCurrentLoopFactor(Ifx_MS_FocSolutionF16* self, uint8 factor)
+{
+    bool accepted = false;
+
+    if ((factor >= 1u) && (factor <= IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX))
+    {
+        /* The scaled gains of a pending request are in use by the fast loop which latches it */
+        if (self->p_scaledLoopGains.factor == self->p_currentLoopFactor)
+        {
+            if (factor != self->p_currentLoopFactor)
+            {
+                Ifx_MS_FocSolutionF16_scaleLoopGains(self, factor);
+            }
+
+            /* Latched by the pattern generator at the start of the next fast loop */
+            Ifx_MHA_PatternGen_TLE987_setCurrentLoopFactor(&(self->patternGenTLE987), factor);
+            accepted = true;
+        }
+        else
+        {
+            accepted = (factor == self->p_scaledLoopGains.factor);
+        }
+    }
+
+    return accepted;
+}
+
+
+static void Ifx_MS_FocSolutionF16_storeLoopGains(Ifx_MS_FocSolutionF16* self)
+{
+    Ifx_MS_FocSolutionF16_LoopGains* gains = &(self->p_loopGains);
+
+    gains->samplingTime_us                    = Ifx_MDA_FluxEstimatorF16_getSamplingTime_us(&(self->fluxEstimator));
+    gains->currentDIntegGainSamplingTime      =
+        Ifx_Math_PiF16_getIntegGainSamplingTime(&(self->focController.currentDPi));
+    gains->currentDAntiWindupGainSamplingTime =
+        Ifx_Math_PiF16_getAntiWindupGainSamplingTime(&(self->focController.currentDPi));
+    gains->currentQIntegGainSamplingTime      =
+        Ifx_Math_PiF16_getIntegGainSamplingTime(&(self->focController.currentQPi));
+    gains->currentQAntiWindupGainSamplingTime =
+        Ifx_Math_PiF16_getAntiWindupGainSamplingTime(&(self->focController.currentQPi));
+    gains->iToFAngleIncrementQ14              = Ifx_MDA_IToFControllerF16_getAngleIncrement(&(self->iToF));
+    gains->vToFAngleIncrementQ14              = Ifx_MDA_VToFControllerF16_getAngleIncrement(&(self->vToF));
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+    gains->delayCompensationTime_us           =
+        Ifx_MDA_FocControllerF16_getDelayCompensationTime_us(&(self->focController));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+}
+
+
+static inline Ifx_Math_Fract16 Ifx_MS_FocSolutionF16_scaleLoopGain(Ifx_Math_Fract16 gain, uint8 factor)
+{
+    /* Gain per sampling interval is proportional to the current loop factor */
+    sint32 scaledGain = ((sint32)gain * (sint32)factor) / (sint32)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR;
+
+    return Ifx_Math_Sat_F16_F32((Ifx_Math_Fract32)scaledGain);
+}
+
+
+static void Ifx_MS_FocSolutionF16_scaleLoopGains(Ifx_MS_FocSolutionF16* self, uint8 factor)
+{
+    Ifx_MS_FocSolutionF16_ScaledLoopGains* scaled = &(self->p_scaledLoopGains);
+    const Ifx_MS_FocSolutionF16_LoopGains* gains  = &(self->p_loopGains);
+    uint32                                 samplingTime_us;
+
+    /* Gains set at the configured factor since the last switch become the base of the scaling */
+    if (self->p_currentLoopFactor == (uint8)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR)
+    {
+        Ifx_MS_FocSolutionF16_storeLoopGains(self);
+    }
+
+    /* Sampling time at the factor, and its ratio to the one in use */
+    samplingTime_us               = (gains->samplingTime_us * factor) /
+                                    (uint32)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR;
+    scaled->gains.samplingTime_us = samplingTime_us;
+    scaled->rateRatioQ16          = ((Ifx_Math_Fract32)factor << 16) / (Ifx_Math_Fract32)self->p_currentLoopFactor;
+
+    /* Flux estimator filters and PLL */
+    Ifx_MDA_FluxEstimatorF16_calcParameters(&(self->fluxEstimator), samplingTime_us, &(scaled->fluxEstimator));
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_calcSamplingTimeCoeffs(&(self->slidingModeObserver), samplingTime_us,
+        &(scaled->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* Deadbeat current controller */
+    Ifx_MDA_FocControllerF16_calcDeadbeatCoeffs(samplingTime_us, &(scaled->deadbeat));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
+    /* Current PI controllers */
+    scaled->gains.currentDIntegGainSamplingTime      =
+        Ifx_MS_FocSolutionF16_scaleLoopGain(gains->currentDIntegGainSamplingTime, factor);
+    scaled->gains.currentDAntiWindupGainSamplingTime =
+        Ifx_MS_FocSolutionF16_scaleLoopGain(gains->currentDAntiWindupGainSamplingTime, factor);
+    scaled->gains.currentQIntegGainSamplingTime      =
+        Ifx_MS_FocSolutionF16_scaleLoopGain(gains->currentQIntegGainSamplingTime, factor);
+    scaled->gains.currentQAntiWindupGainSamplingTime =
+        Ifx_MS_FocSolutionF16_scaleLoopGain(gains->currentQAntiWindupGainSamplingTime, factor);
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /* The voltage command is applied one fast loop after its calculation and held for one fast loop, the middle of
+     * this interval moves by 1.5 PWM periods per PWM period of the fast loop */
+    scaled->gains.delayCompensationTime_us = (uint32)((sint32)gains->delayCompensationTime_us
+        + ((((sint32)factor - (sint32)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR) * 3
+            * (sint32)gains->samplingTime_us) / (2 * (sint32)IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR)));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+
+    /* Open loop angle increments */
+    scaled->gains.iToFAngleIncrementQ14 = Ifx_MS_FocSolutionF16_scaleLoopGain(gains->iToFAngleIncrementQ14, factor);
+    scaled->gains.vToFAngleIncrementQ14 = Ifx_MS_FocSolutionF16_scaleLoopGain(gains->vToFAngleIncrementQ14, factor);
+
+    /* Complete, the request can follow */
+    scaled->factor = factor;
+}
+
+
+static void Ifx_MS_FocSolutionF16_updateCurrentLoopFactor(Ifx_MS_FocSolutionF16* self)
+{
+    const Ifx_MS_FocSolutionF16_ScaledLoopGains* scaled = &(self->p_scaledLoopGains);
+
+    /* Flux estimator filters and PLL, the rate held by the PLL moves to the new sampling time */
+    Ifx_MDA_FluxEstimatorF16_setParameters(&(self->fluxEstimator), &(scaled->fluxEstimator), scaled->rateRatioQ16);
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_setSamplingTimeCoeffs(&(self->slidingModeObserver), &(scaled->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* Deadbeat current controller */
+    Ifx_MDA_FocControllerF16_setDeadbeatCoeffs(&(self->focController), &(scaled->deadbeat));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+
+    /* Current PI controllers */
+    Ifx_Math_PiF16_setIntegGainSamplingTime(&(self->focController.currentDPi),
+        scaled->gains.currentDIntegGainSamplingTime);
+    Ifx_Math_PiF16_setAntiWindupGainSamplingTime(&(self->focController.currentDPi),
+        scaled->gains.currentDAntiWindupGainSamplingTime);
+    Ifx_Math_PiF16_setIntegGainSamplingTime(&(self->focController.currentQPi),
+        scaled->gains.currentQIntegGainSamplingTime);
+    Ifx_Math_PiF16_setAntiWindupGainSamplingTime(&(self->focController.currentQPi),
+        scaled->gains.currentQAntiWindupGainSamplingTime);
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+    Ifx_MDA_FocControllerF16_setDelayCompensationTime_us(&(self->focController),
+        scaled->gains.delayCompensationTime_us);
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+
+    /* Open loop angle increments */
+    Ifx_MDA_IToFControllerF16_setAngleIncrement(&(self->iToF), scaled->gains.iToFAngleIncrementQ14);
+    Ifx_MDA_VToFControllerF16_setAngleIncrement(&(self->vToF), scaled->gains.vToFAngleIncrementQ14);
+
+    self->p_currentLoopFactor = scaled->factor;
+}
+
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+void Ifx_MS_FocSolutionF16_resetProfiler(Ifx_MS_FocSolutionF16* self)
+{
+    uint8 stage;
+    uint8 bin;
+
+    for (stage = 0u; stage < (uint8)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+    {
+        /* Minimum starts at the largest value, so that the first execution replaces it */
+        self->p_profilerStatistics[stage].min   = 0xFFFFFFFFu;
+        self->p_profilerStatistics[stage].max   = 0u;
+        self->p_profilerStatistics[stage].count = 0u;
+        self->p_profilerStatistics[stage].sum   = 0u;
+
+        for (bin = 0u; bin < IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS; bin++)
+        {
+            self->p_profilerStatistics[stage].histogram[bin] = 0u;
+        }
+    }
+}
+
+
+static inline void Ifx_MS_FocSolutionF16_updateProfiler(Ifx_MS_FocSolutionF16* self, const uint32* timestamps)
+{
+    uint8 stage;
+
+    for (stage = 0u; stage < (uint8)Ifx_MS_FocSolutionF16_ProfilerStage_count; stage++)
+    {
+        Ifx_MS_FocSolutionF16_ProfilerStatistics* statistics = &(self->p_profilerStatistics[stage]);
+        uint32                                    duration;
+        uint32                                    bin;
+
+        /* Unsigned subtraction is correct across a wrap around of the timestamp */
+        if (stage == (uint8)Ifx_MS_FocSolutionF16_ProfilerStage_total)
+        {
+            duration = timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_total]
+                       - timestamps[Ifx_MS_FocSolutionF16_ProfilerStage_measureAndReconstruct];
+        }
+        else
+        {
+            duration = timestamps[stage + 1u] - timestamps[stage];
+        }
+
+        if (duration < statistics->min)
+        {
+            statistics->min = duration;
+        }
+
+        if (duration > statistics->max)
+        {
+            statistics->max = duration;
+        }
+
+        statistics->count++;
+        statistics->sum += duration;
+
+        /* Executions longer than the histogram range are counted in the last bin */
+        bin = duration >> IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT;
+
+        if (bin >= IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS)
+        {
+            bin = IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS - 1u;
+        }
+
+        if (statistics->histogram[bin] < 0xFFFFu)
+        {
+            statistics->histogram[bin]++;
+        }
+    }
+}
+
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+void Ifx_MS_FocSolutionF16_getParameters(Ifx_MS_FocSolutionF16* self, Ifx_MS_FocSolutionF16_Parameters* parameters)
+{
+    /* Flux estimator parameters and coefficients */
+    Ifx_MDA_FluxEstimatorF16_getParameters(&(self->fluxEstimator), &(parameters->fluxEstimator));
+
+    /* PI controllers */
+    Ifx_MS_FocSolutionF16_getPiParameters(&(self->speedPi), &(parameters->speedPi));
+    Ifx_MS_FocSolutionF16_getPiParameters(&(self->focController.currentDPi), &(parameters->currentDPi));
+    Ifx_MS_FocSolutionF16_getPiParameters(&(self->focController.currentQPi), &(parameters->currentQPi));
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+    Ifx_MDA_FocControllerF16_getDeadbeatCoeffs(&(self->focController), &(parameters->deadbeat));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /* Sliding mode observer coefficients */
+    Ifx_MDA_SlidingModeObserverF16_getSamplingTimeCoeffs(&(self->slidingModeObserver),
+        &(parameters->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+
+    /* Modulator */
+    parameters->deadTime_tick        = Ifx_MAS_ModulatorF16_getDeadTime_tick(&(self->modulator));
+    parameters->driverDelay_tick     = Ifx_MAS_ModulatorF16_getDriverDelay_tick(&(self->modulator));
+    parameters->ringingTime_tick     = Ifx_MAS_ModulatorF16_getRingingTime_tick(&(self->modulator));
+    parameters->measurementTime_tick = Ifx_MAS_ModulatorF16_getMeasurementTime_tick(&(self->modulator));
+    parameters->maxAmplitudeQ15      = Ifx_MAS_ModulatorF16_getMaxAmplitude(&(self->modulator));
+
+    /* Offset of the current sense amplifier */
+    parameters->currentOffset = Ifx_MHA_MeasurementADC_TLE987_getOffset(&(self->measurementADCTLE987));
+}
+
+
+const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_findParameterBlock(void)
+{
+    /* Newest block with a valid header */
+    const Ifx_MS_FocSolutionF16_ParameterBlock* block = Ifx_MS_FocSolutionF16_findNewestBlock(false, 0u);
+    uint8                                       attempt;
+
+    /* Fall back to the next older block while the CRC fails, at most once per page */
+    for (attempt = 0u; (attempt < (uint8)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES) && (block != NULL_PTR);
+         attempt++)
+    {
+        if (Ifx_MS_FocSolutionF16_calcParameterBlockCrc(block) == block->crc)
+        {
+            break;
+        }
+
+        block = Ifx_MS_FocSolutionF16_findNewestBlock(true, block->sequence);
+    }
+
+    return block;
 }
 
 
+bool Ifx_MS_FocSolutionF16_storeParameters(Ifx_MS_FocSolutionF16* self)
+{
+    /* Page image, the unused bytes and the padding are programmed as 0 */
+    union
+    {
+        Ifx_MS_FocSolutionF16_ParameterBlock block;
+        uint8                                bytes[FlashPageSize];
+    } page;
+
+    /* Newest valid block, the new one is written to the following page */
+    const Ifx_MS_FocSolutionF16_ParameterBlock* newest;
+    uint32                                      pageIndex = 0u;
+    uint8                                       i;
+    bool                                        programmed = false;
+
+    /* ProgramPage() blocks the interrupts for the whole page program, only allowed with the power stage off */
+    if ((self->p_status.state == Ifx_MS_FocSolutionF16_State_init)
+        || (self->p_status.state == Ifx_MS_FocSolutionF16_State_off)
+        || (self->p_status.state == Ifx_MS_FocSolutionF16_State_standBy)
+        || (self->p_status.state == Ifx_MS_FocSolutionF16_State_fault))
+    {
+        newest = Ifx_MS_FocSolutionF16_findParameterBlock();
+
+        for (i = 0u; i < (uint8)FlashPageSize; i++)
+        {
+            page.bytes[i] = 0u;
+        }
+
+        page.block.magic    = IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_MAGIC;
+        page.block.version  = IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_VERSION;
+        page.block.sequence = 0u;
+
+        if (newest != NULL_PTR)
+        {
+            /* Page index of the newest block, the pages are FlashPageSize apart */
+            for (i = 0u; i < (uint8)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES; i++)
+            {
+                if (Ifx_MS_FocSolutionF16_getParameterPage(i) == newest)
+                {
+                    pageIndex = ((uint32)i + 1u) % (uint32)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES;
+                }
+            }
+
+            page.block.sequence = newest->sequence + 1u;
+        }
+
+        Ifx_MS_FocSolutionF16_getParameters(self, &(page.block.parameters));
+        page.block.crc = Ifx_MS_FocSolutionF16_calcParameterBlockCrc(&(page.block));
+
+        /* Program the page, a failing page is erased */
+        programmed = ProgramPage(IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_START + (pageIndex * FlashPageSize), page.bytes,
+            0u, 1u, 1u) == 0u;
+    }
+
+    return programmed;
+}
+
+
+static inline void Ifx_MS_FocSolutionF16_initModulesParameters(Ifx_MS_FocSolutionF16* self, const
+                                                               Ifx_MS_FocSolutionF16_Parameters* parameters)
+{
+    /* Initialize hardware abstraction modules */
+    Ifx_MHA_MeasurementADC_TLE987_init(&(self->measurementADCTLE987));
+    Ifx_MHA_BridgeDrv_TLE987_init(&(self->bridgeDrvTLE987));
+    Ifx_MHA_PatternGen_TLE987_init(&(self->patternGenTLE987));
+
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* Seed the offset of the current sense amplifier, so the first enable skips the calibration */
+    if (parameters->currentOffset != 0u)
+    {
+        Ifx_MHA_MeasurementADC_TLE987_setOffset(&(self->measurementADCTLE987), parameters->currentOffset);
+    }
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
+    /* Initialize modulator with the stored timings */
+    Ifx_MAS_ModulatorF16_init(&(self->modulator));
+    Ifx_MAS_ModulatorF16_setDeadTime_tick(&(self->modulator), parameters->deadTime_tick);
+    Ifx_MAS_ModulatorF16_setDriverDelay_tick(&(self->modulator), parameters->driverDelay_tick);
+    Ifx_MAS_ModulatorF16_setRingingTime_tick(&(self->modulator), parameters->ringingTime_tick);
+    Ifx_MAS_ModulatorF16_setMeasurementTime_tick(&(self->modulator), parameters->measurementTime_tick);
+    Ifx_MAS_ModulatorF16_setMaxAmplitude(&(self->modulator), parameters->maxAmplitudeQ15);
+
+    /* Initialize drive algorithm modules, the flux estimator with the stored coefficients */
+    Ifx_MDA_FluxEstimatorF16_initParameters(&(self->fluxEstimator), &(parameters->fluxEstimator));
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /* Sliding mode observer with the stored coefficients */
+    Ifx_MDA_SlidingModeObserverF16_initSamplingTimeCoeffs(&(self->slidingModeObserver),
+        &(parameters->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+    Ifx_MDA_IToFControllerF16_init(&(self->iToF));
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* FOC controller with the stored deadbeat gains */
+    Ifx_MDA_FocControllerF16_initDeadbeatCoeffs(&(self->focController), &(parameters->deadbeat));
+#else
+    Ifx_MDA_FocControllerF16_init(&(self->focController));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+    Ifx_MS_FocSolutionF16_setPiParameters(&(self->focController.currentDPi), &(parameters->currentDPi));
+    Ifx_MS_FocSolutionF16_setPiParameters(&(self->focController.currentQPi), &(parameters->currentQPi));
+    Ifx_MDA_VToFControllerF16_init(&(self->vToF));
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_INCLUDE_STARTANGLE_IDENT == 1
+    Ifx_MDA_StartAngleIdentF16_init(&(self->startAngleIdent));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_INCLUDE_STARTANGLE_IDENT == 1 */
+
+    /* Init speed precontrol */
+    Ifx_MS_FocSolutionF16_initSpeedPreControl(self);
+
+    /* Init reference current limiter */
+    Ifx_MS_FocSolutionF16_initRefCurrentLimiter(self);
+
+    /* Initialize speed PI controller with the stored gains */
+    Ifx_MS_FocSolutionF16_initSpeedPi(self);
+    Ifx_MS_FocSolutionF16_setPiParameters(&(self->speedPi), &(parameters->speedPi));
+}
+
+
+static inline void Ifx_MS_FocSolutionF16_setPiParameters(Ifx_Math_PiF16* pi, const
+                                                         Ifx_MS_FocSolutionF16_PiParameters* parameters)
+{
+    Ifx_Math_PiF16_setPropGain(pi, parameters->propGain);
+    Ifx_Math_PiF16_setIntegGainSamplingTime(pi, parameters->integGainSamplingTime);
+    Ifx_Math_PiF16_setAntiWindupGainSamplingTime(pi, parameters->antiWindupGainSamplingTime);
+    Ifx_Math_PiF16_setUpperLimit(pi, parameters->upperLimit);
+    Ifx_Math_PiF16_setLowerLimit(pi, parameters->lowerLimit);
+}
+
+
+static inline void Ifx_MS_FocSolutionF16_getPiParameters(Ifx_Math_PiF16* pi, Ifx_MS_FocSolutionF16_PiParameters*
+                                                         parameters)
+{
+    parameters->propGain                   = Ifx_Math_PiF16_getPropGain(pi);
+    parameters->integGainSamplingTime      = Ifx_Math_PiF16_getIntegGainSamplingTime(pi);
+    parameters->antiWindupGainSamplingTime = Ifx_Math_PiF16_getAntiWindupGainSamplingTime(pi);
+    parameters->upperLimit                 = Ifx_Math_PiF16_getUpperLimit(pi);
+    parameters->lowerLimit                 = Ifx_Math_PiF16_getLowerLimit(pi);
+}
+
+
+static inline const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_getParameterPage(uint8 page)
+{
+    /* polyspace +2 MISRA2012:11.4 [Justified:Low] "The parameter block is read from its data flash address." */
+    return (const Ifx_MS_FocSolutionF16_ParameterBlock*)(IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_START +
+                                                         ((uint32)page * FlashPageSize));
+}
+
+
+/* Newest block with the right identifier and version, if olderOnly only among the blocks older than sequence. The
+ * sequence numbers are compared modulo 2^16, they are at most IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES apart. */
+static inline const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_findNewestBlock(bool olderOnly,
+                                                                                                uint16 sequence)
+{
+    const Ifx_MS_FocSolutionF16_ParameterBlock* newest = NULL_PTR;
+    uint8                                       page;
+
+    for (page = 0u; page < (uint8)IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES; page++)
+    {
+        const Ifx_MS_FocSolutionF16_ParameterBlock* block = Ifx_MS_FocSolutionF16_getParameterPage(page);
+
+        if ((block->magic == IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_MAGIC) &&
+            (block->version == IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_VERSION) &&
+            ((olderOnly == false) || ((sint16)(uint16)(sequence - block->sequence) > 0)) &&
+            ((newest == NULL_PTR) || ((sint16)(uint16)(block->sequence - newest->sequence) > 0)))
+        {
+            newest = block;
+        }
+    }
+
+    return newest;
+}
+
+
+static uint16 Ifx_MS_FocSolutionF16_calcParameterBlockCrc(const Ifx_MS_FocSolutionF16_ParameterBlock* block)
+{
+    /* CRC from the version to the end of the parameters */
+    const uint8* bytes = (const uint8*)&(block->version);
+    uint16       crc   = IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_CRC_INIT;
+    uint32       i;
+
+    for (i = 0u; i < IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_CRC_SIZE; i++)
+    {
+        crc = (uint16)(crc << 4u) ^ Ifx_MS_FocSolutionF16_crcTable[(uint8)(crc >> 12u) ^ (uint8)(bytes[i] >> 4u)];
+        crc = (uint16)(crc << 4u) ^ Ifx_MS_FocSolutionF16_crcTable[(uint8)(crc >> 12u) ^ (uint8)(bytes[i] & 0x0Fu)];
+    }
+
+    return crc;
+}
+
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
+
+
 static inline void Ifx_MS_FocSolutionF16_rotateDQRefSystem(Ifx_MS_FocSolutionF16* self)
 {
     /* Add 180deg. to the I2f angle */
@@ -494,6 +1136,11 @@ static inline void Ifx_MS_FocSolutionF16_rotateDQRefSystem(Ifx_MS_FocSolutionF16
     /* Reset current PIs with negative of previous value */
     Ifx_Math_PiF16_setIntegPreviousValue(&(self->focController.currentDPi), Ifx_Math_Neg_F16(currentDPiPrevValue));
     Ifx_Math_PiF16_setIntegPreviousValue(&(self->focController.currentQPi), Ifx_Math_Neg_F16(currentQPiPrevValue));
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /* Rotate the states of the deadbeat current controller with the reference system */
+    Ifx_MDA_FocControllerF16_rotateDeadbeat(&(self->focController));
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
 }
 
 
@@ -575,16 +1222,33 @@ static inline Ifx_MHA_MeasurementADC_TLE987_Output Ifx_MS_FocSolutionF16_measure
     Ifx_MHA_MeasurementADC_TLE987_execute(&(self->measurementADCTLE987));
     Ifx_MHA_MeasurementADC_TLE987_getOutput(&(self->measurementADCTLE987), &measurementADCOutput);
 
-    /* Current reconstruction */
-    self->currentsUVW = Ifx_Math_CurrentReconstruction_F16(self->previousCurrentReconstructionInfo,
-        measurementADCOutput.shuntCurrentsQ15);
+    /* Current reconstruction, skipped if a measurement window of the previous cycle was too short */
+    if (self->previousCurrentReconstructionInfo.measurementValid == true)
+    {
+        self->currentsUVW = Ifx_Math_CurrentReconstruction_F16(self->previousCurrentReconstructionInfo,
+            measurementADCOutput.shuntCurrentsQ15);
+
+        /* Current Clark transformation (UVW to alpha-beta) */
+        self->currentsAlphaBeta = Ifx_Math_Clarke_F16(self->currentsUVW);
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+        /* Keep the currents in the rotating frame for the cycles without measurement */
+        self->heldCurrentsDQ = Ifx_Math_Park_F16(self->currentsAlphaBeta, self->angle);
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
+    }
+
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+    else
+    {
+        /* The currents of the last measurement turn on with the angle */
+        self->currentsAlphaBeta = Ifx_Math_InvPark_F16(self->heldCurrentsDQ, self->angle);
+    }
+
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
 
     /* Update current reconstruction information for the next state */
     self->previousCurrentReconstructionInfo = self->p_currentReconstructionInfo;
 
-    /* Current Clark transformation (UVW to alpha-beta) */
-    self->currentsAlphaBeta = Ifx_Math_Clarke_F16(self->currentsUVW);
-
     /* Return the measured DC link voltage */
     return measurementADCOutput;
 }
@@ -592,15 +1256,23 @@ static inline Ifx_MHA_MeasurementADC_TLE987_Output Ifx_MS_FocSolutionF16_measure
 
 static inline uint32 Ifx_MS_FocSolutionF16_fluxEstimation(Ifx_MS_FocSolutionF16* self)
 {
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /* Sliding mode observer */
+    Ifx_MDA_SlidingModeObserverF16_execute(&(self->slidingModeObserver), self->previousVoltageAlphaBeta,
+        self->currentsAlphaBeta);
+#else
+
     /* Flux estimator */
     Ifx_MDA_FluxEstimatorF16_execute(&(self->fluxEstimator), self->previousVoltageAlphaBeta, self->currentsAlphaBeta);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
 
     /* Store voltage for next cycle */
     self->previousVoltageAlphaBeta = self->voltageAlphaBeta;
 
     /* Assign estimated speed output */
     Ifx_MDA_FluxEstimatorF16_Output fluxEstimatorOutput;
-    Ifx_MDA_FluxEstimatorF16_getOutput(&(self->fluxEstimator), &fluxEstimatorOutput);
+    Ifx_MS_FocSolutionF16_getAngleObserverOutput(self, &fluxEstimatorOutput);
     self->p_output.estimatedSpeedQ15 = fluxEstimatorOutput.speedQ15;
 
     /* Return estimated angle */
@@ -608,6 +1280,28 @@ static inline uint32 Ifx_MS_FocSolutionF16_fluxEstimation(Ifx_MS_FocSolutionF16*
 }
 
 
+static inline void Ifx_MS_FocSolutionF16_configAngleObserverMode(Ifx_MS_FocSolutionF16* self,
+                                                                 Ifx_MDA_FluxEstimatorF16_Mode mode)
+{
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_configMode(&(self->slidingModeObserver), mode);
+#else
+    Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), mode);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+}
+
+
+static inline void Ifx_MS_FocSolutionF16_getAngleObserverOutput(Ifx_MS_FocSolutionF16* self,
+                                                                Ifx_MDA_FluxEstimatorF16_Output* output)
+{
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_getOutput(&(self->slidingModeObserver), output);
+#else
+    Ifx_MDA_FluxEstimatorF16_getOutput(&(self->fluxEstimator), output);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+}
+
+
 /* Execute the fast loop operations with IToF and FOC */
 static inline Ifx_Math_PolarFract16 Ifx_MS_FocSolutionF16_regulationLoop(Ifx_MS_FocSolutionF16* self, uint32
                                                                          estimatedAngle, Ifx_Math_Fract16
@@ -787,6 +1481,9 @@ static inline void Ifx_MS_FocSolutionF16_initRefCurrentLimiter(Ifx_MS_FocSolutio
 static inline void Ifx_MS_FocSolutionF16_initDriveAlgo(Ifx_MS_FocSolutionF16* self)
 {
     Ifx_MDA_FluxEstimatorF16_init(&(self->fluxEstimator));
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_init(&(self->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
     Ifx_MDA_IToFControllerF16_init(&(self->iToF));
     Ifx_MDA_FocControllerF16_init(&(self->focController));
     Ifx_MDA_VToFControllerF16_init(&(self->vToF));
@@ -1108,6 +1805,13 @@ static inline void Ifx_MS_FocSolutionF16_stateMachine(Ifx_MS_FocSolutionF16* sel
             break;
     }
 
+#if IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING == 1
+
+    /* Refine the current offset in standby only: zero voltage command at standstill, no current through the shunt */
+    Ifx_MHA_MeasurementADC_TLE987_enableOffsetTracking(&(self->measurementADCTLE987),
+        (nextState == Ifx_MS_FocSolutionF16_State_standBy));
+#endif /* IFX_MHA_MEASUREMENTADC_CFG_ENABLE_OFFSET_TRACKING */
+
     self->p_status.state = nextState;
 }
 
@@ -1219,7 +1923,7 @@ static inline Ifx_MS_FocSolutionF16_State Ifx_MS_FocSolutionF16_stateStandby(Ifx
         self->p_status.subState = Ifx_MS_FocSolutionF16_SubState_openLoop;
 
         /* Enable flux estimator */
-        Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), Ifx_MDA_FluxEstimatorF16_Mode_enable);
+        Ifx_MS_FocSolutionF16_configAngleObserverMode(self, Ifx_MDA_FluxEstimatorF16_Mode_enable);
 
         /* Go to run state */
         nextState = Ifx_MS_FocSolutionF16_State_run;
@@ -1249,7 +1953,7 @@ static inline Ifx_MS_FocSolutionF16_State Ifx_MS_FocSolutionF16_stateRun(Ifx_MS_
     if (faultStatus == true)
     {
         /* Disable flux estimator */
-        Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), Ifx_MDA_FluxEstimatorF16_Mode_disable);
+        Ifx_MS_FocSolutionF16_configAngleObserverMode(self, Ifx_MDA_FluxEstimatorF16_Mode_disable);
 
         /* Set the module to fault */
         nextState = Ifx_MS_FocSolutionF16_State_fault;
@@ -1539,7 +2243,7 @@ static inline sint32 Ifx_MS_FocSolutionF16_angleError(Ifx_MS_FocSolutionF16* sel
 {
     /* Get flux estimator output */
     Ifx_MDA_FluxEstimatorF16_Output fluxEstimatorOutput;
-    Ifx_MDA_FluxEstimatorF16_getOutput(&(self->fluxEstimator), &fluxEstimatorOutput);
+    Ifx_MS_FocSolutionF16_getAngleObserverOutput(self, &fluxEstimatorOutput);
 
     /* I2f angle in uin16 */
     uint16                          refAngle = (uint16)(iToFOutput.currentVecAngle_rad >> 16);
@@ -1635,7 +2339,7 @@ static inline Ifx_MS_FocSolutionF16_SubState Ifx_MS_FocSolutionF16_subStateClose
 
     /* Get flux estimator output */
     Ifx_MDA_FluxEstimatorF16_Output fluxEstimator;
-    Ifx_MDA_FluxEstimatorF16_getOutput(&(self->fluxEstimator), &fluxEstimator);
+    Ifx_MS_FocSolutionF16_getAngleObserverOutput(self, &fluxEstimator);
 
     /* Reset the iToF previous angle to last flux estimator angle */
     Ifx_MDA_IToFControllerF16_setAnglePreviousValue(&(self->iToF), fluxEstimator.anglePLL);
@@ -1822,7 +2526,7 @@ static inline Ifx_MS_FocSolutionF16_State Ifx_MS_FocSolutionF16_stateRampDown(If
     if (faultStatus == true)
     {
         /* Disable flux estimator */
-        Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), Ifx_MDA_FluxEstimatorF16_Mode_disable);
+        Ifx_MS_FocSolutionF16_configAngleObserverMode(self, Ifx_MDA_FluxEstimatorF16_Mode_disable);
 
         /* Go into fault state */
         nextState = Ifx_MS_FocSolutionF16_State_fault;
@@ -1830,7 +2534,7 @@ static inline Ifx_MS_FocSolutionF16_State Ifx_MS_FocSolutionF16_stateRampDown(If
     else if (Ifx_Math_Abs_F16(self->rateLimitInSpeedQ15) <= IFX_MS_FOCSOLUTIONF16_CFG_MIN_SPEED_THRESHOLD_Q15)
     {
         /* Disable flux estimator */
-        Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), Ifx_MDA_FluxEstimatorF16_Mode_disable);
+        Ifx_MS_FocSolutionF16_configAngleObserverMode(self, Ifx_MDA_FluxEstimatorF16_Mode_disable);
         nextState = Ifx_MS_FocSolutionF16_State_standBy;
     }
     else
@@ -1970,7 +2674,7 @@ static inline Ifx_MS_FocSolutionF16_State Ifx_MS_FocSolutionF16_stateStartAngleI
             self->p_status.subState = Ifx_MS_FocSolutionF16_SubState_openLoop;
 
             /* Enable flux estimator */
-            Ifx_MDA_FluxEstimatorF16_configMode(&(self->fluxEstimator), Ifx_MDA_FluxEstimatorF16_Mode_enable);
+            Ifx_MS_FocSolutionF16_configAngleObserverMode(self, Ifx_MDA_FluxEstimatorF16_Mode_enable);
 
             /* If estimation is done and speed control is enabled, store estimated angle and go to run */
             nextState = Ifx_MS_FocSolutionF16_State_run;
@@ -2021,6 +2725,9 @@ static void Ifx_MS_FocSolutionF16_reset(Ifx_MS_FocSolutionF16* self)
     Ifx_Math_LowPass1stF16_setPreviousValue(&(self->fluxEstimator.p_speedFilter), 0);
     Ifx_Math_PLLF16_resetBuffer(&self->fluxEstimator.p_pllFilter);
     Ifx_Math_PLLF16_setPreviousValue(&self->fluxEstimator.p_pllFilter, 0);
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+    Ifx_MDA_SlidingModeObserverF16_reset(&(self->slidingModeObserver));
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
 
     /* PI controller */
     Ifx_Math_PiF16_setIntegPreviousValue(&(self->speedPi), 0);
@@ -2036,9 +2743,14 @@ static void Ifx_MS_FocSolutionF16_reset(Ifx_MS_FocSolutionF16* self)
     /* Set the initial startup current to the statically configured value */
     self->dqCommand.imag = IFX_MS_FOCSOLUTIONF16_CFG_INIT_START_UP_CURRENT_Q15;
 
-    /* Speed and sector number */
-    self->rateLimitInSpeedQ15                      = 0;
-    self->previousCurrentReconstructionInfo.sector = 0;
+    /* Speed, sector number and measurement windows */
+    self->rateLimitInSpeedQ15                                = 0;
+    self->previousCurrentReconstructionInfo.sector           = 0;
+    self->previousCurrentReconstructionInfo.measurementValid = true;
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+    self->heldCurrentsDQ.real                                = 0;
+    self->heldCurrentsDQ.imag                                = 0;
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
 }
 
 
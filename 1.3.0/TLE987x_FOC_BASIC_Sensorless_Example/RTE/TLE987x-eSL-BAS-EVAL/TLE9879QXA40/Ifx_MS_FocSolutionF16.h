@@ -23,6 +23,8 @@
 #include "Ifx_MDA_FocControllerF16.h"
 #include "Ifx_MDA_IToFControllerF16.h"
 
+#include "Ifx_MDA_SlidingModeObserverF16.h"
+
 #include "Ifx_MDA_StartAngleIdentF16.h"
 
 #include "Ifx_MDA_VToFControllerF16.h"
@@ -46,6 +48,31 @@
 
 #include "Ifx_Math_SpeedPreControlF16.h"
 
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR != IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR
+#error "IFX_MHA_PATTERNGEN_CFG_ENABLE_RUNTIME_LOOP_FACTOR has to match the one of the FOC solution"
+#endif
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+/* Permanent magnet flux in Q15 from the inverse torque constant, the normalized torque is 1.5 * flux * current */
+#define IFX_MS_FOCSOLUTIONF16_FLUX_Q15                                                  \
+    ((2147483648 + ((3 * IFX_MS_FOCSOLUTIONF16_CFG_INVERSE_TORQUE_CONSTANT_Q15) / 2)) / \
+     (3 * IFX_MS_FOCSOLUTIONF16_CFG_INVERSE_TORQUE_CONSTANT_Q15))
+
+#if IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 != IFX_MDA_FLUXESTIMATORF16_CFG_PHASE_RES_Q15
+#error "IFX_MDA_FOCCONTROLLERF16_CFG_RESISTANCE_Q15 has to match the phase resistance of the flux estimator"
+#endif
+#if IFX_MDA_FOCCONTROLLERF16_CFG_FLUX_Q15 != IFX_MS_FOCSOLUTIONF16_FLUX_Q15
+#error "IFX_MDA_FOCCONTROLLERF16_CFG_FLUX_Q15 has to match the inverse torque constant of the FOC solution"
+#endif
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+/**
+ * Largest factor accepted by Ifx_MS_FocSolutionF16_setCurrentLoopFactor()
+ */
+#define IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX (16U)
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
+
 /**
  * Base mechanical speed, in rpm
  * <table>
@@ -263,6 +290,285 @@ typedef struct Ifx_MS_FocSolutionF16_Status
     Ifx_MS_FocSolutionF16_ControlMode actualControlMode;
 } Ifx_MS_FocSolutionF16_Status;
 
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+
+/**
+ * Number of histogram bins per profiled stage. Bin i counts the executions with a duration in
+ * [i, i + 1) * 2^IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_BIN_SHIFT timestamp ticks, the last bin also counts all longer
+ * executions.
+ */
+#define IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS (16U)
+
+/**
+ * Stages of Ifx_MS_FocSolutionF16_executeControlMode() measured by the profiler
+ */
+typedef enum Ifx_MS_FocSolutionF16_ProfilerStage
+{
+    Ifx_MS_FocSolutionF16_ProfilerStage_measureAndReconstruct = 0, /**<Measurement and current reconstruction*/
+    Ifx_MS_FocSolutionF16_ProfilerStage_fluxEstimation        = 1, /**<Angle and speed estimation*/
+    Ifx_MS_FocSolutionF16_ProfilerStage_regulation            = 2, /**<FOC or V/f loop, start angle identification*/
+    Ifx_MS_FocSolutionF16_ProfilerStage_voltageGeneration     = 3, /**<Modulator and pattern generator*/
+    Ifx_MS_FocSolutionF16_ProfilerStage_total                 = 4, /**<Complete fast loop*/
+    Ifx_MS_FocSolutionF16_ProfilerStage_count                 = 5  /**<Number of profiled stages*/
+} Ifx_MS_FocSolutionF16_ProfilerStage;
+
+/**
+ * Execution time statistics of one profiled stage, in ticks of IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP()
+ */
+typedef struct Ifx_MS_FocSolutionF16_ProfilerStatistics
+{
+    /**
+     * Shortest execution time
+     */
+    uint32 min;
+
+    /**
+     * Longest execution time
+     */
+    uint32 max;
+
+    /**
+     * Number of measured executions
+     */
+    uint32 count;
+
+    /**
+     * Sum of all measured execution times
+     */
+    uint64 sum;
+
+    /**
+     * Histogram of the execution times, each bin saturates at 0xFFFF
+     */
+    uint16 histogram[IFX_MS_FOCSOLUTIONF16_PROFILER_HISTOGRAM_BINS];
+} Ifx_MS_FocSolutionF16_ProfilerStatistics;
+
+/**
+ * Free running, up counting timestamp provided by the application. Differences of two timestamps are evaluated modulo
+ * 2^32, so the counter may wrap around.
+ */
+uint32 IFX_MS_FOCSOLUTIONF16_CFG_PROFILER_TIMESTAMP(void);
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+/**
+ * Identifier of a programmed parameter block page
+ */
+#define IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_MAGIC (0xF0C5U)
+
+/**
+ * Version of the parameter block, in the upper byte, and size of the parameters, in the lower byte. A block written by
+ * a software with another layout of Ifx_MS_FocSolutionF16_Parameters is not loaded.
+ */
+#define IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_VERSION \
+    ((uint16)((1U << 8U) | ((uint16)sizeof(Ifx_MS_FocSolutionF16_Parameters) & 0xFFU)))
+
+/**
+ * Gains and limits of a PI controller in the parameter block, in the Q formats configured in Config Wizard
+ */
+typedef struct Ifx_MS_FocSolutionF16_PiParameters
+{
+    /**
+     * Proportional gain
+     */
+    Ifx_Math_Fract16 propGain;
+
+    /**
+     * Integral gain multiplied by the sampling time
+     */
+    Ifx_Math_Fract16 integGainSamplingTime;
+
+    /**
+     * Anti windup gain multiplied by the sampling time
+     */
+    Ifx_Math_Fract16 antiWindupGainSamplingTime;
+
+    /**
+     * Upper and lower limit of the output
+     */
+    Ifx_Math_Fract16 upperLimit;
+    Ifx_Math_Fract16 lowerLimit;
+} Ifx_MS_FocSolutionF16_PiParameters;
+
+/**
+ * Calibration and tuning parameters of the FOC solution, stored in data flash by
+ * Ifx_MS_FocSolutionF16_storeParameters() and loaded by Ifx_MS_FocSolutionF16_init(). The values which are calculated
+ * at the initialization, e.g. the coefficients of the filters of the Flux Estimator, are stored as calculated.
+ */
+typedef struct Ifx_MS_FocSolutionF16_Parameters
+{
+    /**
+     * Flux Estimator parameters and coefficients
+     */
+    Ifx_MDA_FluxEstimatorF16_Parameters fluxEstimator;
+
+    /**
+     * Speed PI controller
+     */
+    Ifx_MS_FocSolutionF16_PiParameters speedPi;
+
+    /**
+     * D and Q current PI controllers of the FOC controller
+     */
+    Ifx_MS_FocSolutionF16_PiParameters currentDPi;
+    Ifx_MS_FocSolutionF16_PiParameters currentQPi;
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /**
+     * Gains and carry-over of the deadbeat controller of the FOC controller
+     */
+    Ifx_MDA_FocControllerF16_DeadbeatCoeffs deadbeat;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /**
+     * Sliding mode observer coefficients which depend on the sampling time
+     */
+    Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs slidingModeObserver;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+
+    /**
+     * Modulator dead time, driver delay, ringing time and measurement time, in ticks
+     */
+    uint16 deadTime_tick;
+    uint16 driverDelay_tick;
+    uint16 ringingTime_tick;
+    uint16 measurementTime_tick;
+
+    /**
+     * Modulator maximum amplitude, in Q15
+     */
+    Ifx_Math_Fract16 maxAmplitudeQ15;
+
+    /**
+     * Offset of the current sense amplifier, ADC result at zero shunt current, 0 if not calibrated
+     */
+    uint16 currentOffset;
+} Ifx_MS_FocSolutionF16_Parameters;
+
+/**
+ * Parameter block as stored in one data flash page
+ */
+typedef struct Ifx_MS_FocSolutionF16_ParameterBlock
+{
+    /**
+     * IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_MAGIC
+     */
+    uint16 magic;
+
+    /**
+     * CRC-16/CCITT of the block from version to the end of the parameters
+     */
+    uint16 crc;
+
+    /**
+     * IFX_MS_FOCSOLUTIONF16_PARAMETER_BLOCK_VERSION
+     */
+    uint16 version;
+
+    /**
+     * Incremented by every write, the block with the highest sequence number is the newest one
+     */
+    uint16 sequence;
+
+    /**
+     * Stored parameters
+     */
+    Ifx_MS_FocSolutionF16_Parameters parameters;
+} Ifx_MS_FocSolutionF16_ParameterBlock;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+/**
+ * \brief Gains of the fast loop which depend on its sampling time, at IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR
+ */
+typedef struct Ifx_MS_FocSolutionF16_LoopGains
+{
+    /**
+     * Sampling time of the flux estimator, in microseconds
+     */
+    uint32 samplingTime_us;
+
+    /**
+     * Integral gain * sampling time of the d current PI controller
+     */
+    Ifx_Math_Fract16 currentDIntegGainSamplingTime;
+
+    /**
+     * Anti-windup gain * sampling time of the d current PI controller
+     */
+    Ifx_Math_Fract16 currentDAntiWindupGainSamplingTime;
+
+    /**
+     * Integral gain * sampling time of the q current PI controller
+     */
+    Ifx_Math_Fract16 currentQIntegGainSamplingTime;
+
+    /**
+     * Anti-windup gain * sampling time of the q current PI controller
+     */
+    Ifx_Math_Fract16 currentQAntiWindupGainSamplingTime;
+
+    /**
+     * Angle increment of the I/f controller, in Q14
+     */
+    Ifx_Math_Fract16 iToFAngleIncrementQ14;
+
+    /**
+     * Angle increment of the V/f controller, in Q14
+     */
+    Ifx_Math_Fract16 vToFAngleIncrementQ14;
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1
+
+    /**
+     * Delay compensation time of the FOC controller, in microseconds
+     */
+    uint32 delayCompensationTime_us;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DELAY_COMPENSATION_ENABLE == 1 */
+} Ifx_MS_FocSolutionF16_LoopGains;
+
+/**
+ * \brief Gains of the fast loop scaled for a requested current loop factor by
+ * Ifx_MS_FocSolutionF16_setCurrentLoopFactor(), taken over by the fast loop which latches the factor
+ */
+typedef struct Ifx_MS_FocSolutionF16_ScaledLoopGains
+{
+    /**
+     * Current loop factor the gains are scaled for
+     */
+    uint8 factor;
+
+    /**
+     * Factor divided by the factor in use at the request, in Q16, for the rate of change held by the PLL
+     */
+    Ifx_Math_Fract32 rateRatioQ16;
+
+    /**
+     * Gains of the FOC controller and of the open loop controllers
+     */
+    Ifx_MS_FocSolutionF16_LoopGains gains;
+
+    /**
+     * Parameters of the flux estimator
+     */
+    Ifx_MDA_FluxEstimatorF16_Parameters fluxEstimator;
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /**
+     * Coefficients of the sliding mode observer
+     */
+    Ifx_MDA_SlidingModeObserverF16_SamplingTimeCoeffs slidingModeObserver;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
+#if IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1
+
+    /**
+     * Coefficients of the deadbeat current controller
+     */
+    Ifx_MDA_FocControllerF16_DeadbeatCoeffs deadbeat;
+#endif /* IFX_MDA_FOCCONTROLLERF16_CFG_DEADBEAT_ENABLE == 1 */
+} Ifx_MS_FocSolutionF16_ScaledLoopGains;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
+
 /**
  * \brief Data structure that stores all data of module instance.
  *
@@ -298,6 +604,13 @@ typedef struct Ifx_MS_FocSolutionF16
      * Instance of flux estimator
      */
     Ifx_MDA_FluxEstimatorF16 fluxEstimator;
+#if IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1
+
+    /**
+     * Instance of the sliding mode observer, replaces the flux estimator for the angle and speed estimation
+     */
+    Ifx_MDA_SlidingModeObserverF16 slidingModeObserver;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ANGLE_OBSERVER == 1 */
 
     /**
      * Instance of  i2f
@@ -966,6 +1279,13 @@ typedef struct Ifx_MS_FocSolutionF16
      * Current reconstruction variables from the previous cycle
      */
     Ifx_Math_CurrentReconstruction_info previousCurrentReconstructionInfo;
+#if IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE != IFX_MAS_MODULATORF16_OVERMODULATION_MODE_LINEAR
+
+    /**
+     * Currents of the last valid measurement in the rotating frame, used while the measurement windows are too short
+     */
+    Ifx_Math_CmpFract16 heldCurrentsDQ;
+#endif /* IFX_MAS_MODULATORF16_CFG_OVERMODULATION_MODE */
 
     /**
      * Dynamic parameter of boolean type to enable or disable speed precontrol
@@ -1006,6 +1326,31 @@ typedef struct Ifx_MS_FocSolutionF16
      * Flag to signal command Q current sign change
      */
     bool p_qCommandZeroCrossing;
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+
+    /**
+     * Execution time statistics of the fast loop stages
+     */
+    Ifx_MS_FocSolutionF16_ProfilerStatistics p_profilerStatistics[Ifx_MS_FocSolutionF16_ProfilerStage_count];
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+    /**
+     * Current loop factor the sampling time dependent gains are scaled for
+     */
+    uint8 p_currentLoopFactor;
+
+    /**
+     * Sampling time dependent gains at the configured current loop factor, the base of the scaling
+     */
+    Ifx_MS_FocSolutionF16_LoopGains p_loopGains;
+
+    /**
+     * Gains scaled for the requested current loop factor, a request is pending while their factor differs from
+     * p_currentLoopFactor
+     */
+    Ifx_MS_FocSolutionF16_ScaledLoopGains p_scaledLoopGains;
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
 } Ifx_MS_FocSolutionF16;
 
 /**
@@ -1013,6 +1358,10 @@ typedef struct Ifx_MS_FocSolutionF16
  *
  *  The normalized parameters are initialized according to the data entered in ConfigWizard.
  *
+ *  With IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 the parameters of Ifx_MS_FocSolutionF16_Parameters are
+ * taken from the newest valid parameter block in data flash instead, if there is one. The stored coefficients are used
+ * as they are, so the initialization does not calculate them from the Config Wizard values.
+ *
  *  \param [inout] self Reference to structure that contains instance data members
  *
  */
@@ -1675,4 +2024,143 @@ static inline Ifx_Math_Fract16 Ifx_MS_FocSolutionF16_getTransitionDownDCurrentSc
 }
 
 
+/**
+ *  \brief Get the number of PWM periods per execution of Ifx_MS_FocSolutionF16_executeControlMode().
+ *
+ *  To be used by the one match callback, which triggers the fast loop on every factor-th PWM period.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR, or the factor in use with
+ * IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+ */
+static inline uint8 Ifx_MS_FocSolutionF16_getCurrentLoopFactor(Ifx_MS_FocSolutionF16* self)
+{
+    return Ifx_MHA_PatternGen_TLE987_getCurrentLoopFactor(&(self->patternGenTLE987));
+}
+
+
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1
+
+/**
+ *  \brief Request the number of PWM periods per execution of Ifx_MS_FocSolutionF16_executeControlMode().
+ *
+ *  E.g. a small factor at high electrical frequency and a large one at low speed, which leaves more CPU time to the
+ * background. The sampling time dependent gains are scaled for the factor here, outside of the fast loop: the sampling
+ * time of the flux estimator (filters, PLL gains, speed conversion), of the sliding mode observer and of the deadbeat
+ * controller, the integral and anti-windup gains of the current PI controllers, the delay compensation time and the
+ * angle increments of the I/f and V/f controllers. They are scaled from their values at
+ * IFX_MS_FOCSOLUTIONF16_CFG_CURRENT_LOOP_FACTOR, which are taken whenever a factor is requested at the configured one,
+ * so a change of these gains is to be made at the configured factor, as well as Ifx_MS_FocSolutionF16_getParameters().
+ *
+ *  The pattern generator takes the factor over with the next triggered fast loop, so the one match callback counts with
+ * the new factor from there on, see Ifx_MS_FocSolutionF16_getCurrentLoopFactor(). That fast loop only copies the
+ * scaled gains into the modules and moves the rate held by the PLL to the new sampling time, without division. Until
+ * then the request is pending and a further request of another factor is refused.
+ *
+ *  The fast loop has to fit into factor PWM periods. Only available with
+ * IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] factor Number of PWM periods per fast loop, 1 to IFX_MS_FOCSOLUTIONF16_CURRENT_LOOP_FACTOR_MAX
+ *
+ *  \return true if the factor is in range and was requested, false if not or if another factor is pending
+ */
+bool Ifx_MS_FocSolutionF16_setCurrentLoopFactor(Ifx_MS_FocSolutionF16* self, uint8 factor);
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_RUNTIME_LOOP_FACTOR == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1
+
+/**
+ *  \brief Resets the execution time statistics of all profiled stages.
+ *
+ *  Must not be interrupted by Ifx_MS_FocSolutionF16_executeControlMode().
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+void Ifx_MS_FocSolutionF16_resetProfiler(Ifx_MS_FocSolutionF16* self);
+
+/**
+ *  \brief Get the execution time statistics of one stage of the fast loop.
+ *
+ *  The statistics are updated at the end of every call to Ifx_MS_FocSolutionF16_executeControlMode(). If it can
+ * interrupt the caller, the copy may mix two consecutive updates.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] stage Profiled stage
+ *  \param [out] statistics Execution time statistics of the stage
+ *
+ */
+static inline void Ifx_MS_FocSolutionF16_getProfilerStatistics(Ifx_MS_FocSolutionF16* self,
+                                                               Ifx_MS_FocSolutionF16_ProfilerStage stage,
+                                                               Ifx_MS_FocSolutionF16_ProfilerStatistics* statistics)
+{
+    *statistics = self->p_profilerStatistics[stage];
+}
+
+
+/**
+ *  \brief Get the mean execution time of one stage of the fast loop.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] stage Profiled stage
+ *
+ *  \return Mean execution time in timestamp ticks, 0 if the stage was not executed yet
+ */
+static inline uint32 Ifx_MS_FocSolutionF16_getProfilerMean(Ifx_MS_FocSolutionF16* self,
+                                                           Ifx_MS_FocSolutionF16_ProfilerStage stage)
+{
+    uint32 mean = 0u;
+
+    if (self->p_profilerStatistics[stage].count != 0u)
+    {
+        mean = (uint32)(self->p_profilerStatistics[stage].sum / self->p_profilerStatistics[stage].count);
+    }
+
+    return mean;
+}
+
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PROFILER == 1 */
+#if IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1
+
+/**
+ *  \brief Get the calibration and tuning parameters of the FOC solution as stored in the parameter block.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [out] parameters Actual parameters of the FOC solution and of its modules
+ *
+ */
+void Ifx_MS_FocSolutionF16_getParameters(Ifx_MS_FocSolutionF16* self, Ifx_MS_FocSolutionF16_Parameters* parameters);
+
+/**
+ *  \brief Find the newest valid parameter block in data flash.
+ *
+ *  The IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES pages at the end of the data flash are scanned for the block
+ * with the right identifier and version and the highest sequence number, only its CRC is checked. If the CRC fails, the
+ * next older block is taken, so the execution time is bounded by the number of pages.
+ *
+ *  \return Newest valid parameter block, NULL_PTR if there is none
+ */
+const Ifx_MS_FocSolutionF16_ParameterBlock* Ifx_MS_FocSolutionF16_findParameterBlock(void);
+
+/**
+ *  \brief Store the actual calibration and tuning parameters in data flash.
+ *
+ *  The block is written with ProgramPage() to the page after the one of the newest valid block, so the writes rotate
+ * over the IFX_MS_FOCSOLUTIONF16_CFG_PARAMETER_BLOCK_PAGES pages and the newest valid block stays untouched. A write
+ * interrupted by a reset leaves a block with a wrong CRC, which is skipped at the next initialization. The control
+ * interrupts are not served while the page is programmed, so the block is only written with the power stage off, i.e.
+ * in the init, off, standBy or fault state, e.g. before a shutdown. In any other state nothing is written.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ *  \return true if the page was programmed, false if it failed or the state does not allow it
+ */
+bool Ifx_MS_FocSolutionF16_storeParameters(Ifx_MS_FocSolutionF16* self);
+
+#endif /* IFX_MS_FOCSOLUTIONF16_CFG_ENABLE_PARAMETER_BLOCK == 1 */
 #endif /*IFX_MS_FOCSOLUTIONF16_H*/
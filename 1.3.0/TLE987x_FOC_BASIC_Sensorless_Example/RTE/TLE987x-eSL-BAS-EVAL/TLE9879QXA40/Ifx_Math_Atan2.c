@@ -12,64 +12,99 @@
 #include "Ifx_Math_Atan.h"
 #include "Ifx_Math_ShL.h"
 
-/* polyspace-begin CODE-METRIC:VOCF [Justified:Low] "Not possible to achieve the threshold limit for the code metrics
- * without violating MISRA rules or other code metrics." */
+/* Fractional bits of the CORDIC vector, the magnitude including the CORDIC gain of 1.65 stays below 2^31 */
+#define IFX_MATH_ATAN2_CORDIC_SHIFT    (14U)
+
+/* Inverse CORDIC gain 1/prod(sqrt(1 + 2^(-2i))) in Q16, the change for fewer iterations is below 2^-16 from 8 on */
+#define IFX_MATH_ATAN2_CORDIC_GAIN_INV (39797U)
+
+/* Elementary rotation angles atan(2^-i), normalized by 2*pi to 2^32 */
+static const uint32 Ifx_Math_Atan2_cordicAngles[IFX_MATH_ATAN2_CORDIC_MAX_ITERATIONS] = {
+    0x20000000U, 0x12E4051EU, 0x09FB385BU, 0x051111D4U, 0x028B0D43U, 0x0145D7E1U, 0x00A2F61EU, 0x00517C55U, 0x0028BE53U,
+    0x00145F2FU, 0x000A2F98U, 0x000517CCU, 0x00028BE6U, 0x000145F3U, 0x0000A2FAU, 0x0000517DU
+};
+
+#if IFX_MATH_CFG_ATAN2_MODE == IFX_MATH_USROPT_ATAN2_MODE_CORDIC
 uint32 Ifx_Math_Atan2_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x)
 {
-    /* Local variables to store the tangent and angle */
-    Ifx_Math_Fract32 tangent;
-    uint32           angle;
+    /* Angle of the CORDIC, the magnitude is not needed */
+    return Ifx_Math_Atan2Cordic_F16(y, x, IFX_MATH_ATAN2_CORDIC_ITERATIONS).angle;
+}
+
+
+#else
+uint32 Ifx_Math_Atan2_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x)
+{
+    /* Fold the vector into the partition -Pi/4..Pi/4 */
+    Ifx_Math_Atan2Partition_Type partition = Ifx_Math_Atan2Partition_F16(y, x);
+
+    /* Read partial angle from LUT, add up total angle and return */
+    return partition.angle + Ifx_Math_Atan_F16(partition.tangent);
+}
+
+
+#endif /* IFX_MATH_CFG_ATAN2_MODE == IFX_MATH_USROPT_ATAN2_MODE_CORDIC */
+
+Ifx_Math_PolarFract16 Ifx_Math_Atan2Cordic_F16(Ifx_Math_Fract16 y, Ifx_Math_Fract16 x, uint8 iterations)
+{
+    /* Result */
+    Ifx_Math_PolarFract16 polar;
+
+    /* Vector with 15 + IFX_MATH_ATAN2_CORDIC_SHIFT fractional bits */
+    sint32                vectorX = Ifx_Math_ShL_F32(x, IFX_MATH_ATAN2_CORDIC_SHIFT);
+    sint32                vectorY = Ifx_Math_ShL_F32(y, IFX_MATH_ATAN2_CORDIC_SHIFT);
+
+    /* Accumulated rotation */
+    uint32                angle = 0U;
 
-    /* Divide unit circle in four partitions */
-    if (y < -x)
+    /* Magnitude in Q15 */
+    uint32                magnitude;
+    uint8                 i;
+
+    /* Rotate by pi into the right half plane, where the iterations converge */
+    if (vectorX < 0)
     {
-        if (x > y)                                               /* Partition 4: 5*Pi/4..7*Pi/4 */
-        {
-            angle   = IFX_MATH_PI_INDEX + IFX_MATH_PI_INDEX / 2; /* Set pre-angle of 3/2*Pi */
-            tangent = -(Ifx_Math_ShL_F32(x, 15)) / y;            /* Calculate tangent of the angle, stretched by y and
-                                                                  * y+x (x and y are interpreted as vectors) */
-        }
-        else                                                     /* Partition 3: 3*Pi/4..5*Pi/4 */
-        {
-            angle   = IFX_MATH_PI_INDEX;                         /* Set pre-angle of Pi */
-            tangent = (Ifx_Math_ShL_F32(y, 15)) / x;             /* Calculate tangent of the angle, stretched by x and
-                                                                  * y+x (x and y are interpreted as vectors) */
-        }
+        vectorX = -vectorX;
+        vectorY = -vectorY;
+        angle   = IFX_MATH_PI_INDEX;
     }
-    else
+
+    /* Rotate towards the x axis by +-atan(2^-i), the angle accumulates the rotation. The direction is applied by a
+     * conditional negation instead of a branch, so that the execution time does not depend on the input */
+    for (i = 0U; i < iterations; i++)
     {
-        if (x < y)                                               /* Partition 2: 1*Pi/4..3*Pi/4 */
-        {
-            angle   = IFX_MATH_PI_INDEX / 2;                     /* Set pre-angle of 1/2*Pi */
-            tangent = -(Ifx_Math_ShL_F32(x, 15)) / y;            /* Calculate tangent of the angle, stretched by y and
-                                                                  * y+x (x and y are interpreted as vectors) */
-        }
-        else                                                     /* Partition 1: -1*Pi/4..1*Pi/4 */
-        {
-            angle = 0;                                           /* Set no pre-angle */
-
-            if (x == 0)                                          /* Prevent division by zero */
-            {
-                tangent = 0;
-            }
-            else
-            {
-                tangent = (Ifx_Math_ShL_F32(y, 15)) / x;         /* Calculate tangent of the angle, stretched by x and
-                                                                  * y+x (x and y are interpreted as vectors) */
-            }
-        }
+        /* -1 if y is negative (rotate counterclockwise), 0 otherwise (rotate clockwise) */
+        /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+         * arithmetic." */
+        sint32 direction = vectorY >> 31;
+        sint32 shiftedX  = vectorX >> i;
+        sint32 shiftedY  = vectorY >> i;
+
+        /* polyspace +4 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+         * arithmetic." */
+        vectorX = vectorX + ((shiftedY ^ direction) - direction);
+        vectorY = vectorY - ((shiftedX ^ direction) - direction);
+        angle   = angle + ((Ifx_Math_Atan2_cordicAngles[i] ^ (uint32)direction) - (uint32)direction);
     }
 
-    /* Saturate tangent */
-    if (tangent == (IFX_MATH_FRACT16_MAX + 1))
+    /* Remove the CORDIC gain and round to Q15 */
+    magnitude = (uint32)((((uint64)(uint32)vectorX * IFX_MATH_ATAN2_CORDIC_GAIN_INV)
+                          + (1ULL << (IFX_MATH_ATAN2_CORDIC_SHIFT + 15U)))
+                         >> (IFX_MATH_ATAN2_CORDIC_SHIFT + 16U));
+
+    if (magnitude > (uint32)IFX_MATH_FRACT16_MAX)
     {
-        tangent = IFX_MATH_FRACT16_MAX;
+        magnitude = (uint32)IFX_MATH_FRACT16_MAX;
     }
 
-    /* Read partial angle from LUT, add up total angle and return */
-    return angle + Ifx_Math_Atan_F16((Ifx_Math_Fract16)tangent);
-}
+    /* No angle for the zero vector */
+    if ((x == 0) && (y == 0))
+    {
+        angle = 0U;
+    }
 
+    polar.amplitude = (Ifx_Math_Fract16)magnitude;
+    polar.angle     = angle;
 
-/* polyspace-end CODE-METRIC:VOCF [Justified:Low] "Not possible to achieve the threshold limit for the code metrics
- * without violating MISRA rules or other code metrics." */
+    return polar;
+}
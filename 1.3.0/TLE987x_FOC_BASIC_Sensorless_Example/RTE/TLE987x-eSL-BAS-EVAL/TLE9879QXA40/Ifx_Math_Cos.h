@@ -24,12 +24,22 @@
  *  This function calculates the cosinus value of the 32-bit input angle, in the range \f$[0, 2*\pi]\f$, normalized by
  * \f$2*\pi\f$. The output resolution is configurable by controlling the sine lookup table size. The size of the lookup
  * table is given by IFX_MATH_CFG_SIN_LUT_SIZE. The valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE =
- * {IFX_MATH_USROPT_SIN_LUT_SIZE_8; IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ * {IFX_MATH_USROPT_SIN_LUT_SIZE_8; IFX_MATH_USROPT_SIN_LUT_SIZE_9; IFX_MATH_USROPT_SIN_LUT_SIZE_10;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_11; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
  *
  *  \param [in] x 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized by\f$2*\pi\f$
  *
  *  \return 16-bit cosinus value in Q15 format
  */
+#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED
+static inline Ifx_Math_Fract16 Ifx_Math_Cos_F16(uint32 x)
+{
+    /* Cosine(theta) = sin(theta + pi/2), the angle wraps around at 2*pi */
+    return Ifx_Math_Sin_F16(x + IFX_MATH_SIN_QUARTER_ANGLE);
+}
+
+
+#else
 static inline Ifx_Math_Fract16 Ifx_Math_Cos_F16(uint32 x)
 {
     /* Stores the cosine output */
@@ -57,4 +67,6 @@ static inline Ifx_Math_Fract16 Ifx_Math_Cos_F16(uint32 x)
 }
 
 
+#endif /* IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED */
+
 #endif /*IFX_MATH_COS_H*/
@@ -10,34 +10,36 @@
 
 #include "Ifx_Math_InvPark.h"
 #include "Ifx_Math_MulSat.h"
-#include "Ifx_Math_Cos.h"
-#include "Ifx_Math_Sin.h"
+#include "Ifx_Math_SinCos.h"
 #include "Ifx_Math_SubSat.h"
 #include "Ifx_Math_AddSat.h"
 
 Ifx_Math_CmpFract16 Ifx_Math_InvPark_F16(Ifx_Math_CmpFract16 rotating, uint32 angle)
 {
     /* Data structure for return */
-    Ifx_Math_CmpFract16 invParkOutput;
+    Ifx_Math_CmpFract16  invParkOutput;
 
     /* Locals for grouping the operations */
     /* Ia = I_d * cos(theta) */
-    Ifx_Math_Fract16    iA;
+    Ifx_Math_Fract16     iA;
 
     /* I_q * sin(theta) */
-    Ifx_Math_Fract16    iB;
+    Ifx_Math_Fract16     iB;
 
     /* I_q * cos(theta) */
-    Ifx_Math_Fract16    iC;
+    Ifx_Math_Fract16     iC;
 
     /* I_d * sin(theta) */
-    Ifx_Math_Fract16    iD;
+    Ifx_Math_Fract16     iD;
+
+    /* sin(theta) and cos(theta) from one table index */
+    Ifx_Math_SinCos_Type sinCosTheta = Ifx_Math_SinCos_F16(angle);
 
     /* cos(theta) */
-    Ifx_Math_Fract16    cosTheta = Ifx_Math_Cos_F16(angle);
+    Ifx_Math_Fract16     cosTheta = sinCosTheta.cos;
 
     /* sin(theta) */
-    Ifx_Math_Fract16    sinTheta = Ifx_Math_Sin_F16(angle);
+    Ifx_Math_Fract16     sinTheta = sinCosTheta.sin;
 
     /* Calculate the local operations group "I_d * cos(theta)" */
     iA = Ifx_Math_MulSat_F16(rotating.real, cosTheta);
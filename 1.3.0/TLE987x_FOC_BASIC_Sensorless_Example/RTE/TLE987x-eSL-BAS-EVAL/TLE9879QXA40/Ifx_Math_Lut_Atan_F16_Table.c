@@ -13,246 +13,61 @@
 
 /**
  * Lookup table between \f$atan(0)\f$ and \f$atan(1)\f$
- * Tables are available for IFX_MATH_CFG_ATAN_LUT_SIZE = 8, 10, 12 bit
+ * Tables are available for IFX_MATH_CFG_ATAN_LUT_SIZE = 8, 9, 10, 11, 12 bit
  * Table size is (2^IFX_MATH_CFG_ATAN_LUT_SIZE) + 1
+ * Generated by foc_gen_tables of the host build
  */
 
 #if IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_8
 const uint16 Ifx_Math_Lut_Atan_F16_table[257] = {
-    0, 41, 81, 122, 163, 204, 244, 285, 326, 367, 407, 448, 489, 529, 570, 610, 651, 692, 732, 773, 813, 854, 894,
-    935, 975, 1015, 1056, 1096, 1136, 1177, 1217, 1257, 1297, 1337, 1377, 1417, 1457, 1497, 1537, 1577, 1617, 1656,
-    1696, 1736, 1775, 1815, 1854, 1894, 1933, 1973, 2012, 2051, 2090, 2129, 2168, 2207, 2246, 2285, 2324, 2363, 2401,
-    2440, 2478, 2517, 2555, 2594, 2632, 2670, 2708, 2746, 2784, 2822, 2860, 2897, 2935, 2973, 3010, 3047, 3085, 3122,
-    3159, 3196, 3233, 3270, 3307, 3344, 3380, 3417, 3453, 3490, 3526, 3562, 3599, 3635, 3670, 3706, 3742, 3778, 3813,
-    3849, 3884, 3920, 3955, 3990, 4025, 4060, 4095, 4129, 4164, 4199, 4233, 4267, 4302, 4336, 4370, 4404, 4438, 4471,
-    4505, 4539, 4572, 4605, 4639, 4672, 4705, 4738, 4771, 4803, 4836, 4869, 4901, 4933, 4966, 4998, 5030, 5062, 5094,
-    5125, 5157, 5188, 5220, 5251, 5282, 5313, 5344, 5375, 5406, 5437, 5467, 5498, 5528, 5559, 5589, 5619, 5649, 5679,
-    5708, 5738, 5768, 5797, 5826, 5856, 5885, 5914, 5943, 5972, 6000, 6029, 6058, 6086, 6114, 6142, 6171, 6199, 6227,
-    6254, 6282, 6310, 6337, 6365, 6392, 6419, 6446, 6473, 6500, 6527, 6554, 6580, 6607, 6633, 6660, 6686, 6712, 6738,
-    6764, 6790, 6815, 6841, 6867, 6892, 6917, 6943, 6968, 6993, 7018, 7043, 7068, 7092, 7117, 7141, 7166, 7190, 7214,
-    7238, 7262, 7286, 7310, 7334, 7358, 7381, 7405, 7428, 7451, 7475, 7498, 7521, 7544, 7566, 7589, 7612, 7635, 7657,
-    7679, 7702, 7724, 7746, 7768, 7790, 7812, 7834, 7856, 7877, 7899, 7920, 7942, 7963, 7984, 8005, 8026, 8047, 8068,
-    8089, 8110, 8131, 8151, 8172, 8192
+    0, 41, 81, 122, 163, 204, 244, 285, 326, 367, 407, 448, 489, 529, 570, 610, 651, 692, 732, 773, 813, 854, 894, 935,
+    975, 1015, 1056, 1096, 1136, 1177, 1217, 1257, 1297, 1337, 1377, 1417, 1457, 1497, 1537, 1577, 1617, 1656, 1696,
+    1736, 1775, 1815, 1854, 1894, 1933, 1973, 2012, 2051, 2090, 2129, 2168, 2207, 2246, 2285, 2324, 2363, 2401, 2440,
+    2478, 2517, 2555, 2594, 2632, 2670, 2708, 2746, 2784, 2822, 2860, 2897, 2935, 2973, 3010, 3047, 3085, 3122, 3159,
+    3196, 3233, 3270, 3307, 3344, 3380, 3417, 3453, 3490, 3526, 3562, 3599, 3635, 3670, 3706, 3742, 3778, 3813, 3849,
+    3884, 3920, 3955, 3990, 4025, 4060, 4095, 4129, 4164, 4199, 4233, 4267, 4302, 4336, 4370, 4404, 4438, 4471, 4505,
+    4539, 4572, 4605, 4639, 4672, 4705, 4738, 4771, 4803, 4836, 4869, 4901, 4933, 4966, 4998, 5030, 5062, 5094, 5125,
+    5157, 5188, 5220, 5251, 5282, 5313, 5344, 5375, 5406, 5437, 5467, 5498, 5528, 5559, 5589, 5619, 5649, 5679, 5708,
+    5738, 5768, 5797, 5826, 5856, 5885, 5914, 5943, 5972, 6000, 6029, 6058, 6086, 6114, 6142, 6171, 6199, 6227, 6254,
+    6282, 6310, 6337, 6365, 6392, 6419, 6446, 6473, 6500, 6527, 6554, 6580, 6607, 6633, 6660, 6686, 6712, 6738, 6764,
+    6790, 6815, 6841, 6867, 6892, 6917, 6943, 6968, 6993, 7018, 7043, 7068, 7092, 7117, 7141, 7166, 7190, 7214, 7238,
+    7262, 7286, 7310, 7334, 7358, 7381, 7405, 7428, 7451, 7475, 7498, 7521, 7544, 7566, 7589, 7612, 7635, 7657, 7679,
+    7702, 7724, 7746, 7768, 7790, 7812, 7834, 7856, 7877, 7899, 7920, 7942, 7963, 7984, 8005, 8026, 8047, 8068, 8089,
+    8110, 8131, 8151, 8172, 8192
 };
 
-#elif IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_12
-const uint16 Ifx_Math_Lut_Atan_F16_table[4097] = {
-    0, 3, 5, 8, 10, 13, 15, 18, 20, 23, 25, 28, 31, 33, 36, 38, 41, 43, 46, 48, 51, 53, 56, 59, 61, 64, 66, 69, 71,
-    74, 76, 79, 81, 84, 87, 89, 92, 94, 97, 99, 102, 104, 107, 109, 112, 115, 117, 120, 122, 125, 127, 130, 132, 135,
-    138, 140, 143, 145, 148, 150, 153, 155, 158, 160, 163, 166, 168, 171, 173, 176, 178, 181, 183, 186, 188, 191, 194,
-    196, 199, 201, 204, 206, 209, 211, 214, 216, 219, 222, 224, 227, 229, 232, 234, 237, 239, 242, 244, 247, 250, 252,
-    255, 257, 260, 262, 265, 267, 270, 272, 275, 278, 280, 283, 285, 288, 290, 293, 295, 298, 300, 303, 305, 308, 311,
-    313, 316, 318, 321, 323, 326, 328, 331, 333, 336, 339, 341, 344, 346, 349, 351, 354, 356, 359, 361, 364, 367, 369,
-    372, 374, 377, 379, 382, 384, 387, 389, 392, 395, 397, 400, 402, 405, 407, 410, 412, 415, 417, 420, 422, 425, 428,
-    430, 433, 435, 438, 440, 443, 445, 448, 450, 453, 456, 458, 461, 463, 466, 468, 471, 473, 476, 478, 481, 483, 486,
-    489, 491, 494, 496, 499, 501, 504, 506, 509, 511, 514, 517, 519, 522, 524, 527, 529, 532, 534, 537, 539, 542, 544,
-    547, 550, 552, 555, 557, 560, 562, 565, 567, 570, 572, 575, 577, 580, 583, 585, 588, 590, 593, 595, 598, 600, 603,
-    605, 608, 610, 613, 616, 618, 621, 623, 626, 628, 631, 633, 636, 638, 641, 643, 646, 649, 651, 654, 656, 659, 661,
-    664, 666, 669, 671, 674, 676, 679, 681, 684, 687, 689, 692, 694, 697, 699, 702, 704, 707, 709, 712, 714, 717, 720,
-    722, 725, 727, 730, 732, 735, 737, 740, 742, 745, 747, 750, 752, 755, 758, 760, 763, 765, 768, 770, 773, 775, 778,
-    780, 783, 785, 788, 790, 793, 796, 798, 801, 803, 806, 808, 811, 813, 816, 818, 821, 823, 826, 828, 831, 833, 836,
-    839, 841, 844, 846, 849, 851, 854, 856, 859, 861, 864, 866, 869, 871, 874, 876, 879, 882, 884, 887, 889, 892, 894,
-    897, 899, 902, 904, 907, 909, 912, 914, 917, 919, 922, 924, 927, 930, 932, 935, 937, 940, 942, 945, 947, 950, 952,
-    955, 957, 960, 962, 965, 967, 970, 972, 975, 978, 980, 983, 985, 988, 990, 993, 995, 998, 1000, 1003, 1005, 1008,
-    1010, 1013, 1015, 1018, 1020, 1023, 1025, 1028, 1031, 1033, 1036, 1038, 1041, 1043, 1046, 1048, 1051, 1053, 1056,
-    1058, 1061, 1063, 1066, 1068, 1071, 1073, 1076, 1078, 1081, 1083, 1086, 1088, 1091, 1094, 1096, 1099, 1101, 1104,
-    1106, 1109, 1111, 1114, 1116, 1119, 1121, 1124, 1126, 1129, 1131, 1134, 1136, 1139, 1141, 1144, 1146, 1149, 1151,
-    1154, 1156, 1159, 1161, 1164, 1166, 1169, 1172, 1174, 1177, 1179, 1182, 1184, 1187, 1189, 1192, 1194, 1197, 1199,
-    1202, 1204, 1207, 1209, 1212, 1214, 1217, 1219, 1222, 1224, 1227, 1229, 1232, 1234, 1237, 1239, 1242, 1244, 1247,
-    1249, 1252, 1254, 1257, 1259, 1262, 1264, 1267, 1269, 1272, 1274, 1277, 1280, 1282, 1285, 1287, 1290, 1292, 1295,
-    1297, 1300, 1302, 1305, 1307, 1310, 1312, 1315, 1317, 1320, 1322, 1325, 1327, 1330, 1332, 1335, 1337, 1340, 1342,
-    1345, 1347, 1350, 1352, 1355, 1357, 1360, 1362, 1365, 1367, 1370, 1372, 1375, 1377, 1380, 1382, 1385, 1387, 1390,
-    1392, 1395, 1397, 1400, 1402, 1405, 1407, 1410, 1412, 1415, 1417, 1420, 1422, 1425, 1427, 1430, 1432, 1435, 1437,
-    1440, 1442, 1445, 1447, 1450, 1452, 1455, 1457, 1460, 1462, 1465, 1467, 1470, 1472, 1475, 1477, 1480, 1482, 1485,
-    1487, 1490, 1492, 1495, 1497, 1500, 1502, 1505, 1507, 1510, 1512, 1515, 1517, 1520, 1522, 1525, 1527, 1530, 1532,
-    1535, 1537, 1540, 1542, 1545, 1547, 1549, 1552, 1554, 1557, 1559, 1562, 1564, 1567, 1569, 1572, 1574, 1577, 1579,
-    1582, 1584, 1587, 1589, 1592, 1594, 1597, 1599, 1602, 1604, 1607, 1609, 1612, 1614, 1617, 1619, 1622, 1624, 1627,
-    1629, 1632, 1634, 1637, 1639, 1642, 1644, 1646, 1649, 1651, 1654, 1656, 1659, 1661, 1664, 1666, 1669, 1671, 1674,
-    1676, 1679, 1681, 1684, 1686, 1689, 1691, 1694, 1696, 1699, 1701, 1704, 1706, 1709, 1711, 1713, 1716, 1718, 1721,
-    1723, 1726, 1728, 1731, 1733, 1736, 1738, 1741, 1743, 1746, 1748, 1751, 1753, 1756, 1758, 1761, 1763, 1765, 1768,
-    1770, 1773, 1775, 1778, 1780, 1783, 1785, 1788, 1790, 1793, 1795, 1798, 1800, 1803, 1805, 1808, 1810, 1812, 1815,
-    1817, 1820, 1822, 1825, 1827, 1830, 1832, 1835, 1837, 1840, 1842, 1845, 1847, 1849, 1852, 1854, 1857, 1859, 1862,
-    1864, 1867, 1869, 1872, 1874, 1877, 1879, 1882, 1884, 1886, 1889, 1891, 1894, 1896, 1899, 1901, 1904, 1906, 1909,
-    1911, 1914, 1916, 1918, 1921, 1923, 1926, 1928, 1931, 1933, 1936, 1938, 1941, 1943, 1946, 1948, 1950, 1953, 1955,
-    1958, 1960, 1963, 1965, 1968, 1970, 1973, 1975, 1977, 1980, 1982, 1985, 1987, 1990, 1992, 1995, 1997, 2000, 2002,
-    2004, 2007, 2009, 2012, 2014, 2017, 2019, 2022, 2024, 2027, 2029, 2031, 2034, 2036, 2039, 2041, 2044, 2046, 2049,
-    2051, 2054, 2056, 2058, 2061, 2063, 2066, 2068, 2071, 2073, 2076, 2078, 2080, 2083, 2085, 2088, 2090, 2093, 2095,
-    2098, 2100, 2102, 2105, 2107, 2110, 2112, 2115, 2117, 2120, 2122, 2124, 2127, 2129, 2132, 2134, 2137, 2139, 2142,
-    2144, 2146, 2149, 2151, 2154, 2156, 2159, 2161, 2163, 2166, 2168, 2171, 2173, 2176, 2178, 2181, 2183, 2185, 2188,
-    2190, 2193, 2195, 2198, 2200, 2202, 2205, 2207, 2210, 2212, 2215, 2217, 2220, 2222, 2224, 2227, 2229, 2232, 2234,
-    2237, 2239, 2241, 2244, 2246, 2249, 2251, 2254, 2256, 2258, 2261, 2263, 2266, 2268, 2271, 2273, 2275, 2278, 2280,
-    2283, 2285, 2288, 2290, 2292, 2295, 2297, 2300, 2302, 2305, 2307, 2309, 2312, 2314, 2317, 2319, 2321, 2324, 2326,
-    2329, 2331, 2334, 2336, 2338, 2341, 2343, 2346, 2348, 2351, 2353, 2355, 2358, 2360, 2363, 2365, 2367, 2370, 2372,
-    2375, 2377, 2380, 2382, 2384, 2387, 2389, 2392, 2394, 2396, 2399, 2401, 2404, 2406, 2409, 2411, 2413, 2416, 2418,
-    2421, 2423, 2425, 2428, 2430, 2433, 2435, 2437, 2440, 2442, 2445, 2447, 2450, 2452, 2454, 2457, 2459, 2462, 2464,
-    2466, 2469, 2471, 2474, 2476, 2478, 2481, 2483, 2486, 2488, 2490, 2493, 2495, 2498, 2500, 2502, 2505, 2507, 2510,
-    2512, 2514, 2517, 2519, 2522, 2524, 2526, 2529, 2531, 2534, 2536, 2538, 2541, 2543, 2546, 2548, 2550, 2553, 2555,
-    2558, 2560, 2562, 2565, 2567, 2570, 2572, 2574, 2577, 2579, 2582, 2584, 2586, 2589, 2591, 2594, 2596, 2598, 2601,
-    2603, 2605, 2608, 2610, 2613, 2615, 2617, 2620, 2622, 2625, 2627, 2629, 2632, 2634, 2637, 2639, 2641, 2644, 2646,
-    2648, 2651, 2653, 2656, 2658, 2660, 2663, 2665, 2668, 2670, 2672, 2675, 2677, 2679, 2682, 2684, 2687, 2689, 2691,
-    2694, 2696, 2699, 2701, 2703, 2706, 2708, 2710, 2713, 2715, 2718, 2720, 2722, 2725, 2727, 2729, 2732, 2734, 2737,
-    2739, 2741, 2744, 2746, 2748, 2751, 2753, 2756, 2758, 2760, 2763, 2765, 2767, 2770, 2772, 2775, 2777, 2779, 2782,
-    2784, 2786, 2789, 2791, 2793, 2796, 2798, 2801, 2803, 2805, 2808, 2810, 2812, 2815, 2817, 2820, 2822, 2824, 2827,
-    2829, 2831, 2834, 2836, 2838, 2841, 2843, 2846, 2848, 2850, 2853, 2855, 2857, 2860, 2862, 2864, 2867, 2869, 2871,
-    2874, 2876, 2879, 2881, 2883, 2886, 2888, 2890, 2893, 2895, 2897, 2900, 2902, 2904, 2907, 2909, 2912, 2914, 2916,
-    2919, 2921, 2923, 2926, 2928, 2930, 2933, 2935, 2937, 2940, 2942, 2944, 2947, 2949, 2951, 2954, 2956, 2959, 2961,
-    2963, 2966, 2968, 2970, 2973, 2975, 2977, 2980, 2982, 2984, 2987, 2989, 2991, 2994, 2996, 2998, 3001, 3003, 3005,
-    3008, 3010, 3012, 3015, 3017, 3019, 3022, 3024, 3026, 3029, 3031, 3033, 3036, 3038, 3040, 3043, 3045, 3047, 3050,
-    3052, 3054, 3057, 3059, 3061, 3064, 3066, 3068, 3071, 3073, 3075, 3078, 3080, 3082, 3085, 3087, 3089, 3092, 3094,
-    3096, 3099, 3101, 3103, 3106, 3108, 3110, 3113, 3115, 3117, 3120, 3122, 3124, 3127, 3129, 3131, 3134, 3136, 3138,
-    3141, 3143, 3145, 3148, 3150, 3152, 3155, 3157, 3159, 3162, 3164, 3166, 3168, 3171, 3173, 3175, 3178, 3180, 3182,
-    3185, 3187, 3189, 3192, 3194, 3196, 3199, 3201, 3203, 3206, 3208, 3210, 3212, 3215, 3217, 3219, 3222, 3224, 3226,
-    3229, 3231, 3233, 3236, 3238, 3240, 3243, 3245, 3247, 3249, 3252, 3254, 3256, 3259, 3261, 3263, 3266, 3268, 3270,
-    3272, 3275, 3277, 3279, 3282, 3284, 3286, 3289, 3291, 3293, 3296, 3298, 3300, 3302, 3305, 3307, 3309, 3312, 3314,
-    3316, 3319, 3321, 3323, 3325, 3328, 3330, 3332, 3335, 3337, 3339, 3341, 3344, 3346, 3348, 3351, 3353, 3355, 3358,
-    3360, 3362, 3364, 3367, 3369, 3371, 3374, 3376, 3378, 3380, 3383, 3385, 3387, 3390, 3392, 3394, 3396, 3399, 3401,
-    3403, 3406, 3408, 3410, 3412, 3415, 3417, 3419, 3422, 3424, 3426, 3428, 3431, 3433, 3435, 3438, 3440, 3442, 3444,
-    3447, 3449, 3451, 3453, 3456, 3458, 3460, 3463, 3465, 3467, 3469, 3472, 3474, 3476, 3478, 3481, 3483, 3485, 3488,
-    3490, 3492, 3494, 3497, 3499, 3501, 3503, 3506, 3508, 3510, 3513, 3515, 3517, 3519, 3522, 3524, 3526, 3528, 3531,
-    3533, 3535, 3537, 3540, 3542, 3544, 3547, 3549, 3551, 3553, 3556, 3558, 3560, 3562, 3565, 3567, 3569, 3571, 3574,
-    3576, 3578, 3580, 3583, 3585, 3587, 3589, 3592, 3594, 3596, 3599, 3601, 3603, 3605, 3608, 3610, 3612, 3614, 3617,
-    3619, 3621, 3623, 3626, 3628, 3630, 3632, 3635, 3637, 3639, 3641, 3644, 3646, 3648, 3650, 3653, 3655, 3657, 3659,
-    3662, 3664, 3666, 3668, 3670, 3673, 3675, 3677, 3679, 3682, 3684, 3686, 3688, 3691, 3693, 3695, 3697, 3700, 3702,
-    3704, 3706, 3709, 3711, 3713, 3715, 3718, 3720, 3722, 3724, 3726, 3729, 3731, 3733, 3735, 3738, 3740, 3742, 3744,
-    3747, 3749, 3751, 3753, 3756, 3758, 3760, 3762, 3764, 3767, 3769, 3771, 3773, 3776, 3778, 3780, 3782, 3784, 3787,
-    3789, 3791, 3793, 3796, 3798, 3800, 3802, 3804, 3807, 3809, 3811, 3813, 3816, 3818, 3820, 3822, 3824, 3827, 3829,
-    3831, 3833, 3836, 3838, 3840, 3842, 3844, 3847, 3849, 3851, 3853, 3856, 3858, 3860, 3862, 3864, 3867, 3869, 3871,
-    3873, 3875, 3878, 3880, 3882, 3884, 3886, 3889, 3891, 3893, 3895, 3898, 3900, 3902, 3904, 3906, 3909, 3911, 3913,
-    3915, 3917, 3920, 3922, 3924, 3926, 3928, 3931, 3933, 3935, 3937, 3939, 3942, 3944, 3946, 3948, 3950, 3953, 3955,
-    3957, 3959, 3961, 3964, 3966, 3968, 3970, 3972, 3975, 3977, 3979, 3981, 3983, 3985, 3988, 3990, 3992, 3994, 3996,
-    3999, 4001, 4003, 4005, 4007, 4010, 4012, 4014, 4016, 4018, 4021, 4023, 4025, 4027, 4029, 4031, 4034, 4036, 4038,
-    4040, 4042, 4045, 4047, 4049, 4051, 4053, 4055, 4058, 4060, 4062, 4064, 4066, 4069, 4071, 4073, 4075, 4077, 4079,
-    4082, 4084, 4086, 4088, 4090, 4092, 4095, 4097, 4099, 4101, 4103, 4106, 4108, 4110, 4112, 4114, 4116, 4119, 4121,
-    4123, 4125, 4127, 4129, 4132, 4134, 4136, 4138, 4140, 4142, 4145, 4147, 4149, 4151, 4153, 4155, 4158, 4160, 4162,
-    4164, 4166, 4168, 4171, 4173, 4175, 4177, 4179, 4181, 4183, 4186, 4188, 4190, 4192, 4194, 4196, 4199, 4201, 4203,
-    4205, 4207, 4209, 4211, 4214, 4216, 4218, 4220, 4222, 4224, 4227, 4229, 4231, 4233, 4235, 4237, 4239, 4242, 4244,
-    4246, 4248, 4250, 4252, 4254, 4257, 4259, 4261, 4263, 4265, 4267, 4269, 4272, 4274, 4276, 4278, 4280, 4282, 4284,
-    4287, 4289, 4291, 4293, 4295, 4297, 4299, 4302, 4304, 4306, 4308, 4310, 4312, 4314, 4317, 4319, 4321, 4323, 4325,
-    4327, 4329, 4331, 4334, 4336, 4338, 4340, 4342, 4344, 4346, 4349, 4351, 4353, 4355, 4357, 4359, 4361, 4363, 4366,
-    4368, 4370, 4372, 4374, 4376, 4378, 4380, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4400, 4402, 4404, 4406,
-    4408, 4410, 4412, 4414, 4416, 4419, 4421, 4423, 4425, 4427, 4429, 4431, 4433, 4435, 4438, 4440, 4442, 4444, 4446,
-    4448, 4450, 4452, 4454, 4457, 4459, 4461, 4463, 4465, 4467, 4469, 4471, 4473, 4476, 4478, 4480, 4482, 4484, 4486,
-    4488, 4490, 4492, 4495, 4497, 4499, 4501, 4503, 4505, 4507, 4509, 4511, 4513, 4516, 4518, 4520, 4522, 4524, 4526,
-    4528, 4530, 4532, 4534, 4536, 4539, 4541, 4543, 4545, 4547, 4549, 4551, 4553, 4555, 4557, 4559, 4562, 4564, 4566,
-    4568, 4570, 4572, 4574, 4576, 4578, 4580, 4582, 4585, 4587, 4589, 4591, 4593, 4595, 4597, 4599, 4601, 4603, 4605,
-    4607, 4610, 4612, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4637, 4639, 4641, 4643, 4645,
-    4647, 4649, 4651, 4653, 4655, 4657, 4659, 4661, 4663, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684,
-    4686, 4688, 4690, 4692, 4695, 4697, 4699, 4701, 4703, 4705, 4707, 4709, 4711, 4713, 4715, 4717, 4719, 4721, 4723,
-    4725, 4727, 4730, 4732, 4734, 4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762,
-    4764, 4767, 4769, 4771, 4773, 4775, 4777, 4779, 4781, 4783, 4785, 4787, 4789, 4791, 4793, 4795, 4797, 4799, 4801,
-    4803, 4805, 4807, 4810, 4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836, 4838, 4840,
-    4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862, 4865, 4867, 4869, 4871, 4873, 4875, 4877, 4879,
-    4881, 4883, 4885, 4887, 4889, 4891, 4893, 4895, 4897, 4899, 4901, 4903, 4905, 4907, 4909, 4911, 4913, 4915, 4917,
-    4919, 4921, 4923, 4925, 4927, 4929, 4931, 4933, 4935, 4937, 4939, 4941, 4943, 4945, 4947, 4949, 4951, 4954, 4956,
-    4958, 4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990, 4992, 4994,
-    4996, 4998, 5000, 5002, 5004, 5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022, 5024, 5026, 5028, 5030, 5032,
-    5034, 5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054, 5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070,
-    5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086, 5088, 5090, 5092, 5094, 5095, 5097, 5099, 5101, 5103, 5105, 5107,
-    5109, 5111, 5113, 5115, 5117, 5119, 5121, 5123, 5125, 5127, 5129, 5131, 5133, 5135, 5137, 5139, 5141, 5143, 5145,
-    5147, 5149, 5151, 5153, 5155, 5157, 5159, 5161, 5163, 5165, 5167, 5169, 5171, 5173, 5175, 5177, 5179, 5181, 5182,
-    5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216, 5218, 5220,
-    5222, 5224, 5226, 5228, 5230, 5232, 5233, 5235, 5237, 5239, 5241, 5243, 5245, 5247, 5249, 5251, 5253, 5255, 5257,
-    5259, 5261, 5263, 5265, 5267, 5269, 5271, 5273, 5275, 5276, 5278, 5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294,
-    5296, 5298, 5300, 5302, 5304, 5306, 5308, 5310, 5311, 5313, 5315, 5317, 5319, 5321, 5323, 5325, 5327, 5329, 5331,
-    5333, 5335, 5337, 5339, 5341, 5342, 5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364, 5366, 5368,
-    5370, 5371, 5373, 5375, 5377, 5379, 5381, 5383, 5385, 5387, 5389, 5391, 5393, 5395, 5396, 5398, 5400, 5402, 5404,
-    5406, 5408, 5410, 5412, 5414, 5416, 5418, 5420, 5421, 5423, 5425, 5427, 5429, 5431, 5433, 5435, 5437, 5439, 5441,
-    5443, 5444, 5446, 5448, 5450, 5452, 5454, 5456, 5458, 5460, 5462, 5464, 5465, 5467, 5469, 5471, 5473, 5475, 5477,
-    5479, 5481, 5483, 5485, 5486, 5488, 5490, 5492, 5494, 5496, 5498, 5500, 5502, 5504, 5505, 5507, 5509, 5511, 5513,
-    5515, 5517, 5519, 5521, 5523, 5524, 5526, 5528, 5530, 5532, 5534, 5536, 5538, 5540, 5542, 5543, 5545, 5547, 5549,
-    5551, 5553, 5555, 5557, 5559, 5560, 5562, 5564, 5566, 5568, 5570, 5572, 5574, 5576, 5577, 5579, 5581, 5583, 5585,
-    5587, 5589, 5591, 5592, 5594, 5596, 5598, 5600, 5602, 5604, 5606, 5608, 5609, 5611, 5613, 5615, 5617, 5619, 5621,
-    5623, 5624, 5626, 5628, 5630, 5632, 5634, 5636, 5638, 5639, 5641, 5643, 5645, 5647, 5649, 5651, 5652, 5654, 5656,
-    5658, 5660, 5662, 5664, 5666, 5667, 5669, 5671, 5673, 5675, 5677, 5679, 5680, 5682, 5684, 5686, 5688, 5690, 5692,
-    5694, 5695, 5697, 5699, 5701, 5703, 5705, 5707, 5708, 5710, 5712, 5714, 5716, 5718, 5720, 5721, 5723, 5725, 5727,
-    5729, 5731, 5732, 5734, 5736, 5738, 5740, 5742, 5744, 5745, 5747, 5749, 5751, 5753, 5755, 5757, 5758, 5760, 5762,
-    5764, 5766, 5768, 5769, 5771, 5773, 5775, 5777, 5779, 5780, 5782, 5784, 5786, 5788, 5790, 5792, 5793, 5795, 5797,
-    5799, 5801, 5803, 5804, 5806, 5808, 5810, 5812, 5814, 5815, 5817, 5819, 5821, 5823, 5825, 5826, 5828, 5830, 5832,
-    5834, 5836, 5837, 5839, 5841, 5843, 5845, 5847, 5848, 5850, 5852, 5854, 5856, 5857, 5859, 5861, 5863, 5865, 5867,
-    5868, 5870, 5872, 5874, 5876, 5878, 5879, 5881, 5883, 5885, 5887, 5888, 5890, 5892, 5894, 5896, 5898, 5899, 5901,
-    5903, 5905, 5907, 5908, 5910, 5912, 5914, 5916, 5917, 5919, 5921, 5923, 5925, 5927, 5928, 5930, 5932, 5934, 5936,
-    5937, 5939, 5941, 5943, 5945, 5946, 5948, 5950, 5952, 5954, 5955, 5957, 5959, 5961, 5963, 5964, 5966, 5968, 5970,
-    5972, 5973, 5975, 5977, 5979, 5981, 5982, 5984, 5986, 5988, 5990, 5991, 5993, 5995, 5997, 5999, 6000, 6002, 6004,
-    6006, 6008, 6009, 6011, 6013, 6015, 6016, 6018, 6020, 6022, 6024, 6025, 6027, 6029, 6031, 6033, 6034, 6036, 6038,
-    6040, 6041, 6043, 6045, 6047, 6049, 6050, 6052, 6054, 6056, 6058, 6059, 6061, 6063, 6065, 6066, 6068, 6070, 6072,
-    6074, 6075, 6077, 6079, 6081, 6082, 6084, 6086, 6088, 6089, 6091, 6093, 6095, 6097, 6098, 6100, 6102, 6104, 6105,
-    6107, 6109, 6111, 6112, 6114, 6116, 6118, 6120, 6121, 6123, 6125, 6127, 6128, 6130, 6132, 6134, 6135, 6137, 6139,
-    6141, 6142, 6144, 6146, 6148, 6150, 6151, 6153, 6155, 6157, 6158, 6160, 6162, 6164, 6165, 6167, 6169, 6171, 6172,
-    6174, 6176, 6178, 6179, 6181, 6183, 6185, 6186, 6188, 6190, 6192, 6193, 6195, 6197, 6199, 6200, 6202, 6204, 6206,
-    6207, 6209, 6211, 6213, 6214, 6216, 6218, 6220, 6221, 6223, 6225, 6227, 6228, 6230, 6232, 6234, 6235, 6237, 6239,
-    6240, 6242, 6244, 6246, 6247, 6249, 6251, 6253, 6254, 6256, 6258, 6260, 6261, 6263, 6265, 6267, 6268, 6270, 6272,
-    6273, 6275, 6277, 6279, 6280, 6282, 6284, 6286, 6287, 6289, 6291, 6292, 6294, 6296, 6298, 6299, 6301, 6303, 6305,
-    6306, 6308, 6310, 6311, 6313, 6315, 6317, 6318, 6320, 6322, 6323, 6325, 6327, 6329, 6330, 6332, 6334, 6336, 6337,
-    6339, 6341, 6342, 6344, 6346, 6348, 6349, 6351, 6353, 6354, 6356, 6358, 6359, 6361, 6363, 6365, 6366, 6368, 6370,
-    6371, 6373, 6375, 6377, 6378, 6380, 6382, 6383, 6385, 6387, 6389, 6390, 6392, 6394, 6395, 6397, 6399, 6400, 6402,
-    6404, 6406, 6407, 6409, 6411, 6412, 6414, 6416, 6417, 6419, 6421, 6423, 6424, 6426, 6428, 6429, 6431, 6433, 6434,
-    6436, 6438, 6440, 6441, 6443, 6445, 6446, 6448, 6450, 6451, 6453, 6455, 6456, 6458, 6460, 6461, 6463, 6465, 6467,
-    6468, 6470, 6472, 6473, 6475, 6477, 6478, 6480, 6482, 6483, 6485, 6487, 6488, 6490, 6492, 6493, 6495, 6497, 6499,
-    6500, 6502, 6504, 6505, 6507, 6509, 6510, 6512, 6514, 6515, 6517, 6519, 6520, 6522, 6524, 6525, 6527, 6529, 6530,
-    6532, 6534, 6535, 6537, 6539, 6540, 6542, 6544, 6545, 6547, 6549, 6550, 6552, 6554, 6555, 6557, 6559, 6560, 6562,
-    6564, 6565, 6567, 6569, 6570, 6572, 6574, 6575, 6577, 6579, 6580, 6582, 6584, 6585, 6587, 6589, 6590, 6592, 6594,
-    6595, 6597, 6599, 6600, 6602, 6604, 6605, 6607, 6609, 6610, 6612, 6613, 6615, 6617, 6618, 6620, 6622, 6623, 6625,
-    6627, 6628, 6630, 6632, 6633, 6635, 6637, 6638, 6640, 6642, 6643, 6645, 6646, 6648, 6650, 6651, 6653, 6655, 6656,
-    6658, 6660, 6661, 6663, 6665, 6666, 6668, 6669, 6671, 6673, 6674, 6676, 6678, 6679, 6681, 6683, 6684, 6686, 6687,
-    6689, 6691, 6692, 6694, 6696, 6697, 6699, 6701, 6702, 6704, 6705, 6707, 6709, 6710, 6712, 6714, 6715, 6717, 6718,
-    6720, 6722, 6723, 6725, 6727, 6728, 6730, 6731, 6733, 6735, 6736, 6738, 6740, 6741, 6743, 6744, 6746, 6748, 6749,
-    6751, 6753, 6754, 6756, 6757, 6759, 6761, 6762, 6764, 6766, 6767, 6769, 6770, 6772, 6774, 6775, 6777, 6778, 6780,
-    6782, 6783, 6785, 6787, 6788, 6790, 6791, 6793, 6795, 6796, 6798, 6799, 6801, 6803, 6804, 6806, 6807, 6809, 6811,
-    6812, 6814, 6815, 6817, 6819, 6820, 6822, 6824, 6825, 6827, 6828, 6830, 6832, 6833, 6835, 6836, 6838, 6840, 6841,
-    6843, 6844, 6846, 6848, 6849, 6851, 6852, 6854, 6856, 6857, 6859, 6860, 6862, 6863, 6865, 6867, 6868, 6870, 6871,
-    6873, 6875, 6876, 6878, 6879, 6881, 6883, 6884, 6886, 6887, 6889, 6891, 6892, 6894, 6895, 6897, 6898, 6900, 6902,
-    6903, 6905, 6906, 6908, 6910, 6911, 6913, 6914, 6916, 6917, 6919, 6921, 6922, 6924, 6925, 6927, 6929, 6930, 6932,
-    6933, 6935, 6936, 6938, 6940, 6941, 6943, 6944, 6946, 6947, 6949, 6951, 6952, 6954, 6955, 6957, 6958, 6960, 6962,
-    6963, 6965, 6966, 6968, 6969, 6971, 6973, 6974, 6976, 6977, 6979, 6980, 6982, 6984, 6985, 6987, 6988, 6990, 6991,
-    6993, 6994, 6996, 6998, 6999, 7001, 7002, 7004, 7005, 7007, 7009, 7010, 7012, 7013, 7015, 7016, 7018, 7019, 7021,
-    7023, 7024, 7026, 7027, 7029, 7030, 7032, 7033, 7035, 7037, 7038, 7040, 7041, 7043, 7044, 7046, 7047, 7049, 7051,
-    7052, 7054, 7055, 7057, 7058, 7060, 7061, 7063, 7064, 7066, 7068, 7069, 7071, 7072, 7074, 7075, 7077, 7078, 7080,
-    7081, 7083, 7085, 7086, 7088, 7089, 7091, 7092, 7094, 7095, 7097, 7098, 7100, 7101, 7103, 7105, 7106, 7108, 7109,
-    7111, 7112, 7114, 7115, 7117, 7118, 7120, 7121, 7123, 7124, 7126, 7128, 7129, 7131, 7132, 7134, 7135, 7137, 7138,
-    7140, 7141, 7143, 7144, 7146, 7147, 7149, 7150, 7152, 7154, 7155, 7157, 7158, 7160, 7161, 7163, 7164, 7166, 7167,
-    7169, 7170, 7172, 7173, 7175, 7176, 7178, 7179, 7181, 7182, 7184, 7185, 7187, 7189, 7190, 7192, 7193, 7195, 7196,
-    7198, 7199, 7201, 7202, 7204, 7205, 7207, 7208, 7210, 7211, 7213, 7214, 7216, 7217, 7219, 7220, 7222, 7223, 7225,
-    7226, 7228, 7229, 7231, 7232, 7234, 7235, 7237, 7238, 7240, 7241, 7243, 7244, 7246, 7247, 7249, 7250, 7252, 7253,
-    7255, 7256, 7258, 7259, 7261, 7262, 7264, 7265, 7267, 7268, 7270, 7271, 7273, 7274, 7276, 7277, 7279, 7280, 7282,
-    7283, 7285, 7286, 7288, 7289, 7291, 7292, 7294, 7295, 7297, 7298, 7300, 7301, 7303, 7304, 7306, 7307, 7309, 7310,
-    7312, 7313, 7315, 7316, 7318, 7319, 7321, 7322, 7324, 7325, 7327, 7328, 7329, 7331, 7332, 7334, 7335, 7337, 7338,
-    7340, 7341, 7343, 7344, 7346, 7347, 7349, 7350, 7352, 7353, 7355, 7356, 7358, 7359, 7361, 7362, 7363, 7365, 7366,
-    7368, 7369, 7371, 7372, 7374, 7375, 7377, 7378, 7380, 7381, 7383, 7384, 7386, 7387, 7389, 7390, 7391, 7393, 7394,
-    7396, 7397, 7399, 7400, 7402, 7403, 7405, 7406, 7408, 7409, 7411, 7412, 7413, 7415, 7416, 7418, 7419, 7421, 7422,
-    7424, 7425, 7427, 7428, 7429, 7431, 7432, 7434, 7435, 7437, 7438, 7440, 7441, 7443, 7444, 7446, 7447, 7448, 7450,
-    7451, 7453, 7454, 7456, 7457, 7459, 7460, 7462, 7463, 7464, 7466, 7467, 7469, 7470, 7472, 7473, 7475, 7476, 7477,
-    7479, 7480, 7482, 7483, 7485, 7486, 7488, 7489, 7490, 7492, 7493, 7495, 7496, 7498, 7499, 7501, 7502, 7503, 7505,
-    7506, 7508, 7509, 7511, 7512, 7514, 7515, 7516, 7518, 7519, 7521, 7522, 7524, 7525, 7526, 7528, 7529, 7531, 7532,
-    7534, 7535, 7536, 7538, 7539, 7541, 7542, 7544, 7545, 7547, 7548, 7549, 7551, 7552, 7554, 7555, 7557, 7558, 7559,
-    7561, 7562, 7564, 7565, 7566, 7568, 7569, 7571, 7572, 7574, 7575, 7576, 7578, 7579, 7581, 7582, 7584, 7585, 7586,
-    7588, 7589, 7591, 7592, 7594, 7595, 7596, 7598, 7599, 7601, 7602, 7603, 7605, 7606, 7608, 7609, 7611, 7612, 7613,
-    7615, 7616, 7618, 7619, 7620, 7622, 7623, 7625, 7626, 7627, 7629, 7630, 7632, 7633, 7635, 7636, 7637, 7639, 7640,
-    7642, 7643, 7644, 7646, 7647, 7649, 7650, 7651, 7653, 7654, 7656, 7657, 7658, 7660, 7661, 7663, 7664, 7665, 7667,
-    7668, 7670, 7671, 7672, 7674, 7675, 7677, 7678, 7679, 7681, 7682, 7684, 7685, 7686, 7688, 7689, 7691, 7692, 7693,
-    7695, 7696, 7698, 7699, 7700, 7702, 7703, 7705, 7706, 7707, 7709, 7710, 7712, 7713, 7714, 7716, 7717, 7718, 7720,
-    7721, 7723, 7724, 7725, 7727, 7728, 7730, 7731, 7732, 7734, 7735, 7736, 7738, 7739, 7741, 7742, 7743, 7745, 7746,
-    7748, 7749, 7750, 7752, 7753, 7754, 7756, 7757, 7759, 7760, 7761, 7763, 7764, 7765, 7767, 7768, 7770, 7771, 7772,
-    7774, 7775, 7776, 7778, 7779, 7781, 7782, 7783, 7785, 7786, 7787, 7789, 7790, 7792, 7793, 7794, 7796, 7797, 7798,
-    7800, 7801, 7803, 7804, 7805, 7807, 7808, 7809, 7811, 7812, 7813, 7815, 7816, 7818, 7819, 7820, 7822, 7823, 7824,
-    7826, 7827, 7828, 7830, 7831, 7833, 7834, 7835, 7837, 7838, 7839, 7841, 7842, 7843, 7845, 7846, 7848, 7849, 7850,
-    7852, 7853, 7854, 7856, 7857, 7858, 7860, 7861, 7862, 7864, 7865, 7866, 7868, 7869, 7871, 7872, 7873, 7875, 7876,
-    7877, 7879, 7880, 7881, 7883, 7884, 7885, 7887, 7888, 7889, 7891, 7892, 7893, 7895, 7896, 7898, 7899, 7900, 7902,
-    7903, 7904, 7906, 7907, 7908, 7910, 7911, 7912, 7914, 7915, 7916, 7918, 7919, 7920, 7922, 7923, 7924, 7926, 7927,
-    7928, 7930, 7931, 7932, 7934, 7935, 7936, 7938, 7939, 7940, 7942, 7943, 7944, 7946, 7947, 7948, 7950, 7951, 7952,
-    7954, 7955, 7956, 7958, 7959, 7960, 7962, 7963, 7964, 7966, 7967, 7968, 7970, 7971, 7972, 7974, 7975, 7976, 7978,
-    7979, 7980, 7982, 7983, 7984, 7986, 7987, 7988, 7990, 7991, 7992, 7994, 7995, 7996, 7997, 7999, 8000, 8001, 8003,
-    8004, 8005, 8007, 8008, 8009, 8011, 8012, 8013, 8015, 8016, 8017, 8019, 8020, 8021, 8023, 8024, 8025, 8026, 8028,
-    8029, 8030, 8032, 8033, 8034, 8036, 8037, 8038, 8040, 8041, 8042, 8044, 8045, 8046, 8047, 8049, 8050, 8051, 8053,
-    8054, 8055, 8057, 8058, 8059, 8060, 8062, 8063, 8064, 8066, 8067, 8068, 8070, 8071, 8072, 8074, 8075, 8076, 8077,
-    8079, 8080, 8081, 8083, 8084, 8085, 8087, 8088, 8089, 8090, 8092, 8093, 8094, 8096, 8097, 8098, 8100, 8101, 8102,
-    8103, 8105, 8106, 8107, 8109, 8110, 8111, 8112, 8114, 8115, 8116, 8118, 8119, 8120, 8121, 8123, 8124, 8125, 8127,
-    8128, 8129, 8131, 8132, 8133, 8134, 8136, 8137, 8138, 8140, 8141, 8142, 8143, 8145, 8146, 8147, 8149, 8150, 8151,
-    8152, 8154, 8155, 8156, 8158, 8159, 8160, 8161, 8163, 8164, 8165, 8166, 8168, 8169, 8170, 8172, 8173, 8174, 8175,
-    8177, 8178, 8179, 8181, 8182, 8183, 8184, 8186, 8187, 8188, 8189, 8191, 8192
+#elif IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_9
+const uint16 Ifx_Math_Lut_Atan_F16_table[513] = {
+    0, 20, 41, 61, 81, 102, 122, 143, 163, 183, 204, 224, 244, 265, 285, 305, 326, 346, 367, 387, 407, 428, 448, 468,
+    489, 509, 529, 550, 570, 590, 610, 631, 651, 671, 692, 712, 732, 752, 773, 793, 813, 833, 854, 874, 894, 914, 935,
+    955, 975, 995, 1015, 1036, 1056, 1076, 1096, 1116, 1136, 1156, 1177, 1197, 1217, 1237, 1257, 1277, 1297, 1317, 1337,
+    1357, 1377, 1397, 1417, 1437, 1457, 1477, 1497, 1517, 1537, 1557, 1577, 1597, 1617, 1637, 1656, 1676, 1696, 1716,
+    1736, 1756, 1775, 1795, 1815, 1835, 1854, 1874, 1894, 1914, 1933, 1953, 1973, 1992, 2012, 2031, 2051, 2071, 2090,
+    2110, 2129, 2149, 2168, 2188, 2207, 2227, 2246, 2266, 2285, 2305, 2324, 2343, 2363, 2382, 2401, 2421, 2440, 2459,
+    2478, 2498, 2517, 2536, 2555, 2574, 2594, 2613, 2632, 2651, 2670, 2689, 2708, 2727, 2746, 2765, 2784, 2803, 2822,
+    2841, 2860, 2879, 2897, 2916, 2935, 2954, 2973, 2991, 3010, 3029, 3047, 3066, 3085, 3103, 3122, 3141, 3159, 3178,
+    3196, 3215, 3233, 3252, 3270, 3289, 3307, 3325, 3344, 3362, 3380, 3399, 3417, 3435, 3453, 3472, 3490, 3508, 3526,
+    3544, 3562, 3580, 3599, 3617, 3635, 3653, 3670, 3688, 3706, 3724, 3742, 3760, 3778, 3796, 3813, 3831, 3849, 3867,
+    3884, 3902, 3920, 3937, 3955, 3972, 3990, 4007, 4025, 4042, 4060, 4077, 4095, 4112, 4129, 4147, 4164, 4181, 4199,
+    4216, 4233, 4250, 4267, 4284, 4302, 4319, 4336, 4353, 4370, 4387, 4404, 4421, 4438, 4454, 4471, 4488, 4505, 4522,
+    4539, 4555, 4572, 4589, 4605, 4622, 4639, 4655, 4672, 4688, 4705, 4721, 4738, 4754, 4771, 4787, 4803, 4820, 4836,
+    4852, 4869, 4885, 4901, 4917, 4933, 4949, 4966, 4982, 4998, 5014, 5030, 5046, 5062, 5078, 5094, 5109, 5125, 5141,
+    5157, 5173, 5188, 5204, 5220, 5235, 5251, 5267, 5282, 5298, 5313, 5329, 5344, 5360, 5375, 5391, 5406, 5421, 5437,
+    5452, 5467, 5483, 5498, 5513, 5528, 5543, 5559, 5574, 5589, 5604, 5619, 5634, 5649, 5664, 5679, 5694, 5708, 5723,
+    5738, 5753, 5768, 5782, 5797, 5812, 5826, 5841, 5856, 5870, 5885, 5899, 5914, 5928, 5943, 5957, 5972, 5986, 6000,
+    6015, 6029, 6043, 6058, 6072, 6086, 6100, 6114, 6128, 6142, 6157, 6171, 6185, 6199, 6213, 6227, 6240, 6254, 6268,
+    6282, 6296, 6310, 6323, 6337, 6351, 6365, 6378, 6392, 6406, 6419, 6433, 6446, 6460, 6473, 6487, 6500, 6514, 6527,
+    6540, 6554, 6567, 6580, 6594, 6607, 6620, 6633, 6646, 6660, 6673, 6686, 6699, 6712, 6725, 6738, 6751, 6764, 6777,
+    6790, 6803, 6815, 6828, 6841, 6854, 6867, 6879, 6892, 6905, 6917, 6930, 6943, 6955, 6968, 6980, 6993, 7005, 7018,
+    7030, 7043, 7055, 7068, 7080, 7092, 7105, 7117, 7129, 7141, 7154, 7166, 7178, 7190, 7202, 7214, 7226, 7238, 7250,
+    7262, 7274, 7286, 7298, 7310, 7322, 7334, 7346, 7358, 7369, 7381, 7393, 7405, 7416, 7428, 7440, 7451, 7463, 7475,
+    7486, 7498, 7509, 7521, 7532, 7544, 7555, 7566, 7578, 7589, 7601, 7612, 7623, 7635, 7646, 7657, 7668, 7679, 7691,
+    7702, 7713, 7724, 7735, 7746, 7757, 7768, 7779, 7790, 7801, 7812, 7823, 7834, 7845, 7856, 7866, 7877, 7888, 7899,
+    7910, 7920, 7931, 7942, 7952, 7963, 7974, 7984, 7995, 8005, 8016, 8026, 8037, 8047, 8058, 8068, 8079, 8089, 8100,
+    8110, 8120, 8131, 8141, 8151, 8161, 8172, 8182, 8192
 };
 
 #elif IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_10
-
 const uint16 Ifx_Math_Lut_Atan_F16_table[1025] = {
     0, 10, 20, 31, 41, 51, 61, 71, 81, 92, 102, 112, 122, 132, 143, 153, 163, 173, 183, 194, 204, 214, 224, 234, 244,
     255, 265, 275, 285, 295, 305, 316, 326, 336, 346, 356, 367, 377, 387, 397, 407, 417, 428, 438, 448, 458, 468, 478,
@@ -309,4 +124,330 @@ const uint16 Ifx_Math_Lut_Atan_F16_table[1025] = {
     8105, 8110, 8115, 8120, 8125, 8131, 8136, 8141, 8146, 8151, 8156, 8161, 8166, 8172, 8177, 8182, 8187, 8192
 };
 
+#elif IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_11
+const uint16 Ifx_Math_Lut_Atan_F16_table[2049] = {
+    0, 5, 10, 15, 20, 25, 31, 36, 41, 46, 51, 56, 61, 66, 71, 76, 81, 87, 92, 97, 102, 107, 112, 117, 122, 127, 132,
+    138, 143, 148, 153, 158, 163, 168, 173, 178, 183, 188, 194, 199, 204, 209, 214, 219, 224, 229, 234, 239, 244, 250,
+    255, 260, 265, 270, 275, 280, 285, 290, 295, 300, 305, 311, 316, 321, 326, 331, 336, 341, 346, 351, 356, 361, 367,
+    372, 377, 382, 387, 392, 397, 402, 407, 412, 417, 422, 428, 433, 438, 443, 448, 453, 458, 463, 468, 473, 478, 483,
+    489, 494, 499, 504, 509, 514, 519, 524, 529, 534, 539, 544, 550, 555, 560, 565, 570, 575, 580, 585, 590, 595, 600,
+    605, 610, 616, 621, 626, 631, 636, 641, 646, 651, 656, 661, 666, 671, 676, 681, 687, 692, 697, 702, 707, 712, 717,
+    722, 727, 732, 737, 742, 747, 752, 758, 763, 768, 773, 778, 783, 788, 793, 798, 803, 808, 813, 818, 823, 828, 833,
+    839, 844, 849, 854, 859, 864, 869, 874, 879, 884, 889, 894, 899, 904, 909, 914, 919, 924, 930, 935, 940, 945, 950,
+    955, 960, 965, 970, 975, 980, 985, 990, 995, 1000, 1005, 1010, 1015, 1020, 1025, 1031, 1036, 1041, 1046, 1051, 1056,
+    1061, 1066, 1071, 1076, 1081, 1086, 1091, 1096, 1101, 1106, 1111, 1116, 1121, 1126, 1131, 1136, 1141, 1146, 1151,
+    1156, 1161, 1166, 1172, 1177, 1182, 1187, 1192, 1197, 1202, 1207, 1212, 1217, 1222, 1227, 1232, 1237, 1242, 1247,
+    1252, 1257, 1262, 1267, 1272, 1277, 1282, 1287, 1292, 1297, 1302, 1307, 1312, 1317, 1322, 1327, 1332, 1337, 1342,
+    1347, 1352, 1357, 1362, 1367, 1372, 1377, 1382, 1387, 1392, 1397, 1402, 1407, 1412, 1417, 1422, 1427, 1432, 1437,
+    1442, 1447, 1452, 1457, 1462, 1467, 1472, 1477, 1482, 1487, 1492, 1497, 1502, 1507, 1512, 1517, 1522, 1527, 1532,
+    1537, 1542, 1547, 1552, 1557, 1562, 1567, 1572, 1577, 1582, 1587, 1592, 1597, 1602, 1607, 1612, 1617, 1622, 1627,
+    1632, 1637, 1642, 1646, 1651, 1656, 1661, 1666, 1671, 1676, 1681, 1686, 1691, 1696, 1701, 1706, 1711, 1716, 1721,
+    1726, 1731, 1736, 1741, 1746, 1751, 1756, 1761, 1765, 1770, 1775, 1780, 1785, 1790, 1795, 1800, 1805, 1810, 1815,
+    1820, 1825, 1830, 1835, 1840, 1845, 1849, 1854, 1859, 1864, 1869, 1874, 1879, 1884, 1889, 1894, 1899, 1904, 1909,
+    1914, 1918, 1923, 1928, 1933, 1938, 1943, 1948, 1953, 1958, 1963, 1968, 1973, 1977, 1982, 1987, 1992, 1997, 2002,
+    2007, 2012, 2017, 2022, 2027, 2031, 2036, 2041, 2046, 2051, 2056, 2061, 2066, 2071, 2076, 2080, 2085, 2090, 2095,
+    2100, 2105, 2110, 2115, 2120, 2124, 2129, 2134, 2139, 2144, 2149, 2154, 2159, 2163, 2168, 2173, 2178, 2183, 2188,
+    2193, 2198, 2202, 2207, 2212, 2217, 2222, 2227, 2232, 2237, 2241, 2246, 2251, 2256, 2261, 2266, 2271, 2275, 2280,
+    2285, 2290, 2295, 2300, 2305, 2309, 2314, 2319, 2324, 2329, 2334, 2338, 2343, 2348, 2353, 2358, 2363, 2367, 2372,
+    2377, 2382, 2387, 2392, 2396, 2401, 2406, 2411, 2416, 2421, 2425, 2430, 2435, 2440, 2445, 2450, 2454, 2459, 2464,
+    2469, 2474, 2478, 2483, 2488, 2493, 2498, 2502, 2507, 2512, 2517, 2522, 2526, 2531, 2536, 2541, 2546, 2550, 2555,
+    2560, 2565, 2570, 2574, 2579, 2584, 2589, 2594, 2598, 2603, 2608, 2613, 2617, 2622, 2627, 2632, 2637, 2641, 2646,
+    2651, 2656, 2660, 2665, 2670, 2675, 2679, 2684, 2689, 2694, 2699, 2703, 2708, 2713, 2718, 2722, 2727, 2732, 2737,
+    2741, 2746, 2751, 2756, 2760, 2765, 2770, 2775, 2779, 2784, 2789, 2793, 2798, 2803, 2808, 2812, 2817, 2822, 2827,
+    2831, 2836, 2841, 2846, 2850, 2855, 2860, 2864, 2869, 2874, 2879, 2883, 2888, 2893, 2897, 2902, 2907, 2912, 2916,
+    2921, 2926, 2930, 2935, 2940, 2944, 2949, 2954, 2959, 2963, 2968, 2973, 2977, 2982, 2987, 2991, 2996, 3001, 3005,
+    3010, 3015, 3019, 3024, 3029, 3033, 3038, 3043, 3047, 3052, 3057, 3061, 3066, 3071, 3075, 3080, 3085, 3089, 3094,
+    3099, 3103, 3108, 3113, 3117, 3122, 3127, 3131, 3136, 3141, 3145, 3150, 3155, 3159, 3164, 3168, 3173, 3178, 3182,
+    3187, 3192, 3196, 3201, 3206, 3210, 3215, 3219, 3224, 3229, 3233, 3238, 3243, 3247, 3252, 3256, 3261, 3266, 3270,
+    3275, 3279, 3284, 3289, 3293, 3298, 3302, 3307, 3312, 3316, 3321, 3325, 3330, 3335, 3339, 3344, 3348, 3353, 3358,
+    3362, 3367, 3371, 3376, 3380, 3385, 3390, 3394, 3399, 3403, 3408, 3412, 3417, 3422, 3426, 3431, 3435, 3440, 3444,
+    3449, 3453, 3458, 3463, 3467, 3472, 3476, 3481, 3485, 3490, 3494, 3499, 3503, 3508, 3513, 3517, 3522, 3526, 3531,
+    3535, 3540, 3544, 3549, 3553, 3558, 3562, 3567, 3571, 3576, 3580, 3585, 3589, 3594, 3599, 3603, 3608, 3612, 3617,
+    3621, 3626, 3630, 3635, 3639, 3644, 3648, 3653, 3657, 3662, 3666, 3670, 3675, 3679, 3684, 3688, 3693, 3697, 3702,
+    3706, 3711, 3715, 3720, 3724, 3729, 3733, 3738, 3742, 3747, 3751, 3756, 3760, 3764, 3769, 3773, 3778, 3782, 3787,
+    3791, 3796, 3800, 3804, 3809, 3813, 3818, 3822, 3827, 3831, 3836, 3840, 3844, 3849, 3853, 3858, 3862, 3867, 3871,
+    3875, 3880, 3884, 3889, 3893, 3898, 3902, 3906, 3911, 3915, 3920, 3924, 3928, 3933, 3937, 3942, 3946, 3950, 3955,
+    3959, 3964, 3968, 3972, 3977, 3981, 3985, 3990, 3994, 3999, 4003, 4007, 4012, 4016, 4021, 4025, 4029, 4034, 4038,
+    4042, 4047, 4051, 4055, 4060, 4064, 4069, 4073, 4077, 4082, 4086, 4090, 4095, 4099, 4103, 4108, 4112, 4116, 4121,
+    4125, 4129, 4134, 4138, 4142, 4147, 4151, 4155, 4160, 4164, 4168, 4173, 4177, 4181, 4186, 4190, 4194, 4199, 4203,
+    4207, 4211, 4216, 4220, 4224, 4229, 4233, 4237, 4242, 4246, 4250, 4254, 4259, 4263, 4267, 4272, 4276, 4280, 4284,
+    4289, 4293, 4297, 4302, 4306, 4310, 4314, 4319, 4323, 4327, 4331, 4336, 4340, 4344, 4349, 4353, 4357, 4361, 4366,
+    4370, 4374, 4378, 4383, 4387, 4391, 4395, 4400, 4404, 4408, 4412, 4416, 4421, 4425, 4429, 4433, 4438, 4442, 4446,
+    4450, 4454, 4459, 4463, 4467, 4471, 4476, 4480, 4484, 4488, 4492, 4497, 4501, 4505, 4509, 4513, 4518, 4522, 4526,
+    4530, 4534, 4539, 4543, 4547, 4551, 4555, 4559, 4564, 4568, 4572, 4576, 4580, 4585, 4589, 4593, 4597, 4601, 4605,
+    4610, 4614, 4618, 4622, 4626, 4630, 4634, 4639, 4643, 4647, 4651, 4655, 4659, 4663, 4668, 4672, 4676, 4680, 4684,
+    4688, 4692, 4697, 4701, 4705, 4709, 4713, 4717, 4721, 4725, 4730, 4734, 4738, 4742, 4746, 4750, 4754, 4758, 4762,
+    4767, 4771, 4775, 4779, 4783, 4787, 4791, 4795, 4799, 4803, 4807, 4812, 4816, 4820, 4824, 4828, 4832, 4836, 4840,
+    4844, 4848, 4852, 4856, 4860, 4865, 4869, 4873, 4877, 4881, 4885, 4889, 4893, 4897, 4901, 4905, 4909, 4913, 4917,
+    4921, 4925, 4929, 4933, 4937, 4941, 4945, 4949, 4954, 4958, 4962, 4966, 4970, 4974, 4978, 4982, 4986, 4990, 4994,
+    4998, 5002, 5006, 5010, 5014, 5018, 5022, 5026, 5030, 5034, 5038, 5042, 5046, 5050, 5054, 5058, 5062, 5066, 5070,
+    5074, 5078, 5082, 5086, 5090, 5094, 5097, 5101, 5105, 5109, 5113, 5117, 5121, 5125, 5129, 5133, 5137, 5141, 5145,
+    5149, 5153, 5157, 5161, 5165, 5169, 5173, 5177, 5181, 5184, 5188, 5192, 5196, 5200, 5204, 5208, 5212, 5216, 5220,
+    5224, 5228, 5232, 5235, 5239, 5243, 5247, 5251, 5255, 5259, 5263, 5267, 5271, 5275, 5278, 5282, 5286, 5290, 5294,
+    5298, 5302, 5306, 5310, 5313, 5317, 5321, 5325, 5329, 5333, 5337, 5341, 5344, 5348, 5352, 5356, 5360, 5364, 5368,
+    5371, 5375, 5379, 5383, 5387, 5391, 5395, 5398, 5402, 5406, 5410, 5414, 5418, 5421, 5425, 5429, 5433, 5437, 5441,
+    5444, 5448, 5452, 5456, 5460, 5464, 5467, 5471, 5475, 5479, 5483, 5486, 5490, 5494, 5498, 5502, 5505, 5509, 5513,
+    5517, 5521, 5524, 5528, 5532, 5536, 5540, 5543, 5547, 5551, 5555, 5559, 5562, 5566, 5570, 5574, 5577, 5581, 5585,
+    5589, 5592, 5596, 5600, 5604, 5608, 5611, 5615, 5619, 5623, 5626, 5630, 5634, 5638, 5641, 5645, 5649, 5652, 5656,
+    5660, 5664, 5667, 5671, 5675, 5679, 5682, 5686, 5690, 5694, 5697, 5701, 5705, 5708, 5712, 5716, 5720, 5723, 5727,
+    5731, 5734, 5738, 5742, 5745, 5749, 5753, 5757, 5760, 5764, 5768, 5771, 5775, 5779, 5782, 5786, 5790, 5793, 5797,
+    5801, 5804, 5808, 5812, 5815, 5819, 5823, 5826, 5830, 5834, 5837, 5841, 5845, 5848, 5852, 5856, 5859, 5863, 5867,
+    5870, 5874, 5878, 5881, 5885, 5888, 5892, 5896, 5899, 5903, 5907, 5910, 5914, 5917, 5921, 5925, 5928, 5932, 5936,
+    5939, 5943, 5946, 5950, 5954, 5957, 5961, 5964, 5968, 5972, 5975, 5979, 5982, 5986, 5990, 5993, 5997, 6000, 6004,
+    6008, 6011, 6015, 6018, 6022, 6025, 6029, 6033, 6036, 6040, 6043, 6047, 6050, 6054, 6058, 6061, 6065, 6068, 6072,
+    6075, 6079, 6082, 6086, 6089, 6093, 6097, 6100, 6104, 6107, 6111, 6114, 6118, 6121, 6125, 6128, 6132, 6135, 6139,
+    6142, 6146, 6150, 6153, 6157, 6160, 6164, 6167, 6171, 6174, 6178, 6181, 6185, 6188, 6192, 6195, 6199, 6202, 6206,
+    6209, 6213, 6216, 6220, 6223, 6227, 6230, 6234, 6237, 6240, 6244, 6247, 6251, 6254, 6258, 6261, 6265, 6268, 6272,
+    6275, 6279, 6282, 6286, 6289, 6292, 6296, 6299, 6303, 6306, 6310, 6313, 6317, 6320, 6323, 6327, 6330, 6334, 6337,
+    6341, 6344, 6348, 6351, 6354, 6358, 6361, 6365, 6368, 6371, 6375, 6378, 6382, 6385, 6389, 6392, 6395, 6399, 6402,
+    6406, 6409, 6412, 6416, 6419, 6423, 6426, 6429, 6433, 6436, 6440, 6443, 6446, 6450, 6453, 6456, 6460, 6463, 6467,
+    6470, 6473, 6477, 6480, 6483, 6487, 6490, 6493, 6497, 6500, 6504, 6507, 6510, 6514, 6517, 6520, 6524, 6527, 6530,
+    6534, 6537, 6540, 6544, 6547, 6550, 6554, 6557, 6560, 6564, 6567, 6570, 6574, 6577, 6580, 6584, 6587, 6590, 6594,
+    6597, 6600, 6604, 6607, 6610, 6613, 6617, 6620, 6623, 6627, 6630, 6633, 6637, 6640, 6643, 6646, 6650, 6653, 6656,
+    6660, 6663, 6666, 6669, 6673, 6676, 6679, 6683, 6686, 6689, 6692, 6696, 6699, 6702, 6705, 6709, 6712, 6715, 6718,
+    6722, 6725, 6728, 6731, 6735, 6738, 6741, 6744, 6748, 6751, 6754, 6757, 6761, 6764, 6767, 6770, 6774, 6777, 6780,
+    6783, 6787, 6790, 6793, 6796, 6799, 6803, 6806, 6809, 6812, 6815, 6819, 6822, 6825, 6828, 6832, 6835, 6838, 6841,
+    6844, 6848, 6851, 6854, 6857, 6860, 6863, 6867, 6870, 6873, 6876, 6879, 6883, 6886, 6889, 6892, 6895, 6898, 6902,
+    6905, 6908, 6911, 6914, 6917, 6921, 6924, 6927, 6930, 6933, 6936, 6940, 6943, 6946, 6949, 6952, 6955, 6958, 6962,
+    6965, 6968, 6971, 6974, 6977, 6980, 6984, 6987, 6990, 6993, 6996, 6999, 7002, 7005, 7009, 7012, 7015, 7018, 7021,
+    7024, 7027, 7030, 7033, 7037, 7040, 7043, 7046, 7049, 7052, 7055, 7058, 7061, 7064, 7068, 7071, 7074, 7077, 7080,
+    7083, 7086, 7089, 7092, 7095, 7098, 7101, 7105, 7108, 7111, 7114, 7117, 7120, 7123, 7126, 7129, 7132, 7135, 7138,
+    7141, 7144, 7147, 7150, 7154, 7157, 7160, 7163, 7166, 7169, 7172, 7175, 7178, 7181, 7184, 7187, 7190, 7193, 7196,
+    7199, 7202, 7205, 7208, 7211, 7214, 7217, 7220, 7223, 7226, 7229, 7232, 7235, 7238, 7241, 7244, 7247, 7250, 7253,
+    7256, 7259, 7262, 7265, 7268, 7271, 7274, 7277, 7280, 7283, 7286, 7289, 7292, 7295, 7298, 7301, 7304, 7307, 7310,
+    7313, 7316, 7319, 7322, 7325, 7328, 7331, 7334, 7337, 7340, 7343, 7346, 7349, 7352, 7355, 7358, 7361, 7363, 7366,
+    7369, 7372, 7375, 7378, 7381, 7384, 7387, 7390, 7393, 7396, 7399, 7402, 7405, 7408, 7411, 7413, 7416, 7419, 7422,
+    7425, 7428, 7431, 7434, 7437, 7440, 7443, 7446, 7448, 7451, 7454, 7457, 7460, 7463, 7466, 7469, 7472, 7475, 7477,
+    7480, 7483, 7486, 7489, 7492, 7495, 7498, 7501, 7503, 7506, 7509, 7512, 7515, 7518, 7521, 7524, 7526, 7529, 7532,
+    7535, 7538, 7541, 7544, 7547, 7549, 7552, 7555, 7558, 7561, 7564, 7566, 7569, 7572, 7575, 7578, 7581, 7584, 7586,
+    7589, 7592, 7595, 7598, 7601, 7603, 7606, 7609, 7612, 7615, 7618, 7620, 7623, 7626, 7629, 7632, 7635, 7637, 7640,
+    7643, 7646, 7649, 7651, 7654, 7657, 7660, 7663, 7665, 7668, 7671, 7674, 7677, 7679, 7682, 7685, 7688, 7691, 7693,
+    7696, 7699, 7702, 7705, 7707, 7710, 7713, 7716, 7718, 7721, 7724, 7727, 7730, 7732, 7735, 7738, 7741, 7743, 7746,
+    7749, 7752, 7754, 7757, 7760, 7763, 7765, 7768, 7771, 7774, 7776, 7779, 7782, 7785, 7787, 7790, 7793, 7796, 7798,
+    7801, 7804, 7807, 7809, 7812, 7815, 7818, 7820, 7823, 7826, 7828, 7831, 7834, 7837, 7839, 7842, 7845, 7848, 7850,
+    7853, 7856, 7858, 7861, 7864, 7866, 7869, 7872, 7875, 7877, 7880, 7883, 7885, 7888, 7891, 7893, 7896, 7899, 7902,
+    7904, 7907, 7910, 7912, 7915, 7918, 7920, 7923, 7926, 7928, 7931, 7934, 7936, 7939, 7942, 7944, 7947, 7950, 7952,
+    7955, 7958, 7960, 7963, 7966, 7968, 7971, 7974, 7976, 7979, 7982, 7984, 7987, 7990, 7992, 7995, 7997, 8000, 8003,
+    8005, 8008, 8011, 8013, 8016, 8019, 8021, 8024, 8026, 8029, 8032, 8034, 8037, 8040, 8042, 8045, 8047, 8050, 8053,
+    8055, 8058, 8060, 8063, 8066, 8068, 8071, 8074, 8076, 8079, 8081, 8084, 8087, 8089, 8092, 8094, 8097, 8100, 8102,
+    8105, 8107, 8110, 8112, 8115, 8118, 8120, 8123, 8125, 8128, 8131, 8133, 8136, 8138, 8141, 8143, 8146, 8149, 8151,
+    8154, 8156, 8159, 8161, 8164, 8166, 8169, 8172, 8174, 8177, 8179, 8182, 8184, 8187, 8189, 8192
+};
+
+#elif IFX_MATH_CFG_ATAN_LUT_SIZE == IFX_MATH_USROPT_ATAN_LUT_SIZE_12
+const uint16 Ifx_Math_Lut_Atan_F16_table[4097] = {
+    0, 3, 5, 8, 10, 13, 15, 18, 20, 23, 25, 28, 31, 33, 36, 38, 41, 43, 46, 48, 51, 53, 56, 59, 61, 64, 66, 69, 71, 74,
+    76, 79, 81, 84, 87, 89, 92, 94, 97, 99, 102, 104, 107, 109, 112, 115, 117, 120, 122, 125, 127, 130, 132, 135, 138,
+    140, 143, 145, 148, 150, 153, 155, 158, 160, 163, 166, 168, 171, 173, 176, 178, 181, 183, 186, 188, 191, 194, 196,
+    199, 201, 204, 206, 209, 211, 214, 216, 219, 222, 224, 227, 229, 232, 234, 237, 239, 242, 244, 247, 250, 252, 255,
+    257, 260, 262, 265, 267, 270, 272, 275, 278, 280, 283, 285, 288, 290, 293, 295, 298, 300, 303, 305, 308, 311, 313,
+    316, 318, 321, 323, 326, 328, 331, 333, 336, 339, 341, 344, 346, 349, 351, 354, 356, 359, 361, 364, 367, 369, 372,
+    374, 377, 379, 382, 384, 387, 389, 392, 395, 397, 400, 402, 405, 407, 410, 412, 415, 417, 420, 422, 425, 428, 430,
+    433, 435, 438, 440, 443, 445, 448, 450, 453, 456, 458, 461, 463, 466, 468, 471, 473, 476, 478, 481, 483, 486, 489,
+    491, 494, 496, 499, 501, 504, 506, 509, 511, 514, 517, 519, 522, 524, 527, 529, 532, 534, 537, 539, 542, 544, 547,
+    550, 552, 555, 557, 560, 562, 565, 567, 570, 572, 575, 577, 580, 583, 585, 588, 590, 593, 595, 598, 600, 603, 605,
+    608, 610, 613, 616, 618, 621, 623, 626, 628, 631, 633, 636, 638, 641, 643, 646, 649, 651, 654, 656, 659, 661, 664,
+    666, 669, 671, 674, 676, 679, 681, 684, 687, 689, 692, 694, 697, 699, 702, 704, 707, 709, 712, 714, 717, 720, 722,
+    725, 727, 730, 732, 735, 737, 740, 742, 745, 747, 750, 752, 755, 758, 760, 763, 765, 768, 770, 773, 775, 778, 780,
+    783, 785, 788, 790, 793, 796, 798, 801, 803, 806, 808, 811, 813, 816, 818, 821, 823, 826, 828, 831, 833, 836, 839,
+    841, 844, 846, 849, 851, 854, 856, 859, 861, 864, 866, 869, 871, 874, 876, 879, 882, 884, 887, 889, 892, 894, 897,
+    899, 902, 904, 907, 909, 912, 914, 917, 919, 922, 924, 927, 930, 932, 935, 937, 940, 942, 945, 947, 950, 952, 955,
+    957, 960, 962, 965, 967, 970, 972, 975, 978, 980, 983, 985, 988, 990, 993, 995, 998, 1000, 1003, 1005, 1008, 1010,
+    1013, 1015, 1018, 1020, 1023, 1025, 1028, 1031, 1033, 1036, 1038, 1041, 1043, 1046, 1048, 1051, 1053, 1056, 1058,
+    1061, 1063, 1066, 1068, 1071, 1073, 1076, 1078, 1081, 1083, 1086, 1088, 1091, 1094, 1096, 1099, 1101, 1104, 1106,
+    1109, 1111, 1114, 1116, 1119, 1121, 1124, 1126, 1129, 1131, 1134, 1136, 1139, 1141, 1144, 1146, 1149, 1151, 1154,
+    1156, 1159, 1161, 1164, 1166, 1169, 1172, 1174, 1177, 1179, 1182, 1184, 1187, 1189, 1192, 1194, 1197, 1199, 1202,
+    1204, 1207, 1209, 1212, 1214, 1217, 1219, 1222, 1224, 1227, 1229, 1232, 1234, 1237, 1239, 1242, 1244, 1247, 1249,
+    1252, 1254, 1257, 1259, 1262, 1264, 1267, 1269, 1272, 1274, 1277, 1280, 1282, 1285, 1287, 1290, 1292, 1295, 1297,
+    1300, 1302, 1305, 1307, 1310, 1312, 1315, 1317, 1320, 1322, 1325, 1327, 1330, 1332, 1335, 1337, 1340, 1342, 1345,
+    1347, 1350, 1352, 1355, 1357, 1360, 1362, 1365, 1367, 1370, 1372, 1375, 1377, 1380, 1382, 1385, 1387, 1390, 1392,
+    1395, 1397, 1400, 1402, 1405, 1407, 1410, 1412, 1415, 1417, 1420, 1422, 1425, 1427, 1430, 1432, 1435, 1437, 1440,
+    1442, 1445, 1447, 1450, 1452, 1455, 1457, 1460, 1462, 1465, 1467, 1470, 1472, 1475, 1477, 1480, 1482, 1485, 1487,
+    1490, 1492, 1495, 1497, 1500, 1502, 1505, 1507, 1510, 1512, 1515, 1517, 1520, 1522, 1525, 1527, 1530, 1532, 1535,
+    1537, 1540, 1542, 1545, 1547, 1549, 1552, 1554, 1557, 1559, 1562, 1564, 1567, 1569, 1572, 1574, 1577, 1579, 1582,
+    1584, 1587, 1589, 1592, 1594, 1597, 1599, 1602, 1604, 1607, 1609, 1612, 1614, 1617, 1619, 1622, 1624, 1627, 1629,
+    1632, 1634, 1637, 1639, 1642, 1644, 1646, 1649, 1651, 1654, 1656, 1659, 1661, 1664, 1666, 1669, 1671, 1674, 1676,
+    1679, 1681, 1684, 1686, 1689, 1691, 1694, 1696, 1699, 1701, 1704, 1706, 1709, 1711, 1713, 1716, 1718, 1721, 1723,
+    1726, 1728, 1731, 1733, 1736, 1738, 1741, 1743, 1746, 1748, 1751, 1753, 1756, 1758, 1761, 1763, 1765, 1768, 1770,
+    1773, 1775, 1778, 1780, 1783, 1785, 1788, 1790, 1793, 1795, 1798, 1800, 1803, 1805, 1808, 1810, 1812, 1815, 1817,
+    1820, 1822, 1825, 1827, 1830, 1832, 1835, 1837, 1840, 1842, 1845, 1847, 1849, 1852, 1854, 1857, 1859, 1862, 1864,
+    1867, 1869, 1872, 1874, 1877, 1879, 1882, 1884, 1886, 1889, 1891, 1894, 1896, 1899, 1901, 1904, 1906, 1909, 1911,
+    1914, 1916, 1918, 1921, 1923, 1926, 1928, 1931, 1933, 1936, 1938, 1941, 1943, 1946, 1948, 1950, 1953, 1955, 1958,
+    1960, 1963, 1965, 1968, 1970, 1973, 1975, 1977, 1980, 1982, 1985, 1987, 1990, 1992, 1995, 1997, 2000, 2002, 2004,
+    2007, 2009, 2012, 2014, 2017, 2019, 2022, 2024, 2027, 2029, 2031, 2034, 2036, 2039, 2041, 2044, 2046, 2049, 2051,
+    2054, 2056, 2058, 2061, 2063, 2066, 2068, 2071, 2073, 2076, 2078, 2080, 2083, 2085, 2088, 2090, 2093, 2095, 2098,
+    2100, 2102, 2105, 2107, 2110, 2112, 2115, 2117, 2120, 2122, 2124, 2127, 2129, 2132, 2134, 2137, 2139, 2142, 2144,
+    2146, 2149, 2151, 2154, 2156, 2159, 2161, 2163, 2166, 2168, 2171, 2173, 2176, 2178, 2181, 2183, 2185, 2188, 2190,
+    2193, 2195, 2198, 2200, 2202, 2205, 2207, 2210, 2212, 2215, 2217, 2220, 2222, 2224, 2227, 2229, 2232, 2234, 2237,
+    2239, 2241, 2244, 2246, 2249, 2251, 2254, 2256, 2258, 2261, 2263, 2266, 2268, 2271, 2273, 2275, 2278, 2280, 2283,
+    2285, 2288, 2290, 2292, 2295, 2297, 2300, 2302, 2305, 2307, 2309, 2312, 2314, 2317, 2319, 2321, 2324, 2326, 2329,
+    2331, 2334, 2336, 2338, 2341, 2343, 2346, 2348, 2351, 2353, 2355, 2358, 2360, 2363, 2365, 2367, 2370, 2372, 2375,
+    2377, 2380, 2382, 2384, 2387, 2389, 2392, 2394, 2396, 2399, 2401, 2404, 2406, 2409, 2411, 2413, 2416, 2418, 2421,
+    2423, 2425, 2428, 2430, 2433, 2435, 2437, 2440, 2442, 2445, 2447, 2450, 2452, 2454, 2457, 2459, 2462, 2464, 2466,
+    2469, 2471, 2474, 2476, 2478, 2481, 2483, 2486, 2488, 2490, 2493, 2495, 2498, 2500, 2502, 2505, 2507, 2510, 2512,
+    2514, 2517, 2519, 2522, 2524, 2526, 2529, 2531, 2534, 2536, 2538, 2541, 2543, 2546, 2548, 2550, 2553, 2555, 2558,
+    2560, 2562, 2565, 2567, 2570, 2572, 2574, 2577, 2579, 2582, 2584, 2586, 2589, 2591, 2594, 2596, 2598, 2601, 2603,
+    2605, 2608, 2610, 2613, 2615, 2617, 2620, 2622, 2625, 2627, 2629, 2632, 2634, 2637, 2639, 2641, 2644, 2646, 2648,
+    2651, 2653, 2656, 2658, 2660, 2663, 2665, 2668, 2670, 2672, 2675, 2677, 2679, 2682, 2684, 2687, 2689, 2691, 2694,
+    2696, 2699, 2701, 2703, 2706, 2708, 2710, 2713, 2715, 2718, 2720, 2722, 2725, 2727, 2729, 2732, 2734, 2737, 2739,
+    2741, 2744, 2746, 2748, 2751, 2753, 2756, 2758, 2760, 2763, 2765, 2767, 2770, 2772, 2775, 2777, 2779, 2782, 2784,
+    2786, 2789, 2791, 2793, 2796, 2798, 2801, 2803, 2805, 2808, 2810, 2812, 2815, 2817, 2820, 2822, 2824, 2827, 2829,
+    2831, 2834, 2836, 2838, 2841, 2843, 2846, 2848, 2850, 2853, 2855, 2857, 2860, 2862, 2864, 2867, 2869, 2871, 2874,
+    2876, 2879, 2881, 2883, 2886, 2888, 2890, 2893, 2895, 2897, 2900, 2902, 2904, 2907, 2909, 2912, 2914, 2916, 2919,
+    2921, 2923, 2926, 2928, 2930, 2933, 2935, 2937, 2940, 2942, 2944, 2947, 2949, 2951, 2954, 2956, 2959, 2961, 2963,
+    2966, 2968, 2970, 2973, 2975, 2977, 2980, 2982, 2984, 2987, 2989, 2991, 2994, 2996, 2998, 3001, 3003, 3005, 3008,
+    3010, 3012, 3015, 3017, 3019, 3022, 3024, 3026, 3029, 3031, 3033, 3036, 3038, 3040, 3043, 3045, 3047, 3050, 3052,
+    3054, 3057, 3059, 3061, 3064, 3066, 3068, 3071, 3073, 3075, 3078, 3080, 3082, 3085, 3087, 3089, 3092, 3094, 3096,
+    3099, 3101, 3103, 3106, 3108, 3110, 3113, 3115, 3117, 3120, 3122, 3124, 3127, 3129, 3131, 3134, 3136, 3138, 3141,
+    3143, 3145, 3148, 3150, 3152, 3155, 3157, 3159, 3162, 3164, 3166, 3168, 3171, 3173, 3175, 3178, 3180, 3182, 3185,
+    3187, 3189, 3192, 3194, 3196, 3199, 3201, 3203, 3206, 3208, 3210, 3212, 3215, 3217, 3219, 3222, 3224, 3226, 3229,
+    3231, 3233, 3236, 3238, 3240, 3243, 3245, 3247, 3249, 3252, 3254, 3256, 3259, 3261, 3263, 3266, 3268, 3270, 3272,
+    3275, 3277, 3279, 3282, 3284, 3286, 3289, 3291, 3293, 3296, 3298, 3300, 3302, 3305, 3307, 3309, 3312, 3314, 3316,
+    3319, 3321, 3323, 3325, 3328, 3330, 3332, 3335, 3337, 3339, 3341, 3344, 3346, 3348, 3351, 3353, 3355, 3358, 3360,
+    3362, 3364, 3367, 3369, 3371, 3374, 3376, 3378, 3380, 3383, 3385, 3387, 3390, 3392, 3394, 3396, 3399, 3401, 3403,
+    3406, 3408, 3410, 3412, 3415, 3417, 3419, 3422, 3424, 3426, 3428, 3431, 3433, 3435, 3438, 3440, 3442, 3444, 3447,
+    3449, 3451, 3453, 3456, 3458, 3460, 3463, 3465, 3467, 3469, 3472, 3474, 3476, 3478, 3481, 3483, 3485, 3488, 3490,
+    3492, 3494, 3497, 3499, 3501, 3503, 3506, 3508, 3510, 3513, 3515, 3517, 3519, 3522, 3524, 3526, 3528, 3531, 3533,
+    3535, 3537, 3540, 3542, 3544, 3547, 3549, 3551, 3553, 3556, 3558, 3560, 3562, 3565, 3567, 3569, 3571, 3574, 3576,
+    3578, 3580, 3583, 3585, 3587, 3589, 3592, 3594, 3596, 3599, 3601, 3603, 3605, 3608, 3610, 3612, 3614, 3617, 3619,
+    3621, 3623, 3626, 3628, 3630, 3632, 3635, 3637, 3639, 3641, 3644, 3646, 3648, 3650, 3653, 3655, 3657, 3659, 3662,
+    3664, 3666, 3668, 3670, 3673, 3675, 3677, 3679, 3682, 3684, 3686, 3688, 3691, 3693, 3695, 3697, 3700, 3702, 3704,
+    3706, 3709, 3711, 3713, 3715, 3718, 3720, 3722, 3724, 3726, 3729, 3731, 3733, 3735, 3738, 3740, 3742, 3744, 3747,
+    3749, 3751, 3753, 3756, 3758, 3760, 3762, 3764, 3767, 3769, 3771, 3773, 3776, 3778, 3780, 3782, 3784, 3787, 3789,
+    3791, 3793, 3796, 3798, 3800, 3802, 3804, 3807, 3809, 3811, 3813, 3816, 3818, 3820, 3822, 3824, 3827, 3829, 3831,
+    3833, 3836, 3838, 3840, 3842, 3844, 3847, 3849, 3851, 3853, 3856, 3858, 3860, 3862, 3864, 3867, 3869, 3871, 3873,
+    3875, 3878, 3880, 3882, 3884, 3886, 3889, 3891, 3893, 3895, 3898, 3900, 3902, 3904, 3906, 3909, 3911, 3913, 3915,
+    3917, 3920, 3922, 3924, 3926, 3928, 3931, 3933, 3935, 3937, 3939, 3942, 3944, 3946, 3948, 3950, 3953, 3955, 3957,
+    3959, 3961, 3964, 3966, 3968, 3970, 3972, 3975, 3977, 3979, 3981, 3983, 3985, 3988, 3990, 3992, 3994, 3996, 3999,
+    4001, 4003, 4005, 4007, 4010, 4012, 4014, 4016, 4018, 4021, 4023, 4025, 4027, 4029, 4031, 4034, 4036, 4038, 4040,
+    4042, 4045, 4047, 4049, 4051, 4053, 4055, 4058, 4060, 4062, 4064, 4066, 4069, 4071, 4073, 4075, 4077, 4079, 4082,
+    4084, 4086, 4088, 4090, 4092, 4095, 4097, 4099, 4101, 4103, 4106, 4108, 4110, 4112, 4114, 4116, 4119, 4121, 4123,
+    4125, 4127, 4129, 4132, 4134, 4136, 4138, 4140, 4142, 4145, 4147, 4149, 4151, 4153, 4155, 4158, 4160, 4162, 4164,
+    4166, 4168, 4171, 4173, 4175, 4177, 4179, 4181, 4183, 4186, 4188, 4190, 4192, 4194, 4196, 4199, 4201, 4203, 4205,
+    4207, 4209, 4211, 4214, 4216, 4218, 4220, 4222, 4224, 4227, 4229, 4231, 4233, 4235, 4237, 4239, 4242, 4244, 4246,
+    4248, 4250, 4252, 4254, 4257, 4259, 4261, 4263, 4265, 4267, 4269, 4272, 4274, 4276, 4278, 4280, 4282, 4284, 4287,
+    4289, 4291, 4293, 4295, 4297, 4299, 4302, 4304, 4306, 4308, 4310, 4312, 4314, 4317, 4319, 4321, 4323, 4325, 4327,
+    4329, 4331, 4334, 4336, 4338, 4340, 4342, 4344, 4346, 4349, 4351, 4353, 4355, 4357, 4359, 4361, 4363, 4366, 4368,
+    4370, 4372, 4374, 4376, 4378, 4380, 4383, 4385, 4387, 4389, 4391, 4393, 4395, 4397, 4400, 4402, 4404, 4406, 4408,
+    4410, 4412, 4414, 4416, 4419, 4421, 4423, 4425, 4427, 4429, 4431, 4433, 4435, 4438, 4440, 4442, 4444, 4446, 4448,
+    4450, 4452, 4454, 4457, 4459, 4461, 4463, 4465, 4467, 4469, 4471, 4473, 4476, 4478, 4480, 4482, 4484, 4486, 4488,
+    4490, 4492, 4495, 4497, 4499, 4501, 4503, 4505, 4507, 4509, 4511, 4513, 4516, 4518, 4520, 4522, 4524, 4526, 4528,
+    4530, 4532, 4534, 4536, 4539, 4541, 4543, 4545, 4547, 4549, 4551, 4553, 4555, 4557, 4559, 4562, 4564, 4566, 4568,
+    4570, 4572, 4574, 4576, 4578, 4580, 4582, 4585, 4587, 4589, 4591, 4593, 4595, 4597, 4599, 4601, 4603, 4605, 4607,
+    4610, 4612, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4637, 4639, 4641, 4643, 4645, 4647,
+    4649, 4651, 4653, 4655, 4657, 4659, 4661, 4663, 4666, 4668, 4670, 4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686,
+    4688, 4690, 4692, 4695, 4697, 4699, 4701, 4703, 4705, 4707, 4709, 4711, 4713, 4715, 4717, 4719, 4721, 4723, 4725,
+    4727, 4730, 4732, 4734, 4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764,
+    4767, 4769, 4771, 4773, 4775, 4777, 4779, 4781, 4783, 4785, 4787, 4789, 4791, 4793, 4795, 4797, 4799, 4801, 4803,
+    4805, 4807, 4810, 4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830, 4832, 4834, 4836, 4838, 4840, 4842,
+    4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862, 4865, 4867, 4869, 4871, 4873, 4875, 4877, 4879, 4881,
+    4883, 4885, 4887, 4889, 4891, 4893, 4895, 4897, 4899, 4901, 4903, 4905, 4907, 4909, 4911, 4913, 4915, 4917, 4919,
+    4921, 4923, 4925, 4927, 4929, 4931, 4933, 4935, 4937, 4939, 4941, 4943, 4945, 4947, 4949, 4951, 4954, 4956, 4958,
+    4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990, 4992, 4994, 4996,
+    4998, 5000, 5002, 5004, 5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022, 5024, 5026, 5028, 5030, 5032, 5034,
+    5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054, 5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070, 5072,
+    5074, 5076, 5078, 5080, 5082, 5084, 5086, 5088, 5090, 5092, 5094, 5095, 5097, 5099, 5101, 5103, 5105, 5107, 5109,
+    5111, 5113, 5115, 5117, 5119, 5121, 5123, 5125, 5127, 5129, 5131, 5133, 5135, 5137, 5139, 5141, 5143, 5145, 5147,
+    5149, 5151, 5153, 5155, 5157, 5159, 5161, 5163, 5165, 5167, 5169, 5171, 5173, 5175, 5177, 5179, 5181, 5182, 5184,
+    5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214, 5216, 5218, 5220, 5222,
+    5224, 5226, 5228, 5230, 5232, 5233, 5235, 5237, 5239, 5241, 5243, 5245, 5247, 5249, 5251, 5253, 5255, 5257, 5259,
+    5261, 5263, 5265, 5267, 5269, 5271, 5273, 5275, 5276, 5278, 5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296,
+    5298, 5300, 5302, 5304, 5306, 5308, 5310, 5311, 5313, 5315, 5317, 5319, 5321, 5323, 5325, 5327, 5329, 5331, 5333,
+    5335, 5337, 5339, 5341, 5342, 5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364, 5366, 5368, 5370,
+    5371, 5373, 5375, 5377, 5379, 5381, 5383, 5385, 5387, 5389, 5391, 5393, 5395, 5396, 5398, 5400, 5402, 5404, 5406,
+    5408, 5410, 5412, 5414, 5416, 5418, 5420, 5421, 5423, 5425, 5427, 5429, 5431, 5433, 5435, 5437, 5439, 5441, 5443,
+    5444, 5446, 5448, 5450, 5452, 5454, 5456, 5458, 5460, 5462, 5464, 5465, 5467, 5469, 5471, 5473, 5475, 5477, 5479,
+    5481, 5483, 5485, 5486, 5488, 5490, 5492, 5494, 5496, 5498, 5500, 5502, 5504, 5505, 5507, 5509, 5511, 5513, 5515,
+    5517, 5519, 5521, 5523, 5524, 5526, 5528, 5530, 5532, 5534, 5536, 5538, 5540, 5542, 5543, 5545, 5547, 5549, 5551,
+    5553, 5555, 5557, 5559, 5560, 5562, 5564, 5566, 5568, 5570, 5572, 5574, 5576, 5577, 5579, 5581, 5583, 5585, 5587,
+    5589, 5591, 5592, 5594, 5596, 5598, 5600, 5602, 5604, 5606, 5608, 5609, 5611, 5613, 5615, 5617, 5619, 5621, 5623,
+    5624, 5626, 5628, 5630, 5632, 5634, 5636, 5638, 5639, 5641, 5643, 5645, 5647, 5649, 5651, 5652, 5654, 5656, 5658,
+    5660, 5662, 5664, 5666, 5667, 5669, 5671, 5673, 5675, 5677, 5679, 5680, 5682, 5684, 5686, 5688, 5690, 5692, 5694,
+    5695, 5697, 5699, 5701, 5703, 5705, 5707, 5708, 5710, 5712, 5714, 5716, 5718, 5720, 5721, 5723, 5725, 5727, 5729,
+    5731, 5732, 5734, 5736, 5738, 5740, 5742, 5744, 5745, 5747, 5749, 5751, 5753, 5755, 5757, 5758, 5760, 5762, 5764,
+    5766, 5768, 5769, 5771, 5773, 5775, 5777, 5779, 5780, 5782, 5784, 5786, 5788, 5790, 5792, 5793, 5795, 5797, 5799,
+    5801, 5803, 5804, 5806, 5808, 5810, 5812, 5814, 5815, 5817, 5819, 5821, 5823, 5825, 5826, 5828, 5830, 5832, 5834,
+    5836, 5837, 5839, 5841, 5843, 5845, 5847, 5848, 5850, 5852, 5854, 5856, 5857, 5859, 5861, 5863, 5865, 5867, 5868,
+    5870, 5872, 5874, 5876, 5878, 5879, 5881, 5883, 5885, 5887, 5888, 5890, 5892, 5894, 5896, 5898, 5899, 5901, 5903,
+    5905, 5907, 5908, 5910, 5912, 5914, 5916, 5917, 5919, 5921, 5923, 5925, 5927, 5928, 5930, 5932, 5934, 5936, 5937,
+    5939, 5941, 5943, 5945, 5946, 5948, 5950, 5952, 5954, 5955, 5957, 5959, 5961, 5963, 5964, 5966, 5968, 5970, 5972,
+    5973, 5975, 5977, 5979, 5981, 5982, 5984, 5986, 5988, 5990, 5991, 5993, 5995, 5997, 5999, 6000, 6002, 6004, 6006,
+    6008, 6009, 6011, 6013, 6015, 6016, 6018, 6020, 6022, 6024, 6025, 6027, 6029, 6031, 6033, 6034, 6036, 6038, 6040,
+    6041, 6043, 6045, 6047, 6049, 6050, 6052, 6054, 6056, 6058, 6059, 6061, 6063, 6065, 6066, 6068, 6070, 6072, 6074,
+    6075, 6077, 6079, 6081, 6082, 6084, 6086, 6088, 6089, 6091, 6093, 6095, 6097, 6098, 6100, 6102, 6104, 6105, 6107,
+    6109, 6111, 6112, 6114, 6116, 6118, 6120, 6121, 6123, 6125, 6127, 6128, 6130, 6132, 6134, 6135, 6137, 6139, 6141,
+    6142, 6144, 6146, 6148, 6150, 6151, 6153, 6155, 6157, 6158, 6160, 6162, 6164, 6165, 6167, 6169, 6171, 6172, 6174,
+    6176, 6178, 6179, 6181, 6183, 6185, 6186, 6188, 6190, 6192, 6193, 6195, 6197, 6199, 6200, 6202, 6204, 6206, 6207,
+    6209, 6211, 6213, 6214, 6216, 6218, 6220, 6221, 6223, 6225, 6227, 6228, 6230, 6232, 6234, 6235, 6237, 6239, 6240,
+    6242, 6244, 6246, 6247, 6249, 6251, 6253, 6254, 6256, 6258, 6260, 6261, 6263, 6265, 6267, 6268, 6270, 6272, 6273,
+    6275, 6277, 6279, 6280, 6282, 6284, 6286, 6287, 6289, 6291, 6292, 6294, 6296, 6298, 6299, 6301, 6303, 6305, 6306,
+    6308, 6310, 6311, 6313, 6315, 6317, 6318, 6320, 6322, 6323, 6325, 6327, 6329, 6330, 6332, 6334, 6336, 6337, 6339,
+    6341, 6342, 6344, 6346, 6348, 6349, 6351, 6353, 6354, 6356, 6358, 6359, 6361, 6363, 6365, 6366, 6368, 6370, 6371,
+    6373, 6375, 6377, 6378, 6380, 6382, 6383, 6385, 6387, 6389, 6390, 6392, 6394, 6395, 6397, 6399, 6400, 6402, 6404,
+    6406, 6407, 6409, 6411, 6412, 6414, 6416, 6417, 6419, 6421, 6423, 6424, 6426, 6428, 6429, 6431, 6433, 6434, 6436,
+    6438, 6440, 6441, 6443, 6445, 6446, 6448, 6450, 6451, 6453, 6455, 6456, 6458, 6460, 6461, 6463, 6465, 6467, 6468,
+    6470, 6472, 6473, 6475, 6477, 6478, 6480, 6482, 6483, 6485, 6487, 6488, 6490, 6492, 6493, 6495, 6497, 6499, 6500,
+    6502, 6504, 6505, 6507, 6509, 6510, 6512, 6514, 6515, 6517, 6519, 6520, 6522, 6524, 6525, 6527, 6529, 6530, 6532,
+    6534, 6535, 6537, 6539, 6540, 6542, 6544, 6545, 6547, 6549, 6550, 6552, 6554, 6555, 6557, 6559, 6560, 6562, 6564,
+    6565, 6567, 6569, 6570, 6572, 6574, 6575, 6577, 6579, 6580, 6582, 6584, 6585, 6587, 6589, 6590, 6592, 6594, 6595,
+    6597, 6599, 6600, 6602, 6604, 6605, 6607, 6609, 6610, 6612, 6613, 6615, 6617, 6618, 6620, 6622, 6623, 6625, 6627,
+    6628, 6630, 6632, 6633, 6635, 6637, 6638, 6640, 6642, 6643, 6645, 6646, 6648, 6650, 6651, 6653, 6655, 6656, 6658,
+    6660, 6661, 6663, 6665, 6666, 6668, 6669, 6671, 6673, 6674, 6676, 6678, 6679, 6681, 6683, 6684, 6686, 6687, 6689,
+    6691, 6692, 6694, 6696, 6697, 6699, 6701, 6702, 6704, 6705, 6707, 6709, 6710, 6712, 6714, 6715, 6717, 6718, 6720,
+    6722, 6723, 6725, 6727, 6728, 6730, 6731, 6733, 6735, 6736, 6738, 6740, 6741, 6743, 6744, 6746, 6748, 6749, 6751,
+    6753, 6754, 6756, 6757, 6759, 6761, 6762, 6764, 6766, 6767, 6769, 6770, 6772, 6774, 6775, 6777, 6778, 6780, 6782,
+    6783, 6785, 6787, 6788, 6790, 6791, 6793, 6795, 6796, 6798, 6799, 6801, 6803, 6804, 6806, 6807, 6809, 6811, 6812,
+    6814, 6815, 6817, 6819, 6820, 6822, 6824, 6825, 6827, 6828, 6830, 6832, 6833, 6835, 6836, 6838, 6840, 6841, 6843,
+    6844, 6846, 6848, 6849, 6851, 6852, 6854, 6856, 6857, 6859, 6860, 6862, 6863, 6865, 6867, 6868, 6870, 6871, 6873,
+    6875, 6876, 6878, 6879, 6881, 6883, 6884, 6886, 6887, 6889, 6891, 6892, 6894, 6895, 6897, 6898, 6900, 6902, 6903,
+    6905, 6906, 6908, 6910, 6911, 6913, 6914, 6916, 6917, 6919, 6921, 6922, 6924, 6925, 6927, 6929, 6930, 6932, 6933,
+    6935, 6936, 6938, 6940, 6941, 6943, 6944, 6946, 6947, 6949, 6951, 6952, 6954, 6955, 6957, 6958, 6960, 6962, 6963,
+    6965, 6966, 6968, 6969, 6971, 6973, 6974, 6976, 6977, 6979, 6980, 6982, 6984, 6985, 6987, 6988, 6990, 6991, 6993,
+    6994, 6996, 6998, 6999, 7001, 7002, 7004, 7005, 7007, 7009, 7010, 7012, 7013, 7015, 7016, 7018, 7019, 7021, 7023,
+    7024, 7026, 7027, 7029, 7030, 7032, 7033, 7035, 7037, 7038, 7040, 7041, 7043, 7044, 7046, 7047, 7049, 7051, 7052,
+    7054, 7055, 7057, 7058, 7060, 7061, 7063, 7064, 7066, 7068, 7069, 7071, 7072, 7074, 7075, 7077, 7078, 7080, 7081,
+    7083, 7085, 7086, 7088, 7089, 7091, 7092, 7094, 7095, 7097, 7098, 7100, 7101, 7103, 7105, 7106, 7108, 7109, 7111,
+    7112, 7114, 7115, 7117, 7118, 7120, 7121, 7123, 7124, 7126, 7128, 7129, 7131, 7132, 7134, 7135, 7137, 7138, 7140,
+    7141, 7143, 7144, 7146, 7147, 7149, 7150, 7152, 7154, 7155, 7157, 7158, 7160, 7161, 7163, 7164, 7166, 7167, 7169,
+    7170, 7172, 7173, 7175, 7176, 7178, 7179, 7181, 7182, 7184, 7185, 7187, 7189, 7190, 7192, 7193, 7195, 7196, 7198,
+    7199, 7201, 7202, 7204, 7205, 7207, 7208, 7210, 7211, 7213, 7214, 7216, 7217, 7219, 7220, 7222, 7223, 7225, 7226,
+    7228, 7229, 7231, 7232, 7234, 7235, 7237, 7238, 7240, 7241, 7243, 7244, 7246, 7247, 7249, 7250, 7252, 7253, 7255,
+    7256, 7258, 7259, 7261, 7262, 7264, 7265, 7267, 7268, 7270, 7271, 7273, 7274, 7276, 7277, 7279, 7280, 7282, 7283,
+    7285, 7286, 7288, 7289, 7291, 7292, 7294, 7295, 7297, 7298, 7300, 7301, 7303, 7304, 7306, 7307, 7309, 7310, 7312,
+    7313, 7315, 7316, 7318, 7319, 7321, 7322, 7324, 7325, 7327, 7328, 7329, 7331, 7332, 7334, 7335, 7337, 7338, 7340,
+    7341, 7343, 7344, 7346, 7347, 7349, 7350, 7352, 7353, 7355, 7356, 7358, 7359, 7361, 7362, 7363, 7365, 7366, 7368,
+    7369, 7371, 7372, 7374, 7375, 7377, 7378, 7380, 7381, 7383, 7384, 7386, 7387, 7389, 7390, 7391, 7393, 7394, 7396,
+    7397, 7399, 7400, 7402, 7403, 7405, 7406, 7408, 7409, 7411, 7412, 7413, 7415, 7416, 7418, 7419, 7421, 7422, 7424,
+    7425, 7427, 7428, 7429, 7431, 7432, 7434, 7435, 7437, 7438, 7440, 7441, 7443, 7444, 7446, 7447, 7448, 7450, 7451,
+    7453, 7454, 7456, 7457, 7459, 7460, 7462, 7463, 7464, 7466, 7467, 7469, 7470, 7472, 7473, 7475, 7476, 7477, 7479,
+    7480, 7482, 7483, 7485, 7486, 7488, 7489, 7490, 7492, 7493, 7495, 7496, 7498, 7499, 7501, 7502, 7503, 7505, 7506,
+    7508, 7509, 7511, 7512, 7514, 7515, 7516, 7518, 7519, 7521, 7522, 7524, 7525, 7526, 7528, 7529, 7531, 7532, 7534,
+    7535, 7536, 7538, 7539, 7541, 7542, 7544, 7545, 7547, 7548, 7549, 7551, 7552, 7554, 7555, 7557, 7558, 7559, 7561,
+    7562, 7564, 7565, 7566, 7568, 7569, 7571, 7572, 7574, 7575, 7576, 7578, 7579, 7581, 7582, 7584, 7585, 7586, 7588,
+    7589, 7591, 7592, 7594, 7595, 7596, 7598, 7599, 7601, 7602, 7603, 7605, 7606, 7608, 7609, 7611, 7612, 7613, 7615,
+    7616, 7618, 7619, 7620, 7622, 7623, 7625, 7626, 7627, 7629, 7630, 7632, 7633, 7635, 7636, 7637, 7639, 7640, 7642,
+    7643, 7644, 7646, 7647, 7649, 7650, 7651, 7653, 7654, 7656, 7657, 7658, 7660, 7661, 7663, 7664, 7665, 7667, 7668,
+    7670, 7671, 7672, 7674, 7675, 7677, 7678, 7679, 7681, 7682, 7684, 7685, 7686, 7688, 7689, 7691, 7692, 7693, 7695,
+    7696, 7698, 7699, 7700, 7702, 7703, 7705, 7706, 7707, 7709, 7710, 7712, 7713, 7714, 7716, 7717, 7718, 7720, 7721,
+    7723, 7724, 7725, 7727, 7728, 7730, 7731, 7732, 7734, 7735, 7736, 7738, 7739, 7741, 7742, 7743, 7745, 7746, 7748,
+    7749, 7750, 7752, 7753, 7754, 7756, 7757, 7759, 7760, 7761, 7763, 7764, 7765, 7767, 7768, 7770, 7771, 7772, 7774,
+    7775, 7776, 7778, 7779, 7781, 7782, 7783, 7785, 7786, 7787, 7789, 7790, 7792, 7793, 7794, 7796, 7797, 7798, 7800,
+    7801, 7803, 7804, 7805, 7807, 7808, 7809, 7811, 7812, 7813, 7815, 7816, 7818, 7819, 7820, 7822, 7823, 7824, 7826,
+    7827, 7828, 7830, 7831, 7833, 7834, 7835, 7837, 7838, 7839, 7841, 7842, 7843, 7845, 7846, 7848, 7849, 7850, 7852,
+    7853, 7854, 7856, 7857, 7858, 7860, 7861, 7862, 7864, 7865, 7866, 7868, 7869, 7871, 7872, 7873, 7875, 7876, 7877,
+    7879, 7880, 7881, 7883, 7884, 7885, 7887, 7888, 7889, 7891, 7892, 7893, 7895, 7896, 7898, 7899, 7900, 7902, 7903,
+    7904, 7906, 7907, 7908, 7910, 7911, 7912, 7914, 7915, 7916, 7918, 7919, 7920, 7922, 7923, 7924, 7926, 7927, 7928,
+    7930, 7931, 7932, 7934, 7935, 7936, 7938, 7939, 7940, 7942, 7943, 7944, 7946, 7947, 7948, 7950, 7951, 7952, 7954,
+    7955, 7956, 7958, 7959, 7960, 7962, 7963, 7964, 7966, 7967, 7968, 7970, 7971, 7972, 7974, 7975, 7976, 7978, 7979,
+    7980, 7982, 7983, 7984, 7986, 7987, 7988, 7990, 7991, 7992, 7994, 7995, 7996, 7997, 7999, 8000, 8001, 8003, 8004,
+    8005, 8007, 8008, 8009, 8011, 8012, 8013, 8015, 8016, 8017, 8019, 8020, 8021, 8023, 8024, 8025, 8026, 8028, 8029,
+    8030, 8032, 8033, 8034, 8036, 8037, 8038, 8040, 8041, 8042, 8044, 8045, 8046, 8047, 8049, 8050, 8051, 8053, 8054,
+    8055, 8057, 8058, 8059, 8060, 8062, 8063, 8064, 8066, 8067, 8068, 8070, 8071, 8072, 8074, 8075, 8076, 8077, 8079,
+    8080, 8081, 8083, 8084, 8085, 8087, 8088, 8089, 8090, 8092, 8093, 8094, 8096, 8097, 8098, 8100, 8101, 8102, 8103,
+    8105, 8106, 8107, 8109, 8110, 8111, 8112, 8114, 8115, 8116, 8118, 8119, 8120, 8121, 8123, 8124, 8125, 8127, 8128,
+    8129, 8131, 8132, 8133, 8134, 8136, 8137, 8138, 8140, 8141, 8142, 8143, 8145, 8146, 8147, 8149, 8150, 8151, 8152,
+    8154, 8155, 8156, 8158, 8159, 8160, 8161, 8163, 8164, 8165, 8166, 8168, 8169, 8170, 8172, 8173, 8174, 8175, 8177,
+    8178, 8179, 8181, 8182, 8183, 8184, 8186, 8187, 8188, 8189, 8191, 8192
+};
+
 #endif
@@ -13,28 +13,264 @@
 
 /**
  * Lookup table between 0 and 1
- * Tables are available for IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE = 8, 10, 12 bit
+ * Tables are available for IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE = 8, 9, 10, 11, 12 bit
  * Table size is (2^IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE) + 1
+ * Generated by foc_gen_tables of the host build
  */
 
 #if IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_8
 const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[257] = {
-    0, 2047, 2896, 3547, 4095, 4579, 5016, 5418, 5792, 6143, 6476, 6792, 7094, 7383, 7662, 7931, 8191, 8443, 8688,
-    8926, 9158, 9384, 9605, 9821, 10032, 10239, 10442, 10641, 10836, 11028, 11217, 11402, 11584, 11764, 11941, 12115,
-    12287, 12457, 12624, 12789, 12952, 13113, 13272, 13429, 13584, 13737, 13889, 14039, 14188, 14335, 14481, 14625,
-    14767, 14909, 15049, 15187, 15325, 15461, 15596, 15730, 15863, 15994, 16125, 16254, 16383, 16510, 16637, 16763,
-    16887, 17011, 17134, 17256, 17377, 17497, 17617, 17735, 17853, 17970, 18086, 18202, 18317, 18431, 18544, 18657,
-    18769, 18881, 18991, 19101, 19211, 19320, 19428, 19536, 19643, 19749, 19855, 19960, 20065, 20169, 20273, 20376,
-    20479, 20581, 20683, 20784, 20884, 20985, 21084, 21184, 21282, 21381, 21478, 21576, 21673, 21769, 21865, 21961,
-    22056, 22151, 22246, 22340, 22434, 22527, 22620, 22712, 22804, 22896, 22988, 23079, 23169, 23260, 23350, 23439,
-    23529, 23617, 23706, 23794, 23882, 23970, 24057, 24144, 24231, 24317, 24403, 24489, 24575, 24660, 24745, 24829,
-    24914, 24998, 25082, 25165, 25248, 25331, 25414, 25496, 25578, 25660, 25742, 25823, 25904, 25985, 26065, 26146,
-    26226, 26306, 26385, 26465, 26544, 26623, 26701, 26780, 26858, 26936, 27014, 27091, 27168, 27246, 27322, 27399,
-    27475, 27552, 27628, 27703, 27779, 27854, 27930, 28005, 28079, 28154, 28228, 28303, 28377, 28450, 28524, 28597,
-    28671, 28744, 28817, 28889, 28962, 29034, 29106, 29178, 29250, 29322, 29393, 29464, 29535, 29606, 29677, 29748,
-    29818, 29888, 29958, 30028, 30098, 30168, 30237, 30306, 30375, 30444, 30513, 30582, 30650, 30719, 30787, 30855,
-    30923, 30990, 31058, 31125, 31193, 31260, 31327, 31394, 31461, 31527, 31594, 31660, 31726, 31792, 31858, 31924,
-    31989, 32055, 32120, 32185, 32250, 32315, 32380, 32445, 32509, 32574, 32638, 32702, 32767
+    0, 2047, 2896, 3547, 4095, 4579, 5016, 5418, 5792, 6143, 6476, 6792, 7094, 7383, 7662, 7931, 8191, 8443, 8688, 8926,
+    9158, 9384, 9605, 9821, 10032, 10239, 10442, 10641, 10836, 11028, 11217, 11402, 11584, 11764, 11941, 12115, 12287,
+    12457, 12624, 12789, 12952, 13113, 13272, 13429, 13584, 13737, 13889, 14039, 14188, 14335, 14481, 14625, 14767,
+    14909, 15049, 15187, 15325, 15461, 15596, 15730, 15863, 15994, 16125, 16254, 16383, 16510, 16637, 16763, 16887,
+    17011, 17134, 17256, 17377, 17497, 17617, 17735, 17853, 17970, 18086, 18202, 18317, 18431, 18544, 18657, 18769,
+    18881, 18991, 19101, 19211, 19320, 19428, 19536, 19643, 19749, 19855, 19960, 20065, 20169, 20273, 20376, 20479,
+    20581, 20683, 20784, 20884, 20985, 21084, 21184, 21282, 21381, 21478, 21576, 21673, 21769, 21865, 21961, 22056,
+    22151, 22246, 22340, 22434, 22527, 22620, 22712, 22804, 22896, 22988, 23079, 23169, 23260, 23350, 23439, 23529,
+    23617, 23706, 23794, 23882, 23970, 24057, 24144, 24231, 24317, 24403, 24489, 24575, 24660, 24745, 24829, 24914,
+    24998, 25082, 25165, 25248, 25331, 25414, 25496, 25578, 25660, 25742, 25823, 25904, 25985, 26065, 26146, 26226,
+    26306, 26385, 26465, 26544, 26623, 26701, 26780, 26858, 26936, 27014, 27091, 27168, 27246, 27322, 27399, 27475,
+    27552, 27628, 27703, 27779, 27854, 27930, 28005, 28079, 28154, 28228, 28303, 28377, 28450, 28524, 28597, 28671,
+    28744, 28817, 28889, 28962, 29034, 29106, 29178, 29250, 29322, 29393, 29464, 29535, 29606, 29677, 29748, 29818,
+    29888, 29958, 30028, 30098, 30168, 30237, 30306, 30375, 30444, 30513, 30582, 30650, 30719, 30787, 30855, 30923,
+    30990, 31058, 31125, 31193, 31260, 31327, 31394, 31461, 31527, 31594, 31660, 31726, 31792, 31858, 31924, 31989,
+    32055, 32120, 32185, 32250, 32315, 32380, 32445, 32509, 32574, 32638, 32702, 32767
+};
+
+#elif IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_9
+const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[513] = {
+    0, 1448, 2047, 2508, 2896, 3238, 3547, 3831, 4095, 4344, 4579, 4802, 5016, 5221, 5418, 5608, 5792, 5970, 6143, 6312,
+    6476, 6636, 6792, 6944, 7094, 7240, 7383, 7524, 7662, 7798, 7931, 8062, 8191, 8318, 8443, 8567, 8688, 8808, 8926,
+    9043, 9158, 9272, 9384, 9495, 9605, 9714, 9821, 9927, 10032, 10136, 10239, 10341, 10442, 10542, 10641, 10739, 10836,
+    10932, 11028, 11123, 11217, 11310, 11402, 11494, 11584, 11675, 11764, 11853, 11941, 12028, 12115, 12201, 12287,
+    12372, 12457, 12541, 12624, 12707, 12789, 12871, 12952, 13032, 13113, 13192, 13272, 13350, 13429, 13507, 13584,
+    13661, 13737, 13814, 13889, 13965, 14039, 14114, 14188, 14262, 14335, 14408, 14481, 14553, 14625, 14696, 14767,
+    14838, 14909, 14979, 15049, 15118, 15187, 15256, 15325, 15393, 15461, 15529, 15596, 15663, 15730, 15797, 15863,
+    15929, 15994, 16060, 16125, 16190, 16254, 16319, 16383, 16447, 16510, 16574, 16637, 16700, 16763, 16825, 16887,
+    16949, 17011, 17072, 17134, 17195, 17256, 17316, 17377, 17437, 17497, 17557, 17617, 17676, 17735, 17794, 17853,
+    17912, 17970, 18028, 18086, 18144, 18202, 18259, 18317, 18374, 18431, 18488, 18544, 18601, 18657, 18713, 18769,
+    18825, 18881, 18936, 18991, 19046, 19101, 19156, 19211, 19265, 19320, 19374, 19428, 19482, 19536, 19589, 19643,
+    19696, 19749, 19802, 19855, 19908, 19960, 20013, 20065, 20117, 20169, 20221, 20273, 20325, 20376, 20428, 20479,
+    20530, 20581, 20632, 20683, 20733, 20784, 20834, 20884, 20935, 20985, 21035, 21084, 21134, 21184, 21233, 21282,
+    21331, 21381, 21430, 21478, 21527, 21576, 21624, 21673, 21721, 21769, 21817, 21865, 21913, 21961, 22009, 22056,
+    22104, 22151, 22199, 22246, 22293, 22340, 22387, 22434, 22480, 22527, 22573, 22620, 22666, 22712, 22758, 22804,
+    22850, 22896, 22942, 22988, 23033, 23079, 23124, 23169, 23214, 23260, 23305, 23350, 23394, 23439, 23484, 23529,
+    23573, 23617, 23662, 23706, 23750, 23794, 23838, 23882, 23926, 23970, 24014, 24057, 24101, 24144, 24188, 24231,
+    24274, 24317, 24360, 24403, 24446, 24489, 24532, 24575, 24617, 24660, 24702, 24745, 24787, 24829, 24872, 24914,
+    24956, 24998, 25040, 25082, 25123, 25165, 25207, 25248, 25290, 25331, 25372, 25414, 25455, 25496, 25537, 25578,
+    25619, 25660, 25701, 25742, 25782, 25823, 25864, 25904, 25945, 25985, 26025, 26065, 26106, 26146, 26186, 26226,
+    26266, 26306, 26346, 26385, 26425, 26465, 26504, 26544, 26583, 26623, 26662, 26701, 26741, 26780, 26819, 26858,
+    26897, 26936, 26975, 27014, 27052, 27091, 27130, 27168, 27207, 27246, 27284, 27322, 27361, 27399, 27437, 27475,
+    27514, 27552, 27590, 27628, 27666, 27703, 27741, 27779, 27817, 27854, 27892, 27930, 27967, 28005, 28042, 28079,
+    28117, 28154, 28191, 28228, 28265, 28303, 28340, 28377, 28413, 28450, 28487, 28524, 28561, 28597, 28634, 28671,
+    28707, 28744, 28780, 28817, 28853, 28889, 28925, 28962, 28998, 29034, 29070, 29106, 29142, 29178, 29214, 29250,
+    29286, 29322, 29357, 29393, 29429, 29464, 29500, 29535, 29571, 29606, 29642, 29677, 29712, 29748, 29783, 29818,
+    29853, 29888, 29923, 29958, 29993, 30028, 30063, 30098, 30133, 30168, 30202, 30237, 30272, 30306, 30341, 30375,
+    30410, 30444, 30479, 30513, 30547, 30582, 30616, 30650, 30684, 30719, 30753, 30787, 30821, 30855, 30889, 30923,
+    30957, 30990, 31024, 31058, 31092, 31125, 31159, 31193, 31226, 31260, 31293, 31327, 31360, 31394, 31427, 31461,
+    31494, 31527, 31560, 31594, 31627, 31660, 31693, 31726, 31759, 31792, 31825, 31858, 31891, 31924, 31957, 31989,
+    32022, 32055, 32087, 32120, 32153, 32185, 32218, 32250, 32283, 32315, 32348, 32380, 32413, 32445, 32477, 32509,
+    32542, 32574, 32606, 32638, 32670, 32702, 32734, 32767
+};
+
+#elif IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_10
+const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[1025] = {
+    0, 1023, 1448, 1773, 2047, 2289, 2508, 2709, 2896, 3071, 3238, 3396, 3547, 3691, 3831, 3965, 4095, 4221, 4344, 4463,
+    4579, 4692, 4802, 4910, 5016, 5119, 5221, 5320, 5418, 5514, 5608, 5701, 5792, 5882, 5970, 6057, 6143, 6228, 6312,
+    6394, 6476, 6556, 6636, 6714, 6792, 6868, 6944, 7019, 7094, 7167, 7240, 7312, 7383, 7454, 7524, 7593, 7662, 7730,
+    7798, 7865, 7931, 7997, 8062, 8127, 8191, 8255, 8318, 8381, 8443, 8505, 8567, 8628, 8688, 8748, 8808, 8867, 8926,
+    8985, 9043, 9101, 9158, 9215, 9272, 9328, 9384, 9440, 9495, 9550, 9605, 9660, 9714, 9768, 9821, 9874, 9927, 9980,
+    10032, 10084, 10136, 10188, 10239, 10290, 10341, 10392, 10442, 10492, 10542, 10592, 10641, 10690, 10739, 10788,
+    10836, 10884, 10932, 10980, 11028, 11075, 11123, 11170, 11217, 11263, 11310, 11356, 11402, 11448, 11494, 11539,
+    11584, 11630, 11675, 11719, 11764, 11808, 11853, 11897, 11941, 11985, 12028, 12072, 12115, 12158, 12201, 12244,
+    12287, 12330, 12372, 12414, 12457, 12499, 12541, 12582, 12624, 12665, 12707, 12748, 12789, 12830, 12871, 12911,
+    12952, 12992, 13032, 13073, 13113, 13153, 13192, 13232, 13272, 13311, 13350, 13390, 13429, 13468, 13507, 13545,
+    13584, 13623, 13661, 13699, 13737, 13776, 13814, 13851, 13889, 13927, 13965, 14002, 14039, 14077, 14114, 14151,
+    14188, 14225, 14262, 14298, 14335, 14372, 14408, 14444, 14481, 14517, 14553, 14589, 14625, 14661, 14696, 14732,
+    14767, 14803, 14838, 14874, 14909, 14944, 14979, 15014, 15049, 15084, 15118, 15153, 15187, 15222, 15256, 15291,
+    15325, 15359, 15393, 15427, 15461, 15495, 15529, 15562, 15596, 15630, 15663, 15697, 15730, 15763, 15797, 15830,
+    15863, 15896, 15929, 15962, 15994, 16027, 16060, 16092, 16125, 16157, 16190, 16222, 16254, 16287, 16319, 16351,
+    16383, 16415, 16447, 16479, 16510, 16542, 16574, 16605, 16637, 16669, 16700, 16731, 16763, 16794, 16825, 16856,
+    16887, 16918, 16949, 16980, 17011, 17042, 17072, 17103, 17134, 17164, 17195, 17225, 17256, 17286, 17316, 17347,
+    17377, 17407, 17437, 17467, 17497, 17527, 17557, 17587, 17617, 17646, 17676, 17706, 17735, 17765, 17794, 17824,
+    17853, 17882, 17912, 17941, 17970, 17999, 18028, 18057, 18086, 18115, 18144, 18173, 18202, 18231, 18259, 18288,
+    18317, 18345, 18374, 18402, 18431, 18459, 18488, 18516, 18544, 18573, 18601, 18629, 18657, 18685, 18713, 18741,
+    18769, 18797, 18825, 18853, 18881, 18908, 18936, 18964, 18991, 19019, 19046, 19074, 19101, 19129, 19156, 19184,
+    19211, 19238, 19265, 19293, 19320, 19347, 19374, 19401, 19428, 19455, 19482, 19509, 19536, 19562, 19589, 19616,
+    19643, 19669, 19696, 19723, 19749, 19776, 19802, 19829, 19855, 19881, 19908, 19934, 19960, 19987, 20013, 20039,
+    20065, 20091, 20117, 20143, 20169, 20195, 20221, 20247, 20273, 20299, 20325, 20350, 20376, 20402, 20428, 20453,
+    20479, 20504, 20530, 20556, 20581, 20606, 20632, 20657, 20683, 20708, 20733, 20759, 20784, 20809, 20834, 20859,
+    20884, 20910, 20935, 20960, 20985, 21010, 21035, 21059, 21084, 21109, 21134, 21159, 21184, 21208, 21233, 21258,
+    21282, 21307, 21331, 21356, 21381, 21405, 21430, 21454, 21478, 21503, 21527, 21552, 21576, 21600, 21624, 21649,
+    21673, 21697, 21721, 21745, 21769, 21793, 21817, 21841, 21865, 21889, 21913, 21937, 21961, 21985, 22009, 22033,
+    22056, 22080, 22104, 22128, 22151, 22175, 22199, 22222, 22246, 22269, 22293, 22316, 22340, 22363, 22387, 22410,
+    22434, 22457, 22480, 22504, 22527, 22550, 22573, 22597, 22620, 22643, 22666, 22689, 22712, 22735, 22758, 22781,
+    22804, 22827, 22850, 22873, 22896, 22919, 22942, 22965, 22988, 23010, 23033, 23056, 23079, 23101, 23124, 23147,
+    23169, 23192, 23214, 23237, 23260, 23282, 23305, 23327, 23350, 23372, 23394, 23417, 23439, 23462, 23484, 23506,
+    23529, 23551, 23573, 23595, 23617, 23640, 23662, 23684, 23706, 23728, 23750, 23772, 23794, 23816, 23838, 23860,
+    23882, 23904, 23926, 23948, 23970, 23992, 24014, 24036, 24057, 24079, 24101, 24123, 24144, 24166, 24188, 24209,
+    24231, 24253, 24274, 24296, 24317, 24339, 24360, 24382, 24403, 24425, 24446, 24468, 24489, 24511, 24532, 24553,
+    24575, 24596, 24617, 24639, 24660, 24681, 24702, 24724, 24745, 24766, 24787, 24808, 24829, 24851, 24872, 24893,
+    24914, 24935, 24956, 24977, 24998, 25019, 25040, 25061, 25082, 25102, 25123, 25144, 25165, 25186, 25207, 25227,
+    25248, 25269, 25290, 25310, 25331, 25352, 25372, 25393, 25414, 25434, 25455, 25476, 25496, 25517, 25537, 25558,
+    25578, 25599, 25619, 25640, 25660, 25681, 25701, 25721, 25742, 25762, 25782, 25803, 25823, 25843, 25864, 25884,
+    25904, 25924, 25945, 25965, 25985, 26005, 26025, 26045, 26065, 26086, 26106, 26126, 26146, 26166, 26186, 26206,
+    26226, 26246, 26266, 26286, 26306, 26326, 26346, 26365, 26385, 26405, 26425, 26445, 26465, 26484, 26504, 26524,
+    26544, 26564, 26583, 26603, 26623, 26642, 26662, 26682, 26701, 26721, 26741, 26760, 26780, 26799, 26819, 26838,
+    26858, 26877, 26897, 26916, 26936, 26955, 26975, 26994, 27014, 27033, 27052, 27072, 27091, 27111, 27130, 27149,
+    27168, 27188, 27207, 27226, 27246, 27265, 27284, 27303, 27322, 27342, 27361, 27380, 27399, 27418, 27437, 27456,
+    27475, 27495, 27514, 27533, 27552, 27571, 27590, 27609, 27628, 27647, 27666, 27685, 27703, 27722, 27741, 27760,
+    27779, 27798, 27817, 27836, 27854, 27873, 27892, 27911, 27930, 27948, 27967, 27986, 28005, 28023, 28042, 28061,
+    28079, 28098, 28117, 28135, 28154, 28173, 28191, 28210, 28228, 28247, 28265, 28284, 28303, 28321, 28340, 28358,
+    28377, 28395, 28413, 28432, 28450, 28469, 28487, 28506, 28524, 28542, 28561, 28579, 28597, 28616, 28634, 28652,
+    28671, 28689, 28707, 28725, 28744, 28762, 28780, 28798, 28817, 28835, 28853, 28871, 28889, 28907, 28925, 28944,
+    28962, 28980, 28998, 29016, 29034, 29052, 29070, 29088, 29106, 29124, 29142, 29160, 29178, 29196, 29214, 29232,
+    29250, 29268, 29286, 29304, 29322, 29339, 29357, 29375, 29393, 29411, 29429, 29446, 29464, 29482, 29500, 29518,
+    29535, 29553, 29571, 29588, 29606, 29624, 29642, 29659, 29677, 29695, 29712, 29730, 29748, 29765, 29783, 29800,
+    29818, 29835, 29853, 29871, 29888, 29906, 29923, 29941, 29958, 29976, 29993, 30011, 30028, 30046, 30063, 30080,
+    30098, 30115, 30133, 30150, 30168, 30185, 30202, 30220, 30237, 30254, 30272, 30289, 30306, 30324, 30341, 30358,
+    30375, 30393, 30410, 30427, 30444, 30461, 30479, 30496, 30513, 30530, 30547, 30565, 30582, 30599, 30616, 30633,
+    30650, 30667, 30684, 30701, 30719, 30736, 30753, 30770, 30787, 30804, 30821, 30838, 30855, 30872, 30889, 30906,
+    30923, 30940, 30957, 30973, 30990, 31007, 31024, 31041, 31058, 31075, 31092, 31109, 31125, 31142, 31159, 31176,
+    31193, 31210, 31226, 31243, 31260, 31277, 31293, 31310, 31327, 31344, 31360, 31377, 31394, 31410, 31427, 31444,
+    31461, 31477, 31494, 31510, 31527, 31544, 31560, 31577, 31594, 31610, 31627, 31643, 31660, 31676, 31693, 31709,
+    31726, 31743, 31759, 31776, 31792, 31809, 31825, 31841, 31858, 31874, 31891, 31907, 31924, 31940, 31957, 31973,
+    31989, 32006, 32022, 32038, 32055, 32071, 32087, 32104, 32120, 32136, 32153, 32169, 32185, 32202, 32218, 32234,
+    32250, 32267, 32283, 32299, 32315, 32332, 32348, 32364, 32380, 32396, 32413, 32429, 32445, 32461, 32477, 32493,
+    32509, 32526, 32542, 32558, 32574, 32590, 32606, 32622, 32638, 32654, 32670, 32686, 32702, 32718, 32734, 32750,
+    32767
+};
+
+#elif IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_11
+const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[2049] = {
+    0, 724, 1023, 1254, 1448, 1619, 1773, 1915, 2047, 2172, 2289, 2401, 2508, 2610, 2709, 2804, 2896, 2985, 3071, 3156,
+    3238, 3318, 3396, 3472, 3547, 3620, 3691, 3762, 3831, 3899, 3965, 4031, 4095, 4159, 4221, 4283, 4344, 4404, 4463,
+    4521, 4579, 4636, 4692, 4747, 4802, 4857, 4910, 4963, 5016, 5068, 5119, 5170, 5221, 5271, 5320, 5369, 5418, 5466,
+    5514, 5561, 5608, 5655, 5701, 5747, 5792, 5837, 5882, 5926, 5970, 6014, 6057, 6100, 6143, 6186, 6228, 6270, 6312,
+    6353, 6394, 6435, 6476, 6516, 6556, 6596, 6636, 6675, 6714, 6753, 6792, 6830, 6868, 6907, 6944, 6982, 7019, 7057,
+    7094, 7131, 7167, 7204, 7240, 7276, 7312, 7348, 7383, 7419, 7454, 7489, 7524, 7559, 7593, 7628, 7662, 7696, 7730,
+    7764, 7798, 7831, 7865, 7898, 7931, 7964, 7997, 8030, 8062, 8095, 8127, 8159, 8191, 8223, 8255, 8287, 8318, 8350,
+    8381, 8412, 8443, 8474, 8505, 8536, 8567, 8597, 8628, 8658, 8688, 8718, 8748, 8778, 8808, 8838, 8867, 8897, 8926,
+    8956, 8985, 9014, 9043, 9072, 9101, 9129, 9158, 9187, 9215, 9244, 9272, 9300, 9328, 9356, 9384, 9412, 9440, 9468,
+    9495, 9523, 9550, 9578, 9605, 9632, 9660, 9687, 9714, 9741, 9768, 9794, 9821, 9848, 9874, 9901, 9927, 9954, 9980,
+    10006, 10032, 10058, 10084, 10110, 10136, 10162, 10188, 10214, 10239, 10265, 10290, 10316, 10341, 10366, 10392,
+    10417, 10442, 10467, 10492, 10517, 10542, 10567, 10592, 10616, 10641, 10665, 10690, 10715, 10739, 10763, 10788,
+    10812, 10836, 10860, 10884, 10908, 10932, 10956, 10980, 11004, 11028, 11052, 11075, 11099, 11123, 11146, 11170,
+    11193, 11217, 11240, 11263, 11286, 11310, 11333, 11356, 11379, 11402, 11425, 11448, 11471, 11494, 11516, 11539,
+    11562, 11584, 11607, 11630, 11652, 11675, 11697, 11719, 11742, 11764, 11786, 11808, 11831, 11853, 11875, 11897,
+    11919, 11941, 11963, 11985, 12007, 12028, 12050, 12072, 12094, 12115, 12137, 12158, 12180, 12201, 12223, 12244,
+    12266, 12287, 12308, 12330, 12351, 12372, 12393, 12414, 12436, 12457, 12478, 12499, 12520, 12541, 12561, 12582,
+    12603, 12624, 12645, 12665, 12686, 12707, 12727, 12748, 12768, 12789, 12809, 12830, 12850, 12871, 12891, 12911,
+    12932, 12952, 12972, 12992, 13012, 13032, 13053, 13073, 13093, 13113, 13133, 13153, 13173, 13192, 13212, 13232,
+    13252, 13272, 13291, 13311, 13331, 13350, 13370, 13390, 13409, 13429, 13448, 13468, 13487, 13507, 13526, 13545,
+    13565, 13584, 13603, 13623, 13642, 13661, 13680, 13699, 13718, 13737, 13757, 13776, 13795, 13814, 13833, 13851,
+    13870, 13889, 13908, 13927, 13946, 13965, 13983, 14002, 14021, 14039, 14058, 14077, 14095, 14114, 14132, 14151,
+    14170, 14188, 14206, 14225, 14243, 14262, 14280, 14298, 14317, 14335, 14353, 14372, 14390, 14408, 14426, 14444,
+    14462, 14481, 14499, 14517, 14535, 14553, 14571, 14589, 14607, 14625, 14643, 14661, 14678, 14696, 14714, 14732,
+    14750, 14767, 14785, 14803, 14821, 14838, 14856, 14874, 14891, 14909, 14926, 14944, 14961, 14979, 14996, 15014,
+    15031, 15049, 15066, 15084, 15101, 15118, 15136, 15153, 15170, 15187, 15205, 15222, 15239, 15256, 15273, 15291,
+    15308, 15325, 15342, 15359, 15376, 15393, 15410, 15427, 15444, 15461, 15478, 15495, 15512, 15529, 15546, 15562,
+    15579, 15596, 15613, 15630, 15646, 15663, 15680, 15697, 15713, 15730, 15747, 15763, 15780, 15797, 15813, 15830,
+    15846, 15863, 15879, 15896, 15912, 15929, 15945, 15962, 15978, 15994, 16011, 16027, 16043, 16060, 16076, 16092,
+    16109, 16125, 16141, 16157, 16174, 16190, 16206, 16222, 16238, 16254, 16271, 16287, 16303, 16319, 16335, 16351,
+    16367, 16383, 16399, 16415, 16431, 16447, 16463, 16479, 16495, 16510, 16526, 16542, 16558, 16574, 16590, 16605,
+    16621, 16637, 16653, 16669, 16684, 16700, 16716, 16731, 16747, 16763, 16778, 16794, 16809, 16825, 16841, 16856,
+    16872, 16887, 16903, 16918, 16934, 16949, 16965, 16980, 16996, 17011, 17026, 17042, 17057, 17072, 17088, 17103,
+    17118, 17134, 17149, 17164, 17180, 17195, 17210, 17225, 17241, 17256, 17271, 17286, 17301, 17316, 17332, 17347,
+    17362, 17377, 17392, 17407, 17422, 17437, 17452, 17467, 17482, 17497, 17512, 17527, 17542, 17557, 17572, 17587,
+    17602, 17617, 17631, 17646, 17661, 17676, 17691, 17706, 17720, 17735, 17750, 17765, 17779, 17794, 17809, 17824,
+    17838, 17853, 17868, 17882, 17897, 17912, 17926, 17941, 17955, 17970, 17985, 17999, 18014, 18028, 18043, 18057,
+    18072, 18086, 18101, 18115, 18130, 18144, 18159, 18173, 18188, 18202, 18216, 18231, 18245, 18259, 18274, 18288,
+    18302, 18317, 18331, 18345, 18360, 18374, 18388, 18402, 18417, 18431, 18445, 18459, 18474, 18488, 18502, 18516,
+    18530, 18544, 18558, 18573, 18587, 18601, 18615, 18629, 18643, 18657, 18671, 18685, 18699, 18713, 18727, 18741,
+    18755, 18769, 18783, 18797, 18811, 18825, 18839, 18853, 18867, 18881, 18894, 18908, 18922, 18936, 18950, 18964,
+    18977, 18991, 19005, 19019, 19033, 19046, 19060, 19074, 19088, 19101, 19115, 19129, 19143, 19156, 19170, 19184,
+    19197, 19211, 19224, 19238, 19252, 19265, 19279, 19293, 19306, 19320, 19333, 19347, 19360, 19374, 19387, 19401,
+    19414, 19428, 19441, 19455, 19468, 19482, 19495, 19509, 19522, 19536, 19549, 19562, 19576, 19589, 19603, 19616,
+    19629, 19643, 19656, 19669, 19683, 19696, 19709, 19723, 19736, 19749, 19762, 19776, 19789, 19802, 19815, 19829,
+    19842, 19855, 19868, 19881, 19895, 19908, 19921, 19934, 19947, 19960, 19973, 19987, 20000, 20013, 20026, 20039,
+    20052, 20065, 20078, 20091, 20104, 20117, 20130, 20143, 20156, 20169, 20182, 20195, 20208, 20221, 20234, 20247,
+    20260, 20273, 20286, 20299, 20312, 20325, 20338, 20350, 20363, 20376, 20389, 20402, 20415, 20428, 20440, 20453,
+    20466, 20479, 20492, 20504, 20517, 20530, 20543, 20556, 20568, 20581, 20594, 20606, 20619, 20632, 20645, 20657,
+    20670, 20683, 20695, 20708, 20721, 20733, 20746, 20759, 20771, 20784, 20796, 20809, 20822, 20834, 20847, 20859,
+    20872, 20884, 20897, 20910, 20922, 20935, 20947, 20960, 20972, 20985, 20997, 21010, 21022, 21035, 21047, 21059,
+    21072, 21084, 21097, 21109, 21122, 21134, 21146, 21159, 21171, 21184, 21196, 21208, 21221, 21233, 21245, 21258,
+    21270, 21282, 21295, 21307, 21319, 21331, 21344, 21356, 21368, 21381, 21393, 21405, 21417, 21430, 21442, 21454,
+    21466, 21478, 21491, 21503, 21515, 21527, 21539, 21552, 21564, 21576, 21588, 21600, 21612, 21624, 21637, 21649,
+    21661, 21673, 21685, 21697, 21709, 21721, 21733, 21745, 21757, 21769, 21781, 21793, 21805, 21817, 21829, 21841,
+    21853, 21865, 21877, 21889, 21901, 21913, 21925, 21937, 21949, 21961, 21973, 21985, 21997, 22009, 22021, 22033,
+    22045, 22056, 22068, 22080, 22092, 22104, 22116, 22128, 22139, 22151, 22163, 22175, 22187, 22199, 22210, 22222,
+    22234, 22246, 22258, 22269, 22281, 22293, 22305, 22316, 22328, 22340, 22352, 22363, 22375, 22387, 22398, 22410,
+    22422, 22434, 22445, 22457, 22469, 22480, 22492, 22504, 22515, 22527, 22538, 22550, 22562, 22573, 22585, 22597,
+    22608, 22620, 22631, 22643, 22654, 22666, 22678, 22689, 22701, 22712, 22724, 22735, 22747, 22758, 22770, 22781,
+    22793, 22804, 22816, 22827, 22839, 22850, 22862, 22873, 22885, 22896, 22908, 22919, 22930, 22942, 22953, 22965,
+    22976, 22988, 22999, 23010, 23022, 23033, 23044, 23056, 23067, 23079, 23090, 23101, 23113, 23124, 23135, 23147,
+    23158, 23169, 23181, 23192, 23203, 23214, 23226, 23237, 23248, 23260, 23271, 23282, 23293, 23305, 23316, 23327,
+    23338, 23350, 23361, 23372, 23383, 23394, 23406, 23417, 23428, 23439, 23450, 23462, 23473, 23484, 23495, 23506,
+    23517, 23529, 23540, 23551, 23562, 23573, 23584, 23595, 23606, 23617, 23629, 23640, 23651, 23662, 23673, 23684,
+    23695, 23706, 23717, 23728, 23739, 23750, 23761, 23772, 23783, 23794, 23805, 23816, 23827, 23838, 23849, 23860,
+    23871, 23882, 23893, 23904, 23915, 23926, 23937, 23948, 23959, 23970, 23981, 23992, 24003, 24014, 24025, 24036,
+    24046, 24057, 24068, 24079, 24090, 24101, 24112, 24123, 24133, 24144, 24155, 24166, 24177, 24188, 24199, 24209,
+    24220, 24231, 24242, 24253, 24263, 24274, 24285, 24296, 24307, 24317, 24328, 24339, 24350, 24360, 24371, 24382,
+    24393, 24403, 24414, 24425, 24436, 24446, 24457, 24468, 24479, 24489, 24500, 24511, 24521, 24532, 24543, 24553,
+    24564, 24575, 24585, 24596, 24607, 24617, 24628, 24639, 24649, 24660, 24671, 24681, 24692, 24702, 24713, 24724,
+    24734, 24745, 24755, 24766, 24777, 24787, 24798, 24808, 24819, 24829, 24840, 24851, 24861, 24872, 24882, 24893,
+    24903, 24914, 24924, 24935, 24945, 24956, 24966, 24977, 24987, 24998, 25008, 25019, 25029, 25040, 25050, 25061,
+    25071, 25082, 25092, 25102, 25113, 25123, 25134, 25144, 25155, 25165, 25175, 25186, 25196, 25207, 25217, 25227,
+    25238, 25248, 25259, 25269, 25279, 25290, 25300, 25310, 25321, 25331, 25341, 25352, 25362, 25372, 25383, 25393,
+    25403, 25414, 25424, 25434, 25445, 25455, 25465, 25476, 25486, 25496, 25506, 25517, 25527, 25537, 25547, 25558,
+    25568, 25578, 25588, 25599, 25609, 25619, 25629, 25640, 25650, 25660, 25670, 25681, 25691, 25701, 25711, 25721,
+    25731, 25742, 25752, 25762, 25772, 25782, 25793, 25803, 25813, 25823, 25833, 25843, 25853, 25864, 25874, 25884,
+    25894, 25904, 25914, 25924, 25934, 25945, 25955, 25965, 25975, 25985, 25995, 26005, 26015, 26025, 26035, 26045,
+    26055, 26065, 26076, 26086, 26096, 26106, 26116, 26126, 26136, 26146, 26156, 26166, 26176, 26186, 26196, 26206,
+    26216, 26226, 26236, 26246, 26256, 26266, 26276, 26286, 26296, 26306, 26316, 26326, 26336, 26346, 26356, 26365,
+    26375, 26385, 26395, 26405, 26415, 26425, 26435, 26445, 26455, 26465, 26475, 26484, 26494, 26504, 26514, 26524,
+    26534, 26544, 26554, 26564, 26573, 26583, 26593, 26603, 26613, 26623, 26633, 26642, 26652, 26662, 26672, 26682,
+    26692, 26701, 26711, 26721, 26731, 26741, 26750, 26760, 26770, 26780, 26790, 26799, 26809, 26819, 26829, 26838,
+    26848, 26858, 26868, 26877, 26887, 26897, 26907, 26916, 26926, 26936, 26946, 26955, 26965, 26975, 26985, 26994,
+    27004, 27014, 27023, 27033, 27043, 27052, 27062, 27072, 27081, 27091, 27101, 27111, 27120, 27130, 27140, 27149,
+    27159, 27168, 27178, 27188, 27197, 27207, 27217, 27226, 27236, 27246, 27255, 27265, 27274, 27284, 27294, 27303,
+    27313, 27322, 27332, 27342, 27351, 27361, 27370, 27380, 27389, 27399, 27409, 27418, 27428, 27437, 27447, 27456,
+    27466, 27475, 27485, 27495, 27504, 27514, 27523, 27533, 27542, 27552, 27561, 27571, 27580, 27590, 27599, 27609,
+    27618, 27628, 27637, 27647, 27656, 27666, 27675, 27685, 27694, 27703, 27713, 27722, 27732, 27741, 27751, 27760,
+    27770, 27779, 27789, 27798, 27807, 27817, 27826, 27836, 27845, 27854, 27864, 27873, 27883, 27892, 27901, 27911,
+    27920, 27930, 27939, 27948, 27958, 27967, 27977, 27986, 27995, 28005, 28014, 28023, 28033, 28042, 28051, 28061,
+    28070, 28079, 28089, 28098, 28107, 28117, 28126, 28135, 28145, 28154, 28163, 28173, 28182, 28191, 28200, 28210,
+    28219, 28228, 28238, 28247, 28256, 28265, 28275, 28284, 28293, 28303, 28312, 28321, 28330, 28340, 28349, 28358,
+    28367, 28377, 28386, 28395, 28404, 28413, 28423, 28432, 28441, 28450, 28460, 28469, 28478, 28487, 28496, 28506,
+    28515, 28524, 28533, 28542, 28552, 28561, 28570, 28579, 28588, 28597, 28607, 28616, 28625, 28634, 28643, 28652,
+    28661, 28671, 28680, 28689, 28698, 28707, 28716, 28725, 28735, 28744, 28753, 28762, 28771, 28780, 28789, 28798,
+    28807, 28817, 28826, 28835, 28844, 28853, 28862, 28871, 28880, 28889, 28898, 28907, 28916, 28925, 28935, 28944,
+    28953, 28962, 28971, 28980, 28989, 28998, 29007, 29016, 29025, 29034, 29043, 29052, 29061, 29070, 29079, 29088,
+    29097, 29106, 29115, 29124, 29133, 29142, 29151, 29160, 29169, 29178, 29187, 29196, 29205, 29214, 29223, 29232,
+    29241, 29250, 29259, 29268, 29277, 29286, 29295, 29304, 29313, 29322, 29330, 29339, 29348, 29357, 29366, 29375,
+    29384, 29393, 29402, 29411, 29420, 29429, 29437, 29446, 29455, 29464, 29473, 29482, 29491, 29500, 29509, 29518,
+    29526, 29535, 29544, 29553, 29562, 29571, 29580, 29588, 29597, 29606, 29615, 29624, 29633, 29642, 29650, 29659,
+    29668, 29677, 29686, 29695, 29703, 29712, 29721, 29730, 29739, 29748, 29756, 29765, 29774, 29783, 29792, 29800,
+    29809, 29818, 29827, 29835, 29844, 29853, 29862, 29871, 29879, 29888, 29897, 29906, 29914, 29923, 29932, 29941,
+    29949, 29958, 29967, 29976, 29984, 29993, 30002, 30011, 30019, 30028, 30037, 30046, 30054, 30063, 30072, 30080,
+    30089, 30098, 30107, 30115, 30124, 30133, 30141, 30150, 30159, 30168, 30176, 30185, 30194, 30202, 30211, 30220,
+    30228, 30237, 30246, 30254, 30263, 30272, 30280, 30289, 30298, 30306, 30315, 30324, 30332, 30341, 30349, 30358,
+    30367, 30375, 30384, 30393, 30401, 30410, 30418, 30427, 30436, 30444, 30453, 30461, 30470, 30479, 30487, 30496,
+    30504, 30513, 30522, 30530, 30539, 30547, 30556, 30565, 30573, 30582, 30590, 30599, 30607, 30616, 30625, 30633,
+    30642, 30650, 30659, 30667, 30676, 30684, 30693, 30701, 30710, 30719, 30727, 30736, 30744, 30753, 30761, 30770,
+    30778, 30787, 30795, 30804, 30812, 30821, 30829, 30838, 30846, 30855, 30863, 30872, 30880, 30889, 30897, 30906,
+    30914, 30923, 30931, 30940, 30948, 30957, 30965, 30973, 30982, 30990, 30999, 31007, 31016, 31024, 31033, 31041,
+    31050, 31058, 31066, 31075, 31083, 31092, 31100, 31109, 31117, 31125, 31134, 31142, 31151, 31159, 31168, 31176,
+    31184, 31193, 31201, 31210, 31218, 31226, 31235, 31243, 31252, 31260, 31268, 31277, 31285, 31293, 31302, 31310,
+    31319, 31327, 31335, 31344, 31352, 31360, 31369, 31377, 31385, 31394, 31402, 31410, 31419, 31427, 31436, 31444,
+    31452, 31461, 31469, 31477, 31485, 31494, 31502, 31510, 31519, 31527, 31535, 31544, 31552, 31560, 31569, 31577,
+    31585, 31594, 31602, 31610, 31618, 31627, 31635, 31643, 31652, 31660, 31668, 31676, 31685, 31693, 31701, 31709,
+    31718, 31726, 31734, 31743, 31751, 31759, 31767, 31776, 31784, 31792, 31800, 31809, 31817, 31825, 31833, 31841,
+    31850, 31858, 31866, 31874, 31883, 31891, 31899, 31907, 31915, 31924, 31932, 31940, 31948, 31957, 31965, 31973,
+    31981, 31989, 31997, 32006, 32014, 32022, 32030, 32038, 32047, 32055, 32063, 32071, 32079, 32087, 32096, 32104,
+    32112, 32120, 32128, 32136, 32145, 32153, 32161, 32169, 32177, 32185, 32194, 32202, 32210, 32218, 32226, 32234,
+    32242, 32250, 32259, 32267, 32275, 32283, 32291, 32299, 32307, 32315, 32324, 32332, 32340, 32348, 32356, 32364,
+    32372, 32380, 32388, 32396, 32405, 32413, 32421, 32429, 32437, 32445, 32453, 32461, 32469, 32477, 32485, 32493,
+    32501, 32509, 32518, 32526, 32534, 32542, 32550, 32558, 32566, 32574, 32582, 32590, 32598, 32606, 32614, 32622,
+    32630, 32638, 32646, 32654, 32662, 32670, 32678, 32686, 32694, 32702, 32710, 32718, 32726, 32734, 32742, 32750,
+    32758, 32767
 };
 
 #elif IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_12
@@ -294,73 +530,4 @@ const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[4097] = {
     32754, 32758, 32762, 32767
 };
 
-#elif IFX_MATH_CFG_CARTTOPOLAR_LUT_SIZE == IFX_MATH_USROPT_CARTTOPOLAR_LUT_SIZE_10
-
-const Ifx_Math_Fract16 Ifx_Math_Lut_CartToPolar_F16_table[1025] = {
-    0, 1023, 1448, 1773, 2047, 2289, 2508, 2709, 2896, 3071, 3238, 3396, 3547, 3691, 3831, 3965, 4095, 4221, 4344,
-    4463, 4579, 4692, 4802, 4910, 5016, 5119, 5221, 5320, 5418, 5514, 5608, 5701, 5792, 5882, 5970, 6057, 6143, 6228,
-    6312, 6394, 6476, 6556, 6636, 6714, 6792, 6868, 6944, 7019, 7094, 7167, 7240, 7312, 7383, 7454, 7524, 7593, 7662,
-    7730, 7798, 7865, 7931, 7997, 8062, 8127, 8191, 8255, 8318, 8381, 8443, 8505, 8567, 8628, 8688, 8748, 8808, 8867,
-    8926, 8985, 9043, 9101, 9158, 9215, 9272, 9328, 9384, 9440, 9495, 9550, 9605, 9660, 9714, 9768, 9821, 9874, 9927,
-    9980, 10032, 10084, 10136, 10188, 10239, 10290, 10341, 10392, 10442, 10492, 10542, 10592, 10641, 10690, 10739,
-    10788, 10836, 10884, 10932, 10980, 11028, 11075, 11123, 11170, 11217, 11263, 11310, 11356, 11402, 11448, 11494,
-    11539, 11584, 11630, 11675, 11719, 11764, 11808, 11853, 11897, 11941, 11985, 12028, 12072, 12115, 12158, 12201,
-    12244, 12287, 12330, 12372, 12414, 12457, 12499, 12541, 12582, 12624, 12665, 12707, 12748, 12789, 12830, 12871,
-    12911, 12952, 12992, 13032, 13073, 13113, 13153, 13192, 13232, 13272, 13311, 13350, 13390, 13429, 13468, 13507,
-    13545, 13584, 13623, 13661, 13699, 13737, 13776, 13814, 13851, 13889, 13927, 13965, 14002, 14039, 14077, 14114,
-    14151, 14188, 14225, 14262, 14298, 14335, 14372, 14408, 14444, 14481, 14517, 14553, 14589, 14625, 14661, 14696,
-    14732, 14767, 14803, 14838, 14874, 14909, 14944, 14979, 15014, 15049, 15084, 15118, 15153, 15187, 15222, 15256,
-    15291, 15325, 15359, 15393, 15427, 15461, 15495, 15529, 15562, 15596, 15630, 15663, 15697, 15730, 15763, 15797,
-    15830, 15863, 15896, 15929, 15962, 15994, 16027, 16060, 16092, 16125, 16157, 16190, 16222, 16254, 16287, 16319,
-    16351, 16383, 16415, 16447, 16479, 16510, 16542, 16574, 16605, 16637, 16669, 16700, 16731, 16763, 16794, 16825,
-    16856, 16887, 16918, 16949, 16980, 17011, 17042, 17072, 17103, 17134, 17164, 17195, 17225, 17256, 17286, 17316,
-    17347, 17377, 17407, 17437, 17467, 17497, 17527, 17557, 17587, 17617, 17646, 17676, 17706, 17735, 17765, 17794,
-    17824, 17853, 17882, 17912, 17941, 17970, 17999, 18028, 18057, 18086, 18115, 18144, 18173, 18202, 18231, 18259,
-    18288, 18317, 18345, 18374, 18402, 18431, 18459, 18488, 18516, 18544, 18573, 18601, 18629, 18657, 18685, 18713,
-    18741, 18769, 18797, 18825, 18853, 18881, 18908, 18936, 18964, 18991, 19019, 19046, 19074, 19101, 19129, 19156,
-    19184, 19211, 19238, 19265, 19293, 19320, 19347, 19374, 19401, 19428, 19455, 19482, 19509, 19536, 19562, 19589,
-    19616, 19643, 19669, 19696, 19723, 19749, 19776, 19802, 19829, 19855, 19881, 19908, 19934, 19960, 19987, 20013,
-    20039, 20065, 20091, 20117, 20143, 20169, 20195, 20221, 20247, 20273, 20299, 20325, 20350, 20376, 20402, 20428,
-    20453, 20479, 20504, 20530, 20556, 20581, 20606, 20632, 20657, 20683, 20708, 20733, 20759, 20784, 20809, 20834,
-    20859, 20884, 20910, 20935, 20960, 20985, 21010, 21035, 21059, 21084, 21109, 21134, 21159, 21184, 21208, 21233,
-    21258, 21282, 21307, 21331, 21356, 21381, 21405, 21430, 21454, 21478, 21503, 21527, 21552, 21576, 21600, 21624,
-    21649, 21673, 21697, 21721, 21745, 21769, 21793, 21817, 21841, 21865, 21889, 21913, 21937, 21961, 21985, 22009,
-    22033, 22056, 22080, 22104, 22128, 22151, 22175, 22199, 22222, 22246, 22269, 22293, 22316, 22340, 22363, 22387,
-    22410, 22434, 22457, 22480, 22504, 22527, 22550, 22573, 22597, 22620, 22643, 22666, 22689, 22712, 22735, 22758,
-    22781, 22804, 22827, 22850, 22873, 22896, 22919, 22942, 22965, 22988, 23010, 23033, 23056, 23079, 23101, 23124,
-    23147, 23169, 23192, 23214, 23237, 23260, 23282, 23305, 23327, 23350, 23372, 23394, 23417, 23439, 23462, 23484,
-    23506, 23529, 23551, 23573, 23595, 23617, 23640, 23662, 23684, 23706, 23728, 23750, 23772, 23794, 23816, 23838,
-    23860, 23882, 23904, 23926, 23948, 23970, 23992, 24014, 24036, 24057, 24079, 24101, 24123, 24144, 24166, 24188,
-    24209, 24231, 24253, 24274, 24296, 24317, 24339, 24360, 24382, 24403, 24425, 24446, 24468, 24489, 24511, 24532,
-    24553, 24575, 24596, 24617, 24639, 24660, 24681, 24702, 24724, 24745, 24766, 24787, 24808, 24829, 24851, 24872,
-    24893, 24914, 24935, 24956, 24977, 24998, 25019, 25040, 25061, 25082, 25102, 25123, 25144, 25165, 25186, 25207,
-    25227, 25248, 25269, 25290, 25310, 25331, 25352, 25372, 25393, 25414, 25434, 25455, 25476, 25496, 25517, 25537,
-    25558, 25578, 25599, 25619, 25640, 25660, 25681, 25701, 25721, 25742, 25762, 25782, 25803, 25823, 25843, 25864,
-    25884, 25904, 25924, 25945, 25965, 25985, 26005, 26025, 26045, 26065, 26086, 26106, 26126, 26146, 26166, 26186,
-    26206, 26226, 26246, 26266, 26286, 26306, 26326, 26346, 26365, 26385, 26405, 26425, 26445, 26465, 26484, 26504,
-    26524, 26544, 26564, 26583, 26603, 26623, 26642, 26662, 26682, 26701, 26721, 26741, 26760, 26780, 26799, 26819,
-    26838, 26858, 26877, 26897, 26916, 26936, 26955, 26975, 26994, 27014, 27033, 27052, 27072, 27091, 27111, 27130,
-    27149, 27168, 27188, 27207, 27226, 27246, 27265, 27284, 27303, 27322, 27342, 27361, 27380, 27399, 27418, 27437,
-    27456, 27475, 27495, 27514, 27533, 27552, 27571, 27590, 27609, 27628, 27647, 27666, 27685, 27703, 27722, 27741,
-    27760, 27779, 27798, 27817, 27836, 27854, 27873, 27892, 27911, 27930, 27948, 27967, 27986, 28005, 28023, 28042,
-    28061, 28079, 28098, 28117, 28135, 28154, 28173, 28191, 28210, 28228, 28247, 28265, 28284, 28303, 28321, 28340,
-    28358, 28377, 28395, 28413, 28432, 28450, 28469, 28487, 28506, 28524, 28542, 28561, 28579, 28597, 28616, 28634,
-    28652, 28671, 28689, 28707, 28725, 28744, 28762, 28780, 28798, 28817, 28835, 28853, 28871, 28889, 28907, 28925,
-    28944, 28962, 28980, 28998, 29016, 29034, 29052, 29070, 29088, 29106, 29124, 29142, 29160, 29178, 29196, 29214,
-    29232, 29250, 29268, 29286, 29304, 29322, 29339, 29357, 29375, 29393, 29411, 29429, 29446, 29464, 29482, 29500,
-    29518, 29535, 29553, 29571, 29588, 29606, 29624, 29642, 29659, 29677, 29695, 29712, 29730, 29748, 29765, 29783,
-    29800, 29818, 29835, 29853, 29871, 29888, 29906, 29923, 29941, 29958, 29976, 29993, 30011, 30028, 30046, 30063,
-    30080, 30098, 30115, 30133, 30150, 30168, 30185, 30202, 30220, 30237, 30254, 30272, 30289, 30306, 30324, 30341,
-    30358, 30375, 30393, 30410, 30427, 30444, 30461, 30479, 30496, 30513, 30530, 30547, 30565, 30582, 30599, 30616,
-    30633, 30650, 30667, 30684, 30701, 30719, 30736, 30753, 30770, 30787, 30804, 30821, 30838, 30855, 30872, 30889,
-    30906, 30923, 30940, 30957, 30973, 30990, 31007, 31024, 31041, 31058, 31075, 31092, 31109, 31125, 31142, 31159,
-    31176, 31193, 31210, 31226, 31243, 31260, 31277, 31293, 31310, 31327, 31344, 31360, 31377, 31394, 31410, 31427,
-    31444, 31461, 31477, 31494, 31510, 31527, 31544, 31560, 31577, 31594, 31610, 31627, 31643, 31660, 31676, 31693,
-    31709, 31726, 31743, 31759, 31776, 31792, 31809, 31825, 31841, 31858, 31874, 31891, 31907, 31924, 31940, 31957,
-    31973, 31989, 32006, 32022, 32038, 32055, 32071, 32087, 32104, 32120, 32136, 32153, 32169, 32185, 32202, 32218,
-    32234, 32250, 32267, 32283, 32299, 32315, 32332, 32348, 32364, 32380, 32396, 32413, 32429, 32445, 32461, 32477,
-    32493, 32509, 32526, 32542, 32558, 32574, 32590, 32606, 32622, 32638, 32654, 32670, 32686, 32702, 32718, 32734,
-    32750, 32767
-};
-
 #endif
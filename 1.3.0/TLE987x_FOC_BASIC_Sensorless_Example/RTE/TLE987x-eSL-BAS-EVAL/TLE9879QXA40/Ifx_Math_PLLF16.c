@@ -12,10 +12,12 @@
 
 /* Arithmetic functions */
 #include "Ifx_Math_Add.h"
+#include "Ifx_Math_AddSat.h"
 #include "Ifx_Math_ShR.h"
 #include "Ifx_Math_ShL.h"
 #include "Ifx_Math_Sub.h"
 #include "Ifx_Math_MulShR.h"
+#include "Ifx_Math_Sat.h"
 
 /* Shift factor for the average rate of change of the input angle */
 #if IFX_MATH_CFG_PLL_DELAY_LENGTH == IFX_MATH_USROPT_PLL_DELAY_32
@@ -66,6 +68,19 @@ static inline void Ifx_Math_PLLF16_p_speedCalc(Ifx_Math_PLLF16* self, Ifx_Math_F
  *  \return Converted angle in Ifx_Math_Fract16 format
  */
 static inline Ifx_Math_Fract16 Ifx_Math_PLLF16_p_convAngle(uint32 input);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+/**
+ *  \brief Integrate the angle error multiplied by the integral gain and the square of the sampling time
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] deltaPhiQ15 Angle error between the input angle and previous angle, in Q15
+ *
+ *  \return Integral path, as angle variation per sampling time in the 32-bit angle format
+ */
+static inline Ifx_Math_Fract32 Ifx_Math_PLLF16_p_integCalc(Ifx_Math_PLLF16* self, Ifx_Math_Fract16 deltaPhiQ15);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
 
 /* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
  * argument." */
@@ -77,6 +92,14 @@ void Ifx_Math_PLLF16_init(Ifx_Math_PLLF16* self)
     self->p_samplingTime_us      = 0;
     self->p_propGainSamplingTime = 0;
     self->p_previousValue        = 0;
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* Initialize the integral path */
+    self->p_integGain.value          = 0;
+    self->p_integGain.qFormat        = Ifx_Math_FractQFormat_q0;
+    self->p_integGainSamplingTimeQ31 = 0;
+    self->p_integral                 = 0;
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
 
     /* Initialize buffer contents */
     self->p_bufferIndex = 0;
@@ -97,6 +120,11 @@ void Ifx_Math_PLLF16_resetBuffer(Ifx_Math_PLLF16* self)
     {
         self->p_buffer[i] = 0;
     }
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* The integral path belongs to the rate of the buffer */
+    self->p_integral = 0;
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
 }
 
 
@@ -120,6 +148,16 @@ Ifx_Math_PLLF16_Type Ifx_Math_PLLF16_execute(Ifx_Math_PLLF16* self, uint32 input
 
     /* Calculate the speed from average rate and integrate */
     Ifx_Math_PLLF16_p_speedCalc(self, inputKpQ24, speedQ15);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* Integral path, added to the angle and to the average rate */
+    Ifx_Math_Fract32     integral = Ifx_Math_PLLF16_p_integCalc(self, deltaPhiQ15);
+    self->p_previousValue = self->p_previousValue + (uint32)integral;
+
+    /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    speedQ15 = Ifx_Math_AddSat_F16(speedQ15, (Ifx_Math_Fract16)(integral >> 16));
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
 
     /* Return the output angle variation, in 16-bit fractional format, and the angle in 32-bit */
     output.deltaAngle = speedQ15;
@@ -130,6 +168,29 @@ Ifx_Math_PLLF16_Type Ifx_Math_PLLF16_execute(Ifx_Math_PLLF16* self, uint32 input
 
 
 void Ifx_Math_PLLF16_setPropGain(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q propGain)
+{
+    /* Calculate the proportional gain * sampling time with the sampling time set before */
+    self->p_propGainSamplingTime = Ifx_Math_PLLF16_calcPropGainSamplingTime(propGain, self->p_samplingTime_us);
+    self->p_propGain             = propGain;
+}
+
+
+void Ifx_Math_PLLF16_setSamplingTime_us(Ifx_Math_PLLF16* self, uint32 samplingTime_us)
+{
+    /* Calculate the proportional gain * sampling time, keeping the integral proportional Q format */
+    self->p_propGainSamplingTime = Ifx_Math_PLLF16_calcPropGainSamplingTime(self->p_propGain, samplingTime_us);
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* Calculate the integral gain * sampling time^2 */
+    self->p_integGainSamplingTimeQ31 = Ifx_Math_PLLF16_calcIntegGainSamplingTime(self->p_integGain,
+        samplingTime_us);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
+    self->p_samplingTime_us = samplingTime_us;
+}
+
+
+Ifx_Math_Fract16 Ifx_Math_PLLF16_calcPropGainSamplingTime(Ifx_Math_Fract16Q propGain, uint32 samplingTime_us)
 {
     /* Represents the sampling time in Q30 format */
     Ifx_Math_Fract32 samplingTimeQ30;
@@ -138,35 +199,72 @@ void Ifx_Math_PLLF16_setPropGain(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q propGa
 
     /* polyspace +3 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
      * arithmetic." */
-    samplingTimeQ30 = (Ifx_Math_Fract32)((((sint64)self->p_samplingTime_us) << (sint8)Ifx_Math_FractQFormat_q30) /
+    samplingTimeQ30 = (Ifx_Math_Fract32)((((sint64)samplingTime_us) << (sint8)Ifx_Math_FractQFormat_q30) /
                                          IFX_MATH_MICROSECONDS_TO_SECONDS);
 
-    /* Calculate the proportional gain * sampling time, keeping the proportional gain Q format */
-    self->p_propGainSamplingTime = (Ifx_Math_Fract16)Ifx_Math_MulShR_F32(propGain.value, samplingTimeQ30,
+    /* Proportional gain * sampling time, keeping the proportional gain Q format */
+    return (Ifx_Math_Fract16)Ifx_Math_MulShR_F32(propGain.value, samplingTimeQ30,
         Ifx_Math_MulShR_ShiftMul(propGain.qFormat, Ifx_Math_FractQFormat_q30, Ifx_Math_FractQFormat_q15));
-    self->p_propGain             = propGain;
 }
 
 
-void Ifx_Math_PLLF16_setSamplingTime_us(Ifx_Math_PLLF16* self, uint32 samplingTime_us)
+void Ifx_Math_PLLF16_scaleRate(Ifx_Math_PLLF16* self, Ifx_Math_Fract32 rateRatioQ16)
+{
+    /* The latest input is the reference of the buffered angles */
+    uint8  latestIndex = (self->p_bufferIndex == 0U) ? (uint8)(IFX_MATH_CFG_PLL_DELAY_LENGTH - 1) :
+                         (uint8)(self->p_bufferIndex - 1U);
+    uint32 latest      = self->p_buffer[latestIndex];
+
+    for (int i = 0; i < IFX_MATH_CFG_PLL_DELAY_LENGTH; i++)
+    {
+        /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+         * arithmetic." */
+        sint64 distance = (sint64)(sint32)(latest - self->p_buffer[i]) * (sint64)rateRatioQ16;
+        self->p_buffer[i] = latest - (uint32)(sint32)(distance >> 16);
+    }
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+    /* The integral path is an angle variation per sampling time as well */
+    self->p_integral = Ifx_Math_Sat_F32_F64(((sint64)self->p_integral * (sint64)rateRatioQ16) >> 16);
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+}
+
+
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+void Ifx_Math_PLLF16_setIntegGain(Ifx_Math_PLLF16* self, Ifx_Math_Fract16Q integGain)
+{
+    /* Calculate the integral gain * sampling time^2 with the sampling time set before */
+    self->p_integGainSamplingTimeQ31 = Ifx_Math_PLLF16_calcIntegGainSamplingTime(integGain,
+        self->p_samplingTime_us);
+    self->p_integGain                = integGain;
+}
+
+
+Ifx_Math_Fract32 Ifx_Math_PLLF16_calcIntegGainSamplingTime(Ifx_Math_Fract16Q integGain, uint32 samplingTime_us)
 {
     /* Represents the sampling time in Q30 format */
     Ifx_Math_Fract32 samplingTimeQ30;
 
+    /* Integral gain * sampling time, in Q30 */
+    Ifx_Math_Fract32 integGainSamplingTimeQ30;
+
     /* Convert sampling time from microseconds to seconds, in Ifx_Math_FractQFormat_q30 */
 
-    /* polyspace +3 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+    /* polyspace +6 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
      * arithmetic." */
-    samplingTimeQ30 = (Ifx_Math_Fract32)((((sint64)samplingTime_us) << (sint8)Ifx_Math_FractQFormat_q30) /
-                                         IFX_MATH_MICROSECONDS_TO_SECONDS);
+    samplingTimeQ30          = (Ifx_Math_Fract32)((((sint64)samplingTime_us) << (sint8)Ifx_Math_FractQFormat_q30) /
+                                                  IFX_MATH_MICROSECONDS_TO_SECONDS);
+    integGainSamplingTimeQ30 = Ifx_Math_Sat_F32_F64(((sint64)integGain.value * (sint64)samplingTimeQ30) >>
+                                                    (sint8)integGain.qFormat);
 
-    /* Calculate the proportional gain * sampling time, keeping the integral proportional Q format */
-    self->p_propGainSamplingTime = (Ifx_Math_Fract16)Ifx_Math_MulShR_F32(self->p_propGain.value, samplingTimeQ30,
-        Ifx_Math_MulShR_ShiftMul(self->p_propGain.qFormat, Ifx_Math_FractQFormat_q30, Ifx_Math_FractQFormat_q15));
-    self->p_samplingTime_us      = samplingTime_us;
+    /* Integral gain * sampling time^2, from Q30 * Q30 to Q31 */
+    return Ifx_Math_Sat_F32_F64(((sint64)integGainSamplingTimeQ30 * (sint64)samplingTimeQ30) >> 29);
 }
 
 
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
+
 /* Calculate the average rate of change of the input angle */
 static inline Ifx_Math_Fract16 Ifx_Math_PLLF16_p_calcAvgRate(Ifx_Math_PLLF16* self, uint32 input)
 {
@@ -233,5 +331,24 @@ static inline void Ifx_Math_PLLF16_p_speedCalc(Ifx_Math_PLLF16* self, Ifx_Math_F
 }
 
 
+#if IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI
+
+/* Integrate the angle error */
+static inline Ifx_Math_Fract32 Ifx_Math_PLLF16_p_integCalc(Ifx_Math_PLLF16* self, Ifx_Math_Fract16 deltaPhiQ15)
+{
+    /* Angle error in the 32-bit angle format, i.e. shifted left by 16, * Ki * Ts^2 in Q31 */
+    Ifx_Math_Fract32 deltaIntegral = Ifx_Math_MulShR_F32((Ifx_Math_Fract32)deltaPhiQ15,
+        self->p_integGainSamplingTimeQ31, 15u);
+
+    /* Integration (Backward Euler), saturated to one half revolution per sampling time */
+    self->p_integral = Ifx_Math_AddSat_F32(self->p_integral, deltaIntegral);
+
+    return self->p_integral;
+}
+
+
+#endif /* IFX_MATH_CFG_PLL_TYPE == IFX_MATH_USROPT_PLL_TYPE_PI */
+
+
 /* polyspace-end MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
  * argument." */
@@ -10,34 +10,36 @@
 
 #include "Ifx_Math_Park.h"
 #include "Ifx_Math_MulSat.h"
-#include "Ifx_Math_Cos.h"
-#include "Ifx_Math_Sin.h"
+#include "Ifx_Math_SinCos.h"
 #include "Ifx_Math_AddSat.h"
 #include "Ifx_Math_SubSat.h"
 
 Ifx_Math_CmpFract16 Ifx_Math_Park_F16(Ifx_Math_CmpFract16 stationary, uint32 angle)
 {
     /* Declare data structure for return */
-    Ifx_Math_CmpFract16 parkOutput;
+    Ifx_Math_CmpFract16  parkOutput;
 
     /* Declare locals for grouping the operations */
     /* I_alpha * cos(theta) */
-    Ifx_Math_Fract16    iA;
+    Ifx_Math_Fract16     iA;
 
     /* I_beta * sin(theta) */
-    Ifx_Math_Fract16    iB;
+    Ifx_Math_Fract16     iB;
 
     /* I_beta * cos(theta) */
-    Ifx_Math_Fract16    iC;
+    Ifx_Math_Fract16     iC;
 
     /* I_alpha * sin(theta) */
-    Ifx_Math_Fract16    iD;
+    Ifx_Math_Fract16     iD;
+
+    /* sin(theta) and cos(theta) from one table index */
+    Ifx_Math_SinCos_Type sinCosTheta = Ifx_Math_SinCos_F16(angle);
 
     /* cos(theta) */
-    Ifx_Math_Fract16    cosTheta = Ifx_Math_Cos_F16(angle);
+    Ifx_Math_Fract16     cosTheta = sinCosTheta.cos;
 
     /* sin(theta) */
-    Ifx_Math_Fract16    sinTheta = Ifx_Math_Sin_F16(angle);
+    Ifx_Math_Fract16     sinTheta = sinCosTheta.sin;
 
     /* Calculate the local operations group "I_alpha * cos(theta)" */
     iA = Ifx_Math_MulSat_F16(stationary.real, cosTheta);
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2022 Infineon Technologies AG. All Rights Reserved.
+ *
+ * Use of this file is subject to the terms of use agreed between (i) you or the company in which ordinary course of
+ * business you are acting and (ii) Infineon Technologies AG, its affiliates or its licensees. If and as long as no
+ * such terms of use are agreed, use of this file is subject to the Evaluation Software License Agreement distributed
+ * along with this file within the software delivery package.
+ *
+ */
+
+/**
+ * \file Ifx_Math_PiConstF16.h
+ * \brief PI controller with the Q formats of its gains fixed at compile time.
+ *
+ * Ifx_Math_PiF16_execute() takes the shifts of the gain products from the instance, where Ifx_Math_PiF16_init()
+ * derived them from the Q formats, and is called through a function call. IFX_MATH_PICONSTF16_DEFINE() generates an
+ * inline execute function for one instance with these shifts as constants, in the discretization and anti-windup method
+ * selected by IFX_MATH_CFG_PI_DISC and IFX_MATH_CFG_PI_ANTI_WIND. It works on the same Ifx_Math_PiF16 data structure,
+ * which is initialized and parameterized with the Ifx_Math_PiF16 API as before, and its output and state are bit
+ * identical to those of Ifx_Math_PiF16_execute() as long as the Q formats passed to both are the same.
+ */
+
+#ifndef IFX_MATH_PICONSTF16_H
+#define IFX_MATH_PICONSTF16_H
+#include "Ifx_Math.h"
+#include "Ifx_Math_PiF16.h"
+#include "Ifx_Math_MulShR.h"
+#include "Ifx_Math_Add.h"
+#include "Ifx_Math_Sub.h"
+#include "Ifx_Math_Sat.h"
+
+/* Sampling time divider of the integral and anti-windup gain, the trapezoidal method integrates twice per call */
+#if IFX_MATH_CFG_PI_DISC == IFX_MATH_USROPT_PI_DISC_TRAPEZOIDAL
+#define IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER (1)
+#else
+#define IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER (0)
+#endif
+
+/**
+ * \brief Right shift of a gain product into the intermediate Q format of the PI controller, which is the Q format of
+ * the output plus 9, see Ifx_Math_PiF16_init(). Counterpart of Ifx_Math_MulShR_ShiftMul() for constant expressions.
+ */
+#define IFX_MATH_PICONSTF16_SHIFT(qFormatGain, qFormatError, qFormatOutput)                                   \
+    ((((qFormatGain) + (qFormatError)) >= ((qFormatOutput) + (uint8)Ifx_Math_FractQFormat_q9)) ?             \
+     (((qFormatGain) + (qFormatError)) - ((qFormatOutput) + (uint8)Ifx_Math_FractQFormat_q9)) : 0U)
+
+/**
+ * \brief Generates the execute function of one PI controller instance.
+ *
+ * The generated function has the signature of Ifx_Math_PiF16_execute(). The Q formats are those passed to
+ * Ifx_Math_PiF16_init() for the instance, as integer constant expressions.
+ *
+ * \param name Name of the generated function
+ * \param qFormatPropGain Q format of the proportional gain
+ * \param qFormatIntegGainSamplingTime Q format of the integral gain times the sampling time
+ * \param qFormatAntiWindupGainSamplingTime Q format of the anti-windup gain times the sampling time
+ * \param qFormatError Q format of the input error
+ * \param qFormatOutput Q format of the output
+ */
+#define IFX_MATH_PICONSTF16_DEFINE(name, qFormatPropGain, qFormatIntegGainSamplingTime,                           \
+                                   qFormatAntiWindupGainSamplingTime, qFormatError, qFormatOutput)                \
+    static inline Ifx_Math_Fract16 name(Ifx_Math_PiF16* self, Ifx_Math_Fract16 errorValue, sint8 antiWindupCtrl) \
+    {                                                                                                             \
+        return Ifx_Math_PiConstF16_execute(self, errorValue, antiWindupCtrl,                                      \
+            (uint8)IFX_MATH_PICONSTF16_SHIFT((qFormatPropGain), (qFormatError), (qFormatOutput)),                 \
+            (uint8)(IFX_MATH_PICONSTF16_SHIFT((qFormatIntegGainSamplingTime), (qFormatError), (qFormatOutput)) + \
+                    IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER),                                                   \
+            (uint8)((qFormatAntiWindupGainSamplingTime) + IFX_MATH_PICONSTF16_SAMPLING_TIME_DIVIDER));            \
+    }
+
+/* polyspace-begin MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
+ * argument." */
+
+/**
+ *  \brief Saturate the state of the integrator between the output limits.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *
+ */
+static inline void Ifx_Math_PiConstF16_p_saturatePreviousValue(Ifx_Math_PiF16* self)
+{
+    /* Limits of the state, in the intermediate Q format */
+    Ifx_Math_Fract32 previousValueTempUpp = Ifx_Math_ShL_F32(self->p_upperLimit, (uint8)Ifx_Math_FractQFormat_q9);
+    Ifx_Math_Fract32 previousValueTempLow = Ifx_Math_ShL_F32(self->p_lowerLimit, (uint8)Ifx_Math_FractQFormat_q9);
+
+    if (self->p_integPreviousValue > previousValueTempUpp)
+    {
+        self->p_integPreviousValue = previousValueTempUpp;
+    }
+    else if (self->p_integPreviousValue < previousValueTempLow)
+    {
+        self->p_integPreviousValue = previousValueTempLow;
+    }
+    else
+    {
+        /* Within the limits */
+    }
+}
+
+
+/**
+ *  \brief Saturate the output between the output limits and update the saturation status.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] out Unsaturated output
+ *
+ *  \return Saturated output
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_PiConstF16_p_saturateOutput(Ifx_Math_PiF16* self, Ifx_Math_Fract16 out)
+{
+    Ifx_Math_Fract16 outSat;
+
+    if (out >= self->p_upperLimit)
+    {
+        outSat                   = self->p_upperLimit;
+        self->p_saturationStatus = 1;
+    }
+    else if (out <= self->p_lowerLimit)
+    {
+        outSat                   = self->p_lowerLimit;
+        self->p_saturationStatus = -1;
+    }
+    else
+    {
+        outSat                   = out;
+        self->p_saturationStatus = 0;
+    }
+
+    return outSat;
+}
+
+
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP
+
+/**
+ *  \brief Check the internal (saturation status) and external anti-windup condition of the clamping.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] errorValue Input error
+ *  \param [in] antiWindupCtrl Antiwindup control input
+ *
+ *  \return 1 if the integrator may integrate the error, else 0
+ */
+static inline sint8 Ifx_Math_PiConstF16_p_antiWindupControl(Ifx_Math_PiF16* self, Ifx_Math_Fract16 errorValue, sint8
+                                                            antiWindupCtrl)
+{
+    sint8 antiWindupCtrlIntern = 0;
+    sint8 antiWindupCtrlExtern = 0;
+
+    if ((0 == self->p_saturationStatus)
+        || ((0 > errorValue) && (1 == self->p_saturationStatus))
+        || ((0 < errorValue) && (-1 == self->p_saturationStatus)))
+    {
+        antiWindupCtrlIntern = 1;
+    }
+
+    if ((0 == antiWindupCtrl)
+        || ((0 > errorValue) && (1 == antiWindupCtrl))
+        || ((0 < errorValue) && (-1 == antiWindupCtrl)))
+    {
+        antiWindupCtrlExtern = 1;
+    }
+
+    return antiWindupCtrlExtern * antiWindupCtrlIntern;
+}
+
+
+#endif
+
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+
+/**
+ *  \brief Calculate the anti-windup part of the back calculation.
+ *
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] value Unsaturated output in the intermediate Q format
+ *  \param [in] antiWindupShift Right shift of the anti-windup gain product
+ *
+ *  \return Anti-windup part in the intermediate Q format
+ */
+static inline Ifx_Math_Fract32 Ifx_Math_PiConstF16_p_backCalculation(Ifx_Math_PiF16* self, Ifx_Math_Fract32 value,
+                                                                     uint8 antiWindupShift)
+{
+    /* Limits of the state, in the intermediate Q format */
+    Ifx_Math_Fract32 integStateTempUpp = Ifx_Math_ShL_F32(self->p_upperLimit, (uint8)Ifx_Math_FractQFormat_q9);
+    Ifx_Math_Fract32 integStateTempLow = Ifx_Math_ShL_F32(self->p_lowerLimit, (uint8)Ifx_Math_FractQFormat_q9);
+    Ifx_Math_Fract32 coefficient       = 0;
+
+    if (value > integStateTempUpp)
+    {
+        coefficient = Ifx_Math_MulShR_F32(self->p_antiWindupGainSamplingTime.value, Ifx_Math_Sub_F32(integStateTempUpp,
+            value), antiWindupShift);
+    }
+    else if (value < integStateTempLow)
+    {
+        coefficient = Ifx_Math_MulShR_F32(self->p_antiWindupGainSamplingTime.value, Ifx_Math_Sub_F32(integStateTempLow,
+            value), antiWindupShift);
+    }
+    else
+    {
+        /* No anti-windup within the limits */
+    }
+
+    return coefficient;
+}
+
+
+#endif
+
+/**
+ *  \brief Execute the PI controller with the given shifts of the gain products.
+ *
+ *  Called by the functions generated with IFX_MATH_PICONSTF16_DEFINE() with constant shifts, which the compiler then
+ * folds into the shift instructions.
+ *
+ *  \param [inout] self Reference to structure that contains instance data members
+ *  \param [in] errorValue Input error
+ *  \param [in] antiWindupCtrl Antiwindup control input, used by the clamping only
+ *  \param [in] propShift Right shift of the proportional gain product
+ *  \param [in] integShift Right shift of the integral gain product
+ *  \param [in] antiWindupShift Right shift of the anti-windup gain product, used by the back calculation only
+ *
+ *  \return PI controller output
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_PiConstF16_execute(Ifx_Math_PiF16* self, Ifx_Math_Fract16 errorValue, sint8
+                                                           antiWindupCtrl, uint8 propShift, uint8 integShift, uint8
+                                                           antiWindupShift)
+{
+    /* (Proportional gain * input error) and (integral gain * input error) */
+    Ifx_Math_Fract32 propGainError  = Ifx_Math_MulShR_F32_F16F16(self->p_propGain.value, errorValue, propShift);
+    Ifx_Math_Fract32 integGainError = Ifx_Math_MulShR_F32_F16F16(self->p_integGainSamplingTime.value, errorValue,
+        integShift);
+
+    /* Unsaturated and saturated output */
+    Ifx_Math_Fract16 out;
+    Ifx_Math_Fract16 outSat;
+#if (IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP) && \
+    (IFX_MATH_CFG_PI_DISC != IFX_MATH_USROPT_PI_DISC_FORWARD)
+
+    /* Integral gain * input error, if the clamping with the saturation status of the previous call allows it */
+    Ifx_Math_Fract32 integGainErrorSwitched = integGainError * Ifx_Math_PiConstF16_p_antiWindupControl(self,
+        errorValue, antiWindupCtrl);
+#elif IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+
+    /* Anti windup part */
+    Ifx_Math_Fract32 antiWindup = Ifx_Math_PiConstF16_p_backCalculation(self, Ifx_Math_Add_F32(propGainError,
+        self->p_integPreviousValue), antiWindupShift);
+#endif
+#if IFX_MATH_CFG_PI_ANTI_WIND != IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP
+
+    (void)antiWindupCtrl;
+#endif
+#if IFX_MATH_CFG_PI_ANTI_WIND != IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+
+    (void)antiWindupShift;
+#endif
+#if IFX_MATH_CFG_PI_DISC == IFX_MATH_USROPT_PI_DISC_TRAPEZOIDAL
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP
+
+    /* Half integration before and after the output, each followed by the clamping of the state */
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainErrorSwitched, self->p_integPreviousValue);
+    Ifx_Math_PiConstF16_p_saturatePreviousValue(self);
+    out                        = Ifx_Math_Sat_F16_F32(Ifx_Math_ShR_F32(Ifx_Math_Add_F32(propGainError,
+        self->p_integPreviousValue), (uint8)Ifx_Math_FractQFormat_q9));
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainErrorSwitched, self->p_integPreviousValue);
+    Ifx_Math_PiConstF16_p_saturatePreviousValue(self);
+    outSat                     = Ifx_Math_PiConstF16_p_saturateOutput(self, out);
+#else
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+
+    /* Half integration before and after the output, the anti-windup part is added to both */
+    Ifx_Math_Fract32 integGainErrorPrevVal = Ifx_Math_Add_F32(antiWindup, Ifx_Math_Add_F32(integGainError,
+        self->p_integPreviousValue));
+    integGainError = Ifx_Math_Add_F32(antiWindup, integGainError);
+#else
+
+    /* Half integration before and after the output */
+    Ifx_Math_Fract32 integGainErrorPrevVal = Ifx_Math_Add_F32(integGainError, self->p_integPreviousValue);
+#endif
+    out                        = Ifx_Math_Sat_F16_F32(Ifx_Math_ShR_F32(Ifx_Math_Add_F32(propGainError,
+        integGainErrorPrevVal), (uint8)Ifx_Math_FractQFormat_q9));
+    outSat                     = Ifx_Math_PiConstF16_p_saturateOutput(self, out);
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainError, integGainErrorPrevVal);
+#endif
+#elif IFX_MATH_CFG_PI_DISC == IFX_MATH_USROPT_PI_DISC_FORWARD
+
+    /* Output from the previous state, then integration */
+    out    = Ifx_Math_Sat_F16_F32(Ifx_Math_ShR_F32(Ifx_Math_Add_F32(propGainError, self->p_integPreviousValue),
+        (uint8)Ifx_Math_FractQFormat_q9));
+    outSat = Ifx_Math_PiConstF16_p_saturateOutput(self, out);
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP
+
+    /* The clamping uses the saturation status of this call */
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainError * Ifx_Math_PiConstF16_p_antiWindupControl(self,
+        errorValue, antiWindupCtrl), self->p_integPreviousValue);
+    Ifx_Math_PiConstF16_p_saturatePreviousValue(self);
+#elif IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+    self->p_integPreviousValue = Ifx_Math_Add_F32(self->p_integPreviousValue, Ifx_Math_Add_F32(integGainError,
+        antiWindup));
+#else
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainError, self->p_integPreviousValue);
+#endif
+#elif IFX_MATH_CFG_PI_DISC == IFX_MATH_USROPT_PI_DISC_BACKWARD
+#if IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_CLAMP
+
+    /* Integration, then output from the new state */
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainErrorSwitched, self->p_integPreviousValue);
+    Ifx_Math_PiConstF16_p_saturatePreviousValue(self);
+#elif IFX_MATH_CFG_PI_ANTI_WIND == IFX_MATH_USROPT_PI_ANTI_WIND_BACK_CALC
+
+    /* Integration, then output from the new state */
+    self->p_integPreviousValue = Ifx_Math_Add_F32(self->p_integPreviousValue, Ifx_Math_Add_F32(integGainError,
+        antiWindup));
+#else
+
+    /* Integration, then output from the new state */
+    self->p_integPreviousValue = Ifx_Math_Add_F32(integGainError, self->p_integPreviousValue);
+#endif
+    out    = Ifx_Math_Sat_F16_F32(Ifx_Math_ShR_F32(Ifx_Math_Add_F32(propGainError, self->p_integPreviousValue),
+        (uint8)Ifx_Math_FractQFormat_q9));
+    outSat = Ifx_Math_PiConstF16_p_saturateOutput(self, out);
+#endif
+
+    return outSat;
+}
+
+
+/* polyspace-end MISRA2012:D4.14 [Justified:Low] "The caller function has to guarantee that NULL is not passed as
+ * argument." */
+
+#endif /*IFX_MATH_PICONSTF16_H*/
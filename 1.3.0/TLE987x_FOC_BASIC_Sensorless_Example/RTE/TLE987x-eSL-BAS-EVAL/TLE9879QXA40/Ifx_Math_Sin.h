@@ -22,6 +22,100 @@
  */
 #define IFX_MATH_SIN_ANGLE_TO_INDEX (16 - IFX_MATH_CFG_SIN_LUT_SIZE)
 
+#if IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED
+
+/**
+ * Angle of \f$\pi/2\f$, normalized by \f$2*\pi\f$
+ */
+#define IFX_MATH_SIN_QUARTER_ANGLE       (1UL << 30)
+
+/**
+ * Converts an angle within a quadrant to the index of the quarter wave lookup table
+ */
+#define IFX_MATH_SIN_QUARTER_TO_INDEX    (32U - IFX_MATH_CFG_SIN_LUT_SIZE)
+
+/**
+ * Converts an angle within a quadrant to the Q15 interpolation fraction between two table entries
+ */
+#define IFX_MATH_SIN_QUARTER_TO_FRACTION (IFX_MATH_SIN_QUARTER_TO_INDEX - 15U)
+
+/**
+ * Lookup table between \f$sin(0)\f$ and \f$sin(\pi/2)\f$ in Q15, followed by the mirrored entry before \f$sin(\pi/2)\f$
+ */
+extern const Ifx_Math_Fract16 Ifx_Math_Lut_SinQuarter_F16_table[];
+
+/**
+ *  \brief Calculate the sinus value of an angle within the first quadrant.
+ *
+ *  The sinus is linearly interpolated between the two neighbouring entries of the quarter wave table, with the 15 angle
+ * bits below the table index as fraction. Used by Ifx_Math_Sin_F16() and Ifx_Math_SinCos_F16() of mode
+ * IFX_MATH_USROPT_SIN_MODE_INTERPOLATED.
+ *
+ *  \param [in] x 32-bit angle value, in the range \f$[0, \pi/2]\f$, normalized by\f$2*\pi\f$
+ *
+ *  \return 16-bit sinus value in Q15 format
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_SinQuarter_F16(uint32 x)
+{
+    /* Table index and interpolation fraction of the angle */
+    uint32           tableIndex = x >> IFX_MATH_SIN_QUARTER_TO_INDEX;
+    Ifx_Math_Fract32 fraction   = (Ifx_Math_Fract32)((x >> IFX_MATH_SIN_QUARTER_TO_FRACTION) & 0x7FFFUL);
+
+    /* Difference to the next table entry */
+    Ifx_Math_Fract32 slope = (Ifx_Math_Fract32)Ifx_Math_Lut_SinQuarter_F16_table[tableIndex + 1U]
+                             - (Ifx_Math_Fract32)Ifx_Math_Lut_SinQuarter_F16_table[tableIndex];
+
+    /* polyspace +2 MISRA2012:10.1 [Justified:Low] "Bitwise operators on signed values are required by fixed point
+     * arithmetic." */
+    return (Ifx_Math_Fract16)(Ifx_Math_Lut_SinQuarter_F16_table[tableIndex]
+                              + (((slope * fraction) + (1L << 14)) >> 15));
+}
+
+
+/**
+ *  \brief Calculate the sinus value of the 32-bit input angle.
+ *
+ *  This function calculates the sinus value of a 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized
+ * by\f$2*\pi\f$. The angle is folded into the first quadrant and the sinus is interpolated between the entries of a
+ * quarter wave lookup table, see Ifx_Math_SinQuarter_F16(). The resolution of the table is configurable by
+ * IFX_MATH_CFG_SIN_LUT_SIZE, the number of table intervals per period as in mode IFX_MATH_USROPT_SIN_MODE_LUT. The
+ * valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE = {IFX_MATH_USROPT_SIN_LUT_SIZE_8;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_9; IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_11;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ *
+ *  \param [in] x 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized by\f$2*\pi\f$
+ *
+ *  \return 16-bit sinus value in Q15 format
+ */
+static inline Ifx_Math_Fract16 Ifx_Math_Sin_F16(uint32 x)
+{
+    /* Stores the sinus output */
+    Ifx_Math_Fract16 sinOutput;
+
+    /* Quadrant of the angle and angle within the quadrant */
+    uint32           quadrant = x >> 30;
+    uint32           position = x & (IFX_MATH_SIN_QUARTER_ANGLE - 1UL);
+
+    /* sin(pi/2 + theta) = sin(pi/2 - theta) in the second and fourth quadrant */
+    if ((quadrant & 1UL) != 0UL)
+    {
+        position = IFX_MATH_SIN_QUARTER_ANGLE - position;
+    }
+
+    sinOutput = Ifx_Math_SinQuarter_F16(position);
+
+    /* sin(pi + theta) = -sin(theta) in the third and fourth quadrant */
+    if ((quadrant & 2UL) != 0UL)
+    {
+        sinOutput = -sinOutput;
+    }
+
+    return sinOutput;
+}
+
+
+#else
+
 /**
  * Lookup table between \f$sin(0)\f$ and \f$sin(2*\pi)\f$ in Q15
  */
@@ -33,7 +127,8 @@ extern const Ifx_Math_Fract16 Ifx_Math_Lut_Sincos_F16_table[];
  *  This function calculates the sinus value of a 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized
  * by\f$2*\pi\f$. The output resolution is configurable by controlling the sine lookup table size. The size of the
  * lookup table is given by IFX_MATH_CFG_SIN_LUT_SIZE. The valid configuration set is: IFX_MATH_CFG_SIN_LUT_SIZE =
- * {IFX_MATH_USROPT_SIN_LUT_SIZE_8; IFX_MATH_USROPT_SIN_LUT_SIZE_10; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
+ * {IFX_MATH_USROPT_SIN_LUT_SIZE_8; IFX_MATH_USROPT_SIN_LUT_SIZE_9; IFX_MATH_USROPT_SIN_LUT_SIZE_10;
+ * IFX_MATH_USROPT_SIN_LUT_SIZE_11; IFX_MATH_USROPT_SIN_LUT_SIZE_12}.
  *
  *  \param [in] x 32-bit angle value, in the range \f$[0, 2*\pi]\f$, normalized by\f$2*\pi\f$
  *
@@ -58,4 +153,6 @@ static inline Ifx_Math_Fract16 Ifx_Math_Sin_F16(uint32 x)
 }
 
 
+#endif /* IFX_MATH_CFG_SIN_MODE == IFX_MATH_USROPT_SIN_MODE_INTERPOLATED */
+
 #endif /*IFX_MATH_SIN_H*/